@@ -0,0 +1,503 @@
+/**
+ * @file    audit.c
+ * @brief   门锁审计日志
+ * @details 记录开锁、密码错误与上锁事件，保存在 FAL "audit" 分区中：
+ *          - 分区按擦除扇区组成环形日志，每个扇区以扇区头开始(扇区序号、首条记录时间)，
+ *            其后为顺序写入的 16 字节记录；写满后擦除最旧的扇区继续写
+ *          - audit_log() 只把记录放入 RAM 暂存区，不访问 Flash，可在按键线程中直接调用
+ *          - audit 线程在暂存记录凑满一个 NOR 页时提交，一连串事件只产生一次页编程；
+ *            不足一页的记录最多暂存 AUDIT_FLUSH_MS 后提交
+ *          - 内存中保存每个扇区的首条记录时间(稀疏时间索引)，按时间范围查询时
+ *            只读取时间范围有重叠的扇区
+ * @date    2025-12-20
+ *
+ * 时间戳：启用 RTC 时为 time() 秒数；否则为运行秒数，启动时从上一条记录的时间继续，
+ * 保证日志中的时间不减小。暂存区中尚未提交的记录在掉电时丢失。
+ *
+ * msh 命令：
+ *   audit                  显示日志状态
+ *   audit <t1> <t2>        列出时间在 [t1, t2] 内的记录
+ *   audit recent [秒]      列出最近一段时间的记录，默认 600 秒
+ */
+
+#include "audit.h"
+#include <rtdevice.h>
+#include <stdlib.h>
+
+#ifdef RT_USING_FAL
+#include <fal.h>
+#endif
+#ifdef RT_USING_RTC
+#include <time.h>
+#endif
+
+#ifdef RT_USING_FAL
+
+#define AUDIT_REC_SIZE      sizeof(audit_rec_t)
+#define AUDIT_PAGE_RECS     (AUDIT_PAGE_SIZE / AUDIT_REC_SIZE)
+#define AUDIT_MAGIC         0x48445541  /* "AUDH" */
+#define AUDIT_MAX_SECTORS   256         /* 时间索引容量，分区扇区数超出时只使用前面部分 */
+#define AUDIT_READ_RECS     16          /* 扫描时每次读取的记录数 */
+
+#define AUDIT_EVT_PAGE      (1 << 0)    /* 暂存记录已凑满当前页 */
+#define AUDIT_EVT_FIRST     (1 << 1)    /* 暂存区由空变为非空，重新计算提交超时 */
+
+/* 扇区头，与记录同样大小 */
+typedef struct
+{
+    rt_uint32_t magic;
+    rt_uint32_t seq;                    /* 扇区序号，每打开一个扇区加 1，最大的为当前扇区 */
+    rt_uint32_t time;                   /* 扇区内首条记录的时间 */
+    rt_uint32_t check;
+} audit_head_t;
+
+/* 扇区时间索引，seq 为 0 表示扇区无效 */
+typedef struct
+{
+    rt_uint32_t seq;
+    rt_uint32_t time;
+} audit_sector_t;
+
+static const struct fal_partition *audit_part = RT_NULL;
+static rt_uint32_t audit_sector_size;
+static rt_uint32_t audit_sectors;
+static audit_sector_t audit_index[AUDIT_MAX_SECTORS];
+static rt_uint32_t audit_cur;           /* 当前扇区 */
+static rt_uint32_t audit_off;           /* 当前扇区内的写入偏移 */
+static rt_uint32_t audit_last;          /* 最后一条已提交记录的时间 */
+static rt_uint32_t audit_base;          /* 无 RTC 时本次启动的起始时间 */
+
+/* RAM 暂存区：多个线程写入，audit 线程读出 */
+static audit_rec_t audit_buf[AUDIT_BUF_RECS];
+static volatile rt_uint32_t audit_in;   /* 写入计数 */
+static volatile rt_uint32_t audit_out;  /* 提交计数 */
+static volatile rt_uint32_t audit_room = AUDIT_PAGE_RECS;  /* 当前页剩余记录数 */
+static rt_tick_t audit_first_tick;      /* 暂存区由空变为非空的时刻 */
+
+/* 统计 */
+static rt_uint32_t audit_dropped;       /* 暂存区满丢弃的记录数 */
+static rt_uint32_t audit_programs;      /* 页编程次数 */
+static rt_uint32_t audit_erases;        /* 扇区擦除次数 */
+
+static struct rt_event audit_event;
+static struct rt_mutex audit_lock;      /* Flash 访问互斥 */
+static rt_uint8_t audit_ready = 0;
+
+/* FNV-1a 校验，覆盖 check 之前的 12 字节 */
+static rt_uint32_t audit_check(const void *rec)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)rec;
+    rt_uint32_t h = 2166136261UL;
+    int i;
+
+    for (i = 0; i < (int)AUDIT_REC_SIZE - 4; i++)
+    {
+        h = (h ^ p[i]) * 16777619UL;
+    }
+    return h;
+}
+
+/* 记录区域是否从未写入 */
+static rt_bool_t audit_blank(const audit_rec_t *rec)
+{
+    const rt_uint32_t *p = (const rt_uint32_t *)rec;
+
+    return (p[0] & p[1] & p[2] & p[3]) == 0xFFFFFFFF;
+}
+
+static rt_uint32_t audit_now(void)
+{
+#ifdef RT_USING_RTC
+    time_t t = time(RT_NULL);
+
+    if (t != (time_t)-1) return (rt_uint32_t)t;
+#endif
+    return audit_base + rt_tick_get() / RT_TICK_PER_SECOND;
+}
+
+/* 擦除扇区并写入扇区头，成为当前扇区 */
+static rt_err_t audit_open(rt_uint32_t sector, rt_uint32_t seq, rt_uint32_t time)
+{
+    audit_head_t head;
+
+    audit_index[sector].seq = 0;
+    audit_erases++;
+    if (fal_partition_erase(audit_part, sector * audit_sector_size, audit_sector_size) < 0) return -RT_EIO;
+
+    head.magic = AUDIT_MAGIC;
+    head.seq = seq;
+    head.time = time;
+    head.check = audit_check(&head);
+    if (fal_partition_write(audit_part, sector * audit_sector_size, (const rt_uint8_t *)&head, sizeof(head)) < 0)
+    {
+        return -RT_EIO;
+    }
+    audit_index[sector].seq = seq;
+    audit_index[sector].time = time;
+    audit_cur = sector;
+    audit_off = sizeof(head);
+    audit_room = AUDIT_PAGE_RECS - 1;
+    return RT_EOK;
+}
+
+/**
+ * @brief  把暂存记录写入 Flash，调用者持有 audit_lock
+ * @param  all: RT_FALSE 只提交能填满当前页的记录；RT_TRUE 全部提交
+ * @note   每次写入不跨页，一页只需一次编程；扇区写满时打开下一个扇区
+ */
+static void audit_commit(rt_bool_t all)
+{
+    audit_rec_t page[AUDIT_PAGE_RECS];
+    rt_uint32_t n, room, i;
+
+    while ((n = audit_in - audit_out) > 0)
+    {
+        if (audit_off >= audit_sector_size)
+        {
+            rt_uint32_t next = (audit_cur + 1) % audit_sectors;
+
+            if (audit_open(next, audit_index[audit_cur].seq + 1,
+                           audit_buf[audit_out % AUDIT_BUF_RECS].time) != RT_EOK)
+            {
+                rt_kprintf("audit: erase sector %u failed\n", next);
+                return;
+            }
+        }
+
+        room = (AUDIT_PAGE_SIZE - audit_off % AUDIT_PAGE_SIZE) / AUDIT_REC_SIZE;
+        if (n < room && !all) return;
+        if (n > room) n = room;
+
+        /* 生产者只写入空闲位置，已写入的记录在 audit_out 前进之前不会被改写 */
+        for (i = 0; i < n; i++)
+        {
+            page[i] = audit_buf[(audit_out + i) % AUDIT_BUF_RECS];
+        }
+        if (fal_partition_write(audit_part, audit_cur * audit_sector_size + audit_off,
+                                (const rt_uint8_t *)page, n * AUDIT_REC_SIZE) < 0)
+        {
+            rt_kprintf("audit: program failed at sector %u offset %u\n", audit_cur, audit_off);
+        }
+        audit_programs++;
+        audit_off += n * AUDIT_REC_SIZE;
+        audit_last = page[n - 1].time;
+        audit_room = (audit_off % AUDIT_PAGE_SIZE) ? (AUDIT_PAGE_SIZE - audit_off % AUDIT_PAGE_SIZE) / AUDIT_REC_SIZE
+                                                   : AUDIT_PAGE_RECS;
+        audit_out += n;
+    }
+}
+
+/**
+ * @brief  逐条读取扇区中的记录
+ * @param  end: 扫描到的扇区内偏移
+ * @retval 第一个空白记录的偏移，扫描到 end 时返回 end
+ */
+static rt_uint32_t audit_scan(rt_uint32_t sector, rt_uint32_t end,
+                              void (*fn)(const audit_rec_t *rec, void *parameter), void *parameter)
+{
+    audit_rec_t buf[AUDIT_READ_RECS];
+    rt_uint32_t off = sizeof(audit_head_t);
+    rt_uint32_t base = sector * audit_sector_size;
+    rt_uint32_t i, n;
+
+    while (off < end)
+    {
+        n = (end - off) / AUDIT_REC_SIZE;
+        if (n > AUDIT_READ_RECS) n = AUDIT_READ_RECS;
+        if (fal_partition_read(audit_part, base + off, (rt_uint8_t *)buf, n * AUDIT_REC_SIZE) < 0) break;
+        for (i = 0; i < n; i++, off += AUDIT_REC_SIZE)
+        {
+            if (audit_blank(&buf[i])) return off;
+            if (buf[i].check == audit_check(&buf[i])) fn(&buf[i], parameter);
+        }
+    }
+    return off;
+}
+
+static void audit_mount_last(const audit_rec_t *rec, void *parameter)
+{
+    audit_last = rec->time;
+}
+
+/* 读取所有扇区头建立时间索引，找到当前扇区与写入位置 */
+static rt_err_t audit_mount(void)
+{
+    audit_head_t head;
+    rt_uint32_t s, seq = 0;
+
+    for (s = 0; s < audit_sectors; s++)
+    {
+        audit_index[s].seq = 0;
+        if (fal_partition_read(audit_part, s * audit_sector_size, (rt_uint8_t *)&head, sizeof(head)) < 0) continue;
+        if (head.magic != AUDIT_MAGIC || head.check != audit_check(&head) || head.seq == 0) continue;
+        audit_index[s].seq = head.seq;
+        audit_index[s].time = head.time;
+        if (head.seq > seq)
+        {
+            seq = head.seq;
+            audit_cur = s;
+        }
+    }
+    if (seq == 0)
+    {
+        audit_last = 0;
+        return audit_open(0, 1, audit_now());
+    }
+
+    audit_last = audit_index[audit_cur].time;
+    audit_off = audit_scan(audit_cur, audit_sector_size, audit_mount_last, RT_NULL);
+    audit_room = (audit_off % AUDIT_PAGE_SIZE) ? (AUDIT_PAGE_SIZE - audit_off % AUDIT_PAGE_SIZE) / AUDIT_REC_SIZE
+                                               : AUDIT_PAGE_RECS;
+    return RT_EOK;
+}
+
+/* 提交线程：凑满一页或暂存超时后写入 */
+static void audit_thread_entry(void *parameter)
+{
+    rt_int32_t timeout;
+    rt_tick_t elapsed;
+    rt_err_t ret;
+
+    while (1)
+    {
+        timeout = RT_WAITING_FOREVER;
+        if (audit_in != audit_out)
+        {
+            elapsed = rt_tick_get() - audit_first_tick;
+            timeout = (elapsed >= rt_tick_from_millisecond(AUDIT_FLUSH_MS)) ? 0 :
+                      (rt_int32_t)(rt_tick_from_millisecond(AUDIT_FLUSH_MS) - elapsed);
+        }
+        ret = rt_event_recv(&audit_event, AUDIT_EVT_PAGE | AUDIT_EVT_FIRST,
+                            RT_EVENT_FLAG_OR | RT_EVENT_FLAG_CLEAR, timeout, RT_NULL);
+
+        rt_mutex_take(&audit_lock, RT_WAITING_FOREVER);
+        audit_commit(ret == -RT_ETIMEOUT);
+        rt_mutex_release(&audit_lock);
+    }
+}
+
+#endif /* RT_USING_FAL */
+
+/* ===================== 对外接口 ===================== */
+
+/**
+ * @brief  初始化审计日志
+ * @retval RT_EOK: 成功；其它: 分区不可用，audit_log() 不做任何事
+ * @note   需要在 FAL 初始化之后调用
+ */
+int audit_init(void)
+{
+#ifdef RT_USING_FAL
+    const struct fal_flash_dev *flash;
+    rt_thread_t tid;
+
+    audit_part = fal_partition_find(AUDIT_PART_NAME);
+    flash = audit_part ? fal_flash_device_find(audit_part->flash_name) : RT_NULL;
+    if (flash == RT_NULL)
+    {
+        rt_kprintf("audit: partition %s not found, audit log disabled\n", AUDIT_PART_NAME);
+        return -RT_ERROR;
+    }
+    audit_sector_size = flash->blk_size;
+    audit_sectors = audit_part->len / audit_sector_size;
+    if (audit_sectors > AUDIT_MAX_SECTORS) audit_sectors = AUDIT_MAX_SECTORS;
+    if (audit_sectors < 2 || audit_sector_size % AUDIT_PAGE_SIZE != 0) return -RT_EINVAL;
+
+    rt_mutex_init(&audit_lock, "audit", RT_IPC_FLAG_PRIO);
+    rt_event_init(&audit_event, "audit", RT_IPC_FLAG_PRIO);
+    if (audit_mount() != RT_EOK)
+    {
+        rt_kprintf("audit: %s unusable, audit log disabled\n", AUDIT_PART_NAME);
+        return -RT_EIO;
+    }
+    audit_base = audit_last + 1;  /* 无 RTC 时从上次最后的时间继续 */
+
+    tid = rt_thread_create("audit", audit_thread_entry, RT_NULL, 1536, AUDIT_THREAD_PRIO, 10);
+    if (tid == RT_NULL) return -RT_ENOMEM;
+    rt_thread_startup(tid);
+    audit_ready = 1;
+    return RT_EOK;
+#else
+    return -RT_ENOSYS;
+#endif
+}
+
+/**
+ * @brief  记录一条审计事件
+ * @note   只写入 RAM 暂存区，不访问 Flash；暂存区满时丢弃并计数
+ */
+void audit_log(rt_uint16_t user, rt_uint8_t result, rt_uint8_t method, rt_uint32_t arg)
+{
+#ifdef RT_USING_FAL
+    audit_rec_t *rec;
+    rt_uint32_t now, n;
+    rt_base_t level;
+
+    if (!audit_ready) return;
+    now = audit_now();
+
+    level = rt_hw_interrupt_disable();
+    n = audit_in - audit_out;
+    if (n >= AUDIT_BUF_RECS)
+    {
+        audit_dropped++;
+        rt_hw_interrupt_enable(level);
+        return;
+    }
+    if (n == 0) audit_first_tick = rt_tick_get();
+    rec = &audit_buf[audit_in % AUDIT_BUF_RECS];
+    rec->time = now;
+    rec->user = user;
+    rec->result = result;
+    rec->method = method;
+    rec->arg = arg;
+    rec->check = audit_check(rec);
+    audit_in++;
+    rt_hw_interrupt_enable(level);
+
+    if (n == 0) rt_event_send(&audit_event, AUDIT_EVT_FIRST);
+    if (n + 1 >= audit_room) rt_event_send(&audit_event, AUDIT_EVT_PAGE);
+#endif
+}
+
+/**
+ * @brief  立即提交所有暂存记录
+ */
+rt_err_t audit_flush(void)
+{
+#ifdef RT_USING_FAL
+    if (!audit_ready) return -RT_ENOSYS;
+    rt_mutex_take(&audit_lock, RT_WAITING_FOREVER);
+    audit_commit(RT_TRUE);
+    rt_mutex_release(&audit_lock);
+    return RT_EOK;
+#else
+    return -RT_ENOSYS;
+#endif
+}
+
+#ifdef RT_USING_FAL
+/* 查询时的过滤参数 */
+typedef struct
+{
+    rt_uint32_t t1, t2;
+    rt_uint32_t matched;
+    void (*cb)(const audit_rec_t *rec, void *parameter);
+    void *parameter;
+} audit_filter_t;
+
+static void audit_query_rec(const audit_rec_t *rec, void *parameter)
+{
+    audit_filter_t *f = (audit_filter_t *)parameter;
+
+    if (rec->time < f->t1 || rec->time > f->t2) return;
+    f->matched++;
+    if (f->cb != RT_NULL) f->cb(rec, f->parameter);
+}
+#endif
+
+/**
+ * @brief  按时间范围查询，先提交暂存记录
+ * @param  t1, t2: 时间范围(含两端)
+ * @param  cb:     按时间顺序对每条匹配的记录调用，可为 RT_NULL
+ * @retval 匹配的记录数
+ * @note   按扇区时间索引跳过与时间范围没有重叠的扇区
+ */
+rt_uint32_t audit_query(rt_uint32_t t1, rt_uint32_t t2,
+                        void (*cb)(const audit_rec_t *rec, void *parameter), void *parameter)
+{
+#ifdef RT_USING_FAL
+    audit_filter_t f = {t1, t2, 0, cb, parameter};
+    rt_uint32_t k, s, next, end;
+
+    if (!audit_ready) return 0;
+    rt_mutex_take(&audit_lock, RT_WAITING_FOREVER);
+    audit_commit(RT_TRUE);
+
+    /* 当前扇区的下一个扇区最旧，按写入顺序遍历 */
+    for (k = 1; k <= audit_sectors; k++)
+    {
+        s = (audit_cur + k) % audit_sectors;
+        if (audit_index[s].seq == 0) continue;
+
+        /* 扇区时间范围：从本扇区首条记录到下一个扇区首条记录，当前扇区到最后一条记录 */
+        next = (s + 1) % audit_sectors;
+        end = (s != audit_cur && audit_index[next].seq == audit_index[s].seq + 1) ?
+              audit_index[next].time : audit_last;
+        if (audit_index[s].time > t2 || end < t1) continue;
+
+        audit_scan(s, s == audit_cur ? audit_off : audit_sector_size, audit_query_rec, &f);
+    }
+    rt_mutex_release(&audit_lock);
+    return f.matched;
+#else
+    return 0;
+#endif
+}
+
+/* ===================== msh 命令 ===================== */
+
+#if defined(RT_USING_FINSH) && defined(RT_USING_FAL)
+
+static void audit_print(const audit_rec_t *rec, void *parameter)
+{
+    static const char *const result[] = {"unlock", "fail", "lock"};
+    static const char *const method[] = {"pin", "key", "auto"};
+
+    if (rec->user == AUDIT_USER_NONE)
+    {
+        rt_kprintf("%10u   user -     %-6s %-4s %u\n", rec->time,
+                   rec->result < 3 ? result[rec->result] : "?", rec->method < 3 ? method[rec->method] : "?", rec->arg);
+    }
+    else
+    {
+        rt_kprintf("%10u   user %-5u %-6s %-4s %u\n", rec->time, rec->user,
+                   rec->result < 3 ? result[rec->result] : "?", rec->method < 3 ? method[rec->method] : "?", rec->arg);
+    }
+}
+
+static int audit(int argc, char **argv)
+{
+    rt_uint32_t t1, t2, n, now;
+
+    if (!audit_ready)
+    {
+        rt_kprintf("audit log unavailable\n");
+        return -1;
+    }
+
+    if (argc < 2)
+    {
+        rt_kprintf("%s: %u sectors x %u bytes, current sector %u seq %u, %u bytes used\n",
+                   AUDIT_PART_NAME, audit_sectors, audit_sector_size, audit_cur,
+                   audit_index[audit_cur].seq, audit_off);
+        rt_kprintf("now %u, last record %u, staged %u, dropped %u, programs %u, erases %u\n",
+                   audit_now(), audit_last, audit_in - audit_out, audit_dropped, audit_programs, audit_erases);
+        return 0;
+    }
+
+    if (!rt_strcmp(argv[1], "recent"))
+    {
+        now = audit_now();
+        n = argc > 2 ? (rt_uint32_t)atoi(argv[2]) : 600;
+        t1 = now > n ? now - n : 0;
+        t2 = now;
+    }
+    else if (argc >= 3)
+    {
+        t1 = (rt_uint32_t)strtoul(argv[1], RT_NULL, 0);
+        t2 = (rt_uint32_t)strtoul(argv[2], RT_NULL, 0);
+    }
+    else
+    {
+        rt_kprintf("Usage: audit [<t1> <t2> | recent [seconds]]\n");
+        return -1;
+    }
+
+    n = audit_query(t1, t2, audit_print, RT_NULL);
+    rt_kprintf("%u records in [%u, %u]\n", n, t1, t2);
+    return 0;
+}
+MSH_CMD_EXPORT(audit, audit log: audit [<t1> <t2> | recent [seconds]]);
+
+#endif /* RT_USING_FINSH && RT_USING_FAL */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef DRIVER_AUDIT_H_
+#define DRIVER_AUDIT_H_
+
+#include <rtthread.h>
+
+/* 审计日志：FAL 分区按扇区循环写入，RAM 暂存后按页批量提交 */
+#define AUDIT_PART_NAME     "audit"     /* board/port/fal_cfg.h 中的分区 */
+#define AUDIT_PAGE_SIZE     256         /* NOR 页大小，一次提交最多写一页 */
+#define AUDIT_BUF_RECS      64          /* RAM 暂存记录数，必须是2的幂 */
+#define AUDIT_FLUSH_MS      2000        /* 不足一页的记录最长暂存时间 */
+#define AUDIT_THREAD_PRIO   22          /* 提交线程优先级，低于按键与界面线程 */
+
+/* 结果 */
+#define AUDIT_RESULT_OK     0           /* 开锁成功 */
+#define AUDIT_RESULT_FAIL   1           /* 密码错误 */
+#define AUDIT_RESULT_LOCK   2           /* 上锁 */
+
+/* 方式 */
+#define AUDIT_METHOD_PIN    0           /* 键盘密码 */
+#define AUDIT_METHOD_KEY    1           /* 开锁期间按确认键 */
+#define AUDIT_METHOD_AUTO   2           /* 自动上锁 */
+
+#define AUDIT_USER_NONE     0xFFFF      /* 无对应用户 */
+
+/* 审计记录，16 字节 */
+typedef struct
+{
+    rt_uint32_t time;                   /* 秒；无 RTC 时为跨重启累计的运行秒数 */
+    rt_uint16_t user;                   /* 用户编号 */
+    rt_uint8_t  result;                 /* AUDIT_RESULT_xxx */
+    rt_uint8_t  method;                 /* AUDIT_METHOD_xxx */
+    rt_uint32_t arg;                    /* 附加信息：密码错误与开锁时为此前连续错误次数 */
+    rt_uint32_t check;                  /* 校验，识别掉电写坏的记录 */
+} audit_rec_t;
+
+int audit_init(void);
+void audit_log(rt_uint16_t user, rt_uint8_t result, rt_uint8_t method, rt_uint32_t arg);
+rt_err_t audit_flush(void);
+rt_uint32_t audit_query(rt_uint32_t t1, rt_uint32_t t2,
+                        void (*cb)(const audit_rec_t *rec, void *parameter), void *parameter);
+
+#endif /* DRIVER_AUDIT_H_ */
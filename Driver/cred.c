@@ -0,0 +1,825 @@
+/**
+ * @file    cred.c
+ * @brief   多用户 PIN 凭据存储
+ * @details 凭据保存在 FAL "easyflash" 分区中，分区分为两个存储区(bank)：
+ *          - 每个存储区以头记录开始(序号、设备盐值)，其后为顺序追加的 32 字节记录
+ *          - 添加凭据追加 ADD 记录，吊销追加 DEL 记录，不改写已有数据
+ *          - 当前存储区写满时，把有效记录复制到另一存储区后切换(最后写头记录，掉电不丢数据)
+ *          - 记录中只保存 SHA-256(设备盐值 || PIN) 的前 CRED_HASH_LEN 字节
+ *          启动时顺序回放当前存储区，在内存中建立开放寻址索引(以哈希前 4 字节为键)，
+ *          校验只需计算一次哈希、探测索引并比对一条记录，与用户数量无关
+ *
+ * 校验流程的时间与输入内容无关：
+ *          - 盐值与 PIN 共 22 字节，填充后正好一个 SHA-256 分组；盐值确定后预先填好分组，
+ *            校验时只写入 PIN 并做一次压缩(软件)，或把 22 字节交给 hwcrypto 哈希设备(硬件)
+ *          - 哈希比较使用常数时间比较，不在第一个不同的字节处返回
+ *          - 每次校验至少读取并比较一条记录，PIN 存在与否不改变读 Flash 的次数
+ *          硬件后端需要启用 RT_USING_HWCRYPTO 与 RT_HWCRYPTO_USING_SHA2_256 并注册默认设备，
+ *          否则使用 sha256.c 软件实现，两者结果相同
+ * @date    2025-12-20
+ *
+ * 未启用 FAL 或分区不存在时，只接受内置 PIN(CRED_DEFAULT_PIN)。
+ * 首次使用时格式化存储区，并写入内置 PIN 作为用户 0。
+ *
+ * msh 命令：
+ *   cred                           显示存储状态
+ *   cred add <用户> <PIN> [类型]   添加或更换凭据，类型 0=住户 1=临时 2=维护
+ *   cred del <用户>                吊销凭据
+ *   cred bench [次数]              测量索引重建耗时，以及各哈希后端与整个校验的最小/平均/最大耗时
+ */
+
+#include "cred.h"
+#include "sha256.h"
+#include <rtdevice.h>
+#include <board.h>
+#include <stdlib.h>
+
+#ifdef RT_USING_FAL
+#include <fal.h>
+#endif
+
+/* ===================== 记录格式 ===================== */
+
+#define CRED_REC_SIZE       32
+#define CRED_MAGIC_HEAD     0xC5A1      /* 存储区头 */
+#define CRED_MAGIC_ADD      0xC5A2      /* 添加/更换凭据 */
+#define CRED_MAGIC_DEL      0xC5A3      /* 吊销凭据 */
+#define CRED_MAGIC_EMPTY    0xFFFF      /* 未写入的 NOR 区域 */
+#define CRED_VERSION        1
+#define CRED_SALT_LEN       16
+#define CRED_READ_RECS      16          /* 回放时每次读取的记录数 */
+#define CRED_MSG_LEN        (CRED_SALT_LEN + CRED_PIN_LEN)  /* 哈希输入：盐值 || PIN */
+
+#if defined(RT_USING_HWCRYPTO) && defined(RT_HWCRYPTO_USING_SHA2_256)
+#define CRED_USING_HWHASH
+#endif
+
+/* 凭据记录 */
+typedef struct
+{
+    rt_uint16_t magic;                  /* CRED_MAGIC_ADD / CRED_MAGIC_DEL */
+    rt_uint16_t user;                   /* 用户编号 */
+    rt_uint8_t  type;                   /* CRED_TYPE_xxx */
+    rt_uint8_t  reserved[3];
+    rt_uint8_t  hash[CRED_HASH_LEN];    /* SHA-256(盐值 || PIN) 前若干字节，DEL 记录不使用 */
+    rt_uint32_t check;                  /* 前 28 字节的校验值，识别掉电写坏的记录 */
+} cred_rec_t;
+
+/* 存储区头记录 */
+typedef struct
+{
+    rt_uint16_t magic;                  /* CRED_MAGIC_HEAD */
+    rt_uint16_t version;
+    rt_uint32_t seq;                    /* 每次切换存储区加 1，序号大的存储区有效 */
+    rt_uint8_t  salt[CRED_SALT_LEN];    /* 设备盐值，格式化时生成，切换存储区时保留 */
+    rt_uint32_t reserved;
+    rt_uint32_t check;
+} cred_head_t;
+
+/* ===================== 内存索引 ===================== */
+
+#define CRED_INDEX_SIZE     (1UL << CRED_INDEX_BITS)
+#define CRED_INDEX_MASK     (CRED_INDEX_SIZE - 1)
+#define CRED_SLOT_EMPTY     0xFFFFFFFF  /* 从未使用，探测到此结束 */
+#define CRED_SLOT_DEL       0xFFFFFFFE  /* 已删除，探测时跳过，插入时复用 */
+#define CRED_USER_NONE      0xFFFF
+
+#if CRED_INDEX_BITS > 15 || (1UL << CRED_INDEX_BITS) < 2 * CRED_MAX_USERS
+#error "CRED_INDEX_BITS must give at least 2 * CRED_MAX_USERS slots and at most 32768"
+#endif
+
+/* 索引槽：哈希前 4 字节与记录在分区中的偏移 */
+typedef struct
+{
+    rt_uint32_t tag;
+    rt_uint32_t off;
+} cred_slot_t;
+
+static const rt_uint8_t cred_default_pin[CRED_PIN_LEN] = CRED_DEFAULT_PIN;
+
+static struct rt_mutex cred_lock;
+static rt_uint8_t cred_ready = 0;       /* 1=分区可用，使用存储的凭据 */
+
+/**
+ * @brief  常数时间比较
+ * @retval 相同返回 1，否则返回 0；耗时只与 len 有关
+ */
+static int cred_equal(const rt_uint8_t *a, const rt_uint8_t *b, rt_size_t len)
+{
+    volatile rt_uint8_t diff = 0;
+    rt_size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
+
+#ifdef RT_USING_FAL
+
+static const struct fal_partition *cred_part = RT_NULL;
+static rt_uint32_t cred_bank_size;      /* 单个存储区大小，擦除块的整数倍 */
+static rt_uint32_t cred_bank;           /* 当前存储区起始偏移 */
+static rt_uint32_t cred_tail;           /* 下一条记录的写入偏移 */
+static cred_head_t cred_head;
+static rt_uint8_t cred_block[SHA256_BLOCK_SIZE];    /* 预先填好盐值与填充的哈希分组，PIN 处每次改写 */
+#ifdef CRED_USING_HWHASH
+static struct rt_hwcrypto_ctx *cred_hw = RT_NULL;   /* 硬件哈希上下文，RT_NULL 表示使用软件实现 */
+#endif
+
+static cred_slot_t *cred_index = RT_NULL;   /* CRED_INDEX_SIZE 个槽 */
+static rt_uint16_t *cred_user = RT_NULL;    /* 用户编号 -> 槽号 */
+static rt_uint32_t cred_live;               /* 有效凭据数 */
+static rt_uint32_t cred_used;               /* 非空槽数(含已删除)，过多时重建索引 */
+
+/* FNV-1a 校验，覆盖记录中 check 之前的字段 */
+static rt_uint32_t cred_check(const void *rec)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)rec;
+    rt_uint32_t h = 2166136261UL;
+    int i;
+
+    for (i = 0; i < CRED_REC_SIZE - 4; i++)
+    {
+        h = (h ^ p[i]) * 16777619UL;
+    }
+    return h;
+}
+
+/* 记录区域是否从未写入 */
+static rt_bool_t cred_blank(const void *rec)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)rec;
+    int i;
+
+    for (i = 0; i < CRED_REC_SIZE; i++)
+    {
+        if (p[i] != 0xFF) return RT_FALSE;
+    }
+    return RT_TRUE;
+}
+
+/* 盐值确定后预先生成哈希分组：盐值、PIN 占位、0x80、0 与大端位长度 */
+static void cred_schedule(void)
+{
+    rt_memset(cred_block, 0, sizeof(cred_block));
+    rt_memcpy(cred_block, cred_head.salt, CRED_SALT_LEN);
+    cred_block[CRED_MSG_LEN] = 0x80;
+    cred_block[SHA256_BLOCK_SIZE - 2] = (rt_uint8_t)((CRED_MSG_LEN * 8) >> 8);
+    cred_block[SHA256_BLOCK_SIZE - 1] = (rt_uint8_t)(CRED_MSG_LEN * 8);
+}
+
+/* 软件后端：一次压缩 */
+static rt_err_t cred_hash_sw(const rt_uint8_t *pin, rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    rt_uint8_t block[SHA256_BLOCK_SIZE];
+
+    rt_memcpy(block, cred_block, SHA256_BLOCK_SIZE);
+    rt_memcpy(block + CRED_SALT_LEN, pin, CRED_PIN_LEN);
+    sha256_block_digest(block, digest);
+    rt_memset(block, 0, sizeof(block));
+    return RT_EOK;
+}
+
+#ifdef CRED_USING_HWHASH
+/* 硬件后端：hwcrypto 哈希设备 */
+static rt_err_t cred_hash_hw(const rt_uint8_t *pin, rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    rt_uint8_t msg[CRED_MSG_LEN];
+    rt_err_t ret;
+
+    rt_memcpy(msg, cred_block, CRED_SALT_LEN);
+    rt_memcpy(msg + CRED_SALT_LEN, pin, CRED_PIN_LEN);
+    rt_hwcrypto_hash_reset(cred_hw);
+    ret = rt_hwcrypto_hash_update(cred_hw, msg, CRED_MSG_LEN);
+    if (ret == RT_EOK) ret = rt_hwcrypto_hash_finish(cred_hw, digest, SHA256_DIGEST_SIZE);
+    rt_memset(msg, 0, sizeof(msg));
+    return ret;
+}
+#endif
+
+/* 计算 SHA-256(盐值 || PIN)，有硬件设备时优先使用硬件 */
+static void cred_hash(const rt_uint8_t *pin, rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+#ifdef CRED_USING_HWHASH
+    if (cred_hw != RT_NULL && cred_hash_hw(pin, digest) == RT_EOK) return;
+#endif
+    cred_hash_sw(pin, digest);
+}
+
+static rt_uint32_t cred_tag(const rt_uint8_t *hash)
+{
+    return (rt_uint32_t)hash[0] | ((rt_uint32_t)hash[1] << 8) |
+           ((rt_uint32_t)hash[2] << 16) | ((rt_uint32_t)hash[3] << 24);
+}
+
+/* 清空索引 */
+static void cred_index_clear(void)
+{
+    rt_memset(cred_index, 0xFF, CRED_INDEX_SIZE * sizeof(cred_slot_t));
+    rt_memset(cred_user, 0xFF, CRED_MAX_USERS * sizeof(rt_uint16_t));
+    cred_live = 0;
+    cred_used = 0;
+}
+
+/* 删除用户的索引项 */
+static void cred_index_remove(rt_uint16_t user)
+{
+    rt_uint16_t slot = cred_user[user];
+
+    if (slot == CRED_USER_NONE) return;
+    cred_index[slot].off = CRED_SLOT_DEL;
+    cred_user[user] = CRED_USER_NONE;
+    cred_live--;
+}
+
+/* 插入索引项，每个用户最多占一个槽，槽数不少于用户数的 2 倍，一定能找到空槽 */
+static void cred_index_insert(rt_uint16_t user, rt_uint32_t tag, rt_uint32_t off)
+{
+    rt_uint32_t i = tag & CRED_INDEX_MASK;
+
+    cred_index_remove(user);
+    while (cred_index[i].off < CRED_SLOT_DEL)
+    {
+        i = (i + 1) & CRED_INDEX_MASK;
+    }
+    if (cred_index[i].off == CRED_SLOT_EMPTY) cred_used++;
+    cred_index[i].tag = tag;
+    cred_index[i].off = off;
+    cred_user[user] = (rt_uint16_t)i;
+    cred_live++;
+}
+
+/**
+ * @brief  按哈希查找凭据
+ * @param  hash: SHA-256 结果
+ * @param  rec:  找到时返回记录内容
+ * @retval 槽号，未找到返回 -1
+ * @note   没有哈希前缀相同的槽时，按哈希值在已写入的记录中任选一条读取并比较，使每次查找
+ *         至少读一条记录，且与找到时一样读取存储区中的任意位置(固定读头记录时数据总在缓存中，
+ *         未找到明显更快)；探测长度只取决于哈希值，不反映输入与有效 PIN 的接近程度
+ */
+static rt_int32_t cred_index_find(const rt_uint8_t *hash, cred_rec_t *rec)
+{
+    rt_uint32_t tag = cred_tag(hash);
+    rt_uint32_t i = tag & CRED_INDEX_MASK;
+    rt_uint32_t n;
+    rt_bool_t read = RT_FALSE;
+
+    for (n = 0; n < CRED_INDEX_SIZE; n++, i = (i + 1) & CRED_INDEX_MASK)
+    {
+        if (cred_index[i].off == CRED_SLOT_EMPTY) break;
+        if (cred_index[i].off == CRED_SLOT_DEL || cred_index[i].tag != tag) continue;
+        read = RT_TRUE;
+        if (fal_partition_read(cred_part, cred_index[i].off, (rt_uint8_t *)rec, CRED_REC_SIZE) < 0) continue;
+        if (cred_equal(rec->hash, hash, CRED_HASH_LEN)) return (rt_int32_t)i;
+    }
+    if (!read)
+    {
+        n = (cred_tail - cred_bank) / CRED_REC_SIZE;
+        fal_partition_read(cred_part, cred_bank + tag % n * CRED_REC_SIZE, (rt_uint8_t *)rec, CRED_REC_SIZE);
+        cred_equal(rec->hash, hash, CRED_HASH_LEN);
+    }
+    return -1;
+}
+
+/* 回放当前存储区，重建索引并确定写入位置 */
+static void cred_replay(void)
+{
+    cred_rec_t buf[CRED_READ_RECS];
+    rt_uint32_t off = cred_bank + CRED_REC_SIZE;
+    rt_uint32_t end = cred_bank + cred_bank_size;
+    rt_uint32_t tail = off;
+    rt_uint32_t i, n;
+
+    cred_index_clear();
+    while (off < end)
+    {
+        n = (end - off) / CRED_REC_SIZE;
+        if (n > CRED_READ_RECS) n = CRED_READ_RECS;
+        if (fal_partition_read(cred_part, off, (rt_uint8_t *)buf, n * CRED_REC_SIZE) < 0) break;
+        for (i = 0; i < n; i++, off += CRED_REC_SIZE)
+        {
+            const cred_rec_t *rec = &buf[i];
+
+            if (rec->magic == CRED_MAGIC_EMPTY && cred_blank(rec))
+            {
+                cred_tail = off;
+                return;
+            }
+            tail = off + CRED_REC_SIZE;  /* 写坏的记录也不能再写入 */
+            if (rec->check != cred_check(rec) || rec->user >= CRED_MAX_USERS) continue;
+            if (rec->magic == CRED_MAGIC_ADD)
+            {
+                cred_index_insert(rec->user, cred_tag(rec->hash), off);
+            }
+            else if (rec->magic == CRED_MAGIC_DEL)
+            {
+                cred_index_remove(rec->user);
+            }
+        }
+    }
+    cred_tail = tail;
+}
+
+/* 读取存储区头，有效返回 RT_TRUE */
+static rt_bool_t cred_head_read(rt_uint32_t bank, cred_head_t *head)
+{
+    if (fal_partition_read(cred_part, bank, (rt_uint8_t *)head, CRED_REC_SIZE) < 0) return RT_FALSE;
+    return head->magic == CRED_MAGIC_HEAD && head->version == CRED_VERSION &&
+           head->check == cred_check(head);
+}
+
+/**
+ * @brief  把有效记录复制到另一存储区并切换
+ * @note   先写记录后写头：复制中途掉电时新存储区没有有效头，仍使用原存储区
+ */
+static rt_err_t cred_compact(void)
+{
+    rt_uint32_t dst = (cred_bank == 0) ? cred_bank_size : 0;
+    rt_uint32_t off = dst + CRED_REC_SIZE;
+    cred_head_t head;
+    cred_rec_t rec;
+    rt_uint32_t user;
+
+    if (fal_partition_erase(cred_part, dst, cred_bank_size) < 0) return -RT_EIO;
+    for (user = 0; user < CRED_MAX_USERS; user++)
+    {
+        cred_slot_t *slot;
+
+        if (cred_user[user] == CRED_USER_NONE) continue;
+        slot = &cred_index[cred_user[user]];
+        if (fal_partition_read(cred_part, slot->off, (rt_uint8_t *)&rec, CRED_REC_SIZE) < 0 ||
+            fal_partition_write(cred_part, off, (rt_uint8_t *)&rec, CRED_REC_SIZE) < 0)
+        {
+            cred_replay();  /* 部分索引已指向新存储区，按原存储区恢复 */
+            return -RT_EIO;
+        }
+        slot->off = off;
+        off += CRED_REC_SIZE;
+    }
+
+    head = cred_head;
+    head.seq++;
+    head.check = cred_check(&head);
+    if (fal_partition_write(cred_part, dst, (rt_uint8_t *)&head, CRED_REC_SIZE) < 0)
+    {
+        cred_replay();
+        return -RT_EIO;
+    }
+    cred_head = head;
+    cred_bank = dst;
+    cred_tail = off;
+    rt_kprintf("cred: compacted %u users into bank %u\n", cred_live, dst / cred_bank_size);
+    return RT_EOK;
+}
+
+/* 追加一条记录，返回记录偏移 */
+static rt_err_t cred_append(cred_rec_t *rec, rt_uint32_t *off)
+{
+    rt_err_t ret;
+
+    rec->check = cred_check(rec);
+    if (cred_tail + CRED_REC_SIZE > cred_bank + cred_bank_size)
+    {
+        ret = cred_compact();
+        if (ret != RT_EOK) return ret;
+        if (cred_tail + CRED_REC_SIZE > cred_bank + cred_bank_size) return -RT_EFULL;
+    }
+    if (fal_partition_write(cred_part, cred_tail, (const rt_uint8_t *)rec, CRED_REC_SIZE) < 0)
+    {
+        cred_tail += CRED_REC_SIZE;  /* 可能已部分写入，跳过 */
+        return -RT_EIO;
+    }
+    *off = cred_tail;
+    cred_tail += CRED_REC_SIZE;
+    return RT_EOK;
+}
+
+/* 添加凭据，调用者持有 cred_lock */
+static rt_err_t cred_put(rt_uint16_t user, rt_uint8_t type, const rt_uint8_t *pin)
+{
+    rt_uint8_t digest[SHA256_DIGEST_SIZE];
+    cred_rec_t rec;
+    rt_uint32_t off;
+    rt_err_t ret;
+
+    cred_hash(pin, digest);
+    if (cred_index_find(digest, &rec) >= 0)
+    {
+        /* 不同用户不能使用相同的 PIN，否则无法区分 */
+        if (rec.user != user) return -RT_EBUSY;
+        if (rec.type == type) return RT_EOK;
+    }
+
+    rt_memset(&rec, 0, sizeof(rec));
+    rec.magic = CRED_MAGIC_ADD;
+    rec.user = user;
+    rec.type = type;
+    rt_memcpy(rec.hash, digest, CRED_HASH_LEN);
+    ret = cred_append(&rec, &off);
+    if (ret != RT_EOK) return ret;
+
+    cred_index_insert(user, cred_tag(digest), off);
+    if (cred_used > CRED_INDEX_SIZE * 3 / 4) cred_replay();  /* 已删除的槽过多，重建索引 */
+    return RT_EOK;
+}
+
+/*
+ * 生成设备盐值：以 96 位芯片 UID 保证各设备不同(同一固件格式化时节拍与周期计数在各板上几乎相同)。
+ * 有硬件 RNG 时再混入随机数，同一设备重新格式化后盐值也会变化；没有 RNG 时只靠节拍与周期计数区分
+ */
+static void cred_salt(rt_uint8_t *salt)
+{
+    rt_uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_ctx_t ctx;
+    rt_uint32_t v[3];
+    int i;
+
+    sha256_init(&ctx);
+    v[0] = HAL_GetUIDw0();
+    v[1] = HAL_GetUIDw1();
+    v[2] = HAL_GetUIDw2();
+    sha256_update(&ctx, v, sizeof(v));
+    for (i = 0; i < 16; i++)
+    {
+#ifdef RT_HWCRYPTO_USING_RNG
+        v[0] = rt_hwcrypto_rng_update();
+        sha256_update(&ctx, &v[0], sizeof(v[0]));
+#endif
+        v[0] = rt_tick_get();
+        sha256_update(&ctx, &v[0], sizeof(v[0]));
+#ifdef RT_USING_CPUTIME
+        v[0] = (rt_uint32_t)clock_cpu_gettime();
+        sha256_update(&ctx, &v[0], sizeof(v[0]));
+#endif
+    }
+    sha256_final(&ctx, digest);
+    rt_memcpy(salt, digest, CRED_SALT_LEN);
+}
+
+/* 格式化存储区 0 并写入内置 PIN */
+static rt_err_t cred_format(void)
+{
+    rt_memset(&cred_head, 0, sizeof(cred_head));
+    cred_head.magic = CRED_MAGIC_HEAD;
+    cred_head.version = CRED_VERSION;
+    cred_head.seq = 1;
+    cred_salt(cred_head.salt);
+    cred_head.check = cred_check(&cred_head);
+    cred_schedule();
+
+    if (fal_partition_erase(cred_part, 0, cred_bank_size) < 0 ||
+        fal_partition_write(cred_part, 0, (const rt_uint8_t *)&cred_head, CRED_REC_SIZE) < 0)
+    {
+        return -RT_EIO;
+    }
+    cred_bank = 0;
+    cred_tail = CRED_REC_SIZE;
+    cred_index_clear();
+    rt_kprintf("cred: formatted %s\n", CRED_PART_NAME);
+    return cred_put(0, CRED_TYPE_RESIDENT, cred_default_pin);
+}
+
+/* 选择序号较大的有效存储区并建立索引 */
+static rt_err_t cred_mount(void)
+{
+    cred_head_t head[2];
+    rt_bool_t valid[2];
+
+    valid[0] = cred_head_read(0, &head[0]);
+    valid[1] = cred_head_read(cred_bank_size, &head[1]);
+    if (!valid[0] && !valid[1]) return cred_format();
+
+    if (valid[1] && (!valid[0] || (rt_int32_t)(head[1].seq - head[0].seq) > 0))
+    {
+        cred_head = head[1];
+        cred_bank = cred_bank_size;
+    }
+    else
+    {
+        cred_head = head[0];
+        cred_bank = 0;
+    }
+    cred_schedule();
+    cred_replay();
+    return RT_EOK;
+}
+
+#endif /* RT_USING_FAL */
+
+/* ===================== 对外接口 ===================== */
+
+/**
+ * @brief  初始化凭据存储
+ * @retval RT_EOK: 使用分区中的凭据；其它: 分区不可用，只接受内置 PIN
+ * @note   需要在 FAL 初始化之后调用
+ */
+int cred_init(void)
+{
+    rt_mutex_init(&cred_lock, "cred", RT_IPC_FLAG_PRIO);
+
+#ifdef RT_USING_FAL
+    {
+        const struct fal_flash_dev *flash;
+        rt_tick_t t0 = rt_tick_get();
+
+        cred_part = fal_partition_find(CRED_PART_NAME);
+        flash = cred_part ? fal_flash_device_find(cred_part->flash_name) : RT_NULL;
+        if (flash == RT_NULL)
+        {
+            rt_kprintf("cred: partition %s not found, using built-in PIN\n", CRED_PART_NAME);
+            return -RT_ERROR;
+        }
+        cred_bank_size = cred_part->len / 2 / flash->blk_size * flash->blk_size;
+
+        cred_index = rt_malloc(CRED_INDEX_SIZE * sizeof(cred_slot_t));
+        cred_user = rt_malloc(CRED_MAX_USERS * sizeof(rt_uint16_t));
+        if (cred_index == RT_NULL || cred_user == RT_NULL)
+        {
+            rt_free(cred_index);
+            rt_free(cred_user);
+            cred_index = RT_NULL;
+            cred_user = RT_NULL;
+            rt_kprintf("cred: no memory for index, using built-in PIN\n");
+            return -RT_ENOMEM;
+        }
+
+        if (cred_mount() != RT_EOK)
+        {
+            rt_kprintf("cred: %s unusable, using built-in PIN\n", CRED_PART_NAME);
+            return -RT_EIO;
+        }
+#ifdef CRED_USING_HWHASH
+        if (rt_hwcrypto_dev_default() != RT_NULL)
+        {
+            cred_hw = rt_hwcrypto_hash_create(rt_hwcrypto_dev_default(), HWCRYPTO_TYPE_SHA256);
+        }
+#endif
+        cred_ready = 1;
+        rt_kprintf("cred: %u users, bank %u, %u/%u bytes used, index built in %u ms\n",
+                   cred_live, cred_bank / cred_bank_size, cred_tail - cred_bank, cred_bank_size,
+                   (rt_uint32_t)(rt_tick_get() - t0) * 1000 / RT_TICK_PER_SECOND);
+        return RT_EOK;
+    }
+#else
+    return -RT_ENOSYS;
+#endif
+}
+
+/**
+ * @brief  校验 PIN
+ * @param  pin: CRED_PIN_LEN 位数字
+ * @retval 匹配的用户编号，未匹配返回 -1
+ */
+rt_int32_t cred_verify(const rt_uint8_t *pin)
+{
+    rt_int32_t user = -1;
+
+    if (!cred_ready)
+    {
+        return cred_equal(pin, cred_default_pin, CRED_PIN_LEN) ? 0 : -1;
+    }
+
+#ifdef RT_USING_FAL
+    {
+        rt_uint8_t digest[SHA256_DIGEST_SIZE];
+        cred_rec_t rec;
+
+        cred_hash(pin, digest);
+        rt_mutex_take(&cred_lock, RT_WAITING_FOREVER);
+        if (cred_index_find(digest, &rec) >= 0) user = rec.user;
+        rt_mutex_release(&cred_lock);
+    }
+#endif
+    return user;
+}
+
+/**
+ * @brief  添加或更换凭据
+ * @param  user: 用户编号 0 ~ CRED_MAX_USERS-1，已存在时替换原 PIN
+ * @param  type: CRED_TYPE_xxx
+ * @param  pin:  CRED_PIN_LEN 位数字
+ * @retval RT_EOK 成功；-RT_EBUSY PIN 已被其他用户使用；-RT_EINVAL 参数错误；
+ *         -RT_ENOSYS 分区不可用；-RT_EIO/-RT_EFULL 写入失败
+ */
+rt_err_t cred_add(rt_uint16_t user, rt_uint8_t type, const rt_uint8_t *pin)
+{
+    rt_err_t ret = -RT_ENOSYS;
+    int i;
+
+    if (user >= CRED_MAX_USERS) return -RT_EINVAL;
+    for (i = 0; i < CRED_PIN_LEN; i++)
+    {
+        if (pin[i] > 9) return -RT_EINVAL;
+    }
+    if (!cred_ready) return -RT_ENOSYS;
+
+#ifdef RT_USING_FAL
+    rt_mutex_take(&cred_lock, RT_WAITING_FOREVER);
+    ret = cred_put(user, type, pin);
+    rt_mutex_release(&cred_lock);
+#endif
+    return ret;
+}
+
+/**
+ * @brief  吊销凭据
+ * @retval RT_EOK 成功；-RT_EEMPTY 用户不存在；其它同 cred_add
+ */
+rt_err_t cred_revoke(rt_uint16_t user)
+{
+    rt_err_t ret = -RT_ENOSYS;
+
+    if (user >= CRED_MAX_USERS) return -RT_EINVAL;
+    if (!cred_ready) return -RT_ENOSYS;
+
+#ifdef RT_USING_FAL
+    rt_mutex_take(&cred_lock, RT_WAITING_FOREVER);
+    if (cred_user[user] == CRED_USER_NONE)
+    {
+        ret = -RT_EEMPTY;
+    }
+    else
+    {
+        cred_rec_t rec;
+        rt_uint32_t off;
+
+        rt_memset(&rec, 0, sizeof(rec));
+        rec.magic = CRED_MAGIC_DEL;
+        rec.user = user;
+        ret = cred_append(&rec, &off);
+        if (ret == RT_EOK) cred_index_remove(user);
+    }
+    rt_mutex_release(&cred_lock);
+#endif
+    return ret;
+}
+
+/**
+ * @brief  有效凭据数量
+ */
+rt_uint32_t cred_count(void)
+{
+#ifdef RT_USING_FAL
+    if (cred_ready) return cred_live;
+#endif
+    return 1;
+}
+
+/* ===================== msh 命令 ===================== */
+
+#ifdef RT_USING_FINSH
+
+/* 把数字字符串转换为 PIN，成功返回 RT_EOK */
+static rt_err_t cred_parse_pin(const char *s, rt_uint8_t *pin)
+{
+    int i;
+
+    if (rt_strlen(s) != CRED_PIN_LEN) return -RT_EINVAL;
+    for (i = 0; i < CRED_PIN_LEN; i++)
+    {
+        if (s[i] < '0' || s[i] > '9') return -RT_EINVAL;
+        pin[i] = s[i] - '0';
+    }
+    return RT_EOK;
+}
+
+#if defined(RT_USING_FAL) && defined(RT_USING_CPUTIME)
+/* 单项耗时统计(CPU 周期) */
+typedef struct
+{
+    rt_uint64_t min;
+    rt_uint64_t max;
+    rt_uint64_t sum;
+} cred_stat_t;
+
+static void cred_stat_add(cred_stat_t *st, rt_uint64_t t)
+{
+    if (t < st->min) st->min = t;
+    if (t > st->max) st->max = t;
+    st->sum += t;
+}
+
+static void cred_stat_print(const char *name, const cred_stat_t *st, int count)
+{
+    rt_kprintf("%-10s min %6u ns  avg %6u ns  max %6u ns\n", name,
+               (rt_uint32_t)clock_cpu_microsecond(st->min * 1000),
+               (rt_uint32_t)clock_cpu_microsecond(st->sum * 1000 / count),
+               (rt_uint32_t)clock_cpu_microsecond(st->max * 1000));
+}
+
+/* 测量一个哈希后端，输入 PIN 按序号变化 */
+static void cred_bench_hash(const char *name, rt_err_t (*hash)(const rt_uint8_t *, rt_uint8_t *), int count)
+{
+    cred_stat_t st = {~0ULL, 0, 0};
+    rt_uint8_t pin[CRED_PIN_LEN], digest[SHA256_DIGEST_SIZE];
+    rt_uint64_t t0;
+    int i, j, v;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = CRED_PIN_LEN - 1, v = i * 7919; j >= 0; j--, v /= 10) pin[j] = v % 10;
+        t0 = clock_cpu_gettime();
+        hash(pin, digest);
+        cred_stat_add(&st, clock_cpu_gettime() - t0);
+    }
+    cred_stat_print(name, &st, count);
+}
+
+/* 测量索引重建、各哈希后端与整个校验的耗时；校验分别使用内置 PIN 与按序号生成的 PIN */
+static void cred_bench(int count)
+{
+    cred_stat_t hit = {~0ULL, 0, 0}, miss = {~0ULL, 0, 0};
+    rt_uint8_t pin[CRED_PIN_LEN];
+    rt_uint64_t t0, t;
+    int i, j, v, nhit = 0, nmiss = 0;
+
+    if (count <= 0) count = 1000;
+
+    rt_mutex_take(&cred_lock, RT_WAITING_FOREVER);
+    t0 = clock_cpu_gettime();
+    cred_replay();
+    t = clock_cpu_gettime() - t0;
+    rt_mutex_release(&cred_lock);
+    rt_kprintf("users %u, index build %u us\n", cred_live, (rt_uint32_t)clock_cpu_microsecond(t));
+
+    cred_bench_hash("hash sw", cred_hash_sw, count);
+#ifdef CRED_USING_HWHASH
+    if (cred_hw != RT_NULL) cred_bench_hash("hash hw", cred_hash_hw, count);
+    else rt_kprintf("hash hw    no hwcrypto device\n");
+#endif
+
+    for (i = 0; i < count; i++)
+    {
+        if (i & 1)
+        {
+            for (j = CRED_PIN_LEN - 1, v = i; j >= 0; j--, v /= 10) pin[j] = v % 10;
+        }
+        else
+        {
+            rt_memcpy(pin, cred_default_pin, CRED_PIN_LEN);
+        }
+        t0 = clock_cpu_gettime();
+        v = cred_verify(pin);
+        t = clock_cpu_gettime() - t0;
+        if (v >= 0) { cred_stat_add(&hit, t); nhit++; }
+        else        { cred_stat_add(&miss, t); nmiss++; }
+    }
+    if (nhit)  cred_stat_print("verify ok", &hit, nhit);
+    if (nmiss) cred_stat_print("verify bad", &miss, nmiss);
+}
+#endif
+
+static int cred(int argc, char **argv)
+{
+    rt_uint8_t pin[CRED_PIN_LEN];
+    rt_err_t ret;
+
+    if (argc < 2)
+    {
+#ifdef RT_USING_FAL
+        if (cred_ready)
+        {
+            rt_kprintf("%s: %u users, bank %u seq %u, %u/%u bytes used, %u/%u slots used\n",
+                       CRED_PART_NAME, cred_live, cred_bank / cred_bank_size, cred_head.seq,
+                       cred_tail - cred_bank, cred_bank_size, cred_used, CRED_INDEX_SIZE);
+            return 0;
+        }
+#endif
+        rt_kprintf("credential store unavailable, built-in PIN only\n");
+        return 0;
+    }
+
+    if (!rt_strcmp(argv[1], "add") && argc >= 4)
+    {
+        if (cred_parse_pin(argv[3], pin) != RT_EOK)
+        {
+            rt_kprintf("PIN must be %d digits\n", CRED_PIN_LEN);
+            return -1;
+        }
+        ret = cred_add(atoi(argv[2]), argc > 4 ? atoi(argv[4]) : CRED_TYPE_RESIDENT, pin);
+        rt_kprintf("add user %s: %d\n", argv[2], ret);
+        return ret;
+    }
+    if (!rt_strcmp(argv[1], "del") && argc >= 3)
+    {
+        ret = cred_revoke(atoi(argv[2]));
+        rt_kprintf("revoke user %s: %d\n", argv[2], ret);
+        return ret;
+    }
+#if defined(RT_USING_FAL) && defined(RT_USING_CPUTIME)
+    if (!rt_strcmp(argv[1], "bench") && cred_ready)
+    {
+        cred_bench(argc > 2 ? atoi(argv[2]) : 1000);
+        return 0;
+    }
+#endif
+
+    rt_kprintf("Usage: cred [add <user> <pin> [type] | del <user> | bench [count]]\n");
+    return -1;
+}
+MSH_CMD_EXPORT(cred, credential store: cred [add|del|bench]);
+
+#endif /* RT_USING_FINSH */
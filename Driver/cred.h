@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef DRIVER_CRED_H_
+#define DRIVER_CRED_H_
+
+#include <rtthread.h>
+
+/* 凭据存储：FAL 分区中的追加式记录日志 + 内存开放寻址索引 */
+#define CRED_PART_NAME      "easyflash" /* board/port/fal_cfg.h 中的分区 */
+#define CRED_PIN_LEN        6           /* PIN 位数，每位 0~9 */
+#ifndef CRED_MAX_USERS
+#define CRED_MAX_USERS      2048        /* 用户编号范围 0 ~ CRED_MAX_USERS-1 */
+#endif
+#ifndef CRED_INDEX_BITS
+#define CRED_INDEX_BITS     12          /* 索引槽数 2^N，至少为 CRED_MAX_USERS 的 2 倍 */
+#endif
+#define CRED_HASH_LEN       20          /* 记录中保存的 SHA-256 前 N 字节 */
+
+/* 凭据类型 */
+#define CRED_TYPE_RESIDENT  0           /* 住户 */
+#define CRED_TYPE_TEMP      1           /* 临时密码 */
+#define CRED_TYPE_SERVICE   2           /* 维护密码 */
+
+/* 分区不可用(未启用 FAL 或分区不存在)时使用的内置 PIN，对应用户 0 */
+#define CRED_DEFAULT_PIN    {1, 2, 3, 4, 5, 6}
+
+int cred_init(void);
+rt_int32_t cred_verify(const rt_uint8_t *pin);
+rt_err_t cred_add(rt_uint16_t user, rt_uint8_t type, const rt_uint8_t *pin);
+rt_err_t cred_revoke(rt_uint16_t user);
+rt_uint32_t cred_count(void);
+
+#endif /* DRIVER_CRED_H_ */
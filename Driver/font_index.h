@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 此文件由 tools/fontindex.py 根据 font_ascii_16x8.h 生成，请勿手动修改
+ */
+#ifndef DRIVER_FONT_INDEX_H_
+#define DRIVER_FONT_INDEX_H_
+
+/* 汉字索引：按 Unicode 码点升序排列，idx 为对应字库数组的下标 */
+typedef struct {
+    unsigned int   code;
+    unsigned short idx;
+} typFNT_INDEX;
+
+static const typFNT_INDEX tfont16_index[] = {
+    {0x4E0A,   8},  /* 上 */
+    {0x5165,  13},  /* 入 */
+    {0x529F,   5},  /* 功 */
+    {0x52A8,   3},  /* 动 */
+    {0x542F,   2},  /* 启 */
+    {0x5728,   1},  /* 在 */
+    {0x5BC6,  14},  /* 密 */
+    {0x5DF2,   7},  /* 已 */
+    {0x6210,   4},  /* 成 */
+    {0x6B63,   0},  /* 正 */
+    {0x7801,  15},  /* 码 */
+    {0x8BF7,  11},  /* 请 */
+    {0x8F93,  12},  /* 输 */
+    {0x9501,   9},  /* 锁 */
+    {0x95E8,   6},  /* 门 */
+    {0xFF0C,  10},  /* ， */
+};
+#define TFONT16_INDEX_NUM 16
+
+static const typFNT_INDEX tfont24_index[] = {
+    {0x6211,   0},  /* 我 */
+};
+#define TFONT24_INDEX_NUM 1
+
+static const typFNT_INDEX tfont32_index[] = {
+    {0x6211,   0},  /* 我 */
+};
+#define TFONT32_INDEX_NUM 1
+
+#endif /* DRIVER_FONT_INDEX_H_ */
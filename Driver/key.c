@@ -4,9 +4,13 @@
  * @details 基于RT-Thread平台的矩阵键盘扫描驱动
  *          实现功能：
  *          - 4行4列矩阵键盘GPIO配置
- *          - 行列扫描按键检测算法
+ *          - 行列扫描按键检测算法，行列引脚按端口分组，每行一次端口写入、每个端口一次读取
  *          - 支持16个按键的状态读取
  *          - 标准数字键盘布局支持
+ *          - 空闲时列线中断唤醒(KEY_USE_IRQ)，无按键时扫描线程不再周期运行
+ *          - 定时器扫描(KEY_USE_TIMER)：节拍中断中每次推进一行，完整扫描结果经无锁缓冲区交给扫描线程
+ *          - 按键事件服务：16键位图扫描、逐键积分消抖、按下/释放/长按/重复事件，
+ *            事件带时间戳放入消息队列，由 key_event_get() 阻塞读取
  * @author  移植自原项目
  * @date    2025-11-30
  * @version 1.0
@@ -24,6 +28,120 @@
  */
 
 #include "key.h"  /* 矩阵键盘驱动头文件 */
+#include "trace.h"
+
+/* 行线，按扫描顺序排列 */
+static const rt_base_t key_row_pins[4] = {KEY_R1_PIN, KEY_R2_PIN, KEY_R3_PIN, KEY_R4_PIN};
+/* 列线，按行内键值顺序排列(C4 对应每行第一个键值) */
+static const rt_base_t key_col_pins[4] = {KEY_C4_PIN, KEY_C3_PIN, KEY_C2_PIN, KEY_C1_PIN};
+
+/* 按端口分组的引脚：一次端口访问读写同一端口上的所有行或列 */
+typedef struct
+{
+    rt_base_t   port;       /* 端口号 */
+    rt_uint32_t mask;       /* 该端口上属于本组的引脚 */
+} key_port_t;
+
+static key_port_t key_row_port[4];      /* 行线所在端口 */
+static key_port_t key_col_port[4];      /* 列线所在端口 */
+static rt_uint8_t key_row_port_num;
+static rt_uint8_t key_col_port_num;
+static rt_uint8_t key_col_index[4];     /* 每根列线在 key_col_port 中的下标 */
+
+#if KEY_USE_IRQ
+static struct rt_semaphore key_sem;     /* 列线中断唤醒信号 */
+static volatile rt_uint8_t key_armed;   /* 1=正在等待按键，扫描期间的列线跳变不唤醒 */
+
+/* 列线下降沿中断：只在 key_wait 等待期间唤醒一次 */
+static void key_col_isr(void *args)
+{
+    if (key_armed)
+    {
+        key_armed = 0;
+        rt_sem_release(&key_sem);
+    }
+}
+#endif /* KEY_USE_IRQ */
+
+/* 单个按键的消抖与长按状态 */
+typedef struct
+{
+    rt_uint8_t cnt;         /* 积分计数，0..KEY_DEBOUNCE_CNT */
+    rt_uint8_t pressed;     /* 消抖后的状态 */
+    rt_uint8_t longed;      /* 已产生长按事件 */
+    rt_tick_t  tick;        /* 下一次长按/重复事件的时刻 */
+} key_state_t;
+
+static key_state_t key_state[16];
+static rt_mq_t key_mq = RT_NULL;
+
+static void key_service_start(void);
+
+#if KEY_USE_TIMER
+/* 单生产者(定时器中断)/单消费者(扫描线程)环形缓冲区，读写各自只修改自己的下标，无需加锁 */
+typedef struct
+{
+    rt_uint16_t map;        /* 完整扫描的按键位图 */
+    rt_tick_t   tick;       /* 扫描完成时刻 */
+} key_scan_t;
+
+static key_scan_t key_ring[KEY_RING_SIZE];
+static volatile rt_uint32_t key_ring_head;  /* 只由定时器中断写 */
+static volatile rt_uint32_t key_ring_tail;  /* 只由扫描线程写 */
+static struct rt_timer key_timer;
+static struct rt_semaphore key_scan_sem;    /* 有新的扫描结果 */
+static rt_uint8_t  key_timer_row;           /* 当前已拉低的行 */
+static rt_uint16_t key_timer_map;           /* 本轮扫描已读到的行 */
+#endif /* KEY_USE_TIMER */
+
+/* 把引脚加入按端口分组的表，返回所在表项下标 */
+static rt_uint8_t key_port_add(key_port_t *tab, rt_uint8_t *num, rt_base_t pin)
+{
+    rt_uint8_t i;
+
+    for (i = 0; i < *num; i++)
+    {
+        if (tab[i].port == GET_PIN_PORT(pin)) break;
+    }
+    if (i == *num)
+    {
+        tab[i].port = GET_PIN_PORT(pin);
+        tab[i].mask = 0;
+        (*num)++;
+    }
+    tab[i].mask |= GET_PIN_MASK(pin);
+    return i;
+}
+
+/* 读取所有列线，返回按 key_col_pins 顺序排列的低电平位图 */
+static rt_uint8_t key_col_read(void)
+{
+    rt_uint32_t idr[4];
+    rt_uint8_t i, low = 0;
+
+    for (i = 0; i < key_col_port_num; i++)
+    {
+        idr[i] = rt_pin_port_read(key_col_port[i].port, key_col_port[i].mask);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        if (!(idr[key_col_index[i]] & GET_PIN_MASK(key_col_pins[i]))) low |= 1 << i;
+    }
+    return low;
+}
+
+/* 拉低第 r 行，其他行输出高电平，每个端口一次写入 */
+static void key_row_select(int r)
+{
+    rt_uint32_t clr;
+    int i;
+
+    for (i = 0; i < key_row_port_num; i++)
+    {
+        clr = key_row_port[i].port == GET_PIN_PORT(key_row_pins[r]) ? GET_PIN_MASK(key_row_pins[r]) : 0;
+        rt_pin_port_write(key_row_port[i].port, key_row_port[i].mask & ~clr, clr);
+    }
+}
 
 /* ===================== 键盘初始化函数 ===================== */
 
@@ -54,81 +172,320 @@ void key_init(void)
     rt_pin_mode(KEY_C2_PIN, PIN_MODE_INPUT_PULLUP);  /* 第二列输入线 */
     rt_pin_mode(KEY_C3_PIN, PIN_MODE_INPUT_PULLUP);  /* 第三列输入线 */
     rt_pin_mode(KEY_C4_PIN, PIN_MODE_INPUT_PULLUP);  /* 第四列输入线 */
+
+    /* ========== 生成端口访问表 ========== */
+    key_row_port_num = 0;
+    key_col_port_num = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        key_port_add(key_row_port, &key_row_port_num, key_row_pins[i]);
+        key_col_index[i] = key_port_add(key_col_port, &key_col_port_num, key_col_pins[i]);
+    }
+
+#if KEY_USE_IRQ
+    /* 列线改为上拉+下降沿中断输入，仍可用 rt_pin_read 读取电平。
+       中断始终保持使能(关闭中断会把引脚复位为模拟输入)，是否唤醒由 key_armed 决定 */
+    rt_sem_init(&key_sem, "key", 0, RT_IPC_FLAG_PRIO);
+    for (int i = 0; i < 4; i++)
+    {
+        rt_pin_attach_irq(key_col_pins[i], PIN_IRQ_MODE_FALLING, key_col_isr, RT_NULL);
+        rt_pin_irq_enable(key_col_pins[i], PIN_IRQ_ENABLE);
+    }
+#endif
+
+    /* ========== 启动按键事件服务 ========== */
+    key_service_start();
 }
 
 /* ===================== 按键扫描函数 ===================== */
 
 /**
  * @brief  4x4矩阵键盘扫描函数
- * @retval 按键值: 1-16对应不同按键，0表示无按键按下
+ * @retval 按键位图: bit(n-1) 置1表示键值n按下，支持多键同时按下
  * @note   扫描算法：
  *         1. 逐行扫描：依次将R1-R4拉低，其他行保持高电平
  *         2. 检测列线：读取C1-C4的电平状态
  *         3. 按键映射：按下按键时对应列线被拉低
- *         4. 返回值计算：根据行列位置计算唯一按键值
  *
  * 按键值映射表：
- * R1C1=1   R1C2=2   R1C3=3   R1C4=4
- * R2C1=5   R2C2=6   R2C3=7   R2C4=8
- * R3C1=9   R3C2=10  R3C3=11  R3C4=12
- * R4C1=13  R4C2=14  R4C3=15  R4C4=16
+ * R1C4=1   R1C3=2   R1C2=3   R1C1=4
+ * R2C4=5   R2C3=6   R2C2=7   R2C1=8
+ * R3C4=9   R3C3=10  R3C2=11  R3C1=12
+ * R4C4=13  R4C3=14  R4C2=15  R4C1=16
+ */
+rt_uint16_t key_scan(void)
+{
+    rt_uint16_t map = 0;
+    int r;
+
+    for (r = 0; r < 4; r++)
+    {
+        /* 设置扫描状态：当前行拉低，其他行保持高电平 */
+        key_row_select(r);
+
+        /* 等待电平稳定，消除GPIO切换时的毛刺干扰 */
+        rt_hw_us_delay(10);
+
+        /* 检测列线状态，按下按键时对应列线被拉低 */
+        map |= (rt_uint16_t)key_col_read() << (r * 4);
+    }
+
+    return map;
+}
+
+/**
+ * @brief  读取单个按键
+ * @retval 按键值: 1-16对应不同按键，0表示无按键按下；多键按下时返回键值最大的一个
  */
 rt_uint8_t key_read(void)
 {
+    rt_uint16_t map = key_scan();
     rt_uint8_t temp = 0;  /* 返回值变量，0表示无按键按下 */
 
-    /* =============== 第一行扫描 (R1=Low) =============== */
-    /* 设置扫描状态：R1拉低，其他行保持高电平 */
-    rt_pin_write(KEY_R1_PIN, PIN_LOW);
-    rt_pin_write(KEY_R2_PIN, PIN_HIGH);
-    rt_pin_write(KEY_R3_PIN, PIN_HIGH);
-    rt_pin_write(KEY_R4_PIN, PIN_HIGH);
+    while (map)
+    {
+        temp++;
+        map >>= 1;
+    }
+    return temp;
+}
 
-    /* 等待电平稳定，消除GPIO切换时的毛刺干扰 */
-    rt_hw_us_delay(10);
+/* ===================== 空闲等待函数 ===================== */
 
-    /* 检测列线状态，按下按键时对应列线被拉低 */
-    if (rt_pin_read(KEY_C4_PIN) == PIN_LOW) temp = 1;   /* R1C4 -> 键值1 */
-    if (rt_pin_read(KEY_C3_PIN) == PIN_LOW) temp = 2;   /* R1C3 -> 键值2 */
-    if (rt_pin_read(KEY_C2_PIN) == PIN_LOW) temp = 3;   /* R1C2 -> 键值3 */
-    if (rt_pin_read(KEY_C1_PIN) == PIN_LOW) temp = 4;   /* R1C1 -> 键值4 */
+/**
+ * @brief  等待按键按下
+ * @param  timeout: 最长等待时间(tick)，RT_WAITING_FOREVER 表示一直等待
+ * @retval RT_EOK: 有按键按下(或轮询周期到)，-RT_ETIMEOUT: 等待超时
+ * @note   KEY_USE_IRQ=1 时：
+ *         1. 将四行全部拉低，任意按键按下都会把对应列线拉低
+ *         2. 若此时已有列线为低电平直接返回，否则休眠等待列线下降沿中断
+ *         3. 返回后由 key_read() 做完整扫描，key_read 会重新设置各行电平
+ *         KEY_USE_IRQ=0 时：延时 KEY_SCAN_MS 后返回，与原轮询方式相同
+ *         调用者应在所有按键释放且消抖完成后再调用，按住期间用 KEY_SCAN_MS 周期扫描
+ */
+rt_err_t key_wait(rt_int32_t timeout)
+{
+#if KEY_USE_IRQ
+    rt_err_t ret;
 
-    /* =============== 第二行扫描 (R2=Low) =============== */
-    /* 切换扫描行：R2拉低，其他行保持高电平 */
-    rt_pin_write(KEY_R1_PIN, PIN_HIGH);
-    rt_pin_write(KEY_R2_PIN, PIN_LOW);
+    /* 所有行拉低，按键矩阵等效为4个并联的列按键 */
+    for (int i = 0; i < key_row_port_num; i++)
+    {
+        rt_pin_port_write(key_row_port[i].port, 0, key_row_port[i].mask);
+    }
     rt_hw_us_delay(10);  /* 等待电平稳定 */
 
-    /* 检测第二行各列按键状态 */
-    if (rt_pin_read(KEY_C4_PIN) == PIN_LOW) temp = 5;   /* R2C4 -> 键值5 */
-    if (rt_pin_read(KEY_C3_PIN) == PIN_LOW) temp = 6;   /* R2C3 -> 键值6 */
-    if (rt_pin_read(KEY_C2_PIN) == PIN_LOW) temp = 7;   /* R2C2 -> 键值7 */
-    if (rt_pin_read(KEY_C1_PIN) == PIN_LOW) temp = 8;   /* R2C1 -> 键值8 */
+    /* 清除扫描期间可能残留的信号，再开始接受中断唤醒 */
+    rt_sem_control(&key_sem, RT_IPC_CMD_RESET, (void *)0);
+    key_armed = 1;
 
-    /* =============== 第三行扫描 (R3=Low) =============== */
-    /* 切换扫描行：R3拉低，其他行保持高电平 */
-    rt_pin_write(KEY_R2_PIN, PIN_HIGH);
-    rt_pin_write(KEY_R3_PIN, PIN_LOW);
-    rt_hw_us_delay(10);  /* 等待电平稳定 */
+    /* 按键在拉低行线之前已经按下时不会再产生下降沿，直接返回 */
+    if (key_col_read())
+    {
+        key_armed = 0;
+        return RT_EOK;
+    }
 
-    /* 检测第三行各列按键状态 */
-    if (rt_pin_read(KEY_C4_PIN) == PIN_LOW) temp = 9;   /* R3C4 -> 键值9 */
-    if (rt_pin_read(KEY_C3_PIN) == PIN_LOW) temp = 10;  /* R3C3 -> 键值10 */
-    if (rt_pin_read(KEY_C2_PIN) == PIN_LOW) temp = 11;  /* R3C2 -> 键值11 */
-    if (rt_pin_read(KEY_C1_PIN) == PIN_LOW) temp = 12;  /* R3C1 -> 键值12 */
+    ret = rt_sem_take(&key_sem, timeout);
+    key_armed = 0;
+    return ret;
+#else
+    rt_thread_mdelay(KEY_SCAN_MS);
+    return RT_EOK;
+#endif
+}
 
-    /* =============== 第四行扫描 (R4=Low) =============== */
-    /* 切换扫描行：R4拉低，其他行保持高电平 */
-    rt_pin_write(KEY_R3_PIN, PIN_HIGH);
-    rt_pin_write(KEY_R4_PIN, PIN_LOW);
-    rt_hw_us_delay(10);  /* 等待电平稳定 */
+/* ===================== 定时器扫描 ===================== */
 
-    /* 检测第四行各列按键状态 */
-    if (rt_pin_read(KEY_C4_PIN) == PIN_LOW) temp = 13;  /* R4C4 -> 键值13 */
-    if (rt_pin_read(KEY_C3_PIN) == PIN_LOW) temp = 14;  /* R4C3 -> 键值14 */
-    if (rt_pin_read(KEY_C2_PIN) == PIN_LOW) temp = 15;  /* R4C2 -> 键值15 */
-    if (rt_pin_read(KEY_C1_PIN) == PIN_LOW) temp = 16;  /* R4C1 -> 键值16 */
+#if KEY_USE_TIMER
+/**
+ * @brief  扫描定时器回调(硬定时器，在系统节拍中断中执行)
+ * @note   每次读取上一节拍已拉低那一行的列线，再拉低下一行；
+ *         四行读完后把位图放入环形缓冲区并通知扫描线程，缓冲区满时丢弃本次结果
+ */
+static void key_timer_timeout(void *parameter)
+{
+    rt_uint32_t head;
 
-    /* 返回检测到的按键值，0表示无按键按下 */
-    return temp;
+    key_timer_map |= (rt_uint16_t)key_col_read() << (key_timer_row * 4);
+
+    if (++key_timer_row == 4)
+    {
+        head = key_ring_head;
+        if (head - key_ring_tail < KEY_RING_SIZE)
+        {
+            key_ring[head & (KEY_RING_SIZE - 1)].map  = key_timer_map;
+            key_ring[head & (KEY_RING_SIZE - 1)].tick = rt_tick_get();
+            key_ring_head = head + 1;   /* 数据写完后再发布下标 */
+            rt_sem_release(&key_scan_sem);
+        }
+        key_timer_row = 0;
+        key_timer_map = 0;
+    }
+
+    key_row_select(key_timer_row);
+}
+
+/* 从第一行开始一轮新的定时扫描，定时器已停止，可以安全地清空缓冲区 */
+static void key_timer_start(void)
+{
+    key_ring_tail = key_ring_head;
+    rt_sem_control(&key_scan_sem, RT_IPC_CMD_RESET, (void *)0);
+    key_timer_row = 0;
+    key_timer_map = 0;
+    key_row_select(0);
+    rt_timer_start(&key_timer);
+}
+
+/* 取出一次扫描结果，缓冲区为空时返回0 */
+static int key_ring_pop(key_scan_t *scan)
+{
+    rt_uint32_t tail = key_ring_tail;
+
+    if (tail == key_ring_head) return 0;
+    *scan = key_ring[tail & (KEY_RING_SIZE - 1)];
+    key_ring_tail = tail + 1;
+    return 1;
+}
+#endif /* KEY_USE_TIMER */
+
+/* ===================== 按键事件服务 ===================== */
+
+/* 事件入队，队列满时丢弃 */
+static void key_event_post(rt_uint8_t key, rt_uint8_t type, rt_tick_t now)
+{
+    key_event_t evt;
+
+    evt.key  = key;
+    evt.type = type;
+    evt.tick = now;
+    trace_mark("key_event", (rt_uint16_t)(type << 8 | key));
+    rt_mq_send(key_mq, &evt, sizeof(evt));
+}
+
+/**
+ * @brief  处理一次扫描结果
+ * @param  map: key_scan() 返回的按键位图
+ * @param  now: 扫描时刻
+ * @retval 1: 所有按键已释放且消抖计数归零，可以休眠；0: 需要继续扫描
+ * @note   每个按键独立积分消抖：按下时计数加1，释放时减1，
+ *         计数到 KEY_DEBOUNCE_CNT 判定为按下，回到0判定为释放，
+ *         抖动只会使计数来回变化而不会产生多余事件
+ */
+static int key_process(rt_uint16_t map, rt_tick_t now)
+{
+    int k, idle = 1;
+
+    for (k = 0; k < 16; k++)
+    {
+        key_state_t *st = &key_state[k];
+
+        if (map & (1 << k))
+        {
+            if (st->cnt < KEY_DEBOUNCE_CNT) st->cnt++;
+        }
+        else
+        {
+            if (st->cnt > 0) st->cnt--;
+        }
+
+        if (!st->pressed && st->cnt == KEY_DEBOUNCE_CNT)
+        {
+            st->pressed = 1;
+            st->longed  = 0;
+            st->tick    = now + rt_tick_from_millisecond(KEY_LONG_MS);
+            key_event_post(k + 1, KEY_EVT_PRESS, now);
+        }
+        else if (st->pressed && st->cnt == 0)
+        {
+            st->pressed = 0;
+            key_event_post(k + 1, KEY_EVT_RELEASE, now);
+        }
+        else if (st->pressed && (rt_int32_t)(now - st->tick) >= 0)
+        {
+            key_event_post(k + 1, st->longed ? KEY_EVT_REPEAT : KEY_EVT_LONG, now);
+            st->longed = 1;
+            st->tick   = now + rt_tick_from_millisecond(KEY_REPEAT_MS);
+        }
+
+        if (st->cnt != 0) idle = 0;
+    }
+    return idle;
+}
+
+/**
+ * @brief  按键扫描线程入口函数
+ * @note   KEY_USE_TIMER=1：由定时器完成扫描，本线程只取出扫描结果做消抖；
+ *         全部释放并消抖完成后停止定时器，调用 key_wait() 休眠直到列线中断唤醒
+ *         KEY_USE_TIMER=0：有按键时每 KEY_SCAN_MS 扫描一次，空闲时同样休眠
+ */
+static void key_scan_thread_entry(void *parameter)
+{
+#if KEY_USE_TIMER
+    key_scan_t scan;
+    int idle;
+
+    while (1)
+    {
+#if KEY_USE_IRQ
+        key_wait(RT_WAITING_FOREVER);
+#endif
+        key_timer_start();
+        idle = 0;
+        while (!idle || !KEY_USE_IRQ)
+        {
+            rt_sem_take(&key_scan_sem, RT_WAITING_FOREVER);
+            trace_begin("key_scan");
+            while (key_ring_pop(&scan))
+            {
+                idle = key_process(scan.map, scan.tick);
+            }
+            trace_end("key_scan");
+        }
+        rt_timer_stop(&key_timer);
+    }
+#else
+    int idle;
+
+    while (1)
+    {
+        trace_begin("key_scan");
+        idle = key_process(key_scan(), rt_tick_get());
+        trace_end("key_scan");
+        if (idle)
+            key_wait(RT_WAITING_FOREVER);
+        else
+            rt_thread_mdelay(KEY_SCAN_MS);
+    }
+#endif
+}
+
+/* 创建事件队列与扫描线程，优先级高于业务线程，保证消抖节拍稳定 */
+static void key_service_start(void)
+{
+    rt_thread_t tid;
+
+    key_mq = rt_mq_create("key", sizeof(key_event_t), KEY_EVT_DEPTH, RT_IPC_FLAG_FIFO);
+    if (key_mq == RT_NULL) return;
+
+#if KEY_USE_TIMER
+    rt_sem_init(&key_scan_sem, "keyscan", 0, RT_IPC_FLAG_PRIO);
+    rt_timer_init(&key_timer, "keyscan", key_timer_timeout, RT_NULL, KEY_ROW_TICKS,
+                  RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+#endif
+
+    tid = rt_thread_create("key_scan", key_scan_thread_entry, RT_NULL, 1024, 19, 10);
+    if (tid != RT_NULL) rt_thread_startup(tid);
+}
+
+/**
+ * @brief  读取一个按键事件
+ * @param  evt:     事件输出
+ * @param  timeout: 最长等待时间(tick)，RT_WAITING_FOREVER 表示一直等待
+ * @retval RT_EOK: 读到事件，其它: 超时或服务未启动
+ */
+rt_err_t key_event_get(key_event_t *evt, rt_int32_t timeout)
+{
+    if (key_mq == RT_NULL) return -RT_ERROR;
+    return rt_mq_recv(key_mq, evt, sizeof(*evt), timeout) > 0 ? RT_EOK : -RT_ETIMEOUT;
 }
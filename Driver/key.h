@@ -26,8 +26,42 @@
 #define KEY_C3_PIN  GET_PIN(B, 2)  // P1-18
 #define KEY_C4_PIN  GET_PIN(F, 4)  // P1-22
 
+/* 空闲唤醒方式：1=行线全部拉低，列线下降沿中断唤醒扫描线程；0=按 KEY_SCAN_MS 周期轮询 */
+#define KEY_USE_IRQ         1
+#define KEY_SCAN_MS         5       /* 线程扫描方式下，有按键按下时的扫描周期(ms) */
+
+/* 扫描方式：1=系统节拍硬定时器在中断中每次推进一行，行线的稳定时间由下一次节拍提供，
+   不忙等，也不受线程调度影响；0=扫描线程逐行延时扫描 */
+#define KEY_USE_TIMER       1
+#define KEY_ROW_TICKS       1       /* 每行停留的节拍数，完整扫描一次为 4*KEY_ROW_TICKS 节拍 */
+#define KEY_RING_SIZE       8       /* 扫描结果缓冲区大小，必须是2的幂 */
+
+/* 按键事件服务 */
+/* 积分消抖计数，连续 N 次完整扫描一致才改变状态。消抖窗口：定时器扫描为 N*4*KEY_ROW_TICKS 节拍
+   (1kHz 节拍下约12ms)，线程扫描为 N*KEY_SCAN_MS(约15ms) */
+#define KEY_DEBOUNCE_CNT    3
+#define KEY_LONG_MS         1000    /* 按住超过此时间产生 KEY_EVT_LONG */
+#define KEY_REPEAT_MS       200     /* 长按后每隔此时间产生一次 KEY_EVT_REPEAT */
+#define KEY_EVT_DEPTH       16      /* 事件队列深度 */
+
+/* 按键事件类型 */
+#define KEY_EVT_PRESS       0       /* 按下(消抖后) */
+#define KEY_EVT_RELEASE     1       /* 释放(消抖后) */
+#define KEY_EVT_LONG        2       /* 长按 */
+#define KEY_EVT_REPEAT      3       /* 长按后的自动重复 */
+
+typedef struct
+{
+    rt_uint8_t key;         /* 键值 1-16，与 key_read() 的返回值一致 */
+    rt_uint8_t type;        /* KEY_EVT_xxx */
+    rt_tick_t  tick;        /* 事件产生时的系统节拍 */
+} key_event_t;
+
 void key_init(void);
+rt_uint16_t key_scan(void);
 rt_uint8_t key_read(void);
+rt_err_t key_wait(rt_int32_t timeout);
+rt_err_t key_event_get(key_event_t *evt, rt_int32_t timeout);
 
 
 #endif /* DRIVER_KEY_H_ */
@@ -30,7 +30,9 @@
 /* 系统头文件 */
 #include "lcd.h"                /* LCD驱动头文件 */
 #include "drv_spi.h"            /* RT-Thread SPI驱动 */
+#include "trace.h"              /* 跟踪打点 */
 #include "font_ascii_16x8.h"    /* ASCII字符字库 */
+#include "font_index.h"         /* 汉字字库索引(tools/fontindex.py生成) */
 
 /* ===================== 函数声明与配置 ===================== */
 
@@ -42,6 +44,7 @@ void LCD_Init_Regs(void);  /* ST7735S寄存器初始化函数声明 */
 
 /* 全局变量 */
 static struct rt_spi_device *lcd_spi_dev;  /* SPI设备句柄 */
+lcd_stats_t lcd_stats;                      /* SPI传输统计 */
 
 /* ===================== LCD初始化函数 ===================== */
 
@@ -80,7 +83,7 @@ int LCD_Init_RTT(void)
     struct rt_spi_configuration cfg;
     cfg.data_width = 8;                                         /* 数据宽度：8位 */
     cfg.mode = RT_SPI_MASTER | RT_SPI_MODE_0 | RT_SPI_MSB;     /* 主模式，模式0，MSB先发 */
-    cfg.max_hz = 20 * 1000 * 1000;                            /* 最大频率：20MHz */
+    cfg.max_hz = LCD_SPI_MAX_HZ;                              /* 最大频率：20MHz */
     rt_spi_configure(lcd_spi_dev, &cfg);
 
     /* ========== 步骤5：执行LCD寄存器初始化 ========== */
@@ -92,6 +95,8 @@ int LCD_Init_RTT(void)
 /* 2. 替换底层的 SPI 发送函数 */
 void LCD_Writ_Bus(u8 dat)
 {
+    lcd_stats.bytes += 1;
+    lcd_stats.xfers++;
     rt_spi_send(lcd_spi_dev, &dat, 1);
 }
 
@@ -107,6 +112,8 @@ void LCD_WR_DATA(u16 dat)
     u8 buf[2];
     buf[0] = dat >> 8;
     buf[1] = dat & 0xff;
+    lcd_stats.bytes += 2;
+    lcd_stats.xfers++;
     rt_spi_send(lcd_spi_dev, buf, 2);
 }
 
@@ -116,44 +123,147 @@ void LCD_WR_REG(u8 dat)
     LCD_Writ_Bus(dat);
 }
 
-void LCD_Address_Set(u16 x1,u16 y1,u16 x2,u16 y2)
+/* ===================== 像素流式传输 ===================== */
+
+#if !LCD_USE_FRAMEBUFFER
+/* 流式发送的乒乓行缓冲，按SPI线上字节序(高字节在前)存放：
+   一块在DMA发送的同时，CPU填充另一块 */
+static u8 lcd_line_buf[2][LCD_STREAM_PIXELS * 2];
+
+/******************************************************************************
+      函数说明：开始一次像素流传输
+      返回值：  RT_EOK 成功，其它值表示总线获取失败
+      说明：    DC保持高电平，SPI总线与片选在 LCD_Stream_End 之前一直被占用，
+                期间的多次发送不再重复加锁和检查配置
+******************************************************************************/
+static rt_err_t LCD_Stream_Begin(void)
 {
-    if(USE_HORIZONTAL==0)
-    {
-        LCD_WR_REG(0x2a); LCD_WR_DATA(x1+2); LCD_WR_DATA(x2+2);
-        LCD_WR_REG(0x2b); LCD_WR_DATA(y1+1); LCD_WR_DATA(y2+1);
-        LCD_WR_REG(0x2c);
-    }
-    else if(USE_HORIZONTAL==1)
-    {
-        LCD_WR_REG(0x2a); LCD_WR_DATA(x1+2); LCD_WR_DATA(x2+2);
-        LCD_WR_REG(0x2b); LCD_WR_DATA(y1+3); LCD_WR_DATA(y2+3);
-        LCD_WR_REG(0x2c);
-    }
-    else if(USE_HORIZONTAL==2)
-    {
-        LCD_WR_REG(0x2a); LCD_WR_DATA(x1+1); LCD_WR_DATA(x2+1);
-        LCD_WR_REG(0x2b); LCD_WR_DATA(y1+2); LCD_WR_DATA(y2+2);
-        LCD_WR_REG(0x2c);
-    }
-    else
+    LCD_DC_Set();
+    if (rt_spi_take_bus(lcd_spi_dev) != RT_EOK) return -RT_EBUSY;
+    rt_spi_take(lcd_spi_dev);
+    return RT_EOK;
+}
+
+/******************************************************************************
+      函数说明：提交一段像素数据
+      入口数据：buf 数据，在下一次提交或 LCD_Stream_End 之前不得修改
+                len 字节数
+      返回值：  无
+      说明：    先等待上一段发送完成再提交本段，本段在后台(DMA)发送，函数立即返回
+******************************************************************************/
+static void LCD_Stream_Send(const void *buf, rt_size_t len)
+{
+    const u8 *p = buf;
+    rt_uint16_t n;
+
+    while (len)
     {
-        LCD_WR_REG(0x2a); LCD_WR_DATA(x1+3); LCD_WR_DATA(x2+3);
-        LCD_WR_REG(0x2b); LCD_WR_DATA(y1+2); LCD_WR_DATA(y2+2);
-        LCD_WR_REG(0x2c);
+        n = len > 0xFFFF ? 0xFFFF : len;  /* HAL单次传输长度为16位 */
+        rt_hw_spi_dma_wait(lcd_spi_dev, RT_WAITING_FOREVER);
+        rt_hw_spi_dma_submit(lcd_spi_dev, p, n);
+        lcd_stats.bytes += n;
+        lcd_stats.xfers++;
+        p += n;
+        len -= n;
     }
 }
 
+static void LCD_Stream_End(void)
+{
+    rt_hw_spi_dma_wait(lcd_spi_dev, RT_WAITING_FOREVER);
+    rt_spi_release(lcd_spi_dev);
+    rt_spi_release_bus(lcd_spi_dev);
+}
+#endif /* !LCD_USE_FRAMEBUFFER */
+
+/* ===================== 地址窗口消息链 ===================== */
+
+/* 各显示方向下控制器 RAM 与可视区域的偏移 */
+#if USE_HORIZONTAL==0
+#define LCD_X_OFFSET    2
+#define LCD_Y_OFFSET    1
+#elif USE_HORIZONTAL==1
+#define LCD_X_OFFSET    2
+#define LCD_Y_OFFSET    3
+#elif USE_HORIZONTAL==2
+#define LCD_X_OFFSET    1
+#define LCD_Y_OFFSET    2
+#else
+#define LCD_X_OFFSET    3
+#define LCD_Y_OFFSET    2
+#endif
+
+/* 0x2A、列地址、0x2B、行地址、0x2C 五段 */
+#define LCD_CHAIN_WINDOW    5
+
+/* 一次区域刷新的SPI消息链：地址窗口五段之后是每行一段像素。每段自带DC电平，
+   整条链一次 rt_spi_transfer_chain 提交，段间的DC切换由SPI驱动完成，
+   支持的总线在DMA完成中断里直接启动下一段 */
+static struct rt_spi_chain_message lcd_chain[LCD_CHAIN_WINDOW + LCD_H];
+static u8 lcd_win_cmd[3] = {0x2A, 0x2B, 0x2C};  /* 放在RAM中，DMA不能读取XIP中的常量 */
+static u8 lcd_win_arg[2][4];  /* 列、行地址，链发送完成前不得修改 */
+
+/* 填写一段消息，dc 为该段的DC电平 */
+static void LCD_Chain_Node(struct rt_spi_chain_message *msg,const void *buf,rt_size_t len,rt_bool_t dc)
+{
+    msg->parent.send_buf = buf;
+    msg->parent.recv_buf = RT_NULL;
+    msg->parent.length = len;
+    msg->parent.cs_take = 0;
+    msg->parent.cs_release = 0;
+    msg->parent.next = &msg[1].parent;
+    msg->gpio_port = GET_PIN_PORT(LCD_DC_PIN);
+    msg->gpio_set_mask = dc ? GET_PIN_MASK(LCD_DC_PIN) : 0;
+    msg->gpio_clr_mask = dc ? 0 : GET_PIN_MASK(LCD_DC_PIN);
+    lcd_stats.bytes += len;
+}
+
+static void LCD_Chain_Pair(u8 *buf,u16 a,u16 b)
+{
+    buf[0] = a >> 8;
+    buf[1] = a & 0xff;
+    buf[2] = b >> 8;
+    buf[3] = b & 0xff;
+}
+
+/* 在链首填写地址窗口五段，返回第一个像素段 */
+static struct rt_spi_chain_message *LCD_Chain_Window(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+    lcd_stats.windows++;
+    LCD_Chain_Pair(lcd_win_arg[0], x1 + LCD_X_OFFSET, x2 + LCD_X_OFFSET);
+    LCD_Chain_Pair(lcd_win_arg[1], y1 + LCD_Y_OFFSET, y2 + LCD_Y_OFFSET);
+    LCD_Chain_Node(&lcd_chain[0], &lcd_win_cmd[0], 1, RT_FALSE);
+    LCD_Chain_Node(&lcd_chain[1], lcd_win_arg[0], 4, RT_TRUE);
+    LCD_Chain_Node(&lcd_chain[2], &lcd_win_cmd[1], 1, RT_FALSE);
+    LCD_Chain_Node(&lcd_chain[3], lcd_win_arg[1], 4, RT_TRUE);
+    LCD_Chain_Node(&lcd_chain[4], &lcd_win_cmd[2], 1, RT_FALSE);
+    return &lcd_chain[LCD_CHAIN_WINDOW];
+}
+
+/* 以 last 为最后一段提交整条链，返回后链中的缓冲区可以修改 */
+static void LCD_Chain_Submit(struct rt_spi_chain_message *last)
+{
+    lcd_chain[0].parent.cs_take = 1;
+    last->parent.cs_release = 1;
+    last->parent.next = RT_NULL;
+    lcd_stats.xfers++;
+    rt_spi_transfer_chain(lcd_spi_dev, lcd_chain);
+}
+
+void LCD_Address_Set(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+    LCD_Chain_Submit(LCD_Chain_Window(x1, y1, x2, y2) - 1);
+}
+
 /* 3. 屏幕初始化序列 (移植自原代码) */
 void LCD_Init_Regs(void)
 {
+    /* 等待时间按 ST7735S 手册取值：复位脉宽 >= 10us，复位后 120ms 才能发送 Sleep Out，
+       Sleep Out 后 120ms 才能继续配置。调用线程在等待期间让出CPU，其它外设初始化可以并行 */
     LCD_RES_Clr();
-    rt_thread_mdelay(100);
+    rt_thread_mdelay(1);
     LCD_RES_Set();
-    rt_thread_mdelay(100);
-
-    LCD_BLK_Set();
-    rt_thread_mdelay(100);
+    rt_thread_mdelay(120);
 
     LCD_WR_REG(0x11); // Sleep out
     rt_thread_mdelay(120);
@@ -194,6 +304,498 @@ void LCD_Init_Regs(void)
     LCD_WR_REG(0x13);
     LCD_WR_REG(0x29);
     LCD_WR_REG(0x2C);
+
+    LCD_BLK_Set();  /* 显示开启后再打开背光，避免复位期间的花屏 */
+}
+
+/* ===================== 帧缓冲与脏矩形管理 ===================== */
+
+#if LCD_USE_FRAMEBUFFER
+
+/* 合并两个脏矩形时允许多推送的像素数，约等于一次地址窗口设置的开销 */
+#define LCD_FB_MERGE_SLACK  64
+
+/* 像素字节交换：帧缓冲按SPI线上字节序(高字节在前)存放，刷新时可整行直接发送 */
+#define LCD_FB_SWAP(c)      ((u16)(((c) >> 8) | ((c) << 8)))
+
+/* 脏矩形，坐标为闭区间 */
+typedef struct
+{
+    u16 x1, y1, x2, y2;
+} lcd_rect_t;
+
+#ifdef LCD_FB_ADDR
+static u16 (*const lcd_fb)[LCD_W] = (u16 (*)[LCD_W])LCD_FB_ADDR;
+#else
+static u16 lcd_fb[LCD_H][LCD_W] LCD_FB_SECTION;
+#endif
+
+static lcd_rect_t lcd_dirty[LCD_FB_DIRTY_MAX];  /* 待刷新区域列表 */
+static u8 lcd_dirty_num = 0;                    /* 待刷新区域个数 */
+
+/* 当前绘制窗口及写入光标，与屏幕的 0x2A/0x2B/0x2C 窗口语义一致 */
+static struct
+{
+    u16 x1, x2;
+    u16 x, y;
+} lcd_win;
+
+static u32 LCD_Rect_Area(const lcd_rect_t *r)
+{
+    return (u32)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+static void LCD_Rect_Union(lcd_rect_t *dst, const lcd_rect_t *src)
+{
+    if (src->x1 < dst->x1) dst->x1 = src->x1;
+    if (src->y1 < dst->y1) dst->y1 = src->y1;
+    if (src->x2 > dst->x2) dst->x2 = src->x2;
+    if (src->y2 > dst->y2) dst->y2 = src->y2;
+}
+
+/******************************************************************************
+      函数说明：登记一个脏矩形，并与已有矩形合并
+      入口数据：x1,y1   起始坐标
+                x2,y2   终止坐标(包含)
+      返回值：  无
+      说明：    合并后的面积不超过两者之和加 LCD_FB_MERGE_SLACK 时合并，
+                即重叠或紧邻的区域会被合成一次窗口写入
+******************************************************************************/
+static void LCD_FB_MarkDirty(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+    lcd_rect_t r, u;
+    u32 cost, best_cost = 0xFFFFFFFF;
+    u8 i, best = 0;
+
+    if (x1 >= LCD_W || y1 >= LCD_H || x1 > x2 || y1 > y2) return;
+    if (x2 >= LCD_W) x2 = LCD_W - 1;
+    if (y2 >= LCD_H) y2 = LCD_H - 1;
+    r.x1 = x1; r.y1 = y1; r.x2 = x2; r.y2 = y2;
+
+    /* 反复与已有矩形合并，直到没有可以合并的为止 */
+    i = 0;
+    while (i < lcd_dirty_num)
+    {
+        u = lcd_dirty[i];
+        LCD_Rect_Union(&u, &r);
+        if (LCD_Rect_Area(&u) <= LCD_Rect_Area(&lcd_dirty[i]) + LCD_Rect_Area(&r) + LCD_FB_MERGE_SLACK)
+        {
+            r = u;
+            lcd_dirty[i] = lcd_dirty[--lcd_dirty_num];
+            i = 0;
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    if (lcd_dirty_num < LCD_FB_DIRTY_MAX)
+    {
+        lcd_dirty[lcd_dirty_num++] = r;
+        return;
+    }
+
+    /* 列表已满：并入扩张面积最小的矩形，再重新登记以便继续合并 */
+    for (i = 0; i < lcd_dirty_num; i++)
+    {
+        u = lcd_dirty[i];
+        LCD_Rect_Union(&u, &r);
+        cost = LCD_Rect_Area(&u) - LCD_Rect_Area(&lcd_dirty[i]);
+        if (cost < best_cost)
+        {
+            best_cost = cost;
+            best = i;
+        }
+    }
+    LCD_Rect_Union(&r, &lcd_dirty[best]);
+    lcd_dirty[best] = lcd_dirty[--lcd_dirty_num];
+    LCD_FB_MarkDirty(r.x1, r.y1, r.x2, r.y2);
+}
+
+/******************************************************************************
+      函数说明：把帧缓冲中的一个矩形推送到屏幕
+      入口数据：r 要推送的矩形
+      返回值：  无
+      说明：    地址窗口与像素组成一条消息链一次提交，整行宽度的区域在帧缓冲中
+                连续，只需一段像素，否则每行一段
+******************************************************************************/
+static void LCD_FB_FlushRect(const lcd_rect_t *r)
+{
+    struct rt_spi_chain_message *msg;
+    u16 y;
+
+    msg = LCD_Chain_Window(r->x1, r->y1, r->x2, r->y2);
+    if (r->x1 == 0 && r->x2 == LCD_W - 1)
+    {
+        LCD_Chain_Node(msg++, &lcd_fb[r->y1][0], (rt_size_t)LCD_W * (r->y2 - r->y1 + 1) * 2, RT_TRUE);
+    }
+    else
+    {
+        for (y = r->y1; y <= r->y2; y++)
+        {
+            LCD_Chain_Node(msg++, &lcd_fb[y][r->x1], (rt_size_t)(r->x2 - r->x1 + 1) * 2, RT_TRUE);
+        }
+    }
+    LCD_Chain_Submit(msg - 1);
+}
+
+/******************************************************************************
+      函数说明：向帧缓冲的当前窗口写入像素
+      入口数据：buf   像素数组，为RT_NULL时全部写入color
+                color buf为RT_NULL时使用的颜色
+                n     像素个数
+      返回值：  无
+******************************************************************************/
+static void LCD_FB_Write(const u16 *buf,u16 color,rt_size_t n)
+{
+    u16 c = LCD_FB_SWAP(color);
+    u16 run, i, x;
+
+    while (n)
+    {
+        run = lcd_win.x2 - lcd_win.x + 1;
+        if (run > n) run = n;
+        /* 窗口超出屏幕的部分直接丢弃 */
+        if (lcd_win.y < LCD_H)
+        {
+            for (i = 0, x = lcd_win.x; i < run && x < LCD_W; i++, x++)
+            {
+                lcd_fb[lcd_win.y][x] = buf ? LCD_FB_SWAP(buf[i]) : c;
+            }
+        }
+        if (buf) buf += run;
+        n -= run;
+        lcd_win.x += run;
+        if (lcd_win.x > lcd_win.x2)
+        {
+            lcd_win.x = lcd_win.x1;
+            lcd_win.y++;
+        }
+    }
+}
+
+#endif /* LCD_USE_FRAMEBUFFER */
+
+/******************************************************************************
+      函数说明：设置绘制窗口，之后用 LCD_WritePixels / LCD_FillColor 按行依次写入像素
+      入口数据：x1,y1   起始坐标
+                x2,y2   终止坐标(包含)
+      返回值：  无
+      说明：    启用帧缓冲时窗口指向帧缓冲并登记脏区域，否则直接设置屏幕地址窗口
+******************************************************************************/
+void LCD_Set_Window(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+#if LCD_USE_FRAMEBUFFER
+    lcd_win.x1 = x1;
+    lcd_win.x2 = x2;
+    lcd_win.x  = x1;
+    lcd_win.y  = y1;
+    LCD_FB_MarkDirty(x1, y1, x2, y2);
+#else
+    LCD_Address_Set(x1, y1, x2, y2);
+#endif
+}
+
+/******************************************************************************
+      函数说明：向当前窗口连续写入像素
+      入口数据：buf 像素数组(RGB565)
+                n   像素个数
+      返回值：  无
+      说明：    直接写屏时只占用一次SPI总线，按 LCD_STREAM_PIXELS 大小分块突发发送
+******************************************************************************/
+void LCD_WritePixels(const u16 *buf,rt_size_t n)
+{
+#if LCD_USE_FRAMEBUFFER
+    LCD_FB_Write(buf, 0, n);
+#else
+    rt_size_t i, chunk;
+    u8 idx = 0, *line;
+
+    if (n == 0 || LCD_Stream_Begin() != RT_EOK) return;
+    while (n)
+    {
+        chunk = n > LCD_STREAM_PIXELS ? LCD_STREAM_PIXELS : n;
+        line = lcd_line_buf[idx];
+        for (i = 0; i < chunk; i++)
+        {
+            line[i * 2]     = buf[i] >> 8;
+            line[i * 2 + 1] = buf[i] & 0xff;
+        }
+        LCD_Stream_Send(line, chunk * 2);
+        idx ^= 1;
+        buf += chunk;
+        n -= chunk;
+    }
+    LCD_Stream_End();
+#endif
+}
+
+/******************************************************************************
+      函数说明：向当前窗口连续写入n个相同颜色的像素
+      入口数据：color 颜色
+                n     像素个数
+      返回值：  无
+******************************************************************************/
+void LCD_FillColor(u16 color,rt_size_t n)
+{
+#if LCD_USE_FRAMEBUFFER
+    LCD_FB_Write(RT_NULL, color, n);
+#else
+    rt_size_t i, chunk;
+
+    if (n == 0 || LCD_Stream_Begin() != RT_EOK) return;
+    /* 行缓冲只需填充一次，之后重复发送(只读，无需乒乓) */
+    chunk = n > LCD_STREAM_PIXELS ? LCD_STREAM_PIXELS : n;
+    for (i = 0; i < chunk; i++)
+    {
+        lcd_line_buf[0][i * 2]     = color >> 8;
+        lcd_line_buf[0][i * 2 + 1] = color & 0xff;
+    }
+    while (n)
+    {
+        chunk = n > LCD_STREAM_PIXELS ? LCD_STREAM_PIXELS : n;
+        LCD_Stream_Send(lcd_line_buf[0], chunk * 2);
+        n -= chunk;
+    }
+    LCD_Stream_End();
+#endif
+}
+
+/******************************************************************************
+      函数说明：把点阵字模展开为整块像素后一次写入
+      入口数据：x,y   左上角坐标
+                w,h   点阵宽高，w须为8的倍数
+                msk   字模数据，每字节低位在前
+                fc,bc 字色和背景色
+      返回值：  无
+******************************************************************************/
+static void LCD_Blit_Mask(u16 x,u16 y,u16 w,u16 h,const u8 *msk,u16 fc,u16 bc)
+{
+    static u16 glyph_buf[LCD_GLYPH_MAX * LCD_GLYPH_MAX];
+    u16 k, n = w * h;
+
+    if (n > LCD_GLYPH_MAX * LCD_GLYPH_MAX) return;
+    for (k = 0; k < n; k++)
+    {
+        glyph_buf[k] = (msk[k >> 3] & (0x01 << (k & 7))) ? fc : bc;
+    }
+    LCD_Set_Window(x, y, x + w - 1, y + h - 1);
+    LCD_WritePixels(glyph_buf, n);
+}
+
+/******************************************************************************
+      函数说明：叠加方式绘制点阵，只改写点阵中为1的像素
+      入口数据：x,y 左上角坐标
+                w,h 点阵宽高，w须为8的倍数
+                msk 字模数据，每字节低位在前
+                fc  字色
+      返回值：  无
+      说明：    启用帧缓冲时直接与帧缓冲中的背景合成，前景像素的外接矩形作为
+                一个脏矩形刷新(空白字符不刷新)；直接写屏时无法读回背景，按行把
+                连续的前景像素合并为一次窗口写入
+******************************************************************************/
+static void LCD_Blend_Mask(u16 x,u16 y,u16 w,u16 h,const u8 *msk,u16 fc)
+{
+    u16 i, j, k;
+#if LCD_USE_FRAMEBUFFER
+    u16 c = LCD_FB_SWAP(fc);
+    u16 x1 = LCD_W, y1 = LCD_H, x2 = 0, y2 = 0;
+
+    if (x >= LCD_W || y >= LCD_H) return;
+    for (j = 0; j < h && y + j < LCD_H; j++)
+    {
+        for (i = 0, k = j * w; i < w && x + i < LCD_W; i++, k++)
+        {
+            if (!(msk[k >> 3] & (0x01 << (k & 7)))) continue;
+            lcd_fb[y + j][x + i] = c;
+            if (x + i < x1) x1 = x + i;
+            if (x + i > x2) x2 = x + i;
+            if (y + j < y1) y1 = y + j;
+            y2 = y + j;
+        }
+    }
+    if (x1 <= x2) LCD_FB_MarkDirty(x1, y1, x2, y2);
+#else
+    u16 s;
+
+    for (j = 0; j < h; j++)
+    {
+        i = 0;
+        while (i < w)
+        {
+            k = j * w + i;
+            if (!(msk[k >> 3] & (0x01 << (k & 7))))
+            {
+                i++;
+                continue;
+            }
+            /* 找出本行连续的前景像素 */
+            for (s = i; i < w; i++, k++)
+            {
+                if (!(msk[k >> 3] & (0x01 << (k & 7)))) break;
+            }
+            LCD_Set_Window(x + s, y + j, x + i - 1, y + j);
+            LCD_FillColor(fc, i - s);
+        }
+    }
+#endif
+}
+
+/* ===================== 字模查找与缓存 ===================== */
+
+/******************************************************************************
+      函数说明：解码一个UTF-8字符
+      入口数据：s    字符串
+                code 输出该字符的Unicode码点
+      返回值：  该字符占用的字节数，非法序列按单字节处理
+******************************************************************************/
+static u8 LCD_Utf8_Decode(const u8 *s,u32 *code)
+{
+    u8 i,n;
+
+    if(s[0]<0x80){*code=s[0];return 1;}
+    else if((s[0]&0xE0)==0xC0){*code=s[0]&0x1F;n=2;}
+    else if((s[0]&0xF0)==0xE0){*code=s[0]&0x0F;n=3;}
+    else if((s[0]&0xF8)==0xF0){*code=s[0]&0x07;n=4;}
+    else{*code=s[0];return 1;}
+    for(i=1;i<n;i++)
+    {
+        if((s[i]&0xC0)!=0x80){*code=s[0];return 1;}  /* 遇到结束符或非法字节 */
+        *code=(*code<<6)|(s[i]&0x3F);
+    }
+    return n;
+}
+
+/******************************************************************************
+      函数说明：在字库索引中二分查找字符
+      入口数据：tab  按码点升序排列的索引表(font_index.h)
+                num  索引表项数
+                code 字符码点
+      返回值：  字库数组下标，未找到返回-1
+******************************************************************************/
+static int LCD_Glyph_Search(const typFNT_INDEX *tab,u16 num,u32 code)
+{
+    int lo=0,hi=num-1,mid;
+
+    while(lo<=hi)
+    {
+        mid=(lo+hi)>>1;
+        if(tab[mid].code==code)return tab[mid].idx;
+        if(tab[mid].code<code)lo=mid+1;
+        else hi=mid-1;
+    }
+    return -1;
+}
+
+#if LCD_GLYPH_CACHE_NUM > 0
+/* 预展开的字模：按SPI线上字节序存放，可直接整块写入帧缓冲或发送 */
+typedef struct
+{
+    u32 code;       /* 字符码点 */
+    u16 fc, bc;     /* 展开时使用的字色和背景色 */
+    u8  sizey;      /* 字号，0表示空槽 */
+    u32 stamp;      /* 最近一次使用的时间戳，最小者最先被替换 */
+    u8  pix[LCD_GLYPH_CACHE_SIZE * LCD_GLYPH_CACHE_SIZE * 2];
+} lcd_glyph_t;
+
+static lcd_glyph_t lcd_glyph_cache[LCD_GLYPH_CACHE_NUM];
+static u32 lcd_glyph_clock = 0;
+
+/******************************************************************************
+      函数说明：从LRU缓存中取出已展开的字模，未命中时展开后替换最久未用的槽
+      入口数据：code  字符码点
+                sizey 字号
+                w     点阵宽度，高度为sizey
+                msk   字模数据
+                fc,bc 字色和背景色
+      返回值：  展开后的像素数据，字模过大不缓存时返回RT_NULL
+******************************************************************************/
+static const u8 *LCD_Glyph_Get(u32 code,u8 sizey,u16 w,const u8 *msk,u16 fc,u16 bc)
+{
+    lcd_glyph_t *g, *victim = &lcd_glyph_cache[0];
+    u16 k, c, n = w * sizey;
+    u8 i, *p;
+
+    if (n > LCD_GLYPH_CACHE_SIZE * LCD_GLYPH_CACHE_SIZE) return RT_NULL;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_NUM; i++)
+    {
+        g = &lcd_glyph_cache[i];
+        if (g->sizey == sizey && g->code == code && g->fc == fc && g->bc == bc)
+        {
+            g->stamp = ++lcd_glyph_clock;
+            return g->pix;
+        }
+        if (g->stamp < victim->stamp) victim = g;
+    }
+
+    victim->code  = code;
+    victim->sizey = sizey;
+    victim->fc    = fc;
+    victim->bc    = bc;
+    victim->stamp = ++lcd_glyph_clock;
+    for (k = 0, p = victim->pix; k < n; k++)
+    {
+        c = (msk[k >> 3] & (0x01 << (k & 7))) ? fc : bc;
+        *p++ = c >> 8;
+        *p++ = c & 0xff;
+    }
+    return victim->pix;
+}
+#endif
+
+/******************************************************************************
+      函数说明：非叠加方式绘制一个字模
+      入口数据：x,y   左上角坐标
+                code  字符码点，作为缓存键
+                sizey 字号(点阵高度)
+                w     点阵宽度，须为8的倍数
+                msk   字模数据
+                fc,bc 字色和背景色
+      返回值：  无
+      说明：    缓存命中时直接按图片整块写入，不再逐位展开
+******************************************************************************/
+static void LCD_Draw_Glyph(u16 x,u16 y,u32 code,u8 sizey,u16 w,const u8 *msk,u16 fc,u16 bc)
+{
+#if LCD_GLYPH_CACHE_NUM > 0
+    const u8 *pix = LCD_Glyph_Get(code, sizey, w, msk, fc, bc);
+
+    if (pix)
+    {
+        LCD_ShowPicture(x, y, w, sizey, pix);
+        return;
+    }
+#endif
+    LCD_Blit_Mask(x, y, w, sizey, msk, fc, bc);
+}
+
+/******************************************************************************
+      函数说明：把所有脏区域刷新到屏幕
+      入口数据：无
+      返回值：  无
+      说明：    未启用帧缓冲时所有绘制已直接写屏，此函数为空操作；
+                屏幕未初始化(LCD_Init_RTT 失败)时丢弃脏区域直接返回
+******************************************************************************/
+void LCD_Flush(void)
+{
+#if LCD_USE_FRAMEBUFFER
+    lcd_rect_t r;
+
+    if (lcd_spi_dev == RT_NULL)
+    {
+        lcd_dirty_num = 0;
+        return;
+    }
+
+    trace_begin("lcd_flush");
+    while (lcd_dirty_num)
+    {
+        r = lcd_dirty[--lcd_dirty_num];
+        LCD_FB_FlushRect(&r);
+    }
+    trace_end("lcd_flush");
+#endif
 }
 
 /******************************************************************************
@@ -205,15 +807,9 @@ void LCD_Init_Regs(void)
 ******************************************************************************/
 void LCD_Fill(u16 xsta,u16 ysta,u16 xend,u16 yend,u16 color)
 {
-    u16 i,j;
-    LCD_Address_Set(xsta,ysta,xend-1,yend-1);//设置显示范围
-    for(i=ysta;i<yend;i++)
-    {
-        for(j=xsta;j<xend;j++)
-        {
-            LCD_WR_DATA(color);
-        }
-    }
+    if(xsta>=xend||ysta>=yend)return;
+    LCD_Set_Window(xsta,ysta,xend-1,yend-1);//设置显示范围
+    LCD_FillColor(color,(rt_size_t)(xend-xsta)*(yend-ysta));
 }
 
 /******************************************************************************
@@ -224,50 +820,85 @@ void LCD_Fill(u16 xsta,u16 ysta,u16 xend,u16 yend,u16 color)
 ******************************************************************************/
 void LCD_DrawPoint(u16 x,u16 y,u16 color)
 {
-    LCD_Address_Set(x,y,x,y);//设置光标位置
-    LCD_WR_DATA(color);
+    LCD_Set_Window(x,y,x,y);//设置光标位置
+    LCD_WritePixels(&color,1);
 }
 
 
+/******************************************************************************
+      函数说明：填充矩形区域，超出屏幕的部分被裁剪
+      入口数据：x1,y1   起始坐标
+                x2,y2   终止坐标(包含，可以小于起始坐标，可以为负)
+                color   颜色
+      返回值：  无
+      说明：    画线、矩形、圆等图元都拆分为水平/垂直像素段后经此函数写入，
+                每一段只需一次窗口设置
+******************************************************************************/
+static void LCD_Fill_Clip(int x1,int y1,int x2,int y2,u16 color)
+{
+    int t;
+    if(x1>x2){t=x1;x1=x2;x2=t;}
+    if(y1>y2){t=y1;y1=y2;y2=t;}
+    if(x2<0||y2<0||x1>=LCD_W||y1>=LCD_H)return;
+    if(x1<0)x1=0;
+    if(y1<0)y1=0;
+    if(x2>=LCD_W)x2=LCD_W-1;
+    if(y2>=LCD_H)y2=LCD_H-1;
+    LCD_Fill(x1,y1,x2+1,y2+1,color);
+}
+
+#define LCD_HSpan(x1,x2,y,color)  LCD_Fill_Clip(x1,y,x2,y,color)   /* 水平像素段 */
+#define LCD_VSpan(x,y1,y2,color)  LCD_Fill_Clip(x,y1,x,y2,color)   /* 垂直像素段 */
+
 /******************************************************************************
       函数说明：画线
       入口数据：x1,y1   起始坐标
                 x2,y2   终止坐标
                 color   线的颜色
       返回值：  无
+      说明：    Bresenham算法，沿主方向连续的同行(同列)像素合并为一段写入，
+                水平线和垂直线各只需一次窗口写入
 ******************************************************************************/
 void LCD_DrawLine(u16 x1,u16 y1,u16 x2,u16 y2,u16 color)
 {
-    u16 t;
-    int xerr=0,yerr=0,delta_x,delta_y,distance;
-    int incx,incy,uRow,uCol;
-    delta_x=x2-x1; //计算坐标增量
-    delta_y=y2-y1;
-    uRow=x1;//画线起点坐标
-    uCol=y1;
-    if(delta_x>0)incx=1; //设置单步方向
-    else if (delta_x==0)incx=0;//垂直线
-    else {incx=-1;delta_x=-delta_x;}
-    if(delta_y>0)incy=1;
-    else if (delta_y==0)incy=0;//水平线
-    else {incy=-1;delta_y=-delta_x;}
-    if(delta_x>delta_y)distance=delta_x; //选取基本增量坐标轴
-    else distance=delta_y;
-    for(t=0;t<distance+1;t++)
-    {
-        LCD_DrawPoint(uRow,uCol,color);//画点
-        xerr+=delta_x;
-        yerr+=delta_y;
-        if(xerr>distance)
+    int dx,dy,sx,sy,err,x,y,s;
+    dx=x2>x1?x2-x1:x1-x2; //计算坐标增量
+    dy=y2>y1?y2-y1:y1-y2;
+    sx=x2>=x1?1:-1;       //设置单步方向
+    sy=y2>=y1?1:-1;
+    x=x1;
+    y=y1;
+    if(dx>=dy)//以x为主方向，每行一段
+    {
+        err=dx>>1;
+        for(s=x;x!=x2;x+=sx)
         {
-            xerr-=distance;
-            uRow+=incx;
+            err-=dy;
+            if(err<0)
+            {
+                LCD_HSpan(s,x,y,color);
+                err+=dx;
+                y+=sy;
+                s=x+sx;
+            }
         }
-        if(yerr>distance)
+        LCD_HSpan(s,x,y,color);
+    }
+    else//以y为主方向，每列一段
+    {
+        err=dy>>1;
+        for(s=y;y!=y2;y+=sy)
         {
-            yerr-=distance;
-            uCol+=incy;
+            err-=dx;
+            if(err<0)
+            {
+                LCD_VSpan(x,s,y,color);
+                err+=dy;
+                x+=sx;
+                s=y+sy;
+            }
         }
+        LCD_VSpan(x,s,y,color);
     }
 }
 
@@ -281,42 +912,136 @@ void LCD_DrawLine(u16 x1,u16 y1,u16 x2,u16 y2,u16 color)
 ******************************************************************************/
 void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2,u16 color)
 {
-    LCD_DrawLine(x1,y1,x2,y1,color);
-    LCD_DrawLine(x1,y1,x1,y2,color);
-    LCD_DrawLine(x1,y2,x2,y2,color);
-    LCD_DrawLine(x2,y1,x2,y2,color);
+    LCD_HSpan(x1,x2,y1,color);
+    LCD_HSpan(x1,x2,y2,color);
+    LCD_VSpan(x1,y1,y2,color);
+    LCD_VSpan(x2,y1,y2,color);
 }
 
 
 /******************************************************************************
-      函数说明：画圆
-      入口数据：x0,y0   圆心坐标
-                r       半径
-                color   圆的颜色
+      函数说明：画圆角形状(圆、圆角矩形)
+      入口数据：cx1,cy1 左上角圆弧的圆心
+                cx2,cy2 右下角圆弧的圆心，与cx1,cy1相同时即为圆
+                r       圆角半径
+                color   颜色
+                fill    0画轮廓  1填充
       返回值：  无
+      说明：    与原 Draw_Circle 相同的中点算法，按1/8圆弧步进。半径b不变的
+                连续点在水平方向同一行、在垂直方向同一列，合并为一段写入
 ******************************************************************************/
-void Draw_Circle(u16 x0,u16 y0,u8 r,u16 color)
+static void LCD_Round_Shape(int cx1,int cy1,int cx2,int cy2,int r,u16 color,u8 fill)
 {
-    int a,b;
-    a=0;b=r;
+    int a,b,s,na,nb;
+
+    if(fill)LCD_Fill_Clip(cx1-r,cy1,cx2+r,cy2,color);//上下圆心之间的矩形带
+    a=0;b=r;s=0;
     while(a<=b)
     {
-        LCD_DrawPoint(x0-b,y0-a,color);             //3
-        LCD_DrawPoint(x0+b,y0-a,color);             //0
-        LCD_DrawPoint(x0-a,y0+b,color);             //1
-        LCD_DrawPoint(x0-a,y0-b,color);             //2
-        LCD_DrawPoint(x0+b,y0+a,color);             //4
-        LCD_DrawPoint(x0+a,y0-b,color);             //5
-        LCD_DrawPoint(x0+a,y0+b,color);             //6
-        LCD_DrawPoint(x0-b,y0+a,color);             //7
-        a++;
-        if((a*a+b*b)>(r*r))//判断要画的点是否过远
+        na=a+1;nb=b;
+        if((na*na+nb*nb)>(r*r))nb--;//判断下一个点是否过远
+        if(fill)
+        {
+            //距圆心a行的一行，半宽为b
+            if(a>0)
+            {
+                LCD_HSpan(cx1-b,cx2+b,cy1-a,color);
+                LCD_HSpan(cx1-b,cx2+b,cy2+a,color);
+            }
+            //距圆心b行的一行，半宽为本段最大的a，每段只画一次
+            if((nb!=b||na>nb)&&b>a)
+            {
+                LCD_HSpan(cx1-a,cx2+a,cy1-b,color);
+                LCD_HSpan(cx1-a,cx2+a,cy2+b,color);
+            }
+        }
+        else if(nb!=b||na>nb)//b将要变化，输出a从s到当前的一段
         {
-            b--;
+            if(s==0)//第一段与直边相连
+            {
+                LCD_HSpan(cx1-a,cx2+a,cy1-b,color);
+                LCD_HSpan(cx1-a,cx2+a,cy2+b,color);
+                LCD_VSpan(cx1-b,cy1-a,cy2+a,color);
+                LCD_VSpan(cx2+b,cy1-a,cy2+a,color);
+            }
+            else
+            {
+                LCD_HSpan(cx2+s,cx2+a,cy1-b,color);
+                LCD_HSpan(cx1-a,cx1-s,cy1-b,color);
+                LCD_HSpan(cx2+s,cx2+a,cy2+b,color);
+                LCD_HSpan(cx1-a,cx1-s,cy2+b,color);
+                LCD_VSpan(cx2+b,cy1-a,cy1-s,color);
+                LCD_VSpan(cx1-b,cy1-a,cy1-s,color);
+                LCD_VSpan(cx2+b,cy2+s,cy2+a,color);
+                LCD_VSpan(cx1-b,cy2+s,cy2+a,color);
+            }
+            s=na;
         }
+        a=na;b=nb;
     }
 }
 
+/******************************************************************************
+      函数说明：画圆
+      入口数据：x0,y0   圆心坐标
+                r       半径
+                color   圆的颜色
+      返回值：  无
+******************************************************************************/
+void Draw_Circle(u16 x0,u16 y0,u8 r,u16 color)
+{
+    LCD_Round_Shape(x0,y0,x0,y0,r,color,0);
+}
+
+/******************************************************************************
+      函数说明：画实心圆
+      入口数据：x0,y0   圆心坐标
+                r       半径
+                color   填充颜色
+      返回值：  无
+******************************************************************************/
+void LCD_FillCircle(u16 x0,u16 y0,u8 r,u16 color)
+{
+    LCD_Round_Shape(x0,y0,x0,y0,r,color,1);
+}
+
+/* 圆角矩形：整理坐标顺序，圆角半径不超过短边的一半 */
+static void LCD_Round_Rect(u16 x1,u16 y1,u16 x2,u16 y2,u8 r,u16 color,u8 fill)
+{
+    u16 t;
+    if(x1>x2){t=x1;x1=x2;x2=t;}
+    if(y1>y2){t=y1;y1=y2;y2=t;}
+    if(r>(x2-x1)/2)r=(x2-x1)/2;
+    if(r>(y2-y1)/2)r=(y2-y1)/2;
+    LCD_Round_Shape(x1+r,y1+r,x2-r,y2-r,r,color,fill);
+}
+
+/******************************************************************************
+      函数说明：画圆角矩形
+      入口数据：x1,y1   起始坐标
+                x2,y2   终止坐标
+                r       圆角半径
+                color   颜色
+      返回值：  无
+******************************************************************************/
+void LCD_DrawRoundRect(u16 x1,u16 y1,u16 x2,u16 y2,u8 r,u16 color)
+{
+    LCD_Round_Rect(x1,y1,x2,y2,r,color,0);
+}
+
+/******************************************************************************
+      函数说明：画实心圆角矩形
+      入口数据：x1,y1   起始坐标
+                x2,y2   终止坐标
+                r       圆角半径
+                color   填充颜色
+      返回值：  无
+******************************************************************************/
+void LCD_FillRoundRect(u16 x1,u16 y1,u16 x2,u16 y2,u8 r,u16 color)
+{
+    LCD_Round_Rect(x1,y1,x2,y2,r,color,1);
+}
+
 /******************************************************************************
       函数说明：显示汉字串
       入口数据：x,y显示坐标
@@ -330,13 +1055,14 @@ void Draw_Circle(u16 x0,u16 y0,u8 r,u16 color)
 void LCD_ShowChinese(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 {
     u16 temp = x;
+    u32 code;
     while(*s!=0)
     {
         if(sizey==16) LCD_ShowChinese16x16(x,y,s,fc,bc,sizey,mode);
         else if(sizey==24) LCD_ShowChinese24x24(x,y,s,fc,bc,sizey,mode);
         else if(sizey==32) LCD_ShowChinese32x32(x,y,s,fc,bc,sizey,mode);
         else return;
-        s+=2;
+        s+=LCD_Utf8_Decode(s,&code);
         x+=sizey;
         if(x > 120)
         {
@@ -358,44 +1084,13 @@ void LCD_ShowChinese(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 ******************************************************************************/
 void LCD_ShowChinese16x16(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 {
-    u8 i,j;
-    u16 k;
-    u16 HZnum;//汉字数目
-    u16 TypefaceNum;//一个字符所占字节大小
-    u16 x0=x;
-    TypefaceNum=sizey/8*sizey;//此算法只适用于字宽等于字高，且字高是8的倍数的字，
-                              //也建议用户使用这样大小的字,否则显示容易出问题！
-    HZnum=sizeof(tfont16)/sizeof(typFNT_GB16);  //统计汉字数目
-    for(k=0;k<HZnum;k++)
-    {
-        if ((tfont16[k].Index[0]==*(s))&&(tfont16[k].Index[1]==*(s+1)))
-        {
-            LCD_Address_Set(x,y,x+sizey-1,y+sizey-1);
-            for(i=0;i<TypefaceNum;i++)
-            {
-                for(j=0;j<8;j++)
-                {
-                    if(!mode)//非叠加方式
-                    {
-                        if(tfont16[k].Msk[i]&(0x01<<j))LCD_WR_DATA(fc);
-                        else LCD_WR_DATA(bc);
-                    }
-                    else//叠加方式
-                    {
-                        if(tfont16[k].Msk[i]&(0x01<<j)) LCD_DrawPoint(x,y,fc);//画一个点
-                        x++;
-                        if((x-x0)==sizey)
-                        {
-                            x=x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-        continue;  //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
-    }
+    int k;
+    u32 code;
+    LCD_Utf8_Decode(s,&code);
+    k=LCD_Glyph_Search(tfont16_index,TFONT16_INDEX_NUM,code);  //二分查找字模
+    if(k<0)return;
+    if(!mode)LCD_Draw_Glyph(x,y,code,sizey,sizey,tfont16[k].Msk,fc,bc);//非叠加方式，整字一次写入
+    else LCD_Blend_Mask(x,y,sizey,sizey,tfont16[k].Msk,fc);//叠加方式，只改写前景像素
 }
 
 
@@ -411,44 +1106,13 @@ void LCD_ShowChinese16x16(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 ******************************************************************************/
 void LCD_ShowChinese24x24(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 {
-    u8 i,j;
-    u16 k;
-    u16 HZnum;//汉字数目
-    u16 TypefaceNum;//一个字符所占字节大小
-    u16 x0=x;
-    TypefaceNum=sizey/8*sizey;//此算法只适用于字宽等于字高，且字高是8的倍数的字，
-                              //也建议用户使用这样大小的字,否则显示容易出问题！
-    HZnum=sizeof(tfont24)/sizeof(typFNT_GB24);  //统计汉字数目
-    for(k=0;k<HZnum;k++)
-    {
-        if ((tfont24[k].Index[0]==*(s))&&(tfont24[k].Index[1]==*(s+1)))
-        {
-            LCD_Address_Set(x,y,x+sizey-1,y+sizey-1);
-            for(i=0;i<TypefaceNum;i++)
-            {
-                for(j=0;j<8;j++)
-                {
-                    if(!mode)//非叠加方式
-                    {
-                        if(tfont24[k].Msk[i]&(0x01<<j))LCD_WR_DATA(fc);
-                        else LCD_WR_DATA(bc);
-                    }
-                    else//叠加方式
-                    {
-                        if(tfont24[k].Msk[i]&(0x01<<j)) LCD_DrawPoint(x,y,fc);//画一个点
-                        x++;
-                        if((x-x0)==sizey)
-                        {
-                            x=x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-        continue;  //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
-    }
+    int k;
+    u32 code;
+    LCD_Utf8_Decode(s,&code);
+    k=LCD_Glyph_Search(tfont24_index,TFONT24_INDEX_NUM,code);  //二分查找字模
+    if(k<0)return;
+    if(!mode)LCD_Draw_Glyph(x,y,code,sizey,sizey,tfont24[k].Msk,fc,bc);//非叠加方式，整字一次写入
+    else LCD_Blend_Mask(x,y,sizey,sizey,tfont24[k].Msk,fc);//叠加方式，只改写前景像素
 }
 
 /******************************************************************************
@@ -463,44 +1127,13 @@ void LCD_ShowChinese24x24(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 ******************************************************************************/
 void LCD_ShowChinese32x32(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 {
-    u8 i,j;
-    u16 k;
-    u16 HZnum;//汉字数目
-    u16 TypefaceNum;//一个字符所占字节大小
-    u16 x0=x;
-    TypefaceNum=sizey/8*sizey;//此算法只适用于字宽等于字高，且字高是8的倍数的字，
-                              //也建议用户使用这样大小的字,否则显示容易出问题！
-    HZnum=sizeof(tfont32)/sizeof(typFNT_GB32);  //统计汉字数目
-    for(k=0;k<HZnum;k++)
-    {
-        if ((tfont32[k].Index[0]==*(s))&&(tfont32[k].Index[1]==*(s+1)))
-        {
-            LCD_Address_Set(x,y,x+sizey-1,y+sizey-1);
-            for(i=0;i<TypefaceNum;i++)
-            {
-                for(j=0;j<8;j++)
-                {
-                    if(!mode)//非叠加方式
-                    {
-                        if(tfont32[k].Msk[i]&(0x01<<j))LCD_WR_DATA(fc);
-                        else LCD_WR_DATA(bc);
-                    }
-                    else//叠加方式
-                    {
-                        if(tfont32[k].Msk[i]&(0x01<<j)) LCD_DrawPoint(x,y,fc);//画一个点
-                        x++;
-                        if((x-x0)==sizey)
-                        {
-                            x=x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-        continue;  //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
-    }
+    int k;
+    u32 code;
+    LCD_Utf8_Decode(s,&code);
+    k=LCD_Glyph_Search(tfont32_index,TFONT32_INDEX_NUM,code);  //二分查找字模
+    if(k<0)return;
+    if(!mode)LCD_Draw_Glyph(x,y,code,sizey,sizey,tfont32[k].Msk,fc,bc);//非叠加方式，整字一次写入
+    else LCD_Blend_Mask(x,y,sizey,sizey,tfont32[k].Msk,fc);//叠加方式，只改写前景像素
 }
 
 
@@ -516,38 +1149,14 @@ void LCD_ShowChinese32x32(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode)
 ******************************************************************************/
 void LCD_ShowChar(u16 x,u16 y,u8 num,u16 fc,u16 bc,u8 sizey,u8 mode)
 {
-    u8 temp,sizex,t;
-    u16 i,TypefaceNum;//一个字符所占字节大小
-    u16 x0=x;
-    sizex=sizey/2;
-    TypefaceNum=sizex/8*sizey;
-    num=num-' ';    //得到偏移后的值
-    LCD_Address_Set(x,y,x+sizex-1,y+sizey-1);  //设置光标位置
-    for(i=0;i<TypefaceNum;i++)
-    {
-        if(sizey==16)temp=ascii_1608[num][i];              //调用8x16字体
-        else if(sizey==32)temp=ascii_3216[num][i];       //调用16x32字体
-        else return;
-        for(t=0;t<8;t++)
-        {
-            if(!mode)//非叠加模式
-            {
-                if(temp&(0x01<<t))LCD_WR_DATA(fc);
-                else LCD_WR_DATA(bc);
-            }
-            else//叠加模式
-            {
-                if(temp&(0x01<<t))LCD_DrawPoint(x,y,fc);//画一个点
-                x++;
-                if((x-x0)==sizex)
-                {
-                    x=x0;
-                    y++;
-                    break;
-                }
-            }
-        }
-    }
+    u8 sizex=sizey/2;
+    const u8 *msk;
+    if(num<' '||num>'~')return;
+    if(sizey==16)msk=ascii_1608[num-' '];         //调用8x16字体
+    else if(sizey==32)msk=ascii_3216[num-' '];    //调用16x32字体
+    else return;
+    if(!mode)LCD_Draw_Glyph(x,y,num,sizey,sizex,msk,fc,bc);  //非叠加模式，整字一次写入
+    else LCD_Blend_Mask(x,y,sizex,sizey,msk,fc);             //叠加模式，只改写前景像素
 }
 
 
@@ -663,15 +1272,129 @@ void LCD_ShowFloatNum1(u16 x,u16 y,float num,u8 len,u16 fc,u16 bc,u8 sizey)
 ******************************************************************************/
 void LCD_ShowPicture(u16 x,u16 y,u16 length,u16 width,const u8 pic[])
 {
-    u16 i,j,k=0;
+#if LCD_USE_FRAMEBUFFER
+    /* 图片数据本身就是高字节在前，与帧缓冲字节序一致，逐行拷贝即可 */
+    u16 i,w=length;
+    if(x>=LCD_W||y>=LCD_H)return;
+    if(x+w>LCD_W)w=LCD_W-x;
+    for(i=0;i<width&&y+i<LCD_H;i++)
+    {
+        rt_memcpy(&lcd_fb[y+i][x],&pic[(u32)i*length*2],w*2);
+    }
+    LCD_FB_MarkDirty(x,y,x+length-1,y+width-1);
+#else
+    /* 图片数据本身就是高字节在前，可直接整块突发发送 */
     LCD_Address_Set(x,y,x+length-1,y+width-1);
-    for(i=0;i<length;i++)
+    if(LCD_Stream_Begin()!=RT_EOK)return;
+    LCD_Stream_Send(pic,(rt_size_t)length*width*2);
+    LCD_Stream_End();
+#endif
+}
+
+/* 压缩图片解码状态：游程可以跨行，逐行解码时需保留 */
+typedef struct
+{
+    const lcd_image_t *img;
+    const u8 *p;        /* 当前读位置 */
+    const u8 *end;      /* 数据结束位置 */
+    u8  lit;            /* 1: 当前为字面段，0: 当前为重复段 */
+    u16 left;           /* 当前段剩余像素数 */
+    u16 pix;            /* 重复段的像素颜色 */
+} lcd_rle_t;
+
+/* 读取一个像素符号并转换为RGB565，数据不足时返回0 */
+static u16 LCD_Rle_Next(lcd_rle_t *d)
+{
+    u16 c;
+
+    if(d->img->format==LCD_IMG_RLE8)
     {
-        for(j=0;j<width;j++)
+        if(d->p>=d->end)return 0;
+        c=*d->p++;
+        return c<d->img->palette_size?d->img->palette[c]:0;
+    }
+    if(d->p+1>=d->end){d->p=d->end;return 0;}
+    c=(d->p[0]<<8)|d->p[1];
+    d->p+=2;
+    return c;
+}
+
+/******************************************************************************
+      函数说明：解码压缩图片的一行
+      入口数据：d       解码状态
+                dst     输出缓冲，按SPI线上字节序(高字节在前)写入
+                visible 需要输出的像素数，其余像素只解码不输出(用于裁剪)
+      返回值：  无
+******************************************************************************/
+static void LCD_Rle_Row(lcd_rle_t *d,u8 *dst,u16 visible)
+{
+    u16 i,c;
+    u8 ctl;
+
+    for(i=0;i<d->img->width;i++)
+    {
+        if(d->left==0)
         {
-            LCD_WR_DATA8(pic[k*2]);
-            LCD_WR_DATA8(pic[k*2+1]);
-            k++;
+            if(d->p>=d->end)return;  /* 数据不完整，剩余像素保持不变 */
+            ctl=*d->p++;
+            d->lit=!(ctl&0x80);
+            d->left=d->lit?ctl+1:(ctl&0x7F)+2;
+            if(!d->lit)d->pix=LCD_Rle_Next(d);
         }
+        c=d->lit?LCD_Rle_Next(d):d->pix;
+        d->left--;
+        if(i<visible)
+        {
+            *dst++=c>>8;
+            *dst++=c&0xff;
+        }
+    }
+}
+
+/******************************************************************************
+      函数说明：显示压缩图片
+      入口数据：x,y 起点坐标
+                img 压缩图片描述，由 tools/img2rle.py 生成
+      返回值：  无
+      说明：    逐行解码，不需要整幅图片大小的缓冲；超出屏幕的部分被裁剪
+******************************************************************************/
+void LCD_ShowImageCompressed(u16 x,u16 y,const lcd_image_t *img)
+{
+    lcd_rle_t d;
+    u16 i,w,h;
+
+    if(img==RT_NULL||x>=LCD_W||y>=LCD_H||img->width==0||img->height==0)return;
+    w=img->width;
+    h=img->height;
+    if(x+w>LCD_W)w=LCD_W-x;
+    if(y+h>LCD_H)h=LCD_H-y;
+
+    d.img=img;
+    d.p=img->data;
+    d.end=img->data+img->data_size;
+    d.lit=0;
+    d.left=0;
+    d.pix=0;
+
+#if LCD_USE_FRAMEBUFFER
+    /* 直接解码到帧缓冲，字节序与帧缓冲一致 */
+    for(i=0;i<h;i++)
+    {
+        LCD_Rle_Row(&d,(u8 *)&lcd_fb[y+i][x],w);
+    }
+    LCD_FB_MarkDirty(x,y,x+w-1,y+h-1);
+#else
+    /* 乒乓行缓冲：一行在DMA发送时解码下一行 */
+    u8 idx=0;
+
+    LCD_Address_Set(x,y,x+w-1,y+h-1);
+    if(LCD_Stream_Begin()!=RT_EOK)return;
+    for(i=0;i<h;i++)
+    {
+        LCD_Rle_Row(&d,lcd_line_buf[idx],w);
+        LCD_Stream_Send(lcd_line_buf[idx],(rt_size_t)w*2);
+        idx^=1;
     }
+    LCD_Stream_End();
+#endif
 }
@@ -29,6 +29,37 @@ typedef rt_uint8_t  uint_8; /* 你的代码里有时候用 uint_8 */
 #define LCD_H 128
 #endif
 
+//-----------------帧缓冲配置----------------
+// 1: 所有 LCD_* 绘制先写入 RAM 帧缓冲(128x128 RGB565, 32KB)，调用 LCD_Flush() 后按脏矩形推送到屏幕
+// 0: 与原驱动一致，每次绘制直接写屏
+#ifndef LCD_USE_FRAMEBUFFER
+#define LCD_USE_FRAMEBUFFER 1
+#endif
+
+// 帧缓冲默认放在 AXI SRAM(.bss)。如需放到 PSRAM，可定义固定地址，例如:
+// #define LCD_FB_ADDR 0x90000000
+// 或指定链接段: #define LCD_FB_SECTION rt_section(".psram_data")
+#ifndef LCD_FB_SECTION
+#define LCD_FB_SECTION
+#endif
+
+// 最多同时跟踪的脏矩形个数，超出后与代价最小的矩形合并
+#define LCD_FB_DIRTY_MAX 8
+
+// 直接写屏时流式发送的分块大小(像素)，默认一行
+#define LCD_STREAM_PIXELS LCD_W
+
+// 整字展开缓冲的最大边长，需不小于最大字号
+#define LCD_GLYPH_MAX 32
+
+// 预展开字模缓存：最近使用的 LCD_GLYPH_CACHE_NUM 个(字符,字号,字色,背景色)组合以RGB565保存，
+// 重复显示同一提示语时整字直接写入。只缓存不超过 LCD_GLYPH_CACHE_SIZE 见方的字模，NUM 为 0 时关闭
+#define LCD_GLYPH_CACHE_NUM  16
+#define LCD_GLYPH_CACHE_SIZE 16
+
+// SPI 最高时钟，lcd_bench 以此计算总线利用率
+#define LCD_SPI_MAX_HZ (20 * 1000 * 1000)
+
 //-----------------LCD引脚定义 (基于 P1 排针) ----------------
 #define LCD_RES_PIN  GET_PIN(E, 12) // P1-31
 #define LCD_DC_PIN   GET_PIN(E, 13) // P1-29
@@ -36,11 +67,12 @@ typedef rt_uint8_t  uint_8; /* 你的代码里有时候用 uint_8 */
 #define LCD_CS_PIN   GET_PIN(F, 6)  // P1-24 (用于传给 SPI 挂载函数)
 
 // 操作宏 (使用 RTT API)
-#define LCD_RES_Clr()  rt_pin_write(LCD_RES_PIN, PIN_LOW)
-#define LCD_RES_Set()  rt_pin_write(LCD_RES_PIN, PIN_HIGH)
+// DC 在每次命令/数据切换时翻转，DC/RES 使用端口级写入，引脚号在编译期拆成端口与掩码
+#define LCD_RES_Clr()  rt_pin_port_write(GET_PIN_PORT(LCD_RES_PIN), 0, GET_PIN_MASK(LCD_RES_PIN))
+#define LCD_RES_Set()  rt_pin_port_write(GET_PIN_PORT(LCD_RES_PIN), GET_PIN_MASK(LCD_RES_PIN), 0)
 
-#define LCD_DC_Clr()   rt_pin_write(LCD_DC_PIN, PIN_LOW)
-#define LCD_DC_Set()   rt_pin_write(LCD_DC_PIN, PIN_HIGH)
+#define LCD_DC_Clr()   rt_pin_port_write(GET_PIN_PORT(LCD_DC_PIN), 0, GET_PIN_MASK(LCD_DC_PIN))
+#define LCD_DC_Set()   rt_pin_port_write(GET_PIN_PORT(LCD_DC_PIN), GET_PIN_MASK(LCD_DC_PIN), 0)
 
 #define LCD_BLK_Clr()  rt_pin_write(LCD_BLK_PIN, PIN_LOW)
 #define LCD_BLK_Set()  rt_pin_write(LCD_BLK_PIN, PIN_HIGH)
@@ -72,6 +104,34 @@ typedef rt_uint8_t  uint_8; /* 你的代码里有时候用 uint_8 */
 #define LGRAYBLUE        0XA651
 #define LBBLUE           0X2B12
 
+//-----------------压缩图片格式 (由 tools/img2rle.py 生成) ----------------
+// 行优先的游程编码流，游程可跨行：
+//   控制字节 c < 0x80 : 其后紧跟 c+1 个字面像素
+//   控制字节 c >= 0x80: 其后一个像素重复 (c & 0x7F)+2 次
+#define LCD_IMG_RLE565   0   // 像素为 2 字节 RGB565，高字节在前
+#define LCD_IMG_RLE8     1   // 像素为 1 字节调色板索引
+
+typedef struct
+{
+    u16 width;              // 图片宽度
+    u16 height;             // 图片高度
+    u8  format;             // LCD_IMG_RLE565 / LCD_IMG_RLE8
+    u16 palette_size;       // 调色板颜色数，RLE565 时为 0
+    const u16 *palette;     // 调色板(RGB565)，RLE565 时为 RT_NULL
+    const u8 *data;         // 压缩数据
+    u32 data_size;          // 压缩数据字节数
+} lcd_image_t;
+
+// SPI 传输统计(累计值)，lcd_bench 用于计算有效带宽
+typedef struct
+{
+    u32 bytes;              // 发送的字节数(命令+数据)
+    u32 xfers;              // SPI 传输次数
+    u32 windows;            // 地址窗口设置次数
+} lcd_stats_t;
+
+extern lcd_stats_t lcd_stats;
+
 // 函数声明
 int LCD_Init_RTT(void);
 void LCD_Init(void);
@@ -80,6 +140,9 @@ void LCD_DrawPoint(u16 x,u16 y,u16 color);
 void LCD_DrawLine(u16 x1,u16 y1,u16 x2,u16 y2,u16 color);
 void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2,u16 color);
 void Draw_Circle(u16 x0,u16 y0,u8 r,u16 color);
+void LCD_FillCircle(u16 x0,u16 y0,u8 r,u16 color);
+void LCD_DrawRoundRect(u16 x1,u16 y1,u16 x2,u16 y2,u8 r,u16 color);
+void LCD_FillRoundRect(u16 x1,u16 y1,u16 x2,u16 y2,u8 r,u16 color);
 void LCD_ShowChinese(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode);
 void LCD_ShowChinese16x16(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode);
 void LCD_ShowChinese24x24(u16 x,u16 y,u8 *s,u16 fc,u16 bc,u8 sizey,u8 mode);
@@ -90,6 +153,11 @@ u32 mypow(u8 m,u8 n);
 void LCD_ShowIntNum(u16 x,u16 y,u16 num,u8 len,u16 fc,u16 bc,u8 sizey);
 void LCD_ShowFloatNum1(u16 x,u16 y,float num,u8 len,u16 fc,u16 bc,u8 sizey);
 void LCD_ShowPicture(u16 x,u16 y,u16 length,u16 width,const u8 pic[]);
+void LCD_ShowImageCompressed(u16 x,u16 y,const lcd_image_t *img);
+void LCD_Flush(void);
+void LCD_Set_Window(u16 x1,u16 y1,u16 x2,u16 y2);
+void LCD_WritePixels(const u16 *buf,rt_size_t n);
+void LCD_FillColor(u16 color,rt_size_t n);
 
 void LCD_WR_DATA8(u8 dat);
 void LCD_WR_DATA(u16 dat);
@@ -0,0 +1,188 @@
+/**
+ * @file    lcd_bench.c
+ * @brief   LCD显示性能测试命令
+ * @details 提供 msh 命令 lcd_bench，测量各绘制接口的耗时与SPI有效带宽：
+ *          - 全屏填充、压缩图片显示
+ *          - 16/24/32 汉字与 8x16/16x32 ASCII 字符(非叠加与叠加模式)
+ *          - 画线、画圆
+ *          计时使用 cputime 组件(Cortex-M7 DWT 周期计数器)，
+ *          字节数、传输次数与窗口数取自 lcd.c 中的 lcd_stats 统计。
+ *          主机上 sim/test_lcd_bench.c 包含本文件，在 SPI 模型上运行同样的测试并检查各项 SPI 流量
+ * @date    2025-12-20
+ *
+ * 用法：
+ *   lcd_bench          运行全部测试
+ *   lcd_bench <名称>   只运行名称匹配的测试，例如 lcd_bench hz16
+ * 测试会覆盖屏幕内容，结束后清屏，按任意键即可恢复界面
+ */
+
+#include "lcd.h"
+
+#if defined(RT_USING_FINSH) && defined(RT_USING_CPUTIME)
+
+/* 图片资源定义在 main.c 包含的 pic_rle.h 中 */
+extern const lcd_image_t gImage_2_rle;
+
+/* 测试项 */
+typedef struct
+{
+    const char *name;       /* 名称 */
+    void (*run)(u16 i);     /* 执行一次，i 为迭代序号 */
+    u16 count;              /* 迭代次数 */
+    u16 units;              /* 每次迭代绘制的对象个数 */
+    const char *unit;       /* 对象单位 */
+} lcd_bench_item_t;
+
+/* 每次迭代切换颜色，保证每次都有实际的像素写入 */
+#define BENCH_COLOR(i)  ((i) & 1 ? BLUE : RED)
+#define BENCH_BG(i)     ((i) & 1 ? WHITE : YELLOW)
+
+static void bench_fill(u16 i)
+{
+    LCD_Fill(0, 0, LCD_W, LCD_H, BENCH_BG(i));
+    LCD_Flush();
+}
+
+static void bench_image(u16 i)
+{
+    LCD_ShowImageCompressed(0, 0, &gImage_2_rle);
+    LCD_Flush();
+}
+
+static void bench_hz16(u16 i)
+{
+    LCD_ShowChinese(0, 0, (u8 *)"门已上锁，请输入密码", BENCH_COLOR(i), BENCH_BG(i), 16, 0);
+    LCD_Flush();
+}
+
+static void bench_hz16_overlay(u16 i)
+{
+    LCD_ShowChinese(0, 0, (u8 *)"门已上锁，请输入密码", BENCH_COLOR(i), BENCH_BG(i), 16, 1);
+    LCD_Flush();
+}
+
+static void bench_hz24(u16 i)
+{
+    LCD_ShowChinese(0, 0, (u8 *)"我我我我我", BENCH_COLOR(i), BENCH_BG(i), 24, 0);
+    LCD_Flush();
+}
+
+static void bench_hz32(u16 i)
+{
+    LCD_ShowChinese(0, 0, (u8 *)"我我我", BENCH_COLOR(i), BENCH_BG(i), 32, 0);
+    LCD_Flush();
+}
+
+static void bench_ascii16(u16 i)
+{
+    LCD_ShowString(0, 0, (const u8 *)"0123456789ABCDEF", BENCH_COLOR(i), BENCH_BG(i), 16, 0);
+    LCD_Flush();
+}
+
+static void bench_ascii16_overlay(u16 i)
+{
+    LCD_ShowString(0, 0, (const u8 *)"0123456789ABCDEF", BENCH_COLOR(i), BENCH_BG(i), 16, 1);
+    LCD_Flush();
+}
+
+static void bench_ascii32(u16 i)
+{
+    LCD_ShowString(0, 0, (const u8 *)"01234567", BENCH_COLOR(i), BENCH_BG(i), 32, 0);
+    LCD_Flush();
+}
+
+static void bench_line(u16 i)
+{
+    u16 k;
+    /* 从中心向四周的扇形，覆盖各种斜率 */
+    for (k = 0; k < 8; k++)
+    {
+        LCD_DrawLine(LCD_W / 2, LCD_H / 2, k * (LCD_W - 1) / 7, 0, BENCH_COLOR(i));
+        LCD_DrawLine(LCD_W / 2, LCD_H / 2, k * (LCD_W - 1) / 7, LCD_H - 1, BENCH_COLOR(i));
+    }
+    LCD_Flush();
+}
+
+static void bench_circle(u16 i)
+{
+    u16 k;
+    for (k = 1; k <= 8; k++)
+    {
+        Draw_Circle(LCD_W / 2, LCD_H / 2, k * 7, BENCH_COLOR(i));
+    }
+    LCD_Flush();
+}
+
+static const lcd_bench_item_t bench_items[] =
+{
+    {"fill",            bench_fill,             20, 1,  "frame"},
+    {"image",           bench_image,            20, 1,  "frame"},
+    {"hz16",            bench_hz16,             20, 10, "glyph"},
+    {"hz16_overlay",    bench_hz16_overlay,     20, 10, "glyph"},
+    {"hz24",            bench_hz24,             20, 5,  "glyph"},
+    {"hz32",            bench_hz32,             20, 3,  "glyph"},
+    {"ascii16",         bench_ascii16,          20, 16, "glyph"},
+    {"ascii16_overlay", bench_ascii16_overlay,  20, 16, "glyph"},
+    {"ascii32",         bench_ascii32,          20, 8,  "glyph"},
+    {"line",            bench_line,             20, 16, "line"},
+    {"circle",          bench_circle,           20, 8,  "circle"},
+};
+
+static void lcd_bench_run(const lcd_bench_item_t *it)
+{
+    u32 bytes, xfers, windows, t0, cycles, us, rate, bps, permille;
+    u16 i;
+
+    LCD_Fill(0, 0, LCD_W, LCD_H, WHITE);
+    LCD_Flush();
+
+    bytes   = lcd_stats.bytes;
+    xfers   = lcd_stats.xfers;
+    windows = lcd_stats.windows;
+    t0      = (u32)clock_cpu_gettime();
+    for (i = 0; i < it->count; i++)
+    {
+        it->run(i);
+    }
+    cycles  = (u32)clock_cpu_gettime() - t0;     /* 32位计数器，单项测试远短于一次回绕 */
+    bytes   = lcd_stats.bytes - bytes;
+    xfers   = lcd_stats.xfers - xfers;
+    windows = lcd_stats.windows - windows;
+
+    us = (u32)clock_cpu_microsecond(cycles);
+    if (us == 0) us = 1;
+    rate     = (u32)((rt_uint64_t)it->count * it->units * 1000000 / us);
+    bps      = (u32)((rt_uint64_t)bytes * 1000000 / us);
+    permille = (u32)((rt_uint64_t)bps * 8 * 1000 / LCD_SPI_MAX_HZ);
+
+    rt_kprintf("%-16s %7u us/iter %7u %s/s %8u B/s %3u.%u%% %5u xfer/iter %5u win/iter\n",
+               it->name, us / it->count, rate, it->unit, bps,
+               permille / 10, permille % 10, xfers / it->count, windows / it->count);
+}
+
+static int lcd_bench(int argc, char **argv)
+{
+    rt_size_t i;
+    u8 found = 0;
+
+    rt_kprintf("SPI %u Hz, max %u B/s, framebuffer %s\n", LCD_SPI_MAX_HZ, LCD_SPI_MAX_HZ / 8,
+               LCD_USE_FRAMEBUFFER ? "on" : "off");
+    rt_kprintf("%-16s %15s %15s %10s %6s %15s %14s\n", "test", "time", "rate", "SPI", "util", "transfers", "windows");
+    for (i = 0; i < sizeof(bench_items) / sizeof(bench_items[0]); i++)
+    {
+        if (argc > 1 && rt_strstr(bench_items[i].name, argv[1]) == RT_NULL) continue;
+        lcd_bench_run(&bench_items[i]);
+        found = 1;
+    }
+    if (!found)
+    {
+        rt_kprintf("no test matches '%s'\n", argv[1]);
+    }
+
+    LCD_Fill(0, 0, LCD_W, LCD_H, WHITE);
+    LCD_Flush();
+    return 0;
+}
+MSH_CMD_EXPORT(lcd_bench, LCD drawing benchmark: lcd_bench [test name]);
+
+#endif /* RT_USING_FINSH && RT_USING_CPUTIME */
@@ -0,0 +1,3430 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 此文件由 tools/img2rle.py 生成，请勿手动修改
+ */
+#ifndef DRIVER_PIC_RLE_H_
+#define DRIVER_PIC_RLE_H_
+
+#include "lcd.h"
+
+/* gImage_1: 128x128, RLE565, 25154 bytes (raw 32768 bytes) */
+static const u8 gImage_1_rle_data[25154] = {
+    0x82,0x20,0x81,0x81,0x28,0x81,0x85,0x28,0xA1,0x83,0x28,0xC2,0x00,0x28,0xE1,0x80,
+    0x30,0xE1,0x00,0x30,0xE2,0x82,0x31,0x02,0x00,0x31,0x22,0x82,0x31,0x23,0x00,0x31,
+    0x22,0x86,0x39,0x02,0x8C,0x39,0x23,0x80,0x41,0x23,0x83,0x41,0x43,0x83,0x39,0x63,
+    0x87,0x41,0x63,0x02,0x41,0x64,0x41,0x63,0x49,0x63,0x90,0x49,0x64,0x81,0x41,0x84,
+    0x80,0x41,0x64,0x00,0x39,0x63,0x80,0x39,0x43,0x80,0x39,0x23,0x80,0x31,0x23,0x80,
+    0x31,0x03,0x82,0x29,0x03,0x80,0x31,0x03,0x81,0x29,0x03,0x80,0x29,0x24,0x83,0x31,
+    0x24,0x00,0x31,0x44,0x83,0x20,0x60,0x80,0x20,0x80,0x84,0x28,0x81,0x00,0x20,0x81,
+    0x81,0x28,0x81,0x80,0x28,0xA1,0x80,0x28,0xA0,0x83,0x28,0xC1,0x00,0x30,0xC1,0x84,
+    0x30,0xE1,0x80,0x38,0xE1,0x8D,0x39,0x02,0x84,0x39,0x22,0x82,0x41,0x23,0x80,0x41,
+    0x43,0x86,0x41,0x63,0x82,0x41,0x43,0x82,0x41,0x63,0x80,0x49,0x63,0x8B,0x49,0x64,
+    0x00,0x41,0x44,0x82,0x41,0x43,0x82,0x39,0x43,0x80,0x39,0x23,0x00,0x39,0x03,0x85,
+    0x31,0x03,0x81,0x29,0x03,0x82,0x31,0x03,0x80,0x29,0x23,0x00,0x29,0x24,0x84,0x31,
+    0x24,0x94,0x20,0x80,0x82,0x20,0xA0,0x00,0x28,0xA0,0x82,0x28,0xA1,0x00,0x28,0xC1,
+    0x83,0x30,0xC1,0x82,0x30,0xE1,0x80,0x38,0xE1,0x84,0x39,0x02,0x86,0x39,0x22,0x00,
+    0x39,0x23,0x85,0x41,0x43,0x86,0x41,0x42,0x80,0x41,0x43,0x00,0x41,0x42,0x91,0x41,
+    0x43,0x81,0x39,0x23,0x81,0x31,0x22,0x81,0x31,0x02,0x8B,0x31,0x03,0x82,0x31,0x23,
+    0x02,0x31,0x24,0x29,0x23,0x29,0x24,0x80,0x31,0x44,0x01,0x31,0x64,0x31,0x65,0x8F,
+    0x20,0x80,0x82,0x20,0x60,0x87,0x20,0x80,0x00,0x28,0x80,0x85,0x28,0xA0,0x81,0x28,
+    0xC1,0x83,0x30,0xC1,0x81,0x30,0xE2,0x80,0x31,0x02,0x84,0x39,0x02,0x80,0x39,0x22,
+    0x02,0x41,0x22,0x41,0x23,0x41,0x43,0x80,0x39,0x43,0x82,0x39,0x42,0x87,0x41,0x42,
+    0x82,0x41,0x43,0x81,0x41,0x23,0x00,0x41,0x43,0x87,0x39,0x43,0x80,0x39,0x23,0x00,
+    0x39,0x22,0x82,0x31,0x02,0x81,0x30,0xE2,0x00,0x30,0xE3,0x8C,0x31,0x03,0x80,0x31,
+    0x23,0x01,0x29,0x23,0x31,0x24,0x80,0x31,0x44,0x02,0x31,0x65,0x39,0xA5,0x41,0xE6,
+    0x8A,0x20,0xA0,0x83,0x20,0x80,0x82,0x20,0xA0,0x89,0x20,0x80,0x80,0x28,0x80,0x89,
+    0x28,0xA0,0x80,0x28,0xA1,0x01,0x28,0xC1,0x30,0xC1,0x87,0x30,0xE1,0x00,0x30,0xE2,
+    0x80,0x39,0x02,0x8A,0x39,0x22,0x84,0x41,0x22,0x80,0x41,0x23,0x81,0x41,0x22,0x84,
+    0x39,0x23,0x82,0x39,0x22,0x04,0x39,0x02,0x31,0x02,0x30,0xE2,0x30,0xE1,0x28,0xE1,
+    0x80,0x28,0xC1,0x00,0x28,0xE2,0x80,0x30,0xE2,0x8C,0x31,0x03,0x81,0x31,0x23,0x06,
+    0x31,0x44,0x31,0x64,0x39,0x85,0x41,0xA6,0x41,0xE6,0x4A,0x07,0x52,0x48,0x87,0x28,
+    0xA1,0x8B,0x28,0xC1,0x81,0x28,0xA1,0x82,0x20,0xA0,0x81,0x20,0x80,0x00,0x28,0x80,
+    0x8C,0x20,0x80,0x00,0x28,0x81,0x82,0x28,0xA1,0x00,0x28,0xC1,0x83,0x28,0xA1,0x02,
+    0x28,0xC1,0x30,0xC1,0x30,0xE2,0x80,0x39,0x02,0x01,0x31,0x02,0x31,0x01,0x80,0x30,
+    0xE1,0x00,0x31,0x01,0x86,0x39,0x01,0x89,0x39,0x02,0x80,0x31,0x02,0x81,0x30,0xE2,
+    0x02,0x30,0xE1,0x30,0xE2,0x30,0xE1,0x85,0x28,0xC1,0x00,0x28,0xC2,0x80,0x30,0xE2,
+    0x8B,0x31,0x03,0x09,0x31,0x23,0x31,0x44,0x39,0x64,0x39,0x85,0x41,0xA6,0x41,0xE6,
+    0x4A,0x07,0x52,0x27,0x5A,0x68,0x5A,0x89,0x8B,0x28,0xC1,0x81,0x28,0xA1,0x85,0x28,
+    0xC1,0x84,0x28,0xA1,0x83,0x20,0xA0,0x00,0x28,0xA0,0x86,0x20,0xA0,0x84,0x20,0x80,
+    0x81,0x28,0x80,0x00,0x28,0xA0,0x81,0x28,0xA1,0x80,0x28,0xA0,0x02,0x28,0xA1,0x30,
+    0xC1,0x30,0xE2,0x80,0x39,0x02,0x01,0x38,0xE2,0x30,0xE2,0x80,0x30,0xE1,0x88,0x39,
+    0x01,0x82,0x38,0xE1,0x80,0x30,0xE1,0x00,0x31,0x02,0x82,0x30,0xE2,0x00,0x28,0xE2,
+    0x89,0x28,0xC1,0x81,0x28,0xC2,0x01,0x28,0xE2,0x30,0xE2,0x88,0x31,0x03,0x80,0x31,
+    0x23,0x03,0x39,0x44,0x39,0x65,0x41,0xA5,0x49,0xE6,0x81,0x4A,0x07,0x03,0x52,0x27,
+    0x52,0x48,0x5A,0x68,0x5A,0x89,0x96,0x28,0xC1,0x81,0x28,0xA1,0x81,0x28,0xC1,0x81,
+    0x28,0xA1,0x80,0x28,0xC1,0x80,0x28,0xA0,0x80,0x28,0xC1,0x82,0x28,0xC0,0x80,0x28,
+    0xA0,0x80,0x28,0xA1,0x82,0x28,0xA0,0x00,0x28,0x80,0x83,0x28,0xA0,0x80,0x28,0xA1,
+    0x01,0x30,0xC1,0x30,0xE2,0x80,0x39,0x02,0x80,0x38,0xE2,0x80,0x38,0xE1,0x80,0x39,
+    0x01,0x00,0x38,0xE1,0x80,0x39,0x01,0x83,0x38,0xE1,0x00,0x30,0xC1,0x82,0x30,0xC0,
+    0x00,0x30,0xC1,0x81,0x30,0xE1,0x00,0x30,0xC1,0x80,0x28,0xC1,0x81,0x28,0xA1,0x85,
+    0x28,0xC1,0x80,0x28,0xC2,0x80,0x28,0xE2,0x03,0x30,0xE2,0x30,0xE3,0x31,0x03,0x30,
+    0xE2,0x81,0x31,0x03,0x80,0x31,0x23,0x00,0x39,0x23,0x80,0x39,0x44,0x05,0x39,0x64,
+    0x39,0x85,0x41,0xA5,0x49,0xE6,0x52,0x07,0x52,0x28,0x82,0x52,0x48,0x00,0x52,0x68,
+    0x80,0x5A,0x68,0x93,0x28,0xC1,0x00,0x28,0xE1,0x8E,0x28,0xC1,0x82,0x28,0xE1,0x83,
+    0x28,0xC1,0x81,0x28,0xA1,0x81,0x28,0xA0,0x00,0x30,0xA0,0x81,0x30,0xA1,0x03,0x28,
+    0xC1,0x30,0xC1,0x30,0xE1,0x38,0xE2,0x82,0x39,0x02,0x86,0x39,0x01,0x01,0x38,0xE1,
+    0x30,0xE1,0x80,0x30,0xE0,0x84,0x30,0xC0,0x00,0x28,0xC0,0x82,0x28,0xC1,0x83,0x28,
+    0xA1,0x84,0x28,0xC1,0x80,0x28,0xC2,0x00,0x28,0xE2,0x83,0x30,0xE2,0x00,0x30,0xE3,
+    0x80,0x31,0x03,0x08,0x31,0x23,0x39,0x23,0x39,0x44,0x39,0x64,0x41,0x85,0x41,0xA5,
+    0x49,0xC6,0x49,0xE6,0x52,0x07,0x80,0x52,0x27,0x80,0x52,0x48,0x00,0x5A,0x68,0x82,
+    0x5A,0x88,0x8F,0x28,0xC1,0x80,0x28,0xE1,0x80,0x30,0xE1,0x00,0x30,0xE2,0x81,0x30,
+    0xE1,0x84,0x28,0xE1,0x80,0x28,0xC1,0x82,0x28,0xE1,0x80,0x30,0xE1,0x00,0x28,0xE1,
+    0x80,0x28,0xE0,0x80,0x28,0xE1,0x00,0x28,0xC1,0x8A,0x30,0xC1,0x03,0x30,0xE1,0x30,
+    0xE2,0x38,0xE2,0x39,0x02,0x81,0x41,0x23,0x01,0x41,0x22,0x39,0x22,0x80,0x41,0x22,
+    0x80,0x41,0x42,0x80,0x41,0x63,0x01,0x41,0x42,0x41,0x21,0x81,0x39,0x01,0x83,0x38,
+    0xE0,0x00,0x30,0xE0,0x80,0x30,0xC0,0x00,0x28,0xC0,0x81,0x28,0xA0,0x82,0x28,0xA1,
+    0x84,0x28,0xC1,0x81,0x28,0xC2,0x00,0x28,0xE2,0x80,0x30,0xE2,0x00,0x30,0xE3,0x80,
+    0x31,0x03,0x00,0x39,0x23,0x80,0x39,0x44,0x05,0x39,0x64,0x41,0x65,0x41,0x85,0x49,
+    0xC6,0x49,0xE6,0x52,0x07,0x81,0x52,0x27,0x80,0x52,0x48,0x05,0x52,0x68,0x5A,0x88,
+    0x5A,0x89,0x5A,0xA9,0x62,0xCA,0x6B,0x2B,0x83,0x30,0xE2,0x84,0x28,0xE1,0x81,0x30,
+    0xE2,0x82,0x31,0x02,0x89,0x30,0xE2,0x00,0x30,0xE1,0x88,0x28,0xE1,0x80,0x28,0xE0,
+    0x80,0x28,0xE1,0x81,0x30,0xE1,0x00,0x30,0xE2,0x87,0x38,0xE1,0x00,0x39,0x22,0x80,
+    0x41,0x22,0x00,0x41,0x43,0x83,0x49,0x63,0x03,0x51,0x83,0x51,0xA4,0x59,0xC4,0x59,
+    0xE4,0x80,0x59,0xE5,0x01,0x59,0xE4,0x59,0xC4,0x80,0x51,0x83,0x01,0x49,0x62,0x49,
+    0x42,0x82,0x49,0x62,0x03,0x41,0x42,0x39,0x21,0x38,0xE1,0x30,0xE1,0x80,0x30,0xC0,
+    0x00,0x30,0xC1,0x81,0x28,0xA1,0x83,0x28,0xC1,0x82,0x28,0xC2,0x01,0x28,0xE2,0x30,
+    0xE2,0x81,0x31,0x03,0x03,0x39,0x23,0x39,0x44,0x39,0x64,0x41,0x64,0x80,0x41,0x85,
+    0x80,0x41,0xA5,0x01,0x49,0xE6,0x52,0x07,0x81,0x52,0x27,0x80,0x52,0x48,0x06,0x52,
+    0x68,0x5A,0xA9,0x63,0x0A,0x7B,0x8C,0x8C,0x0F,0xA4,0xF2,0xC5,0xD5,0x81,0x31,0x22,
+    0x88,0x31,0x02,0x84,0x31,0x22,0x89,0x31,0x02,0x82,0x30,0xE2,0x84,0x30,0xE1,0x80,
+    0x30,0xE0,0x81,0x30,0xE1,0x80,0x30,0xE2,0x83,0x39,0x02,0x00,0x41,0x22,0x81,0x41,
+    0x02,0x04,0x41,0x22,0x49,0x42,0x51,0x83,0x51,0xA3,0x59,0xE4,0x82,0x62,0x05,0x02,
+    0x6A,0x25,0x6A,0x66,0x72,0x86,0x80,0x7A,0xC7,0x80,0x82,0xE8,0x08,0x7A,0xC7,0x7A,
+    0xA6,0x72,0x66,0x6A,0x45,0x6A,0x25,0x62,0x04,0x6A,0x04,0x6A,0x25,0x72,0x65,0x80,
+    0x72,0x86,0x06,0x6A,0x66,0x5A,0x05,0x51,0xE4,0x49,0x83,0x41,0x42,0x39,0x02,0x30,
+    0xE1,0x80,0x30,0xC1,0x80,0x30,0xE1,0x80,0x28,0xE2,0x81,0x28,0xC2,0x80,0x30,0xE2,
+    0x80,0x31,0x03,0x01,0x39,0x23,0x39,0x24,0x80,0x39,0x44,0x01,0x39,0x64,0x41,0x64,
+    0x80,0x41,0x85,0x00,0x41,0xA5,0x80,0x49,0xA6,0x0B,0x49,0xE6,0x52,0x07,0x52,0x27,
+    0x52,0x28,0x5A,0x48,0x5A,0xA9,0x6B,0x0B,0x7B,0xAD,0x94,0x70,0xAD,0x33,0xCE,0x17,
+    0xE6,0xD9,0x80,0xEF,0x1B,0x01,0x41,0x84,0x39,0x63,0x85,0x39,0x43,0x82,0x39,0x23,
+    0x81,0x39,0x43,0x88,0x39,0x23,0x01,0x39,0x22,0x31,0x22,0x87,0x31,0x02,0x86,0x31,
+    0x01,0x80,0x39,0x02,0x00,0x39,0x22,0x81,0x41,0x22,0x09,0x41,0x42,0x49,0x43,0x49,
+    0x63,0x49,0x83,0x51,0xA3,0x59,0xE4,0x62,0x25,0x6A,0x66,0x72,0xA6,0x7A,0xC7,0x80,
+    0x83,0x08,0x80,0x82,0xE8,0x02,0x83,0x08,0x8B,0x28,0x93,0x69,0x80,0x9B,0x8A,0x80,
+    0x9B,0xAA,0x03,0x9B,0x8A,0x93,0x69,0x8B,0x28,0x8B,0x07,0x82,0x82,0xC6,0x0B,0x8B,
+    0x27,0x93,0x89,0x9B,0xCA,0x9B,0xCB,0x93,0xAA,0x8B,0x6A,0x7B,0x08,0x6A,0x66,0x5A,
+    0x25,0x51,0xC4,0x49,0x83,0x39,0x02,0x82,0x31,0x02,0x80,0x30,0xE2,0x00,0x31,0x02,
+    0x80,0x31,0x03,0x00,0x39,0x24,0x81,0x39,0x44,0x00,0x39,0x64,0x82,0x41,0x64,0x80,
+    0x41,0x85,0x0C,0x49,0xA5,0x49,0xA6,0x51,0xE7,0x5A,0x48,0x62,0xA9,0x7B,0x4C,0x8B,
+    0xEE,0x9C,0xB1,0xBD,0x95,0xD6,0x57,0xDE,0xB9,0xE6,0xFA,0xEF,0x3B,0x80,0xF7,0x5B,
+    0x02,0xEF,0x3B,0x52,0x06,0x51,0xE6,0x80,0x49,0xE6,0x00,0x49,0xE5,0x82,0x49,0xC5,
+    0x00,0x41,0xA5,0x80,0x41,0xA4,0x82,0x41,0x84,0x82,0x41,0x64,0x00,0x41,0x63,0x81,
+    0x39,0x63,0x81,0x39,0x43,0x82,0x39,0x23,0x00,0x39,0x22,0x80,0x31,0x22,0x81,0x39,
+    0x22,0x80,0x31,0x22,0x82,0x31,0x21,0x00,0x39,0x21,0x81,0x39,0x22,0x0C,0x41,0x42,
+    0x41,0x43,0x49,0x63,0x51,0x83,0x51,0xC4,0x59,0xE5,0x62,0x26,0x6A,0x67,0x72,0xA7,
+    0x7A,0xE8,0x83,0x28,0x8B,0x48,0x8B,0x69,0x83,0x93,0x69,0x02,0x9B,0x89,0x9B,0xA9,
+    0x9B,0xCA,0x80,0xA3,0xCA,0x80,0xA3,0xEA,0x04,0xA3,0xCA,0x9B,0xA9,0x9B,0x89,0x93,
+    0x48,0x8B,0x27,0x81,0x8B,0x07,0x03,0x93,0x68,0x9B,0xA9,0xA3,0xEB,0xA4,0x0C,0x80,
+    0xA4,0x2C,0x08,0xA4,0x0C,0x9B,0xCB,0x93,0x8A,0x83,0x29,0x72,0xC7,0x5A,0x25,0x49,
+    0xA4,0x41,0x63,0x39,0x42,0x81,0x39,0x22,0x00,0x39,0x23,0x80,0x39,0x43,0x80,0x39,
+    0x44,0x80,0x41,0x64,0x01,0x41,0x65,0x41,0x85,0x80,0x41,0x65,0x80,0x41,0x85,0x09,
+    0x49,0xA5,0x49,0xC6,0x51,0xE7,0x5A,0x68,0x7B,0x6C,0xAC,0xD2,0xCD,0xD6,0xE6,0x99,
+    0xEF,0x1A,0xEF,0x1B,0x81,0xEF,0x3B,0x01,0xF7,0x3B,0xEF,0x5B,0x80,0xEF,0x3B,0x80,
+    0x5A,0x68,0x01,0x5A,0x88,0x62,0x88,0x82,0x5A,0x68,0x80,0x5A,0x47,0x80,0x52,0x47,
+    0x82,0x52,0x26,0x81,0x52,0x06,0x01,0x51,0xE6,0x49,0xE5,0x82,0x49,0xC5,0x81,0x49,
+    0xA5,0x04,0x49,0x85,0x41,0x84,0x41,0x64,0x39,0x63,0x39,0x43,0x82,0x39,0x22,0x85,
+    0x39,0x42,0x81,0x41,0x43,0x08,0x49,0x63,0x51,0xA4,0x5A,0x05,0x62,0x45,0x6A,0x86,
+    0x72,0xC7,0x7B,0x08,0x83,0x28,0x8B,0x68,0x81,0x93,0x89,0x82,0x9B,0xA9,0x80,0x9B,
+    0x89,0x01,0x9B,0xA9,0xA3,0xA9,0x82,0xA3,0xCA,0x80,0xA3,0xEA,0x03,0xA3,0xC9,0xA3,
+    0xA9,0x9B,0x88,0x93,0x68,0x81,0x93,0x47,0x03,0x9B,0x68,0x9B,0x89,0xA3,0xCA,0xA3,
+    0xEA,0x84,0xA4,0x0B,0x06,0x9B,0xEB,0x8B,0x8A,0x7A,0xE8,0x62,0x46,0x51,0xE5,0x49,
+    0xA4,0x41,0x83,0x80,0x39,0x62,0x80,0x39,0x63,0x00,0x41,0x63,0x80,0x41,0x64,0x80,
+    0x41,0x65,0x81,0x41,0x85,0x08,0x49,0xA5,0x49,0xC6,0x51,0xE6,0x52,0x27,0x5A,0x48,
+    0x62,0xA9,0xA4,0x91,0xE6,0xB9,0xEF,0x1B,0x80,0xF7,0x3B,0x83,0xEF,0x3B,0x81,0xEF,
+    0x5B,0x80,0x5A,0x68,0x89,0x5A,0x88,0x00,0x62,0x88,0x80,0x5A,0x88,0x81,0x62,0x88,
+    0x01,0x5A,0x88,0x5A,0x68,0x81,0x5A,0x67,0x81,0x5A,0x47,0x80,0x5A,0x27,0x00,0x5A,
+    0x26,0x80,0x52,0x06,0x00,0x49,0xE5,0x81,0x49,0xC5,0x01,0x49,0xA4,0x49,0xC4,0x80,
+    0x49,0xA4,0x80,0x49,0xA3,0x82,0x49,0xA4,0x0B,0x51,0xC4,0x51,0xE4,0x62,0x25,0x6A,
+    0xA6,0x7A,0xE7,0x83,0x48,0x8B,0x88,0x93,0xA9,0x9B,0xCA,0x9B,0xEA,0xA3,0xEA,0x9B,
+    0xE9,0x81,0xA3,0xE9,0x84,0xA3,0xC9,0x86,0xA3,0xE9,0x01,0xA3,0xC9,0x9B,0xA8,0x82,
+    0x9B,0x87,0x03,0x9B,0x88,0x9B,0x89,0xA3,0xA9,0xA3,0xEA,0x80,0xAC,0x0B,0x81,0xAC,
+    0x2B,0x08,0xAC,0x4C,0xAC,0x2C,0xA4,0x0C,0x93,0xAB,0x83,0x29,0x6A,0x67,0x51,0xE4,
+    0x49,0xA3,0x41,0x83,0x81,0x41,0x63,0x82,0x41,0x64,0x80,0x41,0x85,0x09,0x49,0xC6,
+    0x51,0xE6,0x52,0x07,0x5A,0x48,0x62,0x69,0x62,0x89,0x6A,0xAA,0x94,0x2F,0xDE,0x78,
+    0xEF,0x1B,0x85,0xEF,0x3B,0x81,0xEF,0x5B,0x85,0x5A,0x88,0x80,0x5A,0xA9,0x84,0x5A,
+    0xA8,0x85,0x62,0xA8,0x00,0x62,0xC9,0x83,0x62,0xA8,0x80,0x62,0x88,0x00,0x62,0xA8,
+    0x80,0x62,0x88,0x81,0x62,0x67,0x00,0x5A,0x47,0x85,0x5A,0x46,0x07,0x62,0x46,0x62,
+    0x26,0x62,0x47,0x6A,0x66,0x72,0xC7,0x83,0x28,0x93,0xA9,0x9B,0xEA,0x80,0xA4,0x2A,
+    0x00,0xAC,0x2B,0x80,0xAC,0x4A,0x80,0xAC,0x2A,0x00,0xA4,0x09,0x83,0xA3,0xE9,0x00,
+    0xAB,0xE9,0x82,0xAC,0x0A,0x80,0xAC,0x09,0x80,0xAB,0xE9,0x81,0xA3,0xE9,0x00,0xA3,
+    0xC8,0x80,0x9B,0xA8,0x06,0x9B,0x87,0x9B,0x88,0x9B,0x68,0x9B,0x88,0xA3,0xA9,0xA3,
+    0xEA,0xAC,0x0A,0x82,0xAC,0x2B,0x81,0xAC,0x2C,0x07,0xA4,0x0C,0x8B,0x6A,0x72,0xA7,
+    0x5A,0x25,0x51,0xC3,0x49,0xA3,0x41,0x83,0x41,0x63,0x80,0x41,0x64,0x08,0x41,0x65,
+    0x41,0x85,0x41,0xA5,0x49,0xC6,0x52,0x07,0x5A,0x27,0x5A,0x68,0x62,0x89,0x6A,0xAA,
+    0x80,0x6A,0xCA,0x02,0x83,0xAD,0xCD,0xF6,0xEF,0x1B,0x85,0xEF,0x3B,0x81,0xEF,0x5B,
+    0x01,0x5A,0x68,0x5A,0x88,0x80,0x52,0x88,0x00,0x5A,0x88,0x88,0x5A,0xA8,0x80,0x5A,
+    0xC8,0x80,0x62,0xC8,0x80,0x62,0xA8,0x82,0x62,0xC9,0x80,0x62,0xC8,0x80,0x6A,0xC8,
+    0x00,0x6A,0xA9,0x80,0x6A,0xC9,0x01,0x6A,0xA8,0x62,0x88,0x80,0x62,0x87,0x00,0x62,
+    0x67,0x81,0x62,0x87,0x80,0x6A,0xA7,0x81,0x6A,0xA8,0x06,0x72,0xC8,0x7B,0x09,0x83,
+    0x49,0x8B,0x8A,0x9B,0xCA,0xA4,0x2A,0xA4,0x4B,0x81,0xAC,0x4B,0x81,0xB4,0x6B,0x02,
+    0xB4,0x4B,0xAC,0x2A,0xAC,0x09,0x81,0xAB,0xE9,0x80,0xAC,0x0A,0x83,0xAC,0x2A,0x00,
+    0xAC,0x0A,0x81,0xAC,0x09,0x00,0xAB,0xE9,0x80,0xA3,0xE9,0x01,0xA3,0xC9,0xA3,0xA8,
+    0x82,0x9B,0x88,0x02,0xA3,0xA9,0xA3,0xC9,0xAC,0x0A,0x80,0xAC,0x2B,0x00,0xB4,0x2B,
+    0x80,0xAC,0x2B,0x81,0xAC,0x4C,0x06,0xA4,0x2C,0x93,0xAA,0x7B,0x08,0x6A,0x65,0x59,
+    0xE4,0x49,0xA3,0x49,0x83,0x80,0x41,0x84,0x07,0x41,0x85,0x41,0xA5,0x49,0xC5,0x51,
+    0xE6,0x5A,0x27,0x62,0x68,0x62,0x89,0x6A,0xA9,0x81,0x6A,0xCA,0x02,0x7B,0x2C,0xBD,
+    0x74,0xEF,0x1A,0x85,0xEF,0x3B,0x81,0xEF,0x5B,0x82,0x52,0x68,0x00,0x5A,0x88,0x88,
+    0x5A,0xA8,0x86,0x62,0xC8,0x80,0x62,0xC9,0x83,0x6A,0xC8,0x03,0x6A,0xC9,0x6A,0xA8,
+    0x62,0x88,0x5A,0x67,0x80,0x5A,0x46,0x80,0x5A,0x26,0x03,0x62,0x46,0x6A,0xA7,0x73,
+    0x08,0x7B,0x09,0x80,0x7B,0x29,0x04,0x83,0x6A,0x8B,0xCB,0x94,0x0C,0x9C,0x0C,0xA4,
+    0x2C,0x80,0xA4,0x2B,0x02,0xAC,0x4B,0xB4,0x4B,0xAC,0x4B,0x80,0xB4,0x6B,0x00,0xB4,
+    0x8B,0x80,0xBC,0x8B,0x01,0xB4,0x4B,0xAC,0x2A,0x80,0xAC,0x09,0x02,0xAC,0x0A,0xAC,
+    0x2A,0xB4,0x4A,0x80,0xB4,0x4B,0x00,0xB4,0x4A,0x83,0xAC,0x2A,0x02,0xAC,0x09,0xA4,
+    0x09,0xA3,0xE9,0x80,0xAB,0xE9,0x00,0xA3,0xE9,0x80,0xA3,0xC9,0x06,0xA3,0xA9,0xA3,
+    0xA8,0xA3,0xC9,0xA3,0xE9,0xAC,0x0A,0xAC,0x2A,0xB4,0x2A,0x81,0xB4,0x4B,0x81,0xB4,
+    0x4C,0x07,0xAC,0x4C,0xAC,0x2C,0xA4,0x0B,0x8B,0x69,0x72,0xC7,0x62,0x25,0x51,0xC4,
+    0x49,0xA3,0x81,0x49,0xA4,0x04,0x49,0xC5,0x51,0xE6,0x5A,0x27,0x62,0x68,0x62,0x89,
+    0x80,0x6A,0xA9,0x04,0x6A,0xC9,0x6A,0xA9,0x72,0xEA,0xA4,0xB1,0xE6,0xD9,0x80,0xF7,
+    0x3B,0x00,0xEF,0x3B,0x85,0xEF,0x5B,0x00,0x52,0x67,0x81,0x52,0x68,0x00,0x5A,0x88,
+    0x86,0x5A,0xA8,0x00,0x5A,0xC8,0x82,0x62,0xC8,0x83,0x62,0xA8,0x80,0x62,0xC8,0x83,
+    0x6A,0xC9,0x02,0x62,0xA8,0x62,0x67,0x5A,0x47,0x80,0x5A,0x26,0x80,0x5A,0x46,0x07,
+    0x62,0x46,0x6A,0xA7,0x7B,0x29,0x8B,0xCB,0x93,0xEB,0x94,0x0C,0x9C,0x2C,0xA4,0x4D,
+    0x80,0xA4,0x8E,0x09,0xA4,0x6D,0xA4,0x4C,0xAC,0x4B,0xAC,0x2B,0xAC,0x4B,0xB4,0x4A,
+    0xB4,0x4B,0xB4,0x6B,0xB4,0x8B,0xBC,0x8C,0x80,0xBC,0xAC,0x02,0xBC,0x8C,0xB4,0x4B,
+    0xB4,0x2A,0x80,0xAC,0x2A,0x80,0xB4,0x4B,0x80,0xB4,0x6B,0x01,0xB4,0x4B,0xB4,0x4A,
+    0x80,0xB4,0x2A,0x05,0xB4,0x4A,0xAC,0x4A,0xAC,0x2A,0xAC,0x09,0xA4,0x09,0xAC,0x09,
+    0x81,0xAC,0x0A,0x01,0xAB,0xE9,0xA3,0xE9,0x80,0xA3,0xC9,0x00,0xA3,0xE9,0x80,0xAC,
+    0x0A,0x01,0xB4,0x2A,0xB4,0x4A,0x85,0xB4,0x4B,0x0D,0xB4,0x4C,0xAC,0x2C,0x9B,0xCA,
+    0x8B,0x49,0x72,0xA6,0x5A,0x25,0x51,0xE4,0x49,0xC4,0x49,0xA4,0x51,0xE5,0x52,0x06,
+    0x5A,0x47,0x62,0x68,0x6A,0x88,0x80,0x6A,0xA9,0x05,0x6A,0xC9,0x6A,0xCA,0x6A,0xEA,
+    0x8B,0xEE,0xDE,0x78,0xF7,0x3B,0x80,0xEF,0x3B,0x85,0xEF,0x5B,0x80,0x52,0x68,0x80,
+    0x5A,0x68,0x00,0x5A,0x88,0x86,0x5A,0xA8,0x00,0x5A,0xC8,0x81,0x62,0xC8,0x84,0x62,
+    0xA8,0x82,0x62,0xC8,0x80,0x62,0xA8,0x01,0x62,0x87,0x5A,0x47,0x80,0x5A,0x26,0x07,
+    0x62,0x46,0x6A,0xA7,0x73,0x09,0x7B,0x29,0x7B,0x49,0x83,0x8A,0x94,0x0C,0xA4,0x6E,
+    0x80,0xA4,0x8D,0x80,0xA4,0x8E,0x80,0xA4,0x8D,0x02,0xAC,0x8C,0xAC,0x6C,0xAC,0x4B,
+    0x80,0xAC,0x4A,0x03,0xB4,0x4A,0xB4,0x4B,0xB4,0x6B,0xBC,0x8C,0x81,0xBC,0xAC,0x01,
+    0xBC,0x8C,0xB4,0x6B,0x84,0xB4,0x4B,0x80,0xB4,0x6B,0x00,0xB4,0x4B,0x82,0xB4,0x4A,
+    0x03,0xAC,0x4A,0xAC,0x2A,0xAC,0x09,0xAC,0x0A,0x80,0xAC,0x2A,0x81,0xAC,0x0A,0x06,
+    0xAB,0xE9,0xA3,0xE9,0xAB,0xE9,0xAC,0x0A,0xAC,0x2A,0xB4,0x2A,0xB4,0x4A,0x87,0xB4,
+    0x4B,0x0A,0xAC,0x4B,0xA4,0x2B,0x9B,0xCA,0x83,0x49,0x72,0xC7,0x62,0x25,0x51,0xC4,
+    0x51,0xE5,0x5A,0x06,0x5A,0x47,0x62,0x68,0x80,0x6A,0x88,0x06,0x6A,0xA9,0x6A,0xC9,
+    0x6A,0xEA,0x73,0x0A,0x83,0xAD,0xCE,0x16,0xEF,0x1B,0x81,0xEF,0x3B,0x84,0xEF,0x5B,
+    0x00,0x52,0x88,0x81,0x5A,0x68,0x81,0x5A,0x88,0x83,0x5A,0xA8,0x80,0x5A,0xC8,0x81,
+    0x62,0xC8,0x86,0x62,0xA8,0x0A,0x5A,0x87,0x5A,0x67,0x5A,0x47,0x5A,0x46,0x52,0x06,
+    0x52,0x05,0x5A,0x26,0x62,0x67,0x72,0xE8,0x83,0x6A,0x93,0xEC,0x80,0xA4,0x4E,0x02,
+    0xA4,0x6E,0xA4,0x8E,0xAC,0xAE,0x80,0xAC,0xAD,0x04,0xA4,0xAD,0xA4,0x8D,0xA4,0xAD,
+    0xA4,0x8C,0xAC,0x8C,0x80,0xAC,0x6B,0x00,0xAC,0x4A,0x80,0xB4,0x4A,0x80,0xB4,0x6B,
+    0x80,0xBC,0x8C,0x04,0xBC,0xAC,0xC4,0xAC,0xBC,0xAC,0xBC,0x8B,0xB4,0x6B,0x81,0xB4,
+    0x4B,0x04,0xB4,0x2A,0xB4,0x4A,0xB4,0x4B,0xB4,0x6B,0xB4,0x4B,0x83,0xB4,0x4A,0x80,
+    0xAC,0x2A,0x01,0xAC,0x0A,0xAC,0x2A,0x80,0xB4,0x2A,0x00,0xAC,0x2A,0x80,0xAC,0x0A,
+    0x05,0xAB,0xEA,0xAB,0xE9,0xAC,0x0A,0xAC,0x2A,0xB4,0x2A,0xB4,0x4A,0x81,0xB4,0x4B,
+    0x02,0xB4,0x6B,0xB4,0x4B,0xB4,0x4A,0x82,0xB4,0x6B,0x09,0xB4,0x6C,0xAC,0x6C,0xAC,
+    0x4C,0x9B,0xEB,0x83,0x29,0x6A,0x86,0x62,0x25,0x5A,0x25,0x62,0x46,0x62,0x67,0x80,
+    0x6A,0x88,0x80,0x6A,0xA9,0x04,0x6A,0xCA,0x72,0xEA,0x7B,0x4C,0xBD,0x54,0xEE,0xDA,
+    0x80,0xF7,0x3B,0x85,0xEF,0x5B,0x85,0x5A,0x88,0x82,0x5A,0xA8,0x80,0x5A,0xC8,0x83,
+    0x62,0xC8,0x07,0x62,0xA8,0x62,0xC8,0x62,0xA8,0x62,0x88,0x5A,0x87,0x5A,0x67,0x52,
+    0x46,0x52,0x26,0x80,0x49,0xE5,0x08,0x52,0x05,0x52,0x25,0x5A,0x46,0x62,0xA7,0x73,
+    0x08,0x83,0x8A,0x9C,0x0D,0xA4,0x6E,0xAC,0x8F,0x80,0xAC,0x8E,0x00,0xAC,0xAE,0x82,
+    0xAC,0xAD,0x81,0xAC,0xAC,0x00,0xAC,0x8B,0x80,0xAC,0x6B,0x00,0xAC,0x4B,0x80,0xB4,
+    0x4B,0x01,0xB4,0x6B,0xBC,0x6B,0x81,0xBC,0x8C,0x00,0xBC,0xAC,0x80,0xBC,0x8C,0x81,
+    0xBC,0x6B,0x02,0xB4,0x6B,0xB4,0x4B,0xB4,0x4A,0x85,0xB4,0x4B,0x00,0xB4,0x4A,0x85,
+    0xB4,0x2A,0x82,0xAC,0x0A,0x80,0xB4,0x2A,0x83,0xB4,0x4B,0x85,0xB4,0x6B,0x00,0xB4,
+    0x6C,0x80,0xB4,0x8C,0x08,0xB4,0x6C,0xA4,0x2C,0x93,0xAA,0x7B,0x08,0x6A,0x86,0x62,
+    0x66,0x62,0x46,0x6A,0x67,0x6A,0x88,0x80,0x6A,0xA8,0x04,0x6A,0xC9,0x72,0xEA,0x73,
+    0x2B,0xA4,0x90,0xE6,0x98,0x80,0xF7,0x3A,0x80,0xEF,0x5A,0x83,0xEF,0x5B,0x85,0x5A,
+    0x88,0x82,0x5A,0xA8,0x80,0x5A,0xC8,0x82,0x62,0xC8,0x00,0x62,0xA8,0x80,0x5A,0x87,
+    0x0E,0x5A,0x67,0x52,0x46,0x52,0x26,0x4A,0x05,0x49,0xE5,0x49,0xE4,0x49,0xC4,0x52,
+    0x05,0x5A,0x46,0x62,0x86,0x6A,0xC7,0x7B,0x49,0x83,0xAA,0x9C,0x0C,0xA4,0x6E,0x81,
+    0xAC,0x8E,0x00,0xAC,0xAE,0x82,0xB4,0xAD,0x02,0xB4,0xAC,0xAC,0x8C,0xAC,0xAC,0x81,
+    0xB4,0x8B,0x82,0xB4,0x6B,0x00,0xBC,0x6B,0x81,0xBC,0x8C,0x81,0xBC,0xAC,0x82,0xBC,
+    0x8C,0x01,0xBC,0x6B,0xB4,0x6B,0x80,0xB4,0x4B,0x00,0xB4,0x6B,0x83,0xBC,0x6B,0x01,
+    0xB4,0x4B,0xB4,0x4A,0x89,0xB4,0x2A,0x84,0xB4,0x4B,0x86,0xB4,0x6B,0x81,0xB4,0x8C,
+    0x80,0xB4,0x8D,0x06,0xA4,0x2C,0x93,0xCA,0x83,0x28,0x72,0xA7,0x72,0x87,0x6A,0xA7,
+    0x72,0xA8,0x80,0x6A,0xA8,0x05,0x72,0xC9,0x73,0x0A,0x94,0x0E,0xD6,0x16,0xEF,0x1A,
+    0xF7,0x3A,0x81,0xEF,0x5A,0x82,0xEF,0x5B,0x85,0x5A,0x88,0x88,0x5A,0xA8,0x04,0x5A,
+    0x87,0x5A,0x46,0x52,0x46,0x52,0x06,0x49,0xE5,0x80,0x41,0xC4,0x80,0x49,0xE4,0x07,
+    0x52,0x05,0x5A,0x45,0x62,0xA7,0x6A,0xE8,0x7B,0x69,0x8B,0xCB,0x94,0x2C,0xA4,0x8D,
+    0x81,0xAC,0xAE,0x01,0xB4,0xAE,0xB4,0xAD,0x80,0xB4,0xAC,0x82,0xB4,0x8C,0x82,0xB4,
+    0x8B,0x81,0xB4,0x6B,0x80,0xBC,0x6B,0x81,0xBC,0x8C,0x81,0xBC,0xAC,0x00,0xBC,0x8C,
+    0x81,0xBC,0xAC,0x80,0xBC,0x8C,0x81,0xBC,0x6B,0x00,0xBC,0x8B,0x81,0xBC,0x8C,0x80,
+    0xBC,0x6B,0x81,0xB4,0x4B,0x82,0xB4,0x2B,0x89,0xB4,0x4B,0x84,0xB4,0x6B,0x00,0xBC,
+    0x8B,0x81,0xBC,0x8C,0x08,0xBC,0xAC,0xBC,0xAD,0xBC,0xAC,0xB4,0x8C,0xB4,0x6C,0xA4,
+    0x2B,0x93,0xAA,0x83,0x28,0x7A,0xE8,0x81,0x72,0xA8,0x04,0x72,0xC9,0x7B,0x0A,0x8B,
+    0xCC,0xC5,0xB4,0xEF,0x19,0x83,0xEF,0x5A,0x81,0xEF,0x5B,0x87,0x5A,0x88,0x83,0x5A,
+    0xA8,0x81,0x5A,0x87,0x03,0x52,0x46,0x52,0x05,0x49,0xE5,0x41,0xC4,0x80,0x41,0xA4,
+    0x0A,0x49,0xC4,0x52,0x05,0x52,0x25,0x5A,0x46,0x62,0x86,0x6A,0xE8,0x7B,0x69,0x8B,
+    0xEA,0x9C,0x2C,0xA4,0x8D,0xAC,0xAD,0x81,0xB4,0xCE,0x00,0xB4,0xAD,0x80,0xB4,0xAC,
+    0x81,0xBC,0x8C,0x80,0xBC,0x6C,0x80,0xBC,0x8B,0x80,0xB4,0x8B,0x81,0xB4,0x6B,0x80,
+    0xBC,0x6B,0x80,0xBC,0x8C,0x82,0xBC,0xAC,0x80,0xC4,0xAC,0x80,0xC4,0xCD,0x01,0xC4,
+    0xAC,0xBC,0xAC,0x81,0xBC,0x8C,0x01,0xBC,0x8B,0xBC,0x8C,0x80,0xC4,0xAC,0x00,0xBC,
+    0x8B,0x81,0xBC,0x6B,0x83,0xB4,0x4B,0x82,0xBC,0x6B,0x84,0xB4,0x4B,0x00,0xBC,0x6B,
+    0x82,0xB4,0x6B,0x00,0xBC,0x6B,0x80,0xBC,0x8B,0x00,0xBC,0x8C,0x81,0xBC,0xAC,0x01,
+    0xBC,0xAD,0xBC,0xCC,0x80,0xBC,0xAC,0x0B,0xB4,0x8C,0xAC,0x4C,0x9B,0xCA,0x8B,0x49,
+    0x7A,0xE8,0x72,0xC8,0x72,0xA8,0x72,0xC8,0x7A,0xE9,0x83,0x8B,0xB5,0x12,0xE6,0xF9,
+    0x83,0xEF,0x5A,0x81,0xEF,0x5B,0x87,0x5A,0x88,0x80,0x5A,0xA8,0x80,0x5A,0x88,0x00,
+    0x5A,0x87,0x80,0x5A,0x67,0x02,0x52,0x47,0x52,0x05,0x49,0xE5,0x80,0x49,0xC4,0x0A,
+    0x41,0xC4,0x49,0xC4,0x49,0xE5,0x52,0x25,0x5A,0x25,0x5A,0x66,0x62,0xA7,0x73,0x28,
+    0x8B,0xCA,0x9C,0x2B,0xA4,0x6C,0x80,0xAC,0xAD,0x80,0xB4,0xCD,0x80,0xB4,0xAD,0x01,
+    0xB4,0xAC,0xBC,0xAC,0x81,0xBC,0x8C,0x00,0xBC,0x6C,0x80,0xBC,0x6B,0x80,0xB4,0x6B,
+    0x80,0xBC,0x8B,0x81,0xBC,0x6B,0x81,0xBC,0x8C,0x81,0xBC,0xAC,0x00,0xC4,0xAC,0x80,
+    0xC4,0xCD,0x00,0xC4,0xED,0x81,0xC4,0xCD,0x01,0xC4,0xAC,0xBC,0xAC,0x80,0xBC,0x8C,
+    0x04,0xC4,0xAC,0xC4,0xCC,0xC4,0xCD,0xC4,0xAC,0xBC,0x8C,0x80,0xBC,0x8B,0x83,0xBC,
+    0x6B,0x00,0xBC,0x6C,0x80,0xBC,0x8C,0x80,0xBC,0x6B,0x80,0xB4,0x4B,0x80,0xBC,0x6B,
+    0x02,0xBC,0x6C,0xBC,0x8C,0xBC,0x6C,0x82,0xBC,0x6B,0x81,0xBC,0x8C,0x01,0xBC,0xAC,
+    0xC4,0xAC,0x82,0xC4,0xCD,0x06,0xC4,0xAC,0xBC,0xAC,0xB4,0x8C,0xAC,0x2B,0x93,0x89,
+    0x83,0x28,0x7A,0xE8,0x80,0x72,0xC8,0x04,0x7A,0xE9,0x83,0x4B,0xA4,0x70,0xDE,0x98,
+    0xEF,0x3A,0x85,0xEF,0x5B,0x89,0x5A,0x88,0x02,0x52,0x88,0x52,0x67,0x52,0x47,0x80,
+    0x52,0x26,0x01,0x4A,0x06,0x49,0xE5,0x80,0x49,0xC4,0x03,0x49,0xE4,0x49,0xE5,0x49,
+    0xE4,0x52,0x05,0x80,0x5A,0x46,0x05,0x62,0x86,0x6A,0xE8,0x83,0x69,0x94,0x0B,0xA4,
+    0x6C,0xAC,0xAD,0x82,0xB4,0xCD,0x81,0xB4,0xAD,0x00,0xBC,0xAD,0x80,0xBC,0x8C,0x00,
+    0xBC,0x6C,0x80,0xBC,0x6B,0x81,0xB4,0x6B,0x02,0xB4,0x8B,0xBC,0x8B,0xBC,0x8C,0x80,
+    0xBC,0x6B,0x80,0xBC,0x8C,0x80,0xBC,0xAC,0x80,0xC4,0xAC,0x80,0xC4,0xCD,0x81,0xC4,
+    0xED,0x81,0xC4,0xCD,0x01,0xC4,0xAC,0xBC,0xAC,0x80,0xC4,0xAC,0x05,0xC4,0xCD,0xCC,
+    0xED,0xC4,0xCD,0xC4,0xAC,0xBC,0x8C,0xC4,0xAC,0x81,0xBC,0x8C,0x80,0xBC,0x6C,0x81,
+    0xBC,0x8C,0x82,0xBC,0x6B,0x00,0xBC,0x8C,0x82,0xC4,0xAC,0x80,0xBC,0x8C,0x00,0xBC,
+    0x6C,0x81,0xBC,0x8C,0x80,0xC4,0xAC,0x00,0xC4,0xCD,0x81,0xC4,0xED,0x81,0xC4,0xCD,
+    0x05,0xBC,0xAC,0xB4,0x8C,0xA4,0x0B,0x93,0x89,0x83,0x28,0x7A,0xE8,0x80,0x72,0xC8,
+    0x03,0x7B,0x0A,0x93,0xEE,0xD5,0xF6,0xEF,0x1A,0x85,0xEF,0x5B,0x87,0x5A,0x88,0x05,
+    0x52,0x88,0x52,0x67,0x52,0x47,0x4A,0x26,0x4A,0x06,0x4A,0x05,0x84,0x49,0xE5,0x80,
+    0x4A,0x05,0x09,0x52,0x25,0x5A,0x46,0x5A,0x66,0x6A,0xA7,0x73,0x08,0x83,0xAA,0x9C,
+    0x2C,0xA4,0x8D,0xAC,0xAD,0xB4,0xCE,0x80,0xB4,0xCD,0x82,0xB4,0xAD,0x00,0xBC,0xAD,
+    0x80,0xBC,0x8C,0x81,0xBC,0x6B,0x82,0xB4,0x6B,0x00,0xB4,0x8B,0x81,0xBC,0x6B,0x81,
+    0xBC,0x8C,0x80,0xBC,0xAC,0x01,0xC4,0xAC,0xC4,0xCD,0x81,0xC4,0xED,0x82,0xC4,0xCD,
+    0x81,0xC4,0xAC,0x00,0xC4,0xCD,0x81,0xCC,0xED,0x01,0xC4,0xCC,0xC4,0xAC,0x81,0xC4,
+    0xCD,0x00,0xC4,0xAC,0x83,0xBC,0x8C,0x00,0xBC,0x6C,0x81,0xBC,0x8C,0x83,0xC4,0xCD,
+    0x00,0xC4,0xAC,0x81,0xBC,0x8C,0x80,0xC4,0xAC,0x00,0xC4,0xAD,0x80,0xC4,0xCD,0x83,
+    0xC4,0xED,0x80,0xC4,0xCD,0x0A,0xBC,0xAC,0xB4,0x6C,0xA4,0x0B,0x93,0x89,0x83,0x08,
+    0x7A,0xC8,0x72,0xC8,0x7A,0xE9,0x83,0x8C,0xC5,0x74,0xEE,0xFA,0x85,0xEF,0x5B,0x84,
+    0x5A,0xA8,0x80,0x5A,0x88,0x03,0x52,0x68,0x52,0x47,0x4A,0x26,0x42,0x06,0x82,0x41,
+    0xE5,0x81,0x49,0xE5,0x00,0x4A,0x05,0x81,0x52,0x05,0x09,0x52,0x25,0x5A,0x46,0x62,
+    0x87,0x6A,0xC7,0x73,0x08,0x83,0xAA,0x9C,0x4C,0xA4,0x8D,0xAC,0xCD,0xB4,0xCE,0x83,
+    0xB4,0xAD,0x80,0xB4,0xAC,0x80,0xBC,0x8C,0x81,0xBC,0x6B,0x85,0xB4,0x6B,0x80,0xBC,
+    0x6B,0x80,0xBC,0x8C,0x81,0xBC,0xAC,0x00,0xC4,0xCD,0x81,0xC4,0xED,0x83,0xC4,0xCD,
+    0x02,0xC4,0xAC,0xC4,0xCC,0xCC,0xED,0x80,0xCD,0x0E,0x82,0xCC,0xED,0x05,0xCD,0x0E,
+    0xCC,0xED,0xC4,0xCD,0xC4,0xAC,0xBC,0x8C,0xBC,0xAC,0x80,0xC4,0xAC,0x81,0xBC,0x8C,
+    0x00,0xC4,0xCD,0x82,0xCC,0xED,0x01,0xC4,0xCD,0xC4,0xAD,0x80,0xC4,0xAC,0x80,0xC4,
+    0xAD,0x82,0xC4,0xCD,0x86,0xC4,0xED,0x0A,0xBC,0xCD,0xAC,0x6C,0xA3,0xEB,0x8B,0x69,
+    0x7A,0xE8,0x7A,0xC8,0x7A,0xE9,0x83,0x4B,0xB4,0xF1,0xE6,0xD9,0xEF,0x3B,0x84,0xEF,
+    0x5B,0x80,0x5A,0xA9,0x00,0x5A,0xA8,0x80,0x5A,0xA9,0x80,0x5A,0xA8,0x03,0x5A,0x88,
+    0x52,0x68,0x4A,0x47,0x4A,0x06,0x83,0x41,0xE5,0x81,0x49,0xE5,0x82,0x52,0x05,0x09,
+    0x52,0x25,0x5A,0x66,0x6A,0xA7,0x72,0xE8,0x7B,0x28,0x8B,0xAA,0x9C,0x4C,0xA4,0x8D,
+    0xAC,0xAD,0xB4,0xCD,0x82,0xB4,0xAD,0x01,0xB4,0x8D,0xB4,0x8C,0x82,0xBC,0x8C,0x03,
+    0xBC,0x8B,0xB4,0x6B,0xB4,0x4B,0xB4,0x4A,0x81,0xB4,0x4B,0x81,0xB4,0x6B,0x80,0xBC,
+    0x6B,0x80,0xBC,0x8C,0x80,0xBC,0xAC,0x02,0xC4,0xCD,0xC4,0xED,0xCC,0xED,0x80,0xC4,
+    0xED,0x00,0xC4,0xCD,0x80,0xC4,0xED,0x80,0xC4,0xCD,0x02,0xCC,0xED,0xCD,0x0E,0xD5,
+    0x2E,0x85,0xCD,0x0E,0x02,0xCC,0xED,0xC4,0xCD,0xC4,0xAC,0x83,0xC4,0xCD,0x01,0xC4,
+    0xAD,0xCC,0xED,0x81,0xCD,0x0E,0x00,0xCC,0xED,0x87,0xC4,0xCD,0x82,0xC4,0xED,0x80,
+    0xCC,0xED,0x81,0xC4,0xED,0x04,0xBC,0xED,0xB4,0xAD,0xAC,0x4C,0xA3,0xEB,0x8B,0x49,
+    0x80,0x7B,0x09,0x03,0x7B,0x2A,0x9C,0x4F,0xDE,0x78,0xEF,0x3B,0x84,0xEF,0x5B,0x83,
+    0x5A,0xA9,0x81,0x5A,0xA8,0x04,0x52,0x68,0x52,0x67,0x4A,0x47,0x4A,0x26,0x4A,0x06,
+    0x84,0x4A,0x05,0x82,0x52,0x05,0x07,0x52,0x25,0x5A,0x65,0x6A,0xA7,0x73,0x08,0x7B,
+    0x28,0x8B,0xAA,0x9C,0x2B,0xA4,0x6C,0x80,0xAC,0xAD,0x80,0xB4,0x8D,0x82,0xB4,0x8C,
+    0x01,0xBC,0x8C,0xB4,0x8C,0x80,0xBC,0x8C,0x01,0xBC,0x8B,0xB4,0x6B,0x80,0xB4,0x4B,
+    0x80,0xAC,0x2A,0x80,0xB4,0x4B,0x80,0xB4,0x6B,0x81,0xBC,0x6B,0x80,0xBC,0x8C,0x02,
+    0xBC,0xAC,0xC4,0xCD,0xC4,0xED,0x82,0xCC,0xED,0x80,0xC4,0xED,0x02,0xC4,0xCD,0xC4,
+    0xED,0xCD,0x0E,0x81,0xD5,0x2E,0x00,0xCD,0x0E,0x81,0xD5,0x2E,0x00,0xCD,0x2E,0x80,
+    0xCD,0x0E,0x00,0xC4,0xED,0x80,0xC4,0xCD,0x82,0xC4,0xED,0x00,0xCC,0xED,0x81,0xCD,
+    0x0E,0x00,0xCC,0xED,0x82,0xC4,0xCD,0x80,0xCC,0xED,0x00,0xCC,0xEE,0x82,0xCC,0xED,
+    0x81,0xC4,0xED,0x80,0xCC,0xED,0x00,0xC4,0xED,0x80,0xC5,0x0D,0x0B,0xC4,0xED,0xBC,
+    0xED,0xB4,0xAD,0xAC,0x4C,0x9B,0xEB,0x8B,0x8A,0x83,0x49,0x83,0x2A,0x93,0xED,0xCD,
+    0xF6,0xEF,0x1A,0xEF,0x3B,0x83,0xEF,0x5B,0x83,0x5A,0xA9,0x81,0x5A,0xA8,0x01,0x52,
+    0x88,0x52,0x68,0x80,0x52,0x67,0x00,0x52,0x47,0x80,0x52,0x46,0x80,0x4A,0x26,0x82,
+    0x52,0x05,0x0C,0x52,0x25,0x52,0x05,0x52,0x25,0x5A,0x45,0x6A,0xA7,0x73,0x08,0x7B,
+    0x48,0x8B,0xAA,0x9C,0x0A,0xA4,0x4B,0xA4,0x6C,0xAC,0x8C,0xAC,0x6C,0x80,0xAC,0x8C,
+    0x83,0xB4,0x8C,0x80,0xBC,0x8C,0x80,0xB4,0x6B,0x00,0xB4,0x4B,0x82,0xB4,0x4A,0x00,
+    0xB4,0x4B,0x82,0xB4,0x6B,0x00,0xBC,0x6B,0x80,0xBC,0x8C,0x03,0xC4,0xAC,0xC4,0xCD,
+    0xC4,0xED,0xCC,0xED,0x81,0xCD,0x0E,0x01,0xCC,0xED,0xC4,0xED,0x80,0xC4,0xCD,0x02,
+    0xCC,0xEE,0xD5,0x2E,0xD5,0x2F,0x81,0xD5,0x4F,0x00,0xD5,0x2E,0x82,0xCD,0x0E,0x02,
+    0xC4,0xED,0xC4,0xCD,0xC4,0xED,0x82,0xCC,0xED,0x80,0xCD,0x0E,0x01,0xCC,0xEE,0xCC,
+    0xED,0x81,0xC4,0xCD,0x01,0xCC,0xED,0xCC,0xEE,0x83,0xCD,0x0E,0x01,0xCC,0xEE,0xCC,
+    0xED,0x81,0xC4,0xED,0x80,0xCC,0xED,0x80,0xC4,0xED,0x80,0xC5,0x0D,0x0A,0xC4,0xEE,
+    0xBC,0xEE,0xBC,0xAD,0xB4,0x8D,0xA4,0x2C,0x93,0xCB,0x8B,0x8B,0x93,0xED,0xC5,0xB5,
+    0xEE,0xFA,0xEF,0x3A,0x83,0xEF,0x5B,0x84,0x5A,0xA9,0x80,0x5A,0xA8,0x80,0x52,0x88,
+    0x01,0x5A,0x88,0x5A,0xA8,0x80,0x5A,0x88,0x04,0x5A,0x67,0x52,0x47,0x52,0x26,0x52,
+    0x05,0x4A,0x05,0x83,0x52,0x05,0x09,0x5A,0x45,0x6A,0x86,0x73,0x08,0x83,0x69,0x93,
+    0xCA,0x9C,0x0B,0xA4,0x4B,0xA4,0x6C,0xAC,0x8C,0xAC,0x6C,0x80,0xAC,0x8C,0x80,0xB4,
+    0x6C,0x81,0xB4,0x8C,0x80,0xBC,0x8C,0x80,0xB4,0x6B,0x81,0xB4,0x4A,0x80,0xB4,0x4B,
+    0x83,0xB4,0x6B,0x07,0xBC,0x6B,0xBC,0x8B,0xBC,0x8C,0xC4,0xAC,0xC4,0xCD,0xC4,0xED,
+    0xCC,0xED,0xCD,0x0E,0x80,0xCD,0x2E,0x01,0xCD,0x0E,0xC4,0xED,0x81,0xC4,0xCD,0x01,
+    0xCD,0x0E,0xD5,0x4F,0x80,0xDD,0x6F,0x00,0xD5,0x4F,0x83,0xCD,0x0E,0x00,0xCC,0xED,
+    0x80,0xC4,0xED,0x00,0xCC,0xED,0x81,0xCD,0x0E,0x80,0xD5,0x2E,0x03,0xC4,0xCD,0xC4,
+    0xAD,0xC4,0xCD,0xCC,0xED,0x81,0xCD,0x0E,0x81,0xD5,0x2E,0x81,0xCD,0x0E,0x80,0xCD,
+    0x0D,0x84,0xC4,0xED,0x80,0xC5,0x0D,0x81,0xC5,0x0E,0x07,0xBD,0x0E,0xB4,0xCE,0xAC,
+    0x6D,0x9C,0x0C,0x94,0x0D,0xBD,0x73,0xEE,0xF9,0xEF,0x3A,0x83,0xEF,0x5B,0x86,0x5A,
+    0xA9,0x84,0x5A,0x88,0x03,0x5A,0x67,0x52,0x47,0x52,0x06,0x49,0xE5,0x81,0x49,0xC4,
+    0x09,0x49,0xE4,0x51,0xE4,0x52,0x05,0x5A,0x26,0x6A,0xA7,0x7B,0x29,0x8B,0xAA,0x93,
+    0xEB,0x9C,0x0B,0xA4,0x4B,0x83,0xAC,0x6C,0x80,0xB4,0x6C,0x82,0xB4,0x8C,0x00,0xB4,
+    0x8B,0x80,0xB4,0x6B,0x01,0xB4,0x4A,0xB4,0x4B,0x84,0xB4,0x6B,0x80,0xBC,0x6B,0x80,
+    0xBC,0x8B,0x04,0xBC,0x8C,0xC4,0xAC,0xC4,0xCC,0xC4,0xED,0xCC,0xED,0x80,0xCD,0x0E,
+    0x0A,0xCD,0x2E,0xCD,0x0E,0xC4,0xED,0xC4,0xAC,0xBC,0xAC,0xC4,0xCD,0xCD,0x0E,0xD5,
+    0x4F,0xDD,0x70,0xDD,0x6F,0xD5,0x4F,0x83,0xCD,0x0E,0x00,0xCC,0xED,0x80,0xC4,0xED,
+    0x81,0xCC,0xED,0x05,0xCD,0x0E,0xD5,0x4F,0xD5,0x2E,0xC4,0xAD,0xBC,0x8C,0xC4,0xCD,
+    0x81,0xD5,0x2E,0x80,0xCD,0x0E,0x80,0xD5,0x2E,0x81,0xCD,0x0E,0x80,0xCD,0x0D,0x84,
+    0xC4,0xED,0x04,0xC5,0x0D,0xC5,0x0E,0xC5,0x0D,0xC5,0x0E,0xCD,0x2E,0x80,0xC5,0x2F,
+    0x06,0xBC,0xEF,0xAC,0x8E,0x9C,0x2E,0xB4,0xF1,0xE6,0xB9,0xEF,0x1A,0xEF,0x3B,0x82,
+    0xEF,0x5B,0x87,0x5A,0xA9,0x83,0x5A,0xA8,0x03,0x5A,0x87,0x52,0x47,0x4A,0x06,0x41,
+    0xC4,0x81,0x41,0xA4,0x09,0x49,0xA4,0x49,0xC4,0x5A,0x05,0x62,0x66,0x72,0xE8,0x83,
+    0x6A,0x93,0xCA,0x94,0x0B,0x9C,0x2B,0xA4,0x4C,0x84,0xAC,0x6C,0x00,0xB4,0x6C,0x81,
+    0xB4,0x8C,0x00,0xB4,0x6C,0x81,0xB4,0x6B,0x80,0xB4,0x4A,0x83,0xB4,0x6B,0x80,0xBC,
+    0x8B,0x00,0xBC,0x8C,0x80,0xBC,0xAC,0x04,0xBC,0x8C,0xC4,0xAC,0xC4,0xCC,0xC4,0xCD,
+    0xCC,0xED,0x82,0xCD,0x0E,0x08,0xC4,0xCD,0xBC,0xAC,0xBC,0x8C,0xC4,0xAC,0xCC,0xED,
+    0xD5,0x4F,0xDD,0x70,0xDD,0x6F,0xD5,0x4F,0x83,0xCD,0x0E,0x00,0xCC,0xED,0x83,0xC4,
+    0xED,0x05,0xCD,0x0E,0xD5,0x2E,0xCD,0x2E,0xC4,0xCD,0xC4,0xAC,0xCD,0x0E,0x80,0xD5,
+    0x4F,0x00,0xD5,0x2E,0x82,0xCD,0x0E,0x00,0xD5,0x2E,0x82,0xCD,0x0E,0x84,0xC4,0xED,
+    0x00,0xC5,0x0D,0x80,0xC5,0x0E,0x80,0xCD,0x2E,0x81,0xC5,0x2F,0x04,0xBD,0x10,0xAC,
+    0xAF,0xAC,0xB0,0xDE,0x57,0xEF,0x1A,0x83,0xEF,0x5B,0x88,0x5A,0xA9,0x82,0x5A,0xA8,
+    0x10,0x5A,0x88,0x52,0x47,0x52,0x26,0x49,0xE5,0x41,0xC4,0x41,0xA4,0x49,0xA4,0x49,
+    0xC4,0x51,0xE5,0x62,0x46,0x72,0xA7,0x7B,0x29,0x8B,0xAA,0x93,0xCA,0x93,0xEB,0x9C,
+    0x2B,0xA4,0x4B,0x83,0xAC,0x6C,0x83,0xB4,0x6C,0x81,0xB4,0x6B,0x00,0xB4,0x4B,0x84,
+    0xB4,0x6B,0x81,0xBC,0x8B,0x01,0xBC,0xAC,0xC4,0xAC,0x80,0xBC,0xAC,0x03,0xC4,0xAC,
+    0xC4,0xCC,0xC4,0xED,0xCD,0x0D,0x81,0xCD,0x0E,0x06,0xCC,0xED,0xC4,0xCD,0xBC,0x8C,
+    0xBC,0x6B,0xBC,0x6C,0xC4,0xCD,0xD5,0x2E,0x80,0xDD,0x6F,0x00,0xD5,0x4F,0x83,0xCD,
+    0x0E,0x80,0xCC,0xED,0x00,0xC4,0xED,0x81,0xC4,0xCD,0x05,0xCD,0x0E,0xD5,0x2E,0xCD,
+    0x2E,0xC4,0xCD,0xC4,0xED,0xD5,0x2E,0x80,0xD5,0x4F,0x01,0xD5,0x2E,0xCD,0x0E,0x80,
+    0xCC,0xED,0x80,0xCD,0x0E,0x00,0xD5,0x2E,0x81,0xCD,0x0E,0x00,0xCC,0xEE,0x84,0xC4,
+    0xED,0x00,0xC5,0x0E,0x82,0xCD,0x2E,0x80,0xC5,0x2F,0x05,0xC5,0x30,0xB4,0xCF,0xA4,
+    0x6F,0xCD,0xD5,0xEE,0xFA,0xEF,0x3B,0x82,0xEF,0x5B,0x85,0x5A,0xA9,0x80,0x5A,0xC9,
+    0x82,0x62,0xC9,0x80,0x5A,0xA8,0x03,0x5A,0x88,0x5A,0x47,0x52,0x26,0x52,0x05,0x80,
+    0x49,0xE5,0x09,0x5A,0x25,0x62,0x46,0x72,0xC7,0x83,0x29,0x8B,0x8A,0x93,0xCA,0x93,
+    0xEA,0x9C,0x0B,0x9C,0x2B,0xA4,0x4B,0x84,0xAC,0x6C,0x81,0xB4,0x6C,0x82,0xB4,0x6B,
+    0x00,0xB4,0x4B,0x82,0xB4,0x6B,0x80,0xB4,0x8B,0x81,0xBC,0x8B,0x06,0xBC,0xAC,0xC4,
+    0xCC,0xC4,0xAC,0xBC,0xAC,0xC4,0xCC,0xC4,0xEC,0xCD,0x0D,0x82,0xCD,0x0E,0x0C,0xCC,
+    0xED,0xC4,0xAC,0xB4,0x6B,0xB4,0x4B,0xB4,0x6B,0xC4,0xAC,0xCD,0x2E,0xD5,0x6F,0xDD,
+    0x6F,0xD5,0x4F,0xCD,0x0E,0xCC,0xEE,0xCD,0x0E,0x81,0xCC,0xED,0x0A,0xC4,0xED,0xC4,
+    0xCD,0xC4,0xAC,0xBC,0xAC,0xC4,0xAC,0xCC,0xED,0xD5,0x2E,0xCD,0x0E,0xC4,0xCD,0xCC,
+    0xED,0xD5,0x2E,0x80,0xD5,0x4F,0x01,0xCD,0x0E,0xCC,0xED,0x81,0xC4,0xCD,0x07,0xCC,
+    0xED,0xCD,0x0E,0xD5,0x2E,0xD5,0x0F,0xCD,0x0E,0xCC,0xEE,0xC4,0xED,0xC4,0xCD,0x82,
+    0xC4,0xED,0x00,0xC5,0x0E,0x82,0xCD,0x2E,0x06,0xCD,0x2F,0xC5,0x2F,0xC5,0x30,0xB4,
+    0xCF,0xA4,0x4E,0xBD,0x53,0xE6,0xD9,0x83,0xEF,0x5B,0x84,0x5A,0xA9,0x80,0x5A,0xC9,
+    0x83,0x62,0xC9,0x81,0x62,0xA9,0x02,0x6A,0xA9,0x62,0xA8,0x62,0x87,0x80,0x5A,0x46,
+    0x05,0x62,0x66,0x72,0xA7,0x83,0x29,0x93,0xAB,0x93,0xEC,0x9C,0x0C,0x81,0x9C,0x2B,
+    0x00,0xA4,0x4B,0x81,0xAC,0x6C,0x01,0xAC,0x6B,0xAC,0x6C,0x82,0xB4,0x6C,0x81,0xB4,
+    0x4B,0x83,0xB4,0x6B,0x83,0xBC,0x8B,0x80,0xBC,0xAB,0x01,0xBC,0xAC,0xBC,0xCC,0x80,
+    0xC4,0xCC,0x01,0xC4,0xEC,0xCD,0x0D,0x82,0xCD,0x2E,0x01,0xC4,0xED,0xBC,0x8C,0x80,
+    0xB4,0x4B,0x02,0xB4,0x6B,0xBC,0xAC,0xCD,0x0E,0x80,0xD5,0x6F,0x02,0xD5,0x4F,0xCD,
+    0x2E,0xCD,0x0E,0x81,0xCC,0xED,0x00,0xC4,0xED,0x80,0xC4,0xCD,0x80,0xBC,0x8C,0x0F,
+    0xBC,0xAC,0xCC,0xED,0xD5,0x2E,0xCC,0xED,0xC4,0xAC,0xCC,0xED,0xD5,0x2E,0xD5,0x4F,
+    0xD5,0x2E,0xCD,0x0E,0xC4,0xCD,0xBC,0xAC,0xBC,0x8C,0xBC,0xAC,0xC4,0xCD,0xCD,0x0E,
+    0x80,0xD5,0x2E,0x01,0xCD,0x0E,0xCC,0xED,0x82,0xC4,0xCD,0x80,0xC4,0xED,0x00,0xC5,
+    0x0E,0x81,0xCD,0x2E,0x80,0xCD,0x4F,0x06,0xCD,0x2F,0xC5,0x30,0xAC,0xAF,0x9C,0x0E,
+    0xB4,0xF1,0xE6,0xB8,0xEF,0x3B,0x82,0xEF,0x5B,0x83,0x5A,0xA9,0x80,0x5A,0xC9,0x86,
+    0x62,0xC9,0x09,0x6A,0xC9,0x73,0x0A,0x73,0x2A,0x73,0x09,0x6A,0xC8,0x62,0xA7,0x6A,
+    0xA7,0x7A,0xE8,0x83,0x6A,0x93,0xEC,0x80,0x9C,0x2C,0x80,0x9C,0x2B,0x02,0xA4,0x2B,
+    0xA4,0x4B,0xAC,0x6B,0x80,0xAC,0x6C,0x80,0xAC,0x6B,0x00,0xB4,0x6B,0x80,0xB4,0x6C,
+    0x84,0xB4,0x4B,0x81,0xB4,0x6B,0x83,0xBC,0x8B,0x01,0xBC,0xAB,0xBC,0x8B,0x80,0xBC,
+    0xAC,0x02,0xC4,0xAC,0xC4,0xCC,0xC4,0xED,0x83,0xCD,0x2E,0x01,0xC4,0xED,0xBC,0x8C,
+    0x80,0xB4,0x2A,0x08,0xB4,0x6B,0xC4,0xAC,0xCD,0x0E,0xD5,0x4F,0xD5,0x6F,0xD5,0x4F,
+    0xD5,0x2E,0xCD,0x0E,0xCC,0xED,0x80,0xCD,0x0E,0x0A,0xCC,0xED,0xC4,0xCD,0xC4,0xAC,
+    0xBC,0xAC,0xBC,0x8C,0xBC,0xAC,0xC4,0xED,0xCD,0x0E,0xC4,0xED,0xC4,0xCD,0xCD,0x0E,
+    0x80,0xD5,0x4F,0x02,0xCD,0x0E,0xC4,0xCD,0xBC,0x8C,0x80,0xBC,0x6B,0x06,0xBC,0x8C,
+    0xC4,0xAC,0xCC,0xEE,0xCD,0x2E,0xD5,0x2E,0xCD,0x0E,0xCC,0xED,0x81,0xC4,0xCD,0x81,
+    0xC4,0xED,0x00,0xCD,0x0E,0x82,0xCD,0x2E,0x80,0xCD,0x4F,0x05,0xC5,0x2F,0xAC,0x6E,
+    0x93,0xED,0xA4,0x6F,0xDE,0x78,0xF7,0x3B,0x82,0xEF,0x5B,0x83,0x5A,0xA9,0x80,0x5A,
+    0xC9,0x86,0x62,0xC9,0x09,0x6A,0xE9,0x7B,0x6B,0x83,0xAB,0x83,0x8B,0x73,0x29,0x6A,
+    0xC7,0x72,0xC7,0x7B,0x08,0x83,0x89,0x9C,0x0C,0x81,0xA4,0x4C,0x03,0xA4,0x4B,0xA4,
+    0x2B,0xA4,0x4B,0xAC,0x4B,0x80,0xAC,0x6C,0x01,0xAC,0x6B,0xAC,0x6C,0x81,0xB4,0x6C,
+    0x83,0xB4,0x4B,0x81,0xB4,0x4A,0x87,0xB4,0x6B,0x03,0xBC,0x8B,0xBC,0xAC,0xC4,0xCD,
+    0xC4,0xED,0x83,0xCD,0x2E,0x01,0xC4,0xED,0xBC,0x8C,0x80,0xB4,0x2A,0x02,0xB4,0x6B,
+    0xC4,0xAC,0xCD,0x0E,0x81,0xD5,0x4F,0x00,0xD5,0x2E,0x80,0xCD,0x0E,0x80,0xCD,0x2E,
+    0x07,0xCD,0x0E,0xC4,0xCD,0xC4,0xAC,0xBC,0xAC,0xBC,0x8C,0xBC,0xAC,0xC4,0xED,0xCD,
+    0x0E,0x80,0xC4,0xCD,0x00,0xCD,0x0E,0x80,0xD5,0x4F,0x01,0xCD,0x0E,0xC4,0xAC,0x81,
+    0xB4,0x6B,0x07,0xBC,0x6B,0xC4,0xAC,0xCC,0xED,0xCD,0x2E,0xD5,0x2E,0xCD,0x0E,0xCC,
+    0xEE,0xC4,0xED,0x80,0xC4,0xCD,0x80,0xC4,0xED,0x01,0xCD,0x0D,0xCD,0x0E,0x81,0xCD,
+    0x2E,0x80,0xCD,0x4F,0x80,0xC5,0x2F,0x05,0xAC,0x6E,0x93,0xCC,0x93,0xED,0xD6,0x16,
+    0xF7,0x3A,0xEF,0x3B,0x81,0xEF,0x5B,0x83,0x5A,0xA9,0x80,0x5A,0xC9,0x86,0x62,0xC9,
+    0x11,0x6A,0xE9,0x73,0x4A,0x83,0x8B,0x83,0xAB,0x7B,0x6A,0x73,0x28,0x7B,0x08,0x83,
+    0x48,0x8B,0xAA,0x9C,0x0B,0xA4,0x6D,0xA4,0x6C,0xA4,0x4C,0xA4,0x4B,0xA4,0x2B,0xA4,
+    0x4B,0xAC,0x4B,0xAC,0x6B,0x82,0xB4,0x8C,0x81,0xB4,0x6C,0x00,0xB4,0x4C,0x81,0xB4,
+    0x4B,0x00,0xAC,0x2A,0x80,0xAC,0x0A,0x82,0xAC,0x2A,0x80,0xAC,0x2B,0x81,0xAC,0x0A,
+    0x03,0xAC,0x2B,0xBC,0x8C,0xC4,0xED,0xC4,0xEE,0x83,0xCD,0x0E,0x01,0xC4,0xED,0xBC,
+    0x8B,0x80,0xB4,0x2A,0x02,0xBC,0x6B,0xC4,0xCD,0xCD,0x2E,0x82,0xD5,0x4F,0x0B,0xCD,
+    0x2E,0xCD,0x0E,0xD5,0x2E,0xD5,0x4F,0xCD,0x2E,0xC4,0xED,0xC4,0xCD,0xBC,0xAC,0xBC,
+    0x8C,0xC4,0xAC,0xCC,0xED,0xCD,0x0E,0x80,0xC4,0xCD,0x00,0xCD,0x0E,0x80,0xD5,0x4F,
+    0x01,0xCD,0x0E,0xBC,0xAC,0x81,0xB4,0x4B,0x04,0xBC,0x6B,0xC4,0xAC,0xCC,0xEE,0xCD,
+    0x0E,0xD5,0x2F,0x80,0xCD,0x0E,0x04,0xCC,0xEE,0xC4,0xED,0xC4,0xCD,0xCC,0xEE,0xCD,
+    0x0D,0x80,0xCD,0x0E,0x81,0xCD,0x2E,0x80,0xCD,0x4F,0x07,0xCD,0x2F,0xC5,0x2F,0xA4,
+    0x6E,0x93,0xCC,0x8B,0xAC,0xC5,0x73,0xEF,0x1A,0xEF,0x3B,0x81,0xEF,0x5B,0x00,0x5A,
+    0xA9,0x84,0x5A,0xC9,0x86,0x62,0xC9,0x07,0x62,0xE8,0x6B,0x09,0x7B,0x6A,0x83,0xAB,
+    0x8B,0xAB,0x8B,0xCB,0x93,0xEB,0x9C,0x0B,0x80,0xA4,0x4C,0x03,0xAC,0x8D,0xAC,0x6C,
+    0xA4,0x6C,0xA4,0x4B,0x80,0xA4,0x2B,0x02,0xA4,0x4B,0xAC,0x4B,0xB4,0x6C,0x81,0xB4,
+    0x8C,0x81,0xB4,0x6C,0x06,0xB4,0x4C,0xB4,0x4B,0xB4,0x2B,0xAC,0x2A,0xAB,0xEA,0xA3,
+    0xC9,0x9B,0xA9,0x80,0x9B,0x88,0x80,0x93,0x67,0x02,0x9B,0x68,0x93,0x48,0x93,0x27,
+    0x80,0x8B,0x07,0x03,0x93,0x48,0xA3,0xEA,0xBC,0xAD,0xC5,0x0E,0x83,0xCD,0x0E,0x01,
+    0xC4,0xED,0xBC,0xAC,0x80,0xB4,0x6B,0x02,0xBC,0x8C,0xC4,0xED,0xCD,0x2E,0x81,0xD5,
+    0x4F,0x00,0xD5,0x2E,0x80,0xCD,0x2E,0x80,0xD5,0x4F,0x07,0xD5,0x2E,0xCD,0x0E,0xC4,
+    0xCD,0xBC,0xAC,0xBC,0x8C,0xC4,0xAC,0xCC,0xED,0xCD,0x0E,0x80,0xC4,0xCD,0x00,0xCD,
+    0x0E,0x80,0xD5,0x4F,0x01,0xCD,0x0E,0xBC,0xAC,0x81,0xB4,0x4B,0x02,0xBC,0x8C,0xC4,
+    0xCD,0xCD,0x0E,0x80,0xD5,0x2F,0x80,0xCD,0x0E,0x80,0xCC,0xEE,0x01,0xC4,0xEE,0xCC,
+    0xEE,0x81,0xCD,0x0E,0x81,0xCD,0x2E,0x80,0xCD,0x4F,0x07,0xCD,0x2F,0xBC,0xEF,0xA4,
+    0x4D,0x93,0xAC,0x83,0x6B,0xB4,0xF1,0xE6,0xD9,0xEF,0x3B,0x81,0xEF,0x5B,0x00,0x5A,
+    0xA9,0x83,0x5A,0xC9,0x87,0x62,0xC9,0x09,0x62,0xC8,0x6B,0x09,0x7B,0x6A,0x83,0x8B,
+    0x93,0xEC,0xA4,0x4D,0xAC,0x8D,0xAC,0xAE,0xB4,0xAE,0xAC,0xAD,0x80,0xAC,0x8D,0x00,
+    0xAC,0x6C,0x80,0xA4,0x4B,0x03,0xA4,0x2A,0xA4,0x2B,0xAC,0x4B,0xB4,0x6C,0x80,0xB4,
+    0x8C,0x01,0xBC,0xAC,0xB4,0x8C,0x81,0xB4,0x6C,0x0C,0xB4,0x4C,0xB4,0x4B,0xAC,0x2B,
+    0xAC,0x0A,0xA3,0xC9,0x9B,0x68,0x93,0x47,0x8B,0x06,0x82,0xC6,0x82,0xA5,0x7A,0x85,
+    0x7A,0x65,0x72,0x24,0x80,0x6A,0x03,0x04,0x6A,0x04,0x7A,0xC6,0x9B,0xA9,0xAC,0x4C,
+    0xBC,0xAD,0x80,0xC4,0xEE,0x80,0xCD,0x0E,0x01,0xC4,0xEE,0xC4,0xCD,0x80,0xC4,0xAC,
+    0x02,0xC4,0xED,0xCD,0x0E,0xD5,0x2E,0x80,0xD5,0x4F,0x80,0xD5,0x2E,0x0B,0xCD,0x0E,
+    0xCD,0x2E,0xD5,0x4F,0xD5,0x6F,0xD5,0x4F,0xCD,0x2E,0xC4,0xED,0xC4,0xAC,0xBC,0xAC,
+    0xC4,0xCD,0xCC,0xED,0xCD,0x0E,0x80,0xC4,0xCD,0x00,0xCD,0x0E,0x80,0xD5,0x2E,0x01,
+    0xCD,0x0E,0xBC,0xAC,0x81,0xB4,0x4B,0x02,0xBC,0xAC,0xCC,0xED,0xCD,0x2F,0x80,0xD5,
+    0x2F,0x00,0xCD,0x2F,0x80,0xCD,0x0E,0x82,0xCC,0xEE,0x81,0xCD,0x0E,0x81,0xCD,0x2E,
+    0x08,0xCD,0x4F,0xCD,0x2F,0xBC,0xEE,0xAC,0x4D,0x93,0xAB,0x83,0x4B,0xA4,0x4F,0xDE,
+    0x98,0xEF,0x3A,0x81,0xEF,0x5B,0x83,0x5A,0xC9,0x88,0x62,0xC9,0x05,0x6A,0xE9,0x73,
+    0x2A,0x7B,0x6A,0x83,0xAB,0x93,0xEC,0xA4,0x6D,0x80,0xAC,0x8D,0x80,0xAC,0xAD,0x04,
+    0xB4,0xAD,0xAC,0x8D,0xAC,0x8C,0xAC,0x6C,0xA4,0x4B,0x80,0xA4,0x2A,0x02,0xAC,0x4B,
+    0xB4,0x6C,0xB4,0x8C,0x80,0xBC,0xAC,0x00,0xBC,0x8C,0x80,0xB4,0x4B,0x80,0xB4,0x4C,
+    0x16,0xB4,0x4B,0xB4,0x2B,0xAC,0x2B,0xA3,0xC9,0x93,0x48,0x8B,0x06,0x7A,0xA5,0x72,
+    0x64,0x6A,0x24,0x62,0x03,0x59,0xC3,0x51,0x82,0x49,0x61,0x49,0x41,0x49,0x62,0x51,
+    0xC3,0x6A,0x65,0x72,0xC6,0x8B,0x69,0xA3,0xEB,0xAC,0x6C,0xBC,0xAD,0xC4,0xEE,0x80,
+    0xCC,0xEE,0x04,0xC4,0xEE,0xCD,0x0E,0xCD,0x2E,0xD5,0x2E,0xD5,0x4F,0x80,0xD5,0x2E,
+    0x80,0xCD,0x2E,0x0B,0xCD,0x0E,0xD5,0x2E,0xD5,0x4F,0xD5,0x6F,0xD5,0x4F,0xD5,0x2E,
+    0xCC,0xED,0xC4,0xCD,0xC4,0xAC,0xC4,0xCD,0xCD,0x0E,0xCD,0x2E,0x81,0xCD,0x0E,0x03,
+    0xCD,0x2E,0xCC,0xEE,0xC4,0xCD,0xBC,0x8C,0x80,0xB4,0x4B,0x03,0xB4,0x6B,0xC4,0xCD,
+    0xCD,0x0E,0xD5,0x4F,0x81,0xD5,0x2F,0x01,0xCD,0x2F,0xCD,0x0F,0x84,0xCD,0x0E,0x82,
+    0xCD,0x2E,0x09,0xCD,0x2F,0xCD,0x4F,0xC4,0xEF,0xAC,0x6D,0x9B,0xCB,0x8B,0x8B,0x9C,
+    0x4F,0xDE,0x57,0xEF,0x1A,0xEF,0x3B,0x80,0xEF,0x5B,0x00,0x62,0xC9,0x82,0x5A,0xC9,
+    0x88,0x62,0xC9,0x06,0x6B,0x09,0x7B,0x4B,0x83,0x8B,0x8B,0xCC,0x9C,0x2D,0xA4,0x6D,
+    0xAC,0x6D,0x82,0xAC,0x8D,0x00,0xAC,0x8C,0x80,0xAC,0x6C,0x04,0xAC,0x4B,0xA4,0x2A,
+    0xA4,0x0A,0xAC,0x2A,0xAC,0x4B,0x81,0xB4,0x6B,0x05,0xAC,0x4B,0xAC,0x0A,0xA3,0xEA,
+    0xAC,0x0B,0xAC,0x2B,0xB4,0x2B,0x80,0xB4,0x4B,0x08,0xAC,0x2B,0x9B,0xA9,0x8B,0x27,
+    0x7A,0xA5,0x6A,0x24,0x59,0xE4,0x49,0xA3,0x41,0x62,0x41,0x42,0x80,0x39,0x21,0x01,
+    0x41,0x62,0x49,0xA2,0x80,0x41,0x82,0x08,0x51,0xC3,0x62,0x24,0x7B,0x07,0x9B,0xAA,
+    0xAC,0x4C,0xC4,0xCE,0xCC,0xEF,0xCD,0x0F,0xD5,0x2F,0x80,0xD5,0x4F,0x00,0xD5,0x2F,
+    0x81,0xCD,0x2E,0x80,0xCD,0x0E,0x00,0xD5,0x2E,0x81,0xD5,0x4F,0x01,0xD5,0x2E,0xCD,
+    0x0E,0x80,0xC4,0xCD,0x02,0xCC,0xED,0xCD,0x0E,0xCD,0x2E,0x82,0xCD,0x0E,0x07,0xC4,
+    0xCD,0xC4,0xAC,0xBC,0x6B,0xB4,0x6B,0xBC,0x6B,0xBC,0xAC,0xC4,0xED,0xD5,0x2F,0x81,
+    0xD5,0x4F,0x81,0xD5,0x2F,0x80,0xCD,0x2F,0x00,0xCD,0x0F,0x82,0xCD,0x0E,0x82,0xCD,
+    0x2E,0x08,0xCD,0x4F,0xC5,0x0F,0xBC,0xAE,0xA4,0x0C,0x93,0xAC,0x9C,0x2E,0xCD,0xF5,
+    0xEE,0xFA,0xEF,0x3B,0x80,0xEF,0x5B,0x8C,0x62,0xC9,0x07,0x6A,0xEA,0x73,0x2A,0x7B,
+    0x6B,0x83,0x8B,0x93,0xCC,0x9C,0x2D,0xA4,0x6D,0xAC,0x6D,0x80,0xAC,0x6C,0x81,0xAC,
+    0x4C,0x80,0xAC,0x4B,0x02,0xA4,0x2A,0xA4,0x0A,0x9B,0xE9,0x82,0xA3,0xE9,0x06,0x9B,
+    0xC9,0x9B,0xA9,0x9B,0x88,0x9B,0xA9,0xA3,0xCA,0xAC,0x0A,0xB4,0x4B,0x80,0xB4,0x6C,
+    0x06,0xB4,0x8C,0xAC,0x2B,0x93,0x69,0x7A,0xA6,0x62,0x04,0x51,0xA4,0x41,0x83,0x81,
+    0x39,0x42,0x03,0x39,0x41,0x41,0x82,0x52,0x25,0x41,0xA3,0x80,0x39,0x41,0x07,0x41,
+    0x62,0x5A,0x24,0x7A,0xE7,0x93,0xAA,0xB4,0x6D,0xC4,0xEF,0xCD,0x10,0xD5,0x30,0x80,
+    0xD5,0x4F,0x01,0xD5,0x2F,0xCD,0x0F,0x82,0xCD,0x0E,0x00,0xD5,0x2E,0x81,0xD5,0x4F,
+    0x01,0xD5,0x2E,0xCD,0x0E,0x80,0xCC,0xED,0x80,0xCD,0x0E,0x00,0xCD,0x2E,0x81,0xCD,
+    0x0E,0x08,0xCC,0xED,0xC4,0xCD,0xBC,0xAC,0xBC,0x8C,0xBC,0x6C,0xBC,0x8D,0xC4,0xCD,
+    0xCD,0x0E,0xD5,0x4F,0x81,0xD5,0x70,0x00,0xD5,0x4F,0x80,0xD5,0x2F,0x01,0xD5,0x4F,
+    0xD5,0x2F,0x80,0xCD,0x0F,0x80,0xCD,0x0E,0x81,0xCD,0x0F,0x01,0xCD,0x0E,0xCD,0x2E,
+    0x80,0xCD,0x2F,0x01,0xBC,0xEE,0xB4,0x8D,0x80,0x9C,0x2D,0x04,0xC5,0x93,0xEE,0xFA,
+    0xF7,0x1B,0xF7,0x3B,0xEF,0x5B,0x8C,0x62,0xC9,0x06,0x6A,0xEA,0x73,0x2A,0x83,0x8B,
+    0x8B,0xAC,0x93,0xEC,0x9C,0x0C,0xA4,0x2C,0x80,0xA4,0x4C,0x00,0xA4,0x2C,0x80,0xA4,
+    0x2B,0x00,0xA4,0x0B,0x80,0xA4,0x0A,0x03,0x9B,0xE9,0x9B,0xC9,0x9B,0xA8,0x93,0xA8,
+    0x80,0x93,0x88,0x07,0x93,0x67,0x8B,0x47,0x93,0x47,0x93,0x68,0x9B,0xA9,0xA3,0xEA,
+    0xAC,0x2B,0xBC,0x8C,0x80,0xC4,0xCD,0x05,0xC4,0xEE,0xB4,0x8D,0x93,0xAA,0x72,0xA6,
+    0x59,0xE4,0x49,0x83,0x82,0x39,0x42,0x0D,0x31,0x42,0x49,0xE4,0x6B,0x08,0x4A,0x25,
+    0x41,0x82,0x39,0x82,0x41,0x62,0x49,0xA3,0x62,0x45,0x7B,0x08,0xA3,0xEC,0xBC,0xCF,
+    0xCD,0x30,0xD5,0x50,0x81,0xD5,0x2F,0x00,0xCD,0x0F,0x83,0xCD,0x0E,0x00,0xD5,0x2F,
+    0x80,0xD5,0x4F,0x03,0xD5,0x2E,0xCD,0x0E,0xCC,0xED,0xCC,0xEE,0x81,0xCD,0x0E,0x03,
+    0xCD,0x2E,0xCD,0x0E,0xCC,0xED,0xC4,0xED,0x80,0xC4,0xAC,0x05,0xBC,0xAC,0xBC,0xAD,
+    0xC4,0xCD,0xC4,0xEE,0xCD,0x2F,0xCD,0x4F,0x81,0xD5,0x70,0x80,0xD5,0x50,0x03,0xD5,
+    0x4F,0xD5,0x50,0xD5,0x2F,0xCD,0x2F,0x84,0xCD,0x0F,0x00,0xCD,0x0E,0x80,0xCD,0x2E,
+    0x0A,0xCD,0x2F,0xC5,0x0F,0xC4,0xEF,0xAC,0x6E,0x9C,0x2D,0xB5,0x11,0xEE,0xD9,0xF7,
+    0x1A,0xF7,0x3B,0xEF,0x5B,0x62,0xC9,0x81,0x62,0xCA,0x00,0x62,0xEA,0x81,0x62,0xCA,
+    0x84,0x62,0xC9,0x03,0x6A,0xE9,0x73,0x2A,0x83,0x8B,0x8B,0xAB,0x80,0x93,0xEC,0x80,
+    0x9C,0x0B,0x01,0x9B,0xEB,0x9B,0xEA,0x81,0x9B,0xCA,0x81,0x9B,0xC9,0x02,0x93,0xA8,
+    0x93,0x67,0x8B,0x47,0x82,0x8B,0x26,0x05,0x93,0x67,0x9B,0xC9,0xAC,0x0A,0xB4,0x6C,
+    0xBC,0xAD,0xCD,0x0E,0x81,0xCD,0x4F,0x06,0xBC,0xEE,0xA3,0xEB,0x7A,0xC7,0x59,0xE4,
+    0x41,0x62,0x39,0x42,0x31,0x42,0x81,0x31,0x62,0x03,0x39,0x83,0x42,0x05,0x39,0xC4,
+    0x39,0xA3,0x80,0x39,0x83,0x06,0x41,0xA4,0x52,0x05,0x6A,0x86,0x93,0x8A,0xB4,0x6E,
+    0xC5,0x10,0xCD,0x30,0x80,0xD5,0x2F,0x00,0xCD,0x2F,0x84,0xCD,0x0E,0x00,0xD5,0x2F,
+    0x80,0xD5,0x4F,0x02,0xD5,0x2E,0xCD,0x0E,0xCC,0xEE,0x85,0xCD,0x0E,0x01,0xCC,0xED,
+    0xC4,0xCD,0x80,0xC4,0xED,0x06,0xC4,0xEE,0xCC,0xEE,0xCD,0x0F,0xCD,0x4F,0xD5,0x50,
+    0xD5,0x70,0xD5,0x50,0x80,0xCD,0x2F,0x01,0xCD,0x0F,0xC5,0x0F,0x80,0xC4,0xEE,0x80,
+    0xCD,0x0F,0x80,0xCC,0xEF,0x81,0xCD,0x0F,0x80,0xCD,0x0E,0x0B,0xCD,0x2E,0xD5,0x2F,
+    0xCD,0x2F,0xCD,0x0F,0xB4,0xCE,0xAC,0x6E,0xB5,0x10,0xEE,0xB8,0xF7,0x1A,0xF7,0x3B,
+    0xEF,0x3B,0x62,0xC9,0x85,0x62,0xCA,0x83,0x62,0xC9,0x04,0x62,0xE9,0x6B,0x09,0x73,
+    0x29,0x7B,0x6A,0x8B,0xAB,0x80,0x93,0xCB,0x00,0x93,0xCA,0x81,0x9B,0xCA,0x80,0x93,
+    0xA9,0x00,0x93,0x89,0x80,0x93,0x88,0x03,0x93,0x68,0x8B,0x67,0x8B,0x26,0x83,0x06,
+    0x80,0x82,0xE5,0x11,0x8B,0x26,0x8B,0x47,0x93,0x88,0xA4,0x0A,0xB4,0x6B,0xBC,0xCD,
+    0xCD,0x0E,0xD5,0x4F,0xD5,0x70,0xD5,0x90,0xD5,0x70,0xC5,0x0F,0xAC,0x2C,0x83,0x08,
+    0x5A,0x04,0x39,0x62,0x39,0x42,0x31,0x42,0x81,0x31,0x62,0x01,0x31,0x83,0x31,0xA3,
+    0x81,0x31,0x83,0x0A,0x39,0x83,0x41,0xC4,0x52,0x05,0x5A,0x46,0x7A,0xE9,0xA4,0x0D,
+    0xBC,0xAF,0xCD,0x10,0xCD,0x2F,0xD5,0x2F,0xCD,0x0F,0x84,0xCD,0x0E,0x81,0xD5,0x4F,
+    0x02,0xD5,0x2E,0xCD,0x0E,0xCC,0xEE,0x85,0xCD,0x0E,0x00,0xCD,0x2E,0x81,0xCD,0x0E,
+    0x01,0xCD,0x0F,0xCD,0x2F,0x80,0xCD,0x30,0x04,0xCD,0x2F,0xBC,0xEE,0xB4,0x8D,0xAC,
+    0x4C,0xA4,0x2B,0x81,0xA4,0x0B,0x03,0xAC,0x2C,0xB4,0x6D,0xC4,0xAE,0xCC,0xCF,0x80,
+    0xCC,0xEF,0x01,0xCD,0x0E,0xCD,0x0F,0x80,0xCD,0x0E,0x00,0xCD,0x2E,0x81,0xCD,0x2F,
+    0x07,0xC5,0x30,0xBD,0x10,0xC5,0x51,0xEE,0xB7,0xF7,0x19,0xEF,0x3A,0xEF,0x3B,0x62,
+    0xCA,0x87,0x62,0xEA,0x00,0x62,0xE9,0x80,0x62,0xC9,0x07,0x62,0xE9,0x6A,0xE9,0x73,
+    0x09,0x7B,0x4A,0x83,0x8B,0x8B,0xAB,0x93,0xCB,0x93,0xCA,0x80,0x9B,0xCA,0x00,0x93,
+    0xAA,0x80,0x93,0xA9,0x00,0x93,0x88,0x80,0x8B,0x68,0x0D,0x8B,0x47,0x83,0x27,0x83,
+    0x06,0x7A,0xE5,0x7A,0xC5,0x82,0xE5,0x8B,0x26,0x93,0x67,0x9B,0xC8,0xAC,0x2B,0xBC,
+    0xAC,0xC4,0xEE,0xCD,0x0E,0xCD,0x4F,0x80,0xD5,0x70,0x06,0xD5,0x6F,0xC5,0x0F,0xB4,
+    0x6D,0x8B,0x69,0x62,0x45,0x41,0x82,0x39,0x62,0x80,0x31,0x42,0x84,0x31,0x63,0x09,
+    0x39,0x83,0x39,0xA3,0x49,0xC4,0x52,0x25,0x5A,0x05,0x6A,0x67,0x93,0x6A,0xAC,0x2D,
+    0xC4,0xCF,0xCD,0x10,0x83,0xCD,0x0F,0x80,0xCD,0x0E,0x00,0xD5,0x2E,0x81,0xD5,0x4F,
+    0x00,0xD5,0x2E,0x81,0xCD,0x0E,0x00,0xCD,0x2E,0x80,0xD5,0x2E,0x80,0xCD,0x2E,0x00,
+    0xCD,0x4E,0x81,0xD5,0x4E,0x07,0xCD,0x2E,0xCD,0x2F,0xC5,0x0F,0xC4,0xCE,0xB4,0x6D,
+    0xA4,0x0B,0x8B,0xAA,0x7B,0x08,0x80,0x72,0xC6,0x09,0x72,0xC7,0x7A,0xE7,0x83,0x29,
+    0x93,0x6A,0xA3,0xCB,0xB4,0x2D,0xBC,0x6E,0xC4,0xAE,0xC4,0xCE,0xCC,0xEE,0x80,0xCD,
+    0x0E,0x01,0xCD,0x2F,0xD5,0x2F,0x80,0xCD,0x2F,0x80,0xCD,0x50,0x06,0xC5,0x50,0xC5,
+    0x51,0xE6,0x96,0xF7,0x19,0xF7,0x3A,0xEF,0x5B,0x62,0xCA,0x87,0x62,0xEA,0x82,0x62,
+    0xE9,0x04,0x6B,0x09,0x73,0x09,0x7B,0x4A,0x83,0x6A,0x8B,0x8A,0x81,0x93,0xAA,0x82,
+    0x93,0xA9,0x05,0x93,0x89,0x8B,0x68,0x8B,0x47,0x83,0x27,0x83,0x06,0x7A,0xE5,0x80,
+    0x7A,0xC5,0x08,0x83,0x05,0x8B,0x46,0x93,0xA8,0xA3,0xE9,0xAC,0x2A,0xBC,0xAC,0xC4,
+    0xED,0xCD,0x0E,0xCD,0x4F,0x80,0xD5,0x70,0x06,0xD5,0x6F,0xC5,0x2E,0xBC,0xAE,0xA3,
+    0xEB,0x7A,0xC6,0x51,0xE3,0x39,0x62,0x80,0x31,0x42,0x81,0x31,0x63,0x80,0x31,0x43,
+    0x0A,0x31,0x63,0x39,0x84,0x41,0xC4,0x52,0x05,0x5A,0x25,0x5A,0x05,0x62,0x26,0x82,
+    0xC8,0x9B,0xCB,0xBC,0x6E,0xCC,0xEF,0x80,0xD5,0x30,0x00,0xD5,0x2F,0x81,0xCD,0x0F,
+    0x01,0xCD,0x2E,0xD5,0x2E,0x81,0xD5,0x4F,0x01,0xD5,0x2F,0xD5,0x2E,0x80,0xCD,0x0E,
+    0x81,0xD5,0x2E,0x19,0xCD,0x2E,0xD5,0x2E,0xD5,0x4F,0xD5,0x6F,0xD5,0x8F,0xD5,0x6F,
+    0xCD,0x4F,0xC5,0x0F,0xB4,0x6D,0x9B,0xCB,0x83,0x08,0x72,0xC7,0x62,0x86,0x5A,0x24,
+    0x49,0xC3,0x52,0x04,0x5A,0x45,0x62,0x86,0x72,0xC7,0x7B,0x08,0x8B,0x8A,0xA3,0xEC,
+    0xB4,0x4D,0xBC,0x8D,0xC4,0xAD,0xC4,0xEE,0x80,0xCD,0x0E,0x00,0xCD,0x2F,0x81,0xD5,
+    0x2F,0x08,0xD5,0x50,0xCD,0x70,0xCD,0x50,0xC5,0x51,0xE6,0x55,0xF7,0x18,0xF7,0x3A,
+    0xEF,0x5A,0x62,0xCA,0x88,0x62,0xEA,0x80,0x62,0xE9,0x80,0x6B,0x09,0x02,0x73,0x09,
+    0x7B,0x2A,0x83,0x6A,0x80,0x8B,0x8A,0x00,0x93,0x8A,0x80,0x93,0x89,0x00,0x93,0xA9,
+    0x80,0x9B,0xA9,0x04,0x93,0x89,0x93,0x68,0x8B,0x47,0x83,0x06,0x7A,0xE6,0x80,0x7A,
+    0xC5,0x09,0x7A,0xE5,0x83,0x26,0x93,0x67,0x9B,0xC8,0x9B,0xE9,0xA4,0x0A,0xB4,0x6B,
+    0xBC,0xCD,0xCD,0x0E,0xCD,0x4F,0x80,0xD5,0x70,0x06,0xD5,0x4F,0xCD,0x4F,0xC5,0x0E,
+    0xB4,0x6D,0x93,0x89,0x62,0x45,0x41,0xA3,0x80,0x31,0x42,0x80,0x31,0x43,0x00,0x39,
+    0x43,0x80,0x31,0x43,0x02,0x39,0x63,0x41,0xA4,0x52,0x05,0x80,0x5A,0x46,0x08,0x5A,
+    0x25,0x62,0x26,0x7A,0xA8,0x9B,0x8B,0xB4,0x6E,0xCC,0xF0,0xD5,0x30,0xD5,0x50,0xD5,
+    0x30,0x80,0xCD,0x0F,0x00,0xCD,0x2F,0x80,0xD5,0x2F,0x82,0xD5,0x4F,0x84,0xD5,0x2E,
+    0x80,0xCD,0x2E,0x01,0xD5,0x4F,0xD5,0x6F,0x80,0xD5,0x90,0x16,0xC5,0x0F,0xAC,0x4D,
+    0x83,0x29,0x6A,0x66,0x5A,0x25,0x62,0x66,0x6A,0xC7,0x62,0x86,0x52,0x04,0x52,0x25,
+    0x5A,0x45,0x62,0x87,0x72,0xC8,0x7B,0x09,0x8B,0x8A,0xA3,0xEB,0xB4,0x4D,0xBC,0x8D,
+    0xC4,0xCD,0xC4,0xEE,0xCC,0xEE,0xCD,0x0E,0xCD,0x0F,0x80,0xD5,0x2F,0x00,0xD5,0x50,
+    0x81,0xCD,0x50,0x05,0xCD,0x51,0xDE,0x14,0xF6,0xF8,0xF7,0x39,0xEF,0x3A,0x62,0xCA,
+    0x87,0x62,0xEA,0x81,0x6A,0xEA,0x80,0x6B,0x09,0x03,0x73,0x09,0x7B,0x29,0x83,0x4A,
+    0x83,0x6A,0x80,0x8B,0x49,0x09,0x8B,0x69,0x93,0x69,0x93,0x89,0x9B,0xA9,0x93,0xA9,
+    0x93,0x89,0x8B,0x68,0x83,0x47,0x7A,0xE6,0x7A,0xC6,0x80,0x7A,0xC5,0x03,0x83,0x06,
+    0x93,0x68,0x93,0x88,0x9B,0xA8,0x80,0x9B,0xC9,0x0F,0xAC,0x2A,0xB4,0x8C,0xBC,0xCD,
+    0xC4,0xEE,0xCD,0x2F,0xCD,0x4F,0xD5,0x4F,0xD5,0x6F,0xCD,0x4F,0xBC,0xEE,0xAC,0x4C,
+    0x83,0x48,0x5A,0x04,0x39,0x62,0x31,0x42,0x39,0x42,0x82,0x39,0x43,0x10,0x41,0x84,
+    0x51,0xE5,0x62,0x67,0x6A,0xA7,0x62,0x67,0x62,0x26,0x6A,0x46,0x7A,0xC8,0x9B,0x8A,
+    0xB4,0x4D,0xC4,0xCF,0xD5,0x30,0xD5,0x51,0xD5,0x50,0xD5,0x2F,0xCD,0x0F,0xD5,0x2F,
+    0x80,0xD5,0x2E,0x82,0xD5,0x4F,0x81,0xD5,0x2E,0x81,0xCD,0x2E,0x01,0xD5,0x4E,0xD5,
+    0x4F,0x81,0xDD,0x90,0x08,0xCD,0x50,0xA4,0x4C,0x83,0x28,0x62,0x04,0x51,0xC3,0x49,
+    0xA3,0x51,0xE4,0x5A,0x46,0x52,0x25,0x80,0x52,0x05,0x09,0x5A,0x46,0x6A,0xA8,0x7B,
+    0x2A,0x8B,0x8B,0x9B,0xCC,0xAC,0x2D,0xBC,0x8E,0xC4,0xAE,0xC4,0xCE,0xC4,0xEE,0x80,
+    0xCC,0xEE,0x00,0xCD,0x0F,0x80,0xD5,0x2F,0x01,0xD5,0x50,0xCD,0x4F,0x80,0xCD,0x50,
+    0x04,0xCD,0x51,0xDD,0xD3,0xEE,0xB7,0xF7,0x39,0xEF,0x3A,0x87,0x62,0xEA,0x81,0x6A,
+    0xEA,0x04,0x6B,0x0A,0x6A,0xEA,0x6B,0x09,0x73,0x09,0x7B,0x29,0x80,0x83,0x49,0x0A,
+    0x83,0x29,0x83,0x28,0x8B,0x28,0x8B,0x68,0x93,0x89,0x93,0xA9,0x93,0x89,0x8B,0x68,
+    0x83,0x48,0x83,0x27,0x7A,0xE6,0x80,0x7A,0xC6,0x03,0x7A,0xE6,0x8B,0x47,0x9B,0xA9,
+    0x93,0xA9,0x81,0x93,0x88,0x06,0x9B,0xC9,0xAC,0x2A,0xB4,0x4B,0xBC,0xAD,0xBC,0xCD,
+    0xC4,0xEE,0xCD,0x2F,0x80,0xCD,0x4F,0x06,0xC5,0x2E,0xBC,0xEE,0xAC,0x2B,0x7A,0xE7,
+    0x49,0xC3,0x39,0x41,0x39,0x42,0x80,0x39,0x62,0x0D,0x41,0x83,0x49,0xC4,0x5A,0x46,
+    0x72,0xE9,0x7B,0x09,0x72,0xC8,0x6A,0x87,0x6A,0x26,0x6A,0x46,0x7A,0xC8,0x93,0x8A,
+    0xB4,0x2D,0xC4,0xAF,0xD5,0x31,0x80,0xD5,0x71,0x00,0xD5,0x50,0x80,0xD5,0x2F,0x00,
+    0xD5,0x2E,0x80,0xD5,0x4E,0x81,0xD5,0x4F,0x00,0xD5,0x2F,0x80,0xD5,0x2E,0x80,0xCD,
+    0x2E,0x0A,0xCD,0x4E,0xD5,0x6F,0xDD,0x90,0xE5,0xB0,0xDD,0xB1,0xD5,0x91,0xB4,0xCE,
+    0x83,0x07,0x59,0xE3,0x49,0xA3,0x49,0xA4,0x80,0x49,0xC4,0x00,0x49,0xE5,0x80,0x49,
+    0xE4,0x11,0x49,0xE5,0x5A,0x26,0x72,0xE9,0x83,0x6B,0x93,0xCC,0xA4,0x2D,0xB4,0x8E,
+    0xC4,0xCF,0xCC,0xEF,0xC4,0xEE,0xC4,0xCE,0xC4,0xEE,0xCC,0xEE,0xCD,0x0E,0xD5,0x2F,
+    0xD5,0x50,0xCD,0x50,0xCD,0x30,0x80,0xCD,0x50,0x04,0xCD,0x51,0xD5,0xB2,0xE6,0x96,
+    0xEF,0x19,0xEF,0x5A,0x87,0x62,0xEA,0x81,0x6A,0xEA,0x80,0x6B,0x0A,0x03,0x6B,0x09,
+    0x73,0x09,0x7B,0x09,0x7B,0x28,0x80,0x7B,0x08,0x03,0x82,0xE8,0x83,0x08,0x83,0x28,
+    0x8B,0x68,0x80,0x8B,0x69,0x13,0x83,0x28,0x83,0x07,0x7B,0x07,0x7A,0xE6,0x7A,0xC6,
+    0x7A,0xE6,0x83,0x27,0x93,0x88,0x9B,0xC9,0x9B,0xA9,0x93,0x88,0x8B,0x67,0x8B,0x47,
+    0x93,0x68,0x9B,0xC9,0xA4,0x0A,0xB4,0x4B,0xB4,0x6C,0xBC,0xAD,0xBC,0xCD,0x82,0xC5,
+    0x0E,0x1A,0xBC,0xCD,0xA3,0xEB,0x72,0xA6,0x51,0xE3,0x49,0xA2,0x49,0xA3,0x49,0xE4,
+    0x5A,0x45,0x6A,0xE8,0x83,0x8A,0x8B,0xCC,0x8B,0x8A,0x7A,0xE9,0x72,0x87,0x6A,0x66,
+    0x72,0x87,0x83,0x08,0x93,0x8A,0xAC,0x0C,0xBC,0x8E,0xD5,0x30,0xDD,0x72,0xDD,0x71,
+    0xD5,0x50,0xD5,0x30,0xD5,0x2F,0xD5,0x4F,0x80,0xD5,0x4E,0x81,0xD5,0x4F,0x80,0xD5,
+    0x2F,0x80,0xD5,0x2E,0x0C,0xCD,0x2E,0xCD,0x4E,0xD5,0x6F,0xDD,0xB0,0xE5,0xD1,0xDD,
+    0xB1,0xCD,0x50,0x93,0xAA,0x62,0x24,0x49,0xA3,0x49,0xA4,0x49,0xC4,0x49,0xA4,0x80,
+    0x49,0xA5,0x13,0x49,0xC4,0x49,0xA4,0x49,0xC4,0x52,0x26,0x73,0x0A,0x93,0xAC,0x9C,
+    0x0D,0xB4,0x8E,0xBC,0xCF,0xCD,0x30,0xD5,0x30,0xCD,0x2F,0xCC,0xEE,0xC4,0xEE,0xCC,
+    0xEE,0xCD,0x0E,0xCD,0x0F,0xD5,0x30,0xCD,0x30,0xCD,0x2F,0x81,0xCD,0x50,0x03,0xD5,
+    0x92,0xE6,0x75,0xEF,0x19,0xEF,0x3A,0x87,0x62,0xEA,0x81,0x6A,0xEA,0x01,0x6B,0x0A,
+    0x6A,0xEA,0x80,0x6A,0xE9,0x06,0x73,0x08,0x7B,0x08,0x72,0xE7,0x7A,0xE7,0x7A,0xC7,
+    0x82,0xE7,0x83,0x28,0x80,0x8B,0x28,0x00,0x83,0x28,0x80,0x7A,0xE7,0x81,0x7A,0xE6,
+    0x0C,0x83,0x07,0x8B,0x68,0x93,0xA9,0x9B,0xC9,0x9B,0xA9,0x93,0x88,0x8B,0x67,0x8B,
+    0x27,0x8B,0x47,0x93,0x88,0x9B,0xC9,0xA4,0x0A,0xAC,0x4C,0x80,0xB4,0x8C,0x00,0xBC,
+    0xAD,0x80,0xBC,0xCD,0x1B,0xBC,0xEE,0xC4,0xEE,0xB4,0xAD,0x9C,0x0B,0x83,0x48,0x72,
+    0xE7,0x72,0xC7,0x73,0x08,0x8B,0x8A,0x9C,0x0C,0xA4,0x4D,0x9C,0x2C,0x93,0xAB,0x83,
+    0x49,0x7A,0xC8,0x7A,0xA7,0x82,0xE8,0x93,0x49,0x93,0x8A,0xA3,0xCB,0xB4,0x4D,0xCC,
+    0xF0,0xD5,0x51,0xDD,0x71,0xD5,0x50,0xD5,0x30,0xD5,0x2F,0xD5,0x4F,0x80,0xD5,0x4E,
+    0x85,0xD5,0x4F,0x02,0xCD,0x2E,0xD5,0x4F,0xD5,0x6F,0x80,0xDD,0xB0,0x03,0xDD,0x90,
+    0xBC,0xAD,0x7A,0xC6,0x51,0xC3,0x80,0x49,0xA4,0x81,0x49,0xA5,0x0E,0x49,0xA4,0x49,
+    0xA5,0x41,0xA4,0x49,0xA5,0x5A,0x47,0x83,0x6B,0x9B,0xED,0xA4,0x4E,0xB4,0xAF,0xC5,
+    0x10,0xD5,0x51,0xD5,0x71,0xD5,0x50,0xCD,0x2F,0xCD,0x0F,0x80,0xCD,0x0E,0x80,0xCD,
+    0x0F,0x81,0xCD,0x2F,0x80,0xCD,0x30,0x03,0xCD,0x72,0xDE,0x35,0xEE,0xF8,0xEF,0x3A,
+    0x87,0x62,0xEA,0x82,0x6A,0xEA,0x03,0x6A,0xE9,0x62,0xE9,0x62,0xC8,0x6A,0xC7,0x80,
+    0x72,0xC7,0x02,0x72,0xA7,0x7A,0xA7,0x7A,0xC7,0x80,0x7A,0xE7,0x01,0x7A,0xC7,0x7A,
+    0xC6,0x80,0x72,0xA6,0x00,0x72,0xC6,0x80,0x7A,0xE6,0x02,0x83,0x27,0x8B,0x88,0x9B,
+    0xA9,0x80,0x9B,0xC9,0x08,0x93,0x88,0x8B,0x47,0x8B,0x27,0x8B,0x47,0x93,0x68,0x93,
+    0x88,0x9B,0xC9,0xAC,0x0A,0xAC,0x4B,0x80,0xB4,0x6C,0x80,0xB4,0x8C,0x00,0xBC,0xAD,
+    0x80,0xBC,0xEE,0x01,0xBC,0xCE,0xAC,0x8D,0x80,0xA4,0x4C,0x00,0xA4,0x2C,0x80,0xA4,
+    0x4C,0x03,0xA4,0x2C,0x9C,0x0C,0x9B,0xCB,0x93,0xAA,0x80,0x8B,0x49,0x09,0x93,0x6A,
+    0x9B,0xAB,0x9B,0xAA,0x9B,0x8A,0xAC,0x0C,0xC4,0xAF,0xD5,0x51,0xDD,0x71,0xD5,0x50,
+    0xD5,0x2F,0x80,0xD5,0x4F,0x80,0xD5,0x4E,0x87,0xD5,0x4F,0x07,0xD5,0x8F,0xDD,0xB0,
+    0xDD,0x90,0xCD,0x4F,0xA4,0x0B,0x6A,0x45,0x51,0xA3,0x49,0x84,0x81,0x49,0xA4,0x0B,
+    0x49,0xC5,0x49,0xA4,0x41,0xA4,0x49,0xC5,0x52,0x06,0x6A,0xC9,0x8B,0xCD,0x9C,0x2E,
+    0xA4,0x4E,0xB4,0xAF,0xC5,0x10,0xD5,0x71,0x80,0xDD,0x91,0x04,0xD5,0x70,0xD5,0x2F,
+    0xCD,0x2F,0xCD,0x0E,0xCC,0xEE,0x80,0xCD,0x0F,0x81,0xCD,0x2F,0x04,0xC5,0x30,0xCD,
+    0x51,0xDE,0x14,0xE6,0xD7,0xEF,0x3A,0x87,0x62,0xEA,0x82,0x6A,0xEA,0x02,0x62,0xC9,
+    0x62,0xA8,0x5A,0x86,0x80,0x62,0x86,0x02,0x6A,0x86,0x6A,0x66,0x72,0x66,0x83,0x72,
+    0x86,0x80,0x72,0xA6,0x05,0x7A,0xE6,0x7B,0x07,0x8B,0x48,0x93,0x89,0x93,0xA9,0x9B,
+    0xC9,0x80,0x9B,0xEA,0x08,0x93,0xA9,0x8B,0x68,0x83,0x27,0x83,0x06,0x83,0x27,0x8B,
+    0x47,0x93,0x88,0x9B,0xC9,0xA4,0x0A,0x80,0xAC,0x4B,0x05,0xB4,0x6B,0xB4,0x6C,0xB4,
+    0x8C,0xBC,0xCD,0xBC,0xEE,0xC4,0xEE,0x80,0xBC,0xCD,0x00,0xB4,0x8C,0x80,0xAC,0x4C,
+    0x01,0xA4,0x0B,0xA3,0xEB,0x80,0x9B,0xEB,0x0B,0xA3,0xEB,0x9B,0xEB,0xA3,0xEB,0xA3,
+    0xCB,0xAB,0xEB,0xA3,0xCB,0x9B,0x8A,0xAB,0xEB,0xBC,0x8D,0xCD,0x10,0xD5,0x50,0xD5,
+    0x30,0x80,0xD5,0x2F,0x80,0xD5,0x2E,0x00,0xD5,0x4E,0x80,0xD5,0x2F,0x80,0xD5,0x2E,
+    0x80,0xD5,0x2F,0x81,0xD5,0x4F,0x08,0xD5,0x8F,0xDD,0x8F,0xD5,0x6F,0xC4,0xEE,0xA4,
+    0x0B,0x7A,0xE7,0x59,0xE4,0x49,0xA3,0x49,0x84,0x81,0x41,0xA4,0x80,0x49,0xC4,0x08,
+    0x49,0xE5,0x62,0xA8,0x83,0x8B,0x9C,0x4E,0xA4,0x4E,0xAC,0x6D,0xB4,0xAE,0xC4,0xEF,
+    0xD5,0x71,0x80,0xDD,0x91,0x07,0xDD,0x70,0xD5,0x50,0xD5,0x2F,0xCD,0x0E,0xC4,0xEE,
+    0xCC,0xEE,0xCD,0x0E,0xCD,0x0F,0x80,0xCD,0x2F,0x04,0xC5,0x0F,0xCD,0x50,0xD5,0xD3,
+    0xE6,0xB7,0xEF,0x39,0x83,0x62,0xEA,0x81,0x63,0x0A,0x83,0x6A,0xEA,0x02,0x62,0xC9,
+    0x5A,0xA7,0x52,0x66,0x81,0x5A,0x45,0x80,0x62,0x25,0x80,0x6A,0x45,0x80,0x6A,0x66,
+    0x05,0x6A,0x86,0x72,0xA6,0x72,0xC6,0x7B,0x07,0x83,0x48,0x93,0xA9,0x83,0x9B,0xEA,
+    0x02,0x9B,0xA9,0x93,0x88,0x83,0x27,0x81,0x83,0x06,0x09,0x8B,0x27,0x93,0x88,0x9B,
+    0xC9,0xAC,0x0A,0xAC,0x2A,0xAC,0x4B,0xB4,0x4B,0xB4,0x6C,0xBC,0xAD,0xBC,0xCD,0x80,
+    0xC4,0xEE,0x04,0xC4,0xCD,0xBC,0xCD,0xB4,0x8D,0xB4,0x8C,0xAC,0x6C,0x81,0xAC,0x2B,
+    0x81,0xAC,0x2C,0x80,0xAC,0x0B,0x04,0xA3,0xEB,0x9B,0xAA,0xA3,0xCA,0xB4,0x4C,0xC4,
+    0xCE,0x80,0xCD,0x0F,0x07,0xD5,0x0F,0xD5,0x0E,0xD5,0x2E,0xD5,0x0E,0xD5,0x2E,0xD5,
+    0x0E,0xCC,0xEE,0xCC,0xED,0x81,0xCD,0x0E,0x80,0xD5,0x2F,0x08,0xCD,0x4E,0xD5,0x6F,
+    0xD5,0x8F,0xCD,0x4F,0xBC,0xCD,0xB4,0x4C,0x9B,0xCA,0x72,0xA7,0x59,0xE4,0x81,0x49,
+    0xA4,0x14,0x41,0xA4,0x49,0xC4,0x52,0x05,0x62,0x87,0x83,0x8B,0x9C,0x2D,0xA4,0x4E,
+    0xA4,0x4D,0xAC,0x6D,0xB4,0xAE,0xC5,0x0F,0xD5,0x70,0xDD,0x71,0xDD,0x91,0xDD,0x70,
+    0xD5,0x70,0xD5,0x4F,0xCD,0x0F,0xC4,0xEE,0xCC,0xEE,0xC4,0xEE,0x80,0xCD,0x0E,0x05,
+    0xCD,0x2F,0xC5,0x2F,0xCD,0x50,0xD5,0xB3,0xE6,0x97,0xEF,0x39,0x87,0x63,0x0A,0x81,
+    0x6A,0xEA,0x03,0x6A,0xE9,0x62,0xC9,0x5A,0x87,0x52,0x45,0x82,0x5A,0x25,0x80,0x62,
+    0x25,0x08,0x6A,0x45,0x6A,0x65,0x6A,0x66,0x72,0x86,0x72,0xA6,0x7A,0xE7,0x83,0x48,
+    0x8B,0x69,0x93,0xAA,0x83,0x9B,0xEA,0x03,0x9B,0xCA,0x93,0xA9,0x83,0x27,0x82,0xE6,
+    0x80,0x7A,0xE6,0x0C,0x83,0x07,0x8B,0x47,0x93,0x88,0xA3,0xC9,0xAC,0x0A,0xAC,0x2B,
+    0xB4,0x4B,0xB4,0x6C,0xBC,0x8C,0xBC,0xAD,0xC4,0xCE,0xC4,0xEE,0xCD,0x0F,0x81,0xCD,
+    0x2F,0x15,0xCD,0x0F,0xC4,0xEE,0xBC,0xAE,0xBC,0x8D,0xB4,0x6C,0xB4,0x4C,0xAC,0x0B,
+    0xAB,0xEB,0xA3,0xCA,0xA3,0xAA,0x9B,0x89,0xA3,0xAA,0xAC,0x0B,0xBC,0x8D,0xC4,0xAE,
+    0xC4,0xCE,0xCC,0xCE,0xCC,0xCD,0xCC,0xED,0xCC,0xCD,0xCC,0xED,0xCC,0xCD,0x81,0xC4,
+    0xCD,0x02,0xCC,0xED,0xCC,0xEE,0xCD,0x0E,0x80,0xCD,0x2E,0x09,0xCD,0x4E,0xD5,0x4E,
+    0xC5,0x0D,0xBC,0xAC,0xB4,0x8C,0xAC,0x4C,0x93,0xCA,0x7A,0xE7,0x62,0x25,0x52,0x04,
+    0x80,0x51,0xE4,0x09,0x5A,0x25,0x6A,0xE8,0x8B,0xCB,0xA4,0x8E,0xA4,0x6E,0x9C,0x0C,
+    0xA4,0x4C,0xB4,0xAD,0xC5,0x0F,0xCD,0x50,0x80,0xD5,0x70,0x80,0xDD,0x90,0x0D,0xD5,
+    0x70,0xD5,0x4F,0xCD,0x0F,0xC4,0xEE,0xCC,0xEE,0xC4,0xEE,0xCD,0x0E,0xC5,0x0E,0xCD,
+    0x0F,0xC5,0x0F,0xCD,0x30,0xD5,0x92,0xE6,0x96,0xEF,0x39,0x87,0x63,0x0A,0x82,0x6A,
+    0xEA,0x02,0x62,0xC9,0x5A,0x87,0x5A,0x46,0x81,0x5A,0x25,0x80,0x62,0x25,0x09,0x6A,
+    0x45,0x6A,0x66,0x6A,0x86,0x6A,0x66,0x72,0x86,0x72,0xC7,0x83,0x08,0x8B,0x89,0x93,
+    0xAA,0x9B,0xCA,0x84,0x9B,0xEA,0x0A,0x9B,0xC9,0x8B,0x48,0x83,0x06,0x7A,0xC6,0x7A,
+    0xE6,0x83,0x06,0x8B,0x48,0x93,0x68,0x9B,0xC9,0xA4,0x0A,0xAC,0x2A,0x80,0xB4,0x4B,
+    0x05,0xBC,0x6C,0xBC,0x8C,0xC4,0xAD,0xC4,0xCE,0xCD,0x0E,0xD5,0x4F,0x81,0xDD,0x70,
+    0x07,0xD5,0x70,0xD5,0x2F,0xCC,0xEE,0xBC,0x8D,0xAC,0x2B,0xA3,0xEA,0xA3,0xCA,0x9B,
+    0x89,0x80,0x9B,0x69,0x02,0x9B,0x89,0xA3,0xCB,0xB4,0x4C,0x80,0xBC,0x6D,0x80,0xC4,
+    0x8C,0x83,0xC4,0xAC,0x03,0xC4,0x8C,0xC4,0xAC,0xC4,0xCD,0xCC,0xED,0x80,0xCD,0x0E,
+    0x80,0xCD,0x2E,0x02,0xCD,0x0D,0xBC,0xAC,0xBC,0x8C,0x80,0xB4,0x8C,0x07,0xAC,0x6C,
+    0x9B,0xEB,0x83,0x29,0x72,0xE7,0x72,0xC7,0x72,0xE8,0x83,0x69,0x9C,0x2D,0x80,0xAC,
+    0xCF,0x04,0x9C,0x4D,0x9C,0x2C,0xAC,0x8D,0xBD,0x0E,0xCD,0x70,0x81,0xD5,0x70,0x80,
+    0xDD,0x70,0x02,0xD5,0x70,0xD5,0x4F,0xCD,0x0E,0x80,0xCC,0xEE,0x02,0xC4,0xEE,0xCC,
+    0xEE,0xC5,0x0E,0x80,0xC5,0x0F,0x03,0xC5,0x10,0xCD,0x71,0xE6,0x96,0xEF,0x39,0x83,
+    0x63,0x0A,0x86,0x6B,0x0A,0x02,0x62,0xC9,0x5A,0x87,0x5A,0x46,0x80,0x5A,0x25,0x0B,
+    0x62,0x45,0x62,0x46,0x6A,0x46,0x6A,0x66,0x72,0xA6,0x72,0xA7,0x72,0xA6,0x72,0xC7,
+    0x7A,0xE7,0x83,0x48,0x93,0xAA,0x93,0xCA,0x80,0x9B,0xEB,0x83,0x9B,0xEA,0x02,0x93,
+    0xAA,0x8B,0x48,0x83,0x07,0x80,0x7A,0xC6,0x05,0x83,0x07,0x8B,0x48,0x93,0x88,0x9B,
+    0xC9,0xA4,0x0A,0xAC,0x2A,0x80,0xB4,0x4B,0x80,0xBC,0x6C,0x04,0xC4,0xAD,0xC4,0xCD,
+    0xCC,0xEE,0xD5,0x2F,0xDD,0x70,0x81,0xDD,0x90,0x07,0xDD,0x70,0xD5,0x2F,0xBC,0xAD,
+    0xB4,0x2B,0xA3,0xEA,0xA3,0xA9,0x9B,0x89,0x9B,0x69,0x80,0x9B,0x89,0x02,0xA3,0xCA,
+    0xAC,0x0B,0xB4,0x2C,0x80,0xBC,0x4C,0x01,0xBC,0x6B,0xC4,0x8C,0x80,0xC4,0xAC,0x81,
+    0xC4,0x8C,0x03,0xC4,0xAC,0xC4,0xAD,0xCC,0xCD,0xCC,0xEE,0x80,0xCD,0x0E,0x01,0xCD,
+    0x0D,0xC4,0xCD,0x82,0xBC,0x8C,0x02,0xBC,0x8D,0xB4,0x6D,0xAC,0x4D,0x80,0xA4,0x4D,
+    0x03,0xAC,0x6D,0xAC,0xAE,0xB4,0xCF,0xAC,0xAE,0x80,0xA4,0x6D,0x03,0xB4,0xAE,0xBD,
+    0x0F,0xC5,0x2F,0xCD,0x4F,0x80,0xD5,0x6F,0x80,0xD5,0x70,0x03,0xD5,0x4F,0xDD,0x6F,
+    0xD5,0x4F,0xCD,0x0E,0x80,0xCC,0xEE,0x80,0xC4,0xEE,0x07,0xC5,0x0F,0xCD,0x0F,0xC5,
+    0x0F,0xC5,0x10,0xCD,0x71,0xE6,0x96,0xEF,0x39,0x63,0x0A,0x8A,0x6B,0x0A,0x02,0x62,
+    0xC8,0x5A,0x87,0x5A,0x46,0x80,0x5A,0x25,0x03,0x5A,0x45,0x62,0x66,0x6A,0x86,0x72,
+    0xA7,0x80,0x72,0xE7,0x80,0x7A,0xE7,0x03,0x83,0x28,0x8B,0x69,0x93,0xAA,0x9B,0xEA,
+    0x81,0x9B,0xEB,0x00,0x9B,0xCA,0x80,0x9B,0xEA,0x03,0x9B,0xCA,0x93,0xAA,0x8B,0x68,
+    0x83,0x07,0x80,0x7A,0xC6,0x07,0x82,0xE7,0x83,0x27,0x93,0x68,0x93,0xA9,0xA4,0x0A,
+    0xAC,0x2A,0xB4,0x4B,0xB4,0x6B,0x80,0xBC,0x6C,0x04,0xBC,0x8C,0xC4,0xAD,0xCC,0xEE,
+    0xD5,0x2F,0xD5,0x6F,0x81,0xDD,0x70,0x06,0xDD,0x6F,0xD5,0x2F,0xC4,0xAD,0xB4,0x4B,
+    0xAB,0xEA,0xA3,0xCA,0xA3,0xA9,0x81,0x9B,0x89,0x01,0xA3,0xAA,0xAB,0xEB,0x81,0xB4,
+    0x0B,0x01,0xBC,0x2B,0xC4,0x6C,0x84,0xC4,0x8C,0x01,0xC4,0xAD,0xCC,0xCD,0x81,0xCC,
+    0xED,0x01,0xC4,0xED,0xBC,0xAC,0x82,0xBC,0x8C,0x00,0xBC,0xAD,0x80,0xBC,0xAE,0x04,
+    0xBC,0xCF,0xBC,0xEF,0xBC,0xCF,0xB4,0xAE,0xB4,0x8D,0x80,0xAC,0x8D,0x00,0xBC,0xEE,
+    0x80,0xC5,0x2F,0x01,0xC5,0x2E,0xC5,0x0E,0x80,0xCD,0x2E,0x02,0xD5,0x2F,0xD5,0x4F,
+    0xD5,0x2F,0x80,0xD5,0x4F,0x81,0xCD,0x0E,0x81,0xC4,0xEE,0x06,0xCD,0x0F,0xC5,0x0F,
+    0xC5,0x10,0xC5,0x51,0xDE,0x76,0xEF,0x39,0x63,0x0A,0x8A,0x6B,0x0A,0x08,0x6A,0xC9,
+    0x62,0x87,0x5A,0x46,0x5A,0x45,0x5A,0x25,0x5A,0x45,0x62,0x66,0x72,0xA7,0x72,0xE7,
+    0x82,0x7B,0x08,0x03,0x83,0x49,0x8B,0x69,0x93,0xAA,0x93,0xCA,0x80,0x9B,0xEA,0x01,
+    0x9B,0xCA,0x93,0xCA,0x81,0x9B,0xCA,0x0A,0x93,0xAA,0x8B,0x69,0x83,0x28,0x7A,0xE7,
+    0x7A,0xC6,0x7A,0xE6,0x83,0x07,0x8B,0x27,0x93,0x88,0x9B,0xE9,0xAC,0x2A,0x80,0xB4,
+    0x4B,0x80,0xBC,0x6C,0x0F,0xBC,0x8C,0xC4,0xAD,0xC4,0xCE,0xCD,0x0E,0xD5,0x4F,0xD5,
+    0x50,0xD5,0x4F,0xD5,0x6F,0xD5,0x4F,0xD5,0x0E,0xC4,0xAD,0xBC,0x6C,0xAC,0x0B,0xAB,
+    0xEA,0xA3,0xCA,0xA3,0x89,0x80,0x9B,0x89,0x01,0xA3,0x89,0xAB,0xCA,0x80,0xAB,0xEA,
+    0x02,0xB4,0x0A,0xBC,0x2B,0xBC,0x6C,0x84,0xC4,0x8C,0x00,0xC4,0xAD,0x82,0xC4,0xCD,
+    0x02,0xBC,0xAC,0xBC,0x6B,0xB4,0x6B,0x80,0xBC,0x6C,0x03,0xBC,0x8C,0xC4,0xAD,0xC4,
+    0xCE,0xC4,0xEE,0x81,0xC4,0xEF,0x80,0xC4,0xEE,0x04,0xC5,0x2F,0xCD,0x70,0xCD,0x4F,
+    0xC5,0x2F,0xC5,0x0E,0x82,0xC4,0xED,0x80,0xCD,0x0E,0x81,0xCD,0x2E,0x81,0xCD,0x0E,
+    0x08,0xC4,0xED,0xC4,0xCD,0xC4,0xEE,0xCD,0x0F,0xC5,0x0F,0xC5,0x10,0xC5,0x51,0xDE,
+    0x55,0xEF,0x39,0x83,0x6B,0x0A,0x81,0x6B,0x2A,0x83,0x6B,0x0A,0x03,0x6A,0xE9,0x62,
+    0xA8,0x62,0x66,0x5A,0x46,0x80,0x5A,0x45,0x02,0x62,0x66,0x6A,0xA7,0x72,0xE7,0x82,
+    0x7B,0x08,0x02,0x83,0x49,0x8B,0x69,0x93,0xAA,0x82,0x93,0xCA,0x81,0x93,0xAA,0x05,
+    0x93,0xA9,0x8B,0x89,0x8B,0x69,0x83,0x28,0x83,0x07,0x7B,0x07,0x81,0x83,0x07,0x0B,
+    0x8B,0x47,0x93,0x88,0xA3,0xE9,0xAC,0x2A,0xB4,0x4B,0xB4,0x4C,0xB4,0x6C,0xBC,0x8C,
+    0xC4,0xAD,0xC4,0xCD,0xCC,0xEE,0xCD,0x2E,0x82,0xD5,0x2F,0x06,0xCD,0x0E,0xCC,0xCD,
+    0xBC,0x8C,0xB4,0x4B,0xB4,0x0B,0xAB,0xEA,0xA3,0xA9,0x81,0xA3,0x89,0x00,0xAB,0xA9,
+    0x80,0xAB,0xCA,0x02,0xB3,0xEA,0xB4,0x2B,0xBC,0x6B,0x83,0xC4,0x8C,0x00,0xC4,0xAC,
+    0x80,0xC4,0xAD,0x0C,0xC4,0xCD,0xC4,0xAD,0xC4,0xAC,0xBC,0x8C,0xB4,0x6B,0xB4,0x4B,
+    0xB4,0x6B,0xBC,0x6C,0xBC,0x8C,0xC4,0xEE,0xCD,0x0E,0xCD,0x2F,0xD5,0x70,0x80,0xDD,
+    0x71,0x01,0xDD,0x91,0xDD,0x90,0x80,0xD5,0x90,0x02,0xCD,0x4F,0xCD,0x2E,0xC5,0x0E,
+    0x81,0xBC,0xCD,0x01,0xC4,0xCD,0xCC,0xEE,0x83,0xCD,0x0E,0x04,0xCD,0x2E,0xC5,0x0E,
+    0xC4,0xED,0xC4,0xCD,0xC4,0xEE,0x80,0xC5,0x0F,0x03,0xC5,0x10,0xC5,0x51,0xDE,0x55,
+    0xEF,0x19,0x81,0x6B,0x0B,0x00,0x6B,0x2B,0x82,0x6B,0x2A,0x83,0x6B,0x0A,0x0A,0x6B,
+    0x09,0x6A,0xC8,0x62,0x87,0x5A,0x66,0x5A,0x46,0x5A,0x45,0x62,0x46,0x62,0x66,0x6A,
+    0xA7,0x72,0xE7,0x7A,0xE8,0x80,0x7B,0x08,0x02,0x83,0x28,0x8B,0x49,0x93,0x8A,0x80,
+    0x93,0xAA,0x01,0x93,0x8A,0x8B,0x6A,0x82,0x8B,0x69,0x00,0x83,0x49,0x84,0x83,0x28,
+    0x0D,0x8B,0x48,0x8B,0x47,0x93,0x68,0x9B,0xA9,0xAC,0x0A,0xB4,0x2B,0xB4,0x4B,0xB4,
+    0x4C,0xBC,0x6C,0xBC,0xAD,0xC4,0xCD,0xCC,0xEE,0xCD,0x0E,0xD5,0x0F,0x80,0xD5,0x2F,
+    0x80,0xD5,0x0E,0x0E,0xCC,0xCD,0xC4,0xAD,0xBC,0x6C,0xB4,0x2B,0xB4,0x0A,0xAB,0xCA,
+    0xA3,0xA9,0xA3,0x89,0xA3,0x69,0xA3,0x89,0xAB,0xA9,0xAB,0xCA,0xAB,0xEA,0xB4,0x2B,
+    0xBC,0x6B,0x82,0xC4,0x8C,0x00,0xC4,0xAC,0x80,0xC4,0xAD,0x02,0xC4,0xCD,0xC4,0xAD,
+    0xC4,0xAC,0x80,0xBC,0x8C,0x07,0xB4,0x6B,0xB4,0x4B,0xB4,0x6B,0xBC,0x8C,0xC4,0xAD,
+    0xCC,0xEE,0xD5,0x2F,0xDD,0x70,0x82,0xDD,0x91,0x06,0xDD,0x90,0xD5,0x90,0xD5,0x70,
+    0xCD,0x4F,0xCD,0x2E,0xC4,0xED,0xC4,0xCD,0x80,0xBC,0xAC,0x01,0xC4,0xCD,0xCC,0xED,
+    0x81,0xCD,0x0E,0x06,0xCD,0x2E,0xCD,0x0E,0xCD,0x2E,0xC5,0x2E,0xC4,0xED,0xBC,0xCD,
+    0xBC,0xCE,0x80,0xC4,0xEF,0x03,0xBC,0xF0,0xBD,0x30,0xD6,0x35,0xEF,0x19,0x82,0x6B,
+    0x0B,0x82,0x6B,0x2A,0x83,0x6B,0x0A,0x0A,0x6B,0x09,0x6A,0xE8,0x62,0xA7,0x62,0x86,
+    0x62,0x66,0x5A,0x46,0x5A,0x45,0x62,0x66,0x6A,0x86,0x72,0xC7,0x72,0xE7,0x80,0x7A,
+    0xE8,0x05,0x7B,0x08,0x83,0x28,0x8B,0x49,0x8B,0x69,0x8B,0x49,0x83,0x49,0x83,0x83,
+    0x28,0x81,0x7B,0x08,0x04,0x83,0x28,0x83,0x48,0x8B,0x68,0x8B,0x69,0x8B,0x68,0x80,
+    0x93,0x88,0x01,0x9B,0xA9,0xAC,0x0A,0x80,0xB4,0x2B,0x05,0xB4,0x4B,0xBC,0x6C,0xBC,
+    0xAD,0xC4,0xAD,0xC4,0xEE,0xCD,0x0E,0x80,0xD5,0x0F,0x15,0xD5,0x2F,0xD5,0x0E,0xD4,
+    0xED,0xCC,0xED,0xCC,0xCD,0xC4,0x8C,0xBC,0x4B,0xB4,0x0A,0xAB,0xCA,0xA3,0xA9,0xA3,
+    0x89,0xA3,0x68,0xA3,0x89,0xA3,0xA9,0xAB,0xA9,0xAB,0xEA,0xB4,0x0A,0xBC,0x4B,0xBC,
+    0x6C,0xC4,0x6C,0xC4,0x8C,0xC4,0xAC,0x80,0xC4,0xAD,0x80,0xC4,0xCD,0x80,0xC4,0xAC,
+    0x01,0xC4,0x8C,0xBC,0x8C,0x80,0xB4,0x4B,0x05,0xB4,0x6B,0xBC,0x8C,0xC4,0xAD,0xCD,
+    0x0E,0xD5,0x4F,0xDD,0x90,0x81,0xDD,0xB1,0x07,0xDD,0x91,0xDD,0x90,0xD5,0x6F,0xD5,
+    0x4F,0xCD,0x2E,0xC5,0x0D,0xC4,0xED,0xC4,0xCD,0x80,0xBC,0xAC,0x01,0xC4,0xAC,0xC4,
+    0xED,0x81,0xCD,0x0E,0x80,0xCD,0x2E,0x80,0xC5,0x2E,0x01,0xBC,0xED,0xBC,0xCD,0x80,
+    0xB4,0xAE,0x04,0xBC,0xAF,0xB4,0xAE,0xAC,0xAF,0xCD,0xD3,0xE7,0x19,0x82,0x6B,0x0B,
+    0x80,0x6B,0x0A,0x83,0x6B,0x2A,0x80,0x6B,0x0A,0x04,0x6B,0x09,0x6A,0xE8,0x6A,0xC8,
+    0x62,0xA7,0x62,0x86,0x80,0x62,0x66,0x02,0x62,0x86,0x6A,0xA7,0x72,0xE7,0x82,0x7B,
+    0x08,0x05,0x83,0x08,0x83,0x28,0x83,0x49,0x83,0x28,0x83,0x08,0x7B,0x08,0x83,0x7B,
+    0x07,0x81,0x7A,0xE7,0x00,0x7B,0x07,0x80,0x83,0x48,0x0C,0x8B,0x69,0x93,0xA9,0x9B,
+    0xA9,0xA3,0xC9,0xAB,0xEA,0xAC,0x0A,0xAC,0x0B,0xB4,0x2B,0xBC,0x6C,0xBC,0x8D,0xC4,
+    0xAD,0xC4,0xCE,0xCC,0xEE,0x80,0xD5,0x0F,0x01,0xD5,0x2F,0xD5,0x0E,0x80,0xD4,0xED,
+    0x05,0xCC,0xED,0xC4,0xAC,0xBC,0x6B,0xB4,0x2A,0xAB,0xEA,0xAB,0xA9,0x81,0xA3,0x89,
+    0x80,0xA3,0xA9,0x06,0xAB,0xC9,0xAB,0xEA,0xBC,0x4B,0xBC,0x6B,0xC4,0x6C,0xC4,0x8C,
+    0xC4,0xAC,0x80,0xC4,0xAD,0x01,0xC4,0xCD,0xC4,0xAD,0x81,0xC4,0xAC,0x00,0xBC,0x6C,
+    0x80,0xB4,0x4B,0x05,0xBC,0x6B,0xBC,0x8C,0xC4,0xCD,0xCD,0x0E,0xD5,0x4F,0xDD,0x70,
+    0x81,0xDD,0x90,0x03,0xDD,0x70,0xD5,0x6F,0xD5,0x4F,0xCD,0x2E,0x80,0xC4,0xED,0x81,
+    0xC4,0xCD,0x05,0xBC,0xAC,0xC4,0xAC,0xC4,0xCD,0xCC,0xED,0xCD,0x0E,0xCD,0x2E,0x81,
+    0xCD,0x4E,0x02,0xC5,0x0E,0xBC,0xED,0xBC,0xCD,0x80,0xB4,0xAE,0x04,0xAC,0x8D,0xA4,
+    0x4D,0x9C,0x4E,0xBD,0x73,0xE6,0xF9,0x82,0x6B,0x0B,0x80,0x6B,0x0A,0x83,0x6B,0x2A,
+    0x80,0x6B,0x0A,0x02,0x6B,0x09,0x6A,0xE8,0x6A,0xC8,0x80,0x62,0xA7,0x80,0x62,0x86,
+    0x01,0x6A,0xA7,0x72,0xC7,0x80,0x7B,0x08,0x00,0x7B,0x28,0x81,0x7B,0x08,0x03,0x83,
+    0x28,0x83,0x08,0x7B,0x08,0x7A,0xE7,0x80,0x7A,0xC7,0x81,0x7A,0xE7,0x13,0x72,0xE7,
+    0x72,0xC7,0x72,0xC6,0x6A,0xA6,0x72,0xA6,0x72,0xC6,0x7B,0x07,0x83,0x48,0x8B,0x68,
+    0x93,0x89,0x9B,0xA9,0xA3,0xC9,0xA3,0xCA,0xAB,0xEA,0xAC,0x0B,0xB4,0x4C,0xBC,0x6C,
+    0xBC,0x8D,0xC4,0xAD,0xCC,0xEE,0x82,0xD5,0x0E,0x81,0xD4,0xED,0x05,0xCC,0xCD,0xC4,
+    0x8C,0xBC,0x2B,0xB4,0x0A,0xAB,0xC9,0xAB,0xA9,0x80,0xA3,0x89,0x80,0xA3,0x88,0x06,
+    0xA3,0xA9,0xAB,0xEA,0xB4,0x2B,0xBC,0x4B,0xC4,0x6C,0xC4,0x8C,0xC4,0xAC,0x82,0xC4,
+    0xAD,0x80,0xC4,0xAC,0x01,0xC4,0x8C,0xBC,0x6B,0x80,0xB4,0x4B,0x05,0xBC,0x6B,0xC4,
+    0xAC,0xC4,0xCD,0xCD,0x0E,0xD5,0x4F,0xDD,0x70,0x80,0xDD,0x6F,0x04,0xD5,0x6F,0xD5,
+    0x4F,0xD5,0x4E,0xCD,0x2E,0xCD,0x0D,0x80,0xC4,0xED,0x81,0xC4,0xCD,0x80,0xC4,0xCC,
+    0x03,0xC4,0xCD,0xCD,0x0D,0xCD,0x0E,0xD5,0x4E,0x80,0xD5,0x6F,0x0A,0xCD,0x6E,0xC5,
+    0x2E,0xC5,0x0E,0xBC,0xCE,0xB4,0xAE,0xAC,0x8D,0xA4,0x2C,0x93,0xCC,0x8B,0xAC,0xB4,
+    0xF1,0xE6,0xB8,0x83,0x6B,0x0B,0x86,0x6B,0x2A,0x03,0x6B,0x09,0x6A,0xE9,0x6A,0xC8,
+    0x62,0xC8,0x80,0x62,0xA7,0x03,0x6A,0xA7,0x6A,0xC7,0x72,0xC8,0x7B,0x08,0x80,0x7B,
+    0x29,0x00,0x7B,0x28,0x81,0x7B,0x08,0x02,0x82,0xE8,0x7A,0xE7,0x72,0xE7,0x81,0x72,
+    0xC7,0x80,0x7A,0xE7,0x09,0x7A,0xE8,0x72,0xE7,0x72,0xA6,0x6A,0x85,0x62,0x45,0x62,
+    0x65,0x6A,0x85,0x72,0xC6,0x83,0x07,0x8B,0x48,0x80,0x9B,0x89,0x08,0x9B,0xA9,0xA3,
+    0xA9,0xA3,0xEA,0xAC,0x0B,0xB4,0x4B,0xBC,0x6C,0xBC,0x8C,0xC4,0xAD,0xCC,0xEE,0x81,
+    0xD4,0xEE,0x07,0xD4,0xED,0xD5,0x0D,0xD4,0xED,0xCC,0xED,0xCC,0xAC,0xC4,0x6B,0xBC,
+    0x2A,0xB3,0xEA,0x80,0xAB,0xA9,0x0B,0xA3,0x89,0xA3,0x88,0xA3,0x89,0xA3,0xA9,0xAB,
+    0xCA,0xB4,0x2B,0xBC,0x4B,0xC4,0x6C,0xC4,0x8C,0xC4,0xAC,0xC4,0x8C,0xCC,0xAD,0x82,
+    0xC4,0x8C,0x01,0xBC,0x6C,0xBC,0x6B,0x80,0xB4,0x4B,0x07,0xBC,0x6B,0xC4,0xAC,0xC4,
+    0xED,0xCD,0x2E,0xD5,0x4F,0xDD,0x70,0xDD,0x6F,0xD5,0x6F,0x80,0xD5,0x4F,0x01,0xD5,
+    0x2E,0xCD,0x0D,0x81,0xC4,0xED,0x00,0xC4,0xCD,0x81,0xC4,0xCC,0x04,0xC4,0xCD,0xC4,
+    0xED,0xCD,0x0D,0xD5,0x2E,0xD5,0x6F,0x80,0xD5,0x8F,0x0A,0xCD,0x6F,0xCD,0x4E,0xC5,
+    0x2E,0xBC,0xCE,0xB4,0xAE,0xAC,0x6D,0x93,0xEB,0x83,0x6A,0x7B,0x4A,0xA4,0xB0,0xDE,
+    0x98,0x83,0x6B,0x0B,0x83,0x6B,0x2A,0x00,0x6B,0x4A,0x80,0x6B,0x2A,0x04,0x6B,0x29,
+    0x6A,0xE9,0x6A,0xC8,0x62,0xC8,0x6A,0xC8,0x81,0x6A,0xC7,0x01,0x72,0xC8,0x73,0x08,
+    0x82,0x7B,0x08,0x80,0x7A,0xE8,0x80,0x7A,0xC7,0x81,0x72,0xC7,0x01,0x72,0xE7,0x7B,
+    0x08,0x80,0x83,0x29,0x03,0x7B,0x28,0x7B,0x08,0x72,0xC7,0x6A,0xA6,0x81,0x6A,0x85,
+    0x01,0x72,0x85,0x7A,0xE7,0x80,0x8B,0x28,0x0B,0x93,0x48,0x9B,0x68,0x9B,0xA9,0xA3,
+    0xEA,0xAC,0x0A,0xB4,0x2B,0xBC,0x4C,0xBC,0x6C,0xC4,0xAD,0xCC,0xCD,0xCC,0xED,0xD4,
+    0xED,0x82,0xCC,0xED,0x11,0xCC,0xCD,0xC4,0x8C,0xBC,0x4B,0xB4,0x0A,0xB3,0xEA,0xAB,
+    0xCA,0xA3,0x89,0xA3,0x88,0xA3,0x68,0xA3,0xA9,0xAB,0xCA,0xB4,0x2B,0xBC,0x4B,0xC4,
+    0x6C,0xC4,0x8C,0xC4,0xAC,0xC4,0x8C,0xCC,0xAD,0x80,0xC4,0x8C,0x00,0xC4,0x6C,0x80,
+    0xBC,0x6C,0x07,0xBC,0x6B,0xB4,0x2B,0xB4,0x4B,0xBC,0x6B,0xC4,0xAC,0xCC,0xED,0xCD,
+    0x2E,0xD5,0x4F,0x81,0xDD,0x6F,0x03,0xD5,0x4F,0xD5,0x2E,0xCD,0x0E,0xCC,0xED,0x82,
+    0xC4,0xCD,0x00,0xC4,0xCC,0x81,0xC4,0xCD,0x03,0xCC,0xED,0xCD,0x0E,0xD5,0x2E,0xD5,
+    0x6F,0x81,0xD5,0x8F,0x09,0xCD,0x6F,0xC5,0x2F,0xBC,0xEE,0xB4,0xCE,0xAC,0x4D,0x93,
+    0xCB,0x83,0x49,0x7B,0x29,0xA4,0x6F,0xDE,0x97,0x83,0x6B,0x0B,0x86,0x6B,0x2A,0x02,
+    0x6B,0x09,0x72,0xE9,0x72,0xC8,0x80,0x6A,0xC8,0x00,0x6A,0xC7,0x81,0x6A,0xC8,0x00,
+    0x72,0xC8,0x80,0x72,0xE8,0x01,0x7A,0xE8,0x7A,0xC8,0x84,0x72,0xA7,0x03,0x72,0xC7,
+    0x73,0x08,0x83,0x49,0x8B,0x6A,0x81,0x8B,0x8A,0x0E,0x8B,0x69,0x83,0x49,0x7B,0x08,
+    0x72,0xE7,0x6A,0xA6,0x6A,0x65,0x72,0xA6,0x82,0xE7,0x83,0x07,0x8B,0x28,0x9B,0x89,
+    0xA3,0xCA,0xAC,0x0B,0xB4,0x2B,0xB4,0x4B,0x81,0xBC,0x6C,0x03,0xC4,0x6C,0xC4,0x8D,
+    0xCC,0xAD,0xCC,0xCD,0x82,0xCC,0xED,0x05,0xCC,0xAD,0xC4,0x8C,0xBC,0x4B,0xB4,0x0B,
+    0xAB,0xCA,0xA3,0x88,0x80,0xA3,0x68,0x08,0xA3,0x89,0xAB,0xCA,0xB4,0x2B,0xBC,0x4B,
+    0xC4,0x6C,0xC4,0x8C,0xC4,0xAC,0xC4,0x8C,0xCC,0xAD,0x81,0xC4,0x8C,0x80,0xBC,0x6C,
+    0x0E,0xBC,0x4B,0xB4,0x2A,0xB4,0x4B,0xBC,0x6B,0xC4,0xCD,0xCD,0x0E,0xD5,0x2E,0xD5,
+    0x4F,0xDD,0x6F,0xDD,0x8F,0xDD,0x6F,0xD5,0x4E,0xCD,0x2E,0xCC,0xED,0xC4,0xED,0x81,
+    0xC4,0xCC,0x00,0xC4,0xAC,0x81,0xC4,0xCC,0x05,0xC4,0xCD,0xCC,0xED,0xCD,0x0D,0xD5,
+    0x2E,0xD5,0x6F,0xDD,0x8F,0x80,0xD5,0x8F,0x09,0xCD,0x4E,0xC5,0x2E,0xBC,0xEE,0xBC,
+    0xCE,0xAC,0x4D,0x93,0xCB,0x83,0x4A,0x7B,0x29,0x94,0x2E,0xDE,0x77,0x83,0x6B,0x0B,
+    0x82,0x6B,0x0A,0x81,0x73,0x0A,0x05,0x6B,0x0A,0x73,0x09,0x72,0xE9,0x7A,0xC9,0x72,
+    0xC8,0x72,0xA8,0x80,0x6A,0xA8,0x00,0x72,0xA7,0x80,0x72,0x87,0x80,0x7A,0xA8,0x80,
+    0x72,0xA7,0x01,0x6A,0x87,0x6A,0x86,0x82,0x72,0x86,0x04,0x72,0xA7,0x7A,0xC7,0x83,
+    0x29,0x8B,0x6A,0x93,0xAB,0x80,0x93,0xCB,0x00,0x9B,0xCB,0x80,0x93,0xCB,0x08,0x8B,
+    0x8A,0x83,0x69,0x83,0x28,0x83,0x07,0x8B,0x48,0x93,0x89,0x9B,0xCA,0xAC,0x0B,0xB4,
+    0x6C,0x81,0xBC,0xAD,0x02,0xC4,0xAD,0xBC,0x8D,0xBC,0x8C,0x81,0xBC,0x6C,0x01,0xC4,
+    0xAC,0xCC,0xED,0x81,0xCC,0xEE,0x10,0xCC,0xCD,0xC4,0xAD,0xC4,0x6C,0xBC,0x0B,0xAB,
+    0xCA,0xA3,0x88,0x9B,0x48,0x9B,0x68,0xA3,0xA9,0xAB,0xEA,0xBC,0x4B,0xBC,0x4C,0xC4,
+    0x6C,0xC4,0x8C,0xC4,0xAC,0xC4,0x8C,0xCC,0xAC,0x82,0xC4,0x8C,0x07,0xBC,0x6B,0xBC,
+    0x4B,0xB4,0x2A,0xB4,0x4B,0xBC,0x6C,0xC4,0xCD,0xCD,0x2E,0xD5,0x4E,0x80,0xD5,0x6F,
+    0x06,0xDD,0x6F,0xD5,0x6F,0xD5,0x4E,0xCD,0x2E,0xCC,0xED,0xC4,0xCD,0xC4,0xCC,0x82,
+    0xC4,0xAC,0x81,0xC4,0xCC,0x03,0xC4,0xED,0xCD,0x0D,0xD5,0x2E,0xD5,0x6F,0x80,0xD5,
+    0x8F,0x0A,0xD5,0x6F,0xCD,0x6E,0xC5,0x2E,0xBD,0x0E,0xB4,0xAE,0xAC,0x4D,0x93,0xAB,
+    0x83,0x2A,0x7B,0x2A,0x8B,0xED,0xD6,0x36,0x85,0x6B,0x0B,0x80,0x6B,0x2B,0x81,0x73,
+    0x0A,0x05,0x73,0x09,0x72,0xE9,0x7A,0xC9,0x82,0xA9,0x82,0x88,0x7A,0x68,0x81,0x7A,
+    0x67,0x02,0x7A,0x47,0x82,0x27,0x8A,0x27,0x80,0x8A,0x47,0x03,0x82,0x67,0x7A,0x67,
+    0x72,0x66,0x72,0x86,0x80,0x72,0x66,0x09,0x7A,0x46,0x7A,0x66,0x7A,0x87,0x7A,0xC7,
+    0x83,0x09,0x8B,0x49,0x8B,0x6A,0x8B,0xAA,0x93,0xAB,0x9B,0xCB,0x80,0xA4,0x0C,0x01,
+    0x9C,0x0C,0x9B,0xEB,0x80,0x9B,0xCA,0x03,0xA4,0x0B,0xAC,0x4C,0xB4,0x6D,0xBC,0xAD,
+    0x80,0xBC,0xCE,0x02,0xBC,0xAD,0xC4,0xAD,0xBC,0xAD,0x81,0xBC,0x8C,0x02,0xC4,0x8C,
+    0xC4,0xCD,0xD5,0x2E,0x80,0xD5,0x2F,0x05,0xD5,0x0F,0xCC,0xEE,0xCC,0xCE,0xC4,0x8D,
+    0xB4,0x0B,0xA3,0x89,0x80,0x9B,0x48,0x02,0xA3,0x89,0xAB,0xA9,0xAC,0x0A,0x80,0xBC,
+    0x4C,0x80,0xC4,0x6C,0x85,0xC4,0x8C,0x80,0xBC,0x6B,0x80,0xB4,0x4B,0x02,0xBC,0x8C,
+    0xCC,0xEE,0xD5,0x4F,0x82,0xD5,0x6F,0x05,0xD5,0x4F,0xD5,0x2E,0xCD,0x2E,0xCC,0xED,
+    0xC4,0xED,0xC4,0xCD,0x81,0xC4,0xCC,0x00,0xC4,0xAC,0x81,0xC4,0xCC,0x03,0xC4,0xCD,
+    0xCC,0xED,0xCD,0x2E,0xD5,0x4F,0x81,0xD5,0x6F,0x09,0xCD,0x4F,0xC5,0x2E,0xBC,0xEE,
+    0xB4,0xAD,0xA4,0x0C,0x8B,0x8A,0x83,0x4A,0x7B,0x09,0x83,0xCC,0xCE,0x16,0x84,0x6B,
+    0x0B,0x04,0x6B,0x2B,0x63,0x2B,0x6B,0x2B,0x73,0x0A,0x7A,0xEA,0x80,0x82,0xE9,0x09,
+    0x82,0xA8,0x7A,0x47,0x79,0xE6,0x81,0xA6,0x81,0xA5,0x89,0xC6,0x92,0x07,0x91,0xE6,
+    0x91,0xC6,0x99,0xA6,0x80,0xA1,0xA7,0x03,0xA1,0xA6,0x99,0xC6,0x92,0x07,0x8A,0x47,
+    0x81,0x82,0x46,0x0D,0x82,0x26,0x8A,0x26,0x82,0x26,0x82,0x67,0x82,0xA7,0x7A,0xE8,
+    0x7B,0x08,0x83,0x49,0x8B,0x6A,0x93,0x8A,0x9B,0xCB,0x9B,0xEC,0xA4,0x0C,0xA4,0x2C,
+    0x80,0xAC,0x4C,0x00,0xB4,0x6D,0x80,0xB4,0x8D,0x81,0xBC,0xAD,0x80,0xBC,0x8C,0x81,
+    0xBC,0x6C,0x02,0xBC,0x8C,0xC4,0xAD,0xCD,0x0E,0x80,0xDD,0x70,0x05,0xDD,0x4F,0xD5,
+    0x4F,0xD5,0x0F,0xCC,0xEE,0xC4,0x8D,0xAB,0xEA,0x80,0x9B,0x48,0x03,0xA3,0x89,0xA3,
+    0xA9,0xAB,0xEA,0xB4,0x0B,0x80,0xBC,0x4C,0x80,0xC4,0x6C,0x01,0xC4,0x8D,0xC4,0x8C,
+    0x80,0xC4,0x8D,0x80,0xC4,0x8C,0x80,0xBC,0x6C,0x05,0xBC,0x4B,0xB4,0x2B,0xB4,0x4B,
+    0xBC,0x8C,0xCC,0xEE,0xD5,0x4F,0x80,0xDD,0x70,0x07,0xD5,0x70,0xDD,0x70,0xD5,0x6F,
+    0xD5,0x2F,0xCD,0x2E,0xCD,0x0E,0xCC,0xED,0xC4,0xED,0x82,0xC4,0xCD,0x00,0xC4,0xAC,
+    0x80,0xBC,0xAC,0x02,0xC4,0xAC,0xC4,0xCD,0xCC,0xED,0x80,0xCD,0x2E,0x00,0xCD,0x4E,
+    0x80,0xCD,0x4F,0x09,0xC5,0x2F,0xBC,0xEE,0xAC,0x8D,0x9B,0xEB,0x83,0x4A,0x7B,0x29,
+    0x73,0x09,0x83,0x8C,0xC5,0xD5,0x6B,0x0B,0x81,0x6B,0x2B,0x00,0x6B,0x0B,0x81,0x6B,
+    0x2B,0x0A,0x73,0x2B,0x7A,0xEA,0x8A,0xA9,0x8A,0x68,0x8A,0x47,0x79,0xC5,0x69,0x43,
+    0x70,0xC2,0x78,0x82,0x80,0x82,0x90,0xE3,0x80,0xA9,0x45,0x01,0xA9,0x25,0xB1,0x05,
+    0x80,0xB8,0xE5,0x04,0xC0,0xE5,0xB1,0x25,0xA9,0x66,0x99,0xA6,0x99,0xC6,0x81,0x91,
+    0xC6,0x08,0x99,0xC6,0x91,0xC6,0x92,0x26,0x8A,0x67,0x82,0xA7,0x7A,0xE8,0x7B,0x28,
+    0x83,0x69,0x8B,0x8A,0x80,0x93,0xAA,0x06,0x93,0xAB,0x93,0xCB,0x9B,0xEB,0xA4,0x0C,
+    0xAC,0x6D,0xB4,0x8D,0xB4,0xAD,0x80,0xB4,0x8D,0x01,0xBC,0x8D,0xB4,0x6C,0x81,0xB4,
+    0x4C,0x03,0xB4,0x6C,0xBC,0x8C,0xC4,0xCE,0xD5,0x4F,0x80,0xDD,0x90,0x0F,0xDD,0x70,
+    0xD5,0x50,0xD5,0x2F,0xD5,0x0F,0xC4,0xAD,0xAB,0xCA,0x93,0x07,0x93,0x27,0xA3,0x89,
+    0xA3,0xAA,0xAB,0xCA,0xAB,0xEB,0xB4,0x2B,0xBC,0x2B,0xBC,0x2C,0xC4,0x6C,0x80,0xC4,
+    0x6D,0x80,0xC4,0x8D,0x00,0xC4,0x6C,0x81,0xBC,0x4C,0x05,0xB4,0x2B,0xB4,0x0B,0xB4,
+    0x4C,0xC4,0xAD,0xD5,0x2F,0xDD,0x70,0x80,0xDD,0x90,0x02,0xDD,0x70,0xDD,0x90,0xDD,
+    0x70,0x81,0xD5,0x4F,0x01,0xCD,0x0E,0xCC,0xEE,0x82,0xC4,0xCD,0x14,0xBC,0xAD,0xBC,
+    0x8C,0xBC,0x6C,0xBC,0x8C,0xBC,0xAD,0xC4,0xCD,0xC4,0xED,0xC5,0x0E,0xCD,0x0E,0xCD,
+    0x2F,0xC5,0x4F,0xC5,0x2F,0xBC,0xEE,0xA4,0x6D,0x93,0xCB,0x7B,0x29,0x7A,0xE9,0x72,
+    0xE9,0x7B,0x4B,0xBD,0x73,0x6B,0x0B,0x84,0x6B,0x2B,0x08,0x73,0x0B,0x7A,0xEA,0x82,
+    0x88,0x81,0xC6,0x79,0x44,0x78,0xE2,0x78,0xC1,0x78,0x81,0x80,0x81,0x80,0x98,0x21,
+    0x04,0xA8,0x42,0xB8,0x83,0xC8,0xA4,0xD0,0xC5,0xD8,0xA5,0x81,0xD8,0x85,0x02,0xD0,
+    0xC5,0xC0,0xE5,0xB1,0x05,0x80,0xA9,0x04,0x80,0xA1,0x04,0x09,0xA9,0x04,0xA9,0x25,
+    0xA1,0x85,0x99,0xE6,0x8A,0x67,0x82,0xC7,0x83,0x08,0x83,0x29,0x8B,0x69,0x8B,0x8A,
+    0x80,0x93,0xAB,0x80,0x93,0xAA,0x03,0x9B,0xAA,0xA3,0xEB,0xAC,0x4C,0xB4,0x8D,0x80,
+    0xB4,0xAD,0x01,0xBC,0xAD,0xB4,0x6C,0x81,0xB4,0x4C,0x04,0xB4,0x6C,0xBC,0x8D,0xC4,
+    0xEE,0xD5,0x4F,0xDD,0x90,0x81,0xDD,0x70,0x0D,0xD5,0x50,0xD5,0x30,0xC4,0xAE,0x9B,
+    0x89,0x82,0xA6,0x82,0xC6,0x8B,0x07,0x93,0x28,0x93,0x48,0x9B,0x68,0x9B,0x69,0xA3,
+    0x89,0xAB,0xCA,0xBC,0x2C,0x81,0xC4,0x6D,0x01,0xBC,0x4D,0xBC,0x2C,0x81,0xB4,0x0B,
+    0x05,0xAC,0x0B,0xAB,0xEB,0xBC,0x4C,0xCC,0xEF,0xD5,0x50,0xDD,0x71,0x80,0xDD,0x91,
+    0x81,0xDD,0x70,0x00,0xD5,0x70,0x80,0xDD,0x70,0x01,0xD5,0x30,0xCD,0x0F,0x81,0xC4,
+    0xCE,0x02,0xC4,0xCD,0xBC,0xAD,0xBC,0x8D,0x80,0xBC,0x8C,0x0F,0xBC,0x8D,0xC4,0xAD,
+    0xC4,0xCE,0xC4,0xEE,0xC5,0x0E,0xC5,0x0F,0xC5,0x2F,0xBD,0x2F,0xB4,0xEF,0xA4,0x4D,
+    0x8B,0x8B,0x7B,0x09,0x7A,0xEA,0x72,0xE9,0x73,0x2A,0xB5,0x53,0x80,0x6B,0x2B,0x80,
+    0x6B,0x0B,0x81,0x6B,0x2B,0x0D,0x7A,0xEA,0x82,0x68,0x71,0x84,0x70,0xC1,0x78,0x81,
+    0x80,0x40,0x88,0x40,0x88,0x41,0x98,0x21,0xA8,0x01,0xB0,0x22,0xC8,0x63,0xD8,0x84,
+    0xE0,0x65,0x83,0xE8,0x65,0x03,0xE0,0x85,0xD8,0x85,0xC8,0xA5,0xC0,0xA4,0x82,0xB8,
+    0x83,0x0A,0xC0,0x83,0xB0,0xE4,0xA1,0x65,0x92,0x06,0x8A,0x67,0x82,0xC7,0x83,0x08,
+    0x83,0x49,0x8B,0x8A,0x93,0xAA,0x93,0xAB,0x80,0x93,0xAA,0x03,0x93,0xCB,0x9B,0xEB,
+    0xA4,0x2C,0xB4,0x8D,0x81,0xBC,0xAE,0x01,0xBC,0x8D,0xB4,0x6D,0x80,0xB4,0x4C,0x03,
+    0xB4,0x6D,0xBC,0xAD,0xC4,0xEE,0xCD,0x2F,0x80,0xD5,0x70,0x01,0xDD,0x90,0xDD,0x70,
+    0x80,0xD5,0x50,0x03,0xC4,0xAE,0x93,0x28,0x72,0x44,0x72,0x24,0x80,0x7A,0x65,0x06,
+    0x7A,0x85,0x82,0xC6,0x8A,0xC6,0x93,0x08,0xA3,0x89,0xAB,0xEB,0xB4,0x0C,0x80,0xBC,
+    0x2C,0x02,0xB4,0x0C,0xAB,0xCB,0xAB,0xCA,0x81,0xA3,0xAA,0x06,0xAB,0xCA,0xBC,0x4D,
+    0xCC,0xEF,0xDD,0x71,0xDD,0x92,0xDD,0x91,0xDD,0x71,0x82,0xD5,0x50,0x80,0xDD,0x71,
+    0x02,0xD5,0x51,0xD5,0x10,0xCC,0xEF,0x82,0xC4,0xCE,0x80,0xC4,0xAE,0x82,0xC4,0xCE,
+    0x80,0xC4,0xEE,0x0C,0xC5,0x0F,0xC5,0x2F,0xBD,0x0F,0xB4,0xCF,0xA4,0x2D,0x8B,0x8B,
+    0x7B,0x0A,0x7A,0xEA,0x72,0xC9,0x73,0x2A,0xAD,0x12,0x63,0x2B,0x6B,0x2B,0x81,0x6B,
+    0x0B,0x06,0x6B,0x2B,0x6B,0x0B,0x82,0xA9,0x79,0xC5,0x70,0xA1,0x80,0x60,0x88,0x40,
+    0x80,0x98,0x20,0x06,0xA0,0x20,0xB0,0x21,0xC0,0x22,0xC8,0x43,0xD8,0x64,0xE8,0x64,
+    0xE8,0x44,0x83,0xF0,0x44,0x04,0xE8,0x64,0xE0,0x64,0xD8,0x64,0xD0,0x44,0xD0,0x43,
+    0x81,0xD0,0x23,0x0B,0xD0,0x43,0xC0,0x83,0xA8,0xC3,0x99,0x65,0x92,0x47,0x8A,0xA7,
+    0x83,0x08,0x8B,0x49,0x8B,0x8A,0x93,0xAA,0x93,0xAB,0x9B,0xCB,0x80,0x9B,0xEB,0x08,
+    0x9B,0xEC,0xAC,0x4C,0xB4,0x8E,0xBC,0xCE,0xBC,0xEF,0xC4,0xEF,0xC4,0xCE,0xBC,0xAE,
+    0xB4,0x8D,0x80,0xB4,0x6D,0x03,0xBC,0x8D,0xBC,0xCE,0xCD,0x0F,0xD5,0x50,0x80,0xD5,
+    0x91,0x00,0xDD,0x71,0x80,0xD5,0x50,0x0B,0xC4,0xAE,0x8B,0x28,0x72,0x24,0x61,0xC2,
+    0x61,0xC3,0x61,0xE3,0x72,0x03,0x7A,0x65,0x82,0xA6,0x93,0x08,0xA3,0x8A,0xAB,0xAA,
+    0x81,0xAB,0xCB,0x02,0xAB,0xAB,0xA3,0x8A,0xA3,0x69,0x80,0x9B,0x69,0x10,0x9B,0x49,
+    0xA3,0x8A,0xBC,0x4D,0xD5,0x10,0xE5,0xB2,0xE5,0xD2,0xE5,0xB2,0xDD,0x92,0xD5,0x51,
+    0xD5,0x30,0xCD,0x30,0xD5,0x50,0xDD,0x71,0xDD,0x92,0xDD,0x91,0xD5,0x51,0xCD,0x10,
+    0x80,0xCC,0xEF,0x83,0xCD,0x0F,0x00,0xC4,0xEF,0x80,0xC4,0xCE,0x01,0xC4,0xEE,0xC4,
+    0xEF,0x80,0xC5,0x0F,0x03,0xBC,0xEF,0xB4,0xCF,0xA4,0x2D,0x8B,0x8B,0x80,0x7A,0xEA,
+    0x04,0x72,0xCA,0x73,0x0A,0xA4,0xD1,0x63,0x2B,0x6B,0x0B,0x80,0x73,0x0B,0x80,0x6B,
+    0x0B,0x0D,0x72,0xEB,0x7A,0x88,0x79,0x64,0x78,0x81,0x90,0x40,0x98,0x00,0xA0,0x00,
+    0xA8,0x00,0xB0,0x21,0xC0,0x22,0xD0,0x43,0xD8,0x43,0xE0,0x64,0xE8,0x44,0x80,0xF0,
+    0x24,0x01,0xE8,0x23,0xE8,0x43,0x80,0xE8,0x44,0x82,0xE0,0x44,0x01,0xE0,0x24,0xD8,
+    0x24,0x81,0xD8,0x23,0x06,0xC8,0x63,0xB0,0xA3,0xA1,0x24,0x9A,0x47,0x92,0xE9,0x93,
+    0x6A,0x93,0xAB,0x80,0x9B,0xEC,0x0A,0x9C,0x0C,0xA4,0x2C,0xA4,0x2D,0xAC,0x4D,0xAC,
+    0x6D,0xB4,0x8E,0xBC,0xAE,0xBC,0xEF,0xC5,0x30,0xCD,0x50,0xCD,0x30,0x80,0xC5,0x0F,
+    0x80,0xC4,0xEF,0x04,0xC4,0xCE,0xC4,0xEF,0xCD,0x0F,0xCD,0x30,0xD5,0x71,0x80,0xDD,
+    0x91,0x80,0xDD,0x71,0x0B,0xCC,0xEF,0x9B,0xAA,0x7A,0xA6,0x61,0xE3,0x59,0x82,0x59,
+    0x81,0x61,0xA2,0x69,0xE3,0x7A,0x65,0x8A,0xC7,0x9B,0x49,0xA3,0x8A,0x81,0xA3,0xAB,
+    0x03,0xA3,0x8A,0x9B,0x6A,0x9B,0x69,0x9B,0x49,0x80,0x93,0x28,0x02,0xA3,0xAA,0xC4,
+    0x8E,0xDD,0x51,0x81,0xE5,0xD3,0x01,0xDD,0x92,0xD5,0x51,0x80,0xD5,0x31,0x05,0xD5,
+    0x71,0xDD,0xB2,0xE5,0xD3,0xDD,0xB2,0xDD,0x71,0xD5,0x30,0x80,0xCD,0x30,0x81,0xD5,
+    0x30,0x02,0xCD,0x30,0xCD,0x0F,0xC4,0xEF,0x80,0xC4,0xEE,0x01,0xC4,0xEF,0xC5,0x0F,
+    0x80,0xC5,0x2F,0x0A,0xBD,0x0F,0xB4,0xCF,0xA4,0x4D,0x8B,0x8B,0x7A,0xEA,0x72,0xC9,
+    0x72,0xCA,0x72,0xEB,0x9C,0x90,0x63,0x2B,0x6B,0x2B,0x80,0x73,0x0B,0x80,0x6B,0x0B,
+    0x0D,0x72,0xEB,0x82,0x89,0x79,0x64,0x80,0x81,0x98,0x40,0xA0,0x00,0xA8,0x00,0xB0,
+    0x00,0xB8,0x21,0xD0,0x42,0xE0,0x43,0xE8,0x63,0xE8,0x64,0xE8,0x43,0x80,0xE0,0x23,
+    0x00,0xD8,0x22,0x81,0xD0,0x22,0x04,0xD0,0x02,0xD8,0x03,0xD8,0x23,0xE0,0x23,0xE0,
+    0x24,0x81,0xE0,0x03,0x08,0xD8,0x03,0xD0,0x43,0xC0,0x83,0xA9,0x04,0xAA,0x48,0xA3,
+    0x0A,0x93,0x8A,0x93,0xCB,0x9B,0xEB,0x81,0x9B,0xCB,0x05,0x9B,0xEB,0x9C,0x0C,0xAC,
+    0x4D,0xB4,0xAE,0xBC,0xEF,0xC5,0x30,0x82,0xCD,0x50,0x81,0xCD,0x71,0x00,0xCD,0x50,
+    0x80,0xCD,0x30,0x01,0xCD,0x10,0xCD,0x30,0x80,0xD5,0x71,0x06,0xD5,0x91,0xDD,0x91,
+    0xD5,0x71,0xBC,0xAE,0x9B,0xAA,0x72,0x65,0x61,0xC2,0x80,0x59,0x81,0x05,0x59,0x82,
+    0x69,0xC3,0x7A,0x46,0x8A,0xE8,0x9B,0x4A,0xA3,0x6A,0x80,0xA3,0x8B,0x08,0x9B,0x6A,
+    0x9B,0x29,0x93,0x29,0x92,0xE8,0x8A,0xE8,0x93,0x29,0xB4,0x0C,0xD5,0x10,0xE5,0xB3,
+    0x80,0xED,0xF4,0x02,0xE5,0xD3,0xDD,0xB2,0xD5,0x72,0x80,0xD5,0x71,0x00,0xDD,0x92,
+    0x80,0xE5,0xD3,0x02,0xE5,0xB3,0xDD,0x92,0xD5,0x51,0x83,0xD5,0x50,0x01,0xCD,0x30,
+    0xCD,0x0F,0x82,0xC4,0xEF,0x08,0xC5,0x0F,0xC5,0x2F,0xC5,0x30,0xBD,0x0F,0xB4,0xAF,
+    0xA4,0x2D,0x8B,0x6B,0x7A,0xE9,0x72,0xC9,0x80,0x72,0xCA,0x10,0x9C,0x4F,0x5B,0x4B,
+    0x63,0x2B,0x73,0x0B,0x6B,0x0B,0x6B,0x2B,0x6B,0x0B,0x7A,0xCB,0x82,0x49,0x81,0x44,
+    0x88,0x81,0x98,0x40,0xA0,0x20,0xA8,0x00,0xB0,0x01,0xC0,0x21,0xD0,0x42,0x81,0xE0,
+    0x43,0x03,0xD8,0x23,0xD8,0x02,0xD0,0x02,0xC8,0x01,0x81,0xC0,0x01,0x10,0xC8,0x02,
+    0xD0,0x02,0xD0,0x03,0xE0,0x03,0xE0,0x23,0xE0,0x03,0xE8,0x03,0xE8,0x04,0xE0,0x03,
+    0xD8,0x23,0xC8,0x63,0xB0,0xC3,0xA1,0x85,0x92,0x67,0x82,0xE8,0x7B,0x08,0x83,0x28,
+    0x80,0x83,0x08,0x07,0x82,0xE8,0x83,0x08,0x83,0x49,0x9B,0xEB,0xB4,0xAE,0xC5,0x0F,
+    0xC5,0x30,0xCD,0x50,0x81,0xC5,0x50,0x09,0xCD,0x71,0xCD,0x91,0xD5,0xB2,0xD5,0x92,
+    0xCD,0x71,0xCD,0x50,0xC5,0x30,0xCD,0x30,0xCD,0x50,0xD5,0x71,0x81,0xD5,0xB2,0x0B,
+    0xD5,0x71,0xBC,0xCE,0x93,0x89,0x7A,0xA6,0x6A,0x24,0x61,0xE3,0x59,0x82,0x61,0xA3,
+    0x69,0xE4,0x7A,0x66,0x8A,0xC8,0x93,0x09,0x81,0x9B,0x2A,0x06,0x93,0x09,0x8A,0xE8,
+    0x82,0x87,0x8A,0xC8,0xA3,0xAB,0xCC,0xF0,0xE5,0xB3,0x80,0xED,0xF4,0x02,0xEE,0x14,
+    0xE5,0xD3,0xDD,0xB3,0x81,0xDD,0x92,0x07,0xDD,0xB3,0xE5,0xF3,0xE5,0xF4,0xE5,0xD3,
+    0xDD,0x92,0xD5,0x71,0xD5,0x51,0xCD,0x50,0x80,0xD5,0x50,0x03,0xCD,0x50,0xCD,0x30,
+    0xC5,0x10,0xC5,0x0F,0x81,0xBC,0xEF,0x07,0xC5,0x0F,0xC5,0x2F,0xC5,0x30,0xBC,0xEF,
+    0xAC,0x6D,0x93,0xAB,0x83,0x2A,0x72,0xC9,0x80,0x72,0xA9,0x03,0x6A,0xCA,0x94,0x0F,
+    0x5B,0x4A,0x63,0x2B,0x81,0x6B,0x0B,0x0A,0x72,0xEB,0x82,0x8A,0x91,0xE8,0x89,0x24,
+    0x90,0x61,0x98,0x40,0xA0,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x01,0xC8,0x22,0x80,0xD8,
+    0x22,0x80,0xD0,0x22,0x03,0xC8,0x02,0xC0,0x22,0xC0,0x21,0xB8,0x21,0x80,0xC0,0x22,
+    0x0F,0xC8,0x02,0xD0,0x02,0xD8,0x23,0xE0,0x03,0xE0,0x23,0xE0,0x03,0xE8,0x03,0xE8,
+    0x04,0xE0,0x03,0xD8,0x23,0xD0,0x43,0xB0,0x62,0x98,0xE3,0x91,0xC5,0x8A,0x87,0x82,
+    0xC8,0x80,0x7A,0xE8,0x80,0x7A,0xC7,0x07,0x7A,0xE8,0x83,0x29,0x9B,0xEB,0xB4,0xAE,
+    0xC5,0x10,0xC5,0x50,0xCD,0x51,0xC5,0x50,0x80,0xBD,0x30,0x02,0xC5,0x30,0xC5,0x50,
+    0xC5,0x51,0x80,0xCD,0x71,0x04,0xC5,0x51,0xCD,0x71,0xCD,0x91,0xCD,0x92,0xCD,0xB2,
+    0x82,0xD5,0xB2,0x13,0xCD,0x71,0xB4,0xAE,0xA4,0x0B,0x8B,0x49,0x82,0xC7,0x72,0x45,
+    0x69,0xE4,0x6A,0x05,0x72,0x26,0x82,0x87,0x8A,0xC8,0x8A,0xE9,0x92,0xE9,0x93,0x09,
+    0x93,0x2A,0x93,0x29,0x93,0x09,0xA3,0xAB,0xCC,0xF0,0xE5,0xD3,0x82,0xEE,0x14,0x00,
+    0xE5,0xF4,0x80,0xDD,0xD3,0x08,0xDD,0xB3,0xDD,0xD3,0xE5,0xF3,0xE6,0x14,0xE5,0xF4,
+    0xE5,0xD3,0xDD,0x92,0xD5,0x71,0xCD,0x31,0x82,0xCD,0x30,0x80,0xC5,0x30,0x00,0xC5,
+    0x0F,0x80,0xBC,0xEF,0x01,0xBD,0x0F,0xC5,0x2F,0x80,0xC5,0x30,0x08,0xB4,0xAF,0x9B,
+    0xEC,0x83,0x29,0x7A,0xE9,0x72,0xA8,0x72,0xA9,0x6A,0xA9,0x6A,0xC9,0x8B,0xCD,0x80,
+    0x63,0x2A,0x80,0x6B,0x0A,0x07,0x72,0xEA,0x7A,0xAA,0x8A,0x09,0x99,0x47,0xA0,0xE4,
+    0xA0,0x82,0xA0,0x40,0xA0,0x20,0x80,0xA8,0x00,0x01,0xB0,0x01,0xB8,0x21,0x80,0xC0,
+    0x01,0x00,0xC0,0x22,0x81,0xC0,0x01,0x03,0xC0,0x21,0xC0,0x22,0xC8,0x42,0xD0,0x43,
+    0x80,0xD8,0x23,0x03,0xE0,0x23,0xE0,0x03,0xE0,0x23,0xE8,0x23,0x80,0xE8,0x03,0x09,
+    0xE0,0x23,0xD8,0x23,0xC8,0x22,0xB0,0x21,0x90,0x41,0x88,0xE2,0x91,0xE5,0x92,0xA8,
+    0x93,0x49,0x8B,0x8A,0x80,0x93,0x8A,0x07,0x8B,0x8A,0x93,0xAB,0xA4,0x2D,0xB4,0xCE,
+    0xBD,0x10,0xC5,0x30,0xC5,0x51,0xC5,0x50,0x81,0xBD,0x30,0x80,0xBD,0x0F,0x81,0xBD,
+    0x30,0x03,0xBD,0x50,0xC5,0x71,0xC5,0x91,0xCD,0xB2,0x80,0xCD,0xD2,0x80,0xCD,0xB2,
+    0x13,0xCD,0x91,0xC5,0x31,0xBC,0xCF,0xAC,0x4D,0x9B,0xCB,0x8B,0x49,0x82,0xC8,0x7A,
+    0x87,0x7A,0x67,0x7A,0x87,0x82,0x87,0x82,0xC8,0x8A,0xE9,0x93,0x4A,0xA3,0xAC,0xAB,
+    0xED,0xB4,0x2E,0xCC,0xF1,0xE5,0xB3,0xEE,0x14,0x80,0xEE,0x35,0x80,0xE6,0x34,0x04,
+    0xE6,0x14,0xDD,0xF3,0xE5,0xF3,0xDD,0xF3,0xE5,0xF3,0x81,0xE6,0x14,0x03,0xDD,0xD3,
+    0xDD,0xB2,0xD5,0x71,0xCD,0x31,0x81,0xC5,0x10,0x81,0xC5,0x30,0x00,0xBD,0x10,0x81,
+    0xBD,0x0F,0x05,0xBD,0x30,0xC5,0x10,0xB4,0xCF,0xA4,0x4D,0x8B,0x8A,0x7A,0xE8,0x80,
+    0x72,0xA8,0x80,0x6A,0x88,0x03,0x6A,0xC9,0x83,0xAC,0x63,0x0A,0x6B,0x0A,0x80,0x6A,
+    0xEA,0x0C,0x72,0xCA,0x82,0x49,0x91,0x67,0xA8,0xC6,0xB8,0xA4,0xB8,0x62,0xB0,0x21,
+    0xA8,0x20,0xA8,0x00,0xA8,0x20,0xA8,0x21,0xB0,0x21,0xB8,0x21,0x82,0xB8,0x01,0x80,
+    0xC0,0x01,0x03,0xC8,0x22,0xD0,0x22,0xD8,0x43,0xD8,0x23,0x80,0xE0,0x23,0x00,0xE0,
+    0x03,0x81,0xE0,0x23,0x09,0xD8,0x23,0xD8,0x43,0xD0,0x22,0xC0,0x22,0xB0,0x21,0xA0,
+    0x41,0x90,0xA2,0x99,0xC5,0xAB,0x0A,0xB4,0x0D,0x80,0xAC,0x6E,0x08,0xA4,0x4D,0x9B,
+    0xEC,0x93,0xAB,0x9B,0xEB,0xA4,0x4D,0xB4,0xAE,0xBD,0x10,0xC5,0x50,0xC5,0x51,0x80,
+    0xC5,0x50,0x03,0xBD,0x50,0xBD,0x30,0xBD,0x0F,0xB4,0xEF,0x81,0xB5,0x0F,0x02,0xBD,
+    0x30,0xBD,0x50,0xC5,0x71,0x80,0xC5,0x91,0x81,0xC5,0x71,0x07,0xC5,0x31,0xBD,0x10,
+    0xB4,0xAF,0xAC,0x6E,0xA4,0x0D,0x93,0x8B,0x83,0x09,0x7A,0xA8,0x80,0x7A,0xA7,0x08,
+    0x82,0xC8,0x8B,0x09,0x9B,0xAB,0xB4,0x2E,0xC4,0xD0,0xD5,0x31,0xE5,0xB3,0xED,0xF4,
+    0xEE,0x35,0x80,0xEE,0x55,0x01,0xEE,0x35,0xE6,0x35,0x83,0xE6,0x14,0x80,0xE6,0x34,
+    0x04,0xE6,0x14,0xDD,0xF4,0xD5,0xB3,0xD5,0x72,0xCD,0x51,0x85,0xC5,0x30,0x0F,0xBD,
+    0x30,0xC5,0x30,0xC5,0x50,0xBD,0x30,0xB4,0xCF,0xA4,0x2C,0x8B,0x8A,0x7B,0x08,0x7A,
+    0xE8,0x72,0xA8,0x6A,0xA8,0x6A,0x88,0x6A,0xA8,0x6A,0xC9,0x83,0x8C,0x63,0x0A,0x81,
+    0x6A,0xEA,0x08,0x72,0xAA,0x82,0x29,0x99,0x27,0xB0,0xA5,0xC0,0x64,0xC8,0x43,0xC8,
+    0x22,0xB8,0x01,0xB0,0x00,0x80,0xA8,0x21,0x00,0xB0,0x01,0x80,0xB0,0x21,0x82,0xB8,
+    0x01,0x01,0xC0,0x01,0xC8,0x01,0x80,0xD0,0x22,0x80,0xD8,0x22,0x01,0xD8,0x02,0xE0,
+    0x02,0x81,0xD8,0x22,0x80,0xD0,0x22,0x0A,0xC8,0x22,0xC0,0x21,0xB8,0x42,0xA8,0x82,
+    0x98,0xA2,0xA9,0xE7,0xBB,0x6B,0xAB,0xCC,0x9B,0xEC,0x93,0xAB,0x83,0x69,0x80,0x7B,
+    0x28,0x03,0x8B,0x8A,0x9C,0x0C,0xAC,0x8E,0xBD,0x0F,0x84,0xBD,0x30,0x03,0xBD,0x10,
+    0xB5,0x10,0xBD,0x10,0xBD,0x30,0x80,0xB5,0x10,0x00,0xBD,0x30,0x80,0xBD,0x50,0x82,
+    0xBD,0x30,0x00,0xBD,0x10,0x80,0xBC,0xF0,0x04,0xB4,0xD0,0xAC,0x8F,0xA4,0x2D,0x93,
+    0x8B,0x83,0x09,0x80,0x7A,0xA7,0x09,0x82,0xE8,0x93,0x6A,0xA4,0x0D,0xBC,0x8F,0xCD,
+    0x31,0xD5,0x92,0xE5,0xD3,0xE6,0x14,0xE6,0x35,0xEE,0x35,0x81,0xE6,0x35,0x00,0xE6,
+    0x14,0x80,0xDE,0x14,0x08,0xDD,0xF4,0xDE,0x14,0xE6,0x34,0xE6,0x35,0xE6,0x34,0xDD,
+    0xF4,0xD5,0xB2,0xCD,0x71,0xC5,0x51,0x81,0xC5,0x30,0x80,0xBD,0x30,0x81,0xC5,0x51,
+    0x80,0xC5,0x71,0x07,0xC5,0x51,0xAC,0xAE,0x93,0xAB,0x7B,0x08,0x7A,0xE8,0x72,0xC7,
+    0x6A,0xA8,0x6A,0xC8,0x80,0x6A,0xA8,0x03,0x6A,0xA9,0x7B,0x6B,0x63,0x0A,0x62,0xEA,
+    0x80,0x6A,0xEA,0x08,0x72,0xAA,0x8A,0x2A,0x99,0x48,0xB8,0xA5,0xC8,0x64,0xD0,0x43,
+    0xD8,0x22,0xC8,0x01,0xC0,0x01,0x82,0xB0,0x01,0x82,0xB8,0x01,0x00,0xB8,0x21,0x80,
+    0xC0,0x01,0x00,0xC8,0x01,0x80,0xC8,0x22,0x82,0xD0,0x22,0x80,0xD0,0x21,0x80,0xD0,
+    0x01,0x0A,0xC8,0x01,0xC0,0x21,0xC0,0x42,0xB0,0x83,0xA0,0xE3,0xAA,0x48,0xAB,0x2B,
+    0x9B,0x6B,0x8B,0x6A,0x83,0x49,0x7B,0x29,0x80,0x73,0x08,0x03,0x7B,0x29,0x93,0xCB,
+    0xA4,0x6D,0xAC,0xAE,0x81,0xB4,0xCF,0x01,0xAC,0xAE,0xAC,0xCF,0x81,0xB4,0xEF,0x01,
+    0xBD,0x30,0xBD,0x51,0x81,0xBD,0x30,0x01,0xBD,0x10,0xBD,0x30,0x83,0xBD,0x10,0x11,
+    0xBC,0xCF,0xBC,0xD0,0xB4,0xAF,0xB4,0x8F,0xAC,0x6E,0x9C,0x0D,0x8B,0x6B,0x83,0x08,
+    0x82,0xE8,0x8B,0x4A,0xA3,0xEC,0xB4,0x6E,0xC4,0xF0,0xCD,0x51,0xD5,0x92,0xDD,0xD3,
+    0xDD,0xF4,0xE5,0xF4,0x80,0xE6,0x14,0x82,0xDE,0x14,0x80,0xDD,0xF4,0x80,0xDE,0x14,
+    0x05,0xE6,0x35,0xDE,0x34,0xD5,0xF3,0xCD,0x92,0xC5,0x51,0xBD,0x30,0x83,0xBD,0x10,
+    0x80,0xBD,0x30,0x07,0xBD,0x51,0xC5,0x71,0xC5,0x92,0xC5,0x71,0xB4,0xEF,0x9C,0x0C,
+    0x83,0x69,0x7B,0x08,0x81,0x72,0xE8,0x00,0x72,0xC8,0x80,0x6A,0xA8,0x00,0x7B,0x4B,
+    0x80,0x62,0xEA,0x80,0x62,0xCA,0x08,0x72,0xAA,0x82,0x4A,0x99,0xA8,0xB0,0xE6,0xC0,
+    0x84,0xD8,0x63,0xE0,0x43,0xD8,0x22,0xC8,0x02,0x84,0xB8,0x01,0x00,0xB0,0x01,0x81,
+    0xB8,0x01,0x80,0xC0,0x01,0x81,0xC0,0x21,0x80,0xC0,0x01,0x81,0xC8,0x01,0x81,0xD0,
+    0x01,0x0A,0xC8,0x01,0xC0,0x42,0xA8,0x82,0xA9,0x45,0xAA,0xA9,0x9B,0x2A,0x8B,0x4A,
+    0x83,0x6A,0x83,0x49,0x72,0xE8,0x6A,0xC7,0x80,0x6A,0xA6,0x02,0x7B,0x28,0x93,0xCB,
+    0xA4,0x4D,0x80,0xA4,0x8E,0x80,0xA4,0x6D,0x00,0xA4,0x6E,0x80,0xAC,0xAE,0x01,0xAC,
+    0xCF,0xB4,0xEF,0x82,0xBD,0x10,0x02,0xBC,0xF0,0xBD,0x10,0xBC,0xF0,0x80,0xB4,0xF0,
+    0x02,0xBC,0xF0,0xB4,0xCF,0xAC,0x8E,0x82,0xAC,0x6E,0x0A,0xA4,0x4E,0x9B,0xEC,0x93,
+    0x8B,0x93,0x6A,0x9B,0xEC,0xAC,0x6E,0xBC,0xD0,0xC5,0x11,0xCD,0x51,0xD5,0x92,0xDD,
+    0xB3,0x80,0xDD,0xD3,0x80,0xDD,0xF4,0x00,0xD5,0xD3,0x82,0xD5,0xF3,0x00,0xD6,0x14,
+    0x80,0xDE,0x14,0x05,0xDE,0x35,0xDE,0x55,0xD5,0xF3,0xCD,0x92,0xBD,0x30,0xBD,0x10,
+    0x81,0xB4,0xF0,0x00,0xB4,0xEF,0x81,0xB5,0x10,0x00,0xBD,0x30,0x80,0xBD,0x51,0x04,
+    0xB5,0x10,0xA4,0x8E,0x94,0x0C,0x8B,0xAB,0x8B,0x8A,0x80,0x83,0x6A,0x01,0x83,0x4A,
+    0x7B,0x29,0x80,0x72,0xE9,0x00,0x7B,0x4B,0x80,0x62,0xEA,0x07,0x62,0xCA,0x6A,0xCA,
+    0x72,0xAA,0x7A,0x8A,0x89,0xE9,0xA9,0x46,0xB8,0xC5,0xD0,0x84,0x80,0xE0,0x43,0x02,
+    0xD8,0x22,0xC8,0x22,0xC0,0x21,0x80,0xC0,0x01,0x80,0xB8,0x01,0x02,0xB0,0x00,0xB8,
+    0x01,0xB8,0x21,0x84,0xB8,0x01,0x03,0xB8,0x00,0xC0,0x00,0xC8,0x00,0xC8,0x01,0x82,
+    0xD0,0x01,0x07,0xC8,0x22,0xB8,0x62,0xA8,0xC3,0xA1,0xC6,0x9A,0xA8,0x8A,0xC8,0x7A,
+    0xC7,0x72,0xC7,0x81,0x6A,0xA7,0x07,0x72,0xC7,0x7B,0x28,0x83,0x69,0x93,0xEB,0x9C,
+    0x2C,0xA4,0x4D,0xA4,0x6D,0xA4,0x6E,0x82,0xAC,0x8E,0x80,0xAC,0xAE,0x00,0xAC,0xAF,
+    0x80,0xB4,0xCF,0x01,0xB4,0xAF,0xAC,0xAF,0x80,0xAC,0xAE,0x81,0xAC,0x8E,0x02,0xA4,
+    0x4D,0x9C,0x0D,0x9B,0xEC,0x82,0x9C,0x0D,0x00,0x9B,0xEC,0x80,0x93,0xCC,0x07,0x9C,
+    0x0D,0xAC,0x4E,0xB4,0x8F,0xBC,0xD0,0xC5,0x11,0xCD,0x52,0xD5,0x92,0xD5,0x93,0x81,
+    0xD5,0xB3,0x80,0xD5,0xD3,0x80,0xD5,0xF3,0x00,0xD5,0xF4,0x80,0xD6,0x14,0x00,0xDE,
+    0x14,0x80,0xDE,0x35,0x02,0xD5,0xF3,0xC5,0x72,0xBD,0x10,0x81,0xB4,0xF0,0x80,0xB5,
+    0x10,0x81,0xB5,0x30,0x05,0xBD,0x31,0xB5,0x30,0xAC,0xEF,0x94,0x0C,0x7B,0x29,0x72,
+    0xC7,0x81,0x6A,0xA7,0x02,0x73,0x08,0x7B,0x29,0x83,0x4A,0x80,0x83,0x6B,0x00,0x7B,
+    0x6B,0x80,0x62,0xEA,0x08,0x62,0xCA,0x6A,0xCA,0x72,0xAA,0x7A,0x8A,0x82,0x29,0x99,
+    0xA7,0xA9,0x05,0xC0,0xA4,0xD8,0x63,0x80,0xE0,0x23,0x08,0xD8,0x23,0xD0,0x22,0xC8,
+    0x02,0xC8,0x01,0xC0,0x01,0xB8,0x01,0xB8,0x00,0xB8,0x01,0xB0,0x01,0x80,0xB8,0x01,
+    0x81,0xB8,0x00,0x80,0xC0,0x00,0x01,0xC8,0x01,0xC8,0x21,0x80,0xD0,0x21,0x80,0xD8,
+    0x21,0x13,0xD0,0x22,0xC0,0x42,0xB0,0x82,0xA1,0x44,0x92,0x06,0x82,0x66,0x7A,0x86,
+    0x6A,0x86,0x6A,0xA7,0x72,0xC7,0x72,0xE8,0x83,0x49,0x8B,0xAA,0x93,0xEB,0x93,0xCB,
+    0x8B,0xAA,0x93,0xCB,0x93,0xEB,0x9C,0x2D,0xA4,0x8E,0x83,0xAC,0x8E,0x00,0xAC,0xAE,
+    0x82,0xAC,0x8E,0x00,0xA4,0x6D,0x80,0xA4,0x4D,0x80,0x9C,0x2D,0x02,0x9C,0x0D,0x93,
+    0xEC,0x93,0xCC,0x80,0x93,0xAB,0x80,0x93,0xCB,0x82,0x93,0xCC,0x07,0x9B,0xEC,0xA4,
+    0x0D,0xAC,0x4E,0xAC,0x6F,0xB4,0xAF,0xBD,0x10,0xC5,0x31,0xC5,0x52,0x81,0xCD,0x72,
+    0x00,0xCD,0x93,0x80,0xCD,0xD3,0x00,0xD5,0xF3,0x80,0xD5,0xF4,0x80,0xD6,0x14,0x04,
+    0xDE,0x14,0xD5,0xF4,0xC5,0x92,0xBD,0x10,0xB4,0xCF,0x80,0xB4,0xF0,0x03,0xB5,0x10,
+    0xBD,0x10,0xB5,0x10,0xB5,0x31,0x81,0xBD,0x51,0x03,0xB5,0x10,0xA4,0x8E,0x83,0x8A,
+    0x6A,0xA7,0x83,0x62,0x66,0x04,0x62,0x87,0x6A,0xA8,0x72,0xE9,0x7B,0x4A,0x83,0x8C,
+    0x80,0x62,0xEA,0x80,0x62,0xCA,0x07,0x6A,0xAA,0x72,0xA9,0x7A,0x69,0x8A,0x08,0x99,
+    0x66,0xB0,0xE5,0xC8,0x64,0xE0,0x43,0x80,0xE8,0x23,0x03,0xE0,0x22,0xD8,0x22,0xD0,
+    0x22,0xC8,0x01,0x80,0xC0,0x01,0x00,0xB8,0x20,0x84,0xB8,0x00,0x02,0xC0,0x01,0xC8,
+    0x01,0xD0,0x21,0x80,0xD8,0x22,0x80,0xD8,0x21,0x17,0xD0,0x22,0xC8,0x42,0xB8,0x62,
+    0xA8,0xE3,0x99,0xC5,0x8A,0x26,0x7A,0x46,0x72,0x86,0x72,0xA7,0x72,0xC8,0x7B,0x29,
+    0x8B,0x6A,0x93,0xCB,0x93,0xEB,0x8B,0xAA,0x7B,0x49,0x73,0x08,0x7B,0x08,0x83,0x69,
+    0x93,0xCB,0x9C,0x2D,0xA4,0x4D,0x9C,0x2D,0xA4,0x4D,0x80,0xA4,0x6D,0x80,0xA4,0x6E,
+    0x81,0xA4,0x6D,0x01,0xA4,0x4D,0x9C,0x2C,0x80,0x9C,0x0C,0x00,0x93,0xEC,0x80,0x93,
+    0xCC,0x80,0x93,0xAB,0x02,0x8B,0xAB,0x8B,0x8B,0x8B,0xAB,0x82,0x93,0xAB,0x05,0x93,
+    0xCC,0x9B,0xEC,0xA4,0x2D,0xAC,0x4E,0xB4,0x8F,0xBC,0xF0,0x81,0xBD,0x11,0x80,0xC5,
+    0x31,0x03,0xC5,0x72,0xCD,0x93,0xCD,0xB3,0xCD,0xD3,0x81,0xD5,0xF4,0x06,0xD6,0x14,
+    0xD5,0xF4,0xCD,0xB3,0xBD,0x51,0xAC,0xCF,0xAC,0xAF,0xB4,0xF0,0x82,0xB5,0x10,0x08,
+    0xB5,0x31,0xBD,0x51,0xBD,0x71,0xBD,0x51,0xAC,0xCF,0x94,0x0C,0x7B,0x49,0x6A,0xA7,
+    0x5A,0x45,0x81,0x62,0x66,0x00,0x62,0x87,0x80,0x6A,0xA7,0x80,0x6A,0xA8,0x01,0x72,
+    0xE9,0x62,0xC9,0x80,0x5A,0xC9,0x0A,0x62,0xC9,0x62,0xA9,0x6A,0xA9,0x6A,0x89,0x7A,
+    0x49,0x89,0xC7,0xA1,0x25,0xC0,0x84,0xD8,0x43,0xE8,0x23,0xF0,0x23,0x80,0xE8,0x03,
+    0x04,0xE0,0x22,0xD8,0x22,0xD0,0x21,0xC8,0x01,0xC0,0x01,0x80,0xB8,0x00,0x81,0xB0,
+    0x00,0x02,0xC0,0x00,0xC8,0x01,0xD8,0x01,0x81,0xD8,0x02,0x80,0xD8,0x21,0x0A,0xD0,
+    0x22,0xC0,0x62,0xB0,0xA2,0xA1,0x44,0x92,0x06,0x7A,0x46,0x72,0x86,0x72,0xC7,0x7B,
+    0x08,0x7B,0x29,0x83,0x6A,0x80,0x8B,0x8A,0x02,0x83,0x6A,0x7B,0x29,0x72,0xE7,0x80,
+    0x72,0xC7,0x02,0x7B,0x08,0x83,0x69,0x8B,0xCB,0x80,0x93,0xCB,0x02,0x94,0x0C,0x9C,
+    0x2D,0xA4,0x4D,0x80,0x9C,0x4D,0x00,0x9C,0x2D,0x80,0x9C,0x2C,0x01,0x9C,0x0C,0x93,
+    0xEC,0x81,0x93,0xCB,0x00,0x93,0xAB,0x80,0x8B,0xAB,0x80,0x8B,0x8B,0x80,0x8B,0x8A,
+    0x81,0x8B,0x8B,0x06,0x93,0x8B,0x93,0xAB,0x9B,0xEC,0xA4,0x4E,0xAC,0x8F,0xB4,0xAF,
+    0xBC,0xF0,0x82,0xBD,0x11,0x05,0xBD,0x31,0xC5,0x31,0xC5,0x52,0xC5,0x92,0xCD,0xB3,
+    0xD5,0xD3,0x81,0xD5,0xF4,0x05,0xD5,0xD4,0xCD,0xB3,0xBD,0x51,0xB4,0xF0,0xAC,0xCF,
+    0xB4,0xF0,0x80,0xB5,0x10,0x0D,0xB5,0x11,0xB5,0x31,0xBD,0x51,0xB5,0x51,0xB5,0x10,
+    0xAC,0xCF,0xA4,0x6E,0x8B,0xCB,0x73,0x08,0x62,0xA6,0x62,0x86,0x62,0x66,0x62,0x67,
+    0x62,0x87,0x81,0x6A,0x87,0x80,0x6A,0xA8,0x00,0x6A,0xC9,0x82,0x5A,0xC9,0x80,0x62,
+    0xA9,0x06,0x6A,0x89,0x72,0x69,0x89,0xE8,0xA1,0x26,0xC0,0x84,0xD8,0x43,0xE8,0x23,
+    0x81,0xF0,0x03,0x05,0xE8,0x23,0xE0,0x23,0xE0,0x22,0xD0,0x21,0xC8,0x21,0xC0,0x01,
+    0x80,0xB8,0x00,0x80,0xB0,0x00,0x02,0xC0,0x21,0xD0,0x21,0xD8,0x21,0x80,0xE0,0x02,
+    0x01,0xD8,0x02,0xD8,0x22,0x80,0xD0,0x22,0x06,0xC0,0x62,0xA8,0xC3,0xA1,0x85,0x8A,
+    0x47,0x7A,0xA7,0x72,0xE8,0x7B,0x29,0x80,0x83,0x49,0x00,0x83,0x29,0x81,0x7B,0x29,
+    0x00,0x7B,0x08,0x80,0x72,0xE8,0x01,0x7B,0x08,0x7B,0x49,0x82,0x83,0x6A,0x03,0x8B,
+    0xAB,0x94,0x0C,0x9C,0x0C,0x94,0x0C,0x80,0x93,0xEC,0x80,0x93,0xEB,0x01,0x93,0xCB,
+    0x8B,0xCB,0x81,0x8B,0xAB,0x81,0x8B,0x8B,0x80,0x8B,0x8A,0x00,0x8B,0x6A,0x80,0x83,
+    0x6A,0x81,0x8B,0x6A,0x06,0x93,0xAB,0x9B,0xEC,0xA4,0x4E,0xAC,0x8F,0xB4,0xAF,0xB4,
+    0xD0,0xBC,0xF0,0x83,0xBD,0x11,0x0C,0xBD,0x31,0xC5,0x52,0xCD,0x93,0xCD,0xD3,0xD5,
+    0xD3,0xD5,0xD4,0xD5,0xF4,0xD5,0xD4,0xCD,0xB3,0xC5,0x72,0xBD,0x31,0xB5,0x10,0xB5,
+    0x11,0x81,0xBD,0x31,0x80,0xBD,0x51,0x09,0xB5,0x10,0xAC,0xCF,0x94,0x2D,0x83,0xAB,
+    0x83,0x8A,0x7B,0x49,0x7B,0x29,0x72,0xE8,0x6A,0xC8,0x6A,0xA8,0x80,0x6A,0x87,0x82,
+    0x6A,0xA8,0x00,0x6A,0xC9,0x84,0x5A,0xA9,0x06,0x62,0x89,0x72,0x69,0x89,0xE8,0xA1,
+    0x46,0xB8,0xA5,0xD0,0x64,0xE0,0x23,0x82,0xF0,0x03,0x0D,0xF0,0x02,0xE8,0x22,0xE0,
+    0x22,0xD8,0x22,0xD0,0x21,0xC8,0x01,0xC0,0x00,0xB8,0x00,0xB8,0x20,0xC0,0x21,0xD0,
+    0x21,0xD8,0x01,0xD8,0x02,0xE0,0x02,0x80,0xD8,0x02,0x0A,0xD0,0x22,0xD0,0x42,0xC0,
+    0x62,0xA8,0xC3,0xA9,0xE7,0x92,0xA8,0x83,0x09,0x83,0x4A,0x83,0x6A,0x83,0x49,0x7B,
+    0x09,0x81,0x72,0xE8,0x81,0x73,0x09,0x00,0x83,0x4A,0x80,0x8B,0xAB,0x06,0x83,0x4A,
+    0x73,0x08,0x72,0xC8,0x73,0x09,0x83,0x6A,0x8B,0xAB,0x8B,0xCB,0x80,0x8B,0xAB,0x85,
+    0x8B,0x8A,0x81,0x8B,0x6A,0x00,0x83,0x6A,0x86,0x83,0x4A,0x04,0x8B,0x8B,0x93,0xEC,
+    0xA4,0x2D,0xAC,0x8F,0xB4,0xAF,0x80,0xB4,0xD0,0x80,0xBC,0xF0,0x00,0xBD,0x10,0x80,
+    0xBD,0x11,0x02,0xBD,0x31,0xBD,0x51,0xC5,0x72,0x81,0xCD,0xB3,0x80,0xCD,0xD3,0x04,
+    0xCD,0xB3,0xC5,0x72,0xC5,0x52,0xBD,0x51,0xBD,0x31,0x80,0xBD,0x51,0x80,0xB5,0x31,
+    0x04,0xB4,0xF0,0xAC,0xCF,0x9C,0x6E,0x83,0xAB,0x72,0xE8,0x80,0x6A,0xC7,0x05,0x7B,
+    0x29,0x83,0x6A,0x83,0x8B,0x7B,0x4A,0x73,0x09,0x6A,0xC8,0x81,0x6A,0xA8,0x01,0x6A,
+    0xA9,0x6A,0xC9,0x84,0x5A,0xA9,0x06,0x62,0x89,0x6A,0x69,0x81,0xE8,0xA1,0x46,0xB8,
+    0x85,0xD0,0x44,0xE0,0x23,0x84,0xF0,0x03,0x04,0xE8,0x22,0xE0,0x22,0xD8,0x42,0xD0,
+    0x22,0xC8,0x01,0x80,0xC0,0x01,0x03,0xC0,0x21,0xD0,0x21,0xD8,0x01,0xD8,0x02,0x80,
+    0xE0,0x02,0x0B,0xD8,0x02,0xD0,0x22,0xD0,0x42,0xC8,0x42,0xB0,0xE3,0xB2,0x28,0x9A,
+    0xEA,0x8B,0x4A,0x83,0x6A,0x83,0x49,0x7B,0x29,0x72,0xE8,0x80,0x72,0xC8,0x80,0x72,
+    0xE8,0x05,0x7B,0x29,0x83,0x6A,0x8B,0x8B,0x8B,0xAB,0x83,0x6A,0x7B,0x29,0x80,0x6A,
+    0xC8,0x01,0x72,0xE8,0x7B,0x29,0x81,0x83,0x6A,0x80,0x83,0x4A,0x85,0x83,0x49,0x81,
+    0x83,0x29,0x80,0x7B,0x29,0x03,0x83,0x29,0x7B,0x29,0x83,0x29,0x83,0x49,0x80,0x83,
+    0x4A,0x06,0x8B,0x6A,0x93,0xCC,0x9C,0x0D,0xA4,0x4E,0xAC,0x8F,0xAC,0xAF,0xB4,0xCF,
+    0x80,0xB4,0xD0,0x01,0xBC,0xF0,0xBD,0x10,0x80,0xBD,0x11,0x01,0xBD,0x31,0xC5,0x52,
+    0x80,0xC5,0x72,0x80,0xC5,0x92,0x80,0xCD,0xB3,0x00,0xC5,0x92,0x80,0xC5,0x72,0x81,
+    0xBD,0x72,0x13,0xBD,0x51,0xB5,0x31,0xA4,0xAF,0x94,0x0C,0x83,0x8B,0x72,0xE8,0x62,
+    0x66,0x5A,0x66,0x5A,0x45,0x5A,0x46,0x6A,0xA7,0x7B,0x2A,0x83,0x6B,0x83,0x8B,0x7B,
+    0x4A,0x73,0x09,0x72,0xE9,0x6A,0xC9,0x6A,0xA9,0x6A,0xE9,0x83,0x5A,0x89,0x07,0x5A,
+    0xA9,0x62,0x89,0x6A,0x69,0x81,0xE8,0x99,0x46,0xB8,0x84,0xD0,0x44,0xE0,0x23,0x85,
+    0xF0,0x03,0x80,0xE8,0x23,0x15,0xE0,0x42,0xD8,0x22,0xD0,0x01,0xC0,0x00,0xC0,0x01,
+    0xC8,0x21,0xD8,0x21,0xD8,0x22,0xD8,0x02,0xE0,0x02,0xD8,0x02,0xD8,0x22,0xD0,0x22,
+    0xC8,0x42,0xB9,0x04,0xBA,0x89,0xA3,0x2B,0x8B,0x4A,0x83,0x4A,0x7B,0x29,0x7A,0xE8,
+    0x72,0xE8,0x80,0x72,0xC8,0x02,0x72,0xE8,0x7B,0x09,0x83,0x6A,0x80,0x8B,0xAB,0x04,
+    0x83,0x8B,0x83,0x4A,0x7B,0x09,0x72,0xC8,0x73,0x09,0x80,0x7B,0x29,0x00,0x7B,0x09,
+    0x80,0x73,0x08,0x84,0x72,0xE8,0x01,0x7B,0x08,0x7B,0x09,0x80,0x7B,0x08,0x81,0x7B,
+    0x09,0x80,0x7B,0x29,0x01,0x83,0x29,0x83,0x49,0x81,0x83,0x4A,0x09,0x83,0x6A,0x8B,
+    0x8B,0x93,0xCC,0x9C,0x0D,0xA4,0x4D,0xAC,0x6E,0xAC,0x8F,0xB4,0xAF,0xB4,0xD0,0xB4,
+    0xF0,0x80,0xBC,0xF0,0x02,0xBD,0x10,0xBD,0x11,0xBD,0x31,0x81,0xC5,0x52,0x01,0xC5,
+    0x72,0xC5,0x92,0x80,0xCD,0xB3,0x80,0xC5,0x92,0x80,0xC5,0x72,0x80,0xBD,0x72,0x0C,
+    0xAC,0xF0,0x8B,0xEC,0x6A,0xE8,0x62,0x87,0x52,0x25,0x49,0xE4,0x52,0x04,0x51,0xE4,
+    0x52,0x05,0x5A,0x25,0x62,0x67,0x6A,0xC9,0x7B,0x2A,0x81,0x83,0x6B,0x02,0x7B,0x4A,
+    0x73,0x0A,0x6A,0xE9,0x85,0x5A,0x89,0x06,0x6A,0x68,0x82,0x08,0x99,0x46,0xB0,0xA4,
+    0xD0,0x44,0xE0,0x23,0xF0,0x03,0x84,0xF0,0x02,0x05,0xF0,0x03,0xF0,0x23,0xE8,0x23,
+    0xE0,0x22,0xD8,0x22,0xD0,0x01,0x80,0xC8,0x01,0x01,0xD0,0x21,0xD8,0x22,0x81,0xD8,
+    0x02,0x08,0xD8,0x22,0xD0,0x22,0xC8,0x42,0xB9,0x04,0xBA,0x68,0xA3,0x0A,0x83,0x2A,
+    0x7B,0x29,0x7B,0x28,0x82,0x72,0xE8,0x04,0x7B,0x09,0x7B,0x4A,0x83,0x6A,0x8B,0x8B,
+    0x83,0x8B,0x80,0x83,0x6A,0x07,0x7B,0x29,0x7B,0x09,0x83,0x4A,0x83,0x6A,0x7B,0x29,
+    0x72,0xE8,0x6A,0xC8,0x6A,0xC7,0x83,0x72,0xC7,0x80,0x72,0xC8,0x07,0x72,0xE8,0x72,
+    0xC8,0x72,0xE8,0x7A,0xE8,0x7B,0x09,0x7B,0x29,0x83,0x4A,0x83,0x6A,0x80,0x8B,0x6A,
+    0x01,0x8B,0x8A,0x8B,0x6A,0x80,0x83,0x6A,0x07,0x8B,0x6A,0x8B,0x8B,0x93,0xCC,0x9C,
+    0x0C,0xA4,0x2D,0xAC,0x6E,0xAC,0xAF,0xB4,0xD0,0x82,0xB4,0xF0,0x01,0xBD,0x10,0xBD,
+    0x31,0x81,0xC5,0x51,0x01,0xC5,0x52,0xC5,0x92,0x80,0xCD,0xB3,0x00,0xCD,0x93,0x80,
+    0xC5,0x92,0x07,0xC5,0xB3,0xC5,0x92,0xB5,0x11,0x9C,0x6E,0x8B,0xCB,0x6A,0xC8,0x52,
+    0x25,0x49,0xE4,0x81,0x49,0xC4,0x0A,0x49,0xE4,0x51,0xE5,0x5A,0x47,0x62,0x88,0x6A,
+    0xA8,0x72,0xE9,0x7B,0x2A,0x83,0x6B,0x83,0x8C,0x7B,0x6B,0x73,0x2A,0x85,0x5A,0x89,
+    0x06,0x62,0x68,0x7A,0x08,0x91,0x66,0xB0,0xA4,0xD0,0x64,0xE0,0x23,0xE8,0x23,0x80,
+    0xF0,0x23,0x00,0xF0,0x22,0x83,0xF0,0x03,0x05,0xF0,0x23,0xE8,0x23,0xE8,0x22,0xE0,
+    0x22,0xD0,0x01,0xC8,0x01,0x80,0xD0,0x01,0x80,0xD8,0x02,0x00,0xD8,0x22,0x80,0xD0,
+    0x22,0x04,0xC8,0x42,0xB1,0x04,0xAA,0x27,0x9A,0xE9,0x83,0x09,0x80,0x7B,0x29,0x01,
+    0x7B,0x08,0x7B,0x09,0x80,0x7B,0x29,0x00,0x7B,0x49,0x86,0x83,0x6A,0x80,0x8B,0x8B,
+    0x00,0x7B,0x4A,0x81,0x72,0xE8,0x80,0x72,0xC8,0x82,0x72,0xC7,0x81,0x72,0xC8,0x05,
+    0x7A,0xE8,0x7B,0x29,0x83,0x49,0x83,0x6A,0x8B,0x8B,0x93,0xCB,0x81,0x93,0xCC,0x0A,
+    0x93,0xAB,0x8B,0x8A,0x8B,0x6A,0x83,0x6A,0x8B,0x6A,0x8B,0xAB,0x93,0xCC,0x9C,0x0D,
+    0xA4,0x4E,0xAC,0x8E,0xAC,0xAF,0x80,0xB4,0xD0,0x03,0xB4,0xF0,0xBC,0xF0,0xBD,0x10,
+    0xBD,0x31,0x81,0xC5,0x51,0x01,0xC5,0x72,0xCD,0x92,0x80,0xCD,0xB3,0x00,0xCD,0x93,
+    0x80,0xC5,0x93,0x08,0xCD,0xD3,0xC5,0x93,0xA4,0x8F,0x83,0x8B,0x7B,0x6A,0x7B,0x4A,
+    0x62,0xA7,0x52,0x05,0x49,0xE4,0x81,0x49,0xC4,0x07,0x51,0xE5,0x5A,0x47,0x62,0x87,
+    0x62,0xA8,0x6A,0xC8,0x6A,0xC9,0x72,0xE9,0x73,0x2A,0x80,0x83,0x8C,0x85,0x5A,0x88,
+    0x06,0x62,0x68,0x72,0x28,0x91,0x86,0xB0,0xC4,0xC8,0x64,0xE0,0x23,0xE8,0x23,0x80,
+    0xF0,0x23,0x87,0xF0,0x03,0x05,0xE8,0x22,0xD8,0x22,0xD0,0x01,0xC8,0x01,0xD0,0x21,
+    0xD8,0x01,0x80,0xD8,0x02,0x09,0xD0,0x22,0xD0,0x42,0xC0,0x62,0xA8,0xE3,0xA2,0x07,
+    0x92,0xC9,0x7B,0x09,0x73,0x29,0x7B,0x29,0x83,0x29,0x80,0x83,0x4A,0x87,0x83,0x6A,
+    0x03,0x8B,0x8B,0x8B,0xAB,0x8B,0x8B,0x83,0x4A,0x80,0x7B,0x29,0x01,0x73,0x08,0x7B,
+    0x08,0x83,0x72,0xE8,0x00,0x7B,0x08,0x80,0x7B,0x09,0x04,0x83,0x49,0x8B,0x6A,0x8B,
+    0x8B,0x93,0xCC,0x9B,0xEC,0x80,0x9C,0x2D,0x80,0x9C,0x0D,0x10,0x9B,0xEC,0x93,0xCB,
+    0x8B,0xAB,0x8B,0x8B,0x8B,0x6A,0x8B,0x8B,0x93,0xCC,0x9B,0xEC,0xA4,0x2D,0xA4,0x6E,
+    0xAC,0x8E,0xAC,0xAF,0xB4,0xAF,0xB4,0xD0,0xB4,0xF0,0xBD,0x10,0xBD,0x31,0x81,0xC5,
+    0x52,0x80,0xC5,0x72,0x01,0xCD,0x93,0xCD,0xB3,0x80,0xCD,0x93,0x10,0xC5,0x93,0xCD,
+    0xB3,0xC5,0x92,0x94,0x2D,0x73,0x09,0x62,0x86,0x6A,0xE8,0x7B,0x4A,0x6A,0xC8,0x5A,
+    0x46,0x49,0xE5,0x49,0xC4,0x49,0xE5,0x52,0x05,0x5A,0x47,0x62,0x87,0x62,0xA8,0x81,
+    0x6A,0xC8,0x02,0x6A,0xC9,0x73,0x2A,0x7B,0x6B,0x80,0x5A,0x68,0x82,0x52,0x68,0x07,
+    0x52,0x88,0x5A,0x68,0x72,0x48,0x89,0xA7,0xA8,0xC4,0xC8,0x84,0xE0,0x44,0xE8,0x23,
+    0x81,0xF0,0x23,0x86,0xF0,0x03,0x05,0xF0,0x02,0xE0,0x22,0xD0,0x21,0xC8,0x01,0xC8,
+    0x21,0xD0,0x01,0x80,0xD8,0x01,0x09,0xD0,0x22,0xD0,0x42,0xC0,0x62,0xA0,0xE3,0x99,
+    0xE6,0x8A,0x88,0x73,0x09,0x73,0x29,0x7B,0x49,0x83,0x4A,0x80,0x83,0x6A,0x80,0x83,
+    0x4A,0x85,0x83,0x6A,0x04,0x8B,0x8B,0x8B,0xAB,0x8B,0x8B,0x83,0x8A,0x83,0x6A,0x80,
+    0x83,0x4A,0x84,0x7B,0x29,0x08,0x83,0x29,0x83,0x49,0x83,0x4A,0x8B,0x8A,0x93,0xAB,
+    0x93,0xEC,0x9C,0x0D,0xA4,0x4D,0xA4,0x6E,0x81,0xA4,0x4E,0x03,0xA4,0x2D,0x9C,0x0C,
+    0x93,0xEC,0x93,0xAB,0x80,0x8B,0xAB,0x0A,0x93,0xCC,0x9B,0xEC,0x9C,0x2D,0xA4,0x4E,
+    0xA4,0x6E,0xAC,0x6E,0xAC,0x8F,0xB4,0xCF,0xB4,0xF0,0xBD,0x10,0xC5,0x31,0x82,0xC5,
+    0x52,0x01,0xC5,0x72,0xC5,0x92,0x80,0xCD,0x93,0x81,0xCD,0xB3,0x0F,0xC5,0x72,0x94,
+    0x0D,0x6A,0xE8,0x5A,0x25,0x52,0x05,0x62,0x66,0x7B,0x29,0x73,0x09,0x62,0x67,0x51,
+    0xE5,0x49,0xE5,0x52,0x05,0x5A,0x47,0x62,0x87,0x62,0xA8,0x6A,0xA8,0x80,0x6A,0xC8,
+    0x80,0x6A,0xC9,0x00,0x6A,0xEA,0x85,0x52,0x68,0x06,0x5A,0x68,0x72,0x48,0x89,0xA7,
+    0xA8,0xE5,0xC8,0x84,0xE0,0x44,0xE8,0x23,0x81,0xF0,0x23,0x87,0xF0,0x03,0x04,0xE8,
+    0x22,0xD8,0x22,0xC8,0x01,0xC8,0x21,0xD0,0x01,0x80,0xD8,0x01,0x08,0xD0,0x22,0xC8,
+    0x42,0xB8,0x62,0x98,0xE3,0x91,0xC6,0x82,0x68,0x72,0xE8,0x73,0x29,0x7B,0x49,0x86,
+    0x83,0x4A,0x82,0x83,0x6A,0x00,0x8B,0x8B,0x80,0x8B,0xAB,0x80,0x8B,0x8B,0x02,0x83,
+    0x6A,0x8B,0x8B,0x8B,0x8A,0x80,0x83,0x6A,0x80,0x83,0x4A,0x01,0x83,0x6A,0x8B,0x6A,
+    0x80,0x8B,0x8B,0x04,0x93,0xAB,0x93,0xEC,0x9C,0x0D,0xA4,0x2D,0xA4,0x6E,0x80,0xAC,
+    0x8F,0x80,0xAC,0x6E,0x03,0xA4,0x4E,0xA4,0x2D,0x9C,0x0D,0x9B,0xEC,0x80,0x93,0xEC,
+    0x02,0x9C,0x0C,0x9C,0x0D,0x9C,0x2D,0x80,0xA4,0x4E,0x05,0xAC,0x6E,0xAC,0x8F,0xB4,
+    0xAF,0xBC,0xF0,0xBD,0x10,0xC5,0x31,0x82,0xC5,0x51,0x00,0xC5,0x52,0x80,0xC5,0x72,
+    0x80,0xC5,0x92,0x0F,0xC5,0x93,0xCD,0xB3,0xB5,0x31,0x93,0xEC,0x7B,0x29,0x5A,0x46,
+    0x51,0xE4,0x49,0xE4,0x5A,0x26,0x72,0xE8,0x73,0x2A,0x62,0xA8,0x5A,0x26,0x52,0x26,
+    0x5A,0x47,0x62,0x87,0x80,0x62,0xA8,0x00,0x6A,0xC8,0x81,0x6A,0xC9,0x00,0x6A,0xE9,
+    0x85,0x52,0x68,0x05,0x5A,0x68,0x72,0x48,0x89,0xA7,0xA0,0xE5,0xC0,0x84,0xD8,0x44,
+    0x80,0xE8,0x24,0x89,0xF0,0x03,0x01,0xE8,0x23,0xD8,0x22,0x80,0xC8,0x21,0x0B,0xD0,
+    0x01,0xD0,0x21,0xD8,0x01,0xD0,0x22,0xC8,0x42,0xB0,0x83,0x99,0x04,0x89,0xC6,0x7A,
+    0x67,0x72,0xC8,0x73,0x09,0x7B,0x29,0x81,0x83,0x4A,0x82,0x83,0x49,0x00,0x83,0x4A,
+    0x81,0x83,0x6A,0x02,0x8B,0x8A,0x8B,0x8B,0x8B,0xAB,0x82,0x8B,0x8B,0x86,0x8B,0xAB,
+    0x06,0x93,0xAC,0x93,0xCC,0x9B,0xEC,0x9C,0x0D,0xA4,0x2D,0xA4,0x4E,0xAC,0x8E,0x82,
+    0xAC,0x8F,0x00,0xAC,0x6E,0x80,0xA4,0x4E,0x00,0xA4,0x2D,0x80,0x9C,0x0D,0x80,0x9C,
+    0x2D,0x81,0xA4,0x4E,0x04,0xAC,0x6E,0xB4,0x8F,0xB4,0xCF,0xBC,0xF0,0xBD,0x10,0x82,
+    0xC5,0x31,0x80,0xBD,0x31,0x80,0xBD,0x51,0x08,0xC5,0x52,0xC5,0x72,0xC5,0x92,0xCD,
+    0xB3,0xB4,0xF0,0x8B,0xAB,0x7B,0x4A,0x62,0x87,0x52,0x05,0x80,0x49,0xC4,0x03,0x52,
+    0x05,0x62,0xA8,0x73,0x09,0x6A,0xC8,0x80,0x5A,0x47,0x01,0x62,0x88,0x62,0xA8,0x80,
+    0x6A,0xA9,0x82,0x6A,0xC9,0x85,0x52,0x68,0x07,0x5A,0x68,0x72,0x48,0x81,0xC8,0x99,
+    0x06,0xB0,0xA5,0xC8,0x64,0xD8,0x44,0xE8,0x24,0x89,0xF0,0x03,0x01,0xE8,0x23,0xD8,
+    0x22,0x81,0xC8,0x01,0x80,0xD0,0x21,0x09,0xD0,0x42,0xB8,0x62,0xA8,0xC3,0x91,0x44,
+    0x81,0xE6,0x7A,0x67,0x72,0xC8,0x72,0xE9,0x73,0x09,0x72,0xE8,0x80,0x7B,0x09,0x82,
+    0x7B,0x29,0x00,0x83,0x49,0x82,0x83,0x6A,0x81,0x8B,0x8A,0x02,0x83,0x6A,0x8B,0x8A,
+    0x8B,0x8B,0x81,0x8B,0xAB,0x82,0x93,0xCB,0x06,0x93,0xCC,0x93,0xEC,0x9C,0x0C,0x9C,
+    0x2D,0xA4,0x4D,0xA4,0x4E,0xAC,0x6E,0x84,0xAC,0x8F,0x01,0xAC,0x6E,0xA4,0x4E,0x81,
+    0xA4,0x2D,0x80,0xA4,0x2E,0x80,0xA4,0x4E,0x06,0xAC,0x6E,0xAC,0x8F,0xB4,0xAF,0xB4,
+    0xCF,0xBC,0xF0,0xBD,0x10,0xC5,0x10,0x80,0xBD,0x10,0x81,0xBD,0x11,0x81,0xBD,0x31,
+    0x08,0xBD,0x51,0xC5,0x72,0xCD,0xB3,0xB4,0xF0,0x7B,0x4A,0x6A,0xC7,0x72,0xE9,0x62,
+    0x67,0x51,0xE5,0x80,0x49,0xC4,0x04,0x49,0xE5,0x5A,0x67,0x72,0xE9,0x73,0x09,0x6A,
+    0xC8,0x81,0x62,0xA8,0x80,0x6A,0xA9,0x81,0x6A,0xC9,0x83,0x52,0x48,0x0A,0x52,0x68,
+    0x52,0x48,0x5A,0x48,0x6A,0x48,0x79,0xE7,0x89,0x46,0x98,0xE5,0xB8,0xA4,0xD0,0x84,
+    0xE0,0x44,0xE8,0x23,0x88,0xF0,0x03,0x04,0xE8,0x23,0xD8,0x22,0xD0,0x01,0xC8,0x01,
+    0xC8,0x21,0x80,0xC8,0x41,0x06,0xC8,0x62,0xB0,0xA2,0x99,0x03,0x81,0xA4,0x7A,0x06,
+    0x72,0x67,0x72,0xA7,0x82,0x72,0xC8,0x02,0x72,0xE8,0x7B,0x08,0x7B,0x09,0x81,0x7B,
+    0x29,0x80,0x83,0x4A,0x80,0x83,0x49,0x81,0x83,0x4A,0x03,0x83,0x49,0x83,0x4A,0x83,
+    0x6A,0x8B,0x8B,0x81,0x8B,0xAB,0x80,0x93,0xCB,0x00,0x93,0xCC,0x80,0x93,0xEC,0x05,
+    0x9C,0x0D,0xA4,0x4D,0xA4,0x4E,0xA4,0x6E,0xAC,0x6E,0xAC,0x8E,0x83,0xAC,0x8F,0x01,
+    0xAC,0x6E,0xA4,0x4E,0x81,0xA4,0x2D,0x00,0xA4,0x2E,0x80,0xA4,0x4E,0x05,0xA4,0x6E,
+    0xAC,0x6E,0xAC,0x8F,0xB4,0xAF,0xB4,0xCF,0xBC,0xEF,0x82,0xBC,0xF0,0x81,0xBD,0x10,
+    0x80,0xB5,0x10,0x0A,0xBD,0x11,0xBD,0x31,0xBD,0x51,0xC5,0x92,0xB5,0x10,0x83,0x8A,
+    0x62,0x86,0x6A,0xA8,0x72,0xE9,0x5A,0x67,0x51,0xE5,0x80,0x49,0xC4,0x05,0x49,0xE5,
+    0x5A,0x46,0x73,0x2A,0x83,0x6B,0x73,0x0A,0x6A,0xC9,0x80,0x62,0xA8,0x00,0x6A,0xA9,
+    0x81,0x6A,0xC9,0x85,0x52,0x48,0x80,0x5A,0x47,0x06,0x6A,0x07,0x79,0xA6,0x89,0x25,
+    0xA0,0xC4,0xC0,0x84,0xD8,0x64,0xE8,0x23,0x83,0xF0,0x03,0x82,0xF0,0x02,0x03,0xF0,
+    0x03,0xE8,0x23,0xE0,0x22,0xD0,0x01,0x80,0xC8,0x01,0x08,0xC8,0x41,0xC8,0x42,0xB8,
+    0x62,0xA8,0xC3,0x99,0x44,0x81,0xC5,0x72,0x26,0x6A,0x46,0x6A,0x67,0x80,0x6A,0x87,
+    0x80,0x6A,0xA7,0x01,0x72,0xC7,0x72,0xC8,0x80,0x72,0xE8,0x01,0x7B,0x08,0x7B,0x09,
+    0x87,0x7B,0x29,0x02,0x83,0x49,0x83,0x6A,0x8B,0x8A,0x80,0x8B,0x8B,0x00,0x8B,0xAB,
+    0x80,0x93,0xCB,0x03,0x93,0xEC,0x9C,0x0C,0x9C,0x2D,0xA4,0x4E,0x81,0xA4,0x6E,0x84,
+    0xAC,0x6E,0x00,0xA4,0x4E,0x84,0xA4,0x2D,0x04,0xA4,0x4E,0xAC,0x4E,0xAC,0x6E,0xAC,
+    0x8E,0xB4,0xAF,0x84,0xB4,0xCF,0x81,0xB4,0xEF,0x00,0xB4,0xF0,0x80,0xB5,0x10,0x0A,
+    0xBD,0x31,0xC5,0x51,0xCD,0x92,0xB5,0x10,0x8B,0xCB,0x72,0xC8,0x5A,0x66,0x62,0xA7,
+    0x6A,0xE8,0x5A,0x67,0x52,0x05,0x81,0x49,0xE5,0x05,0x5A,0x47,0x7B,0x2A,0x8B,0xAC,
+    0x7B,0x4B,0x6A,0xE9,0x62,0xA8,0x81,0x6A,0xA9,0x00,0x6A,0xC9,0x82,0x52,0x48,0x80,
+    0x52,0x47,0x0A,0x52,0x48,0x52,0x47,0x5A,0x47,0x62,0x27,0x69,0xE6,0x81,0x65,0x91,
+    0x04,0xB0,0xA4,0xC8,0x84,0xD8,0x63,0xE8,0x23,0x82,0xF0,0x22,0x82,0xF0,0x02,0x0D,
+    0xF0,0x22,0xE8,0x22,0xD8,0x42,0xC8,0x21,0xC0,0x00,0xC0,0x21,0xC0,0x61,0xC0,0x82,
+    0xB0,0xC2,0x99,0x23,0x91,0x84,0x7A,0x05,0x6A,0x26,0x6A,0x46,0x80,0x6A,0x66,0x80,
+    0x6A,0x86,0x80,0x6A,0x87,0x00,0x6A,0xA7,0x80,0x72,0xC7,0x80,0x72,0xE8,0x01,0x7B,
+    0x08,0x7B,0x09,0x86,0x7B,0x29,0x00,0x83,0x4A,0x80,0x83,0x6A,0x00,0x8B,0x8A,0x80,
+    0x8B,0xAB,0x04,0x93,0xCB,0x93,0xCC,0x93,0xEC,0x9C,0x0D,0xA4,0x2D,0x83,0xA4,0x4D,
+    0x81,0xA4,0x4E,0x80,0xA4,0x2D,0x80,0x9C,0x0D,0x81,0x9B,0xEC,0x05,0x9C,0x0D,0xA4,
+    0x2D,0xA4,0x4D,0xAC,0x4E,0xAC,0x6E,0xAC,0x8E,0x80,0xB4,0x8E,0x00,0xB4,0x8F,0x81,
+    0xB4,0xAF,0x81,0xB4,0xCF,0x00,0xB4,0xEF,0x80,0xBD,0x10,0x0B,0xBD,0x31,0xC5,0x51,
+    0xCD,0x72,0xB4,0xF0,0x8B,0xAB,0x72,0xE8,0x62,0x67,0x5A,0x26,0x62,0x87,0x6A,0xC8,
+    0x5A,0x46,0x52,0x05,0x80,0x49,0xE5,0x05,0x49,0xC5,0x62,0x67,0x7B,0x4B,0x8B,0xAD,
+    0x83,0x6B,0x6A,0xE9,0x81,0x6A,0xA9,0x00,0x62,0xC9,0x85,0x52,0x27,0x80,0x52,0x47,
+    0x07,0x5A,0x27,0x62,0x07,0x71,0xA6,0x81,0x65,0x99,0x04,0xB0,0xC4,0xC8,0xA4,0xD8,
+    0x63,0x80,0xE0,0x42,0x00,0xE8,0x42,0x83,0xE8,0x22,0x0D,0xE8,0x42,0xE0,0x42,0xD0,
+    0x61,0xC0,0x40,0xB8,0x40,0xB8,0x60,0xB0,0x81,0xA8,0xC2,0x99,0x23,0x89,0xA4,0x79,
+    0xE5,0x72,0x25,0x6A,0x45,0x62,0x45,0x80,0x62,0x66,0x81,0x6A,0x86,0x02,0x6A,0x87,
+    0x6A,0x86,0x6A,0xA7,0x80,0x72,0xC7,0x80,0x72,0xE8,0x00,0x7B,0x08,0x82,0x7B,0x09,
+    0x83,0x7B,0x29,0x01,0x83,0x49,0x83,0x4A,0x80,0x83,0x6A,0x80,0x8B,0x8B,0x02,0x8B,
+    0xAB,0x93,0xCB,0x93,0xCC,0x85,0x93,0xEC,0x00,0x9B,0xEC,0x83,0x93,0xCC,0x80,0x93,
+    0xAB,0x03,0x93,0xCC,0x9B,0xEC,0x9C,0x0C,0x9C,0x0D,0x80,0xA4,0x2D,0x00,0xAC,0x4D,
+    0x81,0xAC,0x6E,0x03,0xAC,0x8F,0xAC,0x8E,0xB4,0x8F,0xB4,0xAF,0x80,0xB4,0xCF,0x80,
+    0xBD,0x10,0x00,0xBD,0x30,0x80,0xC5,0x51,0x0A,0xCD,0x72,0xB4,0xF0,0x83,0x6A,0x72,
+    0xE8,0x6A,0xC8,0x5A,0x46,0x52,0x05,0x5A,0x46,0x62,0x87,0x5A,0x67,0x52,0x05,0x80,
+    0x49,0xC5,0x08,0x5A,0x26,0x62,0xA8,0x7B,0x4B,0x8B,0xCD,0x83,0x6B,0x6A,0xE9,0x6A,
+    0xA9,0x6A,0xC9,0x62,0xA9,0x83,0x4A,0x27,0x81,0x52,0x27,0x0D,0x52,0x47,0x52,0x27,
+    0x5A,0x07,0x61,0xE6,0x71,0xC5,0x81,0x64,0x91,0x43,0xA9,0x44,0xB9,0x23,0xC0,0xE2,
+    0xC8,0xC1,0xD0,0xA2,0xD8,0x82,0xD8,0x62,0x81,0xD8,0x82,0x0C,0xD0,0x61,0xC8,0x81,
+    0xB8,0xA1,0xA8,0xA0,0xA0,0xC0,0xA0,0xE0,0x99,0x21,0x91,0x42,0x89,0xA3,0x79,0xE4,
+    0x72,0x05,0x6A,0x25,0x6A,0x45,0x80,0x62,0x65,0x80,0x62,0x66,0x82,0x6A,0x86,0x80,
+    0x6A,0xA7,0x00,0x72,0xC7,0x80,0x72,0xE8,0x00,0x7B,0x08,0x82,0x72,0xE8,0x81,0x7B,
+    0x08,0x00,0x7B,0x09,0x81,0x7B,0x29,0x00,0x83,0x49,0x81,0x83,0x4A,0x81,0x83,0x6A,
+    0x84,0x8B,0x6A,0x00,0x83,0x6A,0x82,0x83,0x4A,0x82,0x8B,0x6A,0x02,0x8B,0x8A,0x93,
+    0xAB,0x93,0xCB,0x80,0x9B,0xEC,0x01,0xA4,0x0C,0xA4,0x2D,0x80,0xA4,0x4D,0x07,0xAC,
+    0x4D,0xAC,0x6E,0xAC,0x8E,0xB4,0x8E,0xB4,0xAF,0xBC,0xCF,0xBC,0xEF,0xBD,0x10,0x80,
+    0xC5,0x30,0x04,0xC5,0x50,0xC5,0x51,0xCD,0x52,0xB4,0xD0,0x8B,0x6A,0x80,0x6A,0xC8,
+    0x10,0x62,0xA7,0x52,0x25,0x51,0xE5,0x5A,0x46,0x62,0x88,0x5A,0x67,0x51,0xE5,0x49,
+    0xC5,0x52,0x26,0x5A,0x47,0x6A,0xA9,0x7B,0x2A,0x83,0x8C,0x7B,0x4B,0x72,0xEA,0x6A,
+    0xC9,0x62,0xC9,0x83,0x4A,0x27,0x01,0x4A,0x07,0x52,0x07,0x82,0x52,0x27,0x0A,0x52,
+    0x26,0x62,0x05,0x6A,0x03,0x7A,0x24,0x9A,0xA5,0xA2,0x64,0xA1,0xE2,0xA9,0x82,0xB1,
+    0x61,0xB9,0x21,0xC1,0x01,0x81,0xB9,0x02,0x09,0xB1,0x01,0xA9,0x41,0x99,0x61,0x91,
+    0xA1,0x92,0x01,0x92,0x42,0x82,0x22,0x71,0xE2,0x72,0x03,0x72,0x04,0x80,0x6A,0x25,
+    0x80,0x62,0x65,0x82,0x62,0x66,0x81,0x6A,0x86,0x80,0x6A,0xA7,0x01,0x6A,0xC7,0x72,
+    0xC7,0x86,0x72,0xE8,0x02,0x73,0x08,0x7B,0x08,0x7B,0x09,0x86,0x7B,0x29,0x82,0x83,
+    0x29,0x80,0x83,0x49,0x84,0x83,0x29,0x80,0x83,0x49,0x08,0x83,0x4A,0x83,0x6A,0x8B,
+    0x6A,0x8B,0x8A,0x93,0xAA,0x93,0xAB,0x9B,0xCB,0x9B,0xEC,0xA4,0x0C,0x80,0xA4,0x2C,
+    0x07,0xAC,0x2C,0xAC,0x6D,0xB4,0x8D,0xB4,0xAE,0xBC,0xCE,0xBC,0xEE,0xBC,0xEF,0xC5,
+    0x2F,0x80,0xC5,0x30,0x10,0xC5,0x50,0xC5,0x51,0xCD,0x51,0xBC,0xF0,0x8B,0x8B,0x6A,
+    0x87,0x62,0x67,0x6A,0xA8,0x62,0x67,0x52,0x05,0x49,0xE5,0x5A,0x47,0x62,0x88,0x5A,
+    0x47,0x51,0xE6,0x52,0x26,0x5A,0x67,0x80,0x62,0x88,0x04,0x72,0xEA,0x83,0x8C,0x83,
+    0x6B,0x72,0xEA,0x6A,0xC9,0x81,0x4A,0x27,0x81,0x4A,0x07,0x81,0x52,0x07,0x0B,0x52,
+    0x26,0x4A,0x26,0x52,0x45,0x52,0x44,0x5A,0x63,0x6B,0x04,0x83,0x85,0x83,0x65,0x8B,
+    0x24,0x92,0xC3,0xA2,0x82,0xAA,0x62,0x80,0xAA,0x43,0x0D,0xA2,0x43,0x9A,0x43,0x9A,
+    0x63,0x92,0x83,0x82,0xC3,0x83,0x23,0x83,0x63,0x83,0x84,0x73,0x24,0x62,0x82,0x62,
+    0x43,0x6A,0x44,0x6A,0x45,0x62,0x45,0x82,0x62,0x65,0x82,0x62,0x66,0x01,0x62,0x86,
+    0x6A,0x87,0x80,0x6A,0xA7,0x01,0x6A,0xC7,0x72,0xC8,0x85,0x72,0xE8,0x00,0x73,0x08,
+    0x80,0x7B,0x08,0x86,0x7B,0x29,0x82,0x83,0x29,0x82,0x83,0x28,0x81,0x83,0x29,0x80,
+    0x83,0x49,0x82,0x8B,0x69,0x00,0x93,0x8A,0x80,0x93,0xAA,0x0B,0x9B,0xCB,0x9B,0xEB,
+    0xA4,0x0C,0xA4,0x2C,0xA4,0x0C,0xAC,0x2C,0xAC,0x6D,0xB4,0x8D,0xBC,0xCE,0xBC,0xEE,
+    0xC5,0x0E,0xC5,0x0F,0x81,0xC5,0x2F,0x17,0xCD,0x30,0xC5,0x30,0xC5,0x51,0xBC,0xF0,
+    0x8B,0x8B,0x6A,0x87,0x62,0x47,0x6A,0x87,0x6A,0x88,0x5A,0x47,0x49,0xC5,0x49,0xE5,
+    0x5A,0x47,0x62,0x88,0x5A,0x47,0x5A,0x27,0x62,0x67,0x62,0x88,0x62,0xA8,0x62,0x88,
+    0x72,0xEA,0x83,0x8C,0x7B,0x6C,0x73,0x0A,0x87,0x4A,0x07,0x05,0x4A,0x06,0x52,0x26,
+    0x52,0x65,0x52,0x64,0x52,0xC3,0x6B,0x84,0x80,0x6C,0x04,0x02,0x73,0xC3,0x73,0x82,
+    0x83,0x82,0x80,0x8B,0x83,0x01,0x83,0x83,0x7B,0x63,0x80,0x6B,0x43,0x0B,0x6B,0x83,
+    0x6B,0xC4,0x6C,0x04,0x63,0xE3,0x64,0x03,0x63,0xA3,0x5A,0xE2,0x5A,0x83,0x62,0x64,
+    0x62,0x45,0x5A,0x65,0x62,0x65,0x85,0x62,0x66,0x80,0x62,0x86,0x80,0x6A,0xA7,0x81,
+    0x6A,0xC7,0x00,0x72,0xC8,0x82,0x72,0xE8,0x80,0x73,0x08,0x01,0x7B,0x08,0x7B,0x28,
+    0x86,0x7B,0x29,0x81,0x83,0x29,0x00,0x83,0x28,0x82,0x83,0x48,0x01,0x83,0x28,0x83,
+    0x29,0x80,0x83,0x49,0x81,0x8B,0x69,0x80,0x8B,0x89,0x80,0x93,0xAA,0x0C,0x9B,0xCA,
+    0x9B,0xCB,0xA3,0xEB,0xA4,0x0C,0xAC,0x2C,0xAC,0x4C,0xAC,0x6C,0xB4,0x8D,0xBC,0xCD,
+    0xBC,0xEE,0xC5,0x0E,0xC5,0x2F,0xCD,0x2F,0x81,0xCD,0x4F,0x00,0xCD,0x2F,0x80,0xC5,
+    0x30,0x0B,0xBC,0xCF,0x8B,0x8B,0x6A,0x87,0x62,0x26,0x62,0x47,0x62,0x87,0x5A,0x67,
+    0x49,0xE5,0x49,0xC5,0x52,0x06,0x5A,0x67,0x62,0xA8,0x80,0x62,0x68,0x01,0x62,0x88,
+    0x62,0xA8,0x80,0x6A,0xA9,0x02,0x73,0x0A,0x83,0xAC,0x7B,0x8C,0x80,0x4A,0x07,0x81,
+    0x4A,0x06,0x81,0x4A,0x07,0x80,0x4A,0x06,0x1A,0x52,0x46,0x5A,0x86,0x5A,0xA4,0x5A,
+    0xE3,0x6B,0xA4,0x64,0x23,0x64,0x43,0x5C,0x02,0x5B,0xA0,0x63,0xC1,0x6C,0x02,0x64,
+    0x03,0x5C,0x03,0x4B,0xC2,0x33,0x80,0x33,0x60,0x3B,0x82,0x4C,0x04,0x54,0x44,0x54,
+    0x43,0x5C,0x23,0x5B,0xC3,0x5B,0x03,0x5A,0xA3,0x5A,0x64,0x62,0x65,0x5A,0x65,0x87,
+    0x62,0x66,0x01,0x62,0x86,0x6A,0x86,0x81,0x6A,0xA7,0x80,0x6A,0xC7,0x02,0x72,0xE7,
+    0x72,0xE8,0x72,0xE7,0x80,0x72,0xE8,0x02,0x73,0x08,0x7B,0x08,0x7B,0x28,0x83,0x7B,
+    0x29,0x83,0x83,0x29,0x85,0x83,0x28,0x02,0x8B,0x28,0x8B,0x48,0x8B,0x49,0x80,0x8B,
+    0x69,0x03,0x93,0x89,0x93,0xAA,0x93,0xCA,0x9B,0xEA,0x80,0x9B,0xEB,0x80,0xA4,0x0B,
+    0x07,0xAC,0x2C,0xAC,0x4C,0xB4,0x8C,0xB4,0xAD,0xBC,0xCD,0xBC,0xEE,0xC5,0x0E,0xC5,
+    0x2E,0x84,0xCD,0x4F,0x0E,0xC5,0x2F,0xC5,0x30,0xBC,0xCF,0x8B,0xAB,0x72,0xA8,0x62,
+    0x26,0x5A,0x26,0x5A,0x46,0x62,0x67,0x5A,0x47,0x49,0xE6,0x49,0xA5,0x51,0xE6,0x62,
+    0x88,0x6A,0xA8,0x80,0x62,0x88,0x80,0x6A,0xA8,0x03,0x6A,0xA9,0x6A,0xC9,0x73,0x2A,
+    0x83,0xAC,0x80,0x4A,0x07,0x86,0x4A,0x06,0x19,0x52,0x46,0x5A,0xA6,0x5A,0xC5,0x5B,
+    0x04,0x63,0xE4,0x64,0x23,0x5C,0x43,0x53,0xE1,0x4B,0xA0,0x53,0xE1,0x54,0x22,0x54,
+    0x42,0x44,0x42,0x2B,0xE1,0x1B,0xA0,0x1B,0x80,0x2B,0xA2,0x3B,0xE3,0x4C,0x44,0x54,
+    0x63,0x54,0x43,0x53,0xE3,0x53,0x23,0x5A,0xA3,0x5A,0x64,0x62,0x65,0x87,0x62,0x66,
+    0x82,0x6A,0x86,0x81,0x6A,0xA7,0x82,0x72,0xC7,0x01,0x72,0xE7,0x72,0xE8,0x80,0x7B,
+    0x08,0x00,0x7B,0x28,0x82,0x7B,0x29,0x83,0x83,0x29,0x83,0x83,0x28,0x80,0x83,0x29,
+    0x00,0x8B,0x48,0x80,0x8B,0x49,0x80,0x8B,0x69,0x06,0x93,0x89,0x93,0xA9,0x9B,0xCA,
+    0x9B,0xEB,0xA4,0x0B,0xA4,0x2B,0xA4,0x2C,0x80,0xAC,0x4C,0x06,0xAC,0x6D,0xB4,0x8D,
+    0xB4,0xAD,0xBC,0xCE,0xC4,0xEE,0xC5,0x0E,0xC5,0x2F,0x80,0xCD,0x4F,0x00,0xCD,0x6F,
+    0x81,0xCD,0x4F,0x80,0xCD,0x2F,0x11,0xC5,0x50,0xB4,0xCE,0x93,0xAB,0x72,0xC8,0x62,
+    0x46,0x5A,0x06,0x52,0x05,0x5A,0x47,0x62,0x68,0x52,0x26,0x49,0xA5,0x49,0xC5,0x5A,
+    0x27,0x62,0x88,0x6A,0xC9,0x6A,0xA9,0x6A,0xC9,0x6A,0xA9,0x81,0x6A,0xC9,0x00,0x7B,
+    0x2B,0x80,0x4A,0x07,0x86,0x4A,0x06,0x18,0x52,0x46,0x5A,0xA6,0x5A,0xE5,0x5B,0x45,
+    0x63,0xE4,0x64,0x44,0x5C,0x22,0x4B,0xC1,0x4B,0x80,0x4B,0xE1,0x54,0x42,0x4C,0x62,
+    0x3C,0x22,0x23,0xC0,0x1B,0x80,0x1B,0xA1,0x2B,0xA2,0x3B,0xA2,0x4C,0x03,0x54,0x44,
+    0x54,0x43,0x5C,0x03,0x53,0x23,0x5A,0xC3,0x62,0x85,0x88,0x62,0x66,0x82,0x6A,0x86,
+    0x01,0x6A,0xA6,0x6A,0xA7,0x83,0x72,0xC7,0x02,0x72,0xE7,0x72,0xE8,0x7B,0x08,0x80,
+    0x7B,0x28,0x82,0x7B,0x29,0x82,0x83,0x29,0x81,0x83,0x28,0x00,0x83,0x48,0x82,0x83,
+    0x49,0x08,0x8B,0x49,0x8B,0x69,0x93,0x69,0x93,0x8A,0x93,0xAA,0x93,0xCA,0x9B,0xCA,
+    0x9C,0x0B,0xA4,0x2B,0x80,0xAC,0x4C,0x00,0xAC,0x6D,0x80,0xB4,0x8D,0x07,0xB4,0xAD,
+    0xBC,0xAE,0xBC,0xCE,0xC5,0x0F,0xC5,0x2F,0xCD,0x2F,0xCD,0x4F,0xCD,0x70,0x80,0xD5,
+    0x70,0x00,0xCD,0x6F,0x81,0xCD,0x4F,0x06,0xCD,0x2F,0xC5,0x30,0xB4,0xAE,0x8B,0x6A,
+    0x72,0xC8,0x6A,0x87,0x5A,0x26,0x80,0x51,0xE5,0x06,0x5A,0x47,0x62,0x68,0x51,0xE6,
+    0x49,0xA5,0x52,0x06,0x5A,0x67,0x6A,0xC9,0x80,0x72,0xE9,0x00,0x6A,0xE9,0x82,0x6A,
+    0xC9,0x80,0x4A,0x07,0x86,0x4A,0x06,0x06,0x52,0x46,0x5A,0xA6,0x5B,0x06,0x63,0x45,
+    0x6B,0xE4,0x6C,0x24,0x5B,0xC2,0x80,0x4B,0x81,0x10,0x53,0xE2,0x54,0x42,0x44,0x62,
+    0x34,0x21,0x1B,0xC0,0x1B,0x81,0x23,0x82,0x33,0x83,0x43,0x83,0x4B,0xC4,0x54,0x03,
+    0x54,0x44,0x5C,0x04,0x5B,0x43,0x5A,0xC4,0x62,0x85,0x62,0x86,0x87,0x62,0x66,0x00,
+    0x6A,0x66,0x82,0x6A,0x86,0x01,0x6A,0xA6,0x72,0xA7,0x82,0x72,0xC7,0x02,0x72,0xE7,
+    0x7A,0xE8,0x7B,0x08,0x80,0x7B,0x28,0x00,0x7B,0x29,0x85,0x83,0x29,0x00,0x83,0x28,
+    0x80,0x83,0x48,0x00,0x8B,0x49,0x83,0x8B,0x69,0x80,0x93,0x8A,0x05,0x93,0xAA,0x9B,
+    0xCA,0x9C,0x0B,0xA4,0x0B,0xA4,0x4C,0xAC,0x6C,0x80,0xB4,0x8D,0x01,0xB4,0xAD,0xBC,
+    0xAE,0x80,0xBC,0xCE,0x02,0xC4,0xEF,0xC5,0x0F,0xCD,0x30,0x81,0xCD,0x50,0x81,0xD5,
+    0x70,0x00,0xCD,0x6F,0x81,0xCD,0x4F,0x10,0xCD,0x2F,0xCD,0x50,0xB4,0xAE,0x8B,0x6A,
+    0x72,0x87,0x6A,0x88,0x5A,0x26,0x51,0xE5,0x49,0xE5,0x52,0x06,0x5A,0x47,0x5A,0x27,
+    0x49,0xC5,0x51,0xE5,0x5A,0x27,0x62,0xA8,0x6A,0xE9,0x80,0x72,0xEA,0x82,0x6A,0xC9,
+    0x80,0x4A,0x07,0x00,0x4A,0x06,0x81,0x49,0xE6,0x82,0x4A,0x06,0x19,0x52,0x46,0x5A,
+    0xA6,0x63,0x26,0x6B,0x86,0x6B,0xE5,0x6B,0xE4,0x5B,0x82,0x53,0x82,0x53,0x83,0x53,
+    0xC3,0x54,0x23,0x3C,0x61,0x24,0x00,0x13,0xA0,0x1B,0x82,0x2B,0x83,0x3B,0x84,0x4B,
+    0x65,0x53,0x65,0x53,0xC4,0x54,0x03,0x5B,0xE4,0x63,0x44,0x5A,0xC4,0x62,0x85,0x6A,
+    0x86,0x80,0x62,0x86,0x85,0x62,0x66,0x00,0x6A,0x66,0x82,0x6A,0x86,0x00,0x6A,0xA6,
+    0x83,0x72,0xC7,0x02,0x72,0xE7,0x7A,0xE8,0x7B,0x08,0x81,0x7B,0x28,0x82,0x83,0x28,
+    0x80,0x83,0x29,0x80,0x83,0x49,0x81,0x8B,0x69,0x00,0x8B,0x89,0x80,0x8B,0x8A,0x02,
+    0x93,0x8A,0x93,0xAA,0x9B,0xCA,0x80,0x9B,0xCB,0x03,0x9C,0x0B,0xA4,0x4C,0xAC,0x6D,
+    0xAC,0x8D,0x81,0xB4,0xAD,0x01,0xBC,0xCE,0xBC,0xEE,0x80,0xC5,0x0F,0x03,0xCD,0x30,
+    0xCD,0x50,0xD5,0x70,0xD5,0x71,0x83,0xD5,0x70,0x00,0xCD,0x6F,0x82,0xCD,0x4F,0x06,
+    0xCD,0x50,0xB4,0xAE,0x8B,0x6A,0x6A,0x87,0x6A,0x67,0x62,0x46,0x51,0xE5,0x80,0x49,
+    0xE5,0x09,0x52,0x06,0x5A,0x47,0x52,0x06,0x51,0xE5,0x52,0x26,0x62,0x88,0x6A,0xC9,
+    0x6A,0xEA,0x72,0xEA,0x6A,0xC9,0x80,0x6A,0xCA,0x01,0x6A,0xC9,0x4A,0x07,0x80,0x4A,
+    0x06,0x81,0x49,0xE6,0x82,0x4A,0x06,0x05,0x52,0x47,0x5A,0xA7,0x63,0x27,0x6B,0x87,
+    0x6B,0xA6,0x6B,0xA5,0x80,0x5B,0x64,0x11,0x53,0x84,0x5B,0xC4,0x54,0x03,0x34,0x21,
+    0x13,0xE0,0x13,0xC1,0x1B,0xA3,0x2B,0xA4,0x43,0x85,0x5B,0x65,0x5B,0x25,0x5B,0x64,
+    0x5B,0xA3,0x63,0xC4,0x6B,0x65,0x62,0xC5,0x62,0x86,0x6A,0x86,0x80,0x62,0x86,0x81,
+    0x6A,0x86,0x82,0x6A,0x66,0x82,0x6A,0x86,0x01,0x6A,0xA6,0x6A,0xA7,0x83,0x72,0xC7,
+    0x01,0x72,0xE7,0x7A,0xE7,0x80,0x7B,0x08,0x80,0x7B,0x28,0x82,0x83,0x28,0x80,0x83,
+    0x49,0x80,0x8B,0x49,0x01,0x8B,0x69,0x93,0x89,0x80,0x93,0x8A,0x81,0x93,0xAA,0x01,
+    0x9B,0xCB,0xA4,0x0B,0x80,0xA4,0x2C,0x03,0xAC,0x4C,0xB4,0x8D,0xB4,0xAE,0xBC,0xCE,
+    0x80,0xBC,0xEE,0x02,0xBC,0xEF,0xC5,0x0F,0xC5,0x2F,0x80,0xCD,0x50,0x01,0xCD,0x70,
+    0xD5,0x71,0x80,0xD5,0x91,0x00,0xD5,0x90,0x81,0xD5,0x70,0x01,0xCD,0x4F,0xCD,0x6F,
+    0x82,0xCD,0x4F,0x10,0xCD,0x50,0xBC,0xAE,0x93,0x8B,0x72,0xA8,0x6A,0x67,0x62,0x47,
+    0x5A,0x06,0x51,0xE5,0x49,0xE5,0x51,0xE6,0x52,0x27,0x52,0x26,0x52,0x06,0x5A,0x27,
+    0x62,0x88,0x6A,0xA9,0x6A,0xC9,0x82,0x6A,0xCA,0x01,0x6A,0xC9,0x4A,0x07,0x87,0x4A,
+    0x06,0x18,0x52,0x47,0x5A,0xA8,0x63,0x28,0x6B,0x48,0x6B,0x67,0x6B,0x86,0x63,0x45,
+    0x5B,0x66,0x5B,0x85,0x5B,0xC5,0x54,0x04,0x33,0xC1,0x0B,0xC0,0x13,0xC1,0x1B,0xA3,
+    0x2B,0xC4,0x43,0x85,0x5B,0x45,0x63,0x25,0x63,0x24,0x63,0x64,0x6B,0x64,0x6B,0x26,
+    0x6A,0xE6,0x6A,0xA6,0x8B,0x6A,0x86,0x80,0x6A,0xA6,0x00,0x72,0xA7,0x83,0x72,0xC7,
+    0x01,0x72,0xE7,0x7A,0xE7,0x80,0x7B,0x08,0x80,0x7B,0x28,0x05,0x83,0x28,0x83,0x48,
+    0x83,0x28,0x83,0x48,0x8B,0x49,0x8B,0x69,0x80,0x8B,0x89,0x00,0x93,0x8A,0x82,0x93,
+    0xAA,0x08,0x93,0xCA,0x9B,0xCB,0xA3,0xEB,0xAC,0x4C,0xAC,0x6D,0xB4,0x8D,0xB4,0xAE,
+    0xBC,0xCE,0xC4,0xEF,0x80,0xC5,0x0F,0x80,0xC5,0x2F,0x80,0xCD,0x50,0x81,0xD5,0x71,
+    0x81,0xD5,0x91,0x00,0xD5,0x90,0x81,0xD5,0x70,0x84,0xCD,0x4F,0x07,0xCD,0x50,0xBC,
+    0xAE,0x93,0x8B,0x72,0xC8,0x6A,0x67,0x62,0x67,0x5A,0x27,0x52,0x06,0x80,0x51,0xE5,
+    0x01,0x52,0x06,0x52,0x26,0x80,0x5A,0x47,0x04,0x62,0x88,0x6A,0xA8,0x6A,0xC9,0x6A,
+    0xE9,0x72,0xE9,0x80,0x6A,0xCA,0x01,0x6A,0xC9,0x4A,0x07,0x81,0x49,0xE6,0x84,0x4A,
+    0x06,0x18,0x52,0x28,0x5A,0x88,0x62,0xE8,0x6B,0x08,0x73,0x48,0x73,0x68,0x73,0x48,
+    0x63,0x67,0x63,0x87,0x63,0xA6,0x4B,0xA4,0x33,0xA2,0x13,0xA1,0x13,0xC2,0x1B,0x83,
+    0x2B,0xA4,0x43,0xA5,0x5B,0x66,0x6B,0x46,0x73,0x26,0x6B,0x45,0x73,0x04,0x72,0xE5,
+    0x72,0xC5,0x6A,0xA5,0x87,0x6A,0x86,0x00,0x6A,0x66,0x81,0x6A,0x86,0x80,0x72,0xA6,
+    0x00,0x72,0xA7,0x83,0x72,0xC7,0x01,0x7A,0xE7,0x7A,0xE8,0x81,0x7B,0x08,0x80,0x83,
+    0x28,0x80,0x83,0x48,0x02,0x8B,0x69,0x8B,0x89,0x93,0x8A,0x80,0x93,0xAA,0x81,0x93,
+    0xCA,0x80,0x9B,0xCA,0x07,0x9B,0xEB,0x9C,0x0B,0xA4,0x2C,0xAC,0x6D,0xB4,0xAE,0xBC,
+    0xCE,0xBC,0xEE,0xC5,0x0F,0x81,0xC5,0x2F,0x80,0xCD,0x50,0x80,0xCD,0x70,0x81,0xD5,
+    0x91,0x02,0xDD,0x91,0xD5,0x91,0xD5,0x90,0x81,0xD5,0x70,0x02,0xD5,0x4F,0xCD,0x4F,
+    0xCD,0x2F,0x82,0xCD,0x4F,0x03,0xCD,0x50,0xBC,0xAE,0x8B,0x6A,0x72,0x87,0x80,0x6A,
+    0x67,0x10,0x62,0x67,0x5A,0x26,0x51,0xE6,0x51,0xE5,0x51,0xE6,0x52,0x06,0x5A,0x47,
+    0x5A,0x67,0x62,0xA8,0x6A,0xA8,0x6A,0xA9,0x6A,0xC9,0x72,0xE9,0x72,0xEA,0x6A,0xCA,
+    0x6A,0xC9,0x49,0xE6,0x82,0x41,0xE6,0x81,0x49,0xE6,0x1D,0x49,0xE5,0x4A,0x06,0x52,
+    0x27,0x62,0x68,0x6A,0xA8,0x6A,0xE8,0x73,0x28,0x7B,0x69,0x7B,0x49,0x73,0x49,0x6B,
+    0x68,0x6B,0x87,0x5B,0x85,0x3B,0x83,0x1B,0x82,0x1B,0xA2,0x1B,0x83,0x2B,0x84,0x43,
+    0xA5,0x73,0xE8,0x94,0x0A,0x9C,0x0A,0x93,0xC9,0x93,0x88,0x8B,0x47,0x7A,0xE6,0x7A,
+    0xA6,0x72,0x86,0x6A,0x86,0x6A,0x85,0x81,0x6A,0x65,0x81,0x6A,0x86,0x00,0x6A,0x66,
+    0x81,0x6A,0x86,0x80,0x72,0xA6,0x00,0x72,0xA7,0x82,0x72,0xC7,0x00,0x72,0xE7,0x80,
+    0x7A,0xE7,0x82,0x7B,0x08,0x00,0x83,0x48,0x81,0x8B,0x69,0x01,0x8B,0x89,0x93,0x8A,
+    0x80,0x93,0xAA,0x03,0x93,0xCA,0x9B,0xCA,0x9B,0xEB,0x9C,0x0B,0x80,0xA4,0x2C,0x05,
+    0xA4,0x4C,0xAC,0x6D,0xB4,0xAD,0xBC,0xCE,0xBC,0xEE,0xC5,0x0F,0x81,0xC5,0x2F,0x00,
+    0xCD,0x4F,0x81,0xCD,0x50,0x01,0xCD,0x70,0xD5,0x90,0x80,0xD5,0x91,0x80,0xDD,0x91,
+    0x00,0xDD,0x70,0x80,0xD5,0x70,0x04,0xD5,0x4F,0xCD,0x4F,0xCD,0x2F,0xCD,0x2E,0xCD,
+    0x2F,0x81,0xCD,0x4F,0x04,0xCD,0x50,0xB4,0xAE,0x8B,0x49,0x6A,0x66,0x62,0x46,0x80,
+    0x62,0x67,0x07,0x5A,0x27,0x51,0xE5,0x49,0xE5,0x51,0xE5,0x52,0x06,0x5A,0x27,0x62,
+    0x67,0x6A,0xA8,0x80,0x6A,0xA9,0x83,0x6A,0xC9,0x00,0x49,0xE6,0x82,0x41,0xE6,0x80,
+    0x49,0xE6,0x80,0x49,0xE5,0x1D,0x4A,0x05,0x5A,0x46,0x62,0x67,0x6A,0xA7,0x72,0xE7,
+    0x7B,0x28,0x83,0x49,0x83,0x69,0x83,0x8A,0x83,0xA9,0x84,0x09,0x7C,0x29,0x53,0xC5,
+    0x23,0x83,0x23,0x63,0x2B,0x63,0x33,0xA4,0x64,0x48,0x9D,0x0C,0xC5,0x8F,0xD5,0x90,
+    0xD5,0x6F,0xCD,0x4F,0xC5,0x0E,0xB4,0x6C,0x9B,0xA9,0x83,0x27,0x72,0xC6,0x6A,0x85,
+    0x6A,0x65,0x80,0x6A,0x85,0x82,0x6A,0x65,0x00,0x6A,0x85,0x80,0x6A,0x86,0x81,0x72,
+    0xA6,0x82,0x72,0xC7,0x02,0x72,0xE7,0x7A,0xE7,0x7B,0x07,0x81,0x7B,0x08,0x02,0x7B,
+    0x07,0x83,0x48,0x8B,0x69,0x81,0x8B,0x89,0x0B,0x93,0x89,0x93,0x8A,0x93,0xAA,0x9B,
+    0xCA,0x9B,0xEA,0x9C,0x0B,0xA4,0x2C,0xAC,0x4C,0xAC,0x6D,0xAC,0x8D,0xB4,0xAD,0xBC,
+    0xCE,0x80,0xBC,0xEE,0x01,0xC5,0x0F,0xC5,0x2F,0x85,0xCD,0x4F,0x01,0xD5,0x90,0xD5,
+    0xB1,0x80,0xDD,0x91,0x06,0xDD,0x90,0xDD,0x70,0xD5,0x70,0xD5,0x4F,0xD5,0x2F,0xCD,
+    0x2F,0xCD,0x0E,0x80,0xC5,0x0E,0x01,0xCD,0x2F,0xCD,0x4F,0x80,0xCD,0x50,0x0C,0xB4,
+    0xAE,0x8B,0x29,0x6A,0x46,0x5A,0x05,0x5A,0x26,0x62,0x47,0x5A,0x26,0x51,0xE6,0x49,
+    0xC5,0x51,0xE5,0x51,0xE6,0x5A,0x26,0x62,0x88,0x86,0x6A,0xC9,0x84,0x41,0xE6,0x00,
+    0x49,0xE6,0x80,0x49,0xE5,0x15,0x52,0x05,0x5A,0x46,0x62,0x67,0x72,0xA7,0x7A,0xE8,
+    0x8B,0x49,0x93,0xAA,0xA3,0xEB,0xAC,0x6C,0xB4,0xED,0xBD,0x6F,0xAD,0x8E,0x74,0x68,
+    0x3B,0x84,0x2B,0x63,0x33,0x43,0x5C,0x27,0x9D,0x8E,0xC5,0xF0,0xDE,0x11,0xE5,0xF1,
+    0xED,0xF1,0x80,0xED,0xF2,0x05,0xE5,0xD1,0xD5,0x70,0xBC,0xCD,0x9B,0xCA,0x83,0x07,
+    0x72,0xA5,0x80,0x6A,0x85,0x83,0x6A,0x65,0x01,0x6A,0x85,0x72,0x85,0x81,0x72,0xA6,
+    0x80,0x72,0xC6,0x01,0x7A,0xC6,0x7A,0xC7,0x81,0x7A,0xE7,0x01,0x7B,0x07,0x7B,0x08,
+    0x80,0x7B,0x07,0x02,0x83,0x28,0x83,0x48,0x8B,0x69,0x80,0x8B,0x89,0x02,0x93,0x89,
+    0x93,0xAA,0x9B,0xCA,0x80,0x9B,0xEB,0x01,0xA4,0x2B,0xAC,0x4C,0x80,0xAC,0x6D,0x02,
+    0xB4,0x8D,0xB4,0xCD,0xBC,0xEE,0x80,0xBD,0x0E,0x01,0xC5,0x2E,0xC5,0x2F,0x84,0xCD,
+    0x4F,0x02,0xCD,0x6F,0xD5,0x90,0xDD,0x90,0x80,0xDD,0xB0,0x11,0xDD,0x90,0xD5,0x70,
+    0xD5,0x6F,0xD5,0x4F,0xCD,0x2E,0xCD,0x0E,0xCC,0xEE,0xC4,0xEE,0xC5,0x0E,0xCD,0x0E,
+    0xCD,0x4F,0xD5,0x70,0xCD,0x50,0xBC,0xAE,0x8B,0x49,0x62,0x26,0x59,0xE5,0x5A,0x06,
+    0x80,0x5A,0x26,0x06,0x52,0x06,0x51,0xE5,0x51,0xC5,0x51,0xE6,0x5A,0x26,0x62,0x88,
+    0x6A,0xC9,0x80,0x6A,0xE9,0x80,0x6A,0xC9,0x03,0x6A,0xA9,0x6A,0xC9,0x72,0xC9,0x41,
+    0xE6,0x82,0x42,0x06,0x18,0x41,0xE6,0x49,0xE5,0x49,0xE4,0x51,0xE4,0x5A,0x05,0x62,
+    0x46,0x72,0xA7,0x83,0x49,0x9B,0xEB,0xB4,0x4D,0xC4,0xCE,0xD5,0x50,0xDD,0xD0,0xDE,
+    0x11,0xDE,0x31,0xCE,0x10,0x84,0x89,0x4B,0x84,0x3B,0x43,0x43,0x64,0x84,0xAA,0xBE,
+    0x10,0xDE,0x11,0xE6,0x11,0xED,0xD1,0x80,0xF5,0xD1,0x80,0xED,0xD1,0x04,0xED,0xF1,
+    0xED,0xD1,0xDD,0x70,0xB4,0x8C,0x8B,0x47,0x81,0x72,0x85,0x81,0x6A,0x65,0x80,0x6A,
+    0x85,0x00,0x72,0xA5,0x80,0x72,0xA6,0x82,0x72,0xC6,0x00,0x7A,0xC7,0x82,0x7A,0xE7,
+    0x81,0x7B,0x07,0x02,0x83,0x07,0x83,0x28,0x8B,0x69,0x80,0x93,0x89,0x02,0x93,0x8A,
+    0x9B,0xAA,0x9B,0xEA,0x80,0x9C,0x0B,0x01,0xA4,0x2C,0xAC,0x4C,0x80,0xAC,0x8D,0x05,
+    0xB4,0xAD,0xB4,0xCD,0xBC,0xED,0xBC,0xEE,0xC5,0x0E,0xC5,0x2E,0x84,0xCD,0x4F,0x80,
+    0xCD,0x6F,0x07,0xD5,0x6F,0xD5,0x90,0xDD,0x90,0xDD,0xB0,0xDD,0x90,0xD5,0x6F,0xD5,
+    0x4F,0xCD,0x4F,0x80,0xCD,0x2E,0x00,0xC5,0x0E,0x80,0xC4,0xEE,0x06,0xCD,0x0E,0xCD,
+    0x4F,0xD5,0x70,0xCD,0x50,0xBC,0xAE,0x8B,0x49,0x62,0x26,0x80,0x59,0xE5,0x01,0x5A,
+    0x06,0x52,0x06,0x80,0x51,0xE6,0x08,0x49,0xC5,0x51,0xE5,0x5A,0x26,0x62,0x88,0x6A,
+    0xC9,0x6A,0xE9,0x6A,0xC9,0x6A,0xE9,0x6A,0xC9,0x80,0x6A,0xA9,0x00,0x72,0xC9,0x83,
+    0x41,0xE6,0x0B,0x41,0xE5,0x49,0xE5,0x51,0xC4,0x5A,0x05,0x6A,0x86,0x8B,0x49,0xA4,
+    0x0C,0xC4,0xEE,0xD5,0x91,0xE5,0xD1,0xE5,0xF1,0xEE,0x11,0x80,0xE6,0x11,0x09,0xE6,
+    0x31,0xD6,0x10,0xA5,0x0C,0x74,0x27,0x63,0xE6,0x6C,0x27,0xA5,0x2C,0xD6,0x31,0xE6,
+    0x11,0xEE,0x12,0x80,0xED,0xD1,0x01,0xED,0xB0,0xED,0xD1,0x81,0xF5,0xF1,0x05,0xED,
+    0xF1,0xE5,0xD1,0xBC,0xAC,0x83,0x06,0x72,0x84,0x72,0x85,0x81,0x72,0x65,0x01,0x6A,
+    0x85,0x72,0x85,0x82,0x72,0xA6,0x00,0x72,0xC6,0x80,0x7A,0xC6,0x84,0x7A,0xE7,0x05,
+    0x7B,0x08,0x7B,0x07,0x83,0x07,0x83,0x28,0x8B,0x69,0x93,0x69,0x80,0x93,0x89,0x05,
+    0x9B,0xAA,0x9B,0xEA,0x9C,0x0B,0xA4,0x2B,0xA4,0x4C,0xAC,0x6C,0x80,0xAC,0x8D,0x01,
+    0xB4,0xAD,0xB4,0xCD,0x80,0xBC,0xED,0x03,0xBD,0x0D,0xC5,0x2E,0xC5,0x4E,0xCD,0x4E,
+    0x80,0xCD,0x4F,0x00,0xCD,0x4E,0x81,0xCD,0x4F,0x81,0xD5,0x6F,0x02,0xDD,0x90,0xD5,
+    0x90,0xD5,0x4F,0x80,0xCD,0x4E,0x80,0xCD,0x2E,0x80,0xC5,0x0E,0x07,0xC4,0xEE,0xCD,
+    0x0E,0xCD,0x4F,0xD5,0x70,0xCD,0x50,0xBC,0xAE,0x8B,0x4A,0x62,0x46,0x80,0x59,0xE5,
+    0x80,0x52,0x06,0x80,0x51,0xE6,0x05,0x51,0xE5,0x51,0xE6,0x52,0x26,0x62,0x88,0x6A,
+    0xC9,0x6A,0xE9,0x81,0x6A,0xC9,0x80,0x6A,0xA9,0x00,0x72,0xC9,0x80,0x49,0xE6,0x82,
+    0x49,0xE5,0x06,0x52,0x25,0x6A,0x86,0x8B,0x6A,0xAC,0x6D,0xCD,0x50,0xDD,0xD2,0xE6,
+    0x12,0x81,0xEE,0x32,0x00,0xF6,0x32,0x80,0xEE,0x12,0x07,0xEE,0x31,0xE6,0x11,0xD5,
+    0xF0,0xBD,0xAE,0xB5,0x8E,0xBD,0xAE,0xD5,0xF0,0xEE,0x32,0x81,0xF6,0x32,0x00,0xF5,
+    0xF1,0x80,0xED,0xD1,0x00,0xED,0xF1,0x81,0xF5,0xF1,0x03,0xED,0xF1,0xDD,0x90,0x9B,
+    0xA9,0x72,0x84,0x84,0x72,0x85,0x81,0x72,0xA6,0x00,0x7A,0xA6,0x80,0x7A,0xC6,0x00,
+    0x7A,0xC7,0x84,0x7A,0xE7,0x80,0x7B,0x07,0x02,0x83,0x07,0x83,0x28,0x8B,0x69,0x80,
+    0x93,0x69,0x02,0x93,0x89,0x9B,0xCA,0x9B,0xEB,0x80,0xA4,0x2B,0x80,0xAC,0x6C,0x03,
+    0xAC,0x8C,0xB4,0x8C,0xB4,0xAD,0xB4,0xCD,0x81,0xBC,0xED,0x01,0xC5,0x2E,0xC5,0x4E,
+    0x80,0xCD,0x4E,0x01,0xCD,0x6F,0xCD,0x4F,0x81,0xCD,0x4E,0x00,0xCD,0x4F,0x82,0xD5,
+    0x6F,0x00,0xD5,0x4F,0x82,0xCD,0x2E,0x81,0xC5,0x0E,0x08,0xCD,0x0E,0xCD,0x4F,0xD5,
+    0x70,0xD5,0x50,0xBC,0xAE,0x8B,0x6A,0x62,0x46,0x5A,0x05,0x59,0xE5,0x80,0x52,0x06,
+    0x01,0x51,0xE6,0x52,0x06,0x80,0x51,0xE6,0x01,0x5A,0x26,0x62,0x88,0x83,0x6A,0xC9,
+    0x80,0x6A,0xA9,0x0B,0x72,0xE9,0x4A,0x06,0x4A,0x05,0x41,0xE5,0x51,0xE4,0x62,0x46,
+    0x72,0xC7,0x93,0xAA,0xB4,0xAE,0xD5,0x71,0xE5,0xD2,0xE6,0x12,0x81,0xEE,0x32,0x82,
+    0xF6,0x32,0x81,0xF6,0x12,0x00,0xEE,0x32,0x80,0xE6,0x52,0x02,0xE6,0x72,0xEE,0x52,
+    0xF6,0x52,0x81,0xF6,0x32,0x01,0xF6,0x31,0xF6,0x11,0x80,0xED,0xD1,0x80,0xF5,0xF1,
+    0x05,0xF5,0xF2,0xED,0xF1,0xE5,0xB0,0xAC,0x2A,0x7A,0xA5,0x72,0x65,0x82,0x72,0x85,
+    0x80,0x72,0xA6,0x81,0x72,0xC6,0x01,0x7A,0xC6,0x7A,0xC7,0x85,0x7A,0xE7,0x00,0x7A,
+    0xE8,0x80,0x83,0x08,0x01,0x83,0x28,0x8B,0x48,0x80,0x93,0x69,0x0A,0x93,0x89,0x9B,
+    0xCA,0x9C,0x0B,0xA4,0x2B,0xA4,0x4B,0xAC,0x6C,0xAC,0x8C,0xB4,0x8C,0xB4,0xAC,0xB4,
+    0xCC,0xBC,0xCD,0x81,0xBC,0xED,0x03,0xC5,0x0E,0xCD,0x2E,0xCD,0x4E,0xCD,0x6F,0x80,
+    0xD5,0x6F,0x02,0xD5,0x4F,0xD5,0x4E,0xCD,0x4E,0x80,0xD5,0x4F,0x81,0xD5,0x6F,0x00,
+    0xCD,0x4F,0x84,0xCD,0x2E,0x08,0xCD,0x0E,0xCD,0x2F,0xD5,0x6F,0xD5,0x70,0xCD,0x50,
+    0xB4,0xAE,0x8B,0x69,0x62,0x46,0x5A,0x05,0x80,0x52,0x05,0x06,0x52,0x06,0x51,0xE5,
+    0x52,0x06,0x51,0xE5,0x51,0xE6,0x5A,0x26,0x62,0x88,0x83,0x6A,0xC9,0x80,0x6A,0xA9,
+    0x09,0x72,0xE9,0x4A,0x26,0x4A,0x05,0x49,0xE4,0x6A,0x86,0x93,0xCA,0xBC,0xCF,0xD5,
+    0x91,0xE5,0xD2,0xE6,0x13,0x80,0xEE,0x33,0x80,0xF6,0x53,0x80,0xF6,0x52,0x82,0xF6,
+    0x32,0x02,0xFE,0x12,0xF6,0x12,0xF6,0x32,0x80,0xEE,0x52,0x01,0xEE,0x72,0xF6,0x52,
+    0x82,0xF6,0x32,0x01,0xFE,0x32,0xF6,0x11,0x80,0xED,0xD1,0x80,0xF5,0xF1,0x04,0xF5,
+    0xF2,0xED,0xF1,0xE5,0xB0,0xAC,0x2B,0x7A,0xC5,0x83,0x72,0x85,0x80,0x72,0xA6,0x80,
+    0x72,0xC6,0x00,0x7A,0xC6,0x82,0x7A,0xE7,0x80,0x7B,0x08,0x80,0x7A,0xE8,0x00,0x7B,
+    0x08,0x81,0x83,0x08,0x0C,0x83,0x28,0x8B,0x48,0x8B,0x69,0x93,0x69,0x93,0x89,0x9B,
+    0xCA,0xA4,0x0B,0xA4,0x2B,0xAC,0x4B,0xAC,0x6C,0xB4,0x8C,0xB4,0xAC,0xB4,0xCC,0x80,
+    0xBC,0xCD,0x00,0xBC,0xED,0x80,0xC4,0xED,0x03,0xC5,0x0D,0xCD,0x2E,0xCD,0x4E,0xD5,
+    0x4F,0x81,0xD5,0x6F,0x02,0xD5,0x4F,0xCD,0x2E,0xD5,0x4E,0x82,0xD5,0x4F,0x01,0xCD,
+    0x4E,0xCD,0x2E,0x83,0xCD,0x2F,0x01,0xCD,0x4F,0xD5,0x4F,0x80,0xD5,0x70,0x06,0xCD,
+    0x50,0xB4,0x8D,0x8B,0x69,0x62,0x46,0x52,0x05,0x51,0xE5,0x52,0x05,0x81,0x52,0x06,
+    0x03,0x51,0xE5,0x51,0xE6,0x52,0x26,0x62,0x68,0x83,0x6A,0xC9,0x80,0x6A,0xA9,0x00,
+    0x72,0xE9,
+};
+const lcd_image_t gImage_1_rle = {128, 128, LCD_IMG_RLE565, 0, RT_NULL, gImage_1_rle_data, sizeof(gImage_1_rle_data)};
+
+/* gImage_2: 128x128, RLE8, 2061 bytes (raw 32768 bytes) */
+static const u16 gImage_2_rle_palette[17] = {
+    0x0000,0x1082,0x2104,0x31A6,0x4228,0x52AA,0x6B4D,0x7BCF,
+    0x8C51,0x9CD3,0xA534,0xB5B6,0xC618,0xD69A,0xDEFB,0xEF7D,
+    0xFFFF,
+};
+static const u8 gImage_2_rle_data[2027] = {
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,
+    0xFF,0x10,0xFF,0x10,0xFF,0x10,0xFF,0x10,0xC5,0x10,0xF8,0x00,0x84,0x10,0x00,0x00,
+    0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,
+    0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,
+    0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,
+    0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,
+    0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,
+    0x8F,0x10,0x01,0x09,0x01,0x8E,0x10,0x00,0x00,0x94,0x10,0x04,0x0D,0x02,0x00,0x03,
+    0x0E,0x94,0x10,0x00,0x00,0x8D,0x10,0x03,0x0A,0x01,0x00,0x07,0x8D,0x10,0x00,0x00,
+    0x84,0x10,0x00,0x00,0x8E,0x10,0x02,0x0A,0x09,0x04,0x8E,0x10,0x00,0x00,0x94,0x10,
+    0x04,0x05,0x0C,0x10,0x09,0x08,0x94,0x10,0x00,0x00,0x8D,0x10,0x04,0x04,0x0F,0x10,
+    0x05,0x0C,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x00,0x04,0x8E,0x10,
+    0x00,0x00,0x97,0x10,0x01,0x0C,0x0A,0x94,0x10,0x00,0x00,0x8F,0x10,0x02,0x0F,0x06,
+    0x0E,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x00,0x04,0x8E,0x10,0x00,
+    0x00,0x96,0x10,0x01,0x0F,0x0A,0x95,0x10,0x00,0x00,0x8E,0x10,0x02,0x04,0x00,0x08,
+    0x8D,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x00,0x04,0x8E,0x10,0x00,0x00,
+    0x95,0x10,0x01,0x0E,0x0D,0x96,0x10,0x00,0x00,0x90,0x10,0x01,0x08,0x0A,0x8C,0x10,
+    0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x00,0x04,0x8E,0x10,0x00,0x00,0x94,0x10,
+    0x01,0x0D,0x0C,0x97,0x10,0x00,0x00,0x8C,0x10,0x05,0x0D,0x05,0x0F,0x10,0x08,0x0A,
+    0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x8E,0x10,0x00,0x04,0x81,0x00,0x00,0x04,
+    0x8C,0x10,0x00,0x00,0x94,0x10,0x00,0x03,0x81,0x00,0x00,0x04,0x94,0x10,0x00,0x00,
+    0x8D,0x10,0x00,0x07,0x80,0x00,0x01,0x05,0x0F,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,
+    0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,
+    0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,
+    0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0xF8,
+    0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x01,0x0D,0x00,0x8D,0x10,0x00,0x00,0x94,0x10,
+    0x00,0x08,0x81,0x00,0x00,0x08,0x94,0x10,0x00,0x00,0x8D,0x10,0x04,0x0D,0x02,0x00,
+    0x02,0x0E,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x01,0x07,0x04,0x8D,
+    0x10,0x00,0x00,0x94,0x10,0x01,0x08,0x0C,0x97,0x10,0x00,0x00,0x8D,0x10,0x01,0x05,
+    0x0D,0x8F,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x8F,0x10,0x02,0x0A,0x0E,0x04,0x8D,
+    0x10,0x00,0x00,0x94,0x10,0x01,0x08,0x0F,0x97,0x10,0x00,0x00,0x8D,0x10,0x00,0x06,
+    0x90,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x8E,0x10,0x03,0x0E,0x0A,0x10,0x04,0x8D,
+    0x10,0x00,0x00,0x94,0x10,0x00,0x08,0x80,0x00,0x01,0x02,0x0D,0x94,0x10,0x00,0x00,
+    0x8D,0x10,0x81,0x00,0x01,0x04,0x0F,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x8E,
+    0x10,0x00,0x09,0x80,0x10,0x00,0x04,0x8D,0x10,0x00,0x00,0x97,0x10,0x01,0x0C,0x05,
+    0x94,0x10,0x00,0x00,0x8D,0x10,0x04,0x02,0x0E,0x10,0x08,0x09,0x8C,0x10,0x00,0x00,
+    0x84,0x10,0x00,0x00,0x8D,0x10,0x00,0x0D,0x83,0x00,0x8C,0x10,0x00,0x00,0x94,0x10,
+    0x04,0x04,0x0D,0x10,0x0C,0x05,0x94,0x10,0x00,0x00,0x8D,0x10,0x04,0x04,0x0E,0x10,
+    0x08,0x09,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x91,0x10,0x00,0x04,0x8D,0x10,
+    0x00,0x00,0x94,0x10,0x04,0x0D,0x02,0x00,0x04,0x0D,0x94,0x10,0x00,0x00,0x8D,0x10,
+    0x04,0x0D,0x02,0x00,0x04,0x0F,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,
+    0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,
+    0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,
+    0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0xF8,0x00,0x84,0x10,
+    0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,
+    0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,
+    0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,
+    0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,
+    0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,
+    0x00,0x00,0x8E,0x10,0x82,0x00,0x00,0x05,0x8C,0x10,0x00,0x00,0x94,0x10,0x04,0x0D,
+    0x02,0x00,0x04,0x0F,0x94,0x10,0x00,0x00,0x8D,0x10,0x03,0x0A,0x01,0x00,0x08,0x8D,
+    0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x91,0x10,0x01,0x0B,0x0E,0x8C,0x10,0x00,0x00,
+    0x94,0x10,0x04,0x04,0x0D,0x10,0x0A,0x08,0x94,0x10,0x00,0x00,0x8C,0x10,0x01,0x0F,
+    0x03,0x80,0x0F,0x01,0x05,0x0D,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,
+    0x01,0x0F,0x09,0x8D,0x10,0x00,0x00,0x94,0x10,0x04,0x06,0x0D,0x10,0x0A,0x09,0x94,
+    0x10,0x00,0x00,0x8C,0x10,0x01,0x0C,0x08,0x80,0x10,0x01,0x0B,0x09,0x8C,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x01,0x09,0x0F,0x8D,0x10,0x00,0x00,0x94,0x10,
+    0x04,0x0E,0x01,0x00,0x02,0x0F,0x94,0x10,0x00,0x00,0x8C,0x10,0x01,0x0F,0x03,0x80,
+    0x0F,0x01,0x05,0x08,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x90,0x10,0x00,0x07,
+    0x8E,0x10,0x00,0x00,0x94,0x10,0x04,0x06,0x0E,0x10,0x0C,0x06,0x94,0x10,0x00,0x00,
+    0x8D,0x10,0x00,0x0A,0x80,0x01,0x01,0x05,0x0A,0x8C,0x10,0x00,0x00,0x84,0x10,0x00,
+    0x00,0x8F,0x10,0x01,0x0B,0x0A,0x8E,0x10,0x00,0x00,0x94,0x10,0x04,0x03,0x0E,0x10,
+    0x0C,0x05,0x94,0x10,0x00,0x00,0x8F,0x10,0x02,0x0F,0x04,0x0E,0x8C,0x10,0x00,0x00,
+    0x84,0x10,0x00,0x00,0x8F,0x10,0x01,0x08,0x0C,0x8E,0x10,0x00,0x00,0x94,0x10,0x04,
+    0x0A,0x02,0x00,0x02,0x0D,0x94,0x10,0x00,0x00,0x8D,0x10,0x03,0x05,0x00,0x01,0x0A,
+    0x8D,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,
+    0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,
+    0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,
+    0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,
+    0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,
+    0xA0,0x10,0x00,0x00,0x84,0x10,0xF8,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,
+    0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,
+    0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0xA1,0x10,0x00,0x00,
+    0xAF,0x10,0x00,0x00,0xA0,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x86,0x10,0x01,0x0F,
+    0x0B,0x81,0x10,0x01,0x0F,0x06,0x92,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0x8A,0x10,
+    0x01,0x04,0x0F,0x92,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x87,0x10,0x02,0x09,0x08,
+    0x0A,0x80,0x08,0x00,0x04,0x80,0x08,0x00,0x0C,0x83,0x10,0x01,0x05,0x0D,0x88,0x10,
+    0x00,0x00,0xAF,0x10,0x00,0x00,0x85,0x10,0x81,0x08,0x02,0x07,0x0C,0x02,0x80,0x08,
+    0x00,0x0D,0x80,0x10,0x01,0x0F,0x07,0x82,0x10,0x00,0x06,0x87,0x10,0x00,0x00,0x84,
+    0x10,0x00,0x00,0x88,0x10,0x01,0x0F,0x0C,0x80,0x08,0x00,0x04,0x80,0x08,0x80,0x10,
+    0x00,0x0E,0x81,0x08,0x01,0x07,0x01,0x81,0x08,0x00,0x0E,0x84,0x10,0x00,0x00,0x94,
+    0x10,0x04,0x0D,0x02,0x00,0x04,0x0F,0x94,0x10,0x00,0x00,0x86,0x10,0x07,0x07,0x0E,
+    0x0F,0x04,0x0F,0x10,0x04,0x0F,0x81,0x10,0x02,0x0D,0x05,0x0F,0x80,0x10,0x00,0x08,
+    0x87,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x86,0x10,0x01,0x07,0x0F,0x82,0x10,0x00,
+    0x08,0x82,0x10,0x80,0x0C,0x84,0x10,0x01,0x08,0x0C,0x84,0x10,0x00,0x00,0x94,0x10,
+    0x04,0x05,0x0C,0x10,0x0A,0x06,0x94,0x10,0x00,0x00,0x86,0x10,0x08,0x05,0x10,0x03,
+    0x05,0x08,0x06,0x04,0x08,0x0E,0x81,0x10,0x04,0x0D,0x0F,0x10,0x0C,0x08,0x87,0x10,
+    0x00,0x00,0x84,0x10,0x00,0x00,0x86,0x10,0x02,0x0D,0x04,0x0C,0x81,0x08,0x00,0x04,
+    0x81,0x08,0x0A,0x10,0x0E,0x0D,0x0E,0x06,0x0E,0x0F,0x05,0x0A,0x0C,0x0E,0x84,0x10,
+    0x00,0x00,0x94,0x10,0x00,0x04,0x81,0x10,0x00,0x06,0x94,0x10,0x00,0x00,0x85,0x10,
+    0x0A,0x09,0x04,0x08,0x0D,0x08,0x10,0x04,0x10,0x08,0x0C,0x0E,0x80,0x08,0x00,0x0F,
+    0x80,0x10,0x01,0x0C,0x05,0x87,0x10,0x00,0x00,0x84,0x10,0x00,0x00,0x87,0x10,0x02,
+    0x0F,0x10,0x0C,0x83,0x08,0x80,0x10,0x00,0x0F,0x80,0x08,0x00,0x0F,0x81,0x10,0x02,
+    0x0B,0x05,0x0F,0x84,0x10,0x00,0x00,0x94,0x10,0x00,0x04,0x81,0x10,0x00,0x08,0x94,
+    0x10,0x00,0x00,0x84,0x10,0x02,0x0E,0x03,0x08,0x80,0x0C,0x05,0x06,0x08,0x02,0x08,
+    0x04,0x0C,0x80,0x10,0x00,0x08,0x81,0x10,0x01,0x0C,0x03,0x87,0x10,0x00,0x00,0x84,
+    0x10,0x00,0x00,0x88,0x10,0x02,0x09,0x08,0x06,0x81,0x08,0x00,0x06,0x81,0x10,0x00,
+    0x0A,0x84,0x08,0x00,0x0B,0x85,0x10,0x00,0x00,0x94,0x10,0x00,0x04,0x81,0x10,0x00,
+    0x05,0x94,0x10,0x00,0x00,0x85,0x10,0x01,0x0C,0x08,0x80,0x0C,0x05,0x06,0x08,0x02,
+    0x08,0x04,0x0C,0x80,0x10,0x00,0x08,0x81,0x10,0x02,0x07,0x08,0x0B,0x86,0x10,0x00,
+    0x00,0x84,0x10,0x00,0x00,0x87,0x10,0x03,0x0A,0x0C,0x08,0x0C,0x81,0x10,0x00,0x08,
+    0x84,0x10,0x01,0x0C,0x08,0x88,0x10,0x00,0x00,0x94,0x10,0x04,0x05,0x0C,0x10,0x0A,
+    0x07,0x94,0x10,0x00,0x00,0x85,0x10,0x09,0x0C,0x04,0x06,0x0C,0x07,0x10,0x04,0x10,
+    0x08,0x0C,0x80,0x10,0x00,0x04,0x81,0x10,0x02,0x04,0x10,0x05,0x86,0x10,0x00,0x00,
+    0x84,0x10,0x00,0x00,0x87,0x10,0x03,0x05,0x10,0x08,0x06,0x81,0x08,0x00,0x06,0x84,
+    0x10,0x01,0x0C,0x08,0x88,0x10,0x00,0x00,0x94,0x10,0x04,0x0D,0x02,0x00,0x04,0x0F,
+    0x94,0x10,0x00,0x00,0x85,0x10,0x09,0x0C,0x08,0x0D,0x0B,0x08,0x10,0x04,0x10,0x08,
+    0x0C,0x80,0x10,0x01,0x04,0x09,0x81,0x0A,0x02,0x10,0x08,0x0A,0x85,0x10,0x00,0x00,
+    0x84,0x10,0x00,0x00,0x86,0x10,0x04,0x09,0x0A,0x10,0x08,0x0C,0x81,0x10,0x00,0x08,
+    0x80,0x10,0x00,0x0A,0x81,0x08,0x01,0x06,0x04,0x81,0x08,0x00,0x0A,0x84,0x10,0x00,
+    0x00,0xAF,0x10,0x00,0x00,0x88,0x10,0x01,0x07,0x0E,0x81,0x10,0x01,0x08,0x0C,0x80,
+    0x10,0x03,0x03,0x0A,0x0D,0x04,0x81,0x10,0x01,0x04,0x0D,0x84,0x10,0x00,0x00,0x84,
+    0x10,0x00,0x00,0x86,0x10,0x00,0x0C,0x80,0x10,0x01,0x08,0x0C,0x80,0x10,0x80,0x07,
+    0x90,0x10,0x00,0x00,0xAF,0x10,0x00,0x00,0x87,0x10,0x01,0x0D,0x08,0x81,0x10,0x02,
+    0x07,0x03,0x0F,0x80,0x10,0x03,0x0F,0x10,0x04,0x0F,0x81,0x10,0x01,0x0E,0x0D,0x84,
+    0x10,0x00,0x00,0x84,0x10,0xF8,0x00,0xFF,0x10,0x80,0x10,
+};
+const lcd_image_t gImage_2_rle = {128, 128, LCD_IMG_RLE8, 17, gImage_2_rle_palette, gImage_2_rle_data, sizeof(gImage_2_rle_data)};
+
+/* gImage_3: 128x128, RLE8, 4803 bytes (raw 32768 bytes) */
+static const u16 gImage_3_rle_palette[64] = {
+    0x0000,0x0020,0x0841,0x0861,0x1082,0x10A2,0x18C3,0x18E3,
+    0x2104,0x2124,0x2945,0x2965,0x3186,0x31A6,0x39C7,0x39E7,
+    0x4208,0x4228,0x4A49,0x4A69,0x528A,0x52AA,0x5ACB,0x5AEB,
+    0x630C,0x632C,0x6B4D,0x6B6D,0x738E,0x73AE,0x7BCF,0x7BEF,
+    0x8410,0x8430,0x8C51,0x8C71,0x9492,0x94B2,0x9CD3,0x9CF3,
+    0xA514,0xA534,0xAD55,0xAD75,0xB596,0xB5B6,0xBDD7,0xBDF7,
+    0xC618,0xC638,0xCE59,0xCE79,0xD69A,0xD6BA,0xDEDB,0xDEFB,
+    0xE71C,0xE73C,0xEF5D,0xEF7D,0xF79E,0xF7BE,0xFFDF,0xFFFF,
+};
+static const u8 gImage_3_rle_data[4675] = {
+    0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,
+    0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,
+    0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,
+    0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0x98,0x3F,0x04,0x3E,0x3C,0x39,
+    0x3A,0x3D,0xF5,0x3F,0x09,0x3E,0x3A,0x37,0x39,0x38,0x29,0x1A,0x1D,0x2F,0x3C,0x81,
+    0x3F,0x00,0x3E,0xEF,0x3F,0x0A,0x3E,0x36,0x24,0x17,0x1F,0x20,0x0F,0x03,0x04,0x17,
+    0x34,0x80,0x3A,0x03,0x39,0x37,0x3A,0x3E,0xEC,0x3F,0x07,0x3E,0x37,0x20,0x0A,0x02,
+    0x05,0x06,0x02,0x80,0x00,0x08,0x09,0x21,0x26,0x24,0x1F,0x19,0x23,0x34,0x3D,0xEB,
+    0x3F,0x03,0x3C,0x26,0x0B,0x01,0x84,0x00,0x00,0x01,0x81,0x06,0x05,0x04,0x02,0x07,
+    0x1C,0x37,0x3E,0x86,0x3F,0x03,0x3D,0x3C,0x3D,0x3E,0x85,0x3F,0x02,0x3E,0x3D,0x3E,
+    0xD3,0x3F,0x03,0x3D,0x32,0x13,0x02,0x80,0x00,0x80,0x02,0x88,0x00,0x02,0x0A,0x2B,
+    0x3C,0x85,0x3F,0x05,0x3A,0x2D,0x26,0x29,0x36,0x3E,0x83,0x3F,0x05,0x3D,0x35,0x2D,
+    0x30,0x3A,0x3E,0xD0,0x3F,0x03,0x3D,0x31,0x1A,0x06,0x80,0x00,0x02,0x02,0x06,0x03,
+    0x88,0x00,0x02,0x03,0x1C,0x38,0x84,0x3F,0x07,0x3E,0x2F,0x10,0x05,0x09,0x20,0x36,
+    0x3E,0x82,0x3F,0x05,0x33,0x1C,0x0C,0x13,0x29,0x3C,0xD0,0x3F,0x02,0x36,0x1A,0x05,
+    0x80,0x00,0x03,0x02,0x0A,0x0B,0x02,0x84,0x00,0x02,0x04,0x05,0x01,0x80,0x00,0x01,
+    0x12,0x36,0x84,0x3F,0x08,0x3D,0x27,0x07,0x00,0x01,0x0B,0x24,0x38,0x3E,0x80,0x3F,
+    0x06,0x3D,0x22,0x07,0x01,0x02,0x14,0x36,0xCF,0x3F,0x03,0x3C,0x24,0x08,0x01,0x80,
+    0x00,0x03,0x0A,0x19,0x0C,0x01,0x80,0x00,0x01,0x03,0x01,0x80,0x00,0x02,0x0D,0x0E,
+    0x01,0x80,0x00,0x01,0x10,0x35,0x84,0x3F,0x02,0x3E,0x29,0x08,0x80,0x00,0x03,0x01,
+    0x0B,0x26,0x3A,0x80,0x3F,0x02,0x3D,0x1D,0x04,0x80,0x00,0x02,0x0B,0x2D,0x3D,0xCD,
+    0x3F,0x03,0x3E,0x30,0x11,0x02,0x81,0x00,0x07,0x10,0x28,0x11,0x03,0x01,0x05,0x10,
+    0x04,0x80,0x00,0x80,0x0B,0x04,0x01,0x00,0x01,0x13,0x36,0x85,0x3F,0x02,0x31,0x14,
+    0x03,0x80,0x00,0x02,0x01,0x11,0x34,0x80,0x3E,0x02,0x3C,0x24,0x08,0x80,0x00,0x03,
+    0x04,0x1E,0x39,0x3E,0xCC,0x3F,0x02,0x37,0x1B,0x05,0x82,0x00,0x07,0x0E,0x2F,0x25,
+    0x0F,0x0B,0x17,0x21,0x08,0x80,0x00,0x06,0x04,0x07,0x02,0x01,0x05,0x1E,0x39,0x85,
+    0x3F,0x03,0x3C,0x2B,0x10,0x03,0x80,0x00,0x0D,0x0A,0x31,0x39,0x34,0x31,0x28,0x0E,
+    0x01,0x00,0x01,0x12,0x30,0x3A,0x3E,0xCB,0x3F,0x02,0x30,0x0F,0x01,0x82,0x00,0x07,
+    0x08,0x28,0x38,0x2B,0x22,0x26,0x27,0x09,0x80,0x00,0x06,0x01,0x0B,0x0F,0x0D,0x15,
+    0x2F,0x3D,0x86,0x3F,0x0C,0x3C,0x28,0x0E,0x03,0x04,0x12,0x2D,0x25,0x14,0x0E,0x10,
+    0x08,0x01,0x80,0x00,0x04,0x06,0x14,0x27,0x39,0x3E,0xCA,0x3F,0x03,0x34,0x15,0x05,
+    0x02,0x81,0x00,0x07,0x03,0x1D,0x3A,0x30,0x18,0x0D,0x10,0x05,0x80,0x00,0x01,0x01,
+    0x15,0x80,0x2B,0x02,0x30,0x38,0x3D,0x85,0x3F,0x0A,0x3C,0x3A,0x34,0x22,0x15,0x18,
+    0x27,0x22,0x0B,0x02,0x00,0x80,0x01,0x81,0x00,0x04,0x01,0x02,0x0C,0x2B,0x3D,0xCA,
+    0x3F,0x04,0x3C,0x2B,0x18,0x12,0x06,0x81,0x00,0x04,0x17,0x36,0x1F,0x05,0x00,0x81,
+    0x01,0x08,0x00,0x01,0x11,0x2B,0x28,0x21,0x24,0x32,0x3D,0x82,0x3F,0x03,0x3E,0x38,
+    0x2A,0x22,0x80,0x1F,0x04,0x21,0x2C,0x32,0x18,0x04,0x87,0x00,0x02,0x04,0x25,0x3C,
+    0xCB,0x3F,0x04,0x3D,0x37,0x2F,0x10,0x01,0x80,0x00,0x03,0x14,0x2C,0x12,0x01,0x80,
+    0x00,0x80,0x01,0x80,0x00,0x07,0x09,0x16,0x0C,0x04,0x05,0x18,0x33,0x3E,0x81,0x3F,
+    0x0F,0x3C,0x25,0x0D,0x04,0x02,0x03,0x05,0x14,0x29,0x1F,0x09,0x02,0x03,0x04,0x03,
+    0x01,0x81,0x00,0x03,0x01,0x0C,0x2B,0x3D,0xCD,0x3F,0x02,0x38,0x13,0x01,0x80,0x00,
+    0x02,0x13,0x21,0x07,0x80,0x00,0x02,0x02,0x07,0x02,0x80,0x00,0x02,0x07,0x09,0x03,
+    0x80,0x00,0x02,0x07,0x21,0x39,0x81,0x3F,0x02,0x38,0x15,0x03,0x82,0x00,0x09,0x03,
+    0x19,0x2D,0x1D,0x11,0x13,0x17,0x12,0x08,0x02,0x80,0x00,0x03,0x08,0x21,0x37,0x3E,
+    0xCD,0x3F,0x02,0x39,0x14,0x01,0x80,0x00,0x02,0x12,0x1B,0x03,0x80,0x00,0x02,0x06,
+    0x17,0x05,0x80,0x00,0x03,0x08,0x11,0x08,0x02,0x80,0x00,0x02,0x0E,0x2D,0x3D,0x80,
+    0x3F,0x02,0x39,0x17,0x04,0x82,0x00,0x09,0x01,0x10,0x33,0x36,0x25,0x15,0x11,0x0E,
+    0x0A,0x03,0x80,0x00,0x02,0x0B,0x2A,0x3D,0xCE,0x3F,0x02,0x3B,0x15,0x02,0x80,0x00,
+    0x07,0x0F,0x19,0x06,0x01,0x02,0x0F,0x21,0x07,0x80,0x00,0x03,0x09,0x22,0x1A,0x05,
+    0x80,0x00,0x02,0x04,0x22,0x3C,0x80,0x3F,0x04,0x3D,0x2B,0x12,0x05,0x01,0x80,0x00,
+    0x05,0x02,0x14,0x35,0x3D,0x27,0x07,0x80,0x01,0x01,0x05,0x02,0x80,0x00,0x02,0x04,
+    0x22,0x3C,0xCE,0x3F,0x02,0x3B,0x16,0x02,0x80,0x00,0x07,0x0F,0x21,0x16,0x0D,0x11,
+    0x24,0x27,0x08,0x80,0x00,0x08,0x05,0x27,0x2E,0x0F,0x03,0x01,0x08,0x25,0x3C,0x81,
+    0x3F,0x03,0x3C,0x28,0x0B,0x01,0x80,0x00,0x09,0x04,0x20,0x39,0x3E,0x26,0x06,0x00,
+    0x01,0x05,0x02,0x80,0x00,0x02,0x01,0x1D,0x3B,0xB3,0x3F,0x88,0x3E,0x8F,0x3F,0x02,
+    0x3C,0x1B,0x04,0x80,0x00,0x07,0x0F,0x2F,0x34,0x2F,0x31,0x39,0x2C,0x08,0x80,0x00,
+    0x08,0x03,0x27,0x39,0x23,0x13,0x10,0x1C,0x33,0x3E,0x81,0x3F,0x02,0x3D,0x27,0x07,
+    0x81,0x00,0x0E,0x04,0x1E,0x38,0x3E,0x30,0x13,0x07,0x09,0x0C,0x05,0x01,0x00,0x01,
+    0x1B,0x3A,0x89,0x3F,0x03,0x3D,0x3B,0x3A,0x3D,0xA0,0x3F,0x00,0x3E,0x80,0x3C,0x03,
+    0x3B,0x3A,0x38,0x37,0x80,0x35,0x06,0x36,0x37,0x38,0x39,0x3A,0x3B,0x3C,0x80,0x3E,
+    0x8B,0x3F,0x07,0x3D,0x22,0x08,0x01,0x00,0x11,0x33,0x3D,0x81,0x3E,0x01,0x2F,0x0B,
+    0x80,0x00,0x07,0x06,0x28,0x3C,0x3A,0x34,0x33,0x38,0x3C,0x82,0x3F,0x02,0x3C,0x25,
+    0x06,0x81,0x00,0x09,0x01,0x0D,0x2E,0x3D,0x3C,0x2E,0x21,0x1E,0x0D,0x02,0x81,0x00,
+    0x01,0x1A,0x39,0x88,0x3F,0x05,0x3C,0x30,0x25,0x23,0x2C,0x3A,0x9C,0x3F,0x09,0x3E,
+    0x3D,0x3B,0x34,0x2A,0x28,0x26,0x21,0x1E,0x1B,0x80,0x1A,0x0A,0x1B,0x1C,0x1E,0x20,
+    0x21,0x24,0x2B,0x35,0x3A,0x3D,0x3E,0x89,0x3F,0x07,0x3E,0x30,0x15,0x07,0x08,0x1C,
+    0x38,0x3E,0x81,0x3F,0x07,0x35,0x15,0x07,0x06,0x15,0x31,0x3E,0x3F,0x82,0x3E,0x82,
+    0x3F,0x03,0x3E,0x2C,0x0E,0x04,0x81,0x00,0x08,0x04,0x1C,0x36,0x3B,0x3C,0x3B,0x30,
+    0x0F,0x01,0x80,0x00,0x02,0x01,0x1C,0x39,0x83,0x3F,0x00,0x3D,0x80,0x3B,0x08,0x3D,
+    0x3F,0x35,0x16,0x05,0x04,0x0F,0x2F,0x3E,0x9A,0x3F,0x08,0x3E,0x3C,0x34,0x26,0x17,
+    0x0B,0x09,0x06,0x03,0x87,0x02,0x06,0x05,0x0D,0x18,0x24,0x31,0x39,0x3D,0x89,0x3F,
+    0x05,0x3C,0x2E,0x23,0x24,0x32,0x3E,0x82,0x3F,0x05,0x3C,0x2F,0x23,0x22,0x2F,0x3C,
+    0x89,0x3F,0x03,0x38,0x24,0x12,0x03,0x80,0x00,0x08,0x01,0x0A,0x1D,0x27,0x31,0x35,
+    0x30,0x11,0x02,0x80,0x00,0x03,0x05,0x20,0x3A,0x3E,0x81,0x3F,0x01,0x3C,0x2F,0x80,
+    0x23,0x08,0x31,0x3B,0x30,0x0A,0x01,0x00,0x05,0x27,0x3C,0x8A,0x3F,0x80,0x3E,0x86,
+    0x3F,0x80,0x3E,0x80,0x3F,0x80,0x3E,0x04,0x3A,0x2D,0x1A,0x09,0x02,0x8D,0x00,0x06,
+    0x02,0x08,0x13,0x24,0x33,0x3B,0x3E,0x88,0x3F,0x00,0x3E,0x80,0x3D,0x00,0x3E,0x85,
+    0x3F,0x80,0x3D,0x00,0x3E,0x89,0x3F,0x04,0x3E,0x35,0x21,0x10,0x03,0x82,0x00,0x02,
+    0x03,0x09,0x12,0x80,0x16,0x07,0x0A,0x02,0x00,0x03,0x08,0x17,0x2F,0x3C,0x81,0x3F,
+    0x0C,0x32,0x16,0x05,0x06,0x17,0x30,0x2D,0x09,0x01,0x00,0x03,0x25,0x3C,0x89,0x3F,
+    0x00,0x3B,0x80,0x35,0x00,0x39,0x85,0x3F,0x81,0x3E,0x05,0x3F,0x3D,0x39,0x29,0x12,
+    0x04,0x82,0x00,0x81,0x01,0x00,0x02,0x80,0x03,0x80,0x02,0x81,0x01,0x82,0x00,0x06,
+    0x01,0x08,0x17,0x29,0x35,0x3B,0x3E,0x84,0x3F,0x83,0x3E,0x94,0x3F,0x03,0x3A,0x21,
+    0x08,0x01,0x8B,0x00,0x09,0x01,0x03,0x05,0x16,0x34,0x3E,0x3F,0x3E,0x2A,0x08,0x80,
+    0x00,0x03,0x05,0x1B,0x26,0x08,0x80,0x00,0x02,0x04,0x27,0x3C,0x88,0x3F,0x04,0x3B,
+    0x29,0x17,0x15,0x22,0x84,0x3F,0x83,0x3E,0x03,0x37,0x24,0x0D,0x03,0x80,0x00,0x06,
+    0x01,0x04,0x09,0x0D,0x0C,0x0E,0x11,0x80,0x13,0x00,0x11,0x80,0x0F,0x04,0x0D,0x0C,
+    0x09,0x04,0x01,0x81,0x00,0x06,0x03,0x0A,0x18,0x2B,0x37,0x3C,0x3E,0x80,0x3F,0x07,
+    0x3E,0x3B,0x36,0x32,0x31,0x32,0x38,0x3D,0x93,0x3F,0x02,0x36,0x13,0x02,0x80,0x00,
+    0x04,0x01,0x06,0x05,0x02,0x01,0x88,0x00,0x02,0x08,0x2D,0x3E,0x80,0x3F,0x02,0x2D,
+    0x0C,0x01,0x80,0x00,0x02,0x08,0x15,0x05,0x80,0x00,0x02,0x06,0x2A,0x3D,0x88,0x3F,
+    0x04,0x32,0x12,0x02,0x01,0x0B,0x84,0x3F,0x81,0x3E,0x04,0x3D,0x37,0x22,0x0C,0x01,
+    0x80,0x00,0x07,0x02,0x08,0x15,0x24,0x2D,0x2F,0x32,0x34,0x80,0x35,0x80,0x34,0x07,
+    0x33,0x31,0x2F,0x26,0x17,0x0C,0x04,0x01,0x81,0x00,0x10,0x03,0x0C,0x1C,0x2D,0x38,
+    0x3C,0x3B,0x34,0x29,0x19,0x0F,0x0C,0x10,0x1E,0x2F,0x3A,0x3E,0x91,0x3F,0x0C,0x39,
+    0x1D,0x07,0x03,0x04,0x0B,0x1D,0x1C,0x12,0x0C,0x06,0x03,0x02,0x80,0x01,0x82,0x00,
+    0x03,0x01,0x0C,0x2E,0x3E,0x80,0x3F,0x07,0x37,0x1E,0x07,0x01,0x00,0x02,0x06,0x01,
+    0x80,0x00,0x02,0x11,0x31,0x3E,0x87,0x3F,0x02,0x3E,0x2A,0x07,0x80,0x00,0x00,0x05,
+    0x81,0x3F,0x80,0x3E,0x00,0x3F,0x81,0x3E,0x03,0x38,0x22,0x0B,0x01,0x80,0x00,0x05,
+    0x02,0x0D,0x21,0x33,0x3B,0x3D,0x80,0x3E,0x85,0x3F,0x07,0x3E,0x3C,0x37,0x2B,0x17,
+    0x0A,0x03,0x01,0x81,0x00,0x07,0x04,0x0F,0x22,0x2C,0x27,0x16,0x09,0x03,0x81,0x00,
+    0x03,0x05,0x11,0x2A,0x3B,0x81,0x3E,0x8E,0x3F,0x0F,0x3E,0x32,0x1D,0x15,0x18,0x27,
+    0x37,0x39,0x35,0x2D,0x20,0x15,0x12,0x0E,0x0B,0x09,0x80,0x05,0x03,0x07,0x0E,0x20,
+    0x37,0x81,0x3F,0x05,0x3E,0x33,0x19,0x07,0x03,0x01,0x81,0x00,0x02,0x04,0x21,0x3A,
+    0x88,0x3F,0x02,0x3C,0x23,0x05,0x80,0x00,0x00,0x06,0x81,0x3F,0x81,0x3E,0x05,0x3F,
+    0x3E,0x3B,0x27,0x0B,0x02,0x80,0x00,0x04,0x03,0x0E,0x26,0x38,0x3D,0x8C,0x3F,0x05,
+    0x3D,0x34,0x24,0x14,0x08,0x02,0x81,0x00,0x04,0x01,0x06,0x0B,0x08,0x03,0x84,0x00,
+    0x02,0x02,0x14,0x2F,0x82,0x39,0x80,0x3A,0x80,0x3B,0x01,0x3C,0x3E,0x86,0x3F,0x07,
+    0x3D,0x3C,0x39,0x35,0x33,0x35,0x39,0x3D,0x80,0x3F,0x0C,0x3D,0x3B,0x38,0x35,0x2F,
+    0x28,0x25,0x1D,0x1C,0x21,0x2C,0x38,0x3E,0x81,0x3F,0x05,0x3E,0x3A,0x2C,0x1B,0x11,
+    0x05,0x80,0x00,0x03,0x01,0x0F,0x2E,0x3D,0x88,0x3F,0x02,0x37,0x19,0x03,0x80,0x00,
+    0x01,0x06,0x3F,0x80,0x3E,0x80,0x3F,0x05,0x3E,0x3D,0x36,0x2B,0x14,0x02,0x80,0x00,
+    0x04,0x03,0x11,0x28,0x3A,0x3E,0x84,0x3F,0x00,0x3E,0x87,0x3F,0x06,0x3E,0x3B,0x32,
+    0x22,0x11,0x07,0x02,0x86,0x00,0x02,0x03,0x04,0x01,0x80,0x00,0x01,0x06,0x17,0x80,
+    0x1F,0x80,0x1E,0x08,0x1F,0x20,0x21,0x22,0x26,0x31,0x38,0x3A,0x3D,0x80,0x3E,0x05,
+    0x3D,0x3B,0x37,0x2F,0x25,0x21,0x80,0x20,0x03,0x21,0x27,0x32,0x3B,0x82,0x3F,0x80,
+    0x3E,0x80,0x3D,0x03,0x3C,0x3B,0x3C,0x3E,0x82,0x3F,0x0C,0x3D,0x34,0x27,0x24,0x22,
+    0x1D,0x08,0x01,0x00,0x03,0x1B,0x34,0x3D,0x88,0x3F,0x02,0x32,0x0F,0x01,0x80,0x00,
+    0x01,0x09,0x3F,0x80,0x3E,0x0C,0x3D,0x3C,0x39,0x32,0x1E,0x0E,0x04,0x01,0x00,0x02,
+    0x10,0x2A,0x3A,0x92,0x3F,0x06,0x3E,0x3B,0x2F,0x1F,0x0E,0x04,0x01,0x82,0x00,0x04,
+    0x03,0x09,0x14,0x13,0x05,0x81,0x00,0x83,0x01,0x82,0x02,0x0C,0x07,0x12,0x1B,0x24,
+    0x31,0x37,0x3A,0x32,0x26,0x1C,0x11,0x06,0x02,0x80,0x01,0x04,0x02,0x08,0x16,0x2B,
+    0x3A,0x80,0x3E,0x01,0x3F,0x3E,0x89,0x3F,0x06,0x36,0x1B,0x09,0x05,0x06,0x07,0x03,
+    0x80,0x00,0x04,0x03,0x10,0x1F,0x33,0x3E,0x87,0x3F,0x01,0x2D,0x08,0x80,0x00,0x11,
+    0x01,0x12,0x3E,0x3A,0x36,0x31,0x29,0x1E,0x14,0x06,0x01,0x00,0x02,0x07,0x0F,0x26,
+    0x3A,0x3E,0x90,0x3F,0x82,0x3E,0x04,0x3D,0x39,0x2A,0x12,0x03,0x81,0x00,0x05,0x04,
+    0x12,0x24,0x30,0x1D,0x06,0x8B,0x00,0x09,0x01,0x02,0x07,0x12,0x1C,0x21,0x16,0x08,
+    0x02,0x01,0x84,0x00,0x03,0x02,0x11,0x2D,0x3C,0x8C,0x3F,0x01,0x2D,0x09,0x86,0x00,
+    0x03,0x01,0x06,0x1F,0x38,0x86,0x3F,0x02,0x3D,0x27,0x05,0x80,0x00,0x07,0x03,0x21,
+    0x36,0x26,0x18,0x10,0x0B,0x04,0x81,0x00,0x04,0x01,0x08,0x1F,0x2C,0x38,0x80,0x3E,
+    0x86,0x3F,0x80,0x3E,0x84,0x3F,0x0A,0x3E,0x3B,0x36,0x33,0x34,0x35,0x39,0x3C,0x33,
+    0x17,0x04,0x80,0x00,0x06,0x02,0x12,0x2C,0x3B,0x3A,0x1B,0x04,0x80,0x00,0x88,0x01,
+    0x83,0x00,0x02,0x03,0x06,0x02,0x82,0x00,0x81,0x01,0x81,0x00,0x02,0x04,0x1A,0x39,
+    0x8B,0x3F,0x03,0x3E,0x2D,0x0A,0x02,0x80,0x01,0x84,0x00,0x03,0x02,0x13,0x34,0x3E,
+    0x85,0x3F,0x02,0x38,0x19,0x03,0x80,0x00,0x04,0x04,0x29,0x21,0x0B,0x02,0x82,0x00,
+    0x80,0x01,0x03,0x05,0x18,0x33,0x3D,0x82,0x3E,0x85,0x3F,0x80,0x3E,0x83,0x3F,0x03,
+    0x3D,0x36,0x28,0x18,0x80,0x10,0x05,0x15,0x21,0x2B,0x20,0x0A,0x01,0x80,0x00,0x09,
+    0x0B,0x28,0x3A,0x3E,0x3C,0x29,0x10,0x05,0x07,0x0B,0x80,0x0D,0x83,0x0E,0x04,0x0D,
+    0x0B,0x06,0x02,0x01,0x85,0x00,0x02,0x02,0x08,0x0C,0x80,0x0D,0x00,0x06,0x81,0x00,
+    0x01,0x0F,0x35,0x80,0x3E,0x8A,0x3F,0x05,0x35,0x1B,0x0E,0x0C,0x0B,0x04,0x81,0x00,
+    0x80,0x01,0x04,0x06,0x1C,0x36,0x3D,0x3E,0x84,0x3F,0x02,0x34,0x0E,0x01,0x80,0x00,
+    0x03,0x07,0x2C,0x0E,0x01,0x81,0x00,0x06,0x01,0x02,0x04,0x08,0x19,0x2F,0x3B,0x83,
+    0x3E,0x85,0x3F,0x80,0x3E,0x82,0x3F,0x04,0x3E,0x32,0x1D,0x0A,0x03,0x80,0x00,0x04,
+    0x02,0x06,0x0A,0x06,0x02,0x80,0x00,0x0C,0x04,0x1B,0x38,0x3E,0x3D,0x3A,0x35,0x28,
+    0x1C,0x21,0x2B,0x30,0x32,0x82,0x33,0x07,0x32,0x30,0x29,0x1C,0x12,0x0C,0x05,0x01,
+    0x80,0x00,0x09,0x01,0x02,0x08,0x12,0x21,0x2D,0x32,0x30,0x16,0x02,0x80,0x00,0x02,
+    0x0D,0x33,0x3E,0x8B,0x3F,0x06,0x3D,0x32,0x25,0x22,0x25,0x0F,0x01,0x80,0x00,0x07,
+    0x04,0x08,0x14,0x2B,0x34,0x33,0x38,0x3E,0x83,0x3F,0x01,0x31,0x0A,0x80,0x00,0x03,
+    0x01,0x15,0x34,0x06,0x81,0x00,0x05,0x05,0x09,0x10,0x16,0x21,0x31,0x80,0x37,0x01,
+    0x39,0x3C,0x81,0x3E,0x87,0x3F,0x80,0x3E,0x04,0x3F,0x3E,0x36,0x1C,0x07,0x88,0x00,
+    0x0B,0x03,0x13,0x2F,0x3D,0x3C,0x31,0x26,0x24,0x2B,0x36,0x3A,0x3D,0x82,0x3E,0x82,
+    0x3F,0x11,0x3D,0x39,0x32,0x27,0x19,0x0E,0x06,0x04,0x0A,0x13,0x22,0x32,0x3A,0x3D,
+    0x3E,0x36,0x16,0x02,0x80,0x00,0x01,0x0F,0x34,0x80,0x3C,0x01,0x3D,0x3E,0x88,0x3F,
+    0x06,0x3C,0x2B,0x15,0x11,0x1A,0x0B,0x01,0x80,0x00,0x08,0x06,0x0F,0x17,0x1E,0x19,
+    0x15,0x22,0x36,0x3E,0x81,0x3F,0x02,0x3D,0x2A,0x09,0x80,0x00,0x03,0x03,0x23,0x3B,
+    0x04,0x80,0x00,0x0B,0x02,0x15,0x22,0x2F,0x33,0x34,0x2E,0x23,0x1E,0x23,0x32,0x3D,
+    0x80,0x3E,0x88,0x3F,0x05,0x3E,0x3F,0x3B,0x25,0x09,0x01,0x80,0x00,0x02,0x02,0x03,
+    0x02,0x81,0x00,0x0E,0x01,0x04,0x10,0x28,0x3B,0x3E,0x33,0x17,0x07,0x05,0x12,0x33,
+    0x3E,0x3F,0x3E,0x86,0x3F,0x0A,0x3D,0x32,0x27,0x26,0x25,0x1D,0x1B,0x27,0x34,0x3B,
+    0x3E,0x80,0x3F,0x03,0x3E,0x2B,0x0B,0x01,0x80,0x00,0x00,0x10,0x80,0x2D,0x07,0x2A,
+    0x2E,0x34,0x37,0x39,0x3A,0x3B,0x3D,0x83,0x3F,0x05,0x34,0x14,0x03,0x01,0x03,0x01,
+    0x81,0x00,0x00,0x01,0x80,0x03,0x00,0x04,0x80,0x02,0x02,0x09,0x24,0x3C,0x81,0x3F,
+    0x02,0x3A,0x1D,0x05,0x80,0x00,0x03,0x06,0x29,0x3D,0x05,0x80,0x00,0x0D,0x03,0x1C,
+    0x2E,0x2B,0x22,0x1C,0x11,0x06,0x02,0x06,0x1D,0x39,0x3E,0x3F,0x81,0x3E,0x85,0x3F,
+    0x1A,0x3E,0x3F,0x33,0x14,0x02,0x00,0x01,0x05,0x13,0x18,0x10,0x09,0x06,0x07,0x0B,
+    0x18,0x2B,0x3A,0x3E,0x3F,0x2B,0x0C,0x01,0x00,0x0A,0x2D,0x3D,0x80,0x3F,0x00,0x3E,
+    0x85,0x3F,0x07,0x33,0x1A,0x09,0x0B,0x21,0x37,0x3B,0x3D,0x83,0x3F,0x02,0x3E,0x25,
+    0x06,0x80,0x00,0x0D,0x01,0x0B,0x15,0x0E,0x09,0x0F,0x17,0x1B,0x1D,0x20,0x24,0x30,
+    0x3B,0x3E,0x81,0x3F,0x02,0x30,0x0C,0x01,0x8A,0x00,0x02,0x04,0x1C,0x3A,0x81,0x3F,
+    0x11,0x38,0x16,0x03,0x00,0x01,0x11,0x31,0x3E,0x0B,0x01,0x00,0x01,0x08,0x12,0x0E,
+    0x05,0x02,0x01,0x80,0x00,0x02,0x01,0x12,0x36,0x83,0x3E,0x85,0x3F,0x03,0x3E,0x3F,
+    0x2D,0x09,0x80,0x00,0x05,0x01,0x15,0x2F,0x37,0x2D,0x26,0x80,0x23,0x0C,0x28,0x30,
+    0x35,0x39,0x3D,0x3F,0x30,0x12,0x04,0x03,0x10,0x31,0x3D,0x87,0x3F,0x06,0x3D,0x23,
+    0x08,0x01,0x00,0x11,0x35,0x80,0x3E,0x83,0x3F,0x02,0x3E,0x24,0x05,0x82,0x00,0x80,
+    0x01,0x80,0x00,0x81,0x01,0x05,0x02,0x06,0x14,0x2B,0x3A,0x3E,0x80,0x3F,0x03,0x36,
+    0x19,0x08,0x02,0x87,0x00,0x04,0x01,0x03,0x0C,0x27,0x3C,0x81,0x3F,0x0A,0x3B,0x23,
+    0x0C,0x06,0x0A,0x22,0x3A,0x3F,0x19,0x05,0x01,0x88,0x00,0x01,0x10,0x35,0x80,0x3E,
+    0x00,0x3F,0x81,0x3E,0x86,0x3F,0x01,0x2B,0x07,0x80,0x00,0x02,0x03,0x23,0x3A,0x80,
+    0x3E,0x0F,0x3D,0x3E,0x3D,0x35,0x25,0x1B,0x21,0x33,0x3E,0x3B,0x29,0x15,0x14,0x25,
+    0x39,0x3E,0x87,0x3F,0x02,0x3D,0x23,0x08,0x80,0x01,0x01,0x12,0x35,0x80,0x3E,0x83,
+    0x3F,0x02,0x3E,0x25,0x07,0x8B,0x00,0x03,0x02,0x12,0x29,0x38,0x80,0x3E,0x05,0x3D,
+    0x31,0x20,0x11,0x05,0x01,0x84,0x00,0x05,0x03,0x0A,0x15,0x25,0x38,0x3E,0x81,0x3F,
+    0x0B,0x3E,0x36,0x27,0x21,0x27,0x36,0x3E,0x3F,0x2D,0x13,0x05,0x01,0x81,0x00,0x81,
+    0x01,0x81,0x00,0x01,0x12,0x36,0x80,0x3E,0x8A,0x3F,0x01,0x2C,0x08,0x80,0x00,0x02,
+    0x03,0x1E,0x38,0x80,0x3E,0x80,0x3F,0x05,0x3C,0x24,0x0B,0x03,0x07,0x1F,0x80,0x39,
+    0x04,0x32,0x2C,0x30,0x39,0x3D,0x84,0x3E,0x82,0x3F,0x06,0x3E,0x31,0x17,0x0C,0x0D,
+    0x1F,0x39,0x80,0x3E,0x83,0x3F,0x03,0x3E,0x31,0x12,0x02,0x80,0x00,0x05,0x01,0x02,
+    0x05,0x07,0x05,0x02,0x80,0x01,0x81,0x00,0x03,0x03,0x0E,0x24,0x37,0x80,0x3E,0x04,
+    0x3D,0x38,0x2F,0x13,0x02,0x84,0x00,0x04,0x03,0x14,0x2B,0x3A,0x3E,0x82,0x3F,0x04,
+    0x3C,0x37,0x34,0x37,0x3C,0x81,0x3F,0x09,0x3B,0x2C,0x18,0x0A,0x04,0x03,0x04,0x08,
+    0x0D,0x07,0x81,0x00,0x01,0x12,0x36,0x82,0x3E,0x80,0x3F,0x00,0x3E,0x85,0x3F,0x07,
+    0x31,0x10,0x01,0x00,0x01,0x10,0x32,0x3E,0x81,0x3F,0x02,0x3A,0x17,0x02,0x80,0x00,
+    0x0E,0x12,0x2C,0x22,0x15,0x1B,0x2D,0x36,0x3B,0x3D,0x3B,0x35,0x30,0x31,0x38,0x3E,
+    0x82,0x3F,0x04,0x3C,0x33,0x2C,0x2E,0x36,0x81,0x3E,0x84,0x3F,0x0E,0x3B,0x20,0x08,
+    0x03,0x08,0x0E,0x12,0x1B,0x20,0x1B,0x14,0x10,0x0E,0x06,0x01,0x80,0x00,0x03,0x01,
+    0x0B,0x27,0x3A,0x81,0x3E,0x02,0x3C,0x19,0x02,0x80,0x00,0x01,0x01,0x02,0x80,0x00,
+    0x04,0x01,0x0A,0x20,0x35,0x3D,0x81,0x3F,0x06,0x3C,0x2D,0x1C,0x19,0x2A,0x39,0x3E,
+    0x81,0x3F,0x09,0x3D,0x35,0x27,0x1A,0x16,0x18,0x20,0x2A,0x15,0x02,0x80,0x00,0x03,
+    0x0D,0x31,0x3D,0x3F,0x83,0x3E,0x85,0x3F,0x02,0x39,0x1D,0x04,0x80,0x00,0x02,0x08,
+    0x2A,0x3C,0x81,0x3F,0x02,0x39,0x14,0x02,0x80,0x00,0x11,0x09,0x11,0x07,0x02,0x04,
+    0x0F,0x1E,0x2A,0x2D,0x28,0x1A,0x0E,0x0F,0x24,0x3A,0x3E,0x3F,0x3E,0x80,0x3F,0x82,
+    0x3E,0x80,0x3F,0x00,0x3E,0x84,0x3F,0x0F,0x3E,0x33,0x20,0x17,0x22,0x30,0x34,0x38,
+    0x3A,0x38,0x35,0x34,0x2F,0x1C,0x0A,0x02,0x80,0x00,0x08,0x02,0x12,0x2F,0x3C,0x3E,
+    0x3F,0x3A,0x18,0x02,0x80,0x00,0x09,0x08,0x0E,0x05,0x01,0x00,0x01,0x09,0x20,0x36,
+    0x3D,0x80,0x3F,0x06,0x33,0x14,0x05,0x03,0x0F,0x2B,0x3D,0x83,0x3F,0x03,0x3C,0x39,
+    0x38,0x39,0x80,0x3B,0x01,0x1E,0x04,0x80,0x00,0x02,0x06,0x22,0x39,0x84,0x3E,0x85,
+    0x3F,0x02,0x3D,0x26,0x06,0x80,0x00,0x03,0x03,0x1A,0x36,0x3E,0x80,0x3F,0x02,0x3A,
+    0x17,0x02,0x80,0x00,0x80,0x02,0x81,0x00,0x09,0x01,0x04,0x07,0x08,0x07,0x03,0x00,
+    0x01,0x10,0x34,0x81,0x3E,0x86,0x3F,0x00,0x3E,0x85,0x3F,0x04,0x3D,0x3A,0x38,0x3B,
+    0x3E,0x84,0x3F,0x04,0x3E,0x36,0x24,0x10,0x03,0x80,0x00,0x02,0x05,0x1C,0x37,0x80,
+    0x3E,0x08,0x34,0x12,0x02,0x00,0x01,0x16,0x29,0x15,0x05,0x80,0x00,0x07,0x01,0x0A,
+    0x22,0x37,0x3E,0x3D,0x25,0x08,0x80,0x00,0x02,0x02,0x1F,0x3B,0x88,0x3F,0x08,0x3E,
+    0x29,0x0B,0x01,0x00,0x01,0x11,0x30,0x3D,0x82,0x3E,0x80,0x3F,0x80,0x3E,0x82,0x3F,
+    0x03,0x3E,0x2F,0x0F,0x01,0x80,0x00,0x08,0x09,0x26,0x3B,0x3E,0x3F,0x3C,0x20,0x07,
+    0x01,0x8C,0x00,0x04,0x0C,0x32,0x3E,0x3F,0x3E,0x9A,0x3F,0x04,0x3E,0x3A,0x29,0x0D,
+    0x01,0x80,0x00,0x16,0x0D,0x2D,0x3C,0x3E,0x2A,0x0C,0x01,0x00,0x05,0x20,0x39,0x2E,
+    0x14,0x04,0x01,0x00,0x01,0x0B,0x23,0x38,0x3C,0x24,0x09,0x80,0x00,0x02,0x05,0x21,
+    0x3C,0x89,0x3F,0x02,0x37,0x19,0x04,0x80,0x00,0x03,0x05,0x1D,0x37,0x3D,0x81,0x3E,
+    0x01,0x3F,0x3E,0x85,0x3F,0x02,0x39,0x1F,0x06,0x80,0x00,0x03,0x01,0x11,0x31,0x3D,
+    0x80,0x3E,0x03,0x31,0x18,0x08,0x03,0x80,0x01,0x03,0x03,0x07,0x05,0x01,0x83,0x00,
+    0x06,0x02,0x08,0x1B,0x36,0x3E,0x3F,0x3E,0x9C,0x3F,0x02,0x3A,0x1F,0x05,0x80,0x00,
+    0x0E,0x05,0x1E,0x39,0x3E,0x2D,0x11,0x03,0x02,0x0D,0x2D,0x3C,0x3D,0x2D,0x14,0x04,
+    0x81,0x00,0x09,0x0D,0x2C,0x3C,0x32,0x16,0x08,0x07,0x14,0x2E,0x3D,0x89,0x3F,0x0A,
+    0x3D,0x2B,0x0D,0x02,0x00,0x01,0x0A,0x24,0x34,0x3A,0x3D,0x86,0x3E,0x80,0x3F,0x03,
+    0x3E,0x31,0x12,0x02,0x80,0x00,0x02,0x06,0x22,0x3A,0x80,0x3E,0x03,0x3C,0x31,0x21,
+    0x14,0x80,0x0C,0x04,0x16,0x21,0x1C,0x0E,0x08,0x81,0x07,0x04,0x08,0x10,0x21,0x33,
+    0x3C,0x80,0x3F,0x00,0x3E,0x9D,0x3F,0x02,0x2F,0x0F,0x01,0x80,0x00,0x04,0x12,0x35,
+    0x3E,0x39,0x26,0x80,0x12,0x07,0x23,0x38,0x3E,0x3F,0x3C,0x2D,0x13,0x03,0x80,0x00,
+    0x01,0x06,0x25,0x80,0x3C,0x00,0x2F,0x80,0x24,0x01,0x2E,0x3B,0x8B,0x3F,0x0A,0x39,
+    0x1D,0x07,0x01,0x00,0x01,0x0A,0x18,0x26,0x30,0x34,0x81,0x35,0x80,0x36,0x01,0x37,
+    0x3B,0x80,0x3E,0x08,0x3F,0x3C,0x24,0x09,0x01,0x00,0x01,0x16,0x39,0x82,0x3E,0x0F,
+    0x3A,0x32,0x2B,0x2C,0x33,0x3B,0x37,0x2D,0x28,0x25,0x24,0x25,0x27,0x2E,0x39,0x3E,
+    0x81,0x3F,0x00,0x3E,0x9D,0x3F,0x02,0x3A,0x1A,0x03,0x80,0x00,0x08,0x0F,0x33,0x3D,
+    0x3E,0x3A,0x2F,0x30,0x39,0x3E,0x81,0x3F,0x09,0x3C,0x2B,0x12,0x06,0x04,0x11,0x2D,
+    0x3D,0x3F,0x3E,0x80,0x3D,0x00,0x3E,0x8C,0x3F,0x03,0x3E,0x31,0x15,0x04,0x81,0x00,
+    0x04,0x03,0x09,0x10,0x13,0x14,0x80,0x15,0x80,0x16,0x0C,0x1A,0x27,0x31,0x36,0x3B,
+    0x3D,0x35,0x18,0x05,0x02,0x03,0x1A,0x39,0x86,0x3E,0x00,0x3F,0x82,0x3E,0x81,0x3D,
+    0x80,0x3E,0xA3,0x3F,0x02,0x3D,0x1F,0x04,0x80,0x00,0x02,0x0E,0x30,0x3D,0x80,0x3F,
+    0x00,0x3E,0x85,0x3F,0x06,0x3C,0x2E,0x1C,0x19,0x2A,0x3A,0x3E,0x92,0x3F,0x04,0x3D,
+    0x2B,0x11,0x04,0x01,0x83,0x00,0x83,0x01,0x0D,0x03,0x09,0x10,0x19,0x28,0x33,0x39,
+    0x2D,0x17,0x0F,0x14,0x2A,0x3C,0x3E,0xB4,0x3F,0x07,0x3D,0x21,0x05,0x01,0x00,0x0C,
+    0x2F,0x3D,0x89,0x3F,0x03,0x3D,0x38,0x36,0x3C,0x95,0x3F,0x05,0x3B,0x2A,0x15,0x08,
+    0x03,0x01,0x88,0x00,0x09,0x01,0x04,0x0A,0x17,0x2A,0x36,0x35,0x31,0x34,0x3B,0x80,
+    0x3E,0xB4,0x3F,0x02,0x3D,0x21,0x05,0x80,0x00,0x02,0x0C,0x2E,0x3D,0xA5,0x3F,0x05,
+    0x3C,0x33,0x22,0x14,0x0B,0x06,0x80,0x04,0x82,0x03,0x01,0x02,0x01,0x81,0x00,0x06,
+    0x01,0x04,0x10,0x27,0x39,0x3D,0x3E,0xB7,0x3F,0x02,0x3D,0x20,0x05,0x80,0x00,0x02,
+    0x0D,0x2F,0x3D,0xA6,0x3F,0x08,0x3E,0x3B,0x34,0x27,0x1E,0x1A,0x18,0x17,0x16,0x80,
+    0x15,0x03,0x11,0x09,0x05,0x03,0x81,0x01,0x04,0x02,0x0F,0x27,0x39,0x3E,0xB7,0x3F,
+    0x02,0x3A,0x1B,0x03,0x80,0x00,0x02,0x0E,0x32,0x3E,0xA8,0x3F,0x06,0x3E,0x3D,0x3B,
+    0x3A,0x39,0x37,0x35,0x80,0x34,0x0C,0x30,0x24,0x1D,0x15,0x09,0x02,0x01,0x00,0x01,
+    0x0F,0x2C,0x3C,0x3E,0xAC,0x3F,0x04,0x3E,0x3C,0x3A,0x3B,0x3E,0x81,0x3F,0x04,0x3E,
+    0x3B,0x2E,0x10,0x01,0x80,0x00,0x02,0x12,0x35,0x3E,0xAA,0x3F,0x80,0x3E,0x00,0x3F,
+    0x83,0x3E,0x05,0x3D,0x3B,0x33,0x22,0x0E,0x03,0x80,0x00,0x03,0x03,0x18,0x36,0x3E,
+    0xAC,0x3F,0x05,0x3B,0x2D,0x22,0x26,0x35,0x3D,0x80,0x3F,0x03,0x3A,0x2C,0x16,0x05,
+    0x80,0x00,0x03,0x04,0x1C,0x39,0x3E,0xAB,0x3F,0x00,0x3E,0x81,0x3F,0x80,0x3E,0x81,
+    0x3F,0x04,0x3E,0x39,0x26,0x0D,0x01,0x80,0x00,0x03,0x0B,0x2F,0x3D,0x3E,0xAA,0x3F,
+    0x0B,0x3E,0x30,0x12,0x06,0x0A,0x21,0x37,0x3E,0x3F,0x31,0x14,0x04,0x80,0x00,0x03,
+    0x01,0x0E,0x2D,0x3C,0x80,0x3E,0xAA,0x3F,0x00,0x3E,0x87,0x3F,0x03,0x3E,0x39,0x1F,
+    0x06,0x80,0x00,0x02,0x05,0x1F,0x39,0x80,0x3E,0xA9,0x3F,0x0A,0x3D,0x27,0x06,0x00,
+    0x01,0x0D,0x2D,0x3D,0x3E,0x2A,0x07,0x81,0x00,0x03,0x03,0x17,0x33,0x3D,0x80,0x3E,
+    0xB4,0x3F,0x80,0x3E,0x02,0x2E,0x0F,0x01,0x80,0x00,0x03,0x10,0x31,0x3D,0x3E,0xA9,
+    0x3F,0x02,0x3D,0x28,0x07,0x80,0x00,0x05,0x04,0x1F,0x38,0x3D,0x28,0x06,0x81,0x00,
+    0x04,0x01,0x0C,0x24,0x38,0x3E,0xB6,0x3F,0x03,0x3E,0x38,0x1B,0x04,0x80,0x00,0x03,
+    0x07,0x24,0x3B,0x3E,0xA8,0x3F,0x80,0x3E,0x0A,0x30,0x0F,0x02,0x00,0x01,0x0D,0x2E,
+    0x3B,0x2A,0x0A,0x02,0x81,0x00,0x03,0x02,0x0D,0x28,0x3C,0xB7,0x3F,0x08,0x3D,0x2A,
+    0x0B,0x01,0x00,0x01,0x17,0x38,0x3E,0xAA,0x3F,0x0B,0x3A,0x1E,0x05,0x01,0x00,0x04,
+    0x1D,0x32,0x2C,0x18,0x0B,0x03,0x81,0x00,0x02,0x02,0x19,0x38,0xB7,0x3F,0x03,0x3E,
+    0x37,0x15,0x03,0x80,0x00,0x02,0x0F,0x31,0x3E,0xAA,0x3F,0x0D,0x3E,0x2E,0x0D,0x02,
+    0x00,0x01,0x0A,0x19,0x1B,0x19,0x10,0x04,0x02,0x01,0x80,0x00,0x02,0x14,0x35,0x3E,
+    0xB7,0x3F,0x02,0x3C,0x20,0x06,0x80,0x00,0x02,0x07,0x25,0x3C,0xAA,0x3F,0x03,0x3E,
+    0x39,0x1C,0x05,0x80,0x00,0x01,0x01,0x02,0x80,0x03,0x03,0x02,0x01,0x02,0x01,0x80,
+    0x00,0x02,0x14,0x36,0x3E,0xB6,0x3F,0x08,0x3E,0x3D,0x2D,0x0C,0x01,0x00,0x01,0x1B,
+    0x3A,0xAA,0x3F,0x80,0x3E,0x02,0x2C,0x0D,0x01,0x88,0x00,0x03,0x02,0x19,0x39,0x3E,
+    0xB6,0x3F,0x80,0x3E,0x02,0x37,0x13,0x01,0x80,0x00,0x02,0x18,0x39,0x3E,0xA9,0x3F,
+    0x80,0x3E,0x02,0x38,0x19,0x03,0x81,0x00,0x84,0x01,0x03,0x03,0x0E,0x28,0x3C,0xB7,
+    0x3F,0x80,0x3E,0x02,0x3A,0x15,0x02,0x80,0x00,0x02,0x15,0x37,0x3E,0xAB,0x3F,0x02,
+    0x3D,0x24,0x08,0x81,0x00,0x00,0x06,0x80,0x0E,0x80,0x0C,0x04,0x0D,0x14,0x27,0x39,
+    0x3E,0xB7,0x3F,0x80,0x3E,0x02,0x3B,0x17,0x02,0x80,0x00,0x02,0x13,0x34,0x3E,0xAB,
+    0x3F,0x03,0x3E,0x32,0x11,0x01,0x80,0x00,0x08,0x11,0x2D,0x30,0x2D,0x2C,0x2E,0x33,
+    0x3B,0x3E,0xB8,0x3F,0x80,0x3E,0x02,0x3B,0x19,0x03,0x80,0x00,0x01,0x12,0x32,0x80,
+    0x3E,0xAB,0x3F,0x02,0x39,0x16,0x01,0x80,0x00,0x01,0x13,0x38,0x80,0x3E,0x00,0x3D,
+    0x80,0x3E,0xBC,0x3F,0x02,0x3B,0x1A,0x03,0x80,0x00,0x03,0x11,0x31,0x3D,0x3E,0xAB,
+    0x3F,0x02,0x3B,0x17,0x02,0x80,0x00,0x01,0x12,0x36,0x81,0x3E,0xBE,0x3F,0x02,0x3B,
+    0x1B,0x04,0x80,0x00,0x03,0x0F,0x2F,0x3D,0x3E,0xAB,0x3F,0x07,0x3C,0x18,0x02,0x00,
+    0x01,0x10,0x33,0x3D,0x80,0x3E,0xBE,0x3F,0x02,0x3C,0x20,0x06,0x80,0x00,0x03,0x09,
+    0x28,0x3C,0x3E,0xAB,0x3F,0x02,0x3C,0x1A,0x02,0x80,0x00,0x02,0x0F,0x32,0x3D,0xC0,
+    0x3F,0x07,0x3D,0x2B,0x10,0x09,0x08,0x0C,0x27,0x3C,0xAC,0x3F,0x07,0x3D,0x1F,0x0B,
+    0x08,0x09,0x15,0x32,0x3D,0xC1,0x3F,0x06,0x39,0x2D,0x2B,0x2A,0x2B,0x35,0x3E,0xAC,
+    0x3F,0x02,0x3E,0x32,0x2B,0x80,0x2A,0x02,0x2F,0x3A,0x3E,0xFF,0x3F,0xFF,0x3F,0xFF,
+    0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,
+    0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,
+    0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,0x3F,0xFF,
+    0x3F,0x84,0x3F,
+};
+const lcd_image_t gImage_3_rle = {128, 128, LCD_IMG_RLE8, 64, gImage_3_rle_palette, gImage_3_rle_data, sizeof(gImage_3_rle_data)};
+
+/* gImage_4: 128x128, RLE565, 22219 bytes (raw 32768 bytes) */
+static const u8 gImage_4_rle_data[22219] = {
+    0x00,0x93,0x4A,0x82,0x93,0x29,0x80,0x93,0x09,0x80,0x8B,0x08,0x00,0x8A,0xE8,0x81,
+    0x8A,0xE7,0x01,0x82,0xC7,0x82,0xA6,0x80,0x7A,0x86,0x8C,0x7A,0x85,0x81,0x7A,0x65,
+    0x00,0x7A,0x45,0x82,0x7A,0x65,0x83,0x72,0x45,0x00,0x72,0x44,0x80,0x6A,0x24,0x82,
+    0x6A,0x04,0x80,0x61,0xE3,0x82,0x61,0xC3,0x82,0x59,0xA3,0x84,0x59,0x83,0x02,0x59,
+    0x63,0x51,0x63,0x51,0x43,0x80,0x51,0x42,0x00,0x51,0x22,0x81,0x49,0x22,0x00,0x49,
+    0x21,0x87,0x41,0x01,0x12,0x41,0x00,0x39,0x42,0x8C,0x0E,0xEF,0x1B,0xFF,0xBD,0xFF,
+    0xBE,0xF7,0x9D,0xD6,0x79,0xA5,0x14,0x83,0xEE,0x7B,0xCE,0xA5,0x12,0xD6,0x98,0xF7,
+    0x9C,0xF7,0xDD,0xFF,0xDD,0xEF,0x5B,0x7B,0x6C,0x39,0x64,0x82,0x39,0x43,0x81,0x41,
+    0x43,0x81,0x41,0x63,0x88,0x41,0x83,0x80,0x41,0x84,0x00,0x41,0x63,0x84,0x82,0xA7,
+    0x02,0x82,0x87,0x82,0x86,0x7A,0x86,0x83,0x7A,0x66,0x80,0x7A,0x45,0x81,0x72,0x45,
+    0x01,0x72,0x44,0x72,0x24,0x86,0x6A,0x24,0x00,0x6A,0x44,0x80,0x6A,0x24,0x86,0x6A,
+    0x04,0x80,0x62,0x04,0x80,0x61,0xE4,0x80,0x59,0xC3,0x81,0x59,0xA3,0x84,0x51,0x82,
+    0x80,0x51,0x62,0x81,0x49,0x62,0x83,0x49,0x42,0x80,0x49,0x22,0x01,0x49,0x21,0x41,
+    0x21,0x86,0x41,0x01,0x82,0x39,0x01,0x81,0x41,0x01,0x81,0x39,0x01,0x01,0x6A,0xC8,
+    0xE6,0xD9,0x80,0xFF,0xBD,0x02,0xE7,0x1A,0x83,0xEE,0x39,0xC6,0x80,0x29,0x23,0x04,
+    0x29,0x43,0x31,0x43,0x41,0xC5,0xA4,0xF1,0xEF,0x7B,0x80,0xFF,0xDD,0x01,0xDE,0x98,
+    0x52,0x27,0x80,0x39,0x43,0x81,0x41,0x43,0x81,0x41,0x63,0x80,0x49,0x63,0x83,0x49,
+    0x83,0x00,0x49,0x63,0x80,0x41,0x63,0x01,0x41,0x43,0x39,0x23,0x80,0x39,0x22,0x00,
+    0x31,0x02,0x84,0x72,0x46,0x81,0x72,0x25,0x80,0x6A,0x05,0x8B,0x6A,0x04,0x00,0x69,
+    0xE4,0x83,0x61,0xE3,0x03,0x59,0xE3,0x59,0xC3,0x59,0xC2,0x59,0xA2,0x86,0x51,0x82,
+    0x01,0x51,0x62,0x49,0x62,0x81,0x49,0x42,0x00,0x49,0x41,0x85,0x49,0x21,0x82,0x41,
+    0x21,0x85,0x41,0x01,0x00,0x39,0x01,0x84,0x38,0xE1,0x81,0x39,0x01,0x86,0x41,0x01,
+    0x80,0x39,0x01,0x06,0x49,0x83,0xCD,0xD4,0xFF,0x7B,0xFF,0xBD,0xEF,0x1A,0x73,0x4C,
+    0x31,0x64,0x80,0x31,0x23,0x00,0x31,0x43,0x80,0x31,0x23,0x08,0x39,0x43,0x41,0xA4,
+    0xC5,0xF6,0xF7,0xBC,0xFF,0xDD,0xF7,0x9C,0x7B,0x6B,0x41,0x64,0x39,0x43,0x81,0x41,
+    0x43,0x81,0x41,0x63,0x00,0x49,0x63,0x82,0x49,0x83,0x80,0x49,0x63,0x80,0x41,0x63,
+    0x02,0x41,0x43,0x39,0x23,0x39,0x02,0x80,0x31,0x02,0x01,0x30,0xE2,0x6A,0x05,0x82,
+    0x6A,0x04,0x80,0x69,0xE4,0x80,0x69,0xC4,0x00,0x61,0xC3,0x81,0x61,0xA3,0x01,0x61,
+    0xA2,0x61,0xC3,0x80,0x61,0xC2,0x00,0x61,0xA3,0x83,0x59,0xA3,0x80,0x59,0x83,0x81,
+    0x59,0x82,0x81,0x51,0x82,0x80,0x49,0x61,0x01,0x49,0x41,0x41,0x41,0x81,0x41,0x21,
+    0x80,0x41,0x20,0x81,0x41,0x00,0x83,0x40,0xE0,0x87,0x38,0xE0,0x00,0x38,0xE1,0x80,
+    0x38,0xE0,0x00,0x38,0xC0,0x8E,0x38,0xE1,0x82,0x39,0x01,0x81,0x41,0x01,0x80,0x39,
+    0x01,0x01,0x73,0x09,0xEF,0x19,0x80,0xFF,0xBC,0x02,0x8C,0x4F,0x39,0x84,0x31,0x23,
+    0x80,0x39,0x23,0x81,0x31,0x23,0x03,0x39,0x42,0x31,0x43,0x94,0x6F,0xF7,0x7B,0x80,
+    0xFF,0xDD,0x01,0xB5,0x53,0x49,0xC5,0x86,0x41,0x63,0x80,0x49,0x63,0x83,0x41,0x63,
+    0x03,0x41,0x43,0x39,0x43,0x39,0x22,0x39,0x02,0x80,0x30,0xE2,0x00,0x28,0xE2,0x82,
+    0x59,0xA3,0x81,0x59,0x83,0x00,0x59,0x82,0x80,0x59,0x62,0x00,0x51,0x62,0x81,0x51,
+    0x42,0x81,0x51,0x62,0x00,0x51,0x42,0x82,0x49,0x42,0x80,0x49,0x22,0x01,0x41,0x22,
+    0x41,0x21,0x82,0x41,0x01,0x80,0x41,0x00,0x84,0x38,0xE0,0x00,0x39,0x00,0x83,0x38,
+    0xE0,0x87,0x38,0xC0,0x02,0x38,0xC1,0x38,0xE1,0x38,0xC1,0x97,0x38,0xE1,0x83,0x39,
+    0x01,0x04,0xB4,0xF0,0xF7,0x5A,0xFF,0xBC,0xD6,0x77,0x4A,0x26,0x80,0x31,0x23,0x82,
+    0x39,0x23,0x80,0x39,0x42,0x02,0x31,0x43,0x7B,0xAC,0xEF,0x7B,0x80,0xFF,0xDD,0x03,
+    0xD6,0x77,0x4A,0x06,0x39,0x63,0x41,0x43,0x84,0x41,0x63,0x80,0x41,0x83,0x81,0x41,
+    0x63,0x00,0x41,0x62,0x80,0x41,0x43,0x02,0x39,0x43,0x39,0x22,0x31,0x02,0x80,0x30,
+    0xE2,0x00,0x28,0xE2,0x80,0x51,0x62,0x80,0x49,0x62,0x80,0x49,0x42,0x00,0x49,0x22,
+    0x80,0x49,0x21,0x85,0x41,0x01,0x81,0x40,0xE1,0x80,0x40,0xC1,0x87,0x38,0xC0,0x00,
+    0x38,0xE0,0x81,0x38,0xC0,0x81,0x30,0xC0,0x82,0x30,0xE1,0x82,0x38,0xE1,0x82,0x38,
+    0xE0,0x01,0x38,0xE1,0x30,0xE1,0x84,0x38,0xE1,0x86,0x30,0xE1,0x8F,0x38,0xE1,0x81,
+    0x39,0x01,0x07,0x39,0x22,0x5A,0x26,0x83,0x8B,0xC5,0xB4,0x8C,0x0E,0x39,0x63,0x29,
+    0x02,0x31,0x22,0x80,0x39,0x22,0x82,0x39,0x42,0x02,0x31,0x43,0x6B,0x0A,0xEF,0x5B,
+    0x80,0xFF,0xDD,0x02,0xD6,0x78,0x52,0x06,0x39,0x43,0x80,0x41,0x43,0x83,0x41,0x63,
+    0x80,0x41,0x83,0x81,0x41,0x63,0x04,0x41,0x62,0x41,0x43,0x39,0x43,0x39,0x23,0x39,
+    0x02,0x80,0x30,0xE2,0x80,0x28,0xE2,0x00,0x49,0x21,0x81,0x41,0x21,0x00,0x39,0x21,
+    0x80,0x39,0x01,0x01,0x38,0xE1,0x38,0xE0,0x82,0x30,0xC0,0x82,0x30,0xA0,0x80,0x30,
+    0x80,0x85,0x30,0xA0,0x81,0x30,0xC0,0x00,0x30,0xC1,0x84,0x30,0xC0,0x00,0x30,0xE0,
+    0x82,0x30,0xE1,0x00,0x30,0xE0,0x80,0x38,0xE0,0x83,0x30,0xE0,0x94,0x30,0xE1,0x80,
+    0x30,0xC1,0x00,0x30,0xE1,0x85,0x38,0xE1,0x83,0x39,0x02,0x06,0x39,0x22,0x31,0x22,
+    0x39,0x63,0x39,0x43,0x31,0x22,0x31,0x02,0x31,0x22,0x80,0x39,0x22,0x82,0x39,0x42,
+    0x02,0x31,0x43,0x7B,0x8C,0xEF,0x5B,0x80,0xFF,0xDD,0x02,0xCE,0x37,0x4A,0x06,0x39,
+    0x43,0x80,0x41,0x43,0x82,0x41,0x63,0x81,0x41,0x83,0x82,0x41,0x63,0x04,0x41,0x43,
+    0x39,0x43,0x39,0x23,0x31,0x02,0x30,0xE2,0x81,0x28,0xE2,0x80,0x38,0xE0,0x82,0x30,
+    0xE0,0x86,0x30,0xC0,0x00,0x30,0xC1,0x87,0x30,0xA1,0x83,0x30,0xC1,0x00,0x30,0xE1,
+    0x80,0x30,0xC1,0x80,0x30,0xC0,0x81,0x30,0xE0,0x82,0x30,0xE1,0x86,0x30,0xE0,0x80,
+    0x30,0xE1,0x01,0x28,0xE1,0x30,0xE1,0x82,0x30,0xC1,0x8E,0x30,0xE1,0x81,0x30,0xC1,
+    0x81,0x38,0xE1,0x81,0x38,0xE2,0x84,0x39,0x02,0x83,0x31,0x02,0x80,0x39,0x22,0x82,
+    0x39,0x42,0x02,0x31,0x22,0x9C,0xB1,0xF7,0x9C,0x80,0xFF,0xDD,0x02,0xA5,0x12,0x49,
+    0xC5,0x39,0x63,0x80,0x41,0x43,0x87,0x41,0x63,0x06,0x41,0x62,0x41,0x42,0x41,0x43,
+    0x39,0x23,0x31,0x02,0x30,0xE2,0x28,0xE2,0x81,0x28,0xC2,0x00,0x38,0xC0,0x83,0x30,
+    0xC0,0x81,0x30,0xC1,0x82,0x30,0xC0,0x80,0x30,0xC1,0x80,0x28,0xA1,0x80,0x30,0xA0,
+    0x84,0x30,0xA1,0x83,0x30,0xC1,0x81,0x30,0xC0,0x82,0x30,0xC1,0x82,0x30,0xE1,0x86,
+    0x30,0xE0,0x00,0x30,0xE1,0x81,0x30,0xC1,0x83,0x30,0xE1,0x00,0x28,0xE1,0x80,0x28,
+    0xC1,0x00,0x28,0xE1,0x81,0x30,0xE1,0x80,0x28,0xE1,0x85,0x30,0xE1,0x80,0x30,0xC1,
+    0x82,0x30,0xE1,0x00,0x38,0xE1,0x84,0x39,0x02,0x84,0x31,0x02,0x81,0x39,0x22,0x00,
+    0x31,0x22,0x80,0x31,0x42,0x07,0x4A,0x06,0xD6,0x57,0xFF,0xBD,0xFF,0xDD,0xEF,0x5B,
+    0x6B,0x2A,0x41,0xA4,0x39,0x63,0x84,0x41,0x43,0x82,0x41,0x63,0x01,0x41,0x62,0x41,
+    0x42,0x80,0x39,0x42,0x02,0x39,0x22,0x31,0x02,0x30,0xE2,0x82,0x28,0xC2,0x8A,0x30,
+    0xC0,0x00,0x30,0xC1,0x82,0x28,0xC1,0x82,0x28,0xA1,0x81,0x30,0xA1,0x84,0x30,0xC1,
+    0x82,0x30,0xC0,0x80,0x30,0xC1,0x00,0x30,0xC0,0x82,0x30,0xC1,0x86,0x30,0xE1,0x82,
+    0x30,0xC1,0x97,0x30,0xE1,0x81,0x30,0xE2,0x87,0x31,0x02,0x01,0x39,0x02,0x31,0x02,
+    0x83,0x39,0x22,0x03,0x39,0x42,0x41,0xA4,0xAD,0x12,0xF7,0x9C,0x80,0xFF,0xDD,0x01,
+    0xBD,0xB4,0x4A,0x06,0x80,0x39,0x63,0x84,0x41,0x43,0x83,0x41,0x63,0x80,0x39,0x42,
+    0x01,0x39,0x22,0x31,0x02,0x80,0x30,0xE2,0x80,0x28,0xC1,0x80,0x28,0xC2,0x87,0x30,
+    0xC0,0x82,0x30,0xC1,0x82,0x28,0xC1,0x82,0x28,0xA1,0x81,0x30,0xA1,0x84,0x30,0xC1,
+    0x85,0x30,0xE0,0x00,0x30,0xC1,0xA6,0x30,0xE1,0x85,0x30,0xE2,0x83,0x31,0x02,0x80,
+    0x39,0x02,0x82,0x39,0x22,0x03,0x31,0x22,0x39,0x83,0x94,0x4F,0xEF,0x3B,0x80,0xFF,
+    0xDD,0x02,0xD6,0xB8,0x5A,0xC9,0x41,0x84,0x80,0x39,0x63,0x88,0x41,0x43,0x01,0x41,
+    0x42,0x39,0x42,0x80,0x39,0x22,0x04,0x31,0x02,0x30,0xE2,0x28,0xE2,0x28,0xC1,0x28,
+    0xA1,0x80,0x28,0xC2,0x83,0x30,0xC0,0x82,0x30,0xE0,0x82,0x30,0xC1,0x82,0x28,0xC1,
+    0x82,0x28,0xA1,0x81,0x30,0xA1,0x00,0x30,0xC1,0x82,0x28,0xC1,0x86,0x30,0xC0,0x83,
+    0x30,0xE1,0x86,0x30,0xC1,0x9A,0x30,0xE1,0x85,0x30,0xE2,0x83,0x31,0x02,0x80,0x39,
+    0x02,0x00,0x39,0x22,0x80,0x31,0x22,0x08,0x31,0x23,0x39,0x64,0x8B,0xEE,0xEF,0x1A,
+    0xFF,0xBD,0xFF,0xDD,0xDE,0xF9,0x6B,0x2A,0x39,0x84,0x81,0x39,0x63,0x00,0x41,0x63,
+    0x87,0x41,0x43,0x01,0x41,0x42,0x39,0x42,0x80,0x39,0x22,0x06,0x31,0x02,0x28,0xE2,
+    0x28,0xC1,0x28,0xA1,0x20,0xA1,0x28,0xC1,0x28,0xC2,0x83,0x30,0xC0,0x82,0x30,0xE1,
+    0x82,0x30,0xC1,0x82,0x28,0xC1,0x82,0x28,0xA1,0x82,0x30,0xA1,0x82,0x28,0xC1,0x91,
+    0x28,0xC0,0x80,0x30,0xC1,0x9A,0x30,0xE1,0x85,0x30,0xE2,0x83,0x31,0x02,0x80,0x39,
+    0x02,0x00,0x31,0x02,0x80,0x31,0x22,0x0B,0x31,0x43,0x83,0xAC,0xE6,0xFA,0xF7,0xBC,
+    0xFF,0xDD,0xDE,0xD9,0x6B,0x4B,0x39,0x63,0x31,0x63,0x31,0x43,0x39,0x43,0x39,0x63,
+    0x87,0x41,0x43,0x80,0x39,0x42,0x80,0x39,0x22,0x01,0x31,0x02,0x30,0xE2,0x81,0x28,
+    0xC1,0x03,0x20,0xA1,0x28,0xC1,0x28,0xC2,0x30,0xC0,0x8A,0x30,0xC1,0x82,0x28,0xC1,
+    0x82,0x28,0xA1,0x82,0x30,0xA1,0x82,0x28,0xC1,0x8E,0x28,0xC0,0x80,0x28,0xA0,0x01,
+    0x28,0xC0,0x30,0xC1,0x9B,0x30,0xE1,0x85,0x30,0xE2,0x86,0x31,0x02,0x80,0x31,0x22,
+    0x09,0x62,0xC9,0xDE,0xD9,0xFF,0xBC,0xFF,0xBD,0xE7,0x1A,0x73,0x6B,0x39,0x84,0x39,
+    0x63,0x31,0x63,0x39,0x63,0x80,0x39,0x43,0x85,0x41,0x43,0x81,0x39,0x43,0x01,0x41,
+    0x43,0x39,0x23,0x80,0x31,0x02,0x00,0x28,0xE2,0x82,0x28,0xC1,0x02,0x28,0xC2,0x30,
+    0xE2,0x30,0xC0,0x8A,0x30,0xC1,0x82,0x28,0xC1,0x82,0x28,0xA1,0x82,0x30,0xA1,0x82,
+    0x28,0xC1,0x8E,0x28,0xC0,0x80,0x28,0xA0,0x00,0x28,0xC0,0x9C,0x30,0xE1,0x85,0x30,
+    0xE2,0x86,0x31,0x02,0x07,0x31,0x22,0x41,0x83,0xC5,0xD5,0xF7,0x7C,0xFF,0xBD,0xF7,
+    0x5B,0x7B,0xED,0x39,0x84,0x83,0x39,0x43,0x80,0x41,0x23,0x82,0x41,0x22,0x00,0x39,
+    0x22,0x80,0x39,0x42,0x80,0x39,0x22,0x03,0x39,0x23,0x39,0x02,0x31,0x02,0x28,0xE2,
+    0x82,0x28,0xC1,0x03,0x28,0xC2,0x30,0xE2,0x31,0x23,0x30,0xC0,0x8A,0x30,0xC1,0x82,
+    0x28,0xC1,0x82,0x28,0xA1,0x82,0x30,0xA1,0x82,0x28,0xA1,0x8E,0x28,0xC0,0x80,0x28,
+    0xA0,0x00,0x28,0xC0,0x9C,0x30,0xE1,0x85,0x30,0xE2,0x86,0x31,0x02,0x08,0x31,0x22,
+    0x7B,0x4B,0xEF,0x1A,0xFF,0x9D,0xFF,0xBD,0xB5,0x74,0x39,0xA5,0x31,0x43,0x31,0x23,
+    0x8D,0x39,0x22,0x0A,0x39,0x02,0x30,0xE2,0x30,0xE1,0x28,0xC1,0x20,0xC1,0x20,0xA1,
+    0x28,0xC1,0x28,0xC2,0x28,0xE2,0x31,0x03,0x39,0x44,0x8B,0x30,0xC1,0x82,0x28,0xC1,
+    0x82,0x28,0xA1,0x81,0x30,0xA1,0x83,0x28,0xA1,0x81,0x28,0xA0,0x8B,0x28,0xC0,0x80,
+    0x28,0xA0,0x01,0x28,0xC0,0x30,0xC1,0x83,0x30,0xE1,0x00,0x30,0xE2,0x95,0x30,0xE1,
+    0x89,0x30,0xE2,0x82,0x31,0x02,0x08,0x31,0x22,0xB5,0x12,0xF7,0x7C,0xFF,0xBD,0xEF,
+    0x5C,0x5A,0xE9,0x39,0x64,0x31,0x43,0x31,0x23,0x8C,0x39,0x22,0x00,0x31,0x02,0x80,
+    0x30,0xE2,0x80,0x28,0xC1,0x80,0x20,0xC1,0x04,0x28,0xC1,0x28,0xE2,0x30,0xE2,0x31,
+    0x03,0x39,0x44,0x8B,0x30,0xC1,0x8F,0x28,0xA1,0x83,0x28,0xA0,0x8B,0x28,0xC0,0x01,
+    0x28,0xC1,0x30,0xC1,0x81,0x30,0xE1,0x81,0x30,0xE2,0x84,0x30,0xE1,0x85,0x28,0xE1,
+    0x82,0x30,0xE1,0x8E,0x30,0xE2,0x82,0x31,0x02,0x09,0x41,0x84,0xD6,0x37,0xFF,0xBD,
+    0xFF,0xDD,0xC6,0x16,0x39,0xA5,0x29,0x03,0x31,0x23,0x31,0x22,0x39,0x22,0x87,0x39,
+    0x02,0x01,0x39,0x22,0x39,0x02,0x81,0x31,0x02,0x00,0x30,0xE2,0x80,0x28,0xC1,0x81,
+    0x20,0xC1,0x04,0x28,0xC1,0x28,0xE2,0x31,0x02,0x31,0x23,0x39,0x43,0x88,0x30,0xC1,
+    0x8D,0x28,0xA1,0x82,0x30,0xA1,0x80,0x28,0xA1,0x80,0x28,0xA0,0x84,0x28,0xA1,0x00,
+    0x28,0xA0,0x86,0x28,0xC0,0x02,0x28,0xA1,0x28,0xC1,0x30,0xC1,0x80,0x30,0xE1,0x80,
+    0x31,0x02,0x80,0x30,0xE2,0x8E,0x30,0xE1,0x86,0x30,0xE2,0x86,0x30,0xE1,0x82,0x31,
+    0x02,0x07,0x49,0xC5,0xE6,0xB9,0xFF,0xDD,0xFF,0xBD,0x84,0x0E,0x31,0x44,0x29,0x03,
+    0x31,0x02,0x8B,0x39,0x02,0x81,0x31,0x02,0x00,0x30,0xE2,0x80,0x28,0xC1,0x80,0x20,
+    0xA1,0x05,0x20,0xC1,0x28,0xC1,0x29,0x02,0x31,0x03,0x31,0x23,0x39,0x43,0x81,0x30,
+    0xC1,0x00,0x28,0xC1,0x93,0x28,0xA1,0x83,0x30,0xA1,0x80,0x28,0xA1,0x00,0x28,0xA0,
+    0x85,0x28,0xA1,0x00,0x28,0xA0,0x86,0x28,0xC0,0x01,0x28,0xC1,0x30,0xC1,0x80,0x30,
+    0xE1,0x82,0x30,0xE2,0x83,0x30,0xE1,0x87,0x30,0xC1,0x80,0x30,0xE1,0x86,0x30,0xE2,
+    0x86,0x30,0xE1,0x82,0x31,0x02,0x06,0x5A,0x47,0xE6,0xF9,0xFF,0xDD,0xF7,0x9C,0x5A,
+    0xE9,0x29,0x23,0x29,0x02,0x81,0x31,0x02,0x00,0x38,0xE2,0x87,0x39,0x02,0x81,0x31,
+    0x02,0x01,0x30,0xE2,0x28,0xE2,0x80,0x28,0xC1,0x80,0x20,0xA1,0x02,0x20,0xC1,0x28,
+    0xE1,0x31,0x02,0x80,0x31,0x23,0x02,0x39,0x43,0x28,0xC1,0x30,0xC1,0x97,0x28,0xA1,
+    0x81,0x30,0xA1,0x8D,0x28,0xA1,0x00,0x28,0xA0,0x81,0x28,0xC0,0x80,0x30,0xC1,0x80,
+    0x30,0xE1,0x80,0x30,0xE2,0x01,0x31,0x02,0x30,0xE2,0x83,0x30,0xE1,0x88,0x30,0xC1,
+    0x00,0x30,0xE1,0x86,0x30,0xE2,0x86,0x30,0xE1,0x00,0x31,0x01,0x81,0x31,0x02,0x05,
+    0x52,0x46,0xE6,0xF9,0xFF,0xBC,0xF7,0x7B,0x52,0x88,0x31,0x23,0x83,0x28,0xE1,0x84,
+    0x30,0xE1,0x82,0x30,0xE2,0x81,0x28,0xE1,0x80,0x28,0xC1,0x81,0x20,0xA1,0x02,0x20,
+    0xC1,0x28,0xE2,0x31,0x22,0x80,0x31,0x23,0x01,0x39,0x43,0x28,0xC1,0x89,0x28,0xA1,
+    0x82,0x28,0x80,0x9C,0x28,0xA1,0x00,0x28,0xA0,0x80,0x28,0xC0,0x80,0x28,0xC1,0x80,
+    0x30,0xE1,0x80,0x31,0x02,0x00,0x39,0x02,0x84,0x30,0xE1,0x88,0x30,0xC1,0x00,0x30,
+    0xE1,0x82,0x30,0xE2,0x80,0x38,0xE1,0x01,0x30,0xE1,0x30,0xC1,0x82,0x30,0xE2,0x85,
+    0x30,0xE1,0x07,0x30,0xE2,0x41,0xA4,0x9C,0x90,0xAD,0x32,0xAD,0x12,0x41,0xC5,0x30,
+    0xE2,0x28,0xC1,0x80,0x28,0xE1,0x8C,0x28,0xC1,0x80,0x28,0xA1,0x05,0x20,0xA1,0x20,
+    0x81,0x20,0xA1,0x20,0xC1,0x28,0xE2,0x29,0x02,0x81,0x31,0x23,0x00,0x39,0x23,0x87,
+    0x28,0xA1,0x86,0x28,0x80,0x9C,0x28,0xA1,0x01,0x28,0xA0,0x28,0xC0,0x80,0x28,0xC1,
+    0x80,0x30,0xE1,0x81,0x31,0x02,0x00,0x31,0x01,0x83,0x30,0xE1,0x89,0x30,0xC1,0x80,
+    0x30,0xE1,0x80,0x30,0xE2,0x80,0x38,0xE1,0x80,0x30,0xC1,0x87,0x30,0xE1,0x80,0x28,
+    0xE1,0x02,0x28,0xE2,0x28,0xE1,0x20,0xA1,0x81,0x20,0xC1,0x80,0x28,0xA1,0x80,0x28,
+    0xC1,0x80,0x28,0xA1,0x85,0x20,0xA0,0x81,0x20,0x80,0x80,0x20,0xA1,0x82,0x20,0x81,
+    0x02,0x20,0xA1,0x20,0xC1,0x29,0x02,0x82,0x31,0x23,0x00,0x39,0x23,0x87,0x28,0xA1,
+    0x86,0x28,0x80,0x9D,0x28,0xA1,0x02,0x28,0xA0,0x28,0xC1,0x30,0xC1,0x80,0x30,0xE1,
+    0x00,0x31,0x01,0x80,0x31,0x02,0x00,0x39,0x02,0x80,0x39,0x01,0x86,0x38,0xE1,0x03,
+    0x30,0xE1,0x30,0xE0,0x38,0xE1,0x39,0x00,0x84,0x39,0x01,0x81,0x38,0xE1,0x81,0x30,
+    0xE1,0x00,0x30,0xC1,0x83,0x28,0xC1,0x00,0x28,0xC0,0x81,0x28,0xC1,0x06,0x20,0xC1,
+    0x20,0x80,0x18,0x80,0x20,0xA0,0x20,0xA1,0x20,0x81,0x20,0xA1,0x81,0x20,0xA0,0x80,
+    0x20,0x80,0x00,0x20,0xA0,0x86,0x20,0x80,0x84,0x20,0x81,0x03,0x20,0xA1,0x28,0xE2,
+    0x29,0x03,0x31,0x03,0x81,0x31,0x23,0x00,0x39,0x43,0x86,0x28,0xA1,0x00,0x28,0xA0,
+    0x90,0x28,0x80,0x92,0x28,0xA1,0x80,0x28,0xA0,0x00,0x28,0xC0,0x80,0x30,0xC1,0x05,
+    0x30,0xE1,0x39,0x22,0x41,0x42,0x41,0x63,0x49,0xA3,0x51,0xC4,0x80,0x59,0xE4,0x80,
+    0x5A,0x04,0x04,0x59,0xE4,0x51,0xC4,0x49,0x83,0x49,0x62,0x41,0x62,0x80,0x41,0x42,
+    0x00,0x49,0x82,0x83,0x51,0xC3,0x03,0x51,0xA3,0x41,0x42,0x41,0x22,0x39,0x02,0x80,
+    0x38,0xE1,0x02,0x30,0xE1,0x30,0xC1,0x28,0xA0,0x80,0x28,0x80,0x87,0x20,0x80,0x80,
+    0x18,0x80,0x00,0x20,0xA0,0x8B,0x20,0x80,0x80,0x20,0x60,0x08,0x18,0x60,0x20,0x60,
+    0x20,0x81,0x20,0x60,0x18,0x60,0x18,0x80,0x20,0xA1,0x28,0xC2,0x29,0x02,0x80,0x29,
+    0x03,0x81,0x31,0x23,0x00,0x31,0x43,0x85,0x28,0xA1,0x80,0x28,0x81,0x00,0x28,0xA0,
+    0x91,0x28,0x80,0x00,0x28,0xA0,0x81,0x28,0x80,0x80,0x28,0xA0,0x81,0x28,0x80,0x80,
+    0x28,0xA1,0x82,0x28,0xA0,0x80,0x28,0xA1,0x80,0x28,0xA0,0x0A,0x30,0xC0,0x30,0xE0,
+    0x39,0x01,0x41,0x41,0x49,0xA3,0x5A,0x25,0x6A,0x86,0x6A,0xA6,0x7B,0x07,0x83,0x49,
+    0x8B,0x69,0x82,0x8B,0x89,0x06,0x8B,0x68,0x7B,0x07,0x7A,0xE7,0x72,0xC6,0x72,0x86,
+    0x6A,0x85,0x72,0xC6,0x83,0x83,0x27,0x08,0x7A,0xC6,0x6A,0x65,0x62,0x25,0x59,0xE4,
+    0x49,0x82,0x39,0x21,0x30,0xE0,0x30,0xC0,0x28,0xA0,0x80,0x28,0x80,0x81,0x20,0x80,
+    0x00,0x18,0x80,0x80,0x20,0x80,0x81,0x20,0x60,0x82,0x18,0x80,0x8B,0x20,0x80,0x00,
+    0x20,0x60,0x83,0x18,0x60,0x03,0x18,0x81,0x20,0xA1,0x28,0xE2,0x31,0x03,0x81,0x31,
+    0x23,0x81,0x31,0x43,0x85,0x28,0xA1,0x90,0x28,0x80,0x8B,0x20,0x80,0x80,0x28,0x80,
+    0x82,0x28,0xA0,0x01,0x28,0xC0,0x30,0xC0,0x80,0x30,0xE0,0x0C,0x39,0x21,0x41,0x61,
+    0x5A,0x04,0x6A,0x86,0x7B,0x28,0x93,0xCA,0x9C,0x0B,0xA4,0x2B,0xA4,0x4C,0xAC,0x4C,
+    0xAC,0x4B,0xAC,0x4C,0xAC,0x6C,0x80,0xAC,0x4B,0x06,0xA4,0x4B,0xA4,0x0A,0x9B,0xEA,
+    0x9B,0xC9,0x93,0xA9,0x93,0xC9,0x9B,0xEA,0x80,0xA4,0x0A,0x00,0xA3,0xEA,0x82,0x9B,
+    0xC9,0x06,0x9B,0xCA,0x9B,0xAA,0x83,0x27,0x62,0x44,0x49,0x62,0x38,0xE0,0x30,0xC0,
+    0x80,0x28,0x80,0x81,0x20,0x80,0x83,0x18,0x80,0x03,0x28,0xE2,0x41,0xE6,0x4A,0x06,
+    0x29,0x23,0x80,0x18,0x80,0x80,0x20,0x80,0x80,0x20,0xA0,0x87,0x20,0x80,0x82,0x20,
+    0x81,0x02,0x20,0xA1,0x28,0xC2,0x28,0xE2,0x80,0x31,0x23,0x80,0x31,0x43,0x80,0x31,
+    0x44,0x80,0x31,0x43,0x84,0x28,0xA1,0x00,0x28,0xA0,0x80,0x28,0x80,0x94,0x20,0x80,
+    0x80,0x20,0x60,0x81,0x20,0x80,0x00,0x20,0x60,0x83,0x20,0x80,0x12,0x20,0xA0,0x28,
+    0xC0,0x30,0xE0,0x39,0x21,0x41,0x61,0x49,0xA2,0x5A,0x24,0x72,0xE7,0x8B,0xA9,0x9C,
+    0x0B,0xA4,0x4C,0xB4,0xAD,0xBC,0xCE,0xBC,0xCD,0xBC,0xAD,0xB4,0x8C,0xB4,0x6C,0xBC,
+    0x8C,0xC4,0xCD,0x80,0xC4,0xED,0x02,0xBC,0xED,0xBC,0xAC,0xB4,0x6B,0x80,0xAC,0x4B,
+    0x00,0xB4,0x8C,0x82,0xBC,0xAC,0x00,0xB4,0x8C,0x81,0xB4,0x6B,0x80,0xB4,0x6C,0x07,
+    0xAC,0x6C,0x9B,0xEA,0x83,0x27,0x62,0x44,0x49,0x82,0x39,0x00,0x30,0xA0,0x28,0x80,
+    0x84,0x20,0x80,0x07,0x39,0x64,0xBD,0x74,0xF7,0x5B,0xF7,0x7B,0xCE,0x16,0x41,0xC5,
+    0x20,0xA1,0x20,0x81,0x82,0x20,0xA1,0x80,0x20,0x80,0x00,0x20,0x81,0x80,0x28,0xA1,
+    0x81,0x28,0xC1,0x80,0x28,0xC2,0x80,0x28,0xE2,0x02,0x30,0xE2,0x31,0x23,0x39,0x44,
+    0x80,0x39,0x64,0x84,0x39,0x44,0x83,0x28,0xA1,0x80,0x28,0xA0,0x00,0x20,0xA0,0x87,
+    0x20,0x80,0x8C,0x20,0x60,0x85,0x18,0x60,0x00,0x20,0x60,0x81,0x20,0x80,0x0E,0x28,
+    0xC0,0x31,0x01,0x41,0xA2,0x5A,0x24,0x6A,0xA6,0x7B,0x28,0x8B,0xAA,0x9C,0x0B,0xA4,
+    0x4C,0xAC,0x6C,0xB4,0x6C,0xB4,0x8D,0xBC,0xCD,0xBC,0xCE,0xBC,0xAD,0x80,0xB4,0x8C,
+    0x06,0xBC,0xAD,0xCD,0x2E,0xCD,0x4F,0xCD,0x4E,0xCD,0x2E,0xC5,0x0D,0xBC,0xAC,0x80,
+    0xB4,0x8B,0x00,0xBC,0xCC,0x80,0xC4,0xED,0x02,0xC5,0x0D,0xC4,0xED,0xBC,0xCC,0x80,
+    0xB4,0x8C,0x00,0xBC,0xAC,0x80,0xBC,0xCD,0x0A,0xB4,0xAD,0xAC,0x8D,0xA4,0x4C,0x93,
+    0xCA,0x83,0x27,0x6A,0x65,0x51,0xA2,0x39,0x01,0x30,0xC0,0x28,0xA0,0x20,0xA0,0x81,
+    0x20,0x80,0x01,0x8B,0xCD,0xF7,0x3A,0x80,0xFF,0xBC,0x03,0xFF,0x9C,0x7B,0xAC,0x29,
+    0x02,0x20,0xA1,0x81,0x20,0xC1,0x81,0x28,0xC1,0x01,0x30,0xE2,0x31,0x02,0x80,0x31,
+    0x22,0x80,0x39,0x23,0x04,0x39,0x43,0x39,0x44,0x39,0x64,0x41,0x64,0x41,0x85,0x80,
+    0x41,0xA5,0x85,0x39,0x84,0x00,0x41,0xA5,0x83,0x20,0x81,0x83,0x20,0x80,0x83,0x20,
+    0x60,0x89,0x18,0x60,0x8A,0x18,0x40,0x0A,0x18,0x60,0x20,0x60,0x20,0xA0,0x31,0x01,
+    0x41,0x82,0x52,0x24,0x6A,0xA6,0x7B,0x28,0x93,0xAA,0x9B,0xEB,0xA4,0x2C,0x81,0xAC,
+    0x4C,0x0D,0xB4,0x6C,0xB4,0x8D,0xBC,0xCD,0xC4,0xEE,0xBC,0xCD,0xB4,0x6C,0xB4,0x6B,
+    0xBC,0xAC,0xCD,0x4F,0xD5,0x6F,0xD5,0x4F,0xCD,0x4F,0xCD,0x2E,0xC4,0xED,0x80,0xC4,
+    0xCC,0x00,0xC4,0xED,0x81,0xC5,0x0D,0x12,0xC4,0xED,0xBC,0xAC,0xB4,0x6B,0xAC,0x4B,
+    0xBC,0xAC,0xBC,0xED,0xBC,0xEE,0xBC,0xCE,0xB4,0xCD,0xB4,0xAD,0xAC,0x6C,0x9C,0x2B,
+    0x93,0xA9,0x7B,0x07,0x62,0x24,0x49,0x82,0x39,0x21,0x30,0xE1,0x28,0xC0,0x80,0x28,
+    0xA0,0x01,0x8C,0x0E,0xEF,0x3A,0x80,0xFF,0xBC,0x06,0xFF,0x9C,0x7B,0xAC,0x29,0x02,
+    0x20,0xE1,0x28,0xC1,0x28,0xE1,0x28,0xE2,0x80,0x31,0x02,0x0B,0x39,0x23,0x39,0x43,
+    0x39,0x63,0x41,0x84,0x49,0xA5,0x49,0xC5,0x49,0xE5,0x52,0x06,0x5A,0x47,0x62,0x88,
+    0x62,0xA8,0x6A,0xEA,0x84,0x6B,0x0A,0x05,0x73,0x0A,0x73,0x2A,0x73,0x2B,0x7B,0x6C,
+    0x20,0x80,0x18,0x60,0x80,0x18,0x80,0x80,0x18,0x60,0x81,0x20,0x60,0x86,0x18,0x60,
+    0x87,0x18,0x40,0x85,0x18,0x20,0x84,0x18,0x40,0x07,0x20,0x80,0x31,0x01,0x51,0xE4,
+    0x6A,0x86,0x7B,0x48,0x8B,0xAA,0x9B,0xEB,0xA4,0x0C,0x80,0xAC,0x2C,0x81,0xAC,0x4C,
+    0x01,0xB4,0x8D,0xBC,0xAD,0x80,0xC4,0xEE,0x05,0xC4,0xCE,0xB4,0x8C,0xB4,0x6C,0xBC,
+    0xAD,0xD5,0x4F,0xD5,0x6F,0x81,0xD5,0x4F,0x03,0xCD,0x2E,0xCC,0xED,0xC4,0xED,0xCD,
+    0x0D,0x81,0xCD,0x0E,0x06,0xC4,0xED,0xB4,0x8C,0xAC,0x2A,0xA4,0x0A,0xBC,0xCC,0xC4,
+    0xEE,0xC5,0x0E,0x80,0xBC,0xEE,0x2A,0xB4,0xCE,0xB4,0xAD,0xAC,0x8C,0xA4,0x4C,0x9C,
+    0x0B,0x8B,0x89,0x72,0xA6,0x59,0xE4,0x49,0x82,0x39,0x21,0x31,0x01,0x30,0xE1,0x5A,
+    0x87,0xD6,0x77,0xF7,0x7B,0xFF,0x9C,0xE6,0xF9,0x6B,0x0A,0x39,0x84,0x31,0x63,0x39,
+    0x63,0x39,0x84,0x41,0x84,0x41,0xA5,0x49,0xC5,0x51,0xE6,0x5A,0x27,0x5A,0x47,0x62,
+    0x88,0x6A,0xE9,0x73,0x0A,0x83,0x6C,0x94,0x0E,0x9C,0x4F,0xA4,0x90,0xAC,0xB1,0xAC,
+    0xF1,0xAD,0x12,0xAC,0xF1,0xA4,0xD1,0xA4,0xB0,0x9C,0x90,0x9C,0x4F,0x82,0x94,0x2E,
+    0x83,0x18,0x60,0x82,0x18,0x40,0x85,0x18,0x60,0x89,0x18,0x40,0x82,0x10,0x40,0x85,
+    0x18,0x40,0x05,0x20,0x60,0x28,0xE1,0x49,0xC4,0x6A,0x87,0x8B,0x6A,0x9C,0x0B,0x81,
+    0xA4,0x2C,0x01,0xA4,0x2B,0xAC,0x4B,0x80,0xAC,0x4C,0x02,0xAC,0x6C,0xB4,0x8C,0xBC,
+    0xCE,0x81,0xC4,0xEE,0x80,0xC4,0xCD,0x00,0xCD,0x0E,0x80,0xD5,0x6F,0x00,0xDD,0x70,
+    0x80,0xD5,0x6F,0x01,0xD5,0x2F,0xCD,0x0E,0x80,0xCC,0xED,0x81,0xCD,0x0E,0x1A,0xC4,
+    0xED,0xB4,0x8C,0xAC,0x2A,0xAC,0x4B,0xC4,0xED,0xCD,0x2E,0xCD,0x2F,0xC5,0x0E,0xBC,
+    0xEE,0xBC,0xCE,0xB4,0xAD,0xAC,0x8D,0xAC,0x6C,0xA4,0x4C,0xA4,0x2B,0x93,0xEA,0x83,
+    0x48,0x6A,0xA6,0x5A,0x04,0x49,0xA3,0x41,0x83,0x49,0xE5,0x73,0x4A,0x9C,0xB0,0xA4,
+    0xD1,0x7B,0x8C,0x5A,0x88,0x80,0x5A,0x68,0x02,0x5A,0x88,0x62,0xA8,0x62,0xA9,0x80,
+    0x6A,0xC9,0x00,0x6A,0xE9,0x80,0x73,0x0A,0x05,0x7B,0x2B,0x83,0x8C,0x83,0xAC,0x94,
+    0x0E,0xA4,0x90,0xAC,0xD1,0x80,0xB4,0xF2,0x06,0xB5,0x12,0xB5,0x32,0xAD,0x12,0xAC,
+    0xD1,0xA4,0xD1,0x9C,0x90,0x9C,0x4F,0x82,0x94,0x2E,0x8C,0x18,0x40,0x90,0x10,0x40,
+    0x83,0x18,0x40,0x09,0x20,0x80,0x31,0x01,0x49,0xE4,0x6A,0xC7,0x8B,0x6A,0x9C,0x0C,
+    0xAC,0x4D,0xAC,0x6C,0xAC,0x2C,0xA4,0x2C,0x81,0xAC,0x4B,0x0B,0xAC,0x2B,0xA4,0x0B,
+    0xAC,0x2B,0xB4,0x8D,0xBC,0xCE,0xC4,0xEE,0xC5,0x0E,0xCD,0x2F,0xD5,0x4F,0xD5,0x90,
+    0xDD,0xB0,0xDD,0x8F,0x81,0xDD,0x6F,0x01,0xD5,0x4F,0xD5,0x2E,0x80,0xCD,0x0E,0x80,
+    0xCC,0xEE,0x04,0xC4,0xED,0xC4,0xCD,0xBC,0xCD,0xBC,0xAC,0xC4,0xED,0x81,0xCD,0x4F,
+    0x04,0xC5,0x0F,0xBC,0xCE,0xB4,0xCE,0xB4,0xAD,0xAC,0x8D,0x80,0xAC,0x6C,0x0B,0xAC,
+    0x4C,0xA4,0x4C,0xA4,0x2B,0x93,0xCA,0x83,0x29,0x72,0xA7,0x6A,0x87,0x6A,0xA8,0x62,
+    0x88,0x5A,0x88,0x5A,0xA8,0x62,0xA8,0x80,0x62,0xC9,0x81,0x6A,0xC9,0x80,0x6A,0xEA,
+    0x12,0x72,0xEA,0x73,0x0A,0x73,0x2A,0x7B,0x2B,0x7B,0x4B,0x83,0x8C,0x83,0xAC,0x94,
+    0x0E,0xA4,0x90,0xAC,0xD1,0xAC,0xF1,0xAC,0xF2,0xAD,0x12,0xB5,0x32,0xAD,0x12,0xAC,
+    0xF1,0xA4,0xB0,0x9C,0x90,0x94,0x4F,0x82,0x94,0x2E,0x98,0x18,0x40,0x00,0x18,0x60,
+    0x80,0x18,0x40,0x00,0x18,0x60,0x81,0x18,0x40,0x81,0x18,0x60,0x06,0x20,0x80,0x28,
+    0xC0,0x41,0xA3,0x6A,0xE7,0x83,0xAA,0x9C,0x2B,0xAC,0x6C,0x80,0xAC,0x4C,0x81,0xAC,
+    0x2B,0x0D,0xA3,0xEA,0x9B,0x88,0x8B,0x07,0x7A,0xC6,0x7A,0xA6,0x7A,0xE7,0x83,0x28,
+    0xA4,0x0B,0xC4,0xEE,0xCD,0x2F,0xDD,0x90,0xDD,0xD1,0xDD,0xB1,0xDD,0xB0,0x81,0xDD,
+    0x90,0x07,0xDD,0x6F,0xD5,0x2E,0xCD,0x2E,0xCD,0x0E,0xCC,0xED,0xC4,0xED,0xC4,0xCD,
+    0xC4,0xED,0x80,0xCD,0x2F,0x05,0xCD,0x70,0xCD,0x50,0xBD,0x0F,0xB4,0xAE,0xAC,0x4C,
+    0xA4,0x2B,0x80,0xA4,0x2C,0x02,0xAC,0x4C,0xAC,0x8D,0xAC,0x6C,0x80,0xAC,0x4C,0x06,
+    0xAC,0x6C,0xAC,0x4C,0x9B,0xEB,0x83,0x49,0x72,0xE8,0x72,0xC8,0x6A,0xA8,0x82,0x62,
+    0xC8,0x00,0x62,0xC9,0x81,0x6A,0xC9,0x80,0x6A,0xE9,0x02,0x72,0xEA,0x73,0x0A,0x73,
+    0x2A,0x80,0x7B,0x4B,0x04,0x7B,0x8C,0x83,0xAC,0x94,0x2E,0xA4,0x90,0xAC,0xD1,0x80,
+    0xAC,0xF1,0x81,0xAD,0x12,0x04,0xAC,0xF1,0xA4,0xB0,0x9C,0x90,0x9C,0x4F,0x94,0x2E,
+    0x80,0x94,0x2F,0x00,0x94,0x2E,0x9C,0x18,0x40,0x82,0x18,0x60,0x08,0x18,0x61,0x18,
+    0x81,0x28,0xA1,0x31,0x21,0x5A,0x45,0x83,0x89,0x9C,0x2B,0xA4,0x6C,0xAC,0x6C,0x80,
+    0xAC,0x4C,0x10,0xAC,0x2B,0xAC,0x0B,0xA4,0x0A,0x9B,0x89,0x82,0xC6,0x6A,0x23,0x59,
+    0xA2,0x51,0x82,0x49,0x61,0x51,0x81,0x6A,0x24,0x9B,0xCA,0xC4,0xEE,0xD5,0x90,0xDD,
+    0xB1,0xDD,0xD1,0xE5,0xD0,0x81,0xDD,0xB0,0x03,0xDD,0x6F,0xD5,0x2E,0xCD,0x2E,0xCD,
+    0x0D,0x80,0xC4,0xED,0x01,0xCD,0x0E,0xD5,0x4F,0x80,0xD5,0x70,0x09,0xC5,0x30,0xAC,
+    0x6D,0x93,0x89,0x7A,0xC6,0x6A,0x65,0x62,0x44,0x6A,0x65,0x7A,0xC6,0x93,0xAA,0xA4,
+    0x0B,0x81,0xAC,0x4C,0x05,0xB4,0x6D,0xAC,0x6D,0xA4,0x4C,0x8B,0xAA,0x7B,0x29,0x73,
+    0x09,0x81,0x6A,0xC8,0x03,0x62,0xC8,0x6A,0xC9,0x6A,0xE9,0x6A,0xC9,0x80,0x6A,0xE9,
+    0x80,0x72,0xEA,0x80,0x73,0x0A,0x08,0x73,0x2A,0x7B,0x4B,0x7B,0x6B,0x7B,0x8C,0x83,
+    0xAC,0x94,0x2E,0x9C,0x90,0xA4,0xB0,0xAC,0xD1,0x80,0xAC,0xF1,0x80,0xAD,0x12,0x04,
+    0xAC,0xF1,0xA4,0xD1,0x9C,0x90,0x9C,0x6F,0x94,0x4F,0x81,0x9C,0x2F,0x01,0x18,0x40,
+    0x18,0x60,0x86,0x18,0x61,0x81,0x20,0x61,0x82,0x18,0x60,0x80,0x18,0x80,0x86,0x18,
+    0x60,0x80,0x18,0x81,0x80,0x20,0x81,0x82,0x20,0xA1,0x05,0x20,0xC2,0x31,0x23,0x49,
+    0xE4,0x73,0x07,0x94,0x2A,0xAC,0x8C,0x81,0xAC,0x6C,0x08,0xAC,0x4B,0xA4,0x2B,0xAC,
+    0x2B,0xAB,0xEA,0x9B,0x68,0x7A,0x85,0x59,0xC2,0x49,0x41,0x41,0x21,0x80,0x41,0x00,
+    0x07,0x41,0x20,0x62,0x04,0x9B,0xAA,0xC5,0x0F,0xDD,0xB1,0xE5,0xD1,0xE5,0xF1,0xE5,
+    0xD0,0x80,0xDD,0xB0,0x0D,0xDD,0x6F,0xD5,0x2E,0xCD,0x2E,0xCD,0x0D,0xCC,0xED,0xC4,
+    0xED,0xD5,0x2E,0xDD,0x90,0xD5,0x90,0xC5,0x30,0x9C,0x0B,0x72,0xA6,0x51,0xA2,0x41,
+    0x41,0x80,0x41,0x21,0x0D,0x49,0x40,0x59,0xE2,0x72,0xC6,0x8B,0x68,0xA4,0x0B,0xAC,
+    0x2C,0xAC,0x6C,0xB4,0x6D,0xB4,0x8D,0xAC,0x6C,0x9C,0x0C,0x8B,0x8A,0x83,0x29,0x72,
+    0xE8,0x80,0x6A,0xC8,0x84,0x6A,0xE9,0x00,0x72,0xEA,0x81,0x73,0x0A,0x0A,0x73,0x2A,
+    0x7B,0x4B,0x7B,0x6B,0x7B,0x8C,0x83,0xAC,0x94,0x2E,0x9C,0x6F,0xA4,0xB0,0xA4,0xD1,
+    0xAC,0xD1,0xAC,0xF1,0x80,0xAD,0x12,0x03,0xAC,0xF1,0xA4,0xD1,0x9C,0x90,0x9C,0x6F,
+    0x80,0x9C,0x4F,0x80,0x9C,0x2F,0x00,0x18,0x60,0x80,0x20,0x61,0x81,0x20,0x81,0x80,
+    0x20,0x61,0x84,0x20,0x81,0x00,0x18,0x81,0x81,0x20,0x81,0x00,0x20,0xA1,0x80,0x20,
+    0x81,0x82,0x20,0xA1,0x00,0x20,0x81,0x80,0x20,0xA1,0x00,0x20,0xC2,0x80,0x28,0xE2,
+    0x0C,0x29,0x02,0x31,0x02,0x31,0x23,0x31,0x43,0x39,0x64,0x49,0xE5,0x62,0x86,0x8B,
+    0xA9,0xA4,0x6C,0xAC,0x8C,0xAC,0x6C,0xB4,0x6C,0xB4,0x4C,0x80,0xAC,0x4B,0x80,0xAC,
+    0x2B,0x05,0xA3,0xA9,0x7A,0x86,0x59,0xA2,0x49,0x41,0x49,0x82,0x51,0x62,0x80,0x41,
+    0x00,0x09,0x49,0x41,0x6A,0x65,0xA4,0x0B,0xD5,0x50,0xE5,0xD1,0xE5,0xF1,0xE5,0xD1,
+    0xE5,0xB0,0xDD,0x8F,0xD5,0x4F,0x80,0xD5,0x2E,0x08,0xCD,0x0D,0xCC,0xEE,0xCC,0xED,
+    0xD5,0x4F,0xE5,0xD1,0xD5,0x91,0xA4,0x2C,0x6A,0x64,0x49,0x61,0x82,0x41,0x20,0x06,
+    0x49,0x40,0x59,0xE2,0x72,0xA5,0x83,0x48,0x93,0xA9,0xA4,0x0B,0xAC,0x4C,0x80,0xB4,
+    0x6C,0x06,0xB4,0x6D,0xAC,0x6C,0x93,0xEB,0x83,0x6A,0x7B,0x09,0x72,0xE8,0x6A,0xE8,
+    0x83,0x6A,0xE9,0x00,0x73,0x09,0x81,0x73,0x0A,0x80,0x73,0x2A,0x80,0x7B,0x4B,0x04,
+    0x7B,0x6B,0x83,0xAC,0x94,0x2E,0x9C,0x6F,0x9C,0x90,0x80,0xA4,0xB0,0x00,0xA4,0xD1,
+    0x81,0xAC,0xF1,0x03,0xA4,0xD1,0xA4,0x90,0x9C,0x6F,0x9C,0x4F,0x81,0x9C,0x2F,0x84,
+    0x20,0x81,0x83,0x20,0xA2,0x00,0x28,0xA2,0x80,0x28,0xC2,0x03,0x28,0xE2,0x31,0x03,
+    0x31,0x23,0x39,0x44,0x81,0x39,0x64,0x02,0x39,0x44,0x31,0x44,0x31,0x43,0x80,0x31,
+    0x44,0x00,0x39,0x65,0x80,0x39,0x85,0x80,0x41,0xA5,0x80,0x41,0xC5,0x09,0x49,0xE5,
+    0x4A,0x06,0x52,0x26,0x62,0x87,0x7B,0x29,0x9C,0x0C,0xA4,0x8C,0xAC,0x8D,0xAC,0x8C,
+    0xB4,0x4C,0x80,0xAC,0x4B,0x15,0xB4,0x6C,0xBC,0x6C,0xBC,0x8D,0xB4,0x2B,0x83,0x07,
+    0x59,0xA3,0x41,0x42,0x6A,0x87,0x8B,0x4A,0x51,0x83,0x41,0x00,0x51,0xA2,0x62,0x24,
+    0x8B,0x48,0xC4,0xAE,0xE5,0xB1,0xED,0xF2,0xE5,0xD1,0xE5,0x90,0xD5,0x4F,0xCD,0x0E,
+    0xCC,0xED,0x81,0xCC,0xCD,0x10,0xCC,0xED,0xD5,0x6F,0xDD,0xD1,0xC5,0x0F,0x7A,0xE7,
+    0x49,0x40,0x49,0x61,0x83,0x08,0x59,0xC3,0x41,0x21,0x41,0x20,0x49,0x61,0x6A,0x85,
+    0x7B,0x07,0x93,0x89,0x9B,0xEA,0xAC,0x2B,0x80,0xB4,0x6C,0x05,0xB4,0x8C,0xB4,0x6C,
+    0xAC,0x6C,0x9C,0x0B,0x8B,0x8A,0x7B,0x08,0x80,0x72,0xE8,0x82,0x6A,0xE9,0x80,0x72,
+    0xE9,0x81,0x73,0x0A,0x80,0x73,0x2A,0x07,0x7B,0x2A,0x7B,0x4B,0x7B,0x6B,0x7B,0x8C,
+    0x8B,0xED,0x94,0x0E,0x94,0x2E,0x94,0x0E,0x80,0x94,0x2E,0x80,0x94,0x4F,0x80,0x9C,
+    0x4F,0x02,0x94,0x4F,0x94,0x2E,0x8C,0x0E,0x81,0x94,0x0E,0x0E,0x20,0xC2,0x28,0xE2,
+    0x28,0xE3,0x31,0x03,0x31,0x24,0x39,0x65,0x49,0xC6,0x52,0x27,0x5A,0x68,0x62,0xAA,
+    0x73,0x0B,0x73,0x2C,0x83,0xAD,0x94,0x0F,0x9C,0x71,0x80,0xA4,0xB2,0x05,0xA4,0xD2,
+    0xA4,0x91,0x94,0x2F,0x73,0x2B,0x5A,0x68,0x52,0x07,0x80,0x49,0xE6,0x83,0x4A,0x07,
+    0x00,0x52,0x07,0x81,0x52,0x26,0x04,0x5A,0x47,0x62,0x87,0x7A,0xE9,0x8B,0xAB,0xA4,
+    0x2C,0x80,0xAC,0x8C,0x00,0xAC,0x6C,0x80,0xAC,0x4B,0x01,0xB4,0x6C,0xBC,0xAD,0x80,
+    0xC4,0xCE,0x03,0xBC,0x6C,0x93,0x6A,0x59,0xC3,0x41,0x22,0x80,0x41,0x42,0x80,0x41,
+    0x01,0x09,0x62,0x25,0x83,0x08,0x93,0x49,0xAC,0x2B,0xDD,0x70,0xED,0xF2,0xE5,0xB1,
+    0xD5,0x4F,0xCC,0xCD,0xC4,0x8C,0x80,0xBC,0x6B,0x12,0xC4,0x8C,0xC4,0xAC,0xCC,0xED,
+    0xD5,0x4E,0xD5,0x4F,0xA4,0x2B,0x62,0x24,0x41,0x20,0x49,0x41,0x6A,0x45,0x51,0xC3,
+    0x41,0x41,0x41,0x20,0x5A,0x03,0x8B,0x89,0x9B,0xEA,0xAC,0x4C,0xB4,0x6C,0xB4,0x8C,
+    0x81,0xB4,0x6C,0x05,0xB4,0x8C,0xB4,0x6C,0xA4,0x0B,0x93,0x8A,0x83,0x28,0x7A,0xE8,
+    0x80,0x72,0xE8,0x81,0x72,0xE9,0x02,0x6A,0xE9,0x72,0xE9,0x73,0x09,0x81,0x73,0x0A,
+    0x80,0x73,0x2A,0x80,0x7B,0x4B,0x01,0x7B,0x6B,0x7B,0x8C,0x80,0x83,0x8C,0x81,0x83,
+    0xAC,0x01,0x83,0xCD,0x8B,0xCD,0x82,0x8B,0xED,0x01,0x8C,0x0E,0x8C,0x0D,0x80,0x94,
+    0x0D,0x0A,0x83,0xCE,0x94,0x30,0xA4,0xB2,0xB5,0x34,0xBD,0x95,0xC5,0xB6,0xCD,0xF7,
+    0xD6,0x17,0xD6,0x37,0xD6,0x38,0xD6,0x58,0x80,0xD6,0x38,0x80,0xD6,0x37,0x09,0xCE,
+    0x17,0xCD,0xD6,0xC5,0x95,0xB5,0x13,0x9C,0x70,0x7B,0x4C,0x52,0x68,0x4A,0x27,0x4A,
+    0x06,0x4A,0x07,0x82,0x4A,0x27,0x02,0x52,0x27,0x52,0x47,0x5A,0x47,0x80,0x5A,0x67,
+    0x04,0x62,0x87,0x72,0xE8,0x83,0x6A,0x9C,0x0C,0xA4,0x4C,0x80,0xAC,0x6C,0x0A,0xAC,
+    0x4B,0xAC,0x2B,0xB4,0x6C,0xBC,0xCD,0xCD,0x0E,0xCD,0x0F,0xC4,0xEE,0xBC,0x8D,0x9B,
+    0xAA,0x59,0xC3,0x41,0x21,0x80,0x41,0x01,0x02,0x39,0x01,0x41,0x21,0x7A,0xC7,0x81,
+    0xA3,0xEB,0x05,0xC4,0xCE,0xDD,0x70,0xD5,0x0E,0xC4,0xAD,0xBC,0x6B,0xB4,0x2A,0x80,
+    0xB4,0x0A,0x80,0xB4,0x2A,0x06,0xBC,0x6B,0xC4,0xAC,0xB4,0x6C,0x8B,0x47,0x59,0xE2,
+    0x41,0x20,0x41,0x00,0x80,0x41,0x20,0x05,0x41,0x21,0x41,0x41,0x62,0x24,0xA4,0x2B,
+    0xAC,0x8D,0xBD,0x0E,0x80,0xC5,0x0E,0x01,0xBC,0xCD,0xB4,0x8C,0x80,0xB4,0x6B,0x04,
+    0xB4,0x6C,0xAC,0x4B,0x9B,0xEA,0x8B,0x69,0x7B,0x08,0x80,0x72,0xE8,0x01,0x72,0xE9,
+    0x72,0xE8,0x81,0x6A,0xE9,0x80,0x73,0x09,0x80,0x73,0x0A,0x80,0x73,0x2A,0x02,0x7B,
+    0x2A,0x7B,0x2B,0x7B,0x4B,0x81,0x7B,0x6B,0x01,0x7B,0x8B,0x83,0x8C,0x80,0x83,0xAC,
+    0x81,0x83,0xCD,0x80,0x8B,0xCD,0x81,0x8B,0xED,0x00,0x8C,0x0D,0x82,0xDE,0x99,0x00,
+    0xDE,0x79,0x81,0xDE,0x78,0x80,0xDE,0x58,0x00,0xD6,0x58,0x81,0xD6,0x38,0x08,0xD6,
+    0x37,0xCE,0x17,0xCD,0xF6,0xC5,0x95,0xB5,0x13,0x9C,0x70,0x73,0x4C,0x52,0x68,0x4A,
+    0x27,0x80,0x4A,0x07,0x81,0x4A,0x27,0x80,0x52,0x48,0x02,0x5A,0x47,0x5A,0x67,0x5A,
+    0x87,0x80,0x62,0xA7,0x03,0x73,0x08,0x8B,0x8A,0xA4,0x2C,0xAC,0x4C,0x80,0xAC,0x6B,
+    0x03,0xAC,0x2B,0xAC,0x4B,0xB4,0x8C,0xC4,0xED,0x80,0xCC,0xEE,0x05,0xC4,0xCD,0xBC,
+    0xAD,0xA4,0x0B,0x6A,0x25,0x41,0x21,0x39,0x00,0x80,0x38,0xE0,0x0A,0x51,0x82,0x93,
+    0x8A,0xAC,0x4C,0xA4,0x0B,0xA3,0xEB,0xB4,0x2B,0xC4,0xAD,0xBC,0x6C,0xB4,0x2B,0xB4,
+    0x2A,0xB4,0x0A,0x80,0xB4,0x2A,0x80,0xB4,0x0A,0x07,0xAB,0xE9,0xAC,0x09,0xA3,0xC9,
+    0x8B,0x27,0x6A,0x23,0x49,0x40,0x41,0x20,0x41,0x00,0x81,0x41,0x20,0x0F,0x72,0x85,
+    0xA4,0x4C,0xB4,0xAD,0xC5,0x2F,0xCD,0x4F,0xCD,0x2F,0xC5,0x0E,0xBC,0x8C,0xB4,0x4B,
+    0xAC,0x2B,0xAC,0x4B,0xAC,0x4C,0xAC,0x2B,0x9B,0xEA,0x83,0x69,0x7B,0x08,0x81,0x72,
+    0xE8,0x00,0x72,0xE9,0x80,0x6A,0xE9,0x81,0x73,0x09,0x80,0x73,0x0A,0x81,0x73,0x2A,
+    0x00,0x7B,0x4B,0x81,0x7B,0x6B,0x01,0x7B,0x8B,0x7B,0x8C,0x81,0x83,0xAC,0x01,0x83,
+    0xCD,0x83,0xCC,0x80,0x83,0xCD,0x00,0x8B,0xCD,0x81,0x8B,0xED,0x00,0xDE,0x99,0x81,
+    0xDE,0x79,0x82,0xDE,0x78,0x00,0xDE,0x58,0x82,0xD6,0x58,0x08,0xCE,0x58,0xCE,0x38,
+    0xCE,0x17,0xCD,0xF6,0xC5,0x95,0xB5,0x13,0x9C,0x70,0x73,0x6C,0x5A,0x88,0x84,0x4A,
+    0x27,0x80,0x52,0x47,0x00,0x5A,0x67,0x80,0x5A,0x87,0x0C,0x5A,0xA7,0x62,0xC7,0x7B,
+    0x29,0x93,0xCB,0xA4,0x4C,0xAC,0x4C,0xAC,0x6B,0xAC,0x4B,0xAC,0x2A,0xB4,0x6B,0xBC,
+    0xAC,0xC4,0xCD,0xC4,0xAC,0x81,0xBC,0xAD,0x03,0xB4,0x8C,0x93,0x89,0x62,0x04,0x51,
+    0x82,0x80,0x51,0x62,0x05,0x72,0x85,0xA4,0x2B,0xAC,0x4B,0xA3,0xEA,0xA3,0xCA,0xAB,
+    0xEA,0x80,0xB4,0x2A,0x82,0xB4,0x0A,0x80,0xB4,0x2A,0x07,0xB4,0x0A,0xAB,0xC9,0xA3,
+    0xC9,0xA3,0xA9,0x9B,0x69,0x8B,0x07,0x62,0x03,0x49,0x41,0x80,0x41,0x20,0x0C,0x41,
+    0x00,0x51,0xA2,0x93,0xAA,0xB4,0xAD,0xBC,0xEE,0xC5,0x2F,0xCD,0x2E,0xC5,0x0E,0xC4,
+    0xEE,0xBC,0x8C,0xAC,0x0A,0xA3,0xEA,0xAC,0x0B,0x80,0xAC,0x2B,0x03,0xA4,0x2B,0x93,
+    0xEA,0x7B,0x28,0x72,0xE8,0x81,0x72,0xE9,0x80,0x6A,0xE9,0x80,0x6B,0x09,0x00,0x73,
+    0x0A,0x82,0x73,0x2A,0x00,0x73,0x4B,0x80,0x7B,0x4B,0x80,0x7B,0x6B,0x80,0x7B,0x8C,
+    0x00,0x83,0x8C,0x82,0x83,0xAC,0x80,0x83,0xCC,0x01,0x83,0xCD,0x8B,0xCD,0x80,0x8B,
+    0xED,0x83,0xDE,0x79,0x82,0xDE,0x78,0x81,0xD6,0x58,0x00,0xCE,0x58,0x80,0xCE,0x37,
+    0x08,0xCE,0x17,0xC5,0xF6,0xBD,0x95,0xAD,0x13,0x94,0x70,0x73,0x4C,0x5A,0x88,0x52,
+    0x48,0x52,0x27,0x81,0x4A,0x27,0x00,0x52,0x27,0x80,0x52,0x47,0x81,0x5A,0x67,0x0A,
+    0x62,0xA7,0x73,0x29,0x8B,0xAB,0x9C,0x2B,0xAC,0x4C,0xAC,0x6B,0xAC,0x4B,0xAC,0x2A,
+    0xAC,0x4A,0xB4,0x6B,0xBC,0x8B,0x85,0xBC,0x8C,0x01,0xB4,0x8C,0xAC,0x4C,0x80,0xB4,
+    0x4C,0x08,0xBC,0x8C,0xB4,0x8C,0xAC,0x2B,0xA3,0xE9,0xA3,0xC9,0xAB,0xC9,0xB3,0xEA,
+    0xAB,0xE9,0xB4,0x0A,0x81,0xBC,0x2B,0x02,0xC4,0x2B,0xBC,0x0A,0xB3,0xEA,0x80,0xA3,
+    0x88,0x0D,0x9B,0x68,0x9B,0x69,0x9B,0xAA,0x9B,0x69,0x93,0x48,0x82,0xE7,0x82,0xC6,
+    0x83,0x07,0xA4,0x0B,0xC5,0x0F,0xC5,0x2F,0xC4,0xEE,0xBC,0xEE,0xBC,0xCD,0x80,0xBC,
+    0xAD,0x01,0xBC,0x6B,0xAC,0x0A,0x80,0xA3,0xC9,0x05,0xA4,0x0A,0xAC,0x2B,0xA4,0x4B,
+    0x9C,0x0B,0x83,0x69,0x7B,0x08,0x81,0x72,0xE9,0x00,0x6A,0xE9,0x81,0x6B,0x09,0x82,
+    0x73,0x2A,0x00,0x73,0x4A,0x80,0x73,0x4B,0x00,0x7B,0x4B,0x80,0x7B,0x6B,0x81,0x7B,
+    0x8C,0x00,0x83,0x8C,0x81,0x83,0xAC,0x81,0x83,0xCC,0x00,0x8B,0xCD,0x80,0x8B,0xED,
+    0x00,0xD6,0x79,0x81,0xD6,0x78,0x00,0xCE,0x58,0x81,0xCE,0x38,0x0D,0xCE,0x17,0xC5,
+    0xF7,0xC5,0xD6,0xBD,0xD5,0xB5,0xB4,0xB5,0x74,0xAD,0x53,0xA5,0x12,0x94,0x90,0x8C,
+    0x2F,0x7B,0xAD,0x73,0x4B,0x62,0xC9,0x52,0x68,0x80,0x52,0x47,0x81,0x4A,0x27,0x80,
+    0x52,0x27,0x80,0x52,0x47,0x03,0x52,0x67,0x52,0x46,0x6A,0xC8,0x8B,0xCB,0x80,0xA4,
+    0x4C,0x80,0xAC,0x4B,0x04,0xAC,0x2B,0xAC,0x2A,0xB4,0x8B,0xBC,0x8B,0xB4,0x6B,0x80,
+    0xB4,0x4B,0x12,0xB4,0x6B,0xBC,0x6C,0xBC,0x8C,0xC4,0x8C,0xC4,0xAD,0xCC,0xCD,0xCC,
+    0xED,0xCD,0x0D,0xCD,0x2E,0xCC,0xEE,0xC4,0xAD,0xB4,0x4B,0xAC,0x0A,0xAB,0xE9,0xB3,
+    0xE9,0xB4,0x0A,0xB3,0xEA,0xBC,0x2B,0xCC,0x8C,0x80,0xCC,0x8D,0x10,0xCC,0x6C,0xC4,
+    0x0B,0xB3,0xA9,0xA3,0x48,0x9B,0x48,0x9B,0x68,0xA3,0x89,0xAB,0xCA,0xB4,0x2B,0xC4,
+    0xEE,0xCD,0x2F,0xD5,0x50,0xCD,0x70,0xCD,0x6F,0xCD,0x0E,0xC4,0xEE,0xC4,0xAD,0x81,
+    0xBC,0x8C,0x02,0xBC,0x6B,0xB4,0x4B,0xAC,0x09,0x80,0xA3,0xC9,0x00,0xA4,0x0A,0x80,
+    0xA4,0x2A,0x02,0xA4,0x2B,0x8B,0xA9,0x7B,0x28,0x81,0x72,0xE9,0x00,0x6A,0xE9,0x81,
+    0x6B,0x09,0x82,0x73,0x2A,0x00,0x73,0x4A,0x80,0x73,0x4B,0x00,0x7B,0x4B,0x81,0x7B,
+    0x6B,0x02,0x7B,0x8B,0x7B,0x8C,0x83,0x8C,0x81,0x83,0xAC,0x81,0x83,0xCC,0x00,0x8B,
+    0xCD,0x80,0x8B,0xED,0x0D,0xAD,0x33,0xA5,0x12,0x9C,0xD2,0x9C,0xB1,0x94,0x70,0x8C,
+    0x0F,0x83,0xEE,0x7B,0xAD,0x73,0x6C,0x6B,0x2C,0x6B,0x0B,0x62,0xEA,0x5A,0xA9,0x52,
+    0xA8,0x80,0x52,0x88,0x00,0x52,0x68,0x83,0x52,0x47,0x01,0x4A,0x27,0x52,0x27,0x81,
+    0x4A,0x27,0x81,0x52,0x27,0x0D,0x52,0x47,0x52,0x67,0x5A,0x87,0x73,0x29,0x9C,0x2C,
+    0xAC,0x6D,0xAC,0x6C,0xAC,0x4B,0xAC,0x2B,0xAC,0x2A,0xB4,0x4B,0xC4,0xCC,0xC4,0xED,
+    0xBC,0x6B,0x80,0xB4,0x2A,0x05,0xB4,0x4A,0xBC,0x6B,0xBC,0x8C,0xC4,0x8C,0xC4,0xAD,
+    0xCC,0xCD,0x80,0xCC,0xED,0x0A,0xCD,0x0D,0xCC,0xED,0xC4,0xCD,0xBC,0x8C,0xBC,0x6B,
+    0xBC,0x4A,0xBC,0x2A,0xB3,0xEA,0xAB,0xA9,0xB3,0xCA,0xC4,0x2C,0x80,0xCC,0x6C,0x0D,
+    0xC4,0x2C,0xB3,0xCA,0xA3,0x48,0x92,0xE6,0x9B,0x07,0xA3,0x68,0xAB,0xCA,0xB4,0x2C,
+    0xBC,0x8C,0xCD,0x0E,0xD5,0x2F,0xD5,0x6F,0xCD,0x6F,0xC5,0x0E,0x80,0xC4,0xCD,0x00,
+    0xBC,0x8C,0x80,0xBC,0x6B,0x02,0xB4,0x2A,0xAC,0x0A,0xAB,0xE9,0x81,0xA3,0xE9,0x05,
+    0xA4,0x09,0xA4,0x0A,0xA4,0x2A,0xA4,0x2B,0x93,0xEA,0x83,0x49,0x81,0x72,0xE9,0x80,
+    0x6A,0xE9,0x80,0x6B,0x09,0x82,0x73,0x2A,0x00,0x73,0x4A,0x80,0x73,0x4B,0x80,0x7B,
+    0x4B,0x80,0x7B,0x6B,0x00,0x7B,0x8B,0x80,0x7B,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,
+    0x80,0x8B,0xED,0x03,0x52,0xA9,0x52,0x88,0x52,0x68,0x4A,0x68,0x80,0x4A,0x47,0x80,
+    0x52,0x47,0x00,0x4A,0x47,0x82,0x52,0x48,0x82,0x4A,0x47,0x83,0x52,0x47,0x80,0x4A,
+    0x27,0x82,0x52,0x47,0x00,0x52,0x27,0x80,0x52,0x47,0x05,0x52,0x46,0x62,0xA7,0x83,
+    0xAB,0xA4,0x6D,0xAC,0x6C,0xAC,0x4B,0x80,0xB4,0x2B,0x05,0xB4,0x4A,0xBC,0x8B,0xCC,
+    0xED,0xCD,0x0E,0xC4,0xAC,0xBC,0x6B,0x80,0xB4,0x2A,0x03,0xB4,0x4B,0xBC,0x6C,0xC4,
+    0xAC,0xC4,0xAD,0x80,0xCC,0xCD,0x83,0xCC,0xED,0x06,0xCC,0xCD,0xCC,0xAC,0xBC,0x2A,
+    0xA3,0x88,0x9B,0x27,0x9B,0x48,0xB3,0xAA,0x80,0xBB,0xEB,0x12,0xB3,0xCA,0xAB,0x48,
+    0x9B,0x07,0x92,0xC6,0x92,0xE7,0xA3,0xA9,0xB4,0x4B,0xBC,0xAD,0xC4,0xCD,0xC5,0x0E,
+    0xCD,0x2E,0xD5,0x4E,0xCD,0x4E,0xBC,0xEC,0xBC,0x8C,0xB4,0x8B,0xB4,0x6B,0xB4,0x4B,
+    0xAC,0x2A,0x81,0xA3,0xE9,0x80,0xAC,0x09,0x80,0xA4,0x09,0x80,0xA4,0x0A,0x03,0xA4,
+    0x2B,0x9C,0x0B,0x8B,0x8A,0x7B,0x09,0x80,0x72,0xE9,0x03,0x6B,0x09,0x6A,0xE9,0x6B,
+    0x09,0x73,0x0A,0x82,0x73,0x2A,0x02,0x73,0x4A,0x73,0x4B,0x7B,0x4B,0x80,0x73,0x4B,
+    0x81,0x7B,0x6B,0x80,0x7B,0x8B,0x00,0x83,0x8C,0x81,0x83,0xAC,0x81,0x83,0xCC,0x80,
+    0x8B,0xEC,0x83,0x4A,0x47,0x82,0x52,0x47,0x82,0x52,0x48,0x82,0x4A,0x47,0x00,0x52,
+    0x47,0x81,0x52,0x68,0x89,0x52,0x47,0x09,0x6A,0xE9,0x94,0x0C,0xA4,0x6D,0xAC,0x6C,
+    0xAC,0x4B,0xB4,0x2B,0xB4,0x0B,0xB4,0x4A,0xC4,0xCD,0xCD,0x2E,0x80,0xCD,0x0E,0x08,
+    0xC4,0xAD,0xB4,0x4B,0xAC,0x2A,0xB4,0x4A,0xB4,0x6B,0xBC,0x8C,0xC4,0xAC,0xC4,0xCD,
+    0xCC,0xCD,0x80,0xCC,0xED,0x80,0xD5,0x0E,0x80,0xD5,0x2E,0x0F,0xD4,0xED,0xA3,0xA9,
+    0x8A,0xC5,0x82,0x84,0x92,0xC6,0xA3,0x69,0xAB,0xAA,0xAB,0x8A,0xAB,0x89,0xA3,0x28,
+    0x92,0xC6,0x8A,0x85,0x8A,0xC6,0xAB,0xCA,0xC4,0xCD,0xCD,0x0F,0x80,0xCD,0x2F,0x80,
+    0xCD,0x2E,0x06,0xC5,0x2D,0xBC,0xAC,0xB4,0x6B,0xAC,0x4B,0xAC,0x2A,0xA4,0x09,0xA3,
+    0xE9,0x80,0xA3,0xC9,0x00,0xAC,0x09,0x80,0xAC,0x4A,0x00,0xA4,0x0A,0x80,0xA3,0xE9,
+    0x04,0xA4,0x09,0xA4,0x0A,0x9C,0x0B,0x93,0xCB,0x7B,0x29,0x81,0x72,0xE9,0x01,0x6B,
+    0x09,0x73,0x09,0x83,0x73,0x2A,0x80,0x73,0x4B,0x00,0x7B,0x4B,0x80,0x73,0x4B,0x81,
+    0x7B,0x6B,0x80,0x7B,0x8B,0x00,0x83,0x8C,0x81,0x83,0xAC,0x82,0x83,0xCC,0x00,0x8B,
+    0xEC,0x80,0x4A,0x27,0x85,0x52,0x47,0x82,0x52,0x48,0x82,0x4A,0x47,0x00,0x52,0x47,
+    0x81,0x52,0x68,0x00,0x52,0x47,0x80,0x52,0x48,0x85,0x52,0x47,0x09,0x5A,0x67,0x7B,
+    0x4A,0x9C,0x2C,0xA4,0x6C,0xAC,0x4B,0xAC,0x2B,0xB4,0x2B,0xB4,0x2A,0xBC,0x6B,0xCC,
+    0xED,0x80,0xD5,0x2E,0x80,0xCD,0x0E,0x07,0xBC,0x8C,0xB4,0x6B,0xB4,0x4B,0xB4,0x6B,
+    0xBC,0x8C,0xC4,0xAC,0xC4,0xCC,0xC4,0xED,0x80,0xCC,0xED,0x01,0xD5,0x0E,0xDD,0x4F,
+    0x80,0xDD,0x6F,0x10,0xCC,0xEE,0x93,0x27,0x6A,0x02,0x69,0xC2,0x71,0xE3,0x82,0x65,
+    0x9B,0x08,0xA3,0x48,0x9B,0x28,0x8A,0x86,0x7A,0x24,0x71,0xE4,0x82,0x86,0xB4,0x2C,
+    0xD5,0x50,0xD5,0x91,0xD5,0x70,0x80,0xCD,0x4F,0x06,0xCD,0x2E,0xC5,0x0D,0xBC,0xAC,
+    0xB4,0x6B,0xB4,0x4B,0xAC,0x2A,0xA4,0x0A,0x80,0xA3,0xE9,0x04,0xA3,0xC9,0xAC,0x2A,
+    0xB4,0x4A,0xB4,0x6B,0xA4,0x2A,0x81,0x9B,0xC9,0x03,0x9C,0x0A,0xA4,0x0B,0x9B,0xEB,
+    0x83,0x49,0x83,0x73,0x09,0x83,0x73,0x2A,0x80,0x73,0x4B,0x81,0x7B,0x4B,0x81,0x7B,
+    0x6B,0x80,0x7B,0x8B,0x81,0x83,0xAC,0x82,0x83,0xCC,0x80,0x8B,0xEC,0x80,0x4A,0x27,
+    0x89,0x52,0x47,0x82,0x52,0x68,0x82,0x52,0x67,0x00,0x52,0x47,0x80,0x52,0x68,0x00,
+    0x52,0x48,0x81,0x52,0x67,0x81,0x52,0x47,0x04,0x62,0x88,0x7B,0x6A,0x9C,0x2C,0xA4,
+    0x6C,0xAC,0x4B,0x80,0xAC,0x2B,0x02,0xB4,0x4B,0xBC,0xAC,0xCD,0x0E,0x80,0xD5,0x2E,
+    0x80,0xCD,0x2E,0x01,0xC4,0xED,0xBC,0xCD,0x81,0xBC,0xAC,0x02,0xC4,0xCC,0xC4,0xED,
+    0xC4,0xCD,0x80,0xCC,0xED,0x00,0xDD,0x4F,0x80,0xED,0xD1,0x0E,0xE5,0xB1,0xD5,0x2F,
+    0x9B,0x89,0x7A,0x44,0x72,0x03,0x7A,0x24,0x82,0x65,0x92,0xE8,0x9B,0x08,0x92,0xE7,
+    0x7A,0x24,0x71,0xC3,0x7A,0x45,0xA3,0x8A,0xCD,0x30,0x80,0xDD,0xD2,0x02,0xD5,0x91,
+    0xCD,0x70,0xCD,0x4F,0x80,0xC5,0x2E,0x04,0xC4,0xED,0xB4,0x8C,0xAC,0x4B,0xAC,0x2A,
+    0xA4,0x09,0x81,0xA3,0xE9,0x00,0xAC,0x2A,0x80,0xB4,0x6B,0x01,0xAC,0x4B,0x9B,0xC9,
+    0x80,0x93,0x88,0x04,0x93,0xA9,0x9B,0xCA,0x93,0xAA,0x83,0x49,0x7B,0x09,0x80,0x73,
+    0x0A,0x01,0x73,0x09,0x73,0x0A,0x83,0x73,0x2A,0x80,0x73,0x4B,0x81,0x7B,0x4B,0x81,
+    0x7B,0x6B,0x80,0x7B,0x8B,0x81,0x83,0xAC,0x82,0x83,0xCC,0x80,0x8B,0xEC,0x00,0x4A,
+    0x27,0x8A,0x52,0x47,0x8A,0x52,0x67,0x81,0x52,0x68,0x00,0x52,0x48,0x80,0x5A,0x47,
+    0x0A,0x62,0x87,0x7B,0x49,0x94,0x0B,0x9C,0x4B,0xA4,0x2A,0xA3,0xEA,0xAC,0x0A,0xB4,
+    0x4B,0xC4,0xED,0xCD,0x2E,0xD5,0x4F,0x81,0xCD,0x2E,0x03,0xCD,0x0D,0xC4,0xED,0xC4,
+    0xCC,0xC4,0xCD,0x80,0xC4,0xED,0x04,0xCC,0xED,0xC4,0xED,0xC4,0xCD,0xCD,0x0E,0xE5,
+    0x90,0x80,0xED,0xF2,0x13,0xEE,0x12,0xED,0xF2,0xD5,0x0F,0xBC,0x4C,0xB4,0x0C,0xB3,
+    0xEB,0xA3,0x8A,0x9B,0x29,0x9B,0x09,0x92,0xE8,0x93,0x08,0xAB,0xAB,0xBC,0x6E,0xD5,
+    0x51,0xE5,0xF3,0xE6,0x13,0xDD,0xF3,0xD5,0xB2,0xCD,0x50,0xC5,0x4F,0x80,0xCD,0x4F,
+    0x03,0xC5,0x2E,0xBC,0xAC,0xAC,0x4B,0xA4,0x0A,0x81,0xA3,0xE9,0x08,0xA4,0x0A,0xAC,
+    0x2A,0xB4,0x6B,0xB4,0x8C,0xAC,0x4B,0x9B,0xC9,0x8B,0x67,0x8B,0x47,0x8B,0x68,0x80,
+    0x93,0x89,0x04,0x8B,0x49,0x7B,0x29,0x7B,0x0A,0x73,0x09,0x73,0x0A,0x83,0x73,0x2A,
+    0x80,0x73,0x4A,0x85,0x7B,0x6B,0x80,0x7B,0x8B,0x83,0x83,0xAC,0x81,0x83,0xCC,0x00,
+    0x8B,0xCD,0x8B,0x52,0x47,0x8A,0x52,0x67,0x81,0x52,0x68,0x00,0x5A,0x48,0x80,0x5A,
+    0x47,0x03,0x62,0x87,0x7B,0x49,0x8B,0xEB,0x9C,0x0B,0x80,0xA3,0xEA,0x05,0xAC,0x0A,
+    0xB4,0x4B,0xC4,0xED,0xCD,0x0E,0xCD,0x0D,0xC4,0xCD,0x80,0xBC,0xAC,0x81,0xB4,0x8B,
+    0x02,0xBC,0xAC,0xC4,0xED,0xC4,0xEE,0x80,0xC5,0x0E,0x04,0xCD,0x0E,0xD5,0x2F,0xDD,
+    0xB1,0xED,0xF2,0xEE,0x13,0x80,0xEE,0x33,0x11,0xEE,0x13,0xDD,0x92,0xCD,0x0F,0xC4,
+    0xAF,0xB4,0x2D,0xA3,0x8A,0x9B,0x49,0xA3,0x6A,0xB4,0x0C,0xCC,0xCF,0xDD,0x72,0xED,
+    0xF4,0xEE,0x34,0xE6,0x34,0xE6,0x13,0xDD,0xF3,0xD5,0xB1,0xCD,0x90,0x80,0xCD,0x70,
+    0x05,0xC5,0x2F,0xB4,0xAC,0xA3,0xEA,0x9B,0xC9,0x9B,0xA8,0x9B,0xC9,0x80,0xA3,0xE9,
+    0x00,0xAC,0x4A,0x80,0xB4,0x6B,0x08,0xAC,0x6B,0xA3,0xEA,0x8B,0x67,0x83,0x26,0x8B,
+    0x27,0x93,0x68,0x93,0x69,0x8B,0x69,0x83,0x2A,0x80,0x7B,0x2A,0x84,0x73,0x2A,0x80,
+    0x73,0x4A,0x85,0x7B,0x6B,0x80,0x7B,0x8B,0x00,0x83,0x8C,0x83,0x83,0xAC,0x81,0x83,
+    0xCC,0x8A,0x52,0x47,0x8B,0x52,0x67,0x81,0x52,0x68,0x0F,0x5A,0x68,0x5A,0x47,0x5A,
+    0x48,0x62,0x88,0x73,0x49,0x8B,0xEA,0x94,0x0A,0x9B,0xC9,0xA3,0xEA,0xAC,0x4B,0xBC,
+    0x8C,0xC4,0xED,0xC4,0xEE,0xC4,0xCD,0xB4,0x6B,0xAC,0x2B,0x80,0xAC,0x2A,0x80,0xA4,
+    0x2A,0x0A,0xAC,0x4B,0xBC,0xCD,0xC5,0x2E,0xCD,0x4F,0xCD,0x70,0xD5,0x70,0xD5,0x90,
+    0xDD,0xD1,0xE5,0xF2,0xE6,0x13,0xEE,0x13,0x80,0xEE,0x33,0x0C,0xE5,0xF3,0xD5,0x30,
+    0xCC,0xCF,0xBC,0x4D,0xAB,0xCB,0xA3,0xAB,0xAB,0xCB,0xBC,0x4D,0xCD,0x10,0xDD,0x92,
+    0xEE,0x14,0xEE,0x34,0xE6,0x34,0x80,0xE6,0x13,0x17,0xDD,0xF3,0xDD,0xD2,0xD5,0xD1,
+    0xD5,0x90,0xCD,0x4F,0xB4,0xAD,0x9B,0xEA,0x93,0x88,0x8B,0x47,0x93,0x67,0x9B,0xA8,
+    0x9B,0xC9,0xA4,0x0A,0xAC,0x4B,0xB4,0x6B,0xB4,0x6C,0xAC,0x2B,0x93,0x88,0x83,0x26,
+    0x8B,0x47,0x8B,0x68,0x93,0x69,0x8B,0x69,0x83,0x4A,0x80,0x7B,0x2A,0x84,0x73,0x2A,
+    0x80,0x73,0x4A,0x85,0x7B,0x6B,0x80,0x7B,0x8B,0x00,0x83,0x8C,0x83,0x83,0xAC,0x81,
+    0x83,0xCC,0x81,0x4A,0x27,0x83,0x52,0x47,0x87,0x52,0x67,0x88,0x52,0x68,0x80,0x5A,
+    0x68,0x08,0x5A,0x67,0x5A,0x68,0x62,0x87,0x73,0x29,0x8B,0xCA,0x94,0x0A,0x9B,0xE9,
+    0xAC,0x4B,0xBC,0xAC,0x80,0xC4,0xCD,0x0B,0xBC,0xCD,0xB4,0x6B,0xAC,0x2B,0xAC,0x4B,
+    0xB4,0x6B,0xB4,0xCC,0xBC,0xCD,0xBC,0xED,0xBD,0x0E,0xCD,0x4F,0xD5,0x90,0xD5,0xB1,
+    0x81,0xDD,0xD1,0x80,0xDD,0xF2,0x80,0xE5,0xF3,0x80,0xE6,0x13,0x0A,0xDD,0xD2,0xCD,
+    0x10,0xC4,0xCF,0xC4,0x8E,0xBC,0x4D,0xB4,0x2D,0xB4,0x4D,0xBC,0x6E,0xBC,0xAF,0xD5,
+    0x51,0xDD,0xB3,0x81,0xDD,0xF3,0x00,0xDD,0xD2,0x81,0xD5,0xD2,0x05,0xD5,0xD1,0xD5,
+    0xB1,0xC5,0x0E,0xAC,0x6C,0x9B,0xC9,0x9B,0xA9,0x81,0x9B,0xC9,0x02,0x9B,0xE9,0xA4,
+    0x0A,0xAC,0x4B,0x80,0xAC,0x6B,0x03,0x9B,0xE9,0x8B,0x67,0x8B,0x47,0x8B,0x48,0x80,
+    0x8B,0x69,0x00,0x83,0x4A,0x80,0x7B,0x2A,0x02,0x73,0x2A,0x7B,0x2A,0x7B,0x4B,0x81,
+    0x73,0x2A,0x80,0x73,0x4B,0x83,0x7B,0x6B,0x80,0x7B,0x8B,0x02,0x7B,0x8C,0x7B,0x8B,
+    0x83,0x8C,0x83,0x83,0xAC,0x81,0x83,0xCC,0x80,0x4A,0x27,0x00,0x4A,0x47,0x82,0x52,
+    0x47,0x01,0x52,0x67,0x52,0x68,0x83,0x52,0x67,0x8B,0x52,0x68,0x01,0x5A,0x68,0x5A,
+    0x88,0x80,0x5A,0x67,0x06,0x62,0x87,0x73,0x08,0x83,0xA9,0x93,0xE9,0xA4,0x0A,0xB4,
+    0x6B,0xBC,0xAC,0x80,0xBC,0xCD,0x07,0xB4,0x6C,0xAC,0x2B,0xAC,0x2A,0xB4,0x6B,0xBC,
+    0xED,0xC5,0x4F,0xCD,0x70,0xCD,0x90,0x80,0xD5,0xB1,0x01,0xD5,0xD2,0xDD,0xD2,0x80,
+    0xDD,0xF2,0x00,0xDD,0xD2,0x81,0xDD,0xF2,0x80,0xDD,0xD2,0x02,0xDD,0xB2,0xCD,0x30,
+    0xBC,0x8E,0x80,0xB4,0x4D,0x01,0xBC,0x4E,0xBC,0x4D,0x80,0xB4,0x6E,0x02,0xB4,0x8E,
+    0xC4,0xF0,0xCD,0x51,0x81,0xD5,0x92,0x80,0xD5,0xB2,0x00,0xD5,0xB1,0x81,0xD5,0xD2,
+    0x01,0xCD,0x50,0xBC,0xCE,0x80,0xB4,0xAD,0x02,0xBC,0xAD,0xBC,0xCD,0xB4,0xAD,0x81,
+    0xAC,0x4B,0x80,0xAC,0x6B,0x01,0x9B,0xEA,0x8B,0x68,0x80,0x8B,0x48,0x03,0x8B,0x69,
+    0x8B,0x6A,0x83,0x4A,0x7B,0x4A,0x82,0x7B,0x2A,0x80,0x73,0x2A,0x82,0x7B,0x4B,0x82,
+    0x7B,0x6B,0x80,0x7B,0x8B,0x02,0x7B,0x8C,0x7B,0x8B,0x83,0x8C,0x83,0x83,0xAC,0x81,
+    0x83,0xCC,0x01,0x52,0x47,0x4A,0x27,0x82,0x52,0x47,0x00,0x52,0x67,0x91,0x52,0x68,
+    0x00,0x5A,0x68,0x80,0x5A,0x88,0x07,0x5A,0x68,0x5A,0x67,0x62,0x88,0x6A,0xE8,0x7B,
+    0x68,0x8B,0xA9,0x9B,0xEA,0xAC,0x4B,0x81,0xBC,0xAC,0x08,0xB4,0x4B,0xAC,0x2A,0xAC,
+    0x4B,0xB4,0xAC,0xC5,0x2E,0xCD,0x70,0xCD,0xB1,0xD5,0xB1,0xD5,0xD2,0x80,0xDD,0xF2,
+    0x81,0xDD,0xD2,0x80,0xD5,0xD2,0x07,0xD5,0xB2,0xD5,0xB1,0xD5,0x91,0xCD,0x50,0xC4,
+    0xEF,0xBC,0xAE,0xB4,0x4D,0xB4,0x2D,0x80,0xB4,0x0D,0x01,0xB4,0x2D,0xB4,0x4D,0x80,
+    0xB4,0x6E,0x02,0xB4,0x8E,0xBC,0xF0,0xC5,0x31,0x80,0xC5,0x30,0x06,0xC5,0x51,0xCD,
+    0x71,0xCD,0x91,0xD5,0xB2,0xD5,0xD2,0xDD,0xD2,0xCD,0x70,0x80,0xC5,0x0F,0x00,0xC5,
+    0x2F,0x81,0xCD,0x4F,0x02,0xC5,0x0E,0xB4,0xCD,0xB4,0x8C,0x80,0xAC,0x8C,0x07,0xA4,
+    0x4B,0x9B,0xC9,0x93,0xA9,0x93,0x89,0x93,0xAA,0x8B,0x8A,0x83,0x6A,0x7B,0x4B,0x80,
+    0x7B,0x2A,0x81,0x7B,0x2B,0x83,0x7B,0x4B,0x82,0x7B,0x6B,0x01,0x7B,0x8C,0x7B,0x8B,
+    0x80,0x7B,0x8C,0x80,0x83,0x8C,0x81,0x83,0xAC,0x82,0x83,0xCC,0x82,0x52,0x47,0x00,
+    0x52,0x67,0x84,0x52,0x68,0x8C,0x52,0x88,0x83,0x5A,0x88,0x26,0x5A,0x67,0x62,0x88,
+    0x6A,0xC8,0x7B,0x48,0x8B,0xA9,0x93,0xCA,0xA4,0x2B,0xB4,0x8D,0xBC,0xAD,0xBC,0xAC,
+    0xB4,0x6B,0xAC,0x4B,0xB4,0x8C,0xB4,0xCD,0xC5,0x4E,0xCD,0x70,0xCD,0x90,0xCD,0xB1,
+    0xD5,0xB1,0xD5,0xD2,0xD5,0xB2,0xD5,0xB1,0xD5,0xB2,0xD5,0xB1,0xCD,0x91,0xCD,0x71,
+    0xC5,0x50,0xC5,0x30,0xC5,0x10,0xBC,0xEF,0xB4,0xAE,0xB4,0x6E,0xAC,0x2D,0xAC,0x0C,
+    0xAB,0xCC,0xA3,0x8B,0xA3,0xAB,0xAC,0x2D,0xAC,0x4E,0x80,0xB4,0x6E,0x00,0xBC,0xAF,
+    0x80,0xBC,0xF0,0x80,0xBC,0xEF,0x06,0xBD,0x0F,0xC5,0x30,0xCD,0x91,0xD5,0xD2,0xDD,
+    0xD2,0xCD,0x70,0xBC,0xEE,0x80,0xBC,0xCE,0x05,0xC4,0xEE,0xC5,0x0F,0xC5,0x2F,0xC5,
+    0x0E,0xBC,0xCE,0xB4,0xAD,0x80,0xAC,0x8C,0x07,0xAC,0x6C,0xA4,0x2B,0x9C,0x0B,0x9B,
+    0xEB,0x9B,0xCB,0x93,0xAB,0x83,0x8B,0x83,0x4B,0x80,0x7B,0x4B,0x81,0x7B,0x2B,0x83,
+    0x7B,0x4B,0x82,0x7B,0x6B,0x80,0x7B,0x8C,0x00,0x7B,0xAC,0x80,0x7B,0x8C,0x00,0x83,
+    0x8C,0x81,0x83,0xAC,0x82,0x83,0xCC,0x82,0x52,0x47,0x00,0x52,0x67,0x82,0x52,0x68,
+    0x85,0x52,0x88,0x8A,0x5A,0x88,0x01,0x5A,0xA8,0x5A,0x88,0x80,0x62,0x88,0x05,0x62,
+    0xC8,0x73,0x28,0x83,0xAA,0x93,0xEA,0xA4,0x4C,0xB4,0x8D,0x80,0xBC,0xAD,0x07,0xB4,
+    0x6C,0xAC,0x4B,0xB4,0xAC,0xBC,0xED,0xC5,0x2E,0xC5,0x4F,0xCD,0x70,0xCD,0x90,0x81,
+    0xD5,0xB1,0x80,0xD5,0x91,0x03,0xCD,0x71,0xCD,0x51,0xC5,0x50,0xC5,0x30,0x80,0xBC,
+    0xEF,0x05,0xBC,0xCF,0xBC,0xAE,0xB4,0x6E,0xAC,0x0D,0xA3,0xCB,0x93,0x29,0x80,0x82,
+    0xA7,0x05,0x93,0x29,0xA3,0xEC,0xB4,0x4E,0xB4,0x6E,0xB4,0xAF,0xBC,0xAF,0x81,0xB4,
+    0xCF,0x02,0xBC,0xCF,0xC5,0x10,0xCD,0x71,0x80,0xD5,0xB2,0x01,0xC5,0x30,0xB4,0xAE,
+    0x80,0xB4,0x8D,0x80,0xB4,0xAD,0x0D,0xBC,0xCE,0xB4,0xAD,0xAC,0x6C,0x9C,0x0B,0x9B,
+    0xCA,0x9B,0xEA,0x9C,0x0A,0x9B,0xEA,0x9C,0x0B,0x9B,0xEB,0x93,0xCA,0x8B,0xAB,0x8B,
+    0x8B,0x83,0x8C,0x80,0x83,0x6C,0x00,0x83,0x6B,0x85,0x7B,0x4B,0x82,0x7B,0x6B,0x82,
+    0x7B,0x8C,0x01,0x7B,0xAC,0x83,0x8C,0x82,0x83,0xAC,0x80,0x83,0xCC,0x00,0x83,0xCD,
+    0x81,0x52,0x47,0x81,0x52,0x68,0x80,0x52,0x88,0x87,0x5A,0x88,0x8B,0x5A,0xA8,0x80,
+    0x62,0xA8,0x05,0x62,0xC8,0x73,0x49,0x8B,0xAA,0x93,0xEB,0xAC,0x4C,0xB4,0x8D,0x80,
+    0xB4,0xAD,0x80,0xB4,0x8D,0x02,0xB4,0xAD,0xBC,0xEE,0xC5,0x0E,0x81,0xC5,0x2F,0x01,
+    0xC5,0x50,0xCD,0x50,0x81,0xCD,0x70,0x05,0xC5,0x50,0xC5,0x30,0xC5,0x10,0xBC,0xEF,
+    0xBC,0xCF,0xBC,0xAF,0x80,0xB4,0x8E,0x0D,0xAC,0x4D,0x9B,0xAB,0x93,0x29,0x8A,0xC8,
+    0x82,0x87,0x7A,0x87,0x82,0xA8,0x93,0x29,0xA3,0xCC,0xAC,0x2D,0xAC,0x4E,0xB4,0x6E,
+    0xB4,0x8E,0xB4,0x8F,0x80,0xB4,0xAF,0x08,0xBC,0xEF,0xCD,0x51,0xD5,0x92,0xCD,0x91,
+    0xC5,0x30,0xBC,0xEF,0xBC,0xAE,0xB4,0x8D,0xAC,0x6C,0x81,0xAC,0x8D,0x0A,0xA4,0x0B,
+    0x9B,0xAA,0x93,0x69,0x93,0x68,0x8B,0x68,0x93,0xA9,0x9C,0x0B,0x9B,0xEB,0x93,0xAA,
+    0x8B,0xAB,0x83,0x8B,0x83,0x83,0x8C,0x88,0x7B,0x6B,0x01,0x7B,0x8C,0x7B,0x8B,0x80,
+    0x7B,0x8C,0x80,0x83,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,0x80,0x52,0x47,0x81,0x52,
+    0x68,0x81,0x52,0x88,0x86,0x5A,0x88,0x00,0x5A,0xA8,0x8A,0x5A,0xA9,0x08,0x5A,0xA8,
+    0x62,0xA8,0x62,0xC8,0x6A,0xE8,0x7B,0x49,0x8B,0xCB,0x9C,0x0C,0xAC,0x4C,0xB4,0x8D,
+    0x80,0xBC,0xCD,0x80,0xB4,0xAD,0x80,0xBC,0xCE,0x81,0xB4,0xAD,0x00,0xB4,0x8D,0x80,
+    0xB4,0xAD,0x00,0xB4,0xCE,0x81,0xBC,0xCE,0x03,0xBC,0xEF,0xB4,0xCE,0xAC,0x8D,0xAC,
+    0x6D,0x80,0xAC,0x4D,0x02,0xA4,0x0C,0x93,0x8A,0x8B,0x08,0x80,0x82,0xC8,0x00,0x82,
+    0xA8,0x80,0x82,0xC8,0x07,0x8A,0xE9,0x8B,0x09,0x93,0x8B,0xA3,0xEC,0xAC,0x2D,0xAC,
+    0x4E,0xAC,0x6E,0xB4,0x8E,0x80,0xB4,0xAF,0x15,0xBC,0xCF,0xB4,0xAF,0xB4,0x8E,0xA4,
+    0x4C,0xB4,0x8E,0xBC,0xEF,0xBC,0xCE,0xB4,0x8D,0xAC,0x8D,0xAC,0x6C,0xAC,0x4C,0xA4,
+    0x0B,0x9B,0xAA,0x93,0x89,0x93,0x68,0x8B,0x68,0x93,0xCA,0x9C,0x0B,0x93,0xEB,0x8B,
+    0xAA,0x83,0x8A,0x83,0x8B,0x83,0x83,0x8C,0x00,0x7B,0x6C,0x87,0x7B,0x6B,0x01,0x7B,
+    0x8C,0x7B,0x8B,0x80,0x7B,0x8C,0x80,0x83,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,0x80,
+    0x52,0x47,0x80,0x52,0x68,0x81,0x52,0x88,0x80,0x5A,0x88,0x84,0x5A,0xA8,0x88,0x5A,
+    0xA9,0x81,0x5A,0xC9,0x01,0x5A,0xA9,0x5A,0xA8,0x80,0x62,0xC8,0x07,0x6B,0x08,0x7B,
+    0x6A,0x94,0x0B,0x9C,0x2C,0xAC,0x6D,0xB4,0xAD,0xBC,0xCE,0xBC,0xEE,0x82,0xBC,0xCE,
+    0x01,0xB4,0xAD,0xB4,0x8D,0x81,0xAC,0x6C,0x02,0xAC,0x4C,0xA4,0x4C,0xAC,0x4C,0x82,
+    0xAC,0x6D,0x04,0xA4,0x2C,0xA4,0x0C,0x9B,0xEC,0x93,0xAB,0x8B,0x29,0x80,0x82,0xC8,
+    0x09,0x82,0xE8,0x8B,0x09,0x93,0x29,0x93,0x4A,0x9B,0x6A,0x93,0x4A,0x8B,0x09,0x8B,
+    0x29,0x93,0x6A,0x9B,0xAB,0x80,0x9B,0xEC,0x0E,0xA4,0x2D,0xAC,0x6E,0xB4,0xAF,0xB4,
+    0x8E,0xA4,0x0C,0x93,0x8A,0x83,0x28,0x8B,0x69,0xA4,0x0C,0xB4,0xAE,0xBC,0xCE,0xB4,
+    0xCE,0xB4,0x8D,0xAC,0x6D,0xA4,0x0B,0x82,0x9B,0xCA,0x05,0xA4,0x0B,0xA4,0x2C,0x93,
+    0xCB,0x8B,0x8A,0x83,0x6A,0x83,0x6B,0x80,0x7B,0x6B,0x80,0x83,0x6C,0x02,0x7B,0x6C,
+    0x83,0x8C,0x7B,0x6C,0x86,0x7B,0x6B,0x01,0x7B,0x8C,0x7B,0x8B,0x80,0x7B,0x8C,0x80,
+    0x83,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,0x00,0x52,0x47,0x80,0x52,0x68,0x00,0x52,
+    0x88,0x81,0x5A,0x88,0x88,0x5A,0xA9,0x8B,0x5A,0xC9,0x06,0x62,0xC8,0x62,0xE9,0x6B,
+    0x09,0x83,0xAB,0x9C,0x4C,0xA4,0x6D,0xB4,0xAE,0x82,0xB4,0xAD,0x00,0xB4,0x8D,0x80,
+    0xB4,0xAD,0x06,0xB4,0x8D,0xAC,0x8C,0xAC,0x6C,0xAC,0x4C,0xA4,0x4C,0x9C,0x0B,0x9B,
+    0xCA,0x82,0x93,0xCA,0x04,0x9B,0xCB,0x93,0xCB,0x93,0xAA,0x93,0x6A,0x8B,0x29,0x80,
+    0x82,0xE8,0x0E,0x8B,0x29,0x93,0x6A,0xA3,0xAB,0xA3,0xEC,0xAC,0x0D,0xAC,0x2D,0xAB,
+    0xED,0x9B,0x8B,0x93,0x4A,0x8B,0x4A,0x93,0x8A,0x9B,0xAB,0x9B,0xCB,0x9B,0xCC,0xA4,
+    0x0C,0x80,0xA4,0x2D,0x13,0x9B,0xEC,0x8B,0x6A,0x83,0x29,0x8B,0x6A,0x9B,0xCB,0xA4,
+    0x2C,0xAC,0x6D,0xB4,0xAE,0xBC,0xCE,0xB4,0xAE,0xAC,0x4C,0xA4,0x0B,0xA3,0xEB,0x9B,
+    0xEB,0xA4,0x0B,0xA4,0x2C,0xA4,0x4C,0x93,0xEB,0x83,0x8A,0x83,0x6A,0x80,0x7B,0x4B,
+    0x01,0x7B,0x6B,0x7B,0x6C,0x80,0x7B,0x6B,0x01,0x83,0x6C,0x7B,0x6C,0x86,0x7B,0x6B,
+    0x82,0x7B,0x8C,0x80,0x83,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,0x00,0x52,0x47,0x80,
+    0x52,0x68,0x00,0x52,0x88,0x87,0x5A,0xA9,0x8A,0x62,0xC9,0x81,0x5A,0xE9,0x80,0x5A,
+    0xC9,0x07,0x62,0xC9,0x63,0x09,0x73,0x49,0x83,0xCB,0xA4,0x8D,0xB4,0xCF,0xB4,0xAE,
+    0xAC,0x6C,0x80,0xA4,0x4C,0x00,0xAC,0x6C,0x83,0xAC,0x8D,0x00,0xAC,0x6C,0x80,0xA4,
+    0x4C,0x02,0x9C,0x0B,0x93,0xA9,0x83,0x28,0x80,0x7B,0x07,0x00,0x83,0x07,0x80,0x83,
+    0x28,0x00,0x8B,0x49,0x80,0x8B,0x6A,0x80,0x93,0x8A,0x02,0xA3,0xEC,0xB4,0x4E,0xBC,
+    0x8F,0x82,0xBC,0xAF,0x05,0xB4,0x4D,0xA3,0xEC,0x93,0x8B,0x93,0x8A,0x93,0xAB,0x9B,
+    0xAB,0x80,0x9B,0xCB,0x05,0x9B,0xCC,0x9B,0xCB,0x93,0xAB,0x93,0x8A,0x93,0xAB,0x9B,
+    0xEC,0x80,0xA4,0x0C,0x03,0xA4,0x2C,0xA4,0x4C,0xAC,0x6D,0xAC,0x8D,0x80,0xB4,0x8D,
+    0x01,0xAC,0x4C,0xA4,0x2B,0x80,0xA4,0x2C,0x04,0xA4,0x4D,0x93,0xEB,0x83,0x8A,0x83,
+    0x6A,0x7B,0x4B,0x83,0x7B,0x6B,0x00,0x83,0x6B,0x87,0x7B,0x6B,0x80,0x7B,0x8C,0x80,
+    0x83,0x8C,0x84,0x83,0xAC,0x81,0x83,0xCC,0x03,0x52,0x48,0x52,0x68,0x52,0x88,0x5A,
+    0x88,0x82,0x5A,0xA9,0x00,0x5A,0xC9,0x92,0x62,0xC9,0x08,0x5A,0xC9,0x62,0xE9,0x6B,
+    0x2A,0x7B,0x8B,0x8C,0x0C,0x9C,0x6E,0xA4,0x8E,0xA4,0x6D,0xA4,0x2C,0x80,0xA4,0x2B,
+    0x01,0xA4,0x2C,0xA4,0x4C,0x81,0xAC,0x6C,0x01,0xAC,0x8D,0xAC,0x6C,0x80,0xA4,0x4C,
+    0x02,0xA4,0x2C,0x93,0xA9,0x83,0x27,0x81,0x7A,0xE7,0x08,0x83,0x08,0x83,0x28,0x83,
+    0x49,0x8B,0x8A,0x9B,0xCB,0xA4,0x2D,0xB4,0x6E,0xB4,0x8F,0xC4,0xF0,0x82,0xCD,0x11,
+    0x07,0xC5,0x10,0xBC,0xCF,0xAC,0x6D,0xA4,0x0C,0x9B,0xCB,0x93,0xAB,0x9B,0xAB,0x93,
+    0xAB,0x80,0x93,0x8B,0x15,0x93,0x8A,0x8B,0x49,0x93,0xAB,0xA4,0x0C,0xA4,0x2D,0xA4,
+    0x2C,0xA4,0x0C,0x9C,0x0C,0xA4,0x0C,0xA4,0x0B,0x9C,0x0B,0xA4,0x2C,0xAC,0x4C,0xAC,
+    0x6D,0xB4,0x8D,0xB4,0xAE,0xAC,0x6D,0x9C,0x2C,0x8B,0xAB,0x83,0x6A,0x7B,0x6A,0x7B,
+    0x4B,0x83,0x7B,0x6B,0x00,0x83,0x6B,0x87,0x7B,0x6B,0x80,0x7B,0x8C,0x80,0x83,0x8C,
+    0x84,0x83,0xAC,0x81,0x83,0xCC,0x80,0x52,0x68,0x00,0x52,0x88,0x80,0x5A,0xA9,0x81,
+    0x5A,0xC9,0x87,0x62,0xC9,0x86,0x62,0xE9,0x82,0x62,0xC9,0x08,0x62,0xEA,0x6B,0x2A,
+    0x73,0x8B,0x7B,0xCC,0x83,0xCB,0x8B,0xEB,0x94,0x0C,0xA4,0x4D,0xA4,0x4C,0x82,0xA4,
+    0x2B,0x81,0xA4,0x4C,0x80,0xAC,0x6C,0x80,0xA4,0x4C,0x02,0xA4,0x2C,0x9B,0xEB,0x8B,
+    0x69,0x82,0x83,0x28,0x07,0x8B,0x69,0x8B,0x8A,0x9B,0xCB,0xAC,0x2D,0xB4,0x8E,0xBC,
+    0xAF,0xC4,0xF0,0xCD,0x11,0x83,0xCD,0x31,0x0B,0xC4,0xF0,0xBC,0xAF,0xAC,0x6D,0xA4,
+    0x0C,0x9B,0xCC,0x93,0xAB,0x93,0x8B,0x93,0x8A,0x8B,0x6A,0x93,0x8B,0x8B,0x6A,0x9B,
+    0xCC,0x82,0xA4,0x0C,0x00,0x9B,0xEC,0x80,0x9B,0xEB,0x0A,0x9B,0xCB,0x9B,0xEB,0xA4,
+    0x0B,0xAC,0x4C,0xB4,0xAD,0xB4,0xAE,0xAC,0x6D,0x9C,0x0C,0x83,0x8A,0x83,0x6A,0x83,
+    0x6B,0x8E,0x7B,0x6B,0x01,0x7B,0x8C,0x7B,0x8B,0x80,0x7B,0x8C,0x80,0x83,0x8C,0x82,
+    0x83,0xAC,0x81,0x83,0xCC,0x80,0x52,0x68,0x00,0x52,0x88,0x80,0x5A,0xA9,0x81,0x5A,
+    0xC9,0x85,0x62,0xC9,0x8A,0x62,0xE9,0x05,0x62,0xC9,0x62,0xEA,0x6B,0x4B,0x73,0x6C,
+    0x7B,0xAC,0x73,0x6B,0x80,0x73,0x49,0x01,0x83,0xAB,0x9C,0x4C,0x84,0xA4,0x4C,0x00,
+    0xA4,0x2C,0x84,0xA4,0x4C,0x02,0xA4,0x2C,0x9C,0x0B,0x93,0xCA,0x81,0x93,0xAA,0x04,
+    0x93,0xCB,0x9B,0xEB,0xA4,0x2D,0xAC,0x6E,0xB4,0xAF,0x80,0xBC,0xCF,0x00,0xC4,0xF0,
+    0x81,0xC5,0x10,0x80,0xC4,0xF0,0x0D,0xBC,0xF0,0xBC,0xCF,0xB4,0x8E,0xAC,0x4D,0x9B,
+    0xEC,0x9B,0xAB,0x93,0x8B,0x93,0x8A,0x93,0x8B,0x93,0xAB,0x9B,0xCC,0x9B,0xEC,0xA4,
+    0x0C,0xA4,0x2C,0x80,0xA4,0x0C,0x06,0x9C,0x0C,0x9B,0xEC,0x9B,0xEB,0x9B,0xCB,0x9B,
+    0xEB,0xA4,0x0C,0xAC,0x4D,0x80,0xB4,0xAE,0x05,0xA4,0x6E,0x94,0x0C,0x8B,0xAB,0x83,
+    0x6A,0x83,0x6B,0x7B,0x6B,0x81,0x83,0x6B,0x8A,0x7B,0x6B,0x01,0x7B,0x8C,0x7B,0x8B,
+    0x82,0x7B,0x8C,0x82,0x83,0xAC,0x81,0x83,0xCC,0x02,0x52,0x48,0x52,0x68,0x52,0x88,
+    0x80,0x5A,0xA9,0x00,0x5A,0xC9,0x81,0x62,0xC9,0x8F,0x62,0xEA,0x80,0x62,0xE9,0x00,
+    0x6B,0x2A,0x80,0x73,0x8C,0x07,0x73,0x6B,0x6B,0x2A,0x6B,0x29,0x73,0x49,0x7B,0x8A,
+    0x93,0xEB,0x9C,0x2B,0xA4,0x6C,0x81,0xAC,0x8D,0x00,0xA4,0x6C,0x83,0xA4,0x4C,0x00,
+    0xA4,0x6C,0x81,0xA4,0x4C,0x00,0xA4,0x2C,0x80,0x9C,0x0B,0x00,0x9C,0x0C,0x80,0xA4,
+    0x2C,0x02,0xAC,0x6D,0xB4,0x8E,0xB4,0xAE,0x85,0xBC,0xCF,0x80,0xBC,0xAF,0x07,0xB4,
+    0xAF,0xB4,0x8E,0xAC,0x6E,0xA4,0x0C,0x9B,0xEC,0x9B,0xCC,0x9B,0xCB,0x9B,0xCC,0x80,
+    0x9B,0xEC,0x80,0x9C,0x0C,0x01,0xA4,0x0C,0xA4,0x2C,0x81,0xA4,0x0C,0x80,0x9C,0x0C,
+    0x80,0xA4,0x2C,0x81,0xA4,0x4D,0x03,0x94,0x0C,0x8B,0xCC,0x8B,0xAB,0x83,0x8B,0x83,
+    0x83,0x6B,0x8A,0x7B,0x6B,0x82,0x7B,0x8C,0x02,0x7B,0xAC,0x7B,0x8C,0x7B,0xAC,0x81,
+    0x83,0xAC,0x00,0x83,0xCC,0x80,0x83,0xCD,0x02,0x52,0x48,0x52,0x68,0x52,0x88,0x80,
+    0x5A,0xA9,0x01,0x5A,0xC9,0x62,0xC9,0x92,0x62,0xEA,0x03,0x63,0x0A,0x6B,0x4B,0x73,
+    0x6B,0x73,0x4B,0x80,0x6B,0x2A,0x80,0x6B,0x29,0x03,0x7B,0x6A,0x8B,0xCB,0x94,0x0B,
+    0xA4,0x6D,0x80,0xB4,0xEE,0x00,0xAC,0xAD,0x80,0xAC,0x8D,0x04,0xAC,0x6C,0xA4,0x4C,
+    0xA4,0x4B,0xA4,0x4C,0xA4,0x6C,0x80,0xAC,0x6C,0x81,0xA4,0x4C,0x81,0xA4,0x2C,0x06,
+    0xA4,0x4C,0xAC,0x6D,0xB4,0x8E,0xB4,0xAE,0xB4,0xAF,0xBC,0xCF,0xB4,0xCF,0x80,0xB4,
+    0xAF,0x80,0xB4,0xAE,0x81,0xB4,0x8E,0x02,0xB4,0x6E,0xAC,0x4D,0xA4,0x2D,0x80,0xA4,
+    0x0C,0x03,0xA3,0xEC,0x9B,0xEC,0xA4,0x0D,0xA4,0x0C,0x80,0x9B,0xEC,0x00,0x93,0xCB,
+    0x81,0xA4,0x0C,0x80,0xA4,0x4D,0x00,0xAC,0x4D,0x81,0xA4,0x4D,0x01,0x9C,0x2C,0x93,
+    0xCB,0x80,0x83,0x8A,0x02,0x83,0x8B,0x83,0xAC,0x83,0x8C,0x82,0x83,0x6B,0x8B,0x7B,
+    0x6B,0x81,0x7B,0x8B,0x00,0x7B,0x8C,0x80,0x7B,0xAC,0x81,0x83,0xAC,0x00,0x83,0xCC,
+    0x80,0x83,0xCD,0x04,0x52,0x48,0x52,0x68,0x5A,0x88,0x5A,0xA9,0x5A,0xC9,0x80,0x62,
+    0xC9,0x83,0x62,0xEA,0x87,0x63,0x0A,0x82,0x62,0xEA,0x82,0x63,0x0A,0x82,0x6B,0x2A,
+    0x80,0x6B,0x29,0x05,0x73,0x4A,0x8B,0xAB,0x94,0x0B,0xA4,0x6D,0xB4,0xCE,0xAC,0xCE,
+    0x80,0xAC,0xAD,0x00,0xB4,0xCD,0x80,0xAC,0xAD,0x02,0xAC,0x8C,0xAC,0x6C,0xA4,0x6C,
+    0x82,0xA4,0x4C,0x83,0xA4,0x2C,0x02,0xAC,0x4D,0xAC,0x6E,0xB4,0x8E,0x80,0xB4,0xAE,
+    0x80,0xB4,0xAF,0x80,0xB4,0xAE,0x81,0xB4,0x8E,0x80,0xAC,0x6E,0x01,0xA4,0x4D,0xA4,
+    0x2D,0x83,0xA4,0x0C,0x07,0x9B,0xEC,0x9B,0xCC,0x9B,0xCB,0x93,0xAB,0xA4,0x0C,0xAC,
+    0x4D,0xA4,0x2D,0xAC,0x4D,0x81,0xAC,0x6E,0x03,0xA4,0x4D,0xA4,0x2D,0x9C,0x0C,0x8B,
+    0xAB,0x80,0x83,0x6A,0x80,0x83,0x8B,0x80,0x83,0xAC,0x00,0x83,0x8B,0x80,0x83,0x6B,
+    0x8B,0x7B,0x6B,0x81,0x7B,0x8B,0x80,0x7B,0x8C,0x00,0x7B,0xAC,0x81,0x83,0xAC,0x00,
+    0x83,0xCC,0x80,0x83,0xCD,0x04,0x52,0x48,0x52,0x68,0x5A,0x88,0x5A,0xA9,0x5A,0xC9,
+    0x80,0x62,0xC9,0x85,0x62,0xEA,0x85,0x63,0x0A,0x82,0x62,0xEA,0x83,0x63,0x0A,0x00,
+    0x6B,0x0A,0x81,0x6B,0x2A,0x09,0x6B,0x29,0x73,0x4A,0x8B,0xAB,0x9C,0x2C,0xA4,0x4C,
+    0xA4,0x6D,0xAC,0x8D,0xAC,0x8C,0xAC,0xAD,0xB4,0xCD,0x80,0xB4,0xCE,0x80,0xB4,0xAE,
+    0x04,0xAC,0x8D,0xAC,0x6D,0xA4,0x4D,0xAC,0x4D,0xA4,0x4D,0x80,0xA4,0x2C,0x06,0xA4,
+    0x0C,0x9C,0x0C,0xA4,0x0C,0xA4,0x2C,0xAC,0x4D,0xAC,0x6D,0xAC,0x6E,0x80,0xB4,0x8E,
+    0x08,0xAC,0x8E,0xAC,0x6D,0xAC,0x6E,0xAC,0x8E,0xAC,0x6E,0xAC,0x6D,0xAC,0x4D,0xA4,
+    0x2D,0xA4,0x0C,0x80,0x9C,0x0C,0x83,0x9B,0xEC,0x81,0x9B,0xCB,0x00,0x9C,0x0C,0x80,
+    0xAC,0x6E,0x00,0xAC,0x8E,0x80,0xB4,0x8E,0x05,0xAC,0x6E,0xA4,0x4D,0x9C,0x0C,0x93,
+    0xCB,0x8B,0x8A,0x83,0x4A,0x80,0x83,0x6A,0x05,0x83,0x6B,0x83,0x8C,0x83,0xAC,0x8B,
+    0xAC,0x83,0x8C,0x83,0x8B,0x8B,0x7B,0x6B,0x81,0x7B,0x8B,0x80,0x7B,0x8C,0x00,0x7B,
+    0xAC,0x81,0x83,0xAC,0x00,0x83,0xCC,0x80,0x83,0xCD,0x01,0x52,0x68,0x52,0x88,0x80,
+    0x5A,0xA9,0x80,0x62,0xC9,0x84,0x62,0xEA,0x90,0x63,0x0A,0x80,0x6B,0x0A,0x80,0x6B,
+    0x2A,0x07,0x6B,0x29,0x7B,0x4A,0x83,0xAA,0x94,0x2C,0x9C,0x4C,0xA4,0x4C,0xA4,0x6D,
+    0xAC,0x8C,0x80,0xAC,0xAD,0x83,0xB4,0xAE,0x00,0xAC,0x8E,0x80,0xAC,0x6D,0x03,0xAC,
+    0x4D,0xA4,0x4D,0xA4,0x2C,0x9C,0x0C,0x80,0x9B,0xEB,0x03,0x9C,0x0B,0xA4,0x0C,0xA4,
+    0x2C,0xA4,0x4D,0x83,0xAC,0x4D,0x01,0xA4,0x4C,0xA4,0x2D,0x80,0xA4,0x2C,0x01,0xA4,
+    0x0C,0x9B,0xEC,0x84,0x9B,0xEB,0x82,0x9B,0xCB,0x01,0xA4,0x0C,0xAC,0x4D,0x80,0xB4,
+    0xAF,0x06,0xB4,0x8E,0xB4,0xAF,0xAC,0x8E,0xA4,0x4D,0x93,0xEB,0x8B,0x8A,0x83,0x6A,
+    0x80,0x83,0x4A,0x00,0x83,0x6A,0x80,0x83,0x6B,0x06,0x83,0x6C,0x83,0x8C,0x83,0xAC,
+    0x83,0x8B,0x7B,0x8B,0x83,0x8B,0x7B,0x6B,0x80,0x7B,0x8B,0x85,0x7B,0x6B,0x80,0x7B,
+    0x8B,0x80,0x7B,0x8C,0x01,0x7B,0xAC,0x7B,0x8C,0x81,0x83,0xAC,0x80,0x83,0xCC,0x06,
+    0x83,0xCD,0x83,0xED,0x52,0x68,0x5A,0x88,0x5A,0xA9,0x5A,0xC9,0x62,0xC9,0x84,0x62,
+    0xEA,0x00,0x63,0x0A,0x82,0x63,0x0B,0x87,0x63,0x0A,0x84,0x6B,0x0A,0x81,0x6B,0x2A,
+    0x05,0x73,0x29,0x7B,0x4A,0x83,0xAA,0x94,0x0C,0x9C,0x2C,0x9C,0x4C,0x80,0xA4,0x6C,
+    0x80,0xAC,0x8D,0x02,0xAC,0xAD,0xB4,0xAE,0xB4,0xCE,0x80,0xB4,0xCF,0x00,0xB4,0xEF,
+    0x80,0xB4,0xCE,0x03,0xB4,0xAE,0xAC,0x8D,0xA4,0x4D,0xA4,0x2C,0x81,0x9B,0xEB,0x00,
+    0xA4,0x0C,0x81,0xA4,0x2C,0x00,0xA4,0x4D,0x82,0xA4,0x2C,0x82,0xA4,0x0C,0x00,0x9B,
+    0xEC,0x84,0x9B,0xEB,0x81,0x9B,0xCB,0x0B,0x9B,0xEC,0xA4,0x4D,0xAC,0x6E,0xB4,0xCF,
+    0xB4,0xAF,0xB4,0x8E,0xB4,0xAE,0xAC,0x8E,0x9C,0x0C,0x8B,0xAB,0x83,0x6A,0x83,0x4A,
+    0x80,0x83,0x6A,0x00,0x83,0x4A,0x81,0x83,0x6B,0x01,0x83,0x6C,0x83,0x8C,0x81,0x83,
+    0x8B,0x81,0x7B,0x8B,0x85,0x7B,0x6B,0x81,0x7B,0x8C,0x00,0x7B,0xAC,0x82,0x83,0xAC,
+    0x80,0x83,0xCC,0x80,0x83,0xCD,0x05,0x83,0xED,0x52,0x68,0x5A,0x88,0x5A,0xA9,0x5A,
+    0xC9,0x62,0xC9,0x82,0x62,0xEA,0x00,0x63,0x0A,0x85,0x6B,0x0B,0x86,0x6B,0x0A,0x82,
+    0x6B,0x2B,0x83,0x6B,0x2A,0x04,0x73,0x29,0x7B,0x4A,0x83,0xAA,0x94,0x0B,0x94,0x0C,
+    0x80,0x9C,0x2C,0x80,0xA4,0x4C,0x04,0xA4,0x6C,0xAC,0x8D,0xB4,0xAE,0xB4,0xCE,0xBC,
+    0xEF,0x82,0xBD,0x0F,0x04,0xBC,0xEF,0xB4,0xCE,0xAC,0x6D,0xA4,0x2C,0x9C,0x0C,0x80,
+    0x9B,0xEB,0x00,0x9C,0x0B,0x80,0xA4,0x0C,0x81,0xA4,0x2C,0x81,0xA4,0x0C,0x82,0x9C,
+    0x0C,0x00,0x9B,0xEC,0x81,0x9B,0xEB,0x81,0x9B,0xCB,0x80,0x9B,0xEB,0x03,0x9C,0x0C,
+    0xA4,0x2D,0xAC,0x6D,0xAC,0x6E,0x80,0xB4,0xAF,0x04,0xB4,0x8E,0xAC,0x8E,0xA4,0x4D,
+    0x93,0xCB,0x8B,0x8A,0x82,0x83,0x6A,0x00,0x83,0x4A,0x82,0x83,0x6B,0x82,0x83,0x8B,
+    0x81,0x7B,0x8B,0x83,0x7B,0x6B,0x81,0x7B,0x8C,0x80,0x7B,0xAC,0x82,0x83,0xAC,0x81,
+    0x83,0xCC,0x07,0x83,0xCD,0x83,0xED,0x8B,0xED,0x52,0x68,0x5A,0x88,0x5A,0xA9,0x5A,
+    0xC9,0x62,0xCA,0x80,0x62,0xEA,0x80,0x63,0x0A,0x01,0x6B,0x0B,0x63,0x0B,0x84,0x6B,
+    0x0B,0x86,0x63,0x0A,0x82,0x6B,0x0A,0x80,0x6B,0x2A,0x00,0x6B,0x2B,0x80,0x6B,0x2A,
+    0x02,0x73,0x29,0x7B,0x4A,0x8B,0xAA,0x80,0x93,0xEB,0x00,0x94,0x0C,0x80,0x9C,0x0B,
+    0x06,0xA4,0x2B,0xA4,0x4C,0xAC,0x6C,0xAC,0xAD,0xB4,0xCE,0xB4,0xEE,0xBC,0xEF,0x81,
+    0xBD,0x0F,0x05,0xB4,0xEF,0xB4,0xAE,0xAC,0x8D,0xA4,0x4C,0x9C,0x0B,0x9B,0xEB,0x80,
+    0x9C,0x0B,0x80,0x9C,0x0C,0x80,0xA4,0x0C,0x03,0x9C,0x0C,0x9C,0x0B,0x9C,0x0C,0x9C,
+    0x0B,0x86,0x9B,0xEB,0x80,0x9B,0xCB,0x81,0x9B,0xEB,0x03,0xA4,0x2C,0xAC,0x4D,0xAC,
+    0x6D,0xB4,0x8E,0x80,0xBC,0xCF,0x05,0xAC,0x6D,0xA4,0x2C,0x9C,0x0C,0x8B,0xAA,0x8B,
+    0x8A,0x83,0x8A,0x81,0x83,0x6A,0x83,0x83,0x6B,0x82,0x83,0x8B,0x83,0x7B,0x8B,0x84,
+    0x7B,0x8C,0x84,0x83,0xAC,0x81,0x83,0xCC,0x06,0x83,0xCD,0x83,0xED,0x8B,0xED,0x5A,
+    0x88,0x5A,0x89,0x5A,0xA9,0x62,0xC9,0x80,0x62,0xEA,0x80,0x63,0x0A,0x00,0x6B,0x0B,
+    0x83,0x6B,0x2B,0x81,0x63,0x2B,0x00,0x63,0x2A,0x85,0x63,0x0A,0x00,0x6B,0x0A,0x84,
+    0x6B,0x2B,0x80,0x6B,0x2A,0x03,0x73,0x29,0x7B,0x6A,0x8B,0xCB,0x93,0xCB,0x80,0x93,
+    0xEB,0x00,0x9B,0xEB,0x80,0x9C,0x0B,0x05,0xA4,0x2B,0xA4,0x2C,0xAC,0x6C,0xAC,0xAD,
+    0xB4,0xCE,0xB4,0xEE,0x80,0xBC,0xEF,0x04,0xB4,0xEF,0xB4,0xCE,0xAC,0xAE,0xAC,0x8D,
+    0xA4,0x4C,0x81,0x9C,0x0B,0x84,0x9C,0x0C,0x81,0x9C,0x0B,0x82,0x9B,0xEB,0x01,0x9B,
+    0xCB,0x9B,0xCA,0x82,0x9B,0xEA,0x80,0x9B,0xEB,0x01,0xA4,0x0B,0xA4,0x2C,0x80,0xAC,
+    0x6D,0x00,0xAC,0x8D,0x80,0xB4,0xAE,0x02,0xA4,0x4D,0x9C,0x0B,0x8B,0xAA,0x81,0x83,
+    0x8A,0x80,0x83,0x6A,0x84,0x83,0x6B,0x81,0x83,0x8B,0x86,0x7B,0x8B,0x01,0x7B,0x8C,
+    0x83,0x8C,0x88,0x83,0xAC,0x80,0x83,0xCC,0x05,0x8B,0xCD,0x8B,0xED,0x5A,0x88,0x5A,
+    0x89,0x5A,0xA9,0x62,0xCA,0x80,0x62,0xEA,0x01,0x6B,0x0A,0x6B,0x0B,0x87,0x6B,0x2B,
+    0x82,0x63,0x2B,0x82,0x63,0x2A,0x82,0x6B,0x2B,0x00,0x6B,0x4B,0x80,0x6B,0x2B,0x00,
+    0x6B,0x0A,0x80,0x73,0x2A,0x01,0x83,0x8A,0x93,0xEB,0x80,0x9C,0x0C,0x01,0x9C,0x0B,
+    0x93,0xCA,0x80,0x93,0xAA,0x05,0x93,0xCA,0x9B,0xEA,0x9C,0x0B,0xA4,0x4C,0xAC,0x6C,
+    0xAC,0x8D,0x82,0xAC,0xAE,0x80,0xAC,0x8D,0x00,0xA4,0x2C,0x80,0x9C,0x0B,0x83,0x9C,
+    0x0C,0x84,0x9B,0xEB,0x81,0x9B,0xCB,0x00,0x93,0xCA,0x80,0x9B,0xCA,0x81,0x9B,0xEA,
+    0x0A,0x9B,0xEB,0x9C,0x0B,0xA4,0x0B,0xA4,0x2C,0xA4,0x4C,0xAC,0x4D,0xAC,0x6D,0xAC,
+    0x4D,0xA4,0x2C,0x9B,0xEB,0x8B,0x8A,0x80,0x83,0x69,0x81,0x83,0x8A,0x80,0x83,0x6A,
+    0x82,0x83,0x6B,0x83,0x83,0x8B,0x85,0x7B,0x8B,0x00,0x7B,0xAC,0x89,0x83,0xAC,0x80,
+    0x83,0xCC,0x80,0x8B,0xED,0x00,0x5A,0x89,0x80,0x5A,0xA9,0x00,0x62,0xCA,0x80,0x62,
+    0xEA,0x80,0x6B,0x0B,0x00,0x6B,0x2B,0x84,0x6B,0x4B,0x84,0x6B,0x2B,0x81,0x63,0x2B,
+    0x83,0x6B,0x2B,0x00,0x6B,0x4B,0x80,0x6B,0x2B,0x08,0x6B,0x0A,0x73,0x2A,0x7B,0x4A,
+    0x8B,0xAB,0x9C,0x0C,0x9C,0x2C,0xA4,0x2C,0x9C,0x0B,0x93,0xCA,0x81,0x93,0xA9,0x05,
+    0x93,0xAA,0x93,0xCA,0x9B,0xEB,0xA4,0x2B,0xA4,0x4C,0xA4,0x6C,0x81,0xA4,0x6D,0x03,
+    0xA4,0x4D,0xA4,0x4C,0x9C,0x2C,0x9B,0xEB,0x80,0x9C,0x0B,0x87,0x9B,0xEB,0x00,0x9B,
+    0xCB,0x83,0x93,0xAA,0x00,0x93,0xCA,0x80,0x9B,0xCA,0x03,0x9B,0xEA,0x9B,0xEB,0x9C,
+    0x0B,0xA4,0x0B,0x81,0xA4,0x2C,0x07,0x9C,0x0B,0x9B,0xCB,0x93,0xAA,0x8B,0x69,0x83,
+    0x28,0x83,0x29,0x83,0x69,0x83,0x6A,0x80,0x83,0x8A,0x00,0x83,0x6A,0x82,0x83,0x6B,
+    0x85,0x83,0x8B,0x84,0x83,0x8C,0x84,0x83,0xAC,0x80,0x83,0xCD,0x00,0x83,0xCC,0x80,
+    0x83,0xAC,0x81,0x83,0xCC,0x80,0x8B,0xED,0x06,0x5A,0x89,0x5A,0xA9,0x5A,0xC9,0x62,
+    0xCA,0x62,0xEA,0x63,0x0A,0x6B,0x0B,0x80,0x6B,0x2B,0x8B,0x6B,0x4B,0x85,0x6B,0x2B,
+    0x02,0x6B,0x4B,0x6B,0x2B,0x6B,0x2A,0x80,0x73,0x2A,0x08,0x83,0x8B,0x93,0xEB,0x9C,
+    0x4C,0xA4,0x2C,0xA4,0x4C,0xA4,0x2C,0x9B,0xEA,0x93,0xA9,0x93,0x89,0x81,0x8B,0x89,
+    0x00,0x93,0xA9,0x80,0x93,0xCA,0x00,0x93,0xEB,0x80,0x9C,0x0B,0x03,0x9C,0x0C,0x9C,
+    0x0B,0x9C,0x0C,0x9C,0x0B,0x85,0x9B,0xEB,0x82,0x9B,0xCB,0x00,0x9B,0xCA,0x81,0x93,
+    0xAA,0x80,0x93,0x8A,0x07,0x93,0x89,0x93,0xA9,0x93,0xAA,0x93,0xCA,0x9B,0xCA,0x9B,
+    0xEA,0x9B,0xEB,0x9C,0x0B,0x80,0xA4,0x0C,0x04,0x9C,0x0B,0x93,0xCA,0x8B,0x89,0x83,
+    0x49,0x83,0x08,0x80,0x7B,0x08,0x02,0x7B,0x28,0x83,0x49,0x83,0x6A,0x80,0x83,0x8A,
+    0x88,0x83,0x8B,0x87,0x83,0xAC,0x82,0x83,0xCC,0x81,0x83,0xCD,0x80,0x83,0xAC,0x81,
+    0x83,0xCC,0x80,0x8B,0xED,0x02,0x5A,0x89,0x5A,0xC9,0x62,0xCA,0x80,0x62,0xEA,0x00,
+    0x6B,0x0B,0x81,0x6B,0x2B,0x84,0x6B,0x4B,0x80,0x6B,0x2B,0x80,0x6B,0x4B,0x87,0x6B,
+    0x2B,0x80,0x6B,0x4B,0x06,0x6B,0x2B,0x73,0x2B,0x73,0x0A,0x7B,0x4A,0x8B,0xAB,0x9C,
+    0x2C,0xA4,0x6C,0x81,0xAC,0x4C,0x02,0xA4,0x0B,0x93,0xAA,0x93,0x69,0x81,0x8B,0x68,
+    0x01,0x8B,0x89,0x93,0xA9,0x80,0x93,0xCA,0x00,0x93,0xEB,0x81,0x9C,0x0B,0x01,0x9C,
+    0x0C,0x9C,0x0B,0x87,0x9B,0xEB,0x80,0x9B,0xCA,0x01,0x93,0xCA,0x93,0xAA,0x80,0x93,
+    0x89,0x00,0x8B,0x89,0x80,0x93,0x89,0x03,0x93,0xA9,0x93,0xAA,0x93,0xCA,0x9B,0xCA,
+    0x81,0x9B,0xEA,0x03,0x9B,0xEB,0x9B,0xCA,0x93,0xCA,0x8B,0x89,0x80,0x83,0x28,0x80,
+    0x7B,0x07,0x03,0x7A,0xE7,0x7A,0xE8,0x7B,0x28,0x7B,0x49,0x80,0x83,0x6A,0x01,0x83,
+    0x8A,0x83,0x6B,0x84,0x83,0x8B,0x00,0x83,0x8C,0x80,0x83,0xAC,0x85,0x83,0xCC,0x86,
+    0x83,0xCD,0x83,0x83,0xCC,0x80,0x8B,0xED,0x01,0x5A,0xA9,0x62,0xC9,0x80,0x62,0xEA,
+    0x00,0x6B,0x0B,0x82,0x6B,0x2B,0x86,0x6B,0x4B,0x83,0x6B,0x4C,0x86,0x6B,0x4B,0x00,
+    0x73,0x4B,0x80,0x73,0x2B,0x03,0x7B,0x4A,0x8B,0xAB,0x9C,0x2C,0xAC,0x8D,0x81,0xB4,
+    0x8D,0x03,0xAC,0x4C,0x9B,0xEA,0x93,0x89,0x93,0x68,0x80,0x8B,0x68,0x80,0x93,0xA9,
+    0x80,0x93,0xCA,0x80,0x9B,0xEB,0x88,0x9C,0x0B,0x80,0x9B,0xEB,0x00,0x9B,0xCB,0x80,
+    0x9B,0xCA,0x02,0x93,0xCA,0x93,0xAA,0x93,0x89,0x80,0x8B,0x89,0x81,0x93,0x89,0x01,
+    0x93,0xA9,0x93,0xAA,0x80,0x93,0xCA,0x80,0x93,0xAA,0x05,0x93,0x89,0x8B,0x69,0x8B,
+    0x48,0x83,0x48,0x83,0x07,0x7B,0x07,0x81,0x7A,0xE7,0x80,0x72,0xC7,0x02,0x72,0xE7,
+    0x7B,0x28,0x7B,0x49,0x80,0x83,0x6A,0x00,0x83,0x6B,0x81,0x83,0x8B,0x00,0x83,0x8C,
+    0x82,0x83,0xAC,0x00,0x83,0xCC,0x80,0x8B,0xCC,0x80,0x83,0xCC,0x80,0x8B,0xCC,0x80,
+    0x83,0xCC,0x84,0x8B,0xCD,0x82,0x83,0xCC,0x00,0x8B,0xCD,0x80,0x8B,0xED,0x04,0x62,
+    0xAA,0x62,0xCA,0x62,0xEA,0x63,0x0A,0x6B,0x0B,0x80,0x6B,0x2B,0x00,0x73,0x4B,0x87,
+    0x6B,0x4B,0x85,0x6B,0x4C,0x83,0x6B,0x4B,0x80,0x73,0x4B,0x80,0x73,0x2B,0x03,0x7B,
+    0x6A,0x93,0xEB,0xA4,0x6C,0xB4,0xAD,0x81,0xBC,0xCD,0x03,0xB4,0x8C,0xAC,0x2B,0x9B,
+    0xCA,0x93,0x89,0x80,0x8B,0x88,0x00,0x93,0xA9,0x80,0x93,0xC9,0x00,0x93,0xCA,0x82,
+    0x9C,0x0B,0x82,0xA4,0x0B,0x82,0x9C,0x0B,0x81,0x9B,0xEB,0x04,0x9B,0xEA,0x9B,0xCA,
+    0x93,0xCA,0x93,0xAA,0x93,0xA9,0x80,0x8B,0x89,0x80,0x93,0x89,0x83,0x93,0xA9,0x02,
+    0x93,0x89,0x8B,0x89,0x8B,0x68,0x80,0x83,0x28,0x80,0x83,0x07,0x00,0x7B,0x06,0x81,
+    0x7A,0xE6,0x00,0x72,0xA6,0x80,0x62,0x65,0x02,0x6A,0xA6,0x72,0xE7,0x7B,0x49,0x80,
+    0x83,0x6A,0x80,0x83,0x6B,0x80,0x83,0x8B,0x02,0x83,0x8C,0x8B,0xAC,0x83,0xAC,0x86,
+    0x8B,0xCC,0x81,0x8B,0xCD,0x83,0x8B,0xED,0x01,0x8B,0xCD,0x83,0xCC,0x80,0x8B,0xCD,
+    0x80,0x8B,0xED,0x05,0x8C,0x0D,0x62,0xAA,0x62,0xCA,0x63,0x0A,0x6B,0x0B,0x6B,0x2B,
+    0x80,0x6B,0x4B,0x01,0x73,0x4C,0x6B,0x4B,0x89,0x6B,0x6C,0x83,0x6B,0x4C,0x82,0x6B,
+    0x4B,0x82,0x73,0x4B,0x03,0x83,0x8A,0x9C,0x2C,0xAC,0xAD,0xB4,0xCE,0x80,0xC5,0x0E,
+    0x08,0xC4,0xEE,0xBC,0xCD,0xB4,0x8C,0xA4,0x2B,0x9B,0xC9,0x93,0xA9,0x93,0x89,0x93,
+    0xA9,0x93,0xC9,0x80,0x9B,0xEA,0x80,0xA4,0x0B,0x82,0xA4,0x2B,0x83,0xA4,0x2C,0x81,
+    0xA4,0x0B,0x05,0xA3,0xEB,0x9B,0xEB,0x9B,0xEA,0x9B,0xCA,0x93,0xAA,0x93,0xA9,0x80,
+    0x8B,0x89,0x00,0x93,0x89,0x82,0x93,0xA9,0x04,0x93,0x89,0x8B,0x69,0x8B,0x68,0x8B,
+    0x48,0x83,0x48,0x82,0x83,0x27,0x81,0x7A,0xE6,0x02,0x7A,0xC6,0x72,0xC6,0x6A,0x85,
+    0x80,0x62,0x65,0x02,0x6A,0x86,0x72,0xE7,0x7B,0x29,0x80,0x83,0x4A,0x00,0x83,0x6B,
+    0x80,0x83,0x8B,0x01,0x83,0x8C,0x83,0xAC,0x80,0x8B,0xAC,0x85,0x8B,0xCC,0x00,0x8B,
+    0xCD,0x8A,0x8B,0xED,0x80,0x8C,0x0D,0x04,0x62,0xCA,0x62,0xEA,0x6B,0x2B,0x6B,0x4B,
+    0x6B,0x4C,0x81,0x73,0x4C,0x8F,0x73,0x6C,0x81,0x6B,0x4B,0x82,0x73,0x4B,0x13,0x7B,
+    0x6B,0x8B,0xAB,0xA4,0x4C,0xB4,0xCD,0xBD,0x0F,0xCD,0x2F,0xCD,0x0F,0xCD,0x0E,0xC5,
+    0x0E,0xC4,0xCD,0xB4,0x8C,0xAC,0x2B,0x9B,0xE9,0x9B,0xC9,0x9B,0xE9,0x9B,0xEA,0xA4,
+    0x0B,0xA4,0x2B,0xAC,0x2B,0xAC,0x4B,0x82,0xAC,0x4C,0x00,0xAC,0x4D,0x82,0xAC,0x6D,
+    0x00,0xAC,0x4C,0x80,0xA4,0x4C,0x07,0xA4,0x2C,0xA4,0x2B,0x9C,0x0B,0x9B,0xEB,0x93,
+    0xCA,0x93,0xAA,0x93,0xA9,0x8B,0x89,0x80,0x93,0xA9,0x80,0x93,0x89,0x02,0x93,0x88,
+    0x8B,0x68,0x8B,0x48,0x85,0x83,0x27,0x02,0x82,0xE6,0x7A,0xC6,0x7A,0xC5,0x80,0x7A,
+    0xC6,0x09,0x72,0xA5,0x62,0x65,0x62,0x45,0x6A,0x65,0x6A,0xA6,0x72,0xC7,0x7B,0x08,
+    0x7B,0x29,0x83,0x4A,0x83,0x6B,0x80,0x83,0x8B,0x00,0x83,0xAB,0x80,0x8B,0xAC,0x80,
+    0x8B,0xCC,0x00,0x8B,0xCD,0x80,0x8B,0xCC,0x02,0x8B,0xCD,0x8B,0xCC,0x8B,0xCD,0x8A,
+    0x8B,0xED,0x04,0x8C,0x0D,0x94,0x0D,0x62,0xCA,0x63,0x0A,0x6B,0x6C,0x83,0x73,0x6C,
+    0x00,0x73,0x8C,0x92,0x73,0x6C,0x07,0x73,0x6B,0x73,0x4C,0x73,0x4B,0x7B,0x6B,0x8B,
+    0xCB,0xA4,0x4C,0xB4,0xCE,0xC5,0x0F,0x82,0xCD,0x2F,0x03,0xC5,0x0E,0xBC,0xCD,0xB4,
+    0x8C,0xAC,0x2A,0x80,0xA4,0x0A,0x02,0xA4,0x2B,0xA4,0x4B,0xAC,0x4B,0x81,0xAC,0x6C,
+    0x00,0xB4,0x6D,0x81,0xB4,0x8D,0x81,0xB4,0xAE,0x80,0xB4,0x8D,0x80,0xAC,0x8D,0x05,
+    0xAC,0x6D,0xA4,0x4C,0xA4,0x2B,0x9C,0x0B,0x9B,0xEA,0x93,0xCA,0x80,0x93,0xA9,0x00,
+    0x8B,0x89,0x80,0x93,0x89,0x80,0x8B,0x68,0x00,0x8B,0x47,0x83,0x83,0x27,0x81,0x8B,
+    0x47,0x00,0x83,0x06,0x82,0x7A,0xE6,0x02,0x72,0xA6,0x6A,0x65,0x6A,0x45,0x80,0x6A,
+    0x65,0x08,0x72,0xA6,0x72,0xE7,0x7B,0x08,0x83,0x29,0x83,0x6A,0x83,0x8A,0x8B,0x8B,
+    0x8B,0xAB,0x8B,0xAC,0x81,0x8B,0xCC,0x00,0x8B,0xCD,0x80,0x8B,0xCC,0x00,0x8B,0xCD,
+    0x80,0x8B,0xEC,0x8A,0x8B,0xED,0x80,0x94,0x0D,0x02,0x62,0xCA,0x6B,0x2B,0x73,0x6C,
+    0x8B,0x73,0x8C,0x00,0x73,0x6C,0x8A,0x73,0x8C,0x07,0x73,0x6B,0x73,0x6C,0x7B,0x6C,
+    0x83,0x8B,0x93,0xEB,0xA4,0x6C,0xBC,0xEE,0xCD,0x2F,0x82,0xCD,0x4F,0x03,0xCD,0x2E,
+    0xC5,0x0D,0xBC,0xCD,0xB4,0x8C,0x81,0xAC,0x4B,0x80,0xAC,0x6B,0x03,0xB4,0x6C,0xB4,
+    0x8C,0xB4,0x8D,0xB4,0xAD,0x85,0xBC,0xCE,0x80,0xB4,0xAE,0x09,0xB4,0xAD,0xB4,0x8D,
+    0xAC,0x6C,0xA4,0x4C,0xA4,0x2B,0x9B,0xEB,0x9B,0xCA,0x93,0xAA,0x93,0xA9,0x8B,0x89,
+    0x80,0x8B,0x68,0x80,0x8B,0x48,0x00,0x8B,0x27,0x80,0x83,0x27,0x02,0x8B,0x27,0x8B,
+    0x47,0x8B,0x48,0x80,0x8B,0x68,0x07,0x93,0x68,0x8B,0x27,0x82,0xE6,0x83,0x06,0x83,
+    0x07,0x83,0x27,0x7A,0xE6,0x72,0x85,0x81,0x6A,0x65,0x08,0x72,0xA6,0x7A,0xC7,0x7A,
+    0xE8,0x7B,0x08,0x83,0x49,0x8B,0x6A,0x8B,0x8B,0x8B,0xAB,0x8B,0xAC,0x81,0x8B,0xCC,
+    0x82,0x8B,0xCD,0x82,0x8B,0xED,0x81,0x8C,0x0D,0x02,0x8B,0xED,0x8C,0x0D,0x8B,0xED,
+    0x81,0x8C,0x0D,0x80,0x94,0x0D,0x04,0x94,0x2D,0x62,0xEA,0x6B,0x2B,0x73,0x8C,0x73,
+    0x8D,0x80,0x7B,0xAD,0x00,0x73,0x8D,0x95,0x73,0x8C,0x06,0x73,0x6C,0x7B,0x8C,0x8B,
+    0xAB,0x9C,0x0C,0xAC,0x8C,0xBC,0xCD,0xCD,0x2F,0x81,0xD5,0x4F,0x05,0xD5,0x6F,0xD5,
+    0x4F,0xCD,0x4E,0xC5,0x0D,0xBC,0xCC,0xBC,0xAC,0x83,0xB4,0x8C,0x03,0xBC,0xAD,0xBC,
+    0xCD,0xBC,0xEE,0xC5,0x0F,0x82,0xC5,0x2F,0x80,0xC5,0x0F,0x0C,0xBC,0xEF,0xBC,0xEE,
+    0xBC,0xCE,0xB4,0xAD,0xAC,0x6D,0xAC,0x4C,0xA4,0x2B,0xA4,0x0B,0x9B,0xCA,0x93,0xAA,
+    0x93,0x89,0x8B,0x69,0x8B,0x68,0x82,0x8B,0x48,0x80,0x8B,0x47,0x00,0x8B,0x48,0x81,
+    0x93,0x68,0x80,0x93,0x88,0x06,0x8B,0x47,0x8B,0x06,0x8B,0x27,0x8B,0x47,0x8B,0x48,
+    0x83,0x27,0x7A,0xC6,0x80,0x72,0x85,0x06,0x72,0x65,0x72,0xA6,0x7A,0xC6,0x7A,0xE7,
+    0x83,0x08,0x83,0x49,0x8B,0x6A,0x80,0x8B,0x8B,0x00,0x8B,0xAB,0x81,0x8B,0xCC,0x81,
+    0x8B,0xCD,0x81,0x8B,0xED,0x00,0x8C,0x0D,0x84,0x94,0x0D,0x00,0x8C,0x0D,0x81,0x94,
+    0x0D,0x00,0x94,0x0E,0x80,0x94,0x2E,0x03,0x62,0xEA,0x6B,0x4B,0x73,0xAD,0x7B,0xAD,
+    0x80,0x7B,0xCD,0x00,0x7B,0xAD,0x81,0x73,0xAD,0x01,0x73,0x8C,0x73,0x8D,0x81,0x73,
+    0x8C,0x00,0x73,0xAD,0x8D,0x73,0x8C,0x06,0x83,0xAC,0x93,0xCC,0xA4,0x2C,0xAC,0x8C,
+    0xBC,0xCC,0xCD,0x2E,0xD5,0x4F,0x82,0xD5,0x6F,0x03,0xD5,0x4F,0xCD,0x4E,0xC5,0x0D,
+    0xBC,0xCC,0x80,0xBC,0xAC,0x00,0xB4,0xAC,0x80,0xBC,0xAC,0x80,0xBC,0xCD,0x01,0xC4,
+    0xEE,0xC5,0x2F,0x81,0xCD,0x50,0x00,0xCD,0x70,0x80,0xCD,0x50,0x0B,0xC5,0x2F,0xC5,
+    0x0F,0xBC,0xEE,0xB4,0xAE,0xB4,0x8D,0xAC,0x4C,0xA4,0x2B,0xA4,0x0B,0x9B,0xEA,0x93,
+    0xAA,0x93,0x89,0x93,0x69,0x85,0x93,0x68,0x80,0x93,0x88,0x82,0x9B,0xA9,0x12,0x93,
+    0x68,0x8B,0x27,0x93,0x47,0x93,0x68,0x93,0x89,0x8B,0x68,0x82,0xE6,0x7A,0xC6,0x7A,
+    0xA5,0x7A,0x85,0x7A,0xA6,0x7A,0xC6,0x7A,0xE7,0x83,0x28,0x8B,0x49,0x8B,0x69,0x8B,
+    0x6A,0x8B,0x8B,0x8B,0xAB,0x81,0x8B,0xCC,0x00,0x93,0xCD,0x80,0x8B,0xCD,0x80,0x8B,
+    0xED,0x00,0x8C,0x0D,0x83,0x94,0x0D,0x80,0x94,0x0E,0x80,0x94,0x0D,0x80,0x94,0x0E,
+    0x81,0x94,0x2E,0x01,0x63,0x0A,0x6B,0x6C,0x80,0x7B,0xCD,0x80,0x7B,0xEE,0x80,0x7B,
+    0xCD,0x00,0x7B,0xAD,0x81,0x73,0xAD,0x80,0x73,0x8D,0x80,0x73,0xAD,0x8B,0x73,0x8D,
+    0x09,0x73,0xAC,0x7B,0xAC,0x83,0xCD,0x94,0x0C,0xA4,0x2C,0xAC,0x8C,0xBC,0xCC,0xCD,
+    0x2E,0xD5,0x4F,0xD5,0x6F,0x80,0xDD,0x6F,0x81,0xD5,0x6F,0x02,0xCD,0x2E,0xC4,0xED,
+    0xC4,0xEC,0x81,0xBC,0xCC,0x80,0xBC,0xAC,0x02,0xBC,0xCD,0xC4,0xEE,0xCD,0x2F,0x81,
+    0xCD,0x70,0x0C,0xCD,0x71,0xCD,0x70,0xD5,0x90,0xCD,0x71,0xCD,0x70,0xC5,0x30,0xC5,
+    0x0F,0xBC,0xCE,0xB4,0x8D,0xAC,0x6C,0xA4,0x2B,0xA3,0xEB,0x9B,0xCA,0x80,0x93,0x89,
+    0x81,0x93,0x68,0x80,0x93,0x88,0x01,0x93,0x89,0x9B,0x89,0x80,0x9B,0xA9,0x00,0x9B,
+    0xC9,0x80,0xA3,0xEA,0x08,0xA3,0xC9,0x9B,0x88,0x93,0x48,0x9B,0x88,0x9B,0xA9,0x9B,
+    0xCA,0x93,0x88,0x8B,0x27,0x82,0xE6,0x81,0x7A,0xA6,0x08,0x7A,0xC6,0x82,0xE7,0x83,
+    0x28,0x8B,0x49,0x8B,0x69,0x8B,0x6A,0x8B,0x8A,0x8B,0xAB,0x8B,0xAC,0x80,0x8B,0xCC,
+    0x00,0x93,0xCD,0x80,0x8B,0xCD,0x01,0x8B,0xED,0x93,0xED,0x83,0x94,0x0D,0x84,0x94,
+    0x0E,0x82,0x94,0x2E,0x02,0x63,0x0B,0x73,0x8C,0x7B,0xCD,0x82,0x7B,0xEE,0x80,0x7B,
+    0xCD,0x92,0x73,0xAD,0x08,0x73,0xAC,0x7B,0xCC,0x8B,0xED,0x9C,0x0D,0xA4,0x4C,0xAC,
+    0x8C,0xB4,0xAC,0xCD,0x0E,0xD5,0x4F,0x81,0xDD,0x6F,0x81,0xD5,0x6F,0x02,0xD5,0x4F,
+    0xCD,0x2E,0xCD,0x0D,0x80,0xC5,0x0D,0x00,0xC4,0xED,0x81,0xBC,0xCD,0x01,0xC5,0x0E,
+    0xCD,0x4F,0x80,0xCD,0x70,0x00,0xD5,0x90,0x80,0xD5,0x91,0x80,0xD5,0xB1,0x0C,0xD5,
+    0x91,0xCD,0x70,0xCD,0x4F,0xC5,0x0F,0xBC,0xEE,0xB4,0xAD,0xAC,0x4C,0xA4,0x0B,0x9B,
+    0xEA,0x9B,0xAA,0x93,0xA9,0x9B,0xA9,0x9B,0x89,0x80,0x9B,0xA9,0x81,0x9B,0xC9,0x08,
+    0xA3,0xCA,0xA3,0xEA,0xA4,0x0A,0xAC,0x0A,0xA4,0x0A,0xA3,0xEA,0x9B,0xA9,0x9B,0x89,
+    0xA3,0xCA,0x80,0xA3,0xEA,0x02,0x9B,0xA9,0x8B,0x27,0x82,0xE7,0x80,0x7A,0xC6,0x0E,
+    0x7A,0xA6,0x82,0xC6,0x82,0xE7,0x8B,0x08,0x8B,0x48,0x8B,0x69,0x93,0x69,0x93,0x8A,
+    0x93,0xAA,0x8B,0xAB,0x8B,0xCC,0x93,0xCC,0x93,0xCD,0x8B,0xCD,0x93,0xCD,0x80,0x93,
+    0xED,0x83,0x94,0x0D,0x83,0x94,0x0E,0x83,0x94,0x2E,0x03,0x63,0x2B,0x73,0x8C,0x7B,
+    0xCE,0x7B,0xEE,0x80,0x84,0x0E,0x00,0x7B,0xEE,0x81,0x7B,0xCE,0x86,0x73,0xAD,0x81,
+    0x73,0xCD,0x85,0x73,0xCE,0x0B,0x73,0xCD,0x7B,0xCD,0x7B,0xCC,0x8C,0x0D,0x9C,0x2D,
+    0xA4,0x4C,0xAC,0x8C,0xB4,0xAC,0xCD,0x0D,0xD5,0x4F,0xD5,0x6F,0xDD,0x8F,0x80,0xDD,
+    0x6F,0x81,0xD5,0x6F,0x80,0xD5,0x4E,0x0A,0xCD,0x4E,0xCD,0x2E,0xCD,0x0D,0xC5,0x0D,
+    0xC4,0xED,0xC5,0x0E,0xCD,0x2E,0xCD,0x4F,0xD5,0x70,0xD5,0x90,0xD5,0x91,0x83,0xD5,
+    0xB1,0x07,0xCD,0x70,0xCD,0x4F,0xC5,0x2F,0xC4,0xEE,0xBC,0xCD,0xB4,0x6C,0xAC,0x4C,
+    0xA4,0x0B,0x84,0xA3,0xEA,0x01,0xA4,0x0A,0xAC,0x0A,0x80,0xAC,0x2B,0x81,0xAC,0x4B,
+    0x01,0xAC,0x2B,0xA3,0xEA,0x80,0xA3,0xC9,0x05,0xAC,0x0A,0xAC,0x0B,0xAC,0x0A,0x9B,
+    0xC9,0x8B,0x47,0x8B,0x07,0x82,0x82,0xC6,0x03,0x82,0xE7,0x8B,0x07,0x8B,0x48,0x93,
+    0x69,0x80,0x93,0x89,0x04,0x93,0x8A,0x93,0xAB,0x8B,0xAC,0x93,0xCC,0x93,0xCD,0x80,
+    0x8B,0xCD,0x01,0x93,0xED,0x8B,0xED,0x83,0x94,0x0D,0x83,0x94,0x0E,0x83,0x94,0x2E,
+    0x03,0x6B,0x2B,0x73,0x8D,0x7B,0xEE,0x84,0x0E,0x80,0x84,0x2F,0x00,0x84,0x0F,0x80,
+    0x7B,0xEE,0x82,0x7B,0xCE,0x81,0x7B,0xAE,0x00,0x7B,0xCE,0x82,0x73,0xCE,0x86,0x7B,
+    0xCE,0x80,0x7B,0xED,0x06,0x8C,0x2D,0x9C,0x4D,0xA4,0x6C,0xAC,0xAC,0xB4,0xCC,0xCD,
+    0x0D,0xCD,0x2E,0x80,0xD5,0x6F,0x02,0xDD,0x6F,0xD5,0x6F,0xDD,0x6F,0x81,0xD5,0x6F,
+    0x80,0xD5,0x4F,0x80,0xD5,0x4E,0x80,0xD5,0x2E,0x81,0xD5,0x4F,0x02,0xD5,0x70,0xD5,
+    0x90,0xD5,0xB1,0x80,0xDD,0xB1,0x80,0xDD,0xD1,0x0A,0xDD,0xB1,0xD5,0x90,0xD5,0x70,
+    0xCD,0x4F,0xC5,0x0E,0xC4,0xCE,0xBC,0x8D,0xB4,0x6C,0xAC,0x4B,0xAC,0x0B,0xA4,0x0A,
+    0x81,0xAC,0x0A,0x01,0xAC,0x0B,0xAC,0x2B,0x80,0xB4,0x4B,0x05,0xB4,0x4C,0xB4,0x6C,
+    0xB4,0x4C,0xB4,0x4B,0xAC,0x2B,0xA4,0x0A,0x80,0xA3,0xEA,0x81,0xAC,0x2B,0x02,0xA3,
+    0xE9,0x93,0x67,0x8B,0x27,0x80,0x82,0xE6,0x80,0x82,0xC6,0x03,0x82,0xE7,0x8B,0x07,
+    0x8B,0x48,0x93,0x68,0x80,0x93,0x89,0x02,0x93,0xA9,0x93,0xAA,0x93,0xAB,0x81,0x93,
+    0xCC,0x00,0x93,0xEC,0x80,0x8B,0xEC,0x01,0x94,0x0D,0x94,0x0C,0x80,0x94,0x0D,0x84,
+    0x94,0x0E,0x83,0x94,0x2E,0x02,0x6B,0x2B,0x73,0xAD,0x83,0xEE,0x81,0x84,0x2F,0x80,
+    0x84,0x0F,0x81,0x7B,0xEF,0x00,0x7B,0xEE,0x8A,0x7B,0xCE,0x84,0x7B,0xEE,0x08,0x83,
+    0xED,0x94,0x4E,0x9C,0x6E,0xAC,0x8D,0xB4,0xAC,0xBC,0xCC,0xC4,0xED,0xCD,0x0E,0xD5,
+    0x4E,0x81,0xD5,0x4F,0x81,0xD5,0x6F,0x83,0xDD,0x6F,0x82,0xD5,0x6F,0x04,0xDD,0x70,
+    0xDD,0x90,0xDD,0xB0,0xDD,0xB1,0xDD,0xD1,0x80,0xDD,0xF1,0x0A,0xDD,0xF2,0xDD,0xF1,
+    0xDD,0xD1,0xDD,0xB1,0xD5,0x90,0xD5,0x4F,0xCD,0x0E,0xC4,0xCD,0xBC,0xAD,0xBC,0x8C,
+    0xB4,0x6C,0x81,0xB4,0x4C,0x04,0xB4,0x6C,0xBC,0x6C,0xBC,0x8C,0xBC,0x8D,0xBC,0xAD,
+    0x80,0xBC,0x8C,0x05,0xB4,0x6C,0xB4,0x4B,0xAC,0x2B,0xA4,0x0A,0xA3,0xEA,0xAC,0x0A,
+    0x80,0xAC,0x2B,0x04,0xAC,0x0A,0xA3,0xE9,0x9B,0x88,0x93,0x68,0x8B,0x07,0x81,0x8A,
+    0xE6,0x03,0x8B,0x07,0x8B,0x27,0x8B,0x48,0x93,0x68,0x80,0x93,0x89,0x03,0x93,0xA9,
+    0x93,0xAA,0x93,0xAB,0x93,0xCB,0x80,0x93,0xCC,0x80,0x93,0xEC,0x00,0x8B,0xEC,0x82,
+    0x94,0x0D,0x85,0x94,0x0E,0x82,0x94,0x2E,0x05,0x6B,0x2B,0x73,0xAD,0x84,0x0E,0x84,
+    0x2F,0x8C,0x4F,0x8C,0x50,0x80,0x84,0x2F,0x01,0x84,0x0F,0x7C,0x0F,0x80,0x7B,0xEF,
+    0x8B,0x7B,0xEE,0x00,0x7B,0xEF,0x81,0x7C,0x0F,0x09,0x7B,0xEE,0x84,0x0D,0x94,0x4E,
+    0x9C,0x6E,0xAC,0xAD,0xB4,0xCD,0xBC,0xCC,0xC4,0xCD,0xCC,0xED,0xCD,0x0E,0x80,0xD5,
+    0x2E,0x81,0xD5,0x4E,0x84,0xDD,0x6F,0x80,0xDD,0x8F,0x03,0xDD,0x90,0xDD,0xB0,0xE5,
+    0xB0,0xE5,0xD1,0x80,0xE5,0xF1,0x84,0xE6,0x12,0x04,0xE5,0xF1,0xDD,0xD1,0xDD,0x90,
+    0xD5,0x4F,0xCD,0x2E,0x80,0xCD,0x0E,0x00,0xC4,0xED,0x82,0xC4,0xCD,0x07,0xCC,0xCD,
+    0xCC,0xED,0xCC,0xEE,0xC4,0xED,0xC4,0xAD,0xBC,0x8C,0xB4,0x6C,0xB4,0x4B,0x81,0xAC,
+    0x0A,0x07,0xAC,0x2B,0xB4,0x4B,0xB4,0x2B,0xAC,0x0A,0xA3,0xC9,0x9B,0x88,0x9B,0x68,
+    0x93,0x27,0x82,0x8B,0x07,0x08,0x8B,0x27,0x8B,0x47,0x93,0x68,0x93,0x88,0x93,0xA9,
+    0x9B,0xA9,0x93,0xAA,0x93,0xAB,0x93,0xCB,0x80,0x93,0xCC,0x81,0x93,0xEC,0x81,0x94,
+    0x0D,0x86,0x94,0x0E,0x82,0x94,0x2E,0x03,0x6B,0x2B,0x73,0xAD,0x84,0x0E,0x84,0x4F,
+    0x80,0x8C,0x70,0x02,0x8C,0x50,0x84,0x4F,0x84,0x2F,0x80,0x84,0x0F,0x00,0x7C,0x0F,
+    0x87,0x7B,0xEF,0x86,0x7C,0x0F,0x06,0x7C,0x0E,0x84,0x0E,0x94,0x6E,0xA4,0x8E,0xAC,
+    0xCE,0xBC,0xED,0xBC,0xCC,0x80,0xC4,0xCC,0x06,0xC4,0xED,0xCC,0xED,0xD4,0xED,0xD5,
+    0x2E,0xD5,0x4E,0xDD,0x4E,0xDD,0x6E,0x83,0xDD,0x6F,0x81,0xDD,0x8F,0x02,0xE5,0xB0,
+    0xE5,0xD0,0xE5,0xD1,0x81,0xE5,0xF1,0x84,0xE6,0x11,0x02,0xE5,0xF1,0xE5,0xD0,0xDD,
+    0x90,0x80,0xD5,0x6F,0x80,0xD5,0x4F,0x83,0xD5,0x2E,0x06,0xD5,0x0E,0xCD,0x0E,0xCC,
+    0xEE,0xC4,0xCD,0xBC,0x8C,0xB4,0x4B,0xAC,0x2A,0x80,0xAC,0x0A,0x08,0xB4,0x4B,0xB4,
+    0x6C,0xBC,0x6C,0xB4,0x4B,0xAC,0x0A,0xAB,0xEA,0xA3,0xA9,0x9B,0xA9,0x9B,0x68,0x81,
+    0x93,0x27,0x80,0x8B,0x27,0x01,0x93,0x47,0x93,0x88,0x82,0x9B,0xA9,0x00,0x9B,0xCA,
+    0x80,0x93,0xCB,0x81,0x93,0xEC,0x00,0x94,0x0C,0x80,0x94,0x0D,0x01,0x94,0x0E,0x93,
+    0xEE,0x85,0x94,0x0E,0x81,0x94,0x2E,0x04,0x9C,0x2E,0x6B,0x2B,0x73,0xAD,0x84,0x2F,
+    0x8C,0x6F,0x81,0x8C,0x70,0x02,0x8C,0x50,0x84,0x4F,0x84,0x2F,0x80,0x84,0x0F,0x8F,
+    0x7C,0x0F,0x07,0x7C,0x0E,0x84,0x0E,0x94,0x6E,0xA4,0x8E,0xB4,0xEE,0xBD,0x0D,0xBC,
+    0xEC,0xC4,0xCC,0x80,0xC4,0xAC,0x05,0xC4,0xCC,0xCC,0xCD,0xD5,0x0D,0xD5,0x2D,0xD5,
+    0x2E,0xDD,0x4E,0x80,0xDD,0x6F,0x80,0xE5,0x6F,0x81,0xDD,0x8F,0x01,0xE5,0x8F,0xE5,
+    0x90,0x80,0xE5,0xB0,0x83,0xE5,0xD0,0x83,0xE5,0xF1,0x01,0xE5,0xD0,0xDD,0xB0,0x80,
+    0xDD,0x8F,0x02,0xDD,0x6F,0xD5,0x6F,0xD5,0x4F,0x80,0xD5,0x4E,0x81,0xD5,0x2E,0x07,
+    0xCD,0x0E,0xCD,0x0D,0xC4,0xCD,0xBC,0x8C,0xB4,0x4B,0xB4,0x2B,0xAC,0x2A,0xB4,0x4B,
+    0x80,0xBC,0x8C,0x01,0xBC,0xAC,0xBC,0x6B,0x80,0xAC,0x0A,0x03,0xA3,0xC9,0xA3,0xA9,
+    0x9B,0x88,0x93,0x48,0x80,0x93,0x47,0x04,0x93,0x27,0x93,0x47,0x93,0x68,0x9B,0x88,
+    0x9B,0xA9,0x81,0x9B,0xC9,0x80,0x9B,0xCA,0x00,0x9B,0xCB,0x81,0x93,0xEC,0x80,0x94,
+    0x0D,0x87,0x94,0x0E,0x00,0x94,0x2E,0x82,0x9C,0x2E,0x04,0x6B,0x4C,0x7B,0xCD,0x84,
+    0x4F,0x8C,0x70,0x8C,0x90,0x81,0x8C,0x70,0x03,0x84,0x50,0x84,0x4F,0x84,0x2F,0x84,
+    0x0F,0x90,0x7C,0x0F,0x07,0x84,0x0E,0x94,0x6E,0xA4,0xAF,0xB4,0xEF,0xBD,0x2E,0xC5,
+    0x0D,0xC4,0xED,0xC4,0xCC,0x80,0xC4,0xAC,0x04,0xCC,0xCC,0xD4,0xEC,0xD4,0xED,0xD5,
+    0x0D,0xDD,0x2E,0x80,0xDD,0x4E,0x84,0xE5,0x6F,0x80,0xE5,0x8F,0x80,0xE5,0xB0,0x80,
+    0xDD,0xAF,0x00,0xDD,0x8F,0x80,0xDD,0xAF,0x80,0xDD,0xB0,0x02,0xE5,0xB0,0xE5,0xAF,
+    0xDD,0xAF,0x80,0xDD,0x8F,0x80,0xDD,0x6F,0x01,0xD5,0x6F,0xD5,0x4F,0x80,0xD5,0x4E,
+    0x81,0xD5,0x2E,0x04,0xCD,0x0E,0xCC,0xED,0xC4,0xCD,0xBC,0x8C,0xB4,0x6B,0x80,0xB4,
+    0x4B,0x00,0xBC,0x8C,0x81,0xC4,0xCD,0x07,0xC4,0xAC,0xB4,0x4B,0xB4,0x2B,0xAB,0xEA,
+    0xA3,0xC9,0x9B,0x89,0x9B,0x68,0x93,0x48,0x80,0x93,0x47,0x03,0x93,0x67,0x9B,0x88,
+    0x9B,0xA8,0xA3,0xA9,0x81,0xA3,0xC9,0x01,0x9B,0xC9,0x9B,0xCA,0x80,0x9B,0xCB,0x80,
+    0x93,0xEC,0x80,0x93,0xED,0x87,0x94,0x0E,0x00,0x94,0x2E,0x82,0x9C,0x2E,0x02,0x6B,
+    0x4C,0x7B,0xCD,0x84,0x4F,0x81,0x8C,0x90,0x81,0x8C,0x70,0x02,0x84,0x50,0x84,0x4F,
+    0x84,0x2F,0x90,0x7C,0x0F,0x06,0x84,0x0E,0x94,0x4E,0xA4,0xAE,0xB5,0x0F,0xBD,0x2E,
+    0xC5,0x2D,0xCC,0xED,0x80,0xC4,0xCC,0x80,0xCC,0xAC,0x00,0xCC,0xCC,0x80,0xD4,0xEC,
+    0x80,0xD5,0x0D,0x00,0xDD,0x2D,0x80,0xDD,0x2E,0x82,0xDD,0x4E,0x01,0xDD,0x6F,0xE5,
+    0x6F,0x80,0xE5,0x8F,0x00,0xE5,0xAF,0x88,0xDD,0x8F,0x81,0xDD,0x6F,0x80,0xD5,0x6F,
+    0x81,0xD5,0x4E,0x09,0xD5,0x2E,0xCD,0x0E,0xCD,0x0D,0xC4,0xCD,0xC4,0xAC,0xBC,0x8C,
+    0xBC,0x6B,0xBC,0x8C,0xBC,0xAC,0xC4,0xED,0x80,0xCC,0xED,0x08,0xC4,0xED,0xC4,0xCD,
+    0xBC,0x8C,0xB4,0x4B,0xAC,0x0A,0xAB,0xEA,0xA3,0xA9,0xA3,0x89,0x9B,0x48,0x80,0x93,
+    0x47,0x02,0x9B,0x68,0x9B,0x88,0xA3,0xA9,0x81,0xA3,0xC9,0x80,0xA3,0xE9,0x00,0x9B,
+    0xEA,0x80,0x9B,0xEB,0x01,0x9B,0xEC,0x93,0xEC,0x80,0x93,0xED,0x86,0x94,0x0E,0x80,
+    0x94,0x2E,0x82,0x9C,0x2E,0x02,0x6B,0x6C,0x7B,0xEE,0x84,0x4F,0x83,0x8C,0x90,0x03,
+    0x8C,0x70,0x84,0x70,0x84,0x50,0x84,0x2F,0x90,0x7C,0x0F,0x08,0x84,0x0E,0x8C,0x2E,
+    0xA4,0x8E,0xBD,0x0F,0xC5,0x4E,0xC5,0x2E,0xCD,0x0D,0xCC,0xED,0xCC,0xEC,0x83,0xCC,
+    0xCC,0x00,0xD4,0xEC,0x80,0xD4,0xED,0x83,0xD5,0x0D,0x05,0xDD,0x2D,0xDD,0x4E,0xDD,
+    0x6E,0xDD,0x6F,0xDD,0x8F,0xE5,0x8F,0x85,0xDD,0x8F,0x84,0xDD,0x6E,0x00,0xDD,0x4E,
+    0x82,0xD5,0x4E,0x03,0xD5,0x2E,0xCD,0x0D,0xCC,0xED,0xC4,0xAC,0x80,0xBC,0xAC,0x02,
+    0xBC,0x8C,0xC4,0xCD,0xCC,0xED,0x81,0xCD,0x0D,0x07,0xC4,0xED,0xC4,0xAD,0xBC,0x8C,
+    0xB4,0x4B,0xAC,0x0A,0xAB,0xEA,0xA3,0xC9,0xA3,0xA9,0x81,0x9B,0x68,0x01,0x9B,0x88,
+    0xA3,0xA9,0x81,0xA3,0xC9,0x05,0xAB,0xE9,0xA3,0xE9,0xA4,0x09,0xA3,0xEA,0x9B,0xEA,
+    0x9B,0xEB,0x80,0x9B,0xEC,0x80,0x93,0xED,0x85,0x94,0x0E,0x80,0x9C,0x0E,0x83,0x9C,
+    0x2E,0x02,0x6B,0x6C,0x7B,0xEE,0x84,0x4F,0x81,0x8C,0x90,0x80,0x8C,0x91,0x03,0x8C,
+    0x70,0x84,0x70,0x84,0x50,0x7C,0x2F,0x82,0x7C,0x0F,0x84,0x7B,0xEF,0x86,0x7C,0x0F,
+    0x05,0x83,0xEE,0x8C,0x0E,0x9C,0x8E,0xBD,0x0F,0xC5,0x4F,0xC5,0x4E,0x80,0xCD,0x2E,
+    0x00,0xD5,0x2E,0x80,0xD5,0x2D,0x02,0xD5,0x0D,0xD4,0xED,0xCC,0xEC,0x84,0xD4,0xEC,
+    0x00,0xD4,0xED,0x80,0xD5,0x0D,0x80,0xDD,0x4E,0x00,0xDD,0x6F,0x83,0xE5,0x8F,0x00,
+    0xDD,0x8F,0x80,0xDD,0x6E,0x00,0xDD,0x8E,0x80,0xDD,0x6E,0x84,0xDD,0x4E,0x80,0xD5,
+    0x4E,0x08,0xD5,0x2E,0xD5,0x0D,0xCC,0xED,0xC4,0xCD,0xC4,0xAC,0xBC,0x8C,0xBC,0xAC,
+    0xC4,0xCC,0xCC,0xED,0x82,0xCD,0x0E,0x03,0xC4,0xED,0xBC,0xAC,0xBC,0x6B,0xB4,0x2B,
+    0x80,0xAC,0x0A,0x01,0xAB,0xEA,0xA3,0xC9,0x81,0x9B,0x88,0x00,0x9B,0xA8,0x80,0xA3,
+    0xC9,0x80,0xAB,0xEA,0x81,0xAC,0x0A,0x02,0xA4,0x0A,0xA4,0x0B,0x9B,0xEB,0x80,0x9B,
+    0xEC,0x01,0x9B,0xED,0x94,0x0D,0x80,0x94,0x0E,0x01,0x9C,0x0E,0x94,0x0E,0x82,0x9C,
+    0x0E,0x83,0x9C,0x2E,0x03,0x9C,0x4F,0x6B,0x6C,0x7B,0xEE,0x84,0x4F,0x80,0x8C,0x90,
+    0x81,0x8C,0x91,0x03,0x8C,0x71,0x84,0x70,0x84,0x50,0x7C,0x2F,0x81,0x7C,0x0F,0x80,
+    0x7B,0xEF,0x80,0x7B,0xEE,0x01,0x73,0xEE,0x7B,0xEE,0x81,0x7B,0xEF,0x82,0x7C,0x0F,
+    0x06,0x74,0x0F,0x7C,0x0F,0x83,0xEE,0x8C,0x0D,0x9C,0x4D,0xB4,0xEE,0xC5,0x4F,0x80,
+    0xCD,0x4F,0x00,0xD5,0x6F,0x81,0xDD,0x8F,0x02,0xE5,0x8F,0xDD,0x6E,0xDD,0x2E,0x84,
+    0xD5,0x0D,0x06,0xD5,0x2D,0xDD,0x2D,0xDD,0x2E,0xDD,0x4E,0xDD,0x6F,0xE5,0x8F,0xE5,
+    0xAF,0x82,0xE5,0x8F,0x83,0xDD,0x6E,0x01,0xDD,0x4E,0xD5,0x0D,0x85,0xD5,0x2D,0x00,
+    0xCD,0x0D,0x80,0xCC,0xED,0x00,0xC4,0xCC,0x81,0xC4,0xAC,0x00,0xC4,0xED,0x80,0xCD,
+    0x2E,0x80,0xD5,0x2E,0x03,0xCD,0x0E,0xC4,0xAC,0xBC,0x6C,0xB4,0x4B,0x81,0xB4,0x2B,
+    0x07,0xAC,0x0A,0xA3,0xE9,0xA3,0xA9,0x9B,0x88,0x9B,0xA8,0xA3,0xA9,0xA3,0xC9,0xAB,
+    0xEA,0x81,0xAC,0x0A,0x81,0xAC,0x2A,0x03,0xA4,0x2B,0xA4,0x0B,0xA4,0x0C,0xA3,0xEC,
+    0x80,0x9C,0x0D,0x82,0x9C,0x0E,0x82,0x9C,0x2E,0x00,0x9C,0x2F,0x83,0x9C,0x4F,0x02,
+    0x6B,0x6C,0x7B,0xEE,0x84,0x4F,0x80,0x8C,0x90,0x01,0x8C,0x91,0x94,0x91,0x80,0x8C,
+    0x91,0x02,0x8C,0x70,0x84,0x50,0x84,0x2F,0x81,0x7C,0x0F,0x00,0x7B,0xEF,0x83,0x73,
+    0xEE,0x80,0x7B,0xEE,0x80,0x7B,0xEF,0x00,0x7C,0x0F,0x81,0x74,0x0F,0x08,0x7C,0x0F,
+    0x83,0xEE,0x83,0xED,0x94,0x2D,0xAC,0xAE,0xBD,0x2F,0xC5,0x4F,0xCD,0x6F,0xD5,0x8F,
+    0x80,0xDD,0xB0,0x81,0xE5,0xB0,0x80,0xE5,0x8F,0x00,0xE5,0x6F,0x82,0xDD,0x6E,0x00,
+    0xE5,0x6F,0x80,0xE5,0x8F,0x00,0xE5,0xAF,0x81,0xE5,0xB0,0x00,0xE5,0xAF,0x81,0xE5,
+    0x8F,0x00,0xE5,0x6F,0x81,0xDD,0x6E,0x01,0xDD,0x4E,0xD5,0x0D,0x82,0xCC,0xEC,0x81,
+    0xCC,0xCC,0x80,0xCC,0xEC,0x80,0xCC,0xED,0x00,0xCC,0xCC,0x80,0xC4,0xCC,0x02,0xC4,
+    0xED,0xCD,0x2E,0xD5,0x4E,0x80,0xD5,0x2E,0x04,0xCD,0x0E,0xC4,0xCD,0xBC,0xAC,0xBC,
+    0x8C,0xBC,0x6B,0x81,0xB4,0x6B,0x06,0xAC,0x0A,0xA3,0xE9,0xA3,0xA9,0x9B,0xA8,0xA3,
+    0xA9,0xA3,0xC9,0xA3,0xE9,0x80,0xAC,0x0A,0x00,0xAC,0x2A,0x80,0xB4,0x2A,0x00,0xB4,
+    0x2B,0x80,0xAC,0x2B,0x00,0xA4,0x2B,0x80,0xA4,0x0C,0x01,0x9C,0x0C,0x9C,0x2D,0x81,
+    0x9C,0x0E,0x81,0x9C,0x2E,0x02,0x9C,0x2F,0x9C,0x2E,0x9C,0x2F,0x83,0x9C,0x4F,0x04,
+    0x6B,0x6C,0x7B,0xCE,0x8C,0x4F,0x8C,0x90,0x94,0x90,0x80,0x94,0x91,0x80,0x8C,0x91,
+    0x01,0x8C,0x71,0x84,0x50,0x80,0x84,0x2F,0x80,0x7C,0x0F,0x00,0x73,0xEE,0x80,0x73,
+    0xCE,0x00,0x73,0xEE,0x80,0x73,0xCE,0x80,0x73,0xEE,0x01,0x73,0xEF,0x7B,0xEF,0x82,
+    0x74,0x0F,0x09,0x74,0x0E,0x7C,0x0E,0x84,0x0D,0x94,0x2D,0xAC,0xAE,0xBD,0x2F,0xC5,
+    0x4E,0xCD,0x6F,0xD5,0x8F,0xDD,0xB0,0x81,0xE5,0xD0,0x81,0xED,0xF1,0x80,0xED,0xF0,
+    0x81,0xE5,0xD0,0x00,0xED,0xD0,0x84,0xED,0xF0,0x01,0xED,0xD0,0xE5,0xB0,0x81,0xE5,
+    0x8F,0x04,0xE5,0x6E,0xDD,0x6E,0xDD,0x4E,0xDD,0x2D,0xD5,0x0D,0x81,0xD4,0xEC,0x83,
+    0xCC,0xCC,0x00,0xCC,0xEC,0x80,0xCC,0xED,0x02,0xCD,0x0D,0xD5,0x0D,0xD5,0x2E,0x82,
+    0xD5,0x4E,0x01,0xD5,0x2E,0xCC,0xED,0x80,0xC4,0xAC,0x00,0xC4,0xCD,0x80,0xC4,0xAC,
+    0x04,0xBC,0xAC,0xBC,0x8C,0xB4,0x2A,0xAB,0xE9,0xA3,0xC9,0x80,0xA3,0xA8,0x04,0xA3,
+    0xC9,0xAB,0xE9,0xAC,0x0A,0xAC,0x2A,0xB4,0x2A,0x81,0xB4,0x4B,0x80,0xAC,0x4B,0x80,
+    0xAC,0x2B,0x80,0xA4,0x0C,0x00,0x9C,0x2D,0x80,0x9C,0x0E,0x00,0x94,0x0E,0x84,0x9C,
+    0x2E,0x82,0x9C,0x4F,0x04,0x9C,0x6F,0x6B,0x6C,0x7B,0xCE,0x84,0x4F,0x8C,0x91,0x80,
+    0x94,0x91,0x00,0x94,0xB1,0x80,0x8C,0x91,0x01,0x84,0x91,0x84,0x70,0x80,0x7C,0x30,
+    0x00,0x7C,0x2F,0x80,0x74,0x0F,0x81,0x73,0xEF,0x82,0x6B,0xEF,0x01,0x6C,0x0F,0x74,
+    0x0F,0x82,0x6C,0x0F,0x0C,0x74,0x2F,0x74,0x2E,0x7C,0x0D,0x94,0x6E,0xAC,0xCE,0xBD,
+    0x0F,0xC5,0x2E,0xCD,0x4F,0xD5,0x8F,0xDD,0xB0,0xE5,0xD0,0xE5,0xF0,0xE5,0xF1,0x84,
+    0xEE,0x11,0x00,0xE5,0xF1,0x86,0xEE,0x11,0x80,0xED,0xF1,0x01,0xE5,0xD0,0xE5,0xB0,
+    0x80,0xE5,0x8F,0x01,0xE5,0x6E,0xDD,0x6E,0x80,0xDD,0x4E,0x00,0xDD,0x2E,0x80,0xDD,
+    0x2D,0x84,0xD5,0x0D,0x02,0xD5,0x2D,0xD5,0x2E,0xDD,0x4E,0x81,0xDD,0x6F,0x00,0xD5,
+    0x6F,0x80,0xD5,0x4E,0x02,0xD5,0x2E,0xCC,0xED,0xC4,0xCD,0x81,0xC4,0xED,0x04,0xC4,
+    0xCD,0xC4,0xCC,0xBC,0x8C,0xB4,0x4A,0xAC,0x0A,0x81,0xA3,0xC9,0x02,0xA3,0xE9,0xAC,
+    0x0A,0xAC,0x2A,0x80,0xB4,0x4B,0x01,0xB4,0x6B,0xBC,0x6B,0x80,0xB4,0x6B,0x05,0xAC,
+    0x6B,0xAC,0x4B,0xAC,0x2B,0xAC,0x2C,0xA4,0x2C,0x9C,0x2D,0x80,0x9C,0x2E,0x82,0x94,
+    0x2E,0x01,0x9C,0x4F,0x94,0x2E,0x82,0x9C,0x4F,0x80,0x9C,0x6F,0x03,0x63,0xAD,0x74,
+    0x0F,0x7C,0x70,0x84,0xB1,0x81,0x8C,0xD2,0x80,0x84,0xD3,0x01,0x84,0xD2,0x7C,0xB2,
+    0x80,0x7C,0x92,0x84,0x74,0x71,0x81,0x6C,0x71,0x80,0x6C,0x91,0x81,0x74,0xB2,0x0D,
+    0x74,0xD2,0x74,0xF3,0x75,0x13,0x7D,0x12,0x84,0xF1,0x9C,0xF0,0xAD,0x10,0xBD,0x0F,
+    0xC5,0x2E,0xCD,0x6F,0xD5,0x8F,0xDD,0xB0,0xDD,0xD0,0xE5,0xF0,0x80,0xE6,0x11,0x01,
+    0xEE,0x11,0xEE,0x31,0x81,0xEE,0x11,0x00,0xE6,0x11,0x82,0xEE,0x11,0x82,0xEE,0x31,
+    0x80,0xEE,0x11,0x05,0xED,0xF1,0xED,0xF0,0xE5,0xD0,0xE5,0xB0,0xE5,0xAF,0xE5,0x8F,
+    0x80,0xE5,0xAF,0x80,0xE5,0x8F,0x00,0xE5,0x6E,0x84,0xDD,0x6E,0x01,0xDD,0x6F,0xDD,
+    0x8F,0x80,0xE5,0x8F,0x80,0xDD,0x8F,0x04,0xDD,0x6F,0xD5,0x6F,0xD5,0x2E,0xCD,0x2E,
+    0xCD,0x0E,0x82,0xCC,0xED,0x04,0xC4,0xCD,0xC4,0xAC,0xBC,0x8B,0xB4,0x4A,0xAC,0x0A,
+    0x81,0xA3,0xE9,0x05,0xAB,0xE9,0xAC,0x0A,0xB4,0x4A,0xB4,0x4B,0xBC,0x6B,0xBC,0x8B,
+    0x80,0xBC,0x8C,0x01,0xB4,0x8B,0xB4,0x6B,0x80,0xAC,0x4B,0x00,0xAC,0x2B,0x80,0xA4,
+    0x2C,0x01,0x9C,0x2E,0x9C,0x4E,0x85,0x9C,0x4F,0x80,0x9C,0x6F,0x81,0xA4,0x90,0x06,
+    0x6C,0xB1,0x74,0xF2,0x75,0x13,0x85,0x34,0x85,0x54,0x85,0x55,0x8D,0x76,0x83,0x8D,
+    0x96,0x00,0x85,0x96,0x82,0x85,0x97,0x80,0x85,0xB7,0x80,0x85,0xD7,0x80,0x85,0xF7,
+    0x03,0x85,0xF8,0x86,0x18,0x8D,0xF8,0x8E,0x18,0x81,0x86,0x38,0x08,0x8E,0x17,0x9D,
+    0xF5,0xA5,0x93,0xB5,0x30,0xBD,0x0F,0xC5,0x2E,0xCD,0x6F,0xD5,0x8F,0xDD,0xAF,0x80,
+    0xDD,0xD0,0x81,0xE5,0xF1,0x00,0xE6,0x11,0x84,0xEE,0x11,0x84,0xEE,0x31,0x81,0xEE,
+    0x11,0x01,0xED,0xF1,0xED,0xF0,0x86,0xED,0xD0,0x85,0xE5,0xAF,0x82,0xE5,0xB0,0x03,
+    0xDD,0x8F,0xD5,0x6F,0xD5,0x4E,0xCD,0x2E,0x82,0xCD,0x0E,0x07,0xCD,0x0D,0xCC,0xED,
+    0xC4,0xCD,0xBC,0xAC,0xBC,0x8C,0xB4,0x4B,0xB4,0x2A,0xAC,0x0A,0x80,0xAB,0xE9,0x06,
+    0xAC,0x09,0xAC,0x2A,0xB4,0x4A,0xB4,0x6B,0xBC,0x8B,0xBC,0x8C,0xBC,0xAC,0x80,0xBC,
+    0x8C,0x00,0xB4,0x8B,0x80,0xB4,0x6B,0x05,0xAC,0x4B,0xAC,0x4C,0xA4,0x6C,0xA4,0x6E,
+    0xA4,0x6F,0xA4,0x90,0x81,0xA4,0xB0,0x80,0xAC,0xD1,0x80,0xAC,0xF1,0x80,0xB5,0x12,
+    0x80,0xB5,0x32,0x02,0x85,0x95,0x85,0x96,0x85,0x76,0x81,0x85,0x96,0x80,0x85,0x97,
+    0x01,0x85,0x96,0x85,0x97,0x80,0x7D,0xB7,0x00,0x7D,0x96,0x82,0x75,0x76,0x04,0x75,
+    0x56,0x6D,0x56,0x75,0x96,0x75,0xB7,0x7D,0xF8,0x80,0x86,0x39,0x00,0x86,0x59,0x80,
+    0x86,0x39,0x81,0x7E,0x59,0x07,0x86,0x38,0x95,0xF6,0xA5,0x93,0xB5,0x30,0xC5,0x0F,
+    0xCD,0x4F,0xD5,0x8F,0xDD,0xB0,0x81,0xDD,0xD0,0x81,0xE5,0xD0,0x80,0xE5,0xF1,0x82,
+    0xEE,0x11,0x85,0xEE,0x31,0x82,0xEE,0x11,0x00,0xED,0xF1,0x86,0xED,0xF0,0x81,0xED,
+    0xD0,0x84,0xE5,0xD0,0x03,0xE5,0xB0,0xDD,0xAF,0xDD,0x8F,0xD5,0x4E,0x80,0xCD,0x2E,
+    0x82,0xCD,0x0E,0x08,0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,0xAC,0xBC,0x8B,0xB4,0x4A,
+    0xB4,0x2A,0xAC,0x2A,0xAC,0x0A,0x80,0xAC,0x09,0x05,0xAC,0x2A,0xB4,0x4B,0xBC,0x6B,
+    0xBC,0x8C,0xBC,0xAC,0xC4,0xAC,0x81,0xBC,0xAC,0x08,0xBC,0x8B,0xB4,0x8B,0xB4,0x6B,
+    0xAC,0x6B,0xAC,0x8C,0xB4,0xF0,0xC5,0x53,0xC5,0x74,0xC5,0x94,0x80,0xC5,0xB4,0x00,
+    0xCD,0xD5,0x80,0xCD,0xF5,0x81,0xD6,0x16,0x80,0xD6,0x36,0x80,0x85,0xB6,0x13,0x85,
+    0x96,0x7D,0x35,0x5C,0x72,0x54,0x31,0x4B,0xF0,0x43,0xCF,0x3B,0x8E,0x3B,0x6E,0x33,
+    0x4D,0x33,0x2D,0x2B,0x0C,0x22,0xCC,0x22,0xAC,0x1A,0x8B,0x1A,0x6B,0x1A,0x8B,0x1A,
+    0x8C,0x2B,0x0D,0x33,0xD0,0x65,0x76,0x80,0x7E,0x19,0x00,0x7E,0x39,0x80,0x7E,0x59,
+    0x00,0x7E,0x5A,0x80,0x76,0x59,0x06,0x86,0x38,0x95,0xF6,0xA5,0x93,0xB5,0x30,0xC5,
+    0x2F,0xCD,0x4F,0xD5,0x90,0x80,0xDD,0xB0,0x00,0xDD,0xAF,0x82,0xDD,0xB0,0x80,0xE5,
+    0xD0,0x01,0xE5,0xF0,0xE5,0xF1,0x81,0xEE,0x11,0x80,0xEE,0x31,0x00,0xEE,0x32,0x82,
+    0xEE,0x31,0x84,0xEE,0x11,0x00,0xED,0xF1,0x80,0xED,0xF0,0x81,0xED,0xF1,0x80,0xED,
+    0xF0,0x05,0xED,0xD0,0xED,0xF0,0xED,0xD0,0xE5,0xD0,0xE5,0xB0,0xE5,0xAF,0x81,0xDD,
+    0x8F,0x0D,0xD5,0x4F,0xD5,0x2E,0xCD,0x2E,0xD5,0x2E,0xCD,0x2E,0xCD,0x0E,0xCD,0x0D,
+    0xCD,0x0E,0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,0xAC,0xBC,0x8B,0xB4,0x6B,0x80,0xB4,
+    0x4A,0x80,0xAC,0x2A,0x05,0xAC,0x09,0xAC,0x2A,0xB4,0x6B,0xBC,0x8B,0xBC,0xAC,0xC4,
+    0xCC,0x81,0xC4,0xAC,0x80,0xBC,0xAC,0x00,0xBC,0x8B,0x80,0xB4,0x8B,0x06,0xB4,0x8C,
+    0xC5,0x30,0xD5,0xF5,0xDE,0x57,0xDE,0x77,0xDE,0x97,0xDE,0x98,0x82,0xE6,0xB8,0x80,
+    0xE6,0xD8,0x80,0xE6,0xB8,0x04,0x85,0x75,0x85,0x76,0x8D,0x76,0x5C,0x11,0x1A,0x6A,
+    0x81,0x12,0x29,0x01,0x12,0x09,0x12,0x08,0x81,0x09,0xE8,0x80,0x09,0xE9,0x80,0x09,
+    0xC9,0x81,0x09,0xE9,0x14,0x1A,0xAC,0x5D,0x15,0x75,0xF8,0x76,0x19,0x7E,0x39,0x86,
+    0x7A,0x8E,0x7B,0x86,0x9B,0x76,0x7A,0x76,0x59,0x86,0x37,0x95,0xD5,0xA5,0x73,0xB5,
+    0x30,0xC5,0x2F,0xCD,0x4F,0xD5,0x8F,0xDD,0x8F,0xDD,0xAF,0xDD,0x8F,0xDD,0xAF,0x82,
+    0xDD,0x8F,0x00,0xDD,0xB0,0x80,0xE5,0xD0,0x01,0xE5,0xF0,0xE5,0xF1,0x80,0xEE,0x11,
+    0x80,0xEE,0x31,0x81,0xEE,0x11,0x00,0xEE,0x31,0x84,0xEE,0x11,0x01,0xE5,0xF1,0xE5,
+    0xF0,0x81,0xED,0xF0,0x03,0xEE,0x11,0xED,0xF1,0xED,0xF0,0xED,0xD0,0x80,0xE5,0xD0,
+    0x00,0xE5,0xB0,0x80,0xDD,0x8F,0x81,0xD5,0x6E,0x00,0xD5,0x4E,0x80,0xD5,0x2E,0x02,
+    0xD5,0x4E,0xD5,0x2E,0xCD,0x2E,0x80,0xCD,0x0E,0x00,0xCD,0x0D,0x80,0xC4,0xED,0x01,
+    0xC4,0xCC,0xBC,0xAC,0x80,0xB4,0x6B,0x80,0xB4,0x4A,0x80,0xAC,0x2A,0x03,0xB4,0x4A,
+    0xB4,0x6B,0xBC,0x8B,0xBC,0xAC,0x83,0xC4,0xCC,0x80,0xBC,0xAC,0x06,0xBC,0xAB,0xB4,
+    0x8B,0xB4,0x8C,0xC5,0x30,0xD6,0x15,0xDE,0x77,0xE6,0x98,0x83,0xE6,0xB8,0x83,0xE6,
+    0xD9,0x04,0xC7,0x1C,0xCF,0x1C,0xC6,0xFC,0x7C,0xF4,0x22,0x8B,0x84,0x12,0x09,0x80,
+    0x11,0xE9,0x84,0x11,0xC9,0x11,0x09,0xC9,0x1A,0x6B,0x5C,0xF5,0x6D,0xF8,0x76,0x19,
+    0x86,0x5A,0x96,0x7B,0x9E,0x9C,0x9E,0xDC,0x86,0x9A,0x76,0x79,0x7E,0x37,0x95,0xD5,
+    0xA5,0x72,0xB5,0x30,0xC5,0x2F,0xCD,0x4F,0xD5,0x6F,0x81,0xD5,0x8F,0x00,0xDD,0x8F,
+    0x81,0xD5,0x6F,0x80,0xDD,0x8F,0x01,0xDD,0xAF,0xE5,0xB0,0x80,0xE5,0xD0,0x00,0xE5,
+    0xF1,0x80,0xEE,0x11,0x80,0xEE,0x31,0x80,0xEE,0x11,0x80,0xEE,0x31,0x83,0xEE,0x11,
+    0x83,0xE5,0xF0,0x03,0xED,0xF0,0xE5,0xF0,0xE5,0xD0,0xE5,0xAF,0x80,0xDD,0xAF,0x80,
+    0xDD,0x8F,0x00,0xDD,0x6E,0x80,0xD5,0x6E,0x81,0xD5,0x4E,0x80,0xD5,0x4F,0x80,0xD5,
+    0x4E,0x80,0xD5,0x2E,0x06,0xCD,0x2E,0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,0xAC,0xBC,
+    0x8B,0xB4,0x6B,0x80,0xB4,0x4A,0x80,0xAC,0x2A,0x03,0xB4,0x4A,0xB4,0x6B,0xBC,0x8B,
+    0xBC,0xAC,0x83,0xC4,0xCC,0x00,0xBC,0xCC,0x80,0xBC,0xAC,0x04,0xBC,0xAB,0xB4,0x8C,
+    0xC5,0x10,0xD5,0xF4,0xDE,0x97,0x80,0xE6,0xB8,0x00,0xE6,0xD8,0x81,0xE6,0xD9,0x00,
+    0xEE,0xD9,0x82,0xEE,0xF9,0x04,0xE7,0x5E,0xE7,0x7E,0xDF,0x3E,0x95,0x35,0x2A,0x8A,
+    0x81,0x12,0x09,0x02,0x1A,0x2A,0x22,0x2A,0x22,0x0A,0x80,0x22,0x2A,0x00,0x22,0x0A,
+    0x80,0x19,0xEA,0x80,0x19,0xC9,0x14,0x11,0xC9,0x09,0xC9,0x1A,0x6B,0x5C,0xF5,0x6D,
+    0xF8,0x6E,0x39,0x86,0x3A,0x96,0x1A,0x9E,0x3B,0x9E,0x9B,0x86,0x7A,0x76,0x79,0x7E,
+    0x36,0x8D,0xD4,0xA5,0x72,0xB5,0x30,0xC5,0x0F,0xCD,0x4F,0xCD,0x6F,0xD5,0x6F,0xD5,
+    0x8F,0x84,0xD5,0x6E,0x00,0xDD,0x6F,0x80,0xDD,0x8F,0x00,0xDD,0xAF,0x80,0xE5,0xD0,
+    0x00,0xED,0xF1,0x83,0xEE,0x11,0x82,0xEE,0x31,0x80,0xEE,0x11,0x00,0xE5,0xF1,0x82,
+    0xE5,0xF0,0x80,0xE5,0xD0,0x00,0xE5,0xAF,0x80,0xDD,0x8F,0x87,0xD5,0x6E,0x00,0xD5,
+    0x4E,0x81,0xD5,0x6F,0x81,0xD5,0x4E,0x80,0xCD,0x2E,0x04,0xCD,0x0D,0xC4,0xED,0xC4,
+    0xCC,0xBC,0x8B,0xB4,0x6B,0x80,0xB4,0x4A,0x80,0xAC,0x2A,0x03,0xB4,0x2A,0xB4,0x6B,
+    0xBC,0x6B,0xBC,0x8B,0x84,0xC4,0xCC,0x82,0xBC,0xAC,0x02,0xC5,0x0F,0xD5,0xF4,0xDE,
+    0x97,0x80,0xE6,0xB8,0x80,0xE6,0xD9,0x85,0xEE,0xF9,0x80,0xEF,0x5E,0x02,0xE7,0x3D,
+    0x9D,0x56,0x32,0x8B,0x81,0x19,0xE9,0x01,0x2A,0x8B,0x3A,0xED,0x80,0x42,0xED,0x04,
+    0x3A,0xCD,0x32,0x8C,0x2A,0x4B,0x2A,0x2B,0x21,0xEA,0x80,0x19,0xA9,0x05,0x11,0xC9,
+    0x1A,0x6B,0x5C,0xF5,0x65,0xF8,0x6E,0x39,0x8E,0x5A,0x80,0x9E,0x7B,0x09,0x96,0xBB,
+    0x86,0x7A,0x76,0x78,0x7E,0x36,0x8D,0xD4,0xA5,0x71,0xB5,0x30,0xC5,0x0F,0xCD,0x4E,
+    0xCD,0x4F,0x80,0xD5,0x6F,0x01,0xD5,0x6E,0xD5,0x4E,0x80,0xD5,0x6E,0x00,0xD5,0x4E,
+    0x80,0xD5,0x6E,0x80,0xDD,0x8F,0x03,0xDD,0xAF,0xDD,0xB0,0xE5,0xD0,0xE5,0xF0,0x88,
+    0xEE,0x11,0x80,0xE5,0xF0,0x00,0xE5,0xD0,0x80,0xDD,0xD0,0x00,0xE5,0xD0,0x80,0xDD,
+    0xAF,0x00,0xDD,0x6E,0x84,0xD5,0x6E,0x00,0xD5,0x4E,0x81,0xD5,0x6E,0x84,0xD5,0x6F,
+    0x81,0xD5,0x4E,0x06,0xCD,0x2E,0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,0x8B,0xB4,0x6B,
+    0xB4,0x4A,0x82,0xAC,0x2A,0x02,0xB4,0x4A,0xBC,0x6B,0xBC,0x8B,0x85,0xC4,0xCC,0x00,
+    0xBC,0xCC,0x80,0xBC,0xAC,0x03,0xC4,0xEF,0xD5,0xD3,0xDE,0x97,0xDE,0xD8,0x80,0xE6,
+    0xD9,0x02,0xE6,0xF9,0xEE,0xF9,0xEE,0xFA,0x83,0xEF,0x1A,0x04,0xEF,0x5D,0xEF,0x5E,
+    0xE7,0x3D,0xA5,0x96,0x3A,0x8B,0x81,0x19,0xE9,0x1A,0x2A,0x8B,0x43,0x0E,0x42,0xED,
+    0x3A,0xCD,0x3A,0xAC,0x32,0x6C,0x2A,0x2B,0x22,0x0B,0x19,0xCA,0x19,0x89,0x19,0xA9,
+    0x09,0xC9,0x12,0x4A,0x54,0xF4,0x65,0xF8,0x6E,0x38,0x86,0x59,0x8E,0x7A,0x8E,0x9B,
+    0x86,0x7A,0x76,0x59,0x76,0x58,0x7E,0x36,0x8D,0xD3,0xA5,0x71,0xB5,0x30,0xC5,0x2F,
+    0x80,0xCD,0x4F,0x01,0xD5,0x6E,0xCD,0x6E,0x83,0xD5,0x4E,0x01,0xD5,0x6E,0xD5,0x6F,
+    0x80,0xDD,0x8F,0x80,0xDD,0xAF,0x00,0xE5,0xB0,0x80,0xE5,0xD0,0x81,0xE5,0xF0,0x01,
+    0xE5,0xF1,0xED,0xF1,0x81,0xEE,0x11,0x02,0xE5,0xF1,0xE5,0xD0,0xDD,0xD0,0x81,0xDD,
+    0xAF,0x80,0xDD,0x8F,0x00,0xD5,0x6E,0x82,0xD5,0x4E,0x00,0xD5,0x6D,0x81,0xD5,0x6E,
+    0x81,0xDD,0x6E,0x01,0xD5,0x6E,0xD5,0x6F,0x81,0xDD,0x6F,0x00,0xD5,0x6E,0x82,0xD5,
+    0x4E,0x06,0xCD,0x2E,0xC4,0xED,0xC4,0xCC,0xBC,0x8B,0xB4,0x6B,0xB4,0x4A,0xAC,0x2A,
+    0x81,0xAC,0x09,0x04,0xB4,0x2A,0xB4,0x4B,0xBC,0x8B,0xC4,0xAC,0xC4,0xCC,0x81,0xC4,
+    0xED,0x81,0xC4,0xCC,0x80,0xBC,0xAC,0x03,0xBC,0xCE,0xCD,0x92,0xDE,0x76,0xDE,0xD8,
+    0x80,0xE6,0xD9,0x00,0xE6,0xF9,0x81,0xEE,0xFA,0x82,0xEF,0x1A,0x80,0xEF,0x5D,0x02,
+    0xEF,0x3D,0xAD,0xB7,0x3A,0xAC,0x80,0x19,0xE9,0x02,0x19,0xC9,0x22,0x2A,0x32,0x8B,
+    0x80,0x32,0x6B,0x03,0x2A,0x2A,0x21,0xC9,0x19,0xC9,0x19,0xA9,0x80,0x11,0x88,0x06,
+    0x11,0xA8,0x11,0xA9,0x1A,0x2A,0x54,0xB4,0x6D,0xF8,0x6E,0x18,0x76,0x18,0x80,0x7E,
+    0x18,0x80,0x76,0x38,0x05,0x7E,0x38,0x85,0xF6,0x95,0xB3,0xA5,0x51,0xB5,0x30,0xC5,
+    0x2F,0x80,0xCD,0x4F,0x01,0xD5,0x4E,0xCD,0x4E,0x83,0xD5,0x4E,0x01,0xD5,0x6E,0xD5,
+    0x6F,0x80,0xDD,0x8F,0x80,0xDD,0xAF,0x82,0xDD,0xB0,0x80,0xDD,0xAF,0x00,0xDD,0xB0,
+    0x80,0xE5,0xD0,0x01,0xDD,0xB0,0xDD,0xAF,0x83,0xDD,0x8F,0x01,0xDD,0x6F,0xD5,0x6E,
+    0x82,0xD5,0x4E,0x02,0xDD,0x6E,0xD5,0x6E,0xDD,0x6E,0x81,0xDD,0x8E,0x00,0xDD,0x6E,
+    0x80,0xD5,0x6E,0x02,0xD5,0x4E,0xD5,0x6E,0xD5,0x6F,0x80,0xD5,0x6E,0x83,0xD5,0x4E,
+    0x0E,0xCD,0x2E,0xC4,0xED,0xC4,0xCC,0xBC,0xAC,0xB4,0x6B,0xB4,0x4A,0xAC,0x2A,0xAC,
+    0x09,0xAB,0xE9,0xAC,0x09,0xB4,0x2A,0xB4,0x4A,0xBC,0x8B,0xC4,0xAC,0xC4,0xCC,0x82,
+    0xC4,0xED,0x81,0xC4,0xCC,0x04,0xBC,0xAC,0xBC,0xAD,0xBD,0x30,0xD6,0x34,0xDE,0xB8,
+    0x80,0xE6,0xD9,0x80,0xE6,0xF9,0x80,0xEE,0xFA,0x82,0xEF,0x1A,0x80,0xEF,0x5D,0x07,
+    0xEF,0x5C,0xB5,0xD7,0x42,0xCC,0x19,0xC9,0x19,0xC8,0x19,0xC9,0x19,0xC8,0x19,0xA8,
+    0x80,0x19,0x88,0x01,0x11,0x87,0x11,0x67,0x82,0x11,0x68,0x80,0x11,0x88,0x03,0x19,
+    0xEA,0x54,0x53,0x6D,0x77,0x65,0x96,0x83,0x6D,0x96,0x05,0x75,0x95,0x7D,0x54,0x95,
+    0x32,0xAD,0x31,0xBD,0x30,0xC5,0x2F,0x80,0xCD,0x4F,0x80,0xCD,0x4E,0x84,0xD5,0x4E,
+    0x00,0xD5,0x6E,0x82,0xDD,0x8F,0x80,0xDD,0xAF,0x80,0xDD,0x8F,0x00,0xDD,0x6F,0x81,
+    0xD5,0x6E,0x01,0xD5,0x4E,0xCD,0x2E,0x81,0xCD,0x0D,0x00,0xCD,0x2D,0x80,0xD5,0x2E,
+    0x00,0xCD,0x2E,0x81,0xD5,0x2E,0x80,0xD5,0x4E,0x00,0xD5,0x6E,0x81,0xDD,0x6E,0x00,
+    0xD5,0x6E,0x81,0xD5,0x4E,0x81,0xCD,0x2E,0x00,0xD5,0x4E,0x80,0xCD,0x2E,0x00,0xD5,
+    0x2E,0x81,0xCD,0x2E,0x0E,0xD5,0x4E,0xCD,0x2E,0xCD,0x0D,0xC4,0xED,0xBC,0xAC,0xBC,
+    0x8B,0xB4,0x4A,0xAC,0x2A,0xAC,0x09,0xAB,0xE9,0xAC,0x09,0xAC,0x0A,0xB4,0x4A,0xBC,
+    0x8B,0xC4,0xAC,0x85,0xC4,0xED,0x05,0xC4,0xCC,0xBC,0xAC,0xBC,0xAD,0xB4,0xEE,0xC5,
+    0xB2,0xDE,0x97,0x81,0xE6,0xD9,0x00,0xE6,0xF9,0x80,0xEE,0xFA,0x82,0xEF,0x1A,0x07,
+    0xEF,0x7D,0xEF,0x5D,0xEF,0x5C,0xB5,0xF7,0x42,0xCD,0x21,0xC9,0x19,0xA8,0x21,0xC8,
+    0x80,0x21,0xA8,0x01,0x19,0x88,0x19,0x87,0x83,0x19,0x67,0x80,0x19,0x87,0x05,0x19,
+    0xA8,0x19,0xC8,0x3B,0x0D,0x43,0x6F,0x3B,0x6E,0x3B,0x4D,0x81,0x33,0x4D,0x08,0x33,
+    0x2C,0x33,0x0C,0x43,0x0B,0x7B,0xCD,0xAC,0xD0,0xBD,0x10,0xC5,0x2F,0xC5,0x4F,0xCD,
+    0x4F,0x80,0xCD,0x4E,0x02,0xD5,0x4E,0xCD,0x4E,0xD5,0x4E,0x80,0xD5,0x2E,0x80,0xD5,
+    0x4E,0x00,0xD5,0x6E,0x83,0xDD,0x8F,0x00,0xDD,0x6F,0x80,0xDD,0x6E,0x00,0xD5,0x4E,
+    0x80,0xCD,0x2D,0x80,0xCD,0x0D,0x01,0xC4,0xCC,0xC4,0xAC,0x80,0xBC,0x8B,0x04,0xC4,
+    0xAC,0xCC,0xEC,0xCD,0x0D,0xCD,0x2D,0xD5,0x2D,0x82,0xD5,0x4E,0x81,0xD5,0x4D,0x00,
+    0xCD,0x2D,0x82,0xCD,0x0D,0x00,0xC5,0x0D,0x81,0xCD,0x0D,0x85,0xCD,0x2E,0x80,0xC4,
+    0xED,0x03,0xBC,0xAC,0xBC,0x8B,0xB4,0x4A,0xAC,0x2A,0x82,0xAC,0x09,0x03,0xB4,0x2A,
+    0xBC,0x6B,0xBC,0xAC,0xC4,0xED,0x80,0xCD,0x0D,0x82,0xC4,0xED,0x0B,0xC4,0xEC,0xBC,
+    0xCC,0xBC,0xAC,0xB4,0xCD,0xBD,0x30,0xD6,0x35,0xDE,0xB8,0xE6,0xD9,0xEE,0xD9,0xEE,
+    0xFA,0xEF,0x1A,0xEE,0xFA,0x82,0xEF,0x1A,0x81,0xE7,0x1B,0x02,0xB5,0xB7,0x42,0xAC,
+    0x21,0xA8,0x81,0x21,0x87,0x00,0x21,0x67,0x81,0x21,0x66,0x17,0x19,0x66,0x19,0x86,
+    0x21,0x86,0x21,0xA6,0x29,0xA7,0x29,0xE8,0x32,0x2A,0x3A,0x6A,0x42,0xAB,0x4A,0xEC,
+    0x42,0xCA,0x42,0xCB,0x42,0xEB,0x4B,0x4D,0x53,0x6D,0x5B,0x8E,0x5B,0xAE,0x6B,0xCE,
+    0x94,0x4F,0xA4,0xAF,0xB4,0xCF,0xBC,0xCE,0xBD,0x0E,0xC5,0x2E,0x81,0xCD,0x4E,0x00,
+    0xCD,0x2E,0x81,0xCD,0x0D,0x03,0xCD,0x0C,0xCD,0x2D,0xD5,0x4E,0xD5,0x6E,0x80,0xDD,
+    0x6F,0x82,0xDD,0x8F,0x01,0xD5,0x6E,0xD5,0x4D,0x81,0xCD,0x0D,0x08,0xC4,0xEC,0xC4,
+    0xCC,0xBC,0xAB,0xB4,0x4A,0xAC,0x29,0xB4,0x6B,0xC4,0xEC,0xCD,0x0D,0xD5,0x2D,0x80,
+    0xD5,0x4E,0x02,0xD5,0x6E,0xD5,0x4E,0xCD,0x2D,0x81,0xCD,0x0C,0x01,0xCC,0xEC,0xC4,
+    0xEC,0x81,0xCD,0x0D,0x80,0xC5,0x0D,0x00,0xCD,0x0D,0x85,0xCD,0x2E,0x00,0xCD,0x0D,
+    0x80,0xC4,0xED,0x03,0xBC,0xAC,0xBC,0x8B,0xB4,0x4A,0xAC,0x2A,0x82,0xAC,0x09,0x03,
+    0xB4,0x2A,0xBC,0x6B,0xBC,0xAC,0xC4,0xED,0x83,0xCD,0x0D,0x80,0xC4,0xED,0x0A,0xC4,
+    0xEC,0xBC,0xAC,0xB4,0xAD,0xB4,0xCE,0xCD,0x92,0xDE,0x77,0xE6,0xD9,0xEE,0xD9,0xEE,
+    0xFA,0xEF,0x1A,0xEE,0xFA,0x82,0xEF,0x1A,0x04,0x9C,0xB1,0x9C,0xB2,0x9C,0xD2,0x84,
+    0x31,0x42,0x28,0x80,0x21,0x65,0x80,0x21,0x46,0x02,0x21,0x66,0x29,0x66,0x29,0x86,
+    0x80,0x31,0xA7,0x01,0x31,0xC7,0x31,0xE7,0x80,0x39,0xE7,0x08,0x3A,0x27,0x42,0x49,
+    0x4A,0x69,0x52,0xCA,0x63,0x2C,0x63,0x4C,0x73,0xAE,0x73,0xCF,0x7B,0xCF,0x80,0x7B,
+    0xEF,0x08,0x7C,0x0F,0x84,0x0E,0x94,0x0E,0x9C,0x2D,0xA4,0x0B,0xA4,0x2B,0xB4,0x8C,
+    0xBC,0xED,0xC5,0x0D,0x80,0xCD,0x2E,0x01,0xCD,0x0D,0xC4,0xED,0x82,0xC4,0xEC,0x02,
+    0xCD,0x2D,0xD5,0x4D,0xD5,0x4E,0x83,0xDD,0x6E,0x00,0xD5,0x4E,0x80,0xCD,0x2D,0x09,
+    0xCD,0x0D,0xC4,0xEC,0xBC,0xAC,0xC4,0xAC,0xC4,0xCC,0xB4,0x4A,0xB4,0x2A,0xBC,0xAB,
+    0xCD,0x0D,0xCD,0x2D,0x82,0xD5,0x4E,0x00,0xD5,0x2E,0x82,0xCD,0x0D,0x80,0xCC,0xEC,
+    0x00,0xCD,0x0D,0x81,0xCD,0x2D,0x83,0xCD,0x2E,0x80,0xD5,0x2E,0x80,0xCD,0x2E,0x06,
+    0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,0xAC,0xBC,0x8B,0xB4,0x4A,0xAC,0x2A,0x82,0xAC,
+    0x09,0x03,0xB4,0x2A,0xB4,0x6B,0xBC,0xAC,0xC4,0xED,0x84,0xCD,0x0D,0x0B,0xC4,0xED,
+    0xC4,0xEC,0xBC,0xCC,0xB4,0x8C,0xB4,0x8D,0xB4,0xEF,0xCD,0xD4,0xE6,0xB8,0xEE,0xD9,
+    0xEE,0xFA,0xEF,0x1A,0xEE,0xFA,0x82,0xEF,0x1A,0x81,0x4A,0x07,0x09,0x4A,0x08,0x39,
+    0xC6,0x31,0x85,0x31,0xA6,0x39,0xC6,0x39,0xE7,0x41,0xE7,0x42,0x07,0x42,0x27,0x4A,
+    0x27,0x80,0x42,0x27,0x00,0x42,0x07,0x80,0x42,0x06,0x08,0x42,0x27,0x4A,0x47,0x52,
+    0x68,0x63,0x0A,0x7B,0xCE,0x7B,0xEE,0x7B,0xEF,0x83,0xEF,0x84,0x10,0x81,0x84,0x0F,
+    0x08,0x83,0xEE,0x83,0xAC,0x83,0x6A,0x83,0x48,0x8B,0x48,0x9B,0xEA,0xB4,0x8C,0xBC,
+    0xED,0xC5,0x0D,0x80,0xCD,0x0D,0x00,0xC4,0xED,0x80,0xC4,0xEC,0x03,0xC4,0xCB,0xC4,
+    0xEB,0xC4,0xEC,0xCD,0x2C,0x80,0xD5,0x2D,0x81,0xCD,0x0D,0x00,0xCD,0x2D,0x82,0xCD,
+    0x0D,0x08,0xC4,0xCC,0xBC,0x8B,0xBC,0xAB,0xC4,0xEC,0xBC,0xAC,0xBC,0x8B,0xC4,0xEC,
+    0xCD,0x2D,0xCD,0x2E,0x83,0xD5,0x4E,0x00,0xD5,0x2E,0x81,0xD5,0x4E,0x00,0xD5,0x2D,
+    0x80,0xCD,0x2D,0x89,0xD5,0x4E,0x07,0xCD,0x2E,0xCD,0x0D,0xC4,0xED,0xC4,0xCC,0xBC,
+    0xAC,0xBC,0x8B,0xB4,0x4A,0xAC,0x2A,0x82,0xAC,0x09,0x04,0xAC,0x2A,0xB4,0x6B,0xBC,
+    0xAC,0xC4,0xED,0xCD,0x0D,0x81,0xCD,0x2E,0x80,0xCD,0x0D,0x07,0xC4,0xED,0xC4,0xEC,
+    0xBC,0xAC,0xB4,0x8C,0xB4,0x6C,0xAC,0x6D,0xBD,0x30,0xDE,0x77,0x80,0xEE,0xD9,0x81,
+    0xEE,0xFA,0x81,0xEF,0x1A,0x00,0x8B,0xEE,0x80,0x8C,0x0F,0x02,0x83,0xAD,0x62,0xCA,
+    0x52,0x48,0x84,0x52,0x47,0x00,0x4A,0x47,0x80,0x4A,0x27,0x07,0x4A,0x26,0x4A,0x06,
+    0x4A,0x26,0x4A,0x27,0x4A,0x47,0x52,0x68,0x6B,0x0A,0x73,0x8C,0x83,0x7B,0xCE,0x04,
+    0x7B,0xAD,0x73,0x8C,0x73,0x4B,0x73,0x09,0x72,0xC7,0x80,0x72,0xA6,0x04,0x8B,0x68,
+    0xAC,0x4B,0xBC,0xCC,0xC4,0xED,0xC5,0x0D,0x80,0xCD,0x0D,0x04,0xC4,0xEC,0xC4,0xCC,
+    0xC4,0xCB,0xC4,0xEB,0xC4,0xEC,0x80,0xCD,0x0C,0x01,0xC4,0xEC,0xC4,0xCC,0x80,0xC4,
+    0xAB,0x81,0xC4,0xCC,0x80,0xC4,0xEC,0x08,0xBC,0xAB,0xB4,0x6B,0xBC,0xAB,0xCC,0xED,
+    0xC4,0xEC,0xC4,0xCC,0xC4,0xEC,0xCD,0x0D,0xD5,0x2E,0x81,0xD5,0x4E,0x80,0xD5,0x2E,
+    0x83,0xD5,0x4E,0x80,0xD5,0x2D,0x00,0xD5,0x4D,0x80,0xD5,0x4E,0x04,0xD5,0x6F,0xDD,
+    0x6F,0xDD,0x8F,0xDD,0x6F,0xD5,0x6F,0x81,0xD5,0x4E,0x06,0xCD,0x2E,0xCD,0x0D,0xC4,
+    0xED,0xC4,0xCC,0xBC,0xAC,0xBC,0x8B,0xB4,0x4A,0x80,0xAC,0x2A,0x81,0xAC,0x09,0x03,
+    0xAC,0x0A,0xB4,0x4A,0xBC,0xAC,0xC4,0xED,0x80,0xCD,0x0D,0x80,0xCD,0x2E,0x80,0xCD,
+    0x0D,0x09,0xCC,0xED,0xC4,0xEC,0xBC,0xAC,0xBC,0x8C,0xB4,0x6C,0xA4,0x2C,0xAC,0xAE,
+    0xCD,0xF4,0xEE,0xB8,0xEE,0xD9,0x81,0xEE,0xFA,0x81,0xEF,0x1A,0x81,0xAC,0xD2,0x06,
+    0x9C,0x70,0x7B,0x6C,0x6A,0xC9,0x62,0xA8,0x62,0x88,0x62,0xA8,0x5A,0xA8,0x80,0x5A,
+    0x88,0x80,0x5A,0x67,0x00,0x52,0x67,0x80,0x5A,0x67,0x80,0x5A,0x68,0x16,0x5A,0x88,
+    0x62,0xA8,0x6A,0xEA,0x7B,0x4B,0x7B,0x6C,0x7B,0x8C,0x73,0x4B,0x73,0x2B,0x6B,0x0A,
+    0x62,0xC9,0x62,0x87,0x62,0x67,0x5A,0x45,0x5A,0x24,0x62,0x24,0x6A,0x44,0x83,0x27,
+    0xA4,0x2B,0xBC,0xCC,0xBC,0xED,0xC5,0x0D,0xCD,0x0D,0xC4,0xED,0x80,0xC4,0xCC,0x00,
+    0xC4,0xCB,0x80,0xC4,0xEB,0x80,0xC4,0xEC,0x00,0xC4,0xCB,0x80,0xC4,0xAB,0x81,0xBC,
+    0xAB,0x0A,0xBC,0xAC,0xC4,0xCC,0xC4,0xAC,0xBC,0xAB,0xB4,0x6B,0xBC,0x8B,0xC4,0xED,
+    0xC4,0xEC,0xC4,0xCC,0xC4,0xEC,0xCD,0x0D,0x80,0xCD,0x2E,0x00,0xCD,0x0D,0x80,0xCC,
+    0xED,0x83,0xCD,0x0D,0x82,0xCD,0x2D,0x01,0xD5,0x4D,0xD5,0x4E,0x81,0xDD,0x6F,0x80,
+    0xD5,0x6F,0x04,0xD5,0x4E,0xD5,0x2E,0xCD,0x2E,0xCD,0x0D,0xC4,0xED,0x80,0xC4,0xCC,
+    0x01,0xBC,0xAC,0xBC,0x8B,0x80,0xB4,0x4A,0x00,0xAC,0x2A,0x81,0xAC,0x09,0x03,0xAC,
+    0x0A,0xB4,0x4A,0xBC,0xAC,0xC4,0xED,0x84,0xCD,0x0D,0x0A,0xC4,0xED,0xC4,0xEC,0xBC,
+    0xCC,0xBC,0xAC,0xB4,0x4B,0xA4,0x2B,0xA4,0x6D,0xC5,0x72,0xE6,0x98,0xEE,0xD9,0xEE,
+    0xF9,0x80,0xEE,0xFA,0x81,0xEF,0x1A,0x81,0xAC,0x70,0x02,0x9C,0x4F,0x8B,0xAC,0x7B,
+    0x6B,0x83,0x7B,0x4A,0x00,0x7B,0x6A,0x80,0x7B,0x4A,0x00,0x7B,0x6B,0x80,0x83,0x8B,
+    0x04,0x83,0xAC,0x83,0xCC,0x8B,0xAC,0x93,0xCD,0x93,0xED,0x80,0x9C,0x2E,0x07,0x9C,
+    0x0D,0x83,0x6B,0x6A,0xA8,0x62,0x66,0x5A,0x45,0x62,0x45,0x5A,0x24,0x62,0x24,0x80,
+    0x5A,0x03,0x09,0x62,0x23,0x7A,0xE6,0x9B,0xE9,0xAC,0x8B,0xB4,0xAC,0xBC,0xED,0xC4,
+    0xED,0xC4,0xCC,0xC4,0xAC,0xC4,0xAB,0x81,0xC4,0xCB,0x01,0xC4,0xEB,0xC4,0xCB,0x80,
+    0xC4,0xCC,0x80,0xC4,0xAB,0x81,0xBC,0xAB,0x80,0xC4,0xCC,0x06,0xBC,0xAC,0xBC,0x8B,
+    0xBC,0xAC,0xC4,0xEC,0xC4,0xCC,0xBC,0xAC,0xC4,0xCC,0x80,0xC4,0xED,0x03,0xC4,0xCC,
+    0xBC,0xAC,0xBC,0x6B,0xB4,0x6B,0x80,0xBC,0x8B,0x04,0xC4,0xAC,0xC4,0xCC,0xC4,0xEC,
+    0xCC,0xEC,0xCD,0x0D,0x80,0xCD,0x0C,0x00,0xCD,0x0D,0x83,0xD5,0x2E,0x00,0xCD,0x2E,
+    0x80,0xCD,0x0D,0x00,0xC4,0xED,0x80,0xC4,0xCC,0x81,0xBC,0xAC,0x01,0xBC,0x8B,0xB4,
+    0x6B,0x80,0xB4,0x4A,0x82,0xAC,0x09,0x03,0xB4,0x4A,0xBC,0x8B,0xC4,0xCC,0xC4,0xED,
+    0x81,0xCD,0x0D,0x81,0xC4,0xED,0x07,0xC4,0xEC,0xC4,0xCC,0xBC,0xAC,0xB4,0x6B,0xAC,
+    0x2B,0xA4,0x4C,0xBD,0x10,0xE6,0x56,0x80,0xEE,0xD9,0x01,0xEE,0xF9,0xEE,0xFA,0x81,
+    0xEF,0x1A,0x81,0xB4,0xD1,0x02,0xB4,0xD0,0xB4,0xD1,0xB4,0xF1,0x80,0xBD,0x11,0x06,
+    0xBD,0x32,0xC5,0x52,0xC5,0x72,0xC5,0x93,0xCD,0xB4,0xCD,0xD4,0xD5,0xD4,0x81,0xD5,
+    0xF5,0x03,0xD6,0x15,0xDE,0x15,0xDE,0x16,0xE6,0x36,0x80,0xE6,0x77,0x04,0xDD,0xF5,
+    0xB4,0x8F,0x7B,0x09,0x62,0x66,0x62,0x45,0x80,0x62,0x24,0x01,0x62,0x03,0x59,0xE3,
+    0x80,0x59,0xE2,0x09,0x72,0x85,0x93,0xA9,0xA4,0x2A,0xAC,0x4B,0xAC,0x6B,0xB4,0x4B,
+    0xB4,0x2A,0xB4,0x4A,0xB4,0x6B,0xBC,0x8B,0x82,0xBC,0x8A,0x81,0xBC,0x8B,0x03,0xBC,
+    0x6B,0xBC,0x8B,0xBC,0xAB,0xC4,0xAC,0x80,0xC4,0xCC,0x01,0xC4,0xAC,0xBC,0xAC,0x80,
+    0xC4,0xCC,0x01,0xC4,0xAC,0xBC,0xAC,0x80,0xC4,0xAC,0x01,0xBC,0xAC,0xB4,0x6B,0x80,
+    0xB4,0x4A,0x04,0xB4,0x2A,0xB4,0x4A,0xBC,0x6B,0xBC,0x8B,0xBC,0xAC,0x81,0xC4,0xCC,
+    0x80,0xC4,0xCB,0x02,0xC4,0xCC,0xCC,0xEC,0xCC,0xED,0x81,0xCD,0x0D,0x01,0xCC,0xED,
+    0xC4,0xCD,0x80,0xC4,0xCC,0x83,0xBC,0xAC,0x00,0xBC,0xAB,0x80,0xB4,0x6B,0x01,0xB4,
+    0x4A,0xAC,0x2A,0x80,0xAB,0xE9,0x03,0xAC,0x09,0xB4,0x4A,0xBC,0x8B,0xC4,0xCC,0x85,
+    0xC4,0xED,0x0B,0xC4,0xCC,0xC4,0xAC,0xBC,0xAC,0xB4,0x8C,0xAC,0x4B,0xA4,0x2B,0xB4,
+    0xAE,0xDE,0x15,0xEE,0xB9,0xEE,0xD9,0xEE,0xF9,0xEE,0xFA,0x81,0xEF,0x1A,0x80,0xD5,
+    0x94,0x02,0xCD,0x93,0xD5,0x93,0xD5,0xB4,0x80,0xD5,0xD4,0x80,0xD5,0xB4,0x04,0xD5,
+    0xD4,0xDD,0xD4,0xDD,0xF4,0xDD,0xF5,0xDE,0x15,0x80,0xE6,0x15,0x80,0xDE,0x15,0x82,
+    0xDD,0xF5,0x0F,0xDD,0xF4,0xCD,0x93,0xB4,0x8F,0x93,0x8B,0x7A,0xC8,0x6A,0x45,0x62,
+    0x25,0x62,0x04,0x62,0x03,0x59,0xE3,0x59,0xC3,0x51,0xC2,0x51,0xA2,0x62,0x23,0x8B,
+    0x47,0x9B,0xEA,0x80,0xA4,0x0A,0x00,0xA3,0xE9,0x80,0xA3,0xC9,0x00,0xAC,0x09,0x80,
+    0xAC,0x29,0x81,0xAC,0x28,0x80,0xB4,0x29,0x80,0xB4,0x4A,0x01,0xBC,0x6B,0xBC,0xAC,
+    0x81,0xC4,0xCC,0x80,0xBC,0xAC,0x03,0xC4,0xCC,0xC4,0xCD,0xC4,0xCC,0xC4,0xAC,0x80,
+    0xBC,0xAC,0x00,0xBC,0x8B,0x80,0xB4,0x6B,0x02,0xB4,0x6A,0xB4,0x4A,0xB4,0x6B,0x80,
+    0xBC,0x6B,0x02,0xBC,0x8B,0xBC,0x6B,0xB4,0x6A,0x81,0xB4,0x4A,0x02,0xBC,0x6A,0xBC,
+    0x8B,0xC4,0xAC,0x81,0xCC,0xED,0x01,0xCC,0xCC,0xC4,0xAC,0x82,0xBC,0x8B,0x82,0xBC,
+    0xAC,0x0D,0xB4,0x8B,0xB4,0x6B,0xB4,0x4A,0xAC,0x0A,0xAB,0xE9,0xA3,0xE9,0xAC,0x09,
+    0xB4,0x4A,0xB4,0x6B,0xC4,0xAC,0xC4,0xED,0xCC,0xED,0xC4,0xED,0xCC,0xED,0x81,0xC4,
+    0xED,0x00,0xC4,0xCC,0x80,0xC4,0xAC,0x07,0xBC,0x8C,0xB4,0x4B,0xAC,0x4B,0xAC,0x8D,
+    0xDD,0xF5,0xEE,0xB8,0xEE,0xD9,0xEE,0xFA,0x82,0xEF,0x1A,0x80,0xBC,0xF1,0x00,0xBD,
+    0x11,0x80,0xBC,0xF1,0x80,0xBC,0xF0,0x04,0xBC,0xD0,0xB4,0xAF,0xBC,0xCF,0xBC,0xAF,
+    0xBC,0xCF,0x82,0xBC,0xAF,0x02,0xB4,0xAF,0xB4,0x8F,0xB4,0x8E,0x80,0xB4,0x6E,0x11,
+    0xAC,0x6E,0xAC,0x4E,0xA3,0xEC,0x93,0x6A,0x83,0x08,0x7A,0xA7,0x6A,0x45,0x6A,0x24,
+    0x62,0x04,0x62,0x03,0x59,0xE3,0x59,0xC2,0x51,0xA2,0x51,0xA1,0x59,0xE2,0x83,0x06,
+    0x9B,0xC9,0xA3,0xEA,0x80,0xA4,0x0A,0x00,0xA3,0xE9,0x80,0xA3,0xC9,0x80,0xA3,0xE8,
+    0x80,0xA3,0xE7,0x06,0xA3,0xC7,0xA3,0xE8,0xAB,0xE8,0xB4,0x29,0xB4,0x4A,0xBC,0x6B,
+    0xBC,0xAC,0x81,0xC4,0xCC,0x02,0xBC,0xAC,0xBC,0x8B,0xBC,0xAC,0x81,0xC4,0xCD,0x80,
+    0xC4,0xAC,0x80,0xBC,0xAC,0x01,0xC4,0xAC,0xBC,0xAC,0x80,0xBC,0x8B,0x0A,0xBC,0x6B,
+    0xB4,0x6A,0xB4,0x4A,0xB4,0x2A,0xAC,0x09,0xAB,0xE8,0xA3,0xE8,0xAB,0xE8,0xAC,0x29,
+    0xB4,0x2A,0xBC,0x6B,0x80,0xC4,0xAC,0x04,0xC4,0xCC,0xC4,0xAC,0xBC,0x6B,0xBC,0x4A,
+    0xB4,0x6A,0x80,0xBC,0x8B,0x81,0xBC,0xAC,0x0B,0xBC,0xAB,0xB4,0x8B,0xB4,0x6B,0xB4,
+    0x2A,0xAC,0x09,0xAB,0xE9,0xA3,0xE9,0xAC,0x09,0xB4,0x2A,0xB4,0x4A,0xBC,0xAC,0xC4,
+    0xCC,0x80,0xC4,0xED,0x00,0xCC,0xED,0x81,0xC4,0xED,0x00,0xC4,0xCC,0x80,0xC4,0xAC,
+    0x07,0xBC,0x8C,0xB4,0x6B,0xAC,0x4B,0xAC,0x8D,0xD5,0xD4,0xEE,0xB8,0xEE,0xD9,0xEE,
+    0xFA,0x82,0xEF,0x1A,0x82,0xA4,0x0C,0x81,0xAC,0x2C,0x82,0xA4,0x0C,0x00,0xA3,0xEC,
+    0x81,0xA3,0xEB,0x01,0x9B,0xEB,0x9B,0xCB,0x81,0x9B,0xAB,0x06,0x9B,0xAA,0x9B,0x8A,
+    0x93,0x8A,0x93,0x49,0x83,0x08,0x82,0xC7,0x7A,0x86,0x80,0x6A,0x24,0x10,0x62,0x04,
+    0x61,0xE3,0x59,0xE3,0x59,0xC2,0x51,0xA2,0x49,0x81,0x59,0xE2,0x7B,0x06,0x9B,0xCA,
+    0xAC,0x2B,0xB4,0x6C,0xB4,0x8C,0xB4,0x4B,0xAC,0x0A,0xAC,0x09,0xA3,0xE9,0xA3,0xE8,
+    0x80,0xA3,0xC7,0x81,0xA3,0xA7,0x03,0xAC,0x09,0xB4,0x4A,0xBC,0x8B,0xBC,0xAC,0x80,
+    0xC4,0xCC,0x05,0xC4,0xAC,0xBC,0xAC,0xBC,0x6B,0xBC,0x8C,0xC4,0xAC,0xC4,0xAD,0x80,
+    0xC4,0xAC,0x00,0xC4,0xCD,0x80,0xC4,0xED,0x05,0xC4,0xCC,0xBC,0xAC,0xBC,0x8C,0xBC,
+    0x6B,0xB4,0x6B,0xB4,0x4A,0x80,0xB4,0x2A,0x02,0xAC,0x09,0xAB,0xE8,0xAB,0xC8,0x80,
+    0xAB,0xE8,0x02,0xAC,0x09,0xB4,0x2A,0xBC,0x6B,0x80,0xBC,0x8B,0x00,0xBC,0x6B,0x81,
+    0xB4,0x4A,0x09,0xBC,0x8B,0xBC,0xAC,0xC4,0xAC,0xC4,0xCC,0xBC,0xAC,0xBC,0x8B,0xB4,
+    0x6B,0xB4,0x4A,0xB4,0x2A,0xAC,0x09,0x81,0xAB,0xE9,0x02,0xAC,0x2A,0xB4,0x2A,0xBC,
+    0x8B,0x80,0xC4,0xCC,0x02,0xC4,0xED,0xCD,0x0D,0xCC,0xED,0x80,0xC4,0xED,0x00,0xC4,
+    0xCD,0x80,0xC4,0xAC,0x07,0xBC,0x8C,0xB4,0x8C,0xAC,0x4B,0xAC,0x6D,0xD5,0xB3,0xEE,
+    0x98,0xEE,0xD9,0xEE,0xFA,0x82,0xEF,0x1A,0x00,0x93,0x8A,0x81,0x93,0x69,0x84,0x93,
+    0x8A,0x80,0x93,0x6A,0x82,0x93,0x69,0x82,0x93,0x49,0x1C,0x8B,0x28,0x93,0x28,0x93,
+    0x49,0x93,0x28,0x8A,0xE7,0x82,0xA6,0x7A,0x65,0x72,0x44,0x6A,0x24,0x62,0x04,0x61,
+    0xE3,0x59,0xE3,0x59,0xC2,0x51,0xA2,0x49,0x81,0x51,0xC2,0x7A,0xE6,0x9B,0xCA,0xAC,
+    0x4B,0xB4,0xAD,0xBC,0xAD,0xBC,0xAC,0xBC,0x8C,0xB4,0x6B,0xB4,0x4A,0xAC,0x09,0xA3,
+    0xE8,0xA3,0xC7,0xA3,0xA7,0x80,0x9B,0x66,0x02,0xA3,0xC8,0xB4,0x29,0xBC,0x6B,0x81,
+    0xBC,0xAC,0x07,0xBC,0x8C,0xBC,0x6B,0xB4,0x6B,0xBC,0x8C,0xBC,0xAC,0xBC,0xAD,0xBC,
+    0xAC,0xC4,0xAD,0x81,0xC4,0xCD,0x01,0xBC,0xAC,0xBC,0x8C,0x80,0xBC,0x6B,0x00,0xB4,
+    0x4B,0x81,0xB4,0x2A,0x01,0xB4,0x09,0xAC,0x09,0x81,0xAB,0xE8,0x01,0xAB,0xE9,0xB4,
+    0x09,0x81,0xBC,0x4A,0x04,0xB4,0x4A,0xB4,0x2A,0xB4,0x4A,0xB4,0x6A,0xBC,0x8B,0x80,
+    0xC4,0xCC,0x0F,0xC4,0xED,0xBC,0xAC,0xBC,0x8B,0xB4,0x6B,0xB4,0x4A,0xB4,0x2A,0xB4,
+    0x09,0xAB,0xE9,0xAB,0xC9,0xAB,0xE9,0xAC,0x09,0xAC,0x0A,0xBC,0x6B,0xBC,0xAC,0xC4,
+    0xCC,0xC4,0xED,0x80,0xCD,0x0D,0x02,0xCC,0xED,0xC4,0xED,0xC4,0xCD,0x80,0xC4,0xAC,
+    0x07,0xBC,0x8C,0xB4,0x6C,0xB4,0x4B,0xAC,0x6D,0xCD,0x72,0xE6,0x98,0xE6,0xD9,0xEE,
+    0xFA,0x82,0xEF,0x1A,0x00,0x8B,0x69,0x80,0x8B,0x48,0x00,0x8B,0x49,0x80,0x93,0x49,
+    0x80,0x8B,0x28,0x80,0x8B,0x08,0x00,0x8A,0xE8,0x80,0x8A,0xE7,0x80,0x8A,0xC7,0x00,
+    0x82,0xC7,0x80,0x82,0xA6,0x00,0x7A,0x86,0x80,0x7A,0x85,0x00,0x8A,0xE7,0x80,0x93,
+    0x28,0x11,0x8A,0xE7,0x82,0x86,0x7A,0x65,0x72,0x44,0x6A,0x24,0x6A,0x04,0x61,0xE4,
+    0x5A,0x03,0x59,0xC2,0x51,0xA2,0x49,0x81,0x51,0xC2,0x7A,0xC6,0x9B,0xCA,0xAC,0x4C,
+    0xB4,0x8D,0xBC,0xCD,0xBC,0xAD,0x80,0xBC,0xAC,0x0A,0xBC,0xAB,0xBC,0x6A,0xB4,0x4A,
+    0xAC,0x09,0xA3,0xC8,0x9B,0x87,0x93,0x46,0x9B,0x67,0xAB,0xC8,0xBC,0x4B,0xBC,0x6B,
+    0x80,0xBC,0x8C,0x81,0xB4,0x6B,0x01,0xBC,0x8C,0xBC,0xAC,0x81,0xBC,0xAD,0x80,0xC4,
+    0xAD,0x07,0xBC,0xAD,0xBC,0xAC,0xBC,0x8C,0xB4,0x6B,0xB4,0x2A,0xAC,0x0A,0xAB,0xE9,
+    0xB4,0x09,0x80,0xB4,0x4A,0x01,0xB4,0x2A,0xB4,0x29,0x81,0xAC,0x09,0x01,0xB4,0x29,
+    0xB4,0x4A,0x82,0xBC,0x4A,0x02,0xBC,0x6B,0xBC,0x8B,0xC4,0xCC,0x80,0xC4,0xEC,0x11,
+    0xC4,0xED,0xBC,0xAC,0xBC,0x8B,0xB4,0x6B,0xB4,0x4A,0xB4,0x2A,0xAC,0x0A,0xAB,0xE9,
+    0xA3,0xC8,0xA3,0xC9,0xAB,0xE9,0xAC,0x09,0xB4,0x6B,0xBC,0xAC,0xC4,0xCC,0xC4,0xED,
+    0xCD,0x0D,0xCC,0xED,0x80,0xC4,0xED,0x0A,0xC4,0xCC,0xC4,0xAC,0xBC,0xAC,0xBC,0x8C,
+    0xBC,0x6C,0xB4,0x4C,0xAC,0x6D,0xC5,0x31,0xE6,0x56,0xE6,0xD9,0xE6,0xF9,0x81,0xEF,
+    0x1A,0x00,0xEF,0x3A,0x80,0x93,0x68,0x80,0x93,0x69,0x00,0x93,0x89,0x80,0x93,0x69,
+    0x04,0x93,0x49,0x8B,0x08,0x8A,0xE7,0x8A,0xC7,0x82,0xC7,0x81,0x82,0xA6,0x00,0x7A,
+    0x86,0x80,0x7A,0x65,0x18,0x72,0x44,0x72,0x24,0x7A,0x65,0x92,0xE6,0x9B,0x27,0x93,
+    0x27,0x8A,0xC6,0x82,0x85,0x7A,0x44,0x72,0x44,0x6A,0x24,0x6A,0x04,0x62,0x03,0x59,
+    0xE3,0x51,0xC2,0x51,0xA2,0x51,0x81,0x59,0xE2,0x7A,0xE6,0x93,0xAA,0xA4,0x2B,0xB4,
+    0x8D,0xBC,0xCD,0xBC,0xAD,0xBC,0xAC,0x80,0xBC,0xCC,0x0A,0xBC,0xAB,0xBC,0x8B,0xB4,
+    0x49,0xAC,0x09,0xA3,0xC8,0x9B,0x87,0x9B,0x67,0xA3,0x87,0xAB,0xE9,0xB4,0x2A,0xB4,
+    0x2B,0x80,0xAC,0x4B,0x01,0xB4,0x4B,0xB4,0x6C,0x82,0xBC,0x8C,0x01,0xBC,0x8D,0xBC,
+    0xAD,0x80,0xC4,0xAD,0x03,0xBC,0xAC,0xBC,0x8C,0xB4,0x2A,0xAC,0x09,0x80,0xA3,0xC8,
+    0x05,0xAC,0x09,0xBC,0x6A,0xBC,0x6B,0xBC,0x6A,0xB4,0x6A,0xBC,0x6A,0x80,0xBC,0x8B,
+    0x00,0xC4,0x8B,0x83,0xC4,0xAC,0x0C,0xC4,0xCC,0xC4,0xEC,0xC4,0xED,0xCC,0xED,0xC4,
+    0xED,0xC4,0xEC,0xBC,0xAC,0xBC,0x8B,0xB4,0x6B,0xB4,0x4A,0xB4,0x2A,0xAC,0x09,0xA3,
+    0xE9,0x80,0xA3,0xC8,0x06,0xAB,0xE9,0xAC,0x09,0xB4,0x4A,0xBC,0x8B,0xC4,0xAC,0xC4,
+    0xED,0xCC,0xED,0x81,0xC4,0xED,0x02,0xC4,0xCC,0xC4,0xAC,0xBC,0xAC,0x80,0xBC,0x8C,
+    0x05,0xB4,0x6C,0xB4,0x6D,0xC5,0x10,0xDE,0x15,0xE6,0xD8,0xE6,0xF9,0x81,0xEF,0x1A,
+    0x01,0xEF,0x3A,0x82,0xC6,0x81,0x82,0xE6,0x05,0x83,0x07,0x8B,0x08,0x8B,0x28,0x8B,
+    0x08,0x82,0xE7,0x82,0xC7,0x80,0x82,0xA6,0x81,0x7A,0x86,0x11,0x7A,0x66,0x7A,0x65,
+    0x72,0x44,0x72,0x23,0x7A,0x24,0x8A,0xA5,0x9B,0x07,0x9B,0x27,0x9B,0x07,0x92,0xC6,
+    0x82,0x85,0x7A,0x64,0x72,0x44,0x6A,0x24,0x62,0x03,0x61,0xE3,0x59,0xE3,0x51,0xC3,
+    0x80,0x51,0xA2,0x07,0x59,0xE3,0x7A,0xE7,0x93,0xA9,0xA4,0x0B,0xAC,0x6C,0xBC,0xAD,
+    0xBC,0xCD,0xC4,0xCD,0x80,0xBC,0xCC,0x02,0xBC,0xAB,0xBC,0x8B,0xB4,0x4A,0x80,0xB4,
+    0x29,0x00,0xAB,0xE8,0x80,0xA3,0xA8,0x00,0xAB,0xE9,0x80,0xAC,0x0A,0x02,0xAC,0x2A,
+    0xAC,0x2B,0xAC,0x4B,0x83,0xB4,0x6C,0x0B,0xBC,0x8C,0xBC,0xAD,0xC4,0xAD,0xBC,0xAD,
+    0xBC,0xAC,0xBC,0x6B,0xB4,0x2A,0xAB,0xE9,0xA3,0xC8,0xA3,0xE8,0xB4,0x4A,0xBC,0x6B,
+    0x81,0xBC,0x8B,0x03,0xC4,0xAB,0xC4,0xCC,0xCC,0xED,0xCD,0x0D,0x80,0xD5,0x0D,0x00,
+    0xCD,0x0D,0x80,0xCC,0xED,0x82,0xCD,0x0D,0x08,0xC4,0xED,0xC4,0xCC,0xC4,0xAC,0xBC,
+    0xAB,0xBC,0x8B,0xB4,0x4A,0xB4,0x2A,0xAC,0x09,0xA3,0xE9,0x80,0xA3,0xC8,0x80,0xAC,
+    0x09,0x03,0xB4,0x4A,0xB4,0x6B,0xBC,0xAC,0xC4,0xCC,0x81,0xC4,0xED,0x80,0xC4,0xCC,
+    0x00,0xC4,0xAC,0x80,0xBC,0xAC,0x06,0xBC,0x8C,0xB4,0x6C,0xB4,0x6D,0xBC,0xEF,0xD5,
+    0xD4,0xE6,0xB8,0xE6,0xF9,0x81,0xEF,0x1A,0x00,0xEF,0x3A,
+};
+const lcd_image_t gImage_4_rle = {128, 128, LCD_IMG_RLE565, 0, RT_NULL, gImage_4_rle_data, sizeof(gImage_4_rle_data)};
+
+#endif /* DRIVER_PIC_RLE_H_ */
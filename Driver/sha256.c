@@ -0,0 +1,140 @@
+/**
+ * @file    sha256.c
+ * @brief   软件 SHA-256 (FIPS 180-4)
+ * @details 只依赖 rtthread.h 中的类型与内存函数，不使用动态内存，可以直接在主机上编译；
+ *          供凭据存储计算 PIN 哈希。计算时间只与输入长度有关，与数据内容无关
+ * @date    2025-12-20
+ */
+
+#include "sha256.h"
+
+#define ROR(x, n)   (((x) >> (n)) | ((x) << (32 - (n))))
+
+static const rt_uint32_t sha256_k[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+/* 压缩一个 64 字节数据块 */
+static void sha256_compress(rt_uint32_t state[8], const rt_uint8_t *p)
+{
+    rt_uint32_t w[64];
+    rt_uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        w[i] = ((rt_uint32_t)p[4 * i] << 24) | ((rt_uint32_t)p[4 * i + 1] << 16) |
+               ((rt_uint32_t)p[4 * i + 2] << 8) | p[4 * i + 3];
+    }
+    for (i = 16; i < 64; i++)
+    {
+        t1 = ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        t2 = ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        w[i] = w[i - 16] + t2 + w[i - 7] + t1;
+    }
+
+    a = state[0]; b = state[1]; c = state[2]; d = state[3];
+    e = state[4]; f = state[5]; g = state[6]; h = state[7];
+    for (i = 0; i < 64; i++)
+    {
+        t1 = h + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+static const rt_uint32_t sha256_iv[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+/* 中间哈希值按大端输出 */
+static void sha256_output(const rt_uint32_t state[8], rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        digest[4 * i]     = (rt_uint8_t)(state[i] >> 24);
+        digest[4 * i + 1] = (rt_uint8_t)(state[i] >> 16);
+        digest[4 * i + 2] = (rt_uint8_t)(state[i] >> 8);
+        digest[4 * i + 3] = (rt_uint8_t)(state[i]);
+    }
+}
+
+void sha256_init(sha256_ctx_t *ctx)
+{
+    rt_memcpy(ctx->state, sha256_iv, sizeof(sha256_iv));
+    ctx->length = 0;
+}
+
+void sha256_update(sha256_ctx_t *ctx, const void *data, rt_size_t len)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)data;
+    rt_size_t used = (rt_size_t)(ctx->length % SHA256_BLOCK_SIZE);
+
+    ctx->length += len;
+    while (len > 0)
+    {
+        rt_size_t n = SHA256_BLOCK_SIZE - used;
+
+        if (n > len) n = len;
+        rt_memcpy(ctx->block + used, p, n);
+        used += n;
+        p += n;
+        len -= n;
+        if (used == SHA256_BLOCK_SIZE)
+        {
+            sha256_compress(ctx->state, ctx->block);
+            used = 0;
+        }
+    }
+}
+
+void sha256_final(sha256_ctx_t *ctx, rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    rt_uint64_t bits = ctx->length * 8;
+    rt_size_t used = (rt_size_t)(ctx->length % SHA256_BLOCK_SIZE);
+    int i;
+
+    /* 补 0x80 与 0，最后 8 字节为大端位长度 */
+    ctx->block[used++] = 0x80;
+    if (used > SHA256_BLOCK_SIZE - 8)
+    {
+        rt_memset(ctx->block + used, 0, SHA256_BLOCK_SIZE - used);
+        sha256_compress(ctx->state, ctx->block);
+        used = 0;
+    }
+    rt_memset(ctx->block + used, 0, SHA256_BLOCK_SIZE - 8 - used);
+    for (i = 0; i < 8; i++)
+    {
+        ctx->block[SHA256_BLOCK_SIZE - 1 - i] = (rt_uint8_t)(bits >> (8 * i));
+    }
+    sha256_compress(ctx->state, ctx->block);
+    sha256_output(ctx->state, digest);
+}
+
+/**
+ * @brief  计算已按 SHA-256 规则填充为单个分组的短消息(不超过 55 字节)的哈希
+ * @param  block: 消息、0x80、0 与大端位长度组成的 64 字节分组
+ * @note   调用者预先填好分组中不变的部分，每次只改写可变字节，只需一次压缩
+ */
+void sha256_block_digest(const rt_uint8_t block[SHA256_BLOCK_SIZE], rt_uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    rt_uint32_t state[8];
+
+    rt_memcpy(state, sha256_iv, sizeof(sha256_iv));
+    sha256_compress(state, block);
+    sha256_output(state, digest);
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef DRIVER_SHA256_H_
+#define DRIVER_SHA256_H_
+
+#include <rtthread.h>
+
+#define SHA256_BLOCK_SIZE   64
+#define SHA256_DIGEST_SIZE  32
+
+/* 软件 SHA-256 上下文 */
+typedef struct
+{
+    rt_uint32_t state[8];                   /* 中间哈希值 */
+    rt_uint64_t length;                     /* 已输入字节数 */
+    rt_uint8_t  block[SHA256_BLOCK_SIZE];   /* 未满一块的输入 */
+} sha256_ctx_t;
+
+void sha256_init(sha256_ctx_t *ctx);
+void sha256_update(sha256_ctx_t *ctx, const void *data, rt_size_t len);
+void sha256_final(sha256_ctx_t *ctx, rt_uint8_t digest[SHA256_DIGEST_SIZE]);
+void sha256_block_digest(const rt_uint8_t block[SHA256_BLOCK_SIZE], rt_uint8_t digest[SHA256_DIGEST_SIZE]);
+
+#endif /* DRIVER_SHA256_H_ */
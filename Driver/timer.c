@@ -4,8 +4,9 @@
  * @details 基于RT-Thread平台的舵机控制模块
  *          实现功能：
  *          - PWM信号生成与控制
- *          - 舵机角度精确控制
- *          - 门锁开关状态管理
+ *          - 舵机角度精确控制：梯形/S 曲线运动轨迹，硬定时器逐周期更新脉宽
+ *          - 门锁开关状态管理：非阻塞状态机，定时器判定到位与自动上锁，事件通知动作完成，
+ *            到位上报与自动上锁计时在 lock 线程中完成，中断中不操作软定时器
  *          - 自动化硬件引脚配置
  * @author  移植自原项目
  * @date    2025-11-30
@@ -20,6 +21,11 @@
  * 舵机控制参数：
  * - 0度(上锁)：脉宽0.5ms
  * - 90度(开锁)：脉宽1.5ms
+ *
+ * 运动控制：
+ * 动作开始前按 SERVO_STEP_MS 把整个轨迹预先计算为归一化位置表，
+ * 硬定时器中断每个 PWM 周期只用整数插值出脉宽并更新比较寄存器(rt_pwm_set_pulse)，
+ * 不经过任何线程；最后一步输出满一个周期后判定到位并回调，动作结束时刻是确定的
  */
 
 /* 系统头文件 */
@@ -37,10 +43,261 @@
 #define PWM_PERIOD_NS       20000000    /* PWM周期：20ms = 20,000,000ns (50Hz) */
 #define PWM_MIN_NS          500000      /* 最小脉宽：0.5ms = 500,000ns (0度位置) */
 #define PWM_90_NS           1500000     /* 90度脉宽：1.5ms = 1,500,000ns (90度位置) */
+#define PWM_MAX_NS          2500000     /* 180度脉宽：2.5ms */
+
+#define SERVO_ANGLE_NS(a)   (PWM_MIN_NS + (rt_uint32_t)(a) * (PWM_MAX_NS - PWM_MIN_NS) / 180)
+#define SERVO_SHAPE_ONE     0x10000     /* 归一化位置 1.0 (Q16) */
+#define LOCK_ARRIVED_NONE   0xFF
+
+#define LOCK_THREAD_PRIO    10          /* 到位上报线程，高于按键与界面线程 */
+#define LOCK_THREAD_STACK   1024
 
 /* 全局变量 */
 static struct rt_device_pwm *servo_dev = RT_NULL;  /* PWM设备句柄 */
 
+/* 一次动作的预计算轨迹 */
+typedef struct
+{
+    rt_uint32_t shape[SERVO_MAX_STEPS];     /* 第 k 步的归一化位置(Q16)，最后一步为 SERVO_SHAPE_ONE */
+    rt_uint16_t steps;                      /* 步数 */
+    rt_uint32_t target;                     /* 目标脉宽(ns) */
+    void (*done)(void *parameter);          /* 到位回调 */
+    void *parameter;
+} servo_plan_t;
+
+static servo_plan_t servo_plan[2];                  /* 双缓冲：一个由定时器执行，另一个用于计算新动作 */
+static servo_plan_t *volatile servo_run = RT_NULL;  /* 定时器正在执行的轨迹，RT_NULL 表示静止 */
+static rt_uint32_t servo_from;                      /* 本次动作起点脉宽(ns) */
+static rt_uint32_t servo_pulse;                     /* 当前输出脉宽(ns) */
+static rt_uint16_t servo_step;                      /* 已输出的步数 */
+static struct rt_timer servo_timer;                 /* 每 SERVO_STEP_MS 输出一步 */
+
+static struct rt_timer lock_timer;                  /* 自动上锁定时器 */
+static struct rt_event lock_event;                  /* 动作完成事件 */
+static struct rt_semaphore lock_sem;                /* 中断通知 lock 线程上报到位 */
+static volatile rt_uint8_t lock_cur = LOCK_UNLOCKED;  /* 上电时舵机位置未知，按开锁处理，初始化时转到上锁位置 */
+static volatile rt_uint8_t lock_arrived = LOCK_ARRIVED_NONE;  /* 中断中记录的到位状态，等待 lock 线程上报 */
+static void (*lock_notify)(rt_uint8_t state) = RT_NULL;
+
+/* ===================== 舵机运动曲线 ===================== */
+
+/**
+ * @brief  计算归一化时间 u 处的归一化位置
+ * @param  u: 0 ~ SERVO_SHAPE_ONE
+ * @retval 0 ~ SERVO_SHAPE_ONE
+ */
+static rt_uint32_t servo_shape(rt_uint8_t profile, rt_uint32_t u)
+{
+    rt_uint64_t u2 = (rt_uint64_t)u * u >> 16;
+    rt_uint32_t w;
+
+    if (profile == SERVO_PROFILE_SCURVE)
+    {
+        /* s = u^3 * (10 - 15u + 6u^2)，在 [0,1] 内多项式恒为正；
+           u^3 与多项式都保留 Q24 再相乘舍入，先截断为 Q16 时起步段的小位移被舍为 0，结果也不单调 */
+        rt_uint64_t uu = (rt_uint64_t)u * u;
+        rt_uint64_t u3 = uu * u >> 24;
+        rt_uint64_t poly = ((10ULL << 32) + 6 * uu - 15ULL * u * SERVO_SHAPE_ONE) >> 8;
+        return (rt_uint32_t)((u3 * poly + (1ULL << 31)) >> 32);
+    }
+
+    /* 梯形：最大速度 1.5，加速段 s = 9u^2/4，匀速段 s = 3u/2 - 1/4，减速段与加速段对称 */
+    if (u <= SERVO_SHAPE_ONE / 3)
+    {
+        return (rt_uint32_t)(9 * u2 / 4);
+    }
+    if (u >= SERVO_SHAPE_ONE - SERVO_SHAPE_ONE / 3)
+    {
+        w = SERVO_SHAPE_ONE - u;
+        return SERVO_SHAPE_ONE - (rt_uint32_t)(9 * ((rt_uint64_t)w * w >> 16) / 4);
+    }
+    return 3 * u / 2 - SERVO_SHAPE_ONE / 4;
+}
+
+/* 输出轨迹的下一步，调用者已关中断或处于定时器中断中 */
+static void servo_output(const servo_plan_t *plan)
+{
+    rt_int64_t delta = (rt_int64_t)plan->target - (rt_int64_t)servo_from;
+
+    servo_pulse = (rt_uint32_t)((rt_int64_t)servo_from + delta * plan->shape[servo_step++] / SERVO_SHAPE_ONE);
+    rt_pwm_set_pulse(servo_dev, PWM_DEV_CHANNEL, servo_pulse);
+}
+
+/**
+ * @brief  运动定时器回调(硬定时器，中断上下文)
+ * @note   每个周期输出一步；最后一步输出满一个周期后停止定时器并调用到位回调
+ */
+static void servo_timeout(void *parameter)
+{
+    servo_plan_t *plan = servo_run;
+
+    if (plan == RT_NULL)
+    {
+        rt_timer_stop(&servo_timer);
+        return;
+    }
+    if (servo_step < plan->steps)
+    {
+        servo_output(plan);
+        return;
+    }
+
+    servo_run = RT_NULL;
+    rt_timer_stop(&servo_timer);
+    if (plan->done != RT_NULL) plan->done(plan->parameter);
+}
+
+/**
+ * @brief  舵机按运动曲线转到指定角度
+ * @param  angle:     目标角度 0 ~ 180
+ * @param  ms:        动作时间，按 SERVO_STEP_MS 取整，限制在 1 ~ SERVO_MAX_STEPS 步
+ * @param  profile:   SERVO_PROFILE_TRAPEZOID 或 SERVO_PROFILE_SCURVE
+ * @param  done:      到位回调，在硬定时器中断中调用，不能阻塞；可为 RT_NULL
+ * @retval RT_EOK: 已开始，-RT_ERROR: PWM设备不可用
+ * @note   第一步立即输出，动作在调用后 ms 毫秒时到位；
+ *         动作过程中再次调用时从当前位置开始新动作，原动作的回调不再调用
+ */
+rt_err_t servo_move(rt_uint8_t angle, rt_uint32_t ms, rt_uint8_t profile,
+                    void (*done)(void *parameter), void *parameter)
+{
+    servo_plan_t *plan;
+    rt_uint32_t steps, k;
+    rt_base_t level;
+
+    if (servo_dev == RT_NULL) return -RT_ERROR;
+    if (angle > 180) angle = 180;
+    steps = ms / SERVO_STEP_MS;
+    if (steps < 1) steps = 1;
+    if (steps > SERVO_MAX_STEPS) steps = SERVO_MAX_STEPS;
+
+    /* 锁定调度器使各线程的调用互斥；定时器中断只访问 servo_run 指向的轨迹，另一份可以直接改写 */
+    rt_enter_critical();
+    plan = (servo_run == &servo_plan[0]) ? &servo_plan[1] : &servo_plan[0];
+    for (k = 0; k < steps; k++)
+    {
+        plan->shape[k] = servo_shape(profile, (k + 1) * SERVO_SHAPE_ONE / steps);
+    }
+    plan->steps = steps;
+    plan->target = SERVO_ANGLE_NS(angle);
+    plan->done = done;
+    plan->parameter = parameter;
+
+    level = rt_hw_interrupt_disable();
+    servo_from = servo_pulse;
+    servo_step = 0;
+    servo_run = plan;
+    servo_output(plan);
+    rt_timer_start(&servo_timer);   /* 重新开始计时，下一步在一个周期后输出 */
+    rt_hw_interrupt_enable(level);
+    rt_exit_critical();
+
+    return RT_EOK;
+}
+
+/**
+ * @brief  舵机是否正在运动
+ */
+rt_bool_t servo_busy(void)
+{
+    return servo_run != RT_NULL;
+}
+
+/* ===================== 门锁状态机 ===================== */
+
+/* 重新设置定时器超时时间并启动，只在线程或软定时器中调用 */
+static void lock_timer_arm(rt_uint32_t ms)
+{
+    rt_tick_t tick = rt_tick_from_millisecond(ms);
+
+    rt_timer_stop(&lock_timer);
+    rt_timer_control(&lock_timer, RT_TIMER_CTRL_SET_TIME, &tick);
+    rt_timer_start(&lock_timer);
+}
+
+/**
+ * @brief  舵机到位回调(硬定时器中断中执行)
+ * @note   立即更新状态并发出完成事件，自动上锁计时、打印与通知交给 lock 线程
+ */
+static void lock_done(void *parameter)
+{
+    rt_uint8_t target = (rt_uint8_t)(rt_ubase_t)parameter;
+
+    lock_cur = target;
+    lock_arrived = target;
+    rt_event_send(&lock_event, target == LOCK_LOCKED ? LOCK_EVT_LOCKED : LOCK_EVT_UNLOCKED);
+    rt_sem_release(&lock_sem);
+}
+
+/* 开始转动到目标位置，调用者已锁定调度器 */
+static void lock_move(rt_uint8_t target)
+{
+    rt_event_control(&lock_event, RT_IPC_CMD_RESET, RT_NULL);  /* 清除上一次的完成事件 */
+    rt_timer_stop(&lock_timer);                                 /* 取消自动上锁计时 */
+    lock_arrived = LOCK_ARRIVED_NONE;
+    if (target == LOCK_LOCKED)
+    {
+        /* === 上锁操作：舵机转到0度位置 === */
+        lock_cur = LOCK_LOCKING;
+        servo_move(LOCK_ANGLE_LOCKED, LOCK_MOVE_MS, LOCK_PROFILE, lock_done, (void *)(rt_ubase_t)LOCK_LOCKED);
+    }
+    else
+    {
+        /* === 开锁操作：舵机转到90度位置 === */
+        lock_cur = LOCK_UNLOCKING;
+        servo_move(LOCK_ANGLE_UNLOCKED, LOCK_MOVE_MS, LOCK_PROFILE, lock_done, (void *)(rt_ubase_t)LOCK_UNLOCKED);
+    }
+}
+
+/**
+ * @brief  自动上锁定时器回调(软定时器线程中执行)
+ * @note   开锁保持超时：开始转回上锁位置
+ */
+static void lock_timeout(void *parameter)
+{
+    rt_enter_critical();
+    if (lock_arrived == LOCK_ARRIVED_NONE && lock_cur == LOCK_UNLOCKED)
+    {
+        lock_move(LOCK_LOCKED);  /* 自动上锁 */
+    }
+    rt_exit_critical();
+}
+
+/**
+ * @brief  到位上报线程入口函数
+ * @note   等待 lock_done 的通知：开锁到位时启动自动上锁计时，打印并调用 lock_notify。
+ *         通知处理前已经开始新动作时 lock_arrived 已被清除，本次不上报
+ */
+static void lock_thread_entry(void *parameter)
+{
+    rt_uint8_t done;
+    rt_base_t level;
+
+    while (1)
+    {
+        if (rt_sem_take(&lock_sem, RT_WAITING_FOREVER) != RT_EOK) continue;
+
+        rt_enter_critical();
+        level = rt_hw_interrupt_disable();
+        done = lock_arrived;
+        lock_arrived = LOCK_ARRIVED_NONE;
+        rt_hw_interrupt_enable(level);
+
+        if (done == LOCK_UNLOCKED && LOCK_HOLD_MS > 0) lock_timer_arm(LOCK_HOLD_MS);
+        rt_exit_critical();
+
+        /* 到位事件已由 lock_done 发送；这里再发送可能晚于新动作的 lock_move，置上过时的状态 */
+        if (done == LOCK_LOCKED)
+        {
+            rt_kprintf("Door Locked (0 deg)\n");  /* 调试信息输出 */
+        }
+        else if (done == LOCK_UNLOCKED)
+        {
+            rt_kprintf("Door Unlocked (90 deg)\n");
+        }
+        if (done != LOCK_ARRIVED_NONE && lock_notify != RT_NULL) lock_notify(done);
+    }
+}
+
 /* ===================== PWM初始化函数 ===================== */
 
 /**
@@ -48,13 +305,15 @@ static struct rt_device_pwm *servo_dev = RT_NULL;  /* PWM设备句柄 */
  * @note   函数职责：
  *         1. 查找并获取PWM设备句柄
  *         2. 使能指定的PWM输出通道
- *         3. 设置舵机初始状态为上锁位置
+ *         3. 输出上锁位置脉宽并请求上锁(不等待到位)
  *         4. 输出初始化状态信息
  *
  * @attention 该函数保持原有函数名以确保兼容性
  */
 void TIM2_PWM_Init(void)
 {
+    rt_thread_t tid;
+
     /* ========== 步骤1：查找PWM设备 ========== */
     servo_dev = (struct rt_device_pwm *)rt_device_find(PWM_DEV_NAME);
     if (servo_dev == RT_NULL)
@@ -67,8 +326,21 @@ void TIM2_PWM_Init(void)
     /* ========== 步骤2：使能PWM输出通道 ========== */
     rt_pwm_enable(servo_dev, PWM_DEV_CHANNEL);
 
+    /* 设置周期与初始脉宽，之后的动作只更新脉宽 */
+    servo_pulse = SERVO_ANGLE_NS(LOCK_ANGLE_LOCKED);
+    rt_pwm_set(servo_dev, PWM_DEV_CHANNEL, PWM_PERIOD_NS, servo_pulse);
+    rt_timer_init(&servo_timer, "servo", servo_timeout, RT_NULL, rt_tick_from_millisecond(SERVO_STEP_MS),
+                  RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+
+    rt_event_init(&lock_event, "lock", RT_IPC_FLAG_PRIO);
+    rt_timer_init(&lock_timer, "lock", lock_timeout, RT_NULL, rt_tick_from_millisecond(LOCK_HOLD_MS),
+                  RT_TIMER_FLAG_ONE_SHOT | RT_TIMER_FLAG_SOFT_TIMER);
+    rt_sem_init(&lock_sem, "lock", 0, RT_IPC_FLAG_PRIO);
+    tid = rt_thread_create("lock", lock_thread_entry, RT_NULL, LOCK_THREAD_STACK, LOCK_THREAD_PRIO, 10);
+    if (tid != RT_NULL) rt_thread_startup(tid);
+
     /* ========== 步骤3：设置初始状态 ========== */
-    lock(1);  /* 默认上锁状态，确保系统安全 */
+    lock_request(LOCK_LOCKED);  /* 默认上锁状态，确保系统安全 */
 
     /* ========== 步骤4：输出初始化成功信息 ========== */
     rt_kprintf("PWM Init Success! Servo Ready.\n");
@@ -77,47 +349,100 @@ void TIM2_PWM_Init(void)
 /* ===================== 门锁控制功能函数 ===================== */
 
 /**
- * @brief  门锁控制函数
- * @param  enable: 门锁状态控制参数
- *                 1 = 上锁状态 (舵机转到0度位置)
- *                 0 = 开锁状态 (舵机转到90度位置)
- * @note   工作原理：
- *         - 通过调节PWM脉宽控制舵机转动角度
- *         - 舵机角度直接对应门锁的物理状态
- *         - 内置设备检查与自动初始化机制
- *         - 提供机械运动完成延时
+ * @brief  请求门锁动作(非阻塞)
+ * @param  target: LOCK_LOCKED 或 LOCK_UNLOCKED
+ * @retval RT_EOK: 已接受请求，-RT_ERROR: 未调用 TIM2_PWM_Init 或 PWM设备不可用
+ * @note   - 立即开始按 LOCK_PROFILE 曲线运动并返回，LOCK_MOVE_MS 后到位并发出完成事件
+ *         - 开锁到位后 LOCK_HOLD_MS 自动上锁
+ *         - 转动过程中可以随时改变目标；开锁保持期间再次请求开锁会重新计时
+ *         - 已处于目标状态时不做任何动作
  */
-void lock(rt_uint8_t enable)
+rt_err_t lock_request(rt_uint8_t target)
 {
     /* ========== 设备有效性检查 ========== */
-    if (servo_dev == RT_NULL)
+    /* 不在这里初始化：TIM2_PWM_Init 本身会调用 lock_request，必须先由 main 完成初始化 */
+    if (servo_dev == RT_NULL) return -RT_ERROR;
+
+    rt_enter_critical();
+    if (target == LOCK_LOCKED)
     {
-        /* 如果设备未初始化，尝试自动初始化 */
-        TIM2_PWM_Init();
-        if (servo_dev == RT_NULL)
+        if (lock_cur == LOCK_UNLOCKED || lock_cur == LOCK_UNLOCKING) lock_move(LOCK_LOCKED);
+    }
+    else
+    {
+        if (lock_cur == LOCK_LOCKED || lock_cur == LOCK_LOCKING) lock_move(LOCK_UNLOCKED);
+        else if (lock_cur == LOCK_UNLOCKED && lock_arrived == LOCK_ARRIVED_NONE && LOCK_HOLD_MS > 0)
         {
-            /* 初始化失败，安全退出 */
-            return;
+            lock_timer_arm(LOCK_HOLD_MS);  /* 到位上报完成后才进入保持计时 */
         }
     }
+    rt_exit_critical();
 
-    /* ========== 根据参数执行门锁控制 ========== */
-    if(enable == 1)
+    return RT_EOK;
+}
+
+/**
+ * @brief  等待门锁到达目标状态
+ * @param  target:  LOCK_LOCKED 或 LOCK_UNLOCKED
+ * @param  timeout: 最长等待时间(tick)
+ * @retval RT_EOK: 已到达，-RT_ETIMEOUT: 超时
+ * @note   等待期间开始的新动作(如自动上锁)会复位事件并以 -RT_ERROR 唤醒等待者，
+ *         此时按剩余时间继续等待，直到到达目标或超时
+ */
+rt_err_t lock_wait(rt_uint8_t target, rt_int32_t timeout)
+{
+    rt_tick_t start = rt_tick_get();
+    rt_int32_t left = timeout;
+    rt_err_t ret;
+
+    if (servo_dev == RT_NULL) return -RT_ERROR;
+    while (1)
     {
-        /* === 上锁操作：舵机转到0度位置 === */
-        rt_pwm_set(servo_dev, PWM_DEV_CHANNEL, PWM_PERIOD_NS, PWM_MIN_NS);
-        rt_kprintf("Door Locked (0 deg)\n");  /* 调试信息输出 */
+        ret = rt_event_recv(&lock_event, target == LOCK_LOCKED ? LOCK_EVT_LOCKED : LOCK_EVT_UNLOCKED,
+                            RT_EVENT_FLAG_OR, left, RT_NULL);
+        if (ret != -RT_ERROR) return ret;
+        if (timeout >= 0)
+        {
+            left = timeout - (rt_int32_t)(rt_tick_get() - start);
+            if (left <= 0) return -RT_ETIMEOUT;
+        }
     }
-    else
+}
+
+/**
+ * @brief  获取门锁当前状态
+ * @retval LOCK_UNLOCKED / LOCK_LOCKED / LOCK_UNLOCKING / LOCK_LOCKING
+ */
+rt_uint8_t lock_state(void)
+{
+    return lock_cur;
+}
+
+/**
+ * @brief  设置动作完成通知
+ * @param  notify: 每次到位(LOCK_LOCKED 或 LOCK_UNLOCKED)时在 lock 线程中调用，不能长时间阻塞
+ */
+void lock_set_notify(void (*notify)(rt_uint8_t state))
+{
+    lock_notify = notify;
+}
+
+/**
+ * @brief  门锁控制函数
+ * @param  enable: 门锁状态控制参数
+ *                 1 = 上锁状态 (舵机转到0度位置)
+ *                 0 = 开锁状态 (舵机转到90度位置)
+ * @note   阻塞版本：发出请求后等待舵机到位再返回；
+ *         开锁同样会在 LOCK_HOLD_MS 后自动上锁
+ */
+void lock(rt_uint8_t enable)
+{
+    rt_uint8_t target = enable == 1 ? LOCK_LOCKED : LOCK_UNLOCKED;
+
+    if (lock_request(target) == RT_EOK)
     {
-        /* === 开锁操作：舵机转到90度位置 === */
-        rt_pwm_set(servo_dev, PWM_DEV_CHANNEL, PWM_PERIOD_NS, PWM_90_NS);
-        rt_kprintf("Door Unlocked (90 deg)\n");  /* 调试信息输出 */
+        lock_wait(target, RT_WAITING_FOREVER);
     }
-
-    /* ========== 机械运动完成延时 ========== */
-    /* 舵机需要时间完成物理转动，延时300ms确保动作完成 */
-    rt_thread_mdelay(300);
 }
 
 /* ===================== STM32H7平台特殊配置 ===================== */
@@ -15,8 +15,43 @@
 /* 初始化 PWM 功能 */
 void TIM2_PWM_Init(void); // 保持你习惯的函数名，虽然底层实际是 TIM5
 
-/* 门锁控制函数 */
+/* 舵机运动曲线：动作前预先计算每个 PWM 周期的位置，由硬定时器逐周期写入脉宽 */
+#define SERVO_PROFILE_TRAPEZOID 0   /* 梯形速度：匀加速 1/3、匀速 1/3、匀减速 1/3 */
+#define SERVO_PROFILE_SCURVE    1   /* S 曲线(最小加加速度)：起止速度与加速度均为 0 */
+
+#define SERVO_STEP_MS       20      /* 每步时间，与 PWM 周期一致 */
+#define SERVO_MAX_STEPS     100     /* 单次动作最多步数(2 秒) */
+
+/* 舵机转到 angle 度(0~180)，用时 ms，到位后在硬定时器中断中调用 done(可为 RT_NULL)
+ * 动作过程中可以重新调用，新动作从当前位置开始，旧动作的 done 不再调用 */
+rt_err_t servo_move(rt_uint8_t angle, rt_uint32_t ms, rt_uint8_t profile,
+                    void (*done)(void *parameter), void *parameter);
+rt_bool_t servo_busy(void);
+
+/* 门锁状态 */
+#define LOCK_UNLOCKED       0   /* 已开锁 */
+#define LOCK_LOCKED         1   /* 已上锁 */
+#define LOCK_UNLOCKING      2   /* 正在转到开锁位置 */
+#define LOCK_LOCKING        3   /* 正在转到上锁位置 */
+
+#define LOCK_ANGLE_LOCKED   0       /* 上锁位置(度) */
+#define LOCK_ANGLE_UNLOCKED 90      /* 开锁位置(度) */
+#define LOCK_MOVE_MS        400     /* 开锁/上锁动作时间 */
+#define LOCK_PROFILE        SERVO_PROFILE_SCURVE
+#define LOCK_HOLD_MS        5000    /* 开锁到位后自动上锁的时间，0 表示不自动上锁 */
+
+/* 动作完成事件，lock_event 中对应位在动作完成时置位，开始新动作时清除 */
+#define LOCK_EVT_LOCKED     (1 << 0)
+#define LOCK_EVT_UNLOCKED   (1 << 1)
+
+/* 门锁控制函数(阻塞，等待舵机到位) */
 /* enable: 1 = 上锁 (0度), 0 = 开锁 (90度) */
 void lock(rt_uint8_t enable);
 
+/* 非阻塞门锁控制：立即返回，由定时器完成到位判定与自动上锁 */
+rt_err_t lock_request(rt_uint8_t target);
+rt_err_t lock_wait(rt_uint8_t target, rt_int32_t timeout);
+rt_uint8_t lock_state(void);
+void lock_set_notify(void (*notify)(rt_uint8_t state));
+
 #endif /* DRIVER_TIMER_H_ */
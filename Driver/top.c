@@ -0,0 +1,358 @@
+/**
+ * @file    top.c
+ * @brief   线程 CPU 占用与栈水位监视
+ * @details 为 msh 提供类似 top 的线程视图，用于查找占用 CPU 的线程和栈余量不足的线程：
+ *          - 调度钩子在每次线程切换时把 DWT 周期差累加到切出的线程，
+ *            不采样、不关心节拍，短于一个节拍的运行也能计入
+ *          - 空闲钩子每个节拍最多检查 TOP_SCAN_BYTES 字节的栈，从栈底向栈顶逐段
+ *            确认仍为创建时填充的 '#'，一轮结束得到该线程的历史最大栈用量，再换下一个线程
+ *          - 线程表为固定数组，线程删除时由对象钩子清除，超出 TOP_THREAD_MAX 的线程计入 "other"
+ *          - 钩子与栈扫描自身消耗的周期单独累计，在 top 中显示，正常应低于 1%
+ * @date    2025-12-20
+ *
+ * msh 命令：
+ *   top                            每秒刷新一次，按任意键退出
+ *   top <间隔ms> [次数]            指定刷新间隔，给出次数时输出指定次数后退出(不清屏，便于保存日志)
+ */
+
+#include "top.h"
+#include <rthw.h>
+#include <rtdevice.h>
+#include <board.h>
+#include <stdlib.h>
+
+#if TOP_ENABLE
+
+/* 目标板直接读 DWT 计数器；主机仿真没有该寄存器，使用 cputime 接口 */
+#if defined(__arm__) || defined(__ICCARM__)
+#define TOP_NOW()           (DWT->CYCCNT)
+#else
+#define TOP_NOW()           ((rt_uint32_t)clock_cpu_gettime())
+#endif
+
+/* 栈中距栈底第 i 个字节，栈底是最后才会被用到的一端 */
+#ifdef ARCH_CPU_STACK_GROWS_UPWARD
+#define TOP_STACK_BYTE(t, i)    (((const rt_uint8_t *)(t)->stack_addr)[(t)->stack_size - 1 - (i)])
+#else
+#define TOP_STACK_BYTE(t, i)    (((const rt_uint8_t *)(t)->stack_addr)[i])
+#endif
+
+#define TOP_POLL_MS         50          /* 刷新等待期间检查按键的间隔 */
+
+typedef struct
+{
+    rt_thread_t thread;                 /* RT_NULL 为空位 */
+    rt_uint64_t cycles;                 /* 累计运行周期 */
+    rt_uint64_t snap;                   /* 上次刷新时的 cycles */
+    rt_uint32_t free;                   /* 从未使用过的栈字节数，只会减小 */
+    rt_uint32_t scan;                   /* 本轮已确认未使用的字节数 */
+    rt_uint8_t  scanned;                /* 至少完成过一轮扫描，free 有效 */
+} top_slot_t;
+
+static top_slot_t top_slot[TOP_THREAD_MAX];
+static top_slot_t top_other;                    /* 线程表满时的线程 */
+static top_slot_t *top_cur = &top_other;        /* 正在运行的线程 */
+static rt_uint32_t top_last;                    /* 上次计入运行时间的时刻 */
+static rt_uint32_t top_scan_index;              /* 正在扫描栈的槽位 */
+static rt_tick_t top_scan_tick;                 /* 上次扫描的节拍 */
+static rt_uint64_t top_hook_cycles;             /* 调度钩子自身的耗时 */
+static rt_uint64_t top_scan_cycles;             /* 空闲钩子(栈扫描)自身的耗时 */
+static rt_bool_t top_started;
+static void (*top_chain)(struct rt_thread *from, struct rt_thread *to);
+
+/* 查找线程的槽位，没有则占用一个空位，表满时返回 "other"；调用者关中断 */
+static top_slot_t *top_find(rt_thread_t thread)
+{
+    top_slot_t *empty = RT_NULL;
+    int i;
+
+    for (i = 0; i < TOP_THREAD_MAX; i++)
+    {
+        if (top_slot[i].thread == thread) return &top_slot[i];
+        if (empty == RT_NULL && top_slot[i].thread == RT_NULL) empty = &top_slot[i];
+    }
+    if (empty == RT_NULL) return &top_other;
+
+    rt_memset(empty, 0, sizeof(*empty));
+    empty->thread = thread;
+    empty->free = thread->stack_size;
+    return empty;
+}
+
+/* 把当前线程到此刻为止的运行时间计入，调用者关中断 */
+static rt_uint32_t top_account(void)
+{
+    rt_uint32_t now = TOP_NOW();
+
+    top_cur->cycles += now - top_last;
+    top_last = now;
+    return now;
+}
+
+/* ===================== 内核钩子 ===================== */
+
+static void top_switch_hook(struct rt_thread *from, struct rt_thread *to)
+{
+    rt_uint32_t start = top_account();
+
+    top_cur = top_find(to);
+    top_hook_cycles += TOP_NOW() - start;
+
+    if (top_chain != RT_NULL) top_chain(from, to);
+}
+
+/* 扫描一段栈，一轮结束后换到下一个线程；调用者关中断 */
+static void top_stack_step(void)
+{
+    top_slot_t *slot = RT_NULL;
+    rt_thread_t thread;
+    rt_uint32_t end;
+    int n;
+
+    for (n = 0; n < TOP_THREAD_MAX; n++)
+    {
+        slot = &top_slot[top_scan_index];
+        if (slot->thread != RT_NULL && slot->thread->stack_addr != RT_NULL) break;
+        top_scan_index = (top_scan_index + 1) % TOP_THREAD_MAX;
+    }
+    if (n == TOP_THREAD_MAX) return;
+
+    thread = slot->thread;
+    end = slot->scan + TOP_SCAN_BYTES;
+    if (end > slot->free) end = slot->free;
+    while (slot->scan < end && TOP_STACK_BYTE(thread, slot->scan) == '#') slot->scan++;
+
+    /* 遇到用过的字节，或到达上一轮的水位(其上的字节已知用过)，本轮结束 */
+    if (slot->scan < end || slot->scan == slot->free)
+    {
+        slot->free = slot->scan;
+        slot->scan = 0;
+        slot->scanned = 1;
+        top_scan_index = (top_scan_index + 1) % TOP_THREAD_MAX;
+    }
+}
+
+static void top_idle_hook(void)
+{
+    rt_tick_t tick = rt_tick_get();
+    rt_uint32_t start;
+    rt_base_t level;
+
+    /* 每个节拍只做一次，同时让累计间隔远小于 32 位计数器的一圈 */
+    if (tick == top_scan_tick) return;
+    top_scan_tick = tick;
+
+    level = rt_hw_interrupt_disable();
+    start = top_account();
+    top_stack_step();
+    top_scan_cycles += TOP_NOW() - start;
+    rt_hw_interrupt_enable(level);
+}
+
+static void top_detach_hook(struct rt_object *object)
+{
+    rt_base_t level;
+    int i;
+
+    if ((object->type & ~RT_Object_Class_Static) != RT_Object_Class_Thread) return;
+
+    level = rt_hw_interrupt_disable();
+    for (i = 0; i < TOP_THREAD_MAX; i++)
+    {
+        if (top_slot[i].thread != (rt_thread_t)object) continue;
+        if (top_cur == &top_slot[i])
+        {
+            top_account();
+            top_cur = &top_other;
+        }
+        top_slot[i].thread = RT_NULL;
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/* 为已经存在的线程建立槽位，之后创建的线程在第一次切入时建立 */
+static void top_sync(void)
+{
+    struct rt_object_information *info = rt_object_get_information(RT_Object_Class_Thread);
+    rt_list_t *node;
+    rt_base_t level;
+
+    if (info == RT_NULL) return;
+
+    level = rt_hw_interrupt_disable();
+    rt_list_for_each(node, &info->object_list)
+    {
+        top_find((rt_thread_t)rt_list_entry(node, struct rt_object, list));
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * @brief  安装内核钩子开始统计，重复调用无副作用
+ * @note   占用调度钩子、一个空闲钩子和对象删除钩子
+ */
+int top_init(void)
+{
+    rt_base_t level;
+
+    if (top_started) return RT_EOK;
+    top_started = RT_TRUE;
+
+    top_sync();
+    level = rt_hw_interrupt_disable();
+    top_last = TOP_NOW();
+    if (rt_thread_self() != RT_NULL) top_cur = top_find(rt_thread_self());
+    rt_hw_interrupt_enable(level);
+
+    rt_object_detach_sethook(top_detach_hook);
+    rt_scheduler_sethook(top_switch_hook);
+    return rt_thread_idle_sethook(top_idle_hook);
+}
+
+void top_sched_chain(void (*hook)(struct rt_thread *from, struct rt_thread *to))
+{
+    top_init();
+    top_chain = hook;
+}
+
+/* ===================== msh 命令 ===================== */
+
+#ifdef RT_USING_FINSH
+static rt_bool_t top_key_pressed(void)
+{
+    rt_device_t console = rt_console_get_device();
+    char ch;
+
+    return console != RT_NULL && rt_device_read(console, -1, &ch, 1) == 1;
+}
+
+static const char *top_stat_name(rt_thread_t thread)
+{
+    switch (RT_SCHED_CTX(thread).stat & RT_THREAD_STAT_MASK)
+    {
+    case RT_THREAD_READY:   return "ready";
+    case RT_THREAD_RUNNING: return "run";
+    case RT_THREAD_INIT:    return "init";
+    case RT_THREAD_CLOSE:   return "close";
+    default:                return "susp";
+    }
+}
+
+/* 以 1/scale 为单位的比例 */
+static rt_uint32_t top_ratio(rt_uint64_t part, rt_uint64_t total, rt_uint32_t scale)
+{
+    return total ? (rt_uint32_t)(part * scale / total) : 0;
+}
+
+/**
+ * 输出自上次调用以来的统计，print 为假时只记下起点
+ * 槽位的复制与起点的更新在同一次关中断中完成，两次输出之间的周期不会漏计或重计
+ */
+static void top_show(rt_bool_t print, rt_bool_t clear)
+{
+    static rt_uint64_t hook_snap, scan_snap;
+    static top_slot_t view[TOP_THREAD_MAX + 1];
+    rt_uint64_t delta[TOP_THREAD_MAX + 1], total = 0, hook, scan;
+    rt_uint8_t order[TOP_THREAD_MAX + 1];
+    rt_uint32_t used, pm, load, hook_bp, scan_bp;
+    rt_base_t level;
+    int i, k, n = 0;
+
+    level = rt_hw_interrupt_disable();
+    top_account();
+    for (i = 0; i <= TOP_THREAD_MAX; i++)
+    {
+        top_slot_t *slot = i < TOP_THREAD_MAX ? &top_slot[i] : &top_other;
+
+        view[i] = *slot;
+        slot->snap = slot->cycles;
+    }
+    hook = top_hook_cycles - hook_snap;
+    scan = top_scan_cycles - scan_snap;
+    hook_snap = top_hook_cycles;
+    scan_snap = top_scan_cycles;
+    rt_hw_interrupt_enable(level);
+
+    if (!print) return;
+
+    /* 按本周期运行时间从大到小排序 */
+    for (i = 0; i <= TOP_THREAD_MAX; i++)
+    {
+        if (i < TOP_THREAD_MAX && view[i].thread == RT_NULL) continue;
+        delta[i] = view[i].cycles - view[i].snap;
+        total += delta[i];
+        if (i == TOP_THREAD_MAX && delta[i] == 0) continue;
+        for (k = n++; k > 0 && delta[order[k - 1]] < delta[i]; k--) order[k] = order[k - 1];
+        order[k] = i;
+    }
+
+    load = 1000;
+    for (i = 0; i < TOP_THREAD_MAX; i++)
+    {
+        if (view[i].thread != RT_NULL && view[i].thread == rt_thread_idle_gethandler())
+            load -= top_ratio(delta[i], total, 1000);
+    }
+
+    hook_bp = top_ratio(hook, total, 10000);
+    scan_bp = top_ratio(scan, total, 10000);
+
+    if (clear) rt_kprintf("\033[H\033[J");
+    rt_kprintf("top: %u ms, cpu load %u.%u%%, monitor %u.%02u%% (switch %u.%02u%%, stack scan %u.%02u%%)\n",
+               (rt_uint32_t)(clock_cpu_microsecond(total) / 1000), load / 10, load % 10,
+               (hook_bp + scan_bp) / 100, (hook_bp + scan_bp) % 100,
+               hook_bp / 100, hook_bp % 100, scan_bp / 100, scan_bp % 100);
+    rt_kprintf("%-*.*s pri  stat    cpu%%  stack  max used\n", RT_NAME_MAX, RT_NAME_MAX, "thread");
+    rt_kprintf("%-*.*s ---  -----  -----  -----  ----------\n", RT_NAME_MAX, RT_NAME_MAX, "--------------------------------");
+
+    for (k = 0; k < n; k++)
+    {
+        i = order[k];
+        pm = top_ratio(delta[i], total, 1000);
+        if (i == TOP_THREAD_MAX)
+        {
+            rt_kprintf("%-*.*s               %3u.%u\n", RT_NAME_MAX, RT_NAME_MAX, "(other)", pm / 10, pm % 10);
+            continue;
+        }
+        rt_kprintf("%-*.*s %3d  %-5s  %3u.%u  %5u  ", RT_NAME_MAX, RT_NAME_MAX, view[i].thread->parent.name,
+                   RT_SCHED_PRIV(view[i].thread).current_priority, top_stat_name(view[i].thread),
+                   pm / 10, pm % 10, view[i].thread->stack_size);
+        if (!view[i].scanned || view[i].thread->stack_size == 0)
+        {
+            rt_kprintf("    -\n");
+            continue;
+        }
+        used = view[i].thread->stack_size - view[i].free;
+        pm = used * 100 / view[i].thread->stack_size;
+        rt_kprintf("%5u %3u%%%s\n", used, pm, pm >= TOP_STACK_WARN ? " !" : "");
+    }
+}
+
+static int top(int argc, char **argv)
+{
+    int interval = 1000, count = 0, i, t;
+
+    if (argc > 1) interval = atoi(argv[1]);
+    if (argc > 2) count = atoi(argv[2]);
+    if (interval < TOP_POLL_MS) interval = TOP_POLL_MS;
+
+    top_init();
+    top_sync();
+    top_show(RT_FALSE, RT_FALSE);
+    while (top_key_pressed()) {}
+
+    for (i = 0; count == 0 || i < count; i++)
+    {
+        for (t = 0; t < interval; t += TOP_POLL_MS)
+        {
+            if (top_key_pressed()) return 0;
+            rt_thread_mdelay(TOP_POLL_MS);
+        }
+        top_sync();
+        top_show(RT_TRUE, count == 0);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(top, thread cpu load and stack usage: top [interval_ms [count]]);
+#endif /* RT_USING_FINSH */
+
+#endif /* TOP_ENABLE */
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef DRIVER_TOP_H_
+#define DRIVER_TOP_H_
+
+#include <rtthread.h>
+
+/* 线程监视：调度钩子按 DWT 周期累计各线程运行时间，空闲钩子逐步扫描栈水位，msh 命令 top 显示 */
+#if defined(RT_USING_HOOK) && defined(RT_USING_IDLE_HOOK)
+#define TOP_ENABLE          1           /* 0=不编译监视服务 */
+#else
+#define TOP_ENABLE          0           /* 依赖内核的调度钩子与空闲钩子 */
+#endif
+#define TOP_THREAD_MAX      24          /* 最多统计的线程数，超出的线程计入 "other" */
+#define TOP_SCAN_BYTES      128         /* 每个节拍在空闲钩子中最多检查的栈字节数 */
+#define TOP_STACK_WARN      80          /* 栈水位超过该百分比时在 top 中标出 */
+
+#if TOP_ENABLE
+int top_init(void);
+/* 调度钩子只有一个，由本模块持有；其它需要线程切换通知的模块(trace.c)经此挂接，RT_NULL 取消 */
+void top_sched_chain(void (*hook)(struct rt_thread *from, struct rt_thread *to));
+#else
+#define top_init()                  (-RT_ENOSYS)
+#endif /* TOP_ENABLE */
+
+#endif /* DRIVER_TOP_H_ */
@@ -0,0 +1,342 @@
+/**
+ * @file    trace.c
+ * @brief   内核跟踪记录器
+ * @details 把内核事件和应用打点记录到 RAM 环形缓冲区，用于分析按键到开锁等延迟的去向：
+ *          - 线程切换、中断进出、IPC 获取/释放来自 RT_USING_HOOK 的内核钩子，
+ *            区间(trace_begin/trace_end)与瞬时事件(trace_mark)由应用在关键路径上打点
+ *          - 每个事件 12 字节，时间戳直接读取 DWT 周期计数器(由 cputime 组件开启)，
+ *            写入时只关一次中断，不做格式化和名称拷贝
+ *          - 每个 CPU 一个环形缓冲区，写满后覆盖最旧的事件，停止后保留最后 TRACE_RING_EVENTS 个
+ *          - 节拍中断默认不记录，改为每 TRACE_SYNC_TICKS 个节拍记录一次同步事件，
+ *            保证相邻事件间隔小于 32 位计数器的一圈(600MHz 约 7 秒)
+ * @date    2025-12-20
+ *
+ * 导出：trace dump 停止记录并以文本行输出到控制台(串口)，保存控制台日志后在主机上执行
+ *   python tools/trace2json.py console.log -o trace.json
+ * 生成的文件可用 chrome://tracing 或 ui.perfetto.dev 打开。
+ *
+ * msh 命令：
+ *   trace                          显示记录状态
+ *   trace start [类别...]          清空缓冲区并开始记录，类别为 sched irq tick ipc user all，
+ *                                  默认 sched irq ipc user
+ *   trace stop                     停止记录
+ *   trace dump                     停止记录并导出
+ */
+
+#include "trace.h"
+#include "top.h"
+#include <rthw.h>
+#include <rtdevice.h>
+#include <board.h>
+
+#if TRACE_ENABLE
+
+/* 目标板直接读 DWT 计数器与 IPSR；主机仿真没有这些寄存器，使用 cputime 接口 */
+#if defined(__arm__) || defined(__ICCARM__)
+#define TRACE_NOW()         (DWT->CYCCNT)
+#define TRACE_IRQ_NUM()     (__get_IPSR())
+#else
+#define TRACE_NOW()         ((rt_uint32_t)clock_cpu_gettime())
+#define TRACE_IRQ_NUM()     0
+#endif
+#define TRACE_IRQ_SYSTICK   15          /* SysTick 的异常号 */
+
+#ifdef RT_USING_SMP
+#define TRACE_CPU()         rt_hw_cpu_id()
+#else
+#define TRACE_CPU()         0
+#endif
+
+#define TRACE_NAME_MAX      64          /* 导出时去重的名称数，超出后重复输出 */
+
+/* 调度钩子只有一个，编译了 top 时由它持有，经它转发线程切换 */
+#if TOP_ENABLE
+#define TRACE_SCHED_SETHOOK(hook)   top_sched_chain(hook)
+#else
+#define TRACE_SCHED_SETHOOK(hook)   rt_scheduler_sethook(hook)
+#endif
+
+typedef struct
+{
+    trace_event_t ev[TRACE_RING_EVENTS];
+    rt_uint32_t head;                   /* 已写入的事件总数 */
+} trace_ring_t;
+
+static trace_ring_t trace_ring[RT_CPUS_NR];
+static volatile rt_uint32_t trace_classes;     /* 正在记录的类别，0 表示停止 */
+static rt_tick_t trace_sync_tick;               /* 上次同步事件的节拍 */
+
+/* 写入一个事件，中断与线程上下文都可以调用 */
+static void trace_put(rt_uint8_t type, rt_uint8_t flag, rt_ubase_t data, rt_uint16_t arg)
+{
+    trace_ring_t *ring;
+    trace_event_t *ev;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    ring = &trace_ring[TRACE_CPU()];
+    ev = &ring->ev[ring->head++ & (TRACE_RING_EVENTS - 1)];
+    ev->time = TRACE_NOW();
+    ev->data = data;
+    ev->type = type;
+    ev->flag = flag;
+    ev->arg  = arg;
+    rt_hw_interrupt_enable(level);
+}
+
+/* ===================== 内核钩子 ===================== */
+
+#ifdef RT_USING_HOOK
+static void trace_switch_hook(struct rt_thread *from, struct rt_thread *to)
+{
+    trace_put(TRACE_EV_SWITCH, 0, (rt_ubase_t)to, 0);
+}
+
+/* 节拍中断与其它中断分别由 TRACE_CLASS_TICK、TRACE_CLASS_IRQ 控制 */
+static rt_bool_t trace_irq_skip(rt_uint32_t irq)
+{
+    if (irq == TRACE_IRQ_SYSTICK) return !(trace_classes & TRACE_CLASS_TICK);
+    return !(trace_classes & TRACE_CLASS_IRQ);
+}
+
+static void trace_irq_enter_hook(void)
+{
+    rt_uint32_t irq = TRACE_IRQ_NUM();
+    rt_tick_t now;
+
+    if (irq == TRACE_IRQ_SYSTICK && !(trace_classes & TRACE_CLASS_TICK))
+    {
+        now = rt_tick_get();
+        if (now - trace_sync_tick >= TRACE_SYNC_TICKS)
+        {
+            trace_sync_tick = now;
+            trace_put(TRACE_EV_SYNC, 0, now, 0);
+        }
+    }
+    if (!trace_irq_skip(irq)) trace_put(TRACE_EV_IRQ_ENTER, 0, irq, 0);
+}
+
+static void trace_irq_leave_hook(void)
+{
+    rt_uint32_t irq = TRACE_IRQ_NUM();
+
+    if (!trace_irq_skip(irq)) trace_put(TRACE_EV_IRQ_LEAVE, 0, irq, 0);
+}
+
+static void trace_ipc(rt_uint8_t type, struct rt_object *object)
+{
+    trace_put(type, object->type & ~RT_Object_Class_Static, (rt_ubase_t)object, 0);
+}
+
+static void trace_trytake_hook(struct rt_object *object)
+{
+    trace_ipc(TRACE_EV_TRYTAKE, object);
+}
+
+static void trace_take_hook(struct rt_object *object)
+{
+    trace_ipc(TRACE_EV_TAKE, object);
+}
+
+static void trace_put_hook(struct rt_object *object)
+{
+    trace_ipc(TRACE_EV_PUT, object);
+}
+#endif /* RT_USING_HOOK */
+
+/* ===================== 记录控制 ===================== */
+
+/**
+ * @brief  清空缓冲区并开始记录
+ * @param  classes: TRACE_CLASS_xxx 的组合
+ * @note   内核钩子只在记录期间安装，停止后不留任何开销
+ */
+rt_err_t trace_start(rt_uint32_t classes)
+{
+    rt_base_t level;
+    int i;
+
+    if (classes == 0) return -RT_EINVAL;
+    trace_stop();
+
+    level = rt_hw_interrupt_disable();
+    for (i = 0; i < RT_CPUS_NR; i++) trace_ring[i].head = 0;
+    trace_sync_tick = rt_tick_get();
+    trace_classes = classes;
+    rt_hw_interrupt_enable(level);
+
+    /* 记下当前线程，转换时从它开始 */
+    if (rt_thread_self() != RT_NULL) trace_put(TRACE_EV_SWITCH, 0, (rt_ubase_t)rt_thread_self(), 0);
+
+#ifdef RT_USING_HOOK
+    if (classes & TRACE_CLASS_SCHED) TRACE_SCHED_SETHOOK(trace_switch_hook);
+    rt_interrupt_enter_sethook(trace_irq_enter_hook);
+    rt_interrupt_leave_sethook(trace_irq_leave_hook);
+    if (classes & TRACE_CLASS_IPC)
+    {
+        rt_object_trytake_sethook(trace_trytake_hook);
+        rt_object_take_sethook(trace_take_hook);
+        rt_object_put_sethook(trace_put_hook);
+    }
+#endif
+    return RT_EOK;
+}
+
+void trace_stop(void)
+{
+    trace_classes = 0;
+#ifdef RT_USING_HOOK
+    TRACE_SCHED_SETHOOK(RT_NULL);
+    rt_interrupt_enter_sethook(RT_NULL);
+    rt_interrupt_leave_sethook(RT_NULL);
+    rt_object_trytake_sethook(RT_NULL);
+    rt_object_take_sethook(RT_NULL);
+    rt_object_put_sethook(RT_NULL);
+#endif
+}
+
+/* ===================== 应用打点 ===================== */
+
+static rt_uint8_t trace_context(void)
+{
+    return rt_interrupt_get_nest() ? TRACE_FLAG_ISR : 0;
+}
+
+void trace_begin(const char *name)
+{
+    if (trace_classes & TRACE_CLASS_USER) trace_put(TRACE_EV_BEGIN, trace_context(), (rt_ubase_t)name, 0);
+}
+
+void trace_end(const char *name)
+{
+    if (trace_classes & TRACE_CLASS_USER) trace_put(TRACE_EV_END, trace_context(), (rt_ubase_t)name, 0);
+}
+
+void trace_mark(const char *name, rt_uint16_t value)
+{
+    if (trace_classes & TRACE_CLASS_USER) trace_put(TRACE_EV_MARK, trace_context(), (rt_ubase_t)name, value);
+}
+
+/* ===================== 导出 ===================== */
+
+#ifdef RT_USING_FINSH
+/* 事件引用的名称，每个地址只输出一次 */
+static rt_ubase_t trace_names[TRACE_NAME_MAX];
+static rt_uint32_t trace_name_num;
+
+/**
+ * 输出格式，每行一条，其它控制台输出可以夹在中间：
+ *   trace: begin cpus=<n> res=<ns*1000000/周期>
+ *   N t|o|s <地址> <名称>               线程、IPC 对象、打点名称，先于引用它的事件输出
+ *   E <cpu> <时间> <data> <type> <flag> <arg>   十六进制，按时间顺序
+ *   trace: end
+ */
+static void trace_dump_name(const trace_event_t *ev)
+{
+    const struct rt_object *obj = (const struct rt_object *)ev->data;
+    rt_uint32_t i;
+
+    if (ev->type > TRACE_EV_MARK || ev->type == TRACE_EV_IRQ_ENTER || ev->type == TRACE_EV_IRQ_LEAVE) return;
+    if (ev->data == 0) return;
+    for (i = 0; i < trace_name_num; i++)
+    {
+        if (trace_names[i] == ev->data) return;
+    }
+    if (trace_name_num < TRACE_NAME_MAX) trace_names[trace_name_num++] = ev->data;
+
+    if (ev->type == TRACE_EV_SWITCH)
+        rt_kprintf("N t %lx %.*s\n", ev->data, RT_NAME_MAX, obj->name);
+    else if (ev->type >= TRACE_EV_BEGIN)
+        rt_kprintf("N s %lx %s\n", ev->data, (const char *)ev->data);
+    else
+        rt_kprintf("N o %lx %.*s\n", ev->data, RT_NAME_MAX, obj->name);
+}
+
+static void trace_dump(void)
+{
+    const trace_event_t *ev;
+    rt_uint32_t i, n, head;
+    int cpu;
+
+    trace_stop();
+    trace_name_num = 0;
+    rt_kprintf("trace: begin cpus=%d res=%u\n", RT_CPUS_NR, (rt_uint32_t)clock_cpu_getres());
+    for (cpu = 0; cpu < RT_CPUS_NR; cpu++)
+    {
+        head = trace_ring[cpu].head;
+        n = head < TRACE_RING_EVENTS ? head : TRACE_RING_EVENTS;
+        for (i = head - n; i != head; i++)
+        {
+            ev = &trace_ring[cpu].ev[i & (TRACE_RING_EVENTS - 1)];
+            trace_dump_name(ev);
+            rt_kprintf("E %x %x %lx %x %x %x\n", cpu, ev->time, ev->data, ev->type, ev->flag, ev->arg);
+        }
+    }
+    rt_kprintf("trace: end\n");
+}
+
+static const struct
+{
+    const char *name;
+    rt_uint32_t classes;
+} trace_class_names[] =
+{
+    {"sched", TRACE_CLASS_SCHED},
+    {"irq",   TRACE_CLASS_IRQ},
+    {"tick",  TRACE_CLASS_TICK},
+    {"ipc",   TRACE_CLASS_IPC},
+    {"user",  TRACE_CLASS_USER},
+    {"all",   TRACE_CLASS_DEFAULT | TRACE_CLASS_TICK},
+};
+
+static int trace(int argc, char **argv)
+{
+    rt_uint32_t classes = 0, head;
+    int i, k;
+
+    if (argc < 2)
+    {
+        rt_kprintf("trace %s, classes 0x%02x\n", trace_classes ? "running" : "stopped", trace_classes);
+        for (i = 0; i < RT_CPUS_NR; i++)
+        {
+            head = trace_ring[i].head;
+            rt_kprintf("cpu%d: %u events, %u overwritten\n", i,
+                       head < TRACE_RING_EVENTS ? head : TRACE_RING_EVENTS,
+                       head > TRACE_RING_EVENTS ? head - TRACE_RING_EVENTS : 0);
+        }
+    }
+    else if (!rt_strcmp(argv[1], "start"))
+    {
+        for (i = 2; i < argc; i++)
+        {
+            for (k = 0; k < sizeof(trace_class_names) / sizeof(trace_class_names[0]); k++)
+            {
+                if (!rt_strcmp(argv[i], trace_class_names[k].name)) break;
+            }
+            if (k == sizeof(trace_class_names) / sizeof(trace_class_names[0]))
+            {
+                rt_kprintf("unknown class: %s\n", argv[i]);
+                return -RT_EINVAL;
+            }
+            classes |= trace_class_names[k].classes;
+        }
+        trace_start(classes ? classes : TRACE_CLASS_DEFAULT);
+    }
+    else if (!rt_strcmp(argv[1], "stop"))
+    {
+        trace_stop();
+    }
+    else if (!rt_strcmp(argv[1], "dump"))
+    {
+        trace_dump();
+    }
+    else
+    {
+        rt_kprintf("usage: trace [start [sched|irq|tick|ipc|user|all]... | stop | dump]\n");
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(trace, kernel trace: trace [start [classes...] | stop | dump]);
+#endif /* RT_USING_FINSH */
+
+#endif /* TRACE_ENABLE */
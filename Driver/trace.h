@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef DRIVER_TRACE_H_
+#define DRIVER_TRACE_H_
+
+#include <rtthread.h>
+
+/* 内核跟踪：内核钩子与应用打点写入每个 CPU 一个的 RAM 环形缓冲区，
+   时间戳为 DWT 周期计数，msh 命令 trace 控制与导出，tools/trace2json.py 转换为 Chrome trace */
+#define TRACE_ENABLE        1           /* 0=打点接口编译为空 */
+#define TRACE_RING_EVENTS   4096        /* 每个 CPU 的事件数，必须是2的幂 */
+#define TRACE_SYNC_TICKS    1000        /* 不记录节拍中断时，每隔这些节拍记录一次同步事件 */
+
+/* 事件类型 */
+#define TRACE_EV_SWITCH     1           /* 线程切换，data 为切入的线程 */
+#define TRACE_EV_IRQ_ENTER  2           /* 进入中断，data 为异常号 */
+#define TRACE_EV_IRQ_LEAVE  3           /* 退出中断，data 为异常号 */
+#define TRACE_EV_TRYTAKE    4           /* 开始获取 IPC 对象，data 为对象，flag 为对象类型 */
+#define TRACE_EV_TAKE       5           /* 获得 IPC 对象 */
+#define TRACE_EV_PUT        6           /* 释放 IPC 对象 */
+#define TRACE_EV_BEGIN      7           /* 区间开始，data 为名称 */
+#define TRACE_EV_END        8           /* 区间结束 */
+#define TRACE_EV_MARK       9           /* 瞬时事件，data 为名称，arg 为附加值 */
+#define TRACE_EV_SYNC       10          /* 同步事件，data 为系统节拍 */
+
+#define TRACE_FLAG_ISR      0x80        /* 区间、瞬时事件：在中断上下文中记录 */
+
+/* 记录类别，trace start 的参数 */
+#define TRACE_CLASS_SCHED   0x01        /* 线程切换 */
+#define TRACE_CLASS_IRQ     0x02        /* 中断进出(不含节拍中断) */
+#define TRACE_CLASS_TICK    0x04        /* 节拍中断进出 */
+#define TRACE_CLASS_IPC     0x08        /* IPC 获取与释放 */
+#define TRACE_CLASS_USER    0x10        /* 应用区间与瞬时事件 */
+#define TRACE_CLASS_DEFAULT (TRACE_CLASS_SCHED | TRACE_CLASS_IRQ | TRACE_CLASS_IPC | TRACE_CLASS_USER)
+
+/* 跟踪事件，目标板上为 12 字节 */
+typedef struct
+{
+    rt_uint32_t time;                   /* DWT 周期计数 */
+    rt_ubase_t  data;                   /* 线程、对象或名称的地址，或异常号 */
+    rt_uint8_t  type;                   /* TRACE_EV_xxx */
+    rt_uint8_t  flag;                   /* 对象类型或 TRACE_FLAG_xxx */
+    rt_uint16_t arg;                    /* 瞬时事件的附加值 */
+} trace_event_t;
+
+#if TRACE_ENABLE
+rt_err_t trace_start(rt_uint32_t classes);
+void trace_stop(void);
+/* name 必须是常量字符串：只记录地址，导出时才读取内容 */
+void trace_begin(const char *name);
+void trace_end(const char *name);
+void trace_mark(const char *name, rt_uint16_t value);
+#else
+#define trace_start(classes)        (-RT_ENOSYS)
+#define trace_stop()
+#define trace_begin(name)
+#define trace_end(name)
+#define trace_mark(name, value)
+#endif /* TRACE_ENABLE */
+
+#endif /* DRIVER_TRACE_H_ */
@@ -35,19 +35,18 @@
 #include "lcd.h"         /* lcd显示驱动 */
 #include "key.h"         /* 4x4矩阵键盘驱动 */
 #include "timer.h"       /* 舵机PWM控制驱动 */
-#include "pic.h"         /* 图像资源数据定义 */
+#include "cred.h"        /* PIN 凭据存储 */
+#include "audit.h"       /* 审计日志 */
+#include "trace.h"       /* 跟踪打点 */
+#include "top.h"         /* 线程 CPU 占用与栈水位监视 */
+#include "pic_rle.h"     /* 图像资源数据定义(压缩格式，由 pic.h 经 tools/img2rle.py 生成) */
 
 /* ===================== 全局变量定义 ===================== */
 
-/**
- * @brief 系统预设密码数组
- * @note  6位密码：{1, 2, 3, 4, 5, 6}，可根据需求修改
- */
-u8 password[6] = {1, 2, 3, 4, 5, 6};
-
 /**
  * @brief 用户输入密码临时存储数组
  * @note  数组大小为7，支持6位密码输入 + 1位结束标志
+ *        只由按键线程读写，界面通过 ui_set_digits() 获得快照
  */
 u8 key_temp[7] = {0};
 
@@ -57,36 +56,211 @@ u8 key_temp[7] = {0};
  */
 u8 key_index = 0;
 
+/* ===================== 界面命令队列 ===================== */
+
+/* 界面命令 */
+#define UI_CMD_SCREEN           0       /* 切换整屏界面，arg 为 UI_SCREEN_xxx */
+#define UI_CMD_PROMPT           1       /* 显示顶部提示文字，text 为提示内容 */
+#define UI_CMD_DIGITS           2       /* 密码输入框有更新，内容在 ui_digits 中 */
+#define UI_CMD_READY            3       /* 开机动画结束，arg 为 1 表示屏幕可用，为 0 时不再绘制 */
+#define UI_CMD_HOME             4       /* 定时器或通知回调请求返回主界面，请求在 ui_home_pending 中 */
+
+/* 整屏界面 */
+#define UI_SCREEN_HOME          0       /* 主界面背景 */
+#define UI_SCREEN_UNLOCKED      1       /* 开锁成功 */
+#define UI_SCREEN_ERROR         2       /* 密码错误 */
+#define UI_SCREEN_NONE          0xFF
+
+#define UI_MQ_DEPTH             8       /* 队列深度 */
+
+typedef struct
+{
+    u8 cmd;                 /* UI_CMD_xxx */
+    u8 arg;                 /* 命令参数 */
+    const char *text;       /* UI_CMD_PROMPT: 提示文字，必须是静态字符串 */
+} ui_msg_t;
+
+static rt_mq_t ui_mq = RT_NULL;
+
+/*
+ * 密码输入框只需要显示最新内容，不进入队列：按键线程覆盖写入，
+ * 界面线程每帧最后取走。dirty 表示有尚未绘制的更新
+ */
+static struct
+{
+    u8 dirty;
+    u8 len;
+    u8 digits[6];
+} ui_digits;
+
+/*
+ * 定时器与门锁通知回调中不能阻塞，返回主界面的请求只置此标志，界面线程取完队列后处理。
+ * 之后发送的整屏命令会清除尚未处理的请求
+ */
+static u8 ui_home_pending;
+
+#define UI_HOME_PROMPT          "门已上锁，请输入密码"
+
 /**
- * @brief 上一次密码位数状态记录
- * @note  用于LCD界面刷新判断，初始值255确保首次刷新
+ * @brief  向界面线程发送切换界面、提示文字等命令
+ * @note   这些命令不能丢失，队列满时阻塞等待界面线程取走，只能在可以阻塞的线程中调用；
+ *         软定时器回调与门锁通知中返回主界面使用 ui_request_home()。
+ *         界面线程在开机动画期间也持续取命令，等待时间不超过一次合并的时间。
+ *         切换整屏界面会覆盖之前尚未绘制的输入框内容
  */
-u8 key_index_old = 255;
+static void ui_post(u8 cmd, u8 arg, const char *text)
+{
+    ui_msg_t msg;
 
-/* ===================== 辅助函数实现 ===================== */
+    if (ui_mq == RT_NULL) return;
+
+    if (cmd == UI_CMD_SCREEN)
+    {
+        rt_enter_critical();
+        ui_digits.dirty = 0;
+        ui_home_pending = 0;
+        rt_exit_critical();
+    }
+
+    rt_memset(&msg, 0, sizeof(msg));
+    msg.cmd  = cmd;
+    msg.arg  = arg;
+    msg.text = text;
+    rt_mq_send_wait(ui_mq, &msg, sizeof(msg), RT_WAITING_FOREVER);
+}
+
+/**
+ * @brief  更新密码输入框
+ * @param  digits: 已输入数字，len 为 0 时可以为 RT_NULL
+ * @param  len:    位数
+ * @note   不阻塞调用者。内容写入 ui_digits，队列中只发送唤醒命令；
+ *         队列满时唤醒命令可以丢弃，界面线程取完队列后总会检查 ui_digits
+ */
+static void ui_set_digits(const u8 *digits, u8 len)
+{
+    ui_msg_t msg;
+
+    if (ui_mq == RT_NULL) return;
+    if (len > sizeof(ui_digits.digits)) len = sizeof(ui_digits.digits);  /* 防止数组越界 */
+
+    rt_enter_critical();
+    if (digits != RT_NULL) rt_memcpy(ui_digits.digits, digits, len);
+    ui_digits.len   = len;
+    ui_digits.dirty = 1;
+    rt_exit_critical();
+
+    rt_memset(&msg, 0, sizeof(msg));
+    msg.cmd = UI_CMD_DIGITS;
+    rt_mq_send(ui_mq, &msg, sizeof(msg));
+}
 
 /**
- * @brief  密码字符串比较验证函数
- * @param  string1: 用户输入密码数组指针
- * @param  string2: 系统预设密码数组指针
- * @param  len:     要比较的字节长度
- * @retval 验证结果: 1=密码正确, 0=密码错误
- * @note   从数组末尾开始逆向比较，提高安全性
+ * @brief  请求返回主界面，可在软定时器回调与 lock 线程中调用
+ * @note   不阻塞调用者：请求写入 ui_home_pending，队列中只发送唤醒命令，
+ *         队列满时唤醒命令可以丢弃，界面线程取完队列后总会检查该标志。
+ *         与 ui_post(UI_CMD_SCREEN) 一样覆盖之前尚未绘制的输入框内容
  */
-u8 string_chek(u8* string1, u8* string2, u8 len)
+static void ui_request_home(void)
 {
-    /* 从末尾开始逆向比较每个字节 */
-    while(len--)
+    ui_msg_t msg;
+
+    if (ui_mq == RT_NULL) return;
+
+    rt_enter_critical();
+    ui_digits.dirty = 0;
+    ui_home_pending = 1;
+    rt_exit_critical();
+
+    rt_memset(&msg, 0, sizeof(msg));
+    msg.cmd = UI_CMD_HOME;
+    rt_mq_send(ui_mq, &msg, sizeof(msg));
+}
+
+/* ===================== 快速启动 ===================== */
+
+/* 启动动画节奏：定时器每 BOOT_SPLASH_TICK_MS 触发一帧 */
+#define BOOT_SPLASH_TICK_MS     10      /* 帧间隔 */
+#define BOOT_PROGRESS_STEP      4       /* 每帧进度条前进的像素列数，128列共32帧 */
+#define BOOT_SUCCESS_FRAMES     30      /* "启动成功"停留帧数 */
+#define BOOT_LOGO_FRAMES        60      /* Logo停留帧数 */
+
+/* 启动事件 */
+#define BOOT_EVT_TICK           (1 << 0)    /* 动画定时器节拍 */
+
+static struct rt_event boot_event;
+
+/* 启动过程中的关键时间点 */
+typedef enum
+{
+    BOOT_MAIN = 0,          /* 进入main */
+    BOOT_INPUT_READY,       /* 按键线程开始扫描 */
+    BOOT_PANEL_READY,       /* 屏幕完成复位与寄存器初始化 */
+    BOOT_UI_READY,          /* 主界面显示完成 */
+    BOOT_FIRST_KEY,         /* 第一次接受按键 */
+    BOOT_STAGE_NUM
+} boot_stage_t;
+
+static const char *const boot_stage_name[BOOT_STAGE_NUM] =
+{
+    "main entry", "keypad live", "panel ready", "main screen", "first key accepted"
+};
+static rt_tick_t boot_tick[BOOT_STAGE_NUM];
+
+/**
+ * @brief  记录启动时间点，每个时间点只记录第一次
+ * @param  stage: 时间点
+ */
+static void boot_trace(boot_stage_t stage)
+{
+    if (boot_tick[stage] != 0) return;
+    boot_tick[stage] = rt_tick_get();
+    if (boot_tick[stage] == 0) boot_tick[stage] = 1;  /* 0 表示尚未到达 */
+
+    if (stage == BOOT_FIRST_KEY)
     {
-        /* 如果当前位置字符相同，继续比较下一位 */
-        if(string1[len] == string2[len])
-            ;
-        else
-            /* 发现不匹配，立即返回失败 */
-            return 0;
+        rt_kprintf("[boot] first key accepted at %u ms\n",
+                   (rt_uint32_t)(boot_tick[stage] * 1000 / RT_TICK_PER_SECOND));
+    }
+}
+
+/* ===================== 门锁业务状态 ===================== */
+
+#define ALARM_SHOW_MS   1000    /* 密码错误画面显示时间 */
+
+static volatile u8 door_open = 0;       /* 1=密码正确后的开锁流程中，直到重新上锁 */
+static volatile u8 alarm_active = 0;    /* 1=正在显示密码错误画面 */
+static volatile u8 lock_by_key = 0;     /* 1=开锁期间按确认键上锁，否则为自动上锁 */
+static rt_uint32_t fail_count = 0;      /* 连续密码错误次数，记入审计日志 */
+static struct rt_timer alarm_timer;     /* 错误画面显示计时 */
+
+/* 通知界面线程返回主界面(按键线程中调用，可以阻塞) */
+static void ui_show_home(void)
+{
+    ui_post(UI_CMD_SCREEN, UI_SCREEN_HOME, RT_NULL);
+    ui_post(UI_CMD_PROMPT, 0, UI_HOME_PROMPT);
+    ui_set_digits(RT_NULL, 0);
+}
+
+/* 门锁到位通知(lock 线程中调用，不能阻塞)：开锁流程结束、重新上锁后返回主界面 */
+static void door_lock_notify(rt_uint8_t state)
+{
+    trace_mark("lock_arrive", state);
+    if (state == LOCK_LOCKED && door_open)
+    {
+        if (!lock_by_key) audit_log(AUDIT_USER_NONE, AUDIT_RESULT_LOCK, AUDIT_METHOD_AUTO, 0);
+        door_open = 0;
+        ui_request_home();
+    }
+}
+
+/* 错误画面显示时间到，返回主界面(软定时器线程中执行，不能阻塞) */
+static void alarm_timeout(void *parameter)
+{
+    if (alarm_active)
+    {
+        alarm_active = 0;
+        ui_request_home();
     }
-    /* 所有位都匹配，返回成功 */
-    return 1;
 }
 
 /* ===================== RT-Thread线程入口函数 ===================== */
@@ -95,38 +269,57 @@ u8 string_chek(u8* string1, u8* string2, u8 len)
  * @brief  按键扫描与业务逻辑处理线程入口函数
  * @param  parameter: RT-Thread线程参数(未使用)
  * @note   线程功能：
- *         1. 4x4矩阵键盘扫描与按键处理
+ *         1. 读取消抖后的按键事件并处理
  *         2. 密码输入逻辑控制
- *         3. 门锁开关控制
- *         4. LCD界面状态切换
+ *         3. 门锁开关控制：只发出非阻塞请求，开锁保持与自动上锁由 timer.c 完成，
+ *            开锁期间与错误画面期间仍然接受按键
+ *         4. 通过界面命令队列通知 lcd_show 线程绘制，本线程不直接操作屏幕
  *         线程优先级：20 (中等优先级)
- *         扫描周期：10ms
+ *         按键来源：key_event_get()，无按键时线程阻塞
  */
 void key_process_thread_entry(void *parameter)
 {
     /* 局部变量定义 */
-    u8 key_val, key_old = 0, key_down;  /* 按键状态变量 */
+    key_event_t evt;                    /* 按键事件 */
+    u8 key_down;                        /* 按下的键值 */
     u8 i = 0;                           /* 循环计数器 */
 
-    /* -------------------- 外设初始化 -------------------- */
-    key_init();      /* 初始化4x4矩阵键盘GPIO */
-    TIM2_PWM_Init(); /* 初始化舵机PWM控制(底层使用TIM5) */
+    /* 键盘与舵机已在 main 中初始化，扫描与消抖由 key_scan 线程完成 */
+    boot_trace(BOOT_INPUT_READY);
 
     /* -------------------- 主循环 -------------------- */
     while (1)
     {
-        /* 读取当前按键状态 */
-        key_val = key_read();
-
-        /* 按键消抖与下降沿检测算法 */
-        /* key_down = 当前按下 AND (当前状态 XOR 上次状态) */
-        /* 只有在按键从释放到按下的瞬间，key_down才为真 */
-        key_down = key_val & (key_val ^ key_old);
-        key_old = key_val;  /* 保存当前状态供下次比较 */
+        /* 阻塞等待按键事件，只处理消抖后的按下事件 */
+        if (key_event_get(&evt, RT_WAITING_FOREVER) != RT_EOK) continue;
+        if (evt.type != KEY_EVT_PRESS) continue;
+        key_down = evt.key;
 
         /* 检测到有效按键按下 */
         if (key_down)
         {
+            boot_trace(BOOT_FIRST_KEY);
+
+            /* 开锁期间：确认键立即上锁，其它按键忽略 */
+            if (door_open)
+            {
+                if (key_down == 15 && !lock_by_key)
+                {
+                    lock_by_key = 1;
+                    audit_log(AUDIT_USER_NONE, AUDIT_RESULT_LOCK, AUDIT_METHOD_KEY, 0);
+                    lock_request(LOCK_LOCKED);
+                }
+                continue;
+            }
+
+            /* 错误画面期间：提前返回主界面，本次按键照常处理 */
+            if (alarm_active)
+            {
+                alarm_active = 0;
+                rt_timer_stop(&alarm_timer);
+                ui_show_home();
+            }
+
             /* 根据按键值执行相应操作 */
             switch(key_down)
             {
@@ -149,6 +342,7 @@ void key_process_thread_entry(void *parameter)
                     if (key_index < 6) {
                         key_temp[key_index] = num;   /* 存储数字 */
                         key_index++;                 /* 递增位数计数 */
+                        ui_set_digits(key_temp, key_index);
                     }
                 }
                 break;
@@ -158,6 +352,7 @@ void key_process_thread_entry(void *parameter)
                     if (key_index < 6) {
                         key_temp[key_index] = 0;     /* 存储数字0 */
                         key_index++;                 /* 递增位数计数 */
+                        ui_set_digits(key_temp, key_index);
                     }
                 break;
 
@@ -166,93 +361,285 @@ void key_process_thread_entry(void *parameter)
                    key_index = 0;                    /* 重置输入计数 */
                    /* 清空整个输入缓冲区 */
                    for(i=0; i<7; i++) key_temp[i] = 0;
+                   ui_set_digits(RT_NULL, 0);
                 break;
 
                 /* ========== 确认键处理 ========== */
                 case 15:  /* 第四行第三列：确认键 */
+                {
+                    int user = -1;
+                    u8 len = key_index;
+
                     key_index = 0;  /* 重置输入计数，准备下次输入 */
 
-                    /* 调用密码验证函数 */
-                    if(string_chek(key_temp, password, 6))
+                    /* 只有输满 CRED_PIN_LEN 位才查找，位数不足按密码错误处理(key_temp 以 0 补齐，不能参与比较) */
+                    if (len == CRED_PIN_LEN)
+                    {
+                        trace_begin("pin_verify");
+                        user = cred_verify(key_temp);
+                        trace_end("pin_verify");
+                    }
+                    if(user >= 0)
                     {
                         /* ===== 密码正确：开锁流程 ===== */
-                        lock(0);  /* 舵机转到开锁位置 */
-                        LCD_ShowPicture(0, 0, 128, 128, gImage_3);  /* 显示开锁成功图片 */
-                        rt_thread_mdelay(5000);  /* 显示5秒钟 */
-
-                        /* 自动关锁并返回主界面 */
-                        lock(1);  /* 舵机转到关锁位置 */
-                        LCD_ShowPicture(0, 0, 128, 128, gImage_2);  /* 显示主界面背景 */
-                        LCD_ShowChinese(0, 0, (u8*)"门已上锁，请输入密码", BLUE, WHITE, 16, 0);
+                        audit_log((rt_uint16_t)user, AUDIT_RESULT_OK, AUDIT_METHOD_PIN, fail_count);
+                        fail_count = 0;
+                        lock_by_key = 0;
+                        /* 舵机开锁后保持 LOCK_HOLD_MS 自动上锁，上锁到位时 door_lock_notify 返回主界面 */
+                        door_open = 1;
+                        trace_mark("unlock", (rt_uint16_t)user);
+                        ui_post(UI_CMD_SCREEN, UI_SCREEN_UNLOCKED, RT_NULL);  /* 显示开锁成功图片 */
+                        if (lock_request(LOCK_UNLOCKED) != RT_EOK)  /* 舵机转到开锁位置 */
+                        {
+                            door_open = 0;
+                            ui_show_home();
+                        }
                     }
                     else
                     {
                         /* ===== 密码错误：报警流程 ===== */
-                        lock(1);  /* 确保门锁处于关闭状态 */
-                        LCD_ShowPicture(0, 0, 128, 128, gImage_4);  /* 显示错误警告图片 */
-                        rt_thread_mdelay(1000);  /* 显示1秒钟警告 */
-
-                        /* 返回主界面等待重新输入 */
-                        LCD_ShowPicture(0, 0, 128, 128, gImage_2);  /* 显示主界面背景 */
-                        LCD_ShowChinese(0, 0, (u8*)"门已上锁，请输入密码", BLUE, WHITE, 16, 0);
+                        audit_log(AUDIT_USER_NONE, AUDIT_RESULT_FAIL, AUDIT_METHOD_PIN, ++fail_count);
+                        ui_post(UI_CMD_SCREEN, UI_SCREEN_ERROR, RT_NULL);  /* 显示错误警告图片 */
+                        lock_request(LOCK_LOCKED);  /* 确保门锁处于关闭状态 */
+                        alarm_active = 1;
+                        rt_timer_start(&alarm_timer);  /* 显示1秒钟警告后返回主界面 */
                     }
                     /* 清空输入缓存，防止残留数据 */
                     for(i=0; i<7; i++) key_temp[i] = 0;
+                }
                 break;
             }
         }
+    }
+}
+
+/* 一帧内待绘制的内容，多条命令在此合并 */
+typedef struct
+{
+    u8 screen;              /* 待切换的界面，UI_SCREEN_NONE 表示不切换 */
+    const char *prompt;     /* 待显示的提示文字 */
+    u8 has_digits;          /* 是否需要刷新密码输入框 */
+    u8 len;                 /* 密码位数 */
+    u8 digits[6];           /* 密码数字 */
+} ui_frame_t;
+
+/* 合并一条命令：整屏界面会覆盖之前的提示，同类命令只保留最后一条 */
+static void ui_merge(ui_frame_t *f, const ui_msg_t *msg)
+{
+    switch (msg->cmd)
+    {
+    case UI_CMD_SCREEN:
+        f->screen = msg->arg;
+        f->prompt = RT_NULL;
+        break;
+    case UI_CMD_PROMPT:
+        f->prompt = msg->text;
+        break;
+    }
+}
+
+/* 取走返回主界面的请求：主界面、提示文字与空输入框，之后的输入框更新在其上绘制 */
+static void ui_take_home(ui_frame_t *f)
+{
+    rt_enter_critical();
+    if (ui_home_pending)
+    {
+        ui_home_pending = 0;
+        f->screen     = UI_SCREEN_HOME;
+        f->prompt     = UI_HOME_PROMPT;
+        f->has_digits = 1;
+        f->len        = 0;
+    }
+    rt_exit_critical();
+}
+
+/* 取走密码输入框的最新内容，放在本帧最后绘制 */
+static void ui_take_digits(ui_frame_t *f)
+{
+    rt_enter_critical();
+    if (ui_digits.dirty)
+    {
+        ui_digits.dirty = 0;
+        f->has_digits   = 1;
+        f->len          = ui_digits.len;
+        rt_memcpy(f->digits, ui_digits.digits, sizeof(f->digits));
+    }
+    rt_exit_critical();
+}
+
+/* 绘制整屏界面 */
+static void ui_draw_screen(u8 screen)
+{
+    switch (screen)
+    {
+    case UI_SCREEN_HOME:     LCD_ShowImageCompressed(0, 0, &gImage_2_rle); break;  /* 主界面背景 */
+    case UI_SCREEN_UNLOCKED: LCD_ShowImageCompressed(0, 0, &gImage_3_rle); break;  /* 开锁成功 */
+    case UI_SCREEN_ERROR:    LCD_ShowImageCompressed(0, 0, &gImage_4_rle); break;  /* 密码错误 */
+    }
+}
+
+/* 绘制密码输入框与已输入的数字 */
+static void ui_draw_digits(const u8 *digits, u8 len)
+{
+    u8 j;
 
-        /* 线程休眠10ms，控制按键扫描频率 */
-        rt_thread_mdelay(10);
+    /* 清除原有的密码输入区域，使用黄色背景 */
+    LCD_Fill(16, 45, 112, 60, YELLOW);
+
+    /* 将数字转换为ASCII字符并显示 */
+    /* 位置计算：起始X坐标20，每个字符间隔16像素 */
+    /* 颜色：红色字体，黄色背景，字体大小16，非叠加模式 */
+    for (j = 0; j < len; j++)
+    {
+        LCD_ShowChar(20 + 16*j, 45, digits[j] + 48, RED, YELLOW, 16, 0);
     }
 }
 
 /**
- * @brief  LCD界面刷新线程入口函数
+ * @brief  LCD界面绘制线程入口函数
  * @param  parameter: RT-Thread线程参数(未使用)
  * @note   线程功能：
- *         1. 监控密码输入状态变化
- *         2. 动态更新LCD显示内容
- *         3. 实时显示当前输入的密码位数
+ *         1. 阻塞等待界面命令队列，空闲时不占用CPU
+ *         2. 收到命令后取出队列中所有待处理命令合并为一帧，
+ *            密码输入框只取最新内容，连续输入的多个数字只绘制最后一次
+ *         3. 按界面、提示文字、输入框的顺序绘制后统一刷新到屏幕
+ *         4. 开机动画期间照常取命令合并，收到 UI_CMD_READY 后才开始绘制，
+ *            保证发送方不会因为队列满而长时间阻塞；屏幕初始化失败时只取命令不绘制
  *         线程优先级：21 (低于按键线程，确保按键响应优先)
- *         刷新周期：100ms
+ *         按键到屏幕更新的延迟只取决于绘制与SPI传输时间
  */
 void lcd_refresh_thread_entry(void *parameter)
 {
-    /* 等待主线程完成LCD初始化后再开始刷新任务 */
-    rt_thread_mdelay(500);
+    ui_msg_t msg;
+    ui_frame_t frame;
+    u8 ready = 0;           /* 已收到 UI_CMD_READY */
+    u8 panel = 0;           /* 屏幕初始化成功 */
+
+    frame.screen     = UI_SCREEN_NONE;
+    frame.prompt     = RT_NULL;
+    frame.has_digits = 0;
 
     /* -------------------- 主循环 -------------------- */
     while (1)
     {
-        /* 检查密码输入状态是否发生变化 */
-        if(key_index != key_index_old)
+        if (rt_mq_recv(ui_mq, &msg, sizeof(msg), RT_WAITING_FOREVER) <= 0) continue;
+
+        do
+        {
+            if (msg.cmd == UI_CMD_READY)
+            {
+                ready = 1;
+                panel = msg.arg;
+            }
+            else ui_merge(&frame, &msg);
+        } while (rt_mq_recv(ui_mq, &msg, sizeof(msg), RT_WAITING_NO) > 0);
+        ui_take_home(&frame);
+
+        /* 开机动画期间只合并命令，动画线程仍在绘制 */
+        if (!ready) continue;
+
+        ui_take_digits(&frame);
+        if (panel)
         {
-            /* ===== 刷新密码输入显示区域 ===== */
+            trace_begin("ui_frame");
+            if (frame.screen != UI_SCREEN_NONE) ui_draw_screen(frame.screen);
+            if (frame.prompt != RT_NULL) LCD_ShowChinese(0, 0, (u8*)frame.prompt, BLUE, WHITE, 16, 0);
+            if (frame.has_digits) ui_draw_digits(frame.digits, frame.len);
+
+            /* 将本帧改动的区域一次性推送到屏幕 */
+            LCD_Flush();
+            trace_end("ui_frame");
+        }
 
-            /* 清除原有的密码输入区域，使用黄色背景 */
-            LCD_Fill(16, 45, 112, 60, YELLOW);
+        frame.screen     = UI_SCREEN_NONE;
+        frame.prompt     = RT_NULL;
+        frame.has_digits = 0;
+    }
+}
 
-            /* 防止数组越界保护 */
-            if(key_index > 6) key_index = 6;
+/* ===================== 开机动画 ===================== */
 
-            /* 循环显示当前已输入的每一位密码 */
-            for(int j=0; j<key_index; j++)
-            {
-                /* 将数字转换为ASCII字符并显示 */
-                /* 位置计算：起始X坐标20，每个字符间隔16像素 */
-                /* 颜色：红色字体，黄色背景，字体大小16，非叠加模式 */
-                LCD_ShowChar(20 + 16*j, 45, key_temp[j] + 48, RED, YELLOW, 16, 0);
-            }
+/* 动画定时器回调：只发出节拍事件，绘制在动画线程中完成 */
+static void boot_splash_timeout(void *parameter)
+{
+    rt_event_send(&boot_event, BOOT_EVT_TICK);
+}
+
+/* 等待下一帧，定时器创建失败时退化为线程延时 */
+static void boot_splash_wait(rt_timer_t timer, u16 frames)
+{
+    while (frames--)
+    {
+        if (timer != RT_NULL)
+            rt_event_recv(&boot_event, BOOT_EVT_TICK, RT_EVENT_FLAG_OR | RT_EVENT_FLAG_CLEAR,
+                          RT_WAITING_FOREVER, RT_NULL);
+        else
+            rt_thread_mdelay(BOOT_SPLASH_TICK_MS);
+    }
+}
+
+/**
+ * @brief  屏幕初始化与开机动画线程入口函数
+ * @param  parameter: RT-Thread线程参数(未使用)
+ * @note   线程功能：
+ *         1. 屏幕复位、退出睡眠等约240ms的等待在本线程中进行，
+ *            与 main 中的键盘、舵机初始化并行
+ *         2. 由周期定时器驱动进度条、"启动成功"和Logo画面，
+ *            此时按键线程已经在工作，动画期间的输入不会丢失
+ *         3. 显示主界面后向界面线程发送 UI_CMD_READY，线程结束
+ *         线程优先级：21 (低于按键线程)
+ */
+static void boot_splash_thread_entry(void *parameter)
+{
+    rt_timer_t timer;
+    u16 col;
+    u8 panel = 0;
+
+    if (LCD_Init_RTT() == RT_EOK)
+    {
+        panel = 1;
+        boot_trace(BOOT_PANEL_READY);
 
-            /* 更新状态记录，避免重复刷新 */
-            key_index_old = key_index;
+        /* 清屏并显示启动提示文字 */
+        LCD_Fill(0, 0, 127, 127, WHITE);
+        LCD_ShowChinese(20, 50, (u8*)"正在启动", RED, WHITE, 16, 0);
+        LCD_Flush();
+
+        timer = rt_timer_create("splash", boot_splash_timeout, RT_NULL,
+                                rt_tick_from_millisecond(BOOT_SPLASH_TICK_MS),
+                                RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+        if (timer != RT_NULL) rt_timer_start(timer);
+
+        /* 进度条：从左到右，每帧前进 BOOT_PROGRESS_STEP 列，Y坐标从100到屏幕底部 */
+        for (col = 0; col < LCD_W; col += BOOT_PROGRESS_STEP)
+        {
+            boot_splash_wait(timer, 1);
+            LCD_Fill(col, 100, col + BOOT_PROGRESS_STEP, LCD_H, RED);
+            LCD_Flush();
         }
 
-        /* 线程休眠100ms，控制刷新频率 */
-        /* 较低的刷新频率可以节省CPU资源，提高整体系统性能 */
-        rt_thread_mdelay(100);
+        /* 启动完成提示 */
+        LCD_ShowChinese(20, 50, (u8*)"启动成功", RED, WHITE, 16, 0);
+        LCD_Flush();
+        boot_splash_wait(timer, BOOT_SUCCESS_FRAMES);
+
+        /* 显示产品Logo */
+        LCD_ShowImageCompressed(0, 0, &gImage_1_rle);  /* 全屏显示Logo图片 */
+        LCD_Flush();
+        boot_splash_wait(timer, BOOT_LOGO_FRAMES);
+
+        if (timer != RT_NULL) rt_timer_delete(timer);
+
+        /* 进入主界面，此时 lcd_show 线程尚未开始绘制，可以直接使用界面绘制函数 */
+        ui_draw_screen(UI_SCREEN_HOME);     /* 显示主界面背景图片 */
+        LCD_ShowChinese(0, 0, (u8*)UI_HOME_PROMPT, BLUE, WHITE, 16, 0);  /* 显示提示文字 */
+        ui_draw_digits(RT_NULL, 0);         /* 绘制黄色密码输入框 */
+        LCD_Flush();                        /* 启用帧缓冲时，绘制结果在此统一推送到屏幕 */
+        boot_trace(BOOT_UI_READY);
     }
+
+    /* 屏幕初始化失败时也要放行，门锁功能不依赖显示，界面线程只取命令不绘制 */
+    ui_post(UI_CMD_READY, panel, RT_NULL);
 }
 
 /* ===================== 系统主函数 ===================== */
@@ -260,52 +647,43 @@ void lcd_refresh_thread_entry(void *parameter)
 /**
  * @brief  系统主函数 - RT-Thread应用程序入口
  * @retval RT_EOK: 系统初始化成功
- * @note   主函数职责：
- *         1. 硬件外设初始化
- *         2. LCD显示系统初始化
- *         3. 启动画面与用户界面初始化
- *         4. 创建并启动多线程任务
- *         5. 系统向量表重映射配置
+ * @note   分阶段快速启动：
+ *         1. 启动屏幕线程，面板复位等待与后续初始化并行
+ *         2. 键盘与舵机初始化(只在这里初始化一次)
+ *         3. 创建按键与界面绘制线程，按键立即可用，不等待开机动画
+ *         启动各阶段耗时可用 msh 命令 boot_time 查看
  */
 int main(void)
 {
-    /* ==================== 阶段1：硬件初始化 ==================== */
-    key_init();        /* 初始化4x4矩阵键盘GPIO配置 */
-    TIM2_PWM_Init();   /* 初始化舵机PWM控制器(实际使用TIM5) */
-    lock(1);           /* 系统启动时默认处于上锁状态，确保安全 */
+    boot_trace(BOOT_MAIN);
+    top_init();        /* 从启动开始统计各线程的运行时间与栈用量 */
+    rt_event_init(&boot_event, "boot", RT_IPC_FLAG_PRIO);
 
-    /* ==================== 阶段2：LCD显示系统初始化 ==================== */
-    LCD_Init_RTT();    /* 初始化ST7735S液晶驱动，配置SPI通信 */
-    LCD_Fill(0, 0, 127, 127, WHITE);  /* 清屏：全屏填充白色背景 */
+    /* 界面命令队列，按键线程、定时器与开机动画线程发送，lcd_show 线程接收 */
+    ui_mq = rt_mq_create("ui", sizeof(ui_msg_t), UI_MQ_DEPTH, RT_IPC_FLAG_FIFO);
 
-    /* ==================== 阶段3：开机启动动画 ==================== */
-    /* 显示启动提示文字 */
-    LCD_ShowChinese(20, 50, (u8*)"正在启动", RED, WHITE, 16, 0);
-
-    /* 绘制进度条动画效果 */
-    u8 i = 0;
-    while(i < 128)  /* 从左到右绘制128像素宽的进度条 */
+    /* ==================== 阶段1：屏幕初始化与开机动画(后台) ==================== */
+    /* 线程名称："lcd_boot"，栈大小：2048字节，优先级：21，时间片：10 */
+    rt_thread_t tid_boot = rt_thread_create("lcd_boot", boot_splash_thread_entry, RT_NULL, 2048, 21, 10);
+    if (tid_boot != RT_NULL)
     {
-        /* 绘制垂直红色线条，Y坐标从100到128 */
-        LCD_DrawLine(i, 100, i, 128, RED);
-        rt_thread_mdelay(10);  /* 每画一条线延时10ms，形成动态效果 */
-        i++;
+        rt_thread_startup(tid_boot);
+    }
+    else
+    {
+        ui_post(UI_CMD_READY, 0, RT_NULL);
     }
 
-    /* 启动完成提示 */
-    LCD_ShowChinese(20, 50, (u8*)"启动成功", RED, WHITE, 16, 0);
-    rt_thread_mdelay(500);  /* 显示500ms */
-
-    /* 显示产品Logo */
-    LCD_ShowPicture(0, 0, 128, 128, gImage_1);  /* 全屏显示Logo图片 */
-    rt_thread_mdelay(1000);  /* Logo显示1秒 */
-
-    /* ==================== 阶段4：进入主界面 ==================== */
-    LCD_ShowPicture(0, 0, 128, 128, gImage_2);  /* 显示主界面背景图片 */
-    LCD_ShowChinese(0, 0, (u8*)"门已上锁，请输入密码", BLUE, WHITE, 16, 0);  /* 显示提示文字 */
-    LCD_Fill(16, 45, 112, 60, YELLOW);  /* 绘制黄色密码输入框 */
+    /* ==================== 阶段2：键盘与舵机初始化 ==================== */
+    key_init();        /* 初始化4x4矩阵键盘GPIO配置 */
+    TIM2_PWM_Init();   /* 初始化舵机PWM控制器(实际使用TIM5)，内部请求上锁，不等待舵机到位 */
+    cred_init();       /* 加载凭据存储并建立索引，分区不可用时只接受内置 PIN */
+    audit_init();      /* 挂载审计日志并启动提交线程，分区不可用时不记录 */
+    lock_set_notify(door_lock_notify);
+    rt_timer_init(&alarm_timer, "alarm", alarm_timeout, RT_NULL, rt_tick_from_millisecond(ALARM_SHOW_MS),
+                  RT_TIMER_FLAG_ONE_SHOT | RT_TIMER_FLAG_SOFT_TIMER);
 
-    /* ==================== 阶段5：创建多线程任务 ==================== */
+    /* ==================== 阶段3：创建多线程任务 ==================== */
 
     /* 创建按键处理线程 */
     /* 线程名称："key_logic"，入口函数：key_process_thread_entry */
@@ -316,19 +694,41 @@ int main(void)
         rt_thread_startup(tid_key);  /* 启动按键线程 */
     }
 
-    /* 创建LCD刷新线程 */
+    /* 创建LCD界面绘制线程 */
     /* 线程名称："lcd_show"，入口函数：lcd_refresh_thread_entry */
     /* 栈大小：2048字节，优先级：21，时间片：10 */
     rt_thread_t tid_lcd = rt_thread_create("lcd_show", lcd_refresh_thread_entry, RT_NULL, 2048, 21, 10);
     if (tid_lcd != RT_NULL)
     {
-        rt_thread_startup(tid_lcd);  /* 启动LCD刷新线程 */
+        rt_thread_startup(tid_lcd);  /* 启动LCD界面绘制线程 */
+    }
+    else
+    {
+        ui_mq = RT_NULL;             /* 没有线程接收命令，发送方不再等待队列 */
     }
 
     /* 主函数执行完毕，系统转入多线程调度模式 */
     return RT_EOK;
 }
 
+/**
+ * @brief  msh命令：输出启动各阶段的时间点
+ */
+static int boot_time(void)
+{
+    int i;
+    for (i = 0; i < BOOT_STAGE_NUM; i++)
+    {
+        if (boot_tick[i])
+            rt_kprintf("%-20s %6u ms\n", boot_stage_name[i],
+                       (rt_uint32_t)(boot_tick[i] * 1000 / RT_TICK_PER_SECOND));
+        else
+            rt_kprintf("%-20s %9s\n", boot_stage_name[i], "-");
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(boot_time, show boot stage timestamps);
+
 /* ===================== STM32H7平台特殊配置 ===================== */
 
 #include "stm32h7rsxx.h"  /* STM32H7RS系列芯片寄存器定义 */
@@ -10,6 +10,7 @@
 #include <rtthread.h>
 #include "stm32h7rsxx.h"
 #include "board.h"
+#include "drv_dmabuf.h"
 
 int mpu_init(void)
 {
@@ -84,12 +85,15 @@ int mpu_init(void)
 
     HAL_MPU_ConfigRegion(&MPU_InitStruct);
 
-    /** Initializes and configures the Region and the memory to be protected
+    /** AHB SRAM, which holds the DMA buffer pool (drv_dmabuf.c): normal memory,
+        non-cacheable, so buffers shared with the DMA need no cache maintenance
     */
     MPU_InitStruct.Number = MPU_REGION_NUMBER5;
-    MPU_InitStruct.BaseAddress = 0x30000000;
-    MPU_InitStruct.Size = MPU_REGION_SIZE_32KB;
-    MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    MPU_InitStruct.BaseAddress = DMABUF_POOL_ADDR;
+    MPU_InitStruct.Size = DMABUF_POOL_MPU_SIZE;
+    MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+    MPU_InitStruct.IsShareable = MPU_ACCESS_SHAREABLE;
+    MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
     MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
 
     HAL_MPU_ConfigRegion(&MPU_InitStruct);
@@ -46,7 +46,8 @@ extern struct fal_flash_dev nor_flash0;
     {FAL_PART_MAGIC_WORD, "bt_image",   NOR_FLASH_DEV_NAME,    512*1024,     512*1024, 0}, \
     {FAL_PART_MAGIC_WORD, "download",   NOR_FLASH_DEV_NAME,   1024*1024,  2*1024*1024, 0}, \
     {FAL_PART_MAGIC_WORD, "easyflash",  NOR_FLASH_DEV_NAME, 3*1024*1024,  1*1024*1024, 0}, \
-    {FAL_PART_MAGIC_WORD, "filesystem", NOR_FLASH_DEV_NAME, 4*1024*1024, 12*1024*1024, 0}, \
+    {FAL_PART_MAGIC_WORD, "filesystem", NOR_FLASH_DEV_NAME, 4*1024*1024, 11*1024*1024, 0}, \
+    {FAL_PART_MAGIC_WORD, "audit",      NOR_FLASH_DEV_NAME,15*1024*1024,  1*1024*1024, 0}, \
 }
 #endif /* FAL_PART_HAS_TABLE_CFG */
 
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager      first version
+ */
+
+#include "drv_dmabuf.h"
+
+/*
+ * Apart from the SRAM clocks in rt_hw_dmabuf_init and the two cache helpers
+ * this is plain pointer arithmetic on the bitmap, so the file builds on a
+ * host with DMABUF_POOL_ADDR pointed at an ordinary array.
+ */
+
+#define DMABUF_POOL             ((rt_uint8_t *)(rt_ubase_t)(DMABUF_POOL_ADDR))
+#define DMABUF_LINE_MASK        ((rt_ubase_t)DMABUF_LINE_SIZE - 1)
+
+/* one bit per block, set while the block is free; all clear (nothing to hand
+   out) until rt_hw_dmabuf_init runs, so early callers take the fallback path */
+static rt_uint32_t dmabuf_free_map[DMABUF_WORDS];
+/* number of blocks in the run starting at each allocated block, 0 elsewhere */
+static rt_uint8_t dmabuf_run[DMABUF_BLOCKS];
+
+/* updated from thread and interrupt context (SPI DMA complete), always with interrupts off */
+static struct dmabuf_stats
+{
+    rt_uint32_t direct;         /* mappings used in place */
+    rt_uint32_t bounce;         /* mappings copied through the pool */
+    rt_uint32_t fail;           /* allocations that found no free run */
+    rt_uint16_t used;           /* blocks in use */
+    rt_uint16_t peak;
+} dmabuf_stats;
+
+static void dmabuf_clean(const void *buf, rt_size_t len)
+{
+#ifdef BSP_SCB_ENABLE_D_CACHE
+    rt_ubase_t head = (rt_ubase_t)buf & DMABUF_LINE_MASK;
+
+    SCB_CleanDCache_by_Addr((uint32_t *)((rt_ubase_t)buf - head), len + head);
+#endif
+}
+
+static void dmabuf_invalidate(void *buf, rt_size_t len)
+{
+#ifdef BSP_SCB_ENABLE_D_CACHE
+    /* callers only invalidate whole lines they own */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)buf, len);
+#endif
+}
+
+void *rt_hw_dmabuf_alloc(rt_size_t size)
+{
+    rt_uint32_t n, w, bit, runs, mask;
+    rt_base_t level;
+    void *buf = RT_NULL;
+
+    n = (size + DMABUF_BLOCK_SIZE - 1) / DMABUF_BLOCK_SIZE;
+    if (n == 0 || n > 32)
+    {
+        return RT_NULL;
+    }
+    mask = n == 32 ? ~0U : ((1U << n) - 1);
+
+    level = rt_hw_interrupt_disable();
+    for (w = 0; w < DMABUF_WORDS; w++)
+    {
+        /* bit k of runs stays set while blocks k .. k + i are all free */
+        runs = dmabuf_free_map[w];
+        for (bit = 1; bit < n && runs; bit++)
+        {
+            runs &= dmabuf_free_map[w] >> bit;
+        }
+        if (runs)
+        {
+            bit = __rt_ffs(runs) - 1;
+            dmabuf_free_map[w] &= ~(mask << bit);
+            dmabuf_run[w * 32 + bit] = n;
+            dmabuf_stats.used += n;
+            if (dmabuf_stats.used > dmabuf_stats.peak)
+            {
+                dmabuf_stats.peak = dmabuf_stats.used;
+            }
+            buf = DMABUF_POOL + (w * 32 + bit) * DMABUF_BLOCK_SIZE;
+            break;
+        }
+    }
+    if (buf == RT_NULL)
+    {
+        dmabuf_stats.fail++;
+    }
+    rt_hw_interrupt_enable(level);
+
+    return buf;
+}
+
+void rt_hw_dmabuf_free(void *buf)
+{
+    rt_uint32_t idx, n;
+    rt_base_t level;
+
+    if (buf == RT_NULL)
+    {
+        return;
+    }
+    RT_ASSERT(rt_hw_dmabuf_in_pool(buf));
+    idx = ((rt_uint8_t *)buf - DMABUF_POOL) / DMABUF_BLOCK_SIZE;
+    RT_ASSERT((rt_uint8_t *)buf == DMABUF_POOL + idx * DMABUF_BLOCK_SIZE);
+
+    level = rt_hw_interrupt_disable();
+    n = dmabuf_run[idx];
+    RT_ASSERT(n != 0);
+    dmabuf_run[idx] = 0;
+    dmabuf_free_map[idx / 32] |= (n == 32 ? ~0U : ((1U << n) - 1)) << (idx % 32);
+    dmabuf_stats.used -= n;
+    rt_hw_interrupt_enable(level);
+}
+
+rt_bool_t rt_hw_dmabuf_in_pool(const void *buf)
+{
+    return (rt_ubase_t)buf - (rt_ubase_t)DMABUF_POOL < DMABUF_POOL_SIZE;
+}
+
+static rt_bool_t dmabuf_in_xip(const void *buf)
+{
+    return (rt_ubase_t)buf - DMABUF_XIP_START < DMABUF_XIP_SIZE;
+}
+
+rt_bool_t rt_hw_dmabuf_direct(const void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align)
+{
+    if ((rt_ubase_t)buf & (align - 1))
+    {
+        return RT_FALSE;
+    }
+    if (rt_hw_dmabuf_in_pool(buf))
+    {
+        return RT_TRUE;
+    }
+    if ((dir & RT_DMABUF_TO_DEVICE) && dmabuf_in_xip(buf))
+    {
+        return RT_FALSE;
+    }
+#ifdef BSP_SCB_ENABLE_D_CACHE
+    /* invalidating a partial line would throw away the neighbours' dirty data */
+    if ((dir & RT_DMABUF_FROM_DEVICE) && (((rt_ubase_t)buf | len) & DMABUF_LINE_MASK))
+    {
+        return RT_FALSE;
+    }
+#endif
+    return RT_TRUE;
+}
+
+rt_size_t rt_hw_dmabuf_map(struct rt_dmabuf_map *map, void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align)
+{
+    rt_base_t level;
+
+    RT_ASSERT(map != RT_NULL);
+    RT_ASSERT(align != 0 && (align & (align - 1)) == 0 && align <= DMABUF_LINE_SIZE);
+
+    map->buf = buf;
+    map->dir = dir;
+    map->len = len;
+
+    if (rt_hw_dmabuf_direct(buf, len, dir, align))
+    {
+        map->dma = buf;
+        map->bounce = 0;
+        if (!rt_hw_dmabuf_in_pool(buf))
+        {
+            if (dir & RT_DMABUF_TO_DEVICE)
+            {
+                dmabuf_clean(buf, len);
+            }
+            if (dir & RT_DMABUF_FROM_DEVICE)
+            {
+                /* no line may be evicted on top of what the DMA writes */
+                dmabuf_invalidate(buf, len);
+            }
+        }
+        level = rt_hw_interrupt_disable();
+        dmabuf_stats.direct++;
+        rt_hw_interrupt_enable(level);
+        return len;
+    }
+
+    if (map->len > DMABUF_MAX_SIZE)
+    {
+        map->len = DMABUF_MAX_SIZE;
+    }
+    map->dma = rt_hw_dmabuf_alloc(map->len);
+    if (map->dma == RT_NULL)
+    {
+        map->len = 0;
+        return 0;
+    }
+    map->bounce = 1;
+    if (dir & RT_DMABUF_TO_DEVICE)
+    {
+        rt_memcpy(map->dma, buf, map->len);
+    }
+    level = rt_hw_interrupt_disable();
+    dmabuf_stats.bounce++;
+    rt_hw_interrupt_enable(level);
+
+    return map->len;
+}
+
+void rt_hw_dmabuf_unmap(struct rt_dmabuf_map *map)
+{
+    RT_ASSERT(map != RT_NULL);
+
+    if (map->len == 0)
+    {
+        return;
+    }
+    if (map->bounce)
+    {
+        if (map->dir & RT_DMABUF_FROM_DEVICE)
+        {
+            rt_memcpy(map->buf, map->dma, map->len);
+        }
+        rt_hw_dmabuf_free(map->dma);
+    }
+    else if ((map->dir & RT_DMABUF_FROM_DEVICE) && !rt_hw_dmabuf_in_pool(map->buf))
+    {
+        /* drop lines the core fetched speculatively while the DMA was running */
+        dmabuf_invalidate(map->buf, map->len);
+    }
+    map->len = 0;
+}
+
+int rt_hw_dmabuf_init(void)
+{
+    rt_uint32_t i;
+
+#ifdef __HAL_RCC_SRAM1_CLK_ENABLE
+    /* the AHB SRAMs holding the pool are clock gated after reset */
+    __HAL_RCC_SRAM1_CLK_ENABLE();
+    __HAL_RCC_SRAM2_CLK_ENABLE();
+#endif
+
+    rt_memset(&dmabuf_stats, 0, sizeof(dmabuf_stats));
+    rt_memset(dmabuf_run, 0, sizeof(dmabuf_run));
+    rt_memset(dmabuf_free_map, 0, sizeof(dmabuf_free_map));
+    for (i = 0; i < DMABUF_BLOCKS; i++)
+    {
+        dmabuf_free_map[i / 32] |= 1U << (i % 32);
+    }
+
+    return RT_EOK;
+}
+INIT_BOARD_EXPORT(rt_hw_dmabuf_init);
+
+#ifdef RT_USING_FINSH
+static void dmabuf(void)
+{
+    struct dmabuf_stats stats;
+    rt_base_t level;
+
+    /* take a consistent snapshot, the SPI interrupt may update the counters */
+    level = rt_hw_interrupt_disable();
+    stats = dmabuf_stats;
+    rt_hw_interrupt_enable(level);
+
+    rt_kprintf("dma pool  : 0x%08x, %d x %d bytes\n", DMABUF_POOL_ADDR, DMABUF_BLOCKS, DMABUF_BLOCK_SIZE);
+    rt_kprintf("in use    : %d blocks, peak %d\n", stats.used, stats.peak);
+    rt_kprintf("mappings  : %d direct, %d bounced, %d alloc failures\n",
+               stats.direct, stats.bounce, stats.fail);
+}
+MSH_CMD_EXPORT(dmabuf, show DMA buffer pool usage);
+#endif /* RT_USING_FINSH */
@@ -246,6 +246,25 @@ static rt_ssize_t stm32_pin_read(rt_device_t dev, rt_base_t pin)
     return (state == GPIO_PIN_RESET) ? PIN_LOW : PIN_HIGH;
 }
 
+static rt_uint32_t stm32_pin_port_read(rt_device_t dev, rt_base_t port, rt_uint32_t mask)
+{
+    if (port >= PIN_STPORT_MAX)
+    {
+        return 0;
+    }
+
+    return PIN_STPORT(port << 4)->IDR & mask;
+}
+
+static void stm32_pin_port_write(rt_device_t dev, rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask)
+{
+    if (port < PIN_STPORT_MAX)
+    {
+        /* BSRR: low half sets, high half resets, set wins when both are given */
+        PIN_STPORT(port << 4)->BSRR = (set_mask & 0xFFFFu) | ((clr_mask & 0xFFFFu) << 16);
+    }
+}
+
 static void stm32_pin_mode(rt_device_t dev, rt_base_t pin, rt_uint8_t mode)
 {
     GPIO_InitTypeDef GPIO_InitStruct;
@@ -516,13 +535,15 @@ static rt_err_t stm32_pin_irq_enable(struct rt_device *device, rt_base_t pin,
 }
 static const struct rt_pin_ops _stm32_pin_ops =
 {
-    stm32_pin_mode,
-    stm32_pin_write,
-    stm32_pin_read,
-    stm32_pin_attach_irq,
-    stm32_pin_dettach_irq,
-    stm32_pin_irq_enable,
-    stm32_pin_get,
+    .pin_mode       = stm32_pin_mode,
+    .pin_write      = stm32_pin_write,
+    .pin_read       = stm32_pin_read,
+    .pin_attach_irq = stm32_pin_attach_irq,
+    .pin_detach_irq = stm32_pin_dettach_irq,
+    .pin_irq_enable = stm32_pin_irq_enable,
+    .pin_get        = stm32_pin_get,
+    .pin_port_read  = stm32_pin_port_read,
+    .pin_port_write = stm32_pin_port_write,
 };
 
 rt_inline void pin_irq_hdr(int irqno)
@@ -289,6 +289,39 @@ static rt_err_t drv_pwm_set(TIM_HandleTypeDef *htim, struct rt_pwm_configuration
     return RT_EOK;
 }
 
+/* Only update the compare register. With output compare preload enabled the new
+ * pulse takes effect at the next update event, so the period is never cut short
+ * and this is safe to call once per period from interrupt context. */
+static rt_err_t drv_pwm_set_pulse(TIM_HandleTypeDef *htim, struct rt_pwm_configuration *configuration)
+{
+    rt_uint32_t period, pulse;
+    rt_uint64_t tim_clock;
+    /* Converts the channel number to the channel number of Hal library */
+    rt_uint32_t channel = 0x04 * (configuration->channel - 1);
+
+#if defined(SOC_SERIES_STM32L4) || defined(SOC_SERIES_STM32F0) || defined(SOC_SERIES_STM32G0)
+    tim_clock = HAL_RCC_GetPCLK1Freq();
+#else
+    tim_clock = HAL_RCC_GetPCLK1Freq() * 2;
+#endif
+
+    /* Convert nanosecond to timer counts with the prescaler set by drv_pwm_set */
+    tim_clock /= 1000000UL;
+    period = __HAL_TIM_GET_AUTORELOAD(htim) + 1;
+    pulse = (unsigned long long)configuration->pulse * tim_clock / (htim->Instance->PSC + 1) / 1000ULL;
+    if (pulse < MIN_PULSE)
+    {
+        pulse = MIN_PULSE;
+    }
+    else if (pulse > period)
+    {
+        pulse = period;
+    }
+    __HAL_TIM_SET_COMPARE(htim, channel, pulse - 1);
+
+    return RT_EOK;
+}
+
 static rt_err_t drv_pwm_control(struct rt_device_pwm *device, int cmd, void *arg)
 {
     struct rt_pwm_configuration *configuration = (struct rt_pwm_configuration *)arg;
@@ -304,6 +337,8 @@ static rt_err_t drv_pwm_control(struct rt_device_pwm *device, int cmd, void *arg
         return drv_pwm_set(htim, configuration);
     case PWM_CMD_GET:
         return drv_pwm_get(htim, configuration);
+    case PWM_CMD_SET_PULSE:
+        return drv_pwm_set_pulse(htim, configuration);
     default:
         return RT_EINVAL;
     }
@@ -6,6 +6,7 @@
  * Change Logs:
  * Date         Author          Notes
  * 2024-10-30   Evlers          first version
+ * 2025-12-20   Voyager         transfer in place when the caller's buffer is DMA safe
  */
 
 #include "board.h"
@@ -31,13 +32,18 @@ static struct rt_mmcsd_host *host2;
 
 #define SDIO_TX_RX_COMPLETE_TIMEOUT_LOOPS    (1000000)
 
+/* the IDMA transfers whole words */
+#define SDIO_DMA_ALIGN          4
+#define SDIO_DMA_DIR(data)      ((data)->flags & DATA_DIR_WRITE ? RT_DMABUF_TO_DEVICE : RT_DMABUF_FROM_DEVICE)
+
 #define RTHW_SDIO_LOCK(_sdio)   rt_mutex_take(&_sdio->mutex, RT_WAITING_FOREVER)
 #define RTHW_SDIO_UNLOCK(_sdio) rt_mutex_release(&_sdio->mutex);
 
 struct sdio_pkg
 {
     struct rt_mmcsd_cmd *cmd;
-    void *buff;
+    void *buff;                 /* data->buf itself, or cache_buf when it has to be bounced */
+    struct rt_dmabuf_map map;
     rt_uint32_t flag;
 };
 
@@ -268,14 +274,15 @@ static void rthw_sdio_send_command(struct rthw_sdio *sdio, struct sdio_pkg *pkg)
     /* data pre configuration */
     if (data != RT_NULL)
     {
-        if (data->flags & DATA_DIR_WRITE)
-        {
-            SCB_CleanDCache_by_Addr((uint32_t*)sdio->cache_buf, data->blks * data->blksize);
-        }
-        else
+        rt_size_t map_len = data->blks * data->blksize;
+
+        /* cache_buf is owned up to its next line boundary, so short reads map in place too;
+           data->buf is only used when it maps in place, see rthw_sdio_request */
+        if (pkg->buff == sdio->cache_buf)
         {
-            SCB_InvalidateDCache_by_Addr((uint32_t*)sdio->cache_buf, data->blks * data->blksize + 32);
+            map_len = RT_ALIGN(map_len, SDIO_ALIGN_LEN);
         }
+        rt_hw_dmabuf_map(&pkg->map, pkg->buff, map_len, SDIO_DMA_DIR(data), SDIO_DMA_ALIGN);
 
         reg_cmd |= SDMMC_CMD_CMDTRANS;
         __HAL_SD_DISABLE_IT(&sdio->sdio_des.hw_sdio, SDMMC_MASK_CMDRENDIE | SDMMC_MASK_CMDSENTIE);
@@ -283,7 +290,7 @@ static void rthw_sdio_send_command(struct rthw_sdio *sdio, struct sdio_pkg *pkg)
         hsd->DLEN = data->blks * data->blksize;
         hsd->DCTRL = (get_order(data->blksize) << 4) | (data->flags & DATA_DIR_READ ? SDMMC_DCTRL_DTDIR : 0) | \
                                                         (data->flags & DATA_STREAM ? SDMMC_DCTRL_DTMODE_0 : 0);
-        hsd->IDMABASER = (rt_uint32_t)sdio->cache_buf;
+        hsd->IDMABASER = (rt_uint32_t)pkg->map.dma;
         hsd->IDMACTRL = SDMMC_IDMA_IDMAEN;
     }
      /* config cmd reg */
@@ -318,10 +325,10 @@ static void rthw_sdio_send_command(struct rthw_sdio *sdio, struct sdio_pkg *pkg)
     /* data post configuration */
     if (data != RT_NULL)
     {
-        if (data->flags & DATA_DIR_READ)
+        rt_hw_dmabuf_unmap(&pkg->map);
+        if ((data->flags & DATA_DIR_READ) && pkg->buff != data->buf)
         {
-            SCB_CleanInvalidateDCache_by_Addr((uint32_t*)((uint32_t)sdio->cache_buf & ~(32U - 1U)), data->blks * data->blksize + 32U);
-            rt_memcpy(data->buf, sdio->cache_buf, data->blks * data->blksize);
+            rt_memcpy(data->buf, pkg->buff, data->blks * data->blksize);
         }
     }
 }
@@ -350,11 +357,20 @@ static void rthw_sdio_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *r
         {
             rt_uint32_t size = data->blks * data->blksize;
 
-            RT_ASSERT(size <= SDIO_BUFF_SIZE);
-
-            if (data->flags & DATA_DIR_WRITE)
+            if (rt_hw_dmabuf_direct(data->buf, size, SDIO_DMA_DIR(data), SDIO_DMA_ALIGN))
             {
-                rt_memcpy(sdio->cache_buf, data->buf, size);
+                pkg.buff = data->buf;
+            }
+            else
+            {
+                /* misaligned or shares cache lines: go through the line aligned cache_buf */
+                RT_ASSERT(size <= SDIO_BUFF_SIZE);
+
+                pkg.buff = sdio->cache_buf;
+                if (data->flags & DATA_DIR_WRITE)
+                {
+                    rt_memcpy(sdio->cache_buf, data->buf, size);
+                }
             }
         }
 
@@ -9,6 +9,9 @@
  * 2018-12-11     greedyhao    Porting for stm32f7xx
  * 2019-01-03     zylx         modify DMA initialization and spixfer function
  * 2020-01-15     whj4674672   Porting for stm32h7xx
+ * 2025-12-20     Voyager      wait for DMA completion instead of polling, add async submit API
+ * 2025-12-20     Voyager      hand buffers to the DMA through the shared DMA buffer pool
+ * 2025-12-20     Voyager      run message chains from the DMA complete interrupt
  */
 
 #include "board.h"
@@ -23,6 +26,9 @@
 #include "drv_config.h"
 #include <string.h>
 
+/* upper bound for one DMA segment (65535 bytes at the slowest prescaler takes far less) */
+#define SPI_DMA_TIMEOUT_MS   1000
+
 //#define DRV_DEBUG
 #define LOG_TAG              "drv.spi"
 #include <drv_log.h>
@@ -264,13 +270,28 @@ static rt_err_t stm32_spi_init(struct stm32_spi *spi_drv, struct rt_spi_configur
     return RT_EOK;
 }
 
-static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *message)
+/* map one segment for DMA, shortening it to what could be mapped; RT_FALSE means poll instead */
+static rt_bool_t stm32_spi_dma_map(struct rt_dmabuf_map *map, const void *buf, rt_uint16_t *length, rt_uint8_t dir)
+{
+    rt_size_t mapped = rt_hw_dmabuf_map(map, (void *)buf, *length, dir, 1);
+
+    if (mapped == 0)
+    {
+        return RT_FALSE;
+    }
+    *length = mapped;
+    return RT_TRUE;
+}
+
+static rt_ssize_t spixfer(struct rt_spi_device *device, struct rt_spi_message *message)
 {
     HAL_StatusTypeDef state;
-    rt_size_t message_length, already_send_length;
+    rt_bool_t use_dma;
+    rt_size_t offset;
     rt_uint16_t send_length;
     rt_uint8_t *recv_buf;
     const rt_uint8_t *send_buf;
+    struct rt_dmabuf_map tx_map, rx_map;
 
     RT_ASSERT(device != RT_NULL);
     RT_ASSERT(device->bus != RT_NULL);
@@ -292,34 +313,30 @@ static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *
           (uint32_t)message->send_buf,
           (uint32_t)message->recv_buf, message->length);
 
-    message_length = message->length;
-    recv_buf = message->recv_buf;
-    send_buf = message->send_buf;
-    while (message_length)
+    offset = 0;
+    while (offset < message->length)
     {
         /* the HAL library use uint16 to save the data length */
-        if (message_length > 65535)
-        {
-            send_length = 65535;
-            message_length = message_length - 65535;
-        }
-        else
-        {
-            send_length = message_length;
-            message_length = 0;
-        }
+        send_length = message->length - offset > 65535 ? 65535 : message->length - offset;
 
         /* calculate the start address */
-        already_send_length = message->length - send_length - message_length;
-        send_buf = (rt_uint8_t *)message->send_buf + already_send_length;
-        recv_buf = (rt_uint8_t *)message->recv_buf + already_send_length;
-
-        /* start once data exchange in DMA mode */
+        send_buf = (rt_uint8_t *)message->send_buf + offset;
+        recv_buf = (rt_uint8_t *)message->recv_buf + offset;
+
+        /* start once data exchange in DMA mode; the DMA works on the mapped
+           addresses, which are the caller's buffers unless they had to be bounced */
+        use_dma = RT_FALSE;
+        tx_map.len = 0;
+        rx_map.len = 0;
+        rt_completion_init(&spi_drv->cpt);
         if (message->send_buf && message->recv_buf)
         {
-            if ((spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG) && (spi_drv->spi_dma_flag & SPI_USING_RX_DMA_FLAG))
+            if ((spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG) && (spi_drv->spi_dma_flag & SPI_USING_RX_DMA_FLAG)
+                    && stm32_spi_dma_map(&tx_map, send_buf, &send_length, RT_DMABUF_TO_DEVICE)
+                    && stm32_spi_dma_map(&rx_map, recv_buf, &send_length, RT_DMABUF_FROM_DEVICE))
             {
-                state = HAL_SPI_TransmitReceive_DMA(spi_handle, (uint8_t *)send_buf, (uint8_t *)recv_buf, send_length);
+                use_dma = RT_TRUE;
+                state = HAL_SPI_TransmitReceive_DMA(spi_handle, (uint8_t *)tx_map.dma, (uint8_t *)rx_map.dma, send_length);
             }
             else
             {
@@ -328,9 +345,11 @@ static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *
         }
         else if (message->send_buf)
         {
-            if (spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG)
+            if ((spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG)
+                    && stm32_spi_dma_map(&tx_map, send_buf, &send_length, RT_DMABUF_TO_DEVICE))
             {
-                state = HAL_SPI_Transmit_DMA(spi_handle, (uint8_t *)send_buf, send_length);
+                use_dma = RT_TRUE;
+                state = HAL_SPI_Transmit_DMA(spi_handle, (uint8_t *)tx_map.dma, send_length);
             }
             else
             {
@@ -340,9 +359,11 @@ static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *
         else
         {
             memset((uint8_t *)recv_buf, 0xff, send_length);
-            if (spi_drv->spi_dma_flag & SPI_USING_RX_DMA_FLAG)
+            if ((spi_drv->spi_dma_flag & SPI_USING_RX_DMA_FLAG)
+                    && stm32_spi_dma_map(&rx_map, recv_buf, &send_length, RT_DMABUF_BIDIRECTIONAL))
             {
-                state = HAL_SPI_Receive_DMA(spi_handle, (uint8_t *)recv_buf, send_length);
+                use_dma = RT_TRUE;
+                state = HAL_SPI_Receive_DMA(spi_handle, (uint8_t *)rx_map.dma, send_length);
             }
             else
             {
@@ -356,15 +377,32 @@ static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *
             message->length = 0;
             spi_handle->State = HAL_SPI_STATE_READY;
         }
+        else if (use_dma)
+        {
+            /* sleep until the transfer complete interrupt instead of spinning on the HAL state */
+            if (rt_completion_wait(&spi_drv->cpt, rt_tick_from_millisecond(SPI_DMA_TIMEOUT_MS)) != RT_EOK)
+            {
+                LOG_E("%s dma transfer timeout", spi_drv->config->bus_name);
+                HAL_SPI_Abort(spi_handle);
+                message->length = 0;
+            }
+            else if (spi_handle->ErrorCode != HAL_SPI_ERROR_NONE)
+            {
+                /* the error callback signals the same completion as a finished transfer */
+                LOG_E("%s dma transfer error: 0x%x", spi_drv->config->bus_name, spi_handle->ErrorCode);
+                message->length = 0;
+            }
+            LOG_D("%s transfer done", spi_drv->config->bus_name);
+        }
         else
         {
+            /* polled transfers are finished when the HAL call returns */
             LOG_D("%s transfer done", spi_drv->config->bus_name);
         }
 
-        /* For simplicity reasons, this example is just waiting till the end of the
-           transfer, but application may perform other tasks while transfer operation
-           is ongoing. */
-        while (HAL_SPI_GetState(spi_handle) != HAL_SPI_STATE_READY);
+        rt_hw_dmabuf_unmap(&tx_map);
+        rt_hw_dmabuf_unmap(&rx_map);
+        offset += send_length;
     }
 
     if (message->cs_release)
@@ -375,6 +413,143 @@ static rt_uint32_t spixfer(struct rt_spi_device *device, struct rt_spi_message *
     return message->length;
 }
 
+/*
+ * Hand the next piece of the chain to the DMA, first applying the GPIO side
+ * effect and chip select of every message it enters. Runs in thread context
+ * for the first message and from the transfer complete interrupt for all the
+ * others, so the buffers were checked and cleaned by spixfer_chain and are
+ * given to the DMA as they are. Returns RT_FALSE when there is nothing left
+ * to start: the chain is then either finished (spi_drv->chain is RT_NULL) or
+ * stopped at the message that failed.
+ */
+static rt_bool_t stm32_spi_chain_run(struct stm32_spi *spi_drv)
+{
+    struct rt_spi_chain_message *msg;
+    struct stm32_hw_spi_cs *cs = spi_drv->chain_cs;
+    rt_size_t len;
+
+    while ((msg = spi_drv->chain) != RT_NULL)
+    {
+        if (spi_drv->chain_offset == 0)
+        {
+            if (msg->gpio_set_mask | msg->gpio_clr_mask)
+            {
+                rt_pin_port_write(msg->gpio_port, msg->gpio_set_mask, msg->gpio_clr_mask);
+            }
+            if (msg->parent.cs_take)
+            {
+                HAL_GPIO_WritePin(cs->GPIOx, cs->GPIO_Pin, GPIO_PIN_RESET);
+            }
+        }
+
+        if (spi_drv->chain_offset < msg->parent.length)
+        {
+            /* the HAL library use uint16 to save the data length */
+            len = msg->parent.length - spi_drv->chain_offset;
+            if (len > 65535)
+            {
+                len = 65535;
+            }
+            if (HAL_SPI_Transmit_DMA(&spi_drv->handle, (uint8_t *)msg->parent.send_buf + spi_drv->chain_offset,
+                                     len) != HAL_OK)
+            {
+                spi_drv->handle.State = HAL_SPI_STATE_READY;
+                return RT_FALSE;
+            }
+            spi_drv->chain_offset += len;
+            return RT_TRUE;
+        }
+
+        if (msg->parent.cs_release)
+        {
+            HAL_GPIO_WritePin(cs->GPIOx, cs->GPIO_Pin, GPIO_PIN_SET);
+        }
+        spi_drv->chain = rt_spi_chain_next(msg);
+        spi_drv->chain_offset = 0;
+    }
+
+    return RT_FALSE;
+}
+
+/*
+ * Send a whole message list with one wakeup: each DMA complete interrupt
+ * starts the next piece, so nothing runs in thread context between messages.
+ * Lists that receive, buffers the DMA cannot read in place (they would need
+ * a bounce copy in the interrupt) and buses without TX DMA are left to the
+ * core.
+ */
+static rt_ssize_t spixfer_chain(struct rt_spi_device *device, struct rt_spi_chain_message *message)
+{
+    struct rt_spi_chain_message *msg, *stop;
+    struct rt_dmabuf_map map;
+    rt_base_t level;
+    rt_ssize_t done;
+
+    RT_ASSERT(device != RT_NULL);
+    RT_ASSERT(device->bus != RT_NULL);
+
+    struct stm32_spi *spi_drv =  rt_container_of(device->bus, struct stm32_spi, spi_bus);
+    struct stm32_hw_spi_cs *cs = device->parent.user_data;
+
+    if (!(spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG))
+    {
+        return -RT_ENOSYS;
+    }
+    for (msg = message; msg != RT_NULL; msg = rt_spi_chain_next(msg))
+    {
+        if (msg->parent.recv_buf != RT_NULL || (msg->parent.length != 0 && (msg->parent.send_buf == RT_NULL
+                || !rt_hw_dmabuf_direct(msg->parent.send_buf, msg->parent.length, RT_DMABUF_TO_DEVICE, 1))))
+        {
+            return -RT_ENOSYS;
+        }
+    }
+    /* a direct transmit mapping only cleans the cache lines, there is nothing to release later */
+    for (msg = message; msg != RT_NULL; msg = rt_spi_chain_next(msg))
+    {
+        if (msg->parent.length != 0)
+        {
+            rt_hw_dmabuf_map(&map, (void *)msg->parent.send_buf, msg->parent.length, RT_DMABUF_TO_DEVICE, 1);
+            rt_hw_dmabuf_unmap(&map);
+        }
+    }
+
+    rt_completion_init(&spi_drv->cpt);
+    spi_drv->chain_cs = cs;
+    spi_drv->chain_offset = 0;
+    spi_drv->chain = message;
+    if (stm32_spi_chain_run(spi_drv)
+            && rt_completion_wait(&spi_drv->cpt, rt_tick_from_millisecond(SPI_DMA_TIMEOUT_MS)) != RT_EOK)
+    {
+        /* take the chain away from the interrupt before stopping the transfer */
+        level = rt_hw_interrupt_disable();
+        stop = spi_drv->chain;
+        spi_drv->chain = RT_NULL;
+        rt_hw_interrupt_enable(level);
+        LOG_E("%s dma chain timeout", spi_drv->config->bus_name);
+        HAL_SPI_Abort(&spi_drv->handle);
+    }
+    else
+    {
+        stop = spi_drv->chain;
+        spi_drv->chain = RT_NULL;
+    }
+
+    /* count the messages before the one the chain stopped at */
+    done = 0;
+    for (msg = message; msg != RT_NULL && msg != stop; msg = rt_spi_chain_next(msg))
+    {
+        done++;
+    }
+    if (stop != RT_NULL)
+    {
+        /* the stopped message may have taken CS without reaching its release */
+        HAL_GPIO_WritePin(cs->GPIOx, cs->GPIO_Pin, GPIO_PIN_SET);
+        LOG_I("%s chain stopped at message %d", spi_drv->config->bus_name, done);
+    }
+
+    return done;
+}
+
 static rt_err_t spi_configure(struct rt_spi_device *device,
                               struct rt_spi_configuration *configuration)
 {
@@ -391,6 +566,7 @@ static const struct rt_spi_ops stm_spi_ops =
 {
     .configure = spi_configure,
     .xfer = spixfer,
+    .xfer_chain = spixfer_chain,
 };
 
 static int rt_hw_spi_bus_init(void)
@@ -401,6 +577,7 @@ static int rt_hw_spi_bus_init(void)
         spi_bus_obj[i].config = &spi_config[i];
         spi_bus_obj[i].spi_bus.parent.user_data = &spi_config[i];
         spi_bus_obj[i].handle.Instance = spi_config[i].Instance;
+        rt_completion_init(&spi_bus_obj[i].cpt);
 
         if (spi_bus_obj[i].spi_dma_flag & SPI_USING_RX_DMA_FLAG)
         {
@@ -529,6 +706,135 @@ rt_err_t rt_hw_spi_device_attach(const char *bus_name, const char *device_name,
     return result;
 }
 
+/**
+  * Start a transmit without waiting for it to finish.
+  * The caller owns the bus and CS; use rt_hw_spi_dma_poll/rt_hw_spi_dma_wait
+  * before reusing send_buf or submitting again.
+  */
+rt_err_t rt_hw_spi_dma_submit(struct rt_spi_device *device, const void *send_buf, rt_uint16_t length)
+{
+    RT_ASSERT(device != RT_NULL);
+    RT_ASSERT(device->bus != RT_NULL);
+
+    struct stm32_spi *spi_drv =  rt_container_of(device->bus, struct stm32_spi, spi_bus);
+    SPI_HandleTypeDef *spi_handle = &spi_drv->handle;
+
+    if (spi_drv->dma_busy)
+    {
+        return -RT_EBUSY;
+    }
+    if (length == 0)
+    {
+        return RT_EOK;
+    }
+
+    if (!(spi_drv->spi_dma_flag & SPI_USING_TX_DMA_FLAG))
+    {
+        /* no DMA on this bus: complete synchronously */
+        return HAL_SPI_Transmit(spi_handle, (uint8_t *)send_buf, length, 1000) == HAL_OK ? RT_EOK : -RT_EIO;
+    }
+
+    if (rt_hw_dmabuf_map(&spi_drv->tx_map, (void *)send_buf, length, RT_DMABUF_TO_DEVICE, 1) != length)
+    {
+        /* too large to bounce in one piece, or the pool is exhausted */
+        rt_hw_dmabuf_unmap(&spi_drv->tx_map);
+        return HAL_SPI_Transmit(spi_handle, (uint8_t *)send_buf, length, 1000) == HAL_OK ? RT_EOK : -RT_EIO;
+    }
+    rt_completion_init(&spi_drv->cpt);
+    spi_drv->dma_busy = 1;
+    if (HAL_SPI_Transmit_DMA(spi_handle, (uint8_t *)spi_drv->tx_map.dma, length) != HAL_OK)
+    {
+        spi_drv->dma_busy = 0;
+        spi_handle->State = HAL_SPI_STATE_READY;
+        rt_hw_dmabuf_unmap(&spi_drv->tx_map);
+        return -RT_EIO;
+    }
+
+    return RT_EOK;
+}
+
+/**
+  * Return RT_TRUE when no submitted transfer is in flight.
+  */
+rt_bool_t rt_hw_spi_dma_poll(struct rt_spi_device *device)
+{
+    RT_ASSERT(device != RT_NULL);
+    RT_ASSERT(device->bus != RT_NULL);
+
+    struct stm32_spi *spi_drv =  rt_container_of(device->bus, struct stm32_spi, spi_bus);
+
+    return spi_drv->dma_busy ? RT_FALSE : RT_TRUE;
+}
+
+/**
+  * Block until the submitted transfer completes or timeout ticks elapse.
+  * Returns -RT_EIO when it completed with an SPI or DMA error.
+  */
+rt_err_t rt_hw_spi_dma_wait(struct rt_spi_device *device, rt_int32_t timeout)
+{
+    rt_err_t result;
+
+    RT_ASSERT(device != RT_NULL);
+    RT_ASSERT(device->bus != RT_NULL);
+
+    struct stm32_spi *spi_drv =  rt_container_of(device->bus, struct stm32_spi, spi_bus);
+
+    if (spi_drv->dma_busy)
+    {
+        result = rt_completion_wait(&spi_drv->cpt, timeout);
+        if (result != RT_EOK)
+        {
+            if (timeout != 0)
+            {
+                LOG_E("%s dma transfer timeout", spi_drv->config->bus_name);
+                HAL_SPI_Abort(&spi_drv->handle);
+                spi_drv->dma_busy = 0;
+                rt_hw_dmabuf_unmap(&spi_drv->tx_map);
+            }
+            return result;
+        }
+    }
+
+    /* ErrorCode stays set until the next transfer starts */
+    return spi_drv->handle.ErrorCode == HAL_SPI_ERROR_NONE ? RT_EOK : -RT_EIO;
+}
+
+static void stm32_spi_dma_done(SPI_HandleTypeDef *hspi)
+{
+    struct stm32_spi *spi_drv = rt_container_of(hspi, struct stm32_spi, handle);
+
+    /* releases the bounce block of an rt_hw_spi_dma_submit transfer; no-op for spixfer and chains */
+    rt_hw_dmabuf_unmap(&spi_drv->tx_map);
+    /* a chain goes straight on with its next piece */
+    if (spi_drv->chain != RT_NULL && hspi->ErrorCode == HAL_SPI_ERROR_NONE && stm32_spi_chain_run(spi_drv))
+    {
+        return;
+    }
+    spi_drv->dma_busy = 0;
+    rt_completion_done(&spi_drv->cpt);
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    stm32_spi_dma_done(hspi);
+}
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    stm32_spi_dma_done(hspi);
+}
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    stm32_spi_dma_done(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    LOG_E("spi error: 0x%x", hspi->ErrorCode);
+    stm32_spi_dma_done(hspi);
+}
+
 #if defined(BSP_SPI1_TX_USING_DMA) || defined(BSP_SPI1_RX_USING_DMA)
 void SPI1_IRQHandler(void)
 {
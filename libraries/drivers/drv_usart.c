@@ -11,6 +11,7 @@
  * 2020-05-02     whj4674672   support stm32h7 uart dma
  * 2020-09-09     forest-rain  support stm32wl uart
  * 2020-10-14     Dozingfiretruck   Porting for stm32wbxx
+ * 2025-12-20     Voyager      DMA buffers through the shared DMA buffer pool
  */
 
 #include "board.h"
@@ -276,6 +277,9 @@ static rt_err_t stm32_control(struct rt_serial_device *serial, int cmd, void *ar
             {
                 RT_ASSERT(0);
             }
+
+            rt_hw_dmabuf_free(uart->dma_rx.ring);
+            uart->dma_rx.ring = RT_NULL;
         }
         else if(ctrl_arg == RT_DEVICE_FLAG_DMA_TX)
         {
@@ -397,12 +401,25 @@ static rt_ssize_t stm32_dma_transmit(struct rt_serial_device *serial, rt_uint8_t
 
     if (RT_SERIAL_DMA_TX == direction)
     {
+#ifdef RT_SERIAL_USING_DMA
+        /* cleaned in place, or copied to the pool when buf is in XIP flash */
+        if (rt_hw_dmabuf_map(&uart->dma_tx.map, buf, size, RT_DMABUF_TO_DEVICE, 1) != size)
+        {
+            LOG_E("%s: no DMA buffer for %d bytes", uart->config->name, size);
+            rt_hw_dmabuf_unmap(&uart->dma_tx.map);
+            return 0;
+        }
+        buf = uart->dma_tx.map.dma;
+#endif
         if (HAL_UART_Transmit_DMA(&uart->handle, buf, size) == HAL_OK)
         {
             return size;
         }
         else
         {
+#ifdef RT_SERIAL_USING_DMA
+            rt_hw_dmabuf_unmap(&uart->dma_tx.map);
+#endif
             return 0;
         }
     }
@@ -1154,6 +1171,13 @@ static void stm32_dma_config(struct rt_serial_device *serial, rt_ubase_t flag)
     if (flag == RT_DEVICE_FLAG_DMA_RX)
     {
         rx_fifo = (struct rt_serial_rx_fifo *)serial->serial_rx;
+        /* receive into the non-cacheable DMA pool so the ring never needs cache
+           maintenance; the serial fifo buffer shares lines with its header */
+        uart->dma_rx.ring = rt_hw_dmabuf_alloc(serial->config.bufsz);
+        if (uart->dma_rx.ring != RT_NULL)
+        {
+            rx_fifo->buffer = uart->dma_rx.ring;
+        }
         /* Start DMA transfer */
         if (HAL_UART_Receive_DMA(&(uart->handle), rx_fifo->buffer, serial->config.bufsz) != HAL_OK)
         {
@@ -1235,6 +1259,8 @@ static void _dma_tx_complete(struct rt_serial_device *serial)
 
     if (trans_total_index == 0)
     {
+        /* before the serial core queues the next block into the same map */
+        rt_hw_dmabuf_unmap(&uart->dma_tx.map);
         rt_hw_serial_isr(serial, RT_SERIAL_EVENT_TX_DMADONE);
     }
 }
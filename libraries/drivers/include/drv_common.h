@@ -6,6 +6,7 @@
  * Change Logs:
  * Date           Author       Notes
  * 2018-11-7      SummerGift   first version
+ * 2025-12-20     Voyager      add GET_PIN_PORT/GET_PIN_MASK
  */
 
 #ifndef __DRV_COMMON_H__
@@ -32,6 +33,9 @@ void _Error_Handler(void);
 
 #define __STM32_PORT(port)  GPIO##port##_BASE
 #define GET_PIN(PORTx,PIN) (rt_base_t)((16 * ( ((rt_base_t)__STM32_PORT(PORTx) - (rt_base_t)GPIOA_BASE)/(0x0400UL) )) + PIN)
+/* split a pin number into the port/mask pair used by rt_pin_port_read/write */
+#define GET_PIN_PORT(pin)   ((rt_base_t)(pin) >> 4)
+#define GET_PIN_MASK(pin)   (1UL << ((rt_base_t)(pin) & 0xF))
 #define STM32_FLASH_START_ADRESS       ROM_START
 #define STM32_FLASH_SIZE               ROM_SIZE
 #define STM32_FLASH_END_ADDRESS        ROM_END
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2006-2025, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager      first version
+ */
+
+#ifndef __DRV_DMABUF_H__
+#define __DRV_DMABUF_H__
+
+#include <rtthread.h>
+#include <board.h>
+
+/*
+ * Shared DMA buffer service.
+ *
+ * The pool lives in the AHB SRAM, which drv_mpu.c maps as normal
+ * non-cacheable memory, so buffers handed out here never need cache
+ * maintenance. Allocation is in whole cache-line aligned blocks: a single
+ * block (one line buffer) is found with one find-first-set per bitmap word,
+ * and free is a mask update.
+ *
+ * Drivers hand caller buffers to the DMA through rt_hw_dmabuf_map/unmap:
+ * buffers that the DMA can reach safely are used in place with clean /
+ * invalidate by range, everything else (XIP sources, misaligned addresses,
+ * receive buffers that share cache lines with other data) is bounced
+ * through a pool block.
+ */
+
+#ifndef DMABUF_POOL_ADDR
+#define DMABUF_POOL_ADDR        0x30000000                  /* AHB SRAM1 + SRAM2 */
+#endif
+#ifndef DMABUF_POOL_SIZE
+#define DMABUF_POOL_SIZE        (32 * 1024)
+#endif
+#define DMABUF_POOL_MPU_SIZE    MPU_REGION_SIZE_32KB        /* must match DMABUF_POOL_SIZE */
+#ifndef DMABUF_BLOCK_SIZE
+#define DMABUF_BLOCK_SIZE       512                         /* multiple of the cache line */
+#endif
+#define DMABUF_LINE_SIZE        32                          /* Cortex-M7 D-cache line */
+
+#define DMABUF_BLOCKS           (DMABUF_POOL_SIZE / DMABUF_BLOCK_SIZE)
+#define DMABUF_WORDS            ((DMABUF_BLOCKS + 31) / 32)
+#define DMABUF_MAX_SIZE         (32 * DMABUF_BLOCK_SIZE)    /* a run never crosses a bitmap word */
+
+/* memory-mapped XSPI flash: the CPU executes from it, the DMA must not read it */
+#define DMABUF_XIP_START        0x70000000
+#define DMABUF_XIP_SIZE         (64 * 1024 * 1024)
+
+/* transfer direction, as seen from the memory side */
+#define RT_DMABUF_TO_DEVICE     0x01
+#define RT_DMABUF_FROM_DEVICE   0x02
+#define RT_DMABUF_BIDIRECTIONAL (RT_DMABUF_TO_DEVICE | RT_DMABUF_FROM_DEVICE)
+
+struct rt_dmabuf_map
+{
+    void *buf;                  /* caller's buffer */
+    void *dma;                  /* address to program into the DMA */
+    rt_size_t len;              /* bytes covered by this mapping */
+    rt_uint8_t dir;
+    rt_uint8_t bounce;          /* dma points at a pool block */
+};
+
+int rt_hw_dmabuf_init(void);
+void *rt_hw_dmabuf_alloc(rt_size_t size);
+void rt_hw_dmabuf_free(void *buf);
+rt_bool_t rt_hw_dmabuf_in_pool(const void *buf);
+rt_bool_t rt_hw_dmabuf_direct(const void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align);
+
+/*
+ * Prepare up to len bytes of buf for a DMA transfer whose memory address must
+ * be a multiple of align. Returns the number of bytes mapped, which is less
+ * than len when a bounce is needed and len exceeds DMABUF_MAX_SIZE, and 0 when
+ * no pool block is free; the caller then transfers the rest in further
+ * mappings or falls back to a polled transfer.
+ */
+rt_size_t rt_hw_dmabuf_map(struct rt_dmabuf_map *map, void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align);
+/* Finish the transfer: make received data visible to the CPU and release any bounce block. */
+void rt_hw_dmabuf_unmap(struct rt_dmabuf_map *map);
+
+#endif /* __DRV_DMABUF_H__ */
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <drivers/mmcsd_core.h>
 #include <drivers/sdio.h>
+#include "drv_dmabuf.h"
 
 #define SDIO_BUFF_SIZE       16384
 #define SDIO_ALIGN_LEN       32
@@ -16,9 +16,20 @@
 #include <rthw.h>
 #include <drv_common.h>
 #include "drv_dma.h"
+#include "drv_dmabuf.h"
 
 rt_err_t rt_hw_spi_device_attach(const char *bus_name, const char *device_name, GPIO_TypeDef* cs_gpiox, uint16_t cs_gpio_pin);
 
+/*
+ * Non-blocking transmit API. The caller must own the bus (rt_spi_take_bus)
+ * and drive CS itself (rt_spi_take/rt_spi_release). Only one transfer may be
+ * in flight per bus; on buses without TX DMA the submit falls back to a
+ * blocking polled transfer and completes before returning.
+ */
+rt_err_t rt_hw_spi_dma_submit(struct rt_spi_device *device, const void *send_buf, rt_uint16_t length);
+rt_bool_t rt_hw_spi_dma_poll(struct rt_spi_device *device);
+rt_err_t rt_hw_spi_dma_wait(struct rt_spi_device *device, rt_int32_t timeout);
+
 struct stm32_hw_spi_cs
 {
     GPIO_TypeDef* GPIOx;
@@ -57,6 +68,14 @@ struct stm32_spi
 
     rt_uint8_t spi_dma_flag;
     struct rt_spi_bus spi_bus;
+
+    struct rt_completion cpt;       /* signalled by the DMA transfer complete callback */
+    volatile rt_uint8_t dma_busy;   /* a transfer started by rt_hw_spi_dma_submit is in flight */
+    struct rt_dmabuf_map tx_map;    /* buffer of that transfer as seen by the DMA */
+
+    struct rt_spi_chain_message *chain; /* message spixfer_chain is sending, RT_NULL when idle */
+    rt_size_t chain_offset;         /* bytes of it already handed to the DMA */
+    struct stm32_hw_spi_cs *chain_cs;
 };
 
 #endif /*__DRV_SPI_H_ */
@@ -8,6 +8,7 @@
  * 2018-10-30     SummerGift   first version
  * 2019-03-05     whj4674672   add stm32h7
  * 2020-10-14     Dozingfiretruck   Porting for stm32wbxx
+ * 2025-12-20     Voyager      DMA buffers through the shared DMA buffer pool
  */
 
 #ifndef __DRV_USART_H__
@@ -18,6 +19,7 @@
 #include <rthw.h>
 #include <drv_common.h>
 #include "drv_dma.h"
+#include "drv_dmabuf.h"
 
 int rt_hw_usart_init(void);
 
@@ -68,10 +70,12 @@ struct stm32_uart
     {
         DMA_HandleTypeDef handle;
         rt_size_t remaining_cnt;
+        rt_uint8_t *ring;               /* receive ring taken from the DMA pool, or RT_NULL */
     } dma_rx;
     struct
     {
         DMA_HandleTypeDef handle;
+        struct rt_dmabuf_map map;       /* buffer of the transfer in flight */
     } dma_tx;
 #endif
     rt_uint16_t uart_dma_flag;
@@ -141,6 +141,9 @@ struct rt_pin_ops
 #ifdef RT_USING_PINCTRL
     rt_err_t (*pin_ctrl_confs_apply)(struct rt_device *device, void *fw_conf_np);
 #endif /* RT_USING_PINCTRL */
+    /* optional whole-port access, port/mask encoding is defined by the driver */
+    rt_uint32_t (*pin_port_read)(struct rt_device *device, rt_base_t port, rt_uint32_t mask);
+    void (*pin_port_write)(struct rt_device *device, rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask);
 };
 
 int rt_device_pin_register(const char *name, const struct rt_pin_ops *ops, void *user_data);
@@ -152,6 +155,8 @@ rt_err_t rt_pin_attach_irq(rt_base_t pin, rt_uint8_t mode,
                            void (*hdr)(void *args), void  *args);
 rt_err_t rt_pin_detach_irq(rt_base_t pin);
 rt_err_t rt_pin_irq_enable(rt_base_t pin, rt_uint8_t enabled);
+rt_uint32_t rt_pin_port_read(rt_base_t port, rt_uint32_t mask);
+void rt_pin_port_write(rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask);
 
 #ifdef RT_USING_DM
 rt_ssize_t rt_pin_get_named_pin(struct rt_device *dev, const char *propname, int index,
@@ -8,6 +8,7 @@
  * 2012-11-23     Bernard      Add extern "C"
  * 2020-06-13     armink       fix the 3 wires issue
  * 2022-09-01     liYony       fix api rt_spi_sendrecv16 about MSB and LSB bug
+ * 2025-12-20     Voyager      chained transfers with a GPIO side effect per message
  */
 
 #ifndef __SPI_H__
@@ -71,6 +72,25 @@ struct rt_spi_message
     unsigned cs_release : 1;
 };
 
+/**
+ * SPI message with a GPIO side effect, for rt_spi_transfer_chain() only.
+ * The side effect is applied with rt_pin_port_write() right before the
+ * message is clocked out, e.g. the D/C line of a display controller; both
+ * masks 0 means none. parent.next must point at the parent member of the
+ * next rt_spi_chain_message.
+ */
+struct rt_spi_chain_message
+{
+    struct rt_spi_message parent;
+
+    rt_base_t gpio_port;
+    rt_uint32_t gpio_set_mask;
+    rt_uint32_t gpio_clr_mask;
+};
+
+/* next message of a chain; parent is the first member, so RT_NULL maps to RT_NULL */
+#define rt_spi_chain_next(msg)  ((struct rt_spi_chain_message *)(msg)->parent.next)
+
 /**
  * SPI configuration structure
  */
@@ -101,6 +121,13 @@ struct rt_spi_ops
 {
     rt_err_t (*configure)(struct rt_spi_device *device, struct rt_spi_configuration *configuration);
     rt_ssize_t (*xfer)(struct rt_spi_device *device, struct rt_spi_message *message);
+    /*
+     * Optional: run a whole rt_spi_transfer_chain() list, GPIO side effects
+     * included, without returning to the core between messages. Returns the
+     * number of messages completed, or -RT_ENOSYS (nothing sent) to let the
+     * core walk the list with xfer.
+     */
+    rt_ssize_t (*xfer_chain)(struct rt_spi_device *device, struct rt_spi_chain_message *message);
 };
 
 /**
@@ -275,6 +302,19 @@ rt_err_t rt_spi_sendrecv16(struct rt_spi_device *device,
 struct rt_spi_message *rt_spi_transfer_message(struct rt_spi_device  *device,
                                                struct rt_spi_message *message);
 
+/**
+ * This function transfers a message list with per-message GPIO side effects
+ * to the SPI device, as one submit when the bus supports it.
+ *
+ * @param device the SPI device attached to SPI bus
+ * @param message the message list to be transmitted to SPI device
+ *
+ * @return RT_NULL if transmits message list successfully,
+ *         SPI message which be transmitted failed.
+ */
+struct rt_spi_chain_message *rt_spi_transfer_chain(struct rt_spi_device        *device,
+                                                   struct rt_spi_chain_message *message);
+
 rt_inline rt_size_t rt_spi_recv(struct rt_spi_device *device,
                                 void                 *recv_buf,
                                 rt_size_t             length)
@@ -8,6 +8,7 @@
  * 2015-01-20     Bernard      the first version
  * 2021-02-06     Meco Man     fix RT_ENOSYS code in negative
  * 2022-04-29     WangQiang    add pin operate command in MSH
+ * 2025-12-20     Voyager      add whole-port read/write
  */
 
 #include <drivers/pin.h>
@@ -151,6 +152,46 @@ rt_ssize_t rt_pin_read(rt_base_t pin)
     return _hw_pin.ops->pin_read(&_hw_pin.parent, pin);
 }
 
+/**
+ * @brief Read several pins of one port at once.
+ *
+ * @param port is the port number, as encoded by the pin driver.
+ * @param mask selects the pins to read.
+ *
+ * @return the input level of the selected pins, other bits are zero.
+ *         Returns 0 if the pin driver does not implement port access.
+ */
+rt_uint32_t rt_pin_port_read(rt_base_t port, rt_uint32_t mask)
+{
+    RT_ASSERT(_hw_pin.ops != RT_NULL);
+
+    if (_hw_pin.ops->pin_port_read == RT_NULL)
+    {
+        return 0;
+    }
+    return _hw_pin.ops->pin_port_read(&_hw_pin.parent, port, mask);
+}
+
+/**
+ * @brief Drive several pins of one port in a single access.
+ *
+ * @param port is the port number, as encoded by the pin driver.
+ * @param set_mask selects the pins to drive high.
+ * @param clr_mask selects the pins to drive low. A pin in both masks is driven high.
+ *
+ * Does nothing if the pin driver does not implement port access.
+ */
+void rt_pin_port_write(rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask)
+{
+    RT_ASSERT(_hw_pin.ops != RT_NULL);
+
+    if (_hw_pin.ops->pin_port_write == RT_NULL)
+    {
+        return;
+    }
+    _hw_pin.ops->pin_port_write(&_hw_pin.parent, port, set_mask, clr_mask);
+}
+
 /* Get pin number by name, such as PA.0, P0.12 */
 rt_base_t rt_pin_get(const char *name)
 {
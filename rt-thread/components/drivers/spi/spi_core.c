@@ -11,6 +11,7 @@
  * 2012-05-18     bernard      Changed SPI message to message list.
  *                             Added take/release SPI device/bus interface.
  * 2012-09-28     aozima       fixed rt_spi_release_bus assert error.
+ * 2025-12-20     Voyager      add rt_spi_transfer_chain.
  */
 
 #include <drivers/spi.h>
@@ -457,6 +458,86 @@ __exit:
     return index;
 }
 
+struct rt_spi_chain_message *rt_spi_transfer_chain(struct rt_spi_device        *device,
+                                                   struct rt_spi_chain_message *message)
+{
+    rt_err_t result;
+    rt_ssize_t done;
+    rt_size_t length;
+    struct rt_spi_chain_message *index;
+
+    RT_ASSERT(device != RT_NULL);
+
+    /* get first message */
+    index = message;
+    if (index == RT_NULL)
+        return index;
+
+    result = rt_mutex_take(&(device->bus->lock), RT_WAITING_FOREVER);
+    if (result != RT_EOK)
+    {
+        return index;
+    }
+
+    /* configure SPI bus */
+    if (device->bus->owner != device)
+    {
+        /* not the same owner as current, re-configure SPI bus */
+        result = device->bus->ops->configure(device, &device->config);
+        if (result == RT_EOK)
+        {
+            /* set SPI bus owner */
+            device->bus->owner = device;
+        }
+        else
+        {
+            /* configure SPI bus failed */
+            goto __exit;
+        }
+    }
+
+    /* let the bus run the whole list itself when it can */
+    if (device->bus->ops->xfer_chain != RT_NULL)
+    {
+        done = device->bus->ops->xfer_chain(device, index);
+        if (done != -RT_ENOSYS)
+        {
+            while (done-- > 0 && index != RT_NULL)
+            {
+                index = rt_spi_chain_next(index);
+            }
+            goto __exit;
+        }
+    }
+
+    /* apply each side effect, then transmit its SPI message */
+    while (index != RT_NULL)
+    {
+#ifdef RT_USING_PIN
+        if (index->gpio_set_mask | index->gpio_clr_mask)
+        {
+            rt_pin_port_write(index->gpio_port, index->gpio_set_mask, index->gpio_clr_mask);
+        }
+#endif
+
+        /* a failed transfer may report 0 and clear the length, so compare with a copy */
+        length = index->parent.length;
+        done = device->bus->ops->xfer(device, &index->parent);
+        if (done != (rt_ssize_t)length)
+        {
+            break;
+        }
+
+        index = rt_spi_chain_next(index);
+    }
+
+__exit:
+    /* release bus lock */
+    rt_mutex_release(&(device->bus->lock));
+
+    return index;
+}
+
 rt_err_t rt_spi_take_bus(struct rt_spi_device *device)
 {
     rt_err_t result = RT_EOK;
@@ -59,6 +59,7 @@
  * 2023-12-22     Shell        Support hook list
  * 2024-01-18     Shell        Seperate basical types to a rttypes.h
  *                             Seperate the compiler portings to rtcompiler.h
+ * 2025-12-20     Voyager      add RT_USING_TIMER_WHEEL
  */
 
 #ifndef __RT_DEF_H__
@@ -587,6 +588,16 @@ struct rt_object_information
 #define RT_TIMER_CTRL_GET_PARM          0x8             /**< get timer parameter  */
 #define RT_TIMER_CTRL_SET_PARM          0x9             /**< get timer parameter  */
 
+#ifdef RT_USING_TIMER_WHEEL
+/* the timing wheel keeps each timer on a single list, row[0] */
+#if defined(RT_TIMER_SKIP_LIST_LEVEL) && RT_TIMER_SKIP_LIST_LEVEL != 1
+#error "RT_USING_TIMER_WHEEL replaces the timer skip list, RT_TIMER_SKIP_LIST_LEVEL must be 1"
+#endif
+#ifndef RT_TIMER_WHEEL_LEVELS
+#define RT_TIMER_WHEEL_LEVELS           5               /**< levels of 32 slots, 5 levels span 2^25 ticks */
+#endif
+#endif /* RT_USING_TIMER_WHEEL */
+
 #ifndef RT_TIMER_SKIP_LIST_LEVEL
 #define RT_TIMER_SKIP_LIST_LEVEL          1
 #endif
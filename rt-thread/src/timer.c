@@ -21,6 +21,7 @@
  * 2022-04-19     Stanley      Correct descriptions
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
  * 2024-01-25     Shell        add RT_TIMER_FLAG_THREAD_TIMER for timer to sync with sched
+ * 2025-12-20     Voyager      add hierarchical timing wheel backend (RT_USING_TIMER_WHEEL)
  */
 
 #include <rtthread.h>
@@ -30,8 +31,52 @@
 #define DBG_LVL           DBG_INFO
 #include <rtdbg.h>
 
+#ifdef RT_USING_TIMER_WHEEL
+/*
+ * Hierarchical timing wheel, a compile-time alternative to the skip list.
+ *
+ * Level n has 32 slots of 32^n ticks each. A timer goes into the lowest level
+ * whose span covers its distance from wheel->tick, so starting and stopping a
+ * timer are O(1) list operations. When wheel->tick reaches the start of a slot
+ * on level n > 0, the timers in that slot are placed again one or more levels
+ * down (cascade). A timer is moved at most RT_TIMER_WHEEL_LEVELS - 1 times,
+ * which makes expiry amortised O(1). Timers further away than the top level
+ * spans are parked in its farthest slot and placed again when it comes round.
+ *
+ * map[] has one bit per non-empty slot, so ticks without work are skipped in
+ * one step. Stopping a timer leaves the bit set (the timer does not record its
+ * slot); a stale bit is dropped when its slot is reached.
+ *
+ * Timers due on the same tick expire in the order they reached the level 0
+ * slot, which is not always the order they were started in.
+ */
+#if RT_TIMER_WHEEL_LEVELS < 2 || RT_TIMER_WHEEL_LEVELS > 6
+#error "RT_TIMER_WHEEL_LEVELS must be 2 to 6"
+#endif
+
+#define _WHEEL_BITS             5
+#define _WHEEL_SIZE             (1U << _WHEEL_BITS)
+#define _WHEEL_MASK             (_WHEEL_SIZE - 1)
+#define _WHEEL_SHIFT(level)     ((level) * _WHEEL_BITS)
+#define _WHEEL_SPAN             ((rt_tick_t)1 << _WHEEL_SHIFT(RT_TIMER_WHEEL_LEVELS))
+
+struct _timer_wheel
+{
+    rt_tick_t   tick;                                   /* tick being expired, earlier ticks are done */
+    rt_uint32_t map[RT_TIMER_WHEEL_LEVELS];             /* non-empty slots, may hold stale bits */
+    rt_list_t   slot[RT_TIMER_WHEEL_LEVELS][_WHEEL_SIZE];
+};
+
+typedef struct _timer_wheel _timer_queue_t;
+#define _TIMER_QUEUE_SIZE       1
+#else
+/* one list head per skip list level */
+typedef rt_list_t _timer_queue_t;
+#define _TIMER_QUEUE_SIZE       RT_TIMER_SKIP_LIST_LEVEL
+#endif /* RT_USING_TIMER_WHEEL */
+
 /* hard timer list */
-static rt_list_t _timer_list[RT_TIMER_SKIP_LIST_LEVEL];
+static _timer_queue_t _timer_list[_TIMER_QUEUE_SIZE];
 static struct rt_spinlock _htimer_lock;
 
 #ifdef RT_USING_TIMER_SOFT
@@ -45,7 +90,7 @@ static struct rt_spinlock _htimer_lock;
 #endif /* RT_TIMER_THREAD_PRIO */
 
 /* soft timer list */
-static rt_list_t _soft_timer_list[RT_TIMER_SKIP_LIST_LEVEL];
+static _timer_queue_t _soft_timer_list[_TIMER_QUEUE_SIZE];
 static struct rt_spinlock _stimer_lock;
 static struct rt_thread _timer_thread;
 static struct rt_semaphore _soft_timer_sem;
@@ -148,18 +193,161 @@ static void _timer_init(rt_timer_t timer,
     }
 }
 
+#ifdef RT_USING_TIMER_WHEEL
+/**
+ * @brief Put a timer into the slot matching its timeout tick
+ *
+ * @param wheel is the timing wheel
+ *
+ * @param timer is the timer, not on any list
+ */
+static void _wheel_insert(struct _timer_wheel *wheel, rt_timer_t timer)
+{
+    rt_tick_t expires = timer->timeout_tick;
+    rt_tick_t delta;
+    rt_uint32_t idx;
+    int level;
+
+    /* an empty wheel may have stopped long ago, restart it from now */
+    for (level = 0; level < RT_TIMER_WHEEL_LEVELS && wheel->map[level] == 0; level++);
+    if (level == RT_TIMER_WHEEL_LEVELS)
+    {
+        wheel->tick = rt_tick_get();
+    }
+
+    delta = expires - wheel->tick;
+    if (delta >= RT_TICK_MAX / 2)
+    {
+        /* already due, expire it with the current tick */
+        expires = wheel->tick;
+        delta = 0;
+    }
+    else if (delta >= _WHEEL_SPAN)
+    {
+        /* park it in the farthest slot of the top level */
+        expires = wheel->tick + _WHEEL_SPAN - 1;
+        delta = _WHEEL_SPAN - 1;
+    }
+
+    for (level = 0; level < RT_TIMER_WHEEL_LEVELS - 1; level++)
+    {
+        if (delta < ((rt_tick_t)_WHEEL_SIZE << _WHEEL_SHIFT(level)))
+            break;
+    }
+    idx = (expires >> _WHEEL_SHIFT(level)) & _WHEEL_MASK;
+    rt_list_insert_before(&wheel->slot[level][idx], &timer->row[0]);
+    wheel->map[level] |= 1U << idx;
+}
+
+/**
+ * @brief Move the timers of the level slot starting at wheel->tick down the wheel
+ *
+ * @param wheel is the timing wheel
+ *
+ * @param level is the level, 1 or above
+ */
+static void _wheel_cascade(struct _timer_wheel *wheel, int level)
+{
+    rt_uint32_t idx = (wheel->tick >> _WHEEL_SHIFT(level)) & _WHEEL_MASK;
+    rt_list_t *slot = &wheel->slot[level][idx];
+    struct rt_timer *t;
+
+    wheel->map[level] &= ~(1U << idx);
+    /* none of them can land in this slot again, so it is drained in order */
+    while (!rt_list_isempty(slot))
+    {
+        t = rt_list_entry(slot->next, struct rt_timer, row[0]);
+        rt_list_remove(&t->row[0]);
+        _wheel_insert(wheel, t);
+    }
+}
+
+/**
+ * @brief Ticks from wheel->tick to the next level 0 slot to expire or slot to cascade
+ *
+ * @param wheel is the timing wheel
+ *
+ * @return the ticks, 0 if the current level 0 slot is marked, RT_TICK_MAX if the wheel is empty
+ */
+static rt_tick_t _wheel_next(struct _timer_wheel *wheel)
+{
+    rt_tick_t next = RT_TICK_MAX;
+    rt_tick_t round, when;
+    rt_uint32_t idx, later;
+    int level;
+
+    for (level = 0; level < RT_TIMER_WHEEL_LEVELS; level++)
+    {
+        if (wheel->map[level] == 0)
+            continue;
+
+        round = (wheel->tick >> _WHEEL_SHIFT(level)) & ~(rt_tick_t)_WHEEL_MASK;
+        idx = (wheel->tick >> _WHEEL_SHIFT(level)) & _WHEEL_MASK;
+        /* level 0 expires the current slot, upper levels cascaded it on arrival */
+        later = wheel->map[level] & ~((level ? 2U << idx : 1U << idx) - 1);
+        if (later)
+            when = (round + __rt_ffs(later) - 1) << _WHEEL_SHIFT(level);
+        else
+            when = (round + _WHEEL_SIZE + __rt_ffs(wheel->map[level]) - 1) << _WHEEL_SHIFT(level);
+
+        if (when - wheel->tick < next)
+            next = when - wheel->tick;
+    }
+    return next;
+}
+#endif /* RT_USING_TIMER_WHEEL */
+
+/**
+ * @brief Initialize a timer list
+ *
+ * @param timer_list is the timer list
+ */
+static void _timer_list_init(_timer_queue_t timer_list[])
+{
+#ifdef RT_USING_TIMER_WHEEL
+    int level, i;
+
+    for (level = 0; level < RT_TIMER_WHEEL_LEVELS; level++)
+    {
+        timer_list->map[level] = 0;
+        for (i = 0; i < _WHEEL_SIZE; i++)
+        {
+            rt_list_init(&timer_list->slot[level][i]);
+        }
+    }
+    timer_list->tick = rt_tick_get();
+#else
+    rt_size_t i;
+
+    for (i = 0; i < _TIMER_QUEUE_SIZE; i++)
+    {
+        rt_list_init(timer_list + i);
+    }
+#endif /* RT_USING_TIMER_WHEEL */
+}
+
 /**
  * @brief  Find the next emtpy timer ticks
  *
  * @param timer_list is the array of time list
  *
- * @param timeout_tick is the next timer's ticks
+ * @param timeout_tick is the next timer's ticks. With the timing wheel this
+ *        may be an earlier tick at which timers move down the wheel.
  *
  * @return  Return the operation status. If the return value is RT_EOK, the function is successfully executed.
  *          If the return value is any other values, it means this operation failed.
  */
-static rt_err_t _timer_list_next_timeout(rt_list_t timer_list[], rt_tick_t *timeout_tick)
+static rt_err_t _timer_list_next_timeout(_timer_queue_t timer_list[], rt_tick_t *timeout_tick)
 {
+#ifdef RT_USING_TIMER_WHEEL
+    rt_tick_t next = _wheel_next(timer_list);
+
+    if (next != RT_TICK_MAX)
+    {
+        *timeout_tick = timer_list->tick + next;
+        return RT_EOK;
+    }
+#else
     struct rt_timer *timer;
 
     if (!rt_list_isempty(&timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1]))
@@ -169,9 +357,80 @@ static rt_err_t _timer_list_next_timeout(rt_list_t timer_list[], rt_tick_t *time
         *timeout_tick = timer->timeout_tick;
         return RT_EOK;
     }
+#endif /* RT_USING_TIMER_WHEEL */
     return -RT_ERROR;
 }
 
+/**
+ * @brief Find the first timer that is due at current_tick
+ *
+ * @param timer_list is the array of time list
+ *
+ * @param current_tick is the current tick
+ *
+ * @return the timer, still on the list, or RT_NULL if no timer is due
+ */
+static struct rt_timer *_timer_list_expired(_timer_queue_t timer_list[], rt_tick_t current_tick)
+{
+    struct rt_timer *t;
+#ifdef RT_USING_TIMER_WHEEL
+    rt_list_t *slot;
+    rt_tick_t next;
+    int level;
+
+    for (;;)
+    {
+        slot = &timer_list->slot[0][timer_list->tick & _WHEEL_MASK];
+        if (!rt_list_isempty(slot))
+        {
+            t = rt_list_entry(slot->next, struct rt_timer, row[0]);
+            return t;
+        }
+        timer_list->map[0] &= ~(1U << (timer_list->tick & _WHEEL_MASK));
+        if (timer_list->tick == current_tick)
+        {
+            return RT_NULL;
+        }
+
+        /* one tick per call is the usual case, longer gaps jump to the next tick with work */
+        next = 1;
+        if (current_tick - timer_list->tick > 1)
+        {
+            next = _wheel_next(timer_list);
+            if (next > current_tick - timer_list->tick)
+            {
+                timer_list->tick = current_tick;
+                return RT_NULL;
+            }
+        }
+        timer_list->tick += next;
+        for (level = 1; level < RT_TIMER_WHEEL_LEVELS; level++)
+        {
+            if (timer_list->tick & (((rt_tick_t)1 << _WHEEL_SHIFT(level)) - 1))
+                break;
+            _wheel_cascade(timer_list, level);
+        }
+    }
+#else
+    if (rt_list_isempty(&timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1]))
+    {
+        return RT_NULL;
+    }
+    t = rt_list_entry(timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1].next,
+                      struct rt_timer, row[RT_TIMER_SKIP_LIST_LEVEL - 1]);
+
+    /*
+     * It supposes that the new tick shall less than the half duration of
+     * tick max.
+     */
+    if ((current_tick - t->timeout_tick) < RT_TICK_MAX / 2)
+    {
+        return t;
+    }
+    return RT_NULL;
+#endif /* RT_USING_TIMER_WHEEL */
+}
+
 /**
  * @brief Remove the timer
  *
@@ -395,12 +654,14 @@ RTM_EXPORT(rt_timer_delete);
  *
  * @return the operation status, RT_EOK on OK, -RT_ERROR on error
  */
-static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
+static rt_err_t _timer_start(_timer_queue_t *timer_list, rt_timer_t timer)
 {
+#ifndef RT_USING_TIMER_WHEEL
     unsigned int row_lvl;
     rt_list_t *row_head[RT_TIMER_SKIP_LIST_LEVEL];
     unsigned int tst_nr;
     static unsigned int random_nr;
+#endif /* RT_USING_TIMER_WHEEL */
 
     /* remove timer from list */
     _timer_remove(timer);
@@ -411,6 +672,9 @@ static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
 
     timer->timeout_tick = rt_tick_get() + timer->init_tick;
 
+#ifdef RT_USING_TIMER_WHEEL
+    _wheel_insert(timer_list, timer);
+#else
     row_head[0]  = &timer_list[0];
     for (row_lvl = 0; row_lvl < RT_TIMER_SKIP_LIST_LEVEL; row_lvl++)
     {
@@ -461,6 +725,7 @@ static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
          * bits. */
         tst_nr >>= (RT_TIMER_SKIP_LIST_MASK + 1) >> 1;
     }
+#endif /* RT_USING_TIMER_WHEEL */
 
     timer->parent.flag |= RT_TIMER_FLAG_ACTIVATED;
 
@@ -479,7 +744,7 @@ rt_err_t rt_timer_start(rt_timer_t timer)
     rt_sched_lock_level_t slvl;
     int is_thread_timer = 0;
     struct rt_spinlock *spinlock;
-    rt_list_t *timer_list;
+    _timer_queue_t *timer_list;
     rt_base_t level;
     rt_err_t err;
 
@@ -683,16 +948,10 @@ void rt_timer_check(void)
 
     rt_list_init(&list);
 
-    while (!rt_list_isempty(&_timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1]))
+    for (;;)
     {
-        t = rt_list_entry(_timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1].next,
-                          struct rt_timer, row[RT_TIMER_SKIP_LIST_LEVEL - 1]);
-
-        /*
-         * It supposes that the new tick shall less than the half duration of
-         * tick max.
-         */
-        if ((current_tick - t->timeout_tick) < RT_TICK_MAX / 2)
+        t = _timer_list_expired(_timer_list, current_tick);
+        if (t != RT_NULL)
         {
             RT_OBJECT_HOOK_CALL(rt_timer_enter_hook, (t));
 
@@ -737,6 +996,9 @@ void rt_timer_check(void)
 /**
  * @brief This function will return the next timeout tick in the system.
  *
+ * @note With RT_USING_TIMER_WHEEL the tick may be earlier than the first
+ *       timeout, when timers move down the wheel; it is never later.
+ *
  * @return the next timeout tick in the system
  */
 rt_tick_t rt_timer_next_timeout_tick(void)
@@ -767,18 +1029,12 @@ static void _soft_timer_check(void)
     LOG_D("software timer check enter");
     level = rt_spin_lock_irqsave(&_stimer_lock);
 
-    while (!rt_list_isempty(&_soft_timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1]))
+    for (;;)
     {
-        t = rt_list_entry(_soft_timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1].next,
-                            struct rt_timer, row[RT_TIMER_SKIP_LIST_LEVEL - 1]);
-
         current_tick = rt_tick_get();
 
-        /*
-         * It supposes that the new tick shall less than the half duration of
-         * tick max.
-         */
-        if ((current_tick - t->timeout_tick) < RT_TICK_MAX / 2)
+        t = _timer_list_expired(_soft_timer_list, current_tick);
+        if (t != RT_NULL)
         {
             RT_OBJECT_HOOK_CALL(rt_timer_enter_hook, (t));
 
@@ -877,12 +1133,7 @@ static void _timer_thread_entry(void *parameter)
  */
 void rt_system_timer_init(void)
 {
-    rt_size_t i;
-
-    for (i = 0; i < sizeof(_timer_list) / sizeof(_timer_list[0]); i++)
-    {
-        rt_list_init(_timer_list + i);
-    }
+    _timer_list_init(_timer_list);
     rt_spin_lock_init(&_htimer_lock);
 }
 
@@ -894,14 +1145,7 @@ void rt_system_timer_init(void)
 void rt_system_timer_thread_init(void)
 {
 #ifdef RT_USING_TIMER_SOFT
-    int i;
-
-    for (i = 0;
-         i < sizeof(_soft_timer_list) / sizeof(_soft_timer_list[0]);
-         i++)
-    {
-        rt_list_init(_soft_timer_list + i);
-    }
+    _timer_list_init(_soft_timer_list);
     rt_spin_lock_init(&_stimer_lock);
     rt_sem_init(&_soft_timer_sem, "stimer", 0, RT_IPC_FLAG_PRIO);
     /* start software timer thread */
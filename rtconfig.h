@@ -92,6 +92,9 @@
 #define RT_USING_SERIAL
 #define RT_USING_SERIAL_V1
 #define RT_SERIAL_RB_BUFSZ 64
+#define RT_USING_CPUTIME
+#define RT_USING_CPUTIME_CORTEXM
+#define CPUTIME_TIMER_FREQ 0
 #define RT_USING_PWM
 #define RT_USING_SPI
 #define RT_USING_PIN
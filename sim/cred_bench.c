@@ -0,0 +1,423 @@
+/**
+ * @file    cred_bench.c
+ * @brief   凭据存储(Driver/cred.c)的主机基准测试
+ * @details 直接包含 cred.c，与 rt-thread/components/fal/src 中的 FAL 和 fal_sim.c 中的主机 NOR
+ *          Flash 一起编译，按 board/port/fal_cfg.h 的分区表使用 1MB 的 "easyflash" 分区。
+ *          工程默认的 2048 个用户在这里放大为 CRED_MAX_USERS 16384、CRED_INDEX_BITS 15：
+ *          - 在空白 Flash 上格式化，添加用户 1 ~ N-1(用户 0 为内置 PIN)，再把每 10 个用户中的
+ *            一个吊销后换成新 PIN，使存储区中同时有 ADD、DEL 与被替换的记录
+ *          - mount：释放索引后重新调用 cred_init()，即开机时查找分区、分配索引与回放记录的全过程
+ *          - replay：只计 cred_replay() 顺序读取存储区并重建索引的时间
+ *          - verify：正确 PIN(随机用户的当前 PIN)、只错最后一位的 PIN 与随机错误 PIN 轮流校验，
+ *            分别统计耗时和每次读 Flash 的次数，并比较三类的中位数(校验时间应与输入无关)；
+ *            硬件哈希后端只能在开发板上测量
+ *          时间为主机纳秒，只反映算法与数据量的关系；Flash 模型不计耗时，读取量单独列出，
+ *          开发板上的时间用 msh 命令 cred bench 测量。结束前检查每个用户的 PIN 都能校验到本人、
+ *          被替换的旧 PIN 不再通过、重新挂载后用户数不变，有错误时返回 1。
+ *          用法：cred_bench [用户数] [校验次数]，默认 10000 与 100000。
+ * @date    2025-12-20
+ */
+
+/* rtconfig_preinc.h 把 _POSIX_C_SOURCE 定义为 1，clock_gettime() 需要 199309 */
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE     199309L
+
+#define CRED_MAX_USERS      16384
+#define CRED_INDEX_BITS     15
+
+#include <rtthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fal_sim.h"
+
+/* 不编译 msh 命令 */
+#undef RT_USING_FINSH
+#include "cred.c"
+
+#define BENCH_MOUNTS        20          /* mount/replay 的重复次数 */
+#define BENCH_PIN_MUL       7919        /* 与 10^6 互素，x -> x * 7919 mod 10^6 是 PIN 的一一映射 */
+#define BENCH_PIN_INV       17679       /* 7919 模 10^6 的逆 */
+
+static rt_uint8_t bench_gen[CRED_MAX_USERS];    /* 用户当前 PIN 的代数，PIN 由 (代数, 用户) 生成 */
+static rt_uint32_t bench_users;
+static rt_uint32_t bench_seed = 1;
+static rt_bool_t bench_quiet;
+static int bench_fails;
+
+static rt_uint32_t bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return bench_seed >> 8;
+}
+
+static double bench_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_pin(rt_uint32_t x, rt_uint8_t *pin)
+{
+    rt_uint32_t v = (rt_uint32_t)((rt_uint64_t)x * BENCH_PIN_MUL % 1000000);
+    int j;
+
+    for (j = CRED_PIN_LEN - 1; j >= 0; j--, v /= 10) pin[j] = v % 10;
+}
+
+/* 第 gen 代的用户 PIN，各代、各用户的 x 互不相同；用户 0 使用内置 PIN */
+static void bench_user_pin(rt_uint32_t user, rt_uint8_t *pin)
+{
+    if (user == 0)
+    {
+        rt_memcpy(pin, cred_default_pin, CRED_PIN_LEN);
+        return;
+    }
+    bench_pin(user + bench_gen[user] * CRED_MAX_USERS, pin);
+}
+
+/* 不属于任何用户的 PIN：x 取在所有代用过的范围之外，并避开内置 PIN */
+static void bench_bad_pin(rt_uint8_t *pin)
+{
+    do
+    {
+        bench_pin(4 * CRED_MAX_USERS + bench_rand() % (1000000 - 4 * CRED_MAX_USERS), pin);
+    } while (!memcmp(pin, cred_default_pin, CRED_PIN_LEN));
+}
+
+static void bench_check(int ok, const char *what, rt_uint32_t user)
+{
+    if (ok) return;
+    if (bench_fails++ < 10) printf("FAIL: %s, user %u\n", what, user);
+}
+
+/* 单项耗时统计(纳秒) */
+typedef struct
+{
+    double min;
+    double max;
+    double sum;
+    rt_uint32_t count;
+    rt_uint32_t reads;          /* 期间读 Flash 的次数 */
+} bench_stat_t;
+
+static void bench_stat_add(bench_stat_t *st, double t)
+{
+    if (st->count == 0 || t < st->min) st->min = t;
+    if (t > st->max) st->max = t;
+    st->sum += t;
+    st->count++;
+}
+
+static void bench_stat_print(const char *name, const bench_stat_t *st, double unit, const char *suffix)
+{
+    printf("%-11s min %9.1f %s  avg %9.1f %s  max %9.1f %s", name, st->min / unit, suffix,
+           st->sum / st->count / unit, suffix, st->max / unit, suffix);
+    if (st->reads) printf("  %.2f reads", (double)st->reads / st->count);
+    printf("\n");
+}
+
+/* 模拟重启：释放索引后重新初始化 */
+static void bench_remount(void)
+{
+    rt_mutex_detach(&cred_lock);
+    rt_free(cred_index);
+    rt_free(cred_user);
+    cred_index = RT_NULL;
+    cred_user = RT_NULL;
+    cred_ready = 0;
+    bench_check(cred_init() == RT_EOK, "mount", 0);
+}
+
+/* 添加用户并制造替换记录 */
+static void bench_fill(void)
+{
+    rt_uint8_t pin[CRED_PIN_LEN];
+    bench_stat_t add = {0};
+    rt_uint32_t user;
+    double t0;
+
+    bench_check(cred_init() == RT_EOK, "format", 0);
+    for (user = 1; user < bench_users; user++)
+    {
+        bench_user_pin(user, pin);
+        t0 = bench_ns();
+        bench_check(cred_add(user, CRED_TYPE_RESIDENT, pin) == RT_EOK, "add", user);
+        bench_stat_add(&add, bench_ns() - t0);
+    }
+    for (user = 10; user < bench_users; user += 10)
+    {
+        bench_check(cred_revoke(user) == RT_EOK, "revoke", user);
+        bench_gen[user]++;
+        bench_user_pin(user, pin);
+        bench_check(cred_add(user, CRED_TYPE_TEMP, pin) == RT_EOK, "re-add", user);
+    }
+    bench_stat_print("add", &add, 1e3, "us");
+}
+
+/* 开机挂载与索引重建 */
+static void bench_mount(void)
+{
+    bench_stat_t mount = {0}, replay = {0};
+    fal_sim_stat_t before;
+    rt_uint64_t bytes = 0;
+    double t0;
+    int k;
+
+    bench_quiet = RT_TRUE;
+    for (k = 0; k < BENCH_MOUNTS; k++)
+    {
+        before = fal_sim_stat;
+        t0 = bench_ns();
+        bench_remount();
+        bench_stat_add(&mount, bench_ns() - t0);
+        mount.reads += fal_sim_stat.reads - before.reads;
+        bytes = fal_sim_stat.read_bytes - before.read_bytes;
+
+        before = fal_sim_stat;
+        t0 = bench_ns();
+        cred_replay();
+        bench_stat_add(&replay, bench_ns() - t0);
+        replay.reads += fal_sim_stat.reads - before.reads;
+    }
+    bench_quiet = RT_FALSE;
+
+    printf("users %u, records %u, %u/%u bytes used, %u/%u slots used, %u KB read per mount\n",
+           cred_live, (cred_tail - cred_bank) / CRED_REC_SIZE - 1, cred_tail - cred_bank, cred_bank_size,
+           cred_used, (rt_uint32_t)CRED_INDEX_SIZE, (rt_uint32_t)(bytes / 1024));
+    bench_stat_print("mount", &mount, 1e6, "ms");
+    bench_stat_print("replay", &replay, 1e6, "ms");
+    bench_check(cred_count() == bench_users, "count after mount", cred_count());
+}
+
+/* PIN 当前属于哪个用户，不属于任何用户返回 -1 */
+static rt_int32_t bench_owner(const rt_uint8_t *pin)
+{
+    rt_uint32_t v = 0, x, user, gen;
+    int j;
+
+    if (!memcmp(pin, cred_default_pin, CRED_PIN_LEN)) return 0;
+    for (j = 0; j < CRED_PIN_LEN; j++) v = v * 10 + pin[j];
+    x = (rt_uint32_t)((rt_uint64_t)v * BENCH_PIN_INV % 1000000);
+    user = x % CRED_MAX_USERS;
+    gen = x / CRED_MAX_USERS;
+    if (user == 0 || user >= bench_users || gen != bench_gen[user]) return -1;
+    return (rt_int32_t)user;
+}
+
+static int bench_cmp(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static double bench_median(double *t, int n)
+{
+    qsort(t, n, sizeof(double), bench_cmp);
+    return t[n / 2];
+}
+
+/*
+ * 三类输入轮流校验：正确 PIN、只有最后一位不同的 PIN(前 5 位正确)、随机错误 PIN。
+ * 校验时间与输入无关时三类的耗时相同，读 Flash 的次数也相同；主机上偶尔被抢占，
+ * 平均值受个别大值影响，三类之间用中位数比较
+ */
+static void bench_verify(int count)
+{
+    static const char *const name[3] = {"verify ok", "verify near", "verify bad"};
+    bench_stat_t hash = {0}, st[3] = {{0}};
+    rt_uint8_t pin[CRED_PIN_LEN], digest[SHA256_DIGEST_SIZE];
+    rt_uint32_t user, reads;
+    rt_int32_t ret, owner;
+    double t0, t, med[3], lo, hi;
+    double *samples[3];
+    int i, k;
+
+    for (k = 0; k < 3; k++) samples[k] = malloc(count * sizeof(double));
+
+    for (i = 0; i < count; i++)
+    {
+        bench_bad_pin(pin);
+        t0 = bench_ns();
+        cred_hash_sw(pin, digest);
+        bench_stat_add(&hash, bench_ns() - t0);
+    }
+
+    for (i = 0; i < 3 * count; i++)
+    {
+        k = i % 3;
+        do
+        {
+            user = bench_rand() % bench_users;
+            if (k == 2)
+            {
+                bench_bad_pin(pin);
+            }
+            else
+            {
+                bench_user_pin(user, pin);
+                if (k == 1) pin[CRED_PIN_LEN - 1] = (pin[CRED_PIN_LEN - 1] + 1) % 10;
+            }
+            owner = bench_owner(pin);
+        } while (k != 0 && owner >= 0);     /* 改过的 PIN 恰好属于其他用户时重选 */
+
+        reads = fal_sim_stat.reads;
+        t0 = bench_ns();
+        ret = cred_verify(pin);
+        t = bench_ns() - t0;
+        reads = fal_sim_stat.reads - reads;
+
+        bench_check(ret == owner, name[k], user);
+        bench_check(reads >= 1, "verify without flash read", user);
+        samples[k][st[k].count] = t;
+        bench_stat_add(&st[k], t);
+        st[k].reads += reads;
+    }
+
+    bench_stat_print("hash sw", &hash, 1, "ns");
+    printf("%-11s no hwcrypto device on the host, measure with cred bench on the board\n", "hash hw");
+    for (k = 0; k < 3; k++)
+    {
+        bench_stat_print(name[k], &st[k], 1, "ns");
+        med[k] = bench_median(samples[k], count);
+        free(samples[k]);
+    }
+    lo = hi = med[0];
+    for (k = 1; k < 3; k++)
+    {
+        if (med[k] < lo) lo = med[k];
+        if (med[k] > hi) hi = med[k];
+    }
+    printf("verify median ok/near/bad %.1f/%.1f/%.1f ns, spread %.1f%%\n",
+           med[0], med[1], med[2], (hi - lo) * 100 / lo);
+    bench_check(st[0].reads == st[1].reads && st[1].reads == st[2].reads, "flash reads differ by input", 0);
+}
+
+/* 每个用户的当前 PIN 校验到本人，被替换的旧 PIN 不再通过 */
+static void bench_verify_all(void)
+{
+    rt_uint8_t pin[CRED_PIN_LEN];
+    rt_uint32_t user;
+
+    for (user = 0; user < bench_users; user++)
+    {
+        bench_user_pin(user, pin);
+        bench_check(cred_verify(pin) == (rt_int32_t)user, "current PIN", user);
+        if (bench_gen[user])
+        {
+            bench_pin(user + (bench_gen[user] - 1) * CRED_MAX_USERS, pin);
+            bench_check(cred_verify(pin) == -1, "old PIN accepted", user);
+        }
+    }
+    bench_check(fal_sim_stat.overwrites == 0, "NOR overwrite", fal_sim_stat.overwrites);
+}
+
+int main(int argc, char **argv)
+{
+    int count;
+
+    bench_users = argc > 1 ? atoi(argv[1]) : 10000;
+    count = argc > 2 ? atoi(argv[2]) : 100000;
+    if (bench_users < 2 || bench_users > CRED_MAX_USERS || count < 1)
+    {
+        fprintf(stderr, "user count must be 2 to %d\n", CRED_MAX_USERS);
+        return 1;
+    }
+
+    if (fal_init() <= 0) return 1;
+    bench_fill();
+    bench_mount();
+    bench_verify(count);
+    bench_verify_all();
+
+    printf("flash: %u reads %llu KB, %u writes, %u blocks erased\n", fal_sim_stat.reads,
+           (unsigned long long)fal_sim_stat.read_bytes / 1024, fal_sim_stat.writes, fal_sim_stat.erases);
+    if (bench_fails) printf("%d checks failed\n", bench_fails);
+    return bench_fails ? 1 : 0;
+}
+
+/* ===================== 内核替身 ===================== */
+
+rt_tick_t rt_tick_get(void)
+{
+    return (rt_tick_t)(bench_ns() / (1e9 / RT_TICK_PER_SECOND));
+}
+
+rt_uint64_t clock_cpu_gettime(void)
+{
+    return (rt_uint64_t)bench_ns();
+}
+
+/* 芯片 UID：主机上固定为一台设备 */
+uint32_t HAL_GetUIDw0(void)
+{
+    return 0x00350041;
+}
+
+uint32_t HAL_GetUIDw1(void)
+{
+    return 0x34385111;
+}
+
+uint32_t HAL_GetUIDw2(void)
+{
+    return 0x32383039;
+}
+
+int rt_kprintf(const char *fmt, ...)
+{
+    va_list args;
+    int n;
+
+    if (bench_quiet) return 0;
+    va_start(args, fmt);
+    n = vprintf(fmt, args);
+    va_end(args);
+    return n;
+}
+
+void *rt_malloc(rt_size_t size)
+{
+    return malloc(size);
+}
+
+void rt_free(void *ptr)
+{
+    free(ptr);
+}
+
+void *rt_memcpy(void *dst, const void *src, rt_ubase_t count)
+{
+    return memcpy(dst, src, count);
+}
+
+void *rt_memset(void *s, int c, rt_ubase_t count)
+{
+    return memset(s, c, count);
+}
+
+/* 单线程运行，互斥量不需要实际加锁 */
+rt_err_t rt_mutex_init(rt_mutex_t mutex, const char *name, rt_uint8_t flag)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_detach(rt_mutex_t mutex)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_release(rt_mutex_t mutex)
+{
+    return RT_EOK;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    fal_sim.c
+ * @brief   FAL 的主机 Flash 设备
+ * @details 以内存数组实现 board/port/fal_cfg.h 中的 nor_flash0，与 rt-thread/components/fal/src
+ *          中的 FAL 源文件一起编译，使凭据存储等使用 FAL 分区的代码可以在主机上运行。
+ *          按 NOR Flash 的规则工作：擦除以 FAL_SIM_BLK_SIZE 为单位把数据置为 0xFF，
+ *          写入只能把 1 变成 0(与原数据按位与)，需要把 0 变回 1 的字节计入 overwrites。
+ *          各操作的次数与字节数记录在 fal_sim_stat 中，不模拟耗时。
+ * @date    2025-12-20
+ */
+
+#include <fal.h>
+#include <string.h>
+#include "fal_sim.h"
+
+fal_sim_stat_t fal_sim_stat;
+
+static rt_uint8_t fal_sim_mem[FAL_SIM_SIZE];
+
+static int fal_sim_init(void)
+{
+    memset(fal_sim_mem, 0xFF, sizeof(fal_sim_mem));
+    return 0;
+}
+
+static int fal_sim_read(long offset, uint8_t *buf, size_t size)
+{
+    if (offset < 0 || offset + size > FAL_SIM_SIZE) return -1;
+    memcpy(buf, fal_sim_mem + offset, size);
+    fal_sim_stat.reads++;
+    fal_sim_stat.read_bytes += size;
+    return (int)size;
+}
+
+static int fal_sim_write(long offset, const uint8_t *buf, size_t size)
+{
+    size_t i;
+
+    if (offset < 0 || offset + size > FAL_SIM_SIZE) return -1;
+    for (i = 0; i < size; i++)
+    {
+        if ((fal_sim_mem[offset + i] & buf[i]) != buf[i]) fal_sim_stat.overwrites++;
+        fal_sim_mem[offset + i] &= buf[i];
+    }
+    fal_sim_stat.writes++;
+    fal_sim_stat.write_bytes += size;
+    return (int)size;
+}
+
+static int fal_sim_erase(long offset, size_t size)
+{
+    if (offset < 0 || offset + size > FAL_SIM_SIZE) return -1;
+    if (offset % FAL_SIM_BLK_SIZE || size % FAL_SIM_BLK_SIZE) return -1;
+    memset(fal_sim_mem + offset, 0xFF, size);
+    fal_sim_stat.erases += size / FAL_SIM_BLK_SIZE;
+    return (int)size;
+}
+
+struct fal_flash_dev nor_flash0 =
+{
+    .name       = NOR_FLASH_DEV_NAME,
+    .addr       = 0,
+    .len        = FAL_SIM_SIZE,
+    .blk_size   = FAL_SIM_BLK_SIZE,
+    .ops        = {fal_sim_init, fal_sim_read, fal_sim_write, fal_sim_erase},
+    .write_gran = 1,
+};
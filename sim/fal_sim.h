@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef SIM_FAL_SIM_H_
+#define SIM_FAL_SIM_H_
+
+#include <rtthread.h>
+
+/* 主机 NOR Flash 模型：代替 board/port/fal_cfg.h 中的 nor_flash0 */
+#define FAL_SIM_SIZE        (16 * 1024 * 1024)  /* 与分区表覆盖的范围一致 */
+#define FAL_SIM_BLK_SIZE    4096                /* 擦除块 */
+
+/* 访问统计，可随时清零 */
+typedef struct
+{
+    rt_uint32_t reads;
+    rt_uint32_t writes;
+    rt_uint32_t erases;
+    rt_uint64_t read_bytes;
+    rt_uint64_t write_bytes;
+    rt_uint32_t overwrites;     /* 写入需要把 0 变回 1 的字节数，NOR 上写不进去，正常应为 0 */
+} fal_sim_stat_t;
+
+extern fal_sim_stat_t fal_sim_stat;
+
+#endif /* SIM_FAL_SIM_H_ */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef SIM_SIM_H_
+#define SIM_SIM_H_
+
+#include <rtthread.h>
+#include <stdio.h>
+
+/* 仿真时钟：纳秒，只在所有线程都阻塞或模拟耗时操作时前进 */
+#define SIM_NS_PER_TICK     (1000000000ULL / RT_TICK_PER_SECOND)
+#define SIM_NS_FOREVER      (~0ULL)
+
+#define SIM_THREAD_MAX      32          /* 最多线程数 */
+#define SIM_TIMER_MAX       64          /* 最多同时运行的定时器数 */
+#define SIM_STIM_PRIO       0           /* 按键脚本线程优先级，高于所有应用线程，相当于外部世界 */
+#define SIM_MAIN_PRIO       10          /* main 线程优先级，与 RT_MAIN_THREAD_PRIORITY 一致 */
+
+/* 调试输出 */
+extern FILE *sim_servo_log;             /* 舵机脉宽记录，RT_NULL 时不记录 */
+extern int sim_verbose;
+
+/* sim_kernel.c：调度与时钟 */
+rt_uint64_t sim_now(void);
+void sim_busy(rt_uint64_t ns);
+void sim_sleep_until(rt_uint64_t ns);
+void sim_isr_enter(void);
+void sim_isr_leave(void);
+void sim_start(void (*entry)(void *parameter), void *parameter);
+void sim_exit(int code);
+
+/* sim_board.c：外设模型 */
+typedef struct
+{
+    rt_uint64_t bytes;                  /* SPI 发送的字节数 */
+    rt_uint32_t xfers;                  /* 同步传输次数，消息链按一次计 */
+    rt_uint32_t dma;                    /* DMA 提交次数 */
+    rt_uint32_t windows;                /* 0x2A 列地址命令数，即地址窗口设置次数 */
+    rt_uint32_t ramwr;                  /* 0x2C 写显存命令数 */
+    rt_uint64_t pixels;                 /* 写入显存的像素数 */
+} sim_spi_stat_t;
+
+extern sim_spi_stat_t sim_spi_stats;    /* 屏幕 SPI 流量，可随时清零 */
+
+void sim_key_set(rt_uint8_t key, rt_bool_t down);
+void sim_panel_dump(const char *path);
+rt_uint16_t sim_panel_pixel(int x, int y);
+void sim_board_report(void);
+
+#endif /* SIM_SIM_H_ */
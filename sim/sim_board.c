@@ -0,0 +1,484 @@
+/**
+ * @file    sim_board.c
+ * @brief   主机仿真用的外设模型
+ * @details - GPIO：按端口保存输出电平，4x4 键盘的列线电平由按下的按键和行线输出决定，
+ *            列线下降沿触发 rt_pin_attach_irq 注册的中断
+ *          - SPI5 + ST7735：按 DC 电平解析命令，0x2A/0x2B 设置窗口，0x2C 之后的数据写入
+ *            显存，可导出为 PPM；每个字节按 SPI 时钟计入仿真耗时，DMA 发送在后台计时
+ *          - TIM5 PWM：记录每次设置的脉宽与时间
+ *          - 记录每次按键到屏幕开始/结束更新的时间，作为输入到显示的延迟
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <rtdevice.h>
+#include <board.h>
+#include "drv_spi.h"
+#include "lcd.h"
+#include "key.h"
+#include <string.h>
+
+/* ===================== GPIO 与键盘 ===================== */
+
+#define SIM_PORTS           16
+#define SIM_PINS            (SIM_PORTS * 16)
+#define SIM_LAT_IDLE_NS     5000000ULL  /* 屏幕停止写入超过 5ms 视为本次按键的显示更新结束 */
+
+static rt_uint32_t sim_odr[SIM_PORTS];  /* 各端口输出电平 */
+static rt_uint16_t sim_keys;            /* 按下的按键，bit k-1 对应键值 k */
+
+static struct
+{
+    void (*hdr)(void *args);
+    void *args;
+    rt_uint8_t mode;
+    rt_uint8_t enabled;
+} sim_irq[SIM_PINS];
+
+/* 键值 k = r * 4 + i + 1，列的顺序与 key.c 中 key_col_pins 一致 */
+static const rt_base_t sim_rows[4] = {KEY_R1_PIN, KEY_R2_PIN, KEY_R3_PIN, KEY_R4_PIN};
+static const rt_base_t sim_cols[4] = {KEY_C4_PIN, KEY_C3_PIN, KEY_C2_PIN, KEY_C1_PIN};
+
+/* 输入到显示的延迟 */
+static rt_uint8_t sim_lat_key;
+static rt_uint64_t sim_lat_start, sim_lat_first, sim_lat_last;
+static rt_bool_t sim_lat_done;
+static rt_uint32_t sim_lat_num, sim_lat_idle;
+static rt_uint64_t sim_lat_sum, sim_lat_max;
+
+static rt_bool_t sim_odr_get(rt_base_t pin)
+{
+    return (sim_odr[GET_PIN_PORT(pin) % SIM_PORTS] & GET_PIN_MASK(pin)) != 0;
+}
+
+/* 列线电平位图(按 sim_cols 顺序)，上拉输入，被按下且所在行输出低电平时为低 */
+static rt_uint8_t sim_col_levels(void)
+{
+    rt_uint8_t level = 0x0F;
+    int r, i;
+
+    for (i = 0; i < 4; i++)
+    {
+        for (r = 0; r < 4; r++)
+        {
+            if ((sim_keys & (1 << (r * 4 + i))) && !sim_odr_get(sim_rows[r])) level &= ~(1 << i);
+        }
+    }
+    return level;
+}
+
+/* 引脚电平变化后触发列线下降沿中断 */
+static void sim_col_edges(rt_uint8_t before)
+{
+    rt_uint8_t falling = before & ~sim_col_levels();
+    rt_base_t pin;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        pin = sim_cols[i];
+        if (!(falling & (1 << i)) || !sim_irq[pin].enabled || sim_irq[pin].hdr == RT_NULL) continue;
+        if (sim_irq[pin].mode != PIN_IRQ_MODE_FALLING && sim_irq[pin].mode != PIN_IRQ_MODE_RISING_FALLING) continue;
+        sim_isr_enter();
+        sim_irq[pin].hdr(sim_irq[pin].args);
+        sim_isr_leave();
+    }
+}
+
+static rt_bool_t sim_pin_level(rt_base_t pin)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (sim_cols[i] == pin) return (sim_col_levels() >> i) & 1;
+    }
+    return sim_odr_get(pin);
+}
+
+static void sim_lat_report(void)
+{
+    rt_uint64_t d;
+
+    if (sim_lat_start == 0) return;
+    if (sim_lat_first == 0)
+    {
+        sim_lat_idle++;
+        if (sim_verbose) rt_kprintf("[sim] key %2u: no display update\n", sim_lat_key);
+    }
+    else
+    {
+        d = sim_lat_last - sim_lat_start;
+        sim_lat_num++;
+        sim_lat_sum += d;
+        if (d > sim_lat_max) sim_lat_max = d;
+        if (sim_verbose)
+            rt_kprintf("[sim] key %2u: display update +%.3f ms .. +%.3f ms\n", sim_lat_key,
+                       (sim_lat_first - sim_lat_start) / 1e6, d / 1e6);
+    }
+    sim_lat_start = 0;
+}
+
+/**
+ * @brief  按下或释放一个按键
+ * @param  key: 键值 1-16，与 key_read() 一致
+ */
+void sim_key_set(rt_uint8_t key, rt_bool_t down)
+{
+    rt_uint8_t before = sim_col_levels();
+
+    if (key < 1 || key > 16) return;
+    if (down)
+    {
+        sim_lat_report();
+        sim_keys |= 1 << (key - 1);
+        sim_lat_key = key;
+        sim_lat_start = sim_now();
+        sim_lat_first = sim_lat_last = 0;
+        sim_lat_done = RT_FALSE;
+    }
+    else
+    {
+        sim_keys &= ~(1 << (key - 1));
+    }
+    sim_col_edges(before);
+}
+
+void rt_pin_mode(rt_base_t pin, rt_uint8_t mode)
+{
+}
+
+void rt_pin_write(rt_base_t pin, rt_ssize_t value)
+{
+    rt_uint8_t before = sim_col_levels();
+
+    if (value)
+        sim_odr[GET_PIN_PORT(pin) % SIM_PORTS] |= GET_PIN_MASK(pin);
+    else
+        sim_odr[GET_PIN_PORT(pin) % SIM_PORTS] &= ~GET_PIN_MASK(pin);
+    sim_col_edges(before);
+}
+
+rt_ssize_t rt_pin_read(rt_base_t pin)
+{
+    return sim_pin_level(pin) ? PIN_HIGH : PIN_LOW;
+}
+
+void rt_pin_port_write(rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask)
+{
+    rt_uint8_t before = sim_col_levels();
+
+    sim_odr[port % SIM_PORTS] = (sim_odr[port % SIM_PORTS] | set_mask) & ~clr_mask;
+    sim_col_edges(before);
+}
+
+rt_uint32_t rt_pin_port_read(rt_base_t port, rt_uint32_t mask)
+{
+    rt_uint32_t idr = 0;
+    int bit;
+
+    for (bit = 0; bit < 16; bit++)
+    {
+        if ((mask & (1UL << bit)) && sim_pin_level(port * 16 + bit)) idr |= 1UL << bit;
+    }
+    return idr;
+}
+
+rt_err_t rt_pin_attach_irq(rt_base_t pin, rt_uint8_t mode, void (*hdr)(void *args), void *args)
+{
+    if (pin < 0 || pin >= SIM_PINS) return -RT_EINVAL;
+    sim_irq[pin].hdr = hdr;
+    sim_irq[pin].args = args;
+    sim_irq[pin].mode = mode;
+    return RT_EOK;
+}
+
+rt_err_t rt_pin_irq_enable(rt_base_t pin, rt_uint8_t enabled)
+{
+    if (pin < 0 || pin >= SIM_PINS) return -RT_EINVAL;
+    sim_irq[pin].enabled = enabled;
+    return RT_EOK;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+/* ===================== SPI 与 ST7735 ===================== */
+
+/* ST7735 显存 132x162，可见区域在显存中的偏移与 LCD_Address_Set 一致 */
+#define SIM_GRAM_W          132
+#define SIM_GRAM_H          162
+#if USE_HORIZONTAL == 0
+#define SIM_PANEL_X0        2
+#define SIM_PANEL_Y0        1
+#elif USE_HORIZONTAL == 1
+#define SIM_PANEL_X0        2
+#define SIM_PANEL_Y0        3
+#elif USE_HORIZONTAL == 2
+#define SIM_PANEL_X0        1
+#define SIM_PANEL_Y0        2
+#else
+#define SIM_PANEL_X0        3
+#define SIM_PANEL_Y0        2
+#endif
+
+static struct rt_spi_device sim_lcd_spi;
+static rt_uint64_t sim_spi_byte_ns = 400;   /* 20MHz，rt_spi_configure 时更新 */
+static rt_uint64_t sim_dma_done;            /* 后台 DMA 发送完成时刻 */
+
+static rt_uint16_t sim_gram[SIM_GRAM_H][SIM_GRAM_W];
+static struct
+{
+    rt_uint8_t cmd;
+    rt_uint8_t arg[4];
+    rt_uint8_t argn;
+    rt_int16_t hi;                      /* 像素高字节，-1 表示下一个字节是高字节 */
+    rt_uint16_t xs, xe, ys, ye, x, y;
+} sim_panel;
+
+sim_spi_stat_t sim_spi_stats;
+
+static void sim_panel_byte(rt_uint8_t b)
+{
+    rt_uint16_t a, c;
+
+    /* DC 低电平为命令 */
+    if (!sim_odr_get(LCD_DC_PIN))
+    {
+        sim_panel.cmd = b;
+        sim_panel.argn = 0;
+        sim_panel.hi = -1;
+        if (b == 0x2A) sim_spi_stats.windows++;
+        if (b == 0x2C)
+        {
+            sim_panel.x = sim_panel.xs;
+            sim_panel.y = sim_panel.ys;
+            sim_spi_stats.ramwr++;
+        }
+        return;
+    }
+
+    switch (sim_panel.cmd)
+    {
+    case 0x2A:
+    case 0x2B:
+        if (sim_panel.argn < 4) sim_panel.arg[sim_panel.argn++] = b;
+        if (sim_panel.argn == 4)
+        {
+            a = (rt_uint16_t)((sim_panel.arg[0] << 8) | sim_panel.arg[1]);
+            c = (rt_uint16_t)((sim_panel.arg[2] << 8) | sim_panel.arg[3]);
+            if (sim_panel.cmd == 0x2A) { sim_panel.xs = a; sim_panel.xe = c; }
+            else                       { sim_panel.ys = a; sim_panel.ye = c; }
+        }
+        break;
+    case 0x2C:
+        if (sim_panel.hi < 0)
+        {
+            sim_panel.hi = b;
+            break;
+        }
+        if (sim_panel.x < SIM_GRAM_W && sim_panel.y < SIM_GRAM_H)
+            sim_gram[sim_panel.y][sim_panel.x] = (rt_uint16_t)((sim_panel.hi << 8) | b);
+        sim_panel.hi = -1;
+        sim_spi_stats.pixels++;
+        if (sim_lat_start && !sim_lat_done)
+        {
+            if (sim_lat_first == 0) sim_lat_first = sim_now();
+            if (sim_now() - sim_lat_last > SIM_LAT_IDLE_NS && sim_lat_last != 0)
+                sim_lat_done = RT_TRUE;
+            else
+                sim_lat_last = sim_now();
+        }
+        if (++sim_panel.x > sim_panel.xe)
+        {
+            sim_panel.x = sim_panel.xs;
+            if (++sim_panel.y > sim_panel.ye) sim_panel.y = sim_panel.ys;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void sim_panel_write(const void *buf, rt_size_t len)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)buf;
+    rt_size_t i;
+
+    sim_spi_stats.bytes += len;
+    if (p == RT_NULL) return;
+    for (i = 0; i < len; i++) sim_panel_byte(p[i]);
+}
+
+rt_err_t rt_hw_spi_device_attach(const char *bus_name, const char *device_name,
+                                 GPIO_TypeDef *cs_gpiox, uint16_t cs_gpio_pin)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_spi_configure(struct rt_spi_device *device, struct rt_spi_configuration *cfg)
+{
+    if (cfg->max_hz) sim_spi_byte_ns = 8000000000ULL / cfg->max_hz;
+    device->config = *cfg;
+    return RT_EOK;
+}
+
+rt_err_t rt_spi_take_bus(struct rt_spi_device *device)   { return RT_EOK; }
+rt_err_t rt_spi_release_bus(struct rt_spi_device *device) { return RT_EOK; }
+rt_err_t rt_spi_take(struct rt_spi_device *device)       { return RT_EOK; }
+rt_err_t rt_spi_release(struct rt_spi_device *device)    { return RT_EOK; }
+
+rt_ssize_t rt_spi_transfer(struct rt_spi_device *device, const void *send_buf, void *recv_buf, rt_size_t length)
+{
+    sim_spi_stats.xfers++;
+    sim_panel_write(send_buf, length);
+    if (recv_buf) rt_memset(recv_buf, 0xFF, length);
+    sim_busy(length * sim_spi_byte_ns);
+    return (rt_ssize_t)length;
+}
+
+/* 消息链按一次提交计数：每段先施加它的 GPIO 副作用(如 LCD 的 DC)，再写入屏幕模型 */
+struct rt_spi_chain_message *rt_spi_transfer_chain(struct rt_spi_device *device, struct rt_spi_chain_message *message)
+{
+    rt_size_t length = 0;
+
+    sim_spi_stats.xfers++;
+    for (; message != RT_NULL; message = rt_spi_chain_next(message))
+    {
+        if (message->gpio_set_mask || message->gpio_clr_mask)
+        {
+            rt_pin_port_write(message->gpio_port, message->gpio_set_mask, message->gpio_clr_mask);
+        }
+        sim_panel_write(message->parent.send_buf, message->parent.length);
+        if (message->parent.recv_buf) rt_memset(message->parent.recv_buf, 0xFF, message->parent.length);
+        length += message->parent.length;
+    }
+    sim_busy(length * sim_spi_byte_ns);
+    return RT_NULL;
+}
+
+/* DMA：数据在提交时写入屏幕模型，发送时间在后台计时，调用线程可以继续运行 */
+rt_err_t rt_hw_spi_dma_submit(struct rt_spi_device *device, const void *send_buf, rt_uint16_t length)
+{
+    rt_uint64_t start = sim_dma_done > sim_now() ? sim_dma_done : sim_now();
+
+    sim_spi_stats.dma++;
+    sim_panel_write(send_buf, length);
+    sim_dma_done = start + length * sim_spi_byte_ns;
+    return RT_EOK;
+}
+
+rt_bool_t rt_hw_spi_dma_poll(struct rt_spi_device *device)
+{
+    return sim_now() >= sim_dma_done;
+}
+
+rt_err_t rt_hw_spi_dma_wait(struct rt_spi_device *device, rt_int32_t timeout)
+{
+    sim_sleep_until(sim_dma_done);
+    return RT_EOK;
+}
+
+/**
+ * @brief  把屏幕可见区域导出为 PPM(P6) 文件
+ */
+void sim_panel_dump(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    rt_uint16_t c;
+    int x, y;
+
+    if (fp == RT_NULL)
+    {
+        rt_kprintf("[sim] cannot open %s\n", path);
+        return;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", LCD_W, LCD_H);
+    for (y = 0; y < LCD_H; y++)
+    {
+        for (x = 0; x < LCD_W; x++)
+        {
+            c = sim_gram[y + SIM_PANEL_Y0][x + SIM_PANEL_X0];
+            fputc(((c >> 11) & 0x1F) * 255 / 31, fp);
+            fputc(((c >> 5) & 0x3F) * 255 / 63, fp);
+            fputc((c & 0x1F) * 255 / 31, fp);
+        }
+    }
+    fclose(fp);
+}
+
+/**
+ * @brief  读取屏幕可见区域 (x, y) 处的像素(RGB565)
+ */
+rt_uint16_t sim_panel_pixel(int x, int y)
+{
+    return sim_gram[y + SIM_PANEL_Y0][x + SIM_PANEL_X0];
+}
+
+/* ===================== PWM ===================== */
+
+FILE *sim_servo_log = RT_NULL;
+static struct rt_device_pwm sim_pwm;
+
+static void sim_pwm_log(int channel, rt_uint32_t period, rt_uint32_t pulse)
+{
+    if (sim_servo_log == RT_NULL) return;
+    fprintf(sim_servo_log, "%llu,%d,%u,%u\n", (unsigned long long)(sim_now() / 1000), channel, pulse, period);
+}
+
+static rt_uint32_t sim_pwm_period;
+
+rt_err_t rt_pwm_enable(struct rt_device_pwm *device, int channel)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_pwm_set(struct rt_device_pwm *device, int channel, rt_uint32_t period, rt_uint32_t pulse)
+{
+    sim_pwm_period = period;
+    sim_pwm_log(channel, period, pulse);
+    return RT_EOK;
+}
+
+rt_err_t rt_pwm_set_pulse(struct rt_device_pwm *device, int channel, rt_uint32_t pulse)
+{
+    sim_pwm_log(channel, sim_pwm_period, pulse);
+    return RT_EOK;
+}
+
+/* ===================== 设备 ===================== */
+
+rt_device_t rt_device_find(const char *name)
+{
+    if (!strcmp(name, "lcd0")) return &sim_lcd_spi.parent;
+    if (!strcmp(name, "pwm5")) return &sim_pwm.parent;
+    return RT_NULL;
+}
+
+/* 控制台即标准输出，不接收输入 */
+rt_device_t rt_console_get_device(void)
+{
+    return RT_NULL;
+}
+
+rt_ssize_t rt_device_read(rt_device_t dev, rt_off_t pos, void *buffer, rt_size_t size)
+{
+    return 0;
+}
+
+/**
+ * @brief  输出 SPI 流量与输入到显示延迟的统计
+ */
+void sim_board_report(void)
+{
+    sim_lat_report();
+    rt_kprintf("[sim] spi: %llu bytes, %u transfers, %u dma, %u RAMWR, %llu pixels\n",
+               (unsigned long long)sim_spi_stats.bytes, sim_spi_stats.xfers, sim_spi_stats.dma,
+               sim_spi_stats.ramwr, (unsigned long long)sim_spi_stats.pixels);
+    if (sim_lat_num)
+    {
+        rt_kprintf("[sim] key to display: %u keys, avg %.3f ms, max %.3f ms, %u without update\n",
+                   sim_lat_num, sim_lat_sum / 1e6 / sim_lat_num, sim_lat_max / 1e6, sim_lat_idle);
+    }
+}
@@ -0,0 +1,968 @@
+/**
+ * @file    sim_kernel.c
+ * @brief   主机仿真用的 RT-Thread 内核替身
+ * @details 实现应用与驱动用到的线程、定时器、信号量、事件、互斥量、消息队列接口：
+ *          - 每个 RT-Thread 线程对应一个 pthread，但同一时刻只有一个在运行(持有 sim_lock)，
+ *            按 RT-Thread 的优先级规则选择下一个线程，唤醒更高优先级线程时立即抢占
+ *          - 时间是离散事件时钟：线程运行不消耗时间，只有在所有线程都阻塞时才前进到
+ *            下一个定时器或等待超时的时刻；SPI 传输等外设操作通过 sim_busy() 计入耗时
+ *          - 定时器回调在时钟前进时以中断上下文调用，硬定时器和软定时器都在此处理
+ *          - 支持调度、中断进出与 IPC 对象的内核钩子，跟踪记录器(trace.c)可以直接使用
+ *          调度只由仿真时钟决定，同一脚本每次运行的结果完全相同
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <rthw.h>
+#include <rtdevice.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+typedef enum
+{
+    SIM_INIT,
+    SIM_READY,
+    SIM_RUNNING,
+    SIM_BLOCKED,
+    SIM_DONE,
+} sim_state_t;
+
+/* 线程阻塞的原因 */
+enum
+{
+    SIM_WAIT_NONE,
+    SIM_WAIT_SLEEP,
+    SIM_WAIT_SEM,
+    SIM_WAIT_EVENT,
+    SIM_WAIT_MUTEX,
+    SIM_WAIT_MQ,
+    SIM_WAIT_MQ_SEND,
+};
+
+typedef struct
+{
+    struct rt_thread tcb;               /* 必须是第一个成员，rt_thread_t 可以直接转换 */
+    pthread_t pthread;
+    pthread_cond_t cond;
+    void (*entry)(void *parameter);
+    void *parameter;
+    rt_uint8_t prio;
+    sim_state_t state;
+    rt_uint32_t seq;                    /* 进入就绪的顺序，同优先级先进先出 */
+    int wait;                           /* SIM_WAIT_xxx */
+    void *obj;                          /* 等待的对象 */
+    rt_uint64_t deadline;               /* 等待超时时刻 */
+    rt_err_t result;                    /* 唤醒原因 */
+    rt_uint32_t evt_set;                /* 事件：等待的位 */
+    rt_uint8_t evt_opt;                 /* 事件：RT_EVENT_FLAG_xxx */
+    rt_uint32_t evt_recved;             /* 事件：收到的位 */
+    void *mq_buf;                       /* 消息队列：接收缓冲 */
+    rt_size_t mq_size;                  /* 消息队列：缓冲大小，唤醒后为消息长度 */
+} sim_thread_t;
+
+/* 消息队列，消息前保存长度 */
+typedef struct
+{
+    struct rt_messagequeue mq;
+    rt_uint8_t *pool;
+    rt_uint16_t head;
+} sim_mq_t;
+
+#define SIM_MQ_SLOT(q)      (sizeof(rt_size_t) + (q)->mq.msg_size)
+
+static pthread_mutex_t sim_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sim_host_cond = PTHREAD_COND_INITIALIZER;
+static sim_thread_t *sim_threads[SIM_THREAD_MAX];
+static int sim_thread_num;
+static sim_thread_t *sim_cur;
+static rt_timer_t sim_timers[SIM_TIMER_MAX];
+static int sim_timer_num;
+
+static rt_uint64_t sim_ns;              /* 仿真时钟 */
+static rt_uint32_t sim_seq_tail = 0x80000000UL;   /* 就绪队列尾部序号 */
+static rt_uint32_t sim_seq_head = 0x7FFFFFFFUL;   /* 被抢占的线程回到队列头部 */
+static int sim_irq_nest;                /* 关中断或中断上下文嵌套 */
+static int sim_isr_nest;                /* 中断上下文嵌套，rt_interrupt_get_nest() 的返回值 */
+static int sim_critical;                /* 调度器上锁嵌套 */
+
+/* 内核钩子 */
+static void (*sim_scheduler_hook)(struct rt_thread *from, struct rt_thread *to);
+static void (*sim_irq_enter_hook)(void);
+static void (*sim_irq_leave_hook)(void);
+static void (*sim_trytake_hook)(struct rt_object *object);
+static void (*sim_take_hook)(struct rt_object *object);
+static void (*sim_put_hook)(struct rt_object *object);
+static void (*sim_idle_hook[RT_IDLE_HOOK_LIST_SIZE])(void);
+
+/* 空闲线程只有控制块：没有就绪线程时切换到它并调用空闲钩子，然后时钟前进 */
+static struct rt_thread sim_idle_tcb;
+
+#define SIM_HOOK(hook, args)    do { if (hook) hook args; } while (0)
+
+/* ===================== 调度 ===================== */
+
+rt_uint64_t sim_now(void)
+{
+    return sim_ns;
+}
+
+static rt_uint64_t sim_tick_ns(rt_tick_t tick)
+{
+    return (rt_uint64_t)tick * SIM_NS_PER_TICK;
+}
+
+/* 优先级最高的就绪线程 */
+static sim_thread_t *sim_pick(void)
+{
+    sim_thread_t *best = RT_NULL;
+    int i;
+
+    for (i = 0; i < sim_thread_num; i++)
+    {
+        sim_thread_t *t = sim_threads[i];
+
+        if (t->state != SIM_READY) continue;
+        if (best == RT_NULL || t->prio < best->prio || (t->prio == best->prio && t->seq < best->seq)) best = t;
+    }
+    return best;
+}
+
+/* 等待某个对象的线程中优先级最高的一个 */
+static sim_thread_t *sim_waiter(int wait, void *obj)
+{
+    sim_thread_t *best = RT_NULL;
+    int i;
+
+    for (i = 0; i < sim_thread_num; i++)
+    {
+        sim_thread_t *t = sim_threads[i];
+
+        if (t->state != SIM_BLOCKED || t->wait != wait || t->obj != obj) continue;
+        if (best == RT_NULL || t->prio < best->prio || (t->prio == best->prio && t->seq < best->seq)) best = t;
+    }
+    return best;
+}
+
+static void sim_ready(sim_thread_t *t, rt_bool_t head)
+{
+    t->state = SIM_READY;
+    t->seq = head ? sim_seq_head-- : sim_seq_tail++;
+}
+
+static void sim_wake(sim_thread_t *t, rt_err_t result)
+{
+    t->wait = SIM_WAIT_NONE;
+    t->obj = RT_NULL;
+    t->result = result;
+    sim_ready(t, RT_FALSE);
+}
+
+/* 下一个定时器或等待超时的时刻 */
+static rt_uint64_t sim_next_event(void)
+{
+    rt_uint64_t t = SIM_NS_FOREVER, d;
+    int i;
+
+    for (i = 0; i < sim_timer_num; i++)
+    {
+        d = sim_tick_ns(sim_timers[i]->timeout_tick);
+        if (d < t) t = d;
+    }
+    for (i = 0; i < sim_thread_num; i++)
+    {
+        if (sim_threads[i]->state == SIM_BLOCKED && sim_threads[i]->deadline < t) t = sim_threads[i]->deadline;
+    }
+    return t;
+}
+
+static void sim_timer_remove(rt_timer_t timer)
+{
+    int i;
+
+    for (i = 0; i < sim_timer_num; i++)
+    {
+        if (sim_timers[i] == timer)
+        {
+            sim_timers[i] = sim_timers[--sim_timer_num];
+            break;
+        }
+    }
+    timer->parent.flag &= ~RT_TIMER_FLAG_ACTIVATED;
+}
+
+/* 处理已到期的定时器与等待超时，在中断上下文中调用定时器回调 */
+static void sim_expire(void)
+{
+    rt_tick_t now = rt_tick_get();
+    rt_timer_t due;
+    int i;
+
+    sim_irq_nest++;
+    sim_isr_nest++;
+    SIM_HOOK(sim_irq_enter_hook, ());
+    do
+    {
+        /* 每次取最早到期的一个，回调中可能启动或停止其它定时器 */
+        due = RT_NULL;
+        for (i = 0; i < sim_timer_num; i++)
+        {
+            if (sim_timers[i]->timeout_tick <= now &&
+                (due == RT_NULL || sim_timers[i]->timeout_tick < due->timeout_tick)) due = sim_timers[i];
+        }
+        if (due != RT_NULL)
+        {
+            if (due->parent.flag & RT_TIMER_FLAG_PERIODIC)
+                due->timeout_tick = now + (due->init_tick ? due->init_tick : 1);
+            else
+                sim_timer_remove(due);
+            due->timeout_func(due->parameter);
+        }
+    } while (due != RT_NULL);
+
+    for (i = 0; i < sim_thread_num; i++)
+    {
+        sim_thread_t *t = sim_threads[i];
+
+        if (t->state == SIM_BLOCKED && t->deadline <= sim_ns) sim_wake(t, -RT_ETIMEOUT);
+    }
+    SIM_HOOK(sim_irq_leave_hook, ());
+    sim_isr_nest--;
+    sim_irq_nest--;
+}
+
+/* 时钟前进到下一个事件，但不超过 limit；返回是否处理了事件 */
+static rt_bool_t sim_advance(rt_uint64_t limit)
+{
+    rt_uint64_t t = sim_next_event();
+
+    if (t > limit)
+    {
+        if (limit != SIM_NS_FOREVER) sim_ns = limit;
+        return RT_FALSE;
+    }
+    if (t > sim_ns) sim_ns = t;
+    sim_expire();
+    return RT_TRUE;
+}
+
+/* 与内核一致，调度钩子在关中断状态下调用 */
+static void sim_switch_hook(struct rt_thread *from, struct rt_thread *to)
+{
+    sim_irq_nest++;
+    SIM_HOOK(sim_scheduler_hook, (from, to));
+    sim_irq_nest--;
+}
+
+static void sim_idle(void)
+{
+    int i;
+
+    for (i = 0; i < RT_IDLE_HOOK_LIST_SIZE; i++) SIM_HOOK(sim_idle_hook[i], ());
+}
+
+/* 当前线程已经不再运行(就绪、阻塞或结束)，切换到下一个线程 */
+static void sim_schedule(void)
+{
+    sim_thread_t *self = sim_cur, *next;
+    struct rt_thread *from = self ? &self->tcb : RT_NULL;
+
+    while ((next = sim_pick()) == RT_NULL)
+    {
+        if (from != &sim_idle_tcb)
+        {
+            sim_switch_hook(from, &sim_idle_tcb);
+            from = &sim_idle_tcb;
+        }
+        sim_idle();
+        if (!sim_advance(SIM_NS_FOREVER))
+        {
+            rt_kprintf("sim: all threads blocked forever at %llu ms\n", (unsigned long long)(sim_ns / 1000000));
+            sim_exit(2);
+        }
+    }
+
+    sim_cur = next;
+    next->state = SIM_RUNNING;
+    if (from != &next->tcb) sim_switch_hook(from, &next->tcb);
+    if (next == self) return;
+    pthread_cond_signal(&next->cond);
+    if (self == RT_NULL || self->state == SIM_DONE) return;
+    while (sim_cur != self) pthread_cond_wait(&self->cond, &sim_lock);
+}
+
+/* 有更高优先级的线程就绪时让出 CPU，关中断和调度器上锁期间推迟到解除时 */
+static rt_bool_t sim_preempt(void)
+{
+    sim_thread_t *next;
+
+    if (sim_cur == RT_NULL || sim_irq_nest || sim_critical) return RT_FALSE;
+    next = sim_pick();
+    if (next == RT_NULL || next->prio >= sim_cur->prio) return RT_FALSE;
+    sim_ready(sim_cur, RT_TRUE);
+    sim_schedule();
+    return RT_TRUE;
+}
+
+/* 当前线程阻塞，timeout 为节拍数，超时时刻对齐到节拍 */
+static rt_err_t sim_block(int wait, void *obj, rt_int32_t timeout)
+{
+    sim_thread_t *self = sim_cur;
+
+    self->state = SIM_BLOCKED;
+    self->wait = wait;
+    self->obj = obj;
+    self->deadline = timeout < 0 ? SIM_NS_FOREVER : sim_tick_ns(rt_tick_get() + (rt_tick_t)timeout);
+    sim_schedule();
+    return self->result;
+}
+
+/**
+ * @brief  模拟耗时操作，时钟前进 ns 纳秒
+ * @note   期间到期的定时器照常处理，更高优先级线程就绪时抢占，被抢占的时间不计入
+ */
+void sim_busy(rt_uint64_t ns)
+{
+    rt_uint64_t end = sim_ns + ns, left;
+
+    while (sim_ns < end)
+    {
+        if (!sim_advance(end)) break;
+        left = end - sim_ns;
+        if (sim_preempt()) end = sim_ns + left;
+    }
+}
+
+/* 阻塞到指定时刻，期间其它线程可以运行 */
+void sim_sleep_until(rt_uint64_t ns)
+{
+    if (ns <= sim_ns) return;
+    sim_cur->state = SIM_BLOCKED;
+    sim_cur->wait = SIM_WAIT_SLEEP;
+    sim_cur->obj = RT_NULL;
+    sim_cur->deadline = ns;
+    sim_schedule();
+}
+
+void sim_isr_enter(void)
+{
+    sim_irq_nest++;
+    sim_isr_nest++;
+    SIM_HOOK(sim_irq_enter_hook, ());
+}
+
+void sim_isr_leave(void)
+{
+    SIM_HOOK(sim_irq_leave_hook, ());
+    sim_isr_nest--;
+    sim_irq_nest--;
+    sim_preempt();
+}
+
+static void *sim_thread_main(void *arg)
+{
+    sim_thread_t *t = (sim_thread_t *)arg;
+
+    pthread_mutex_lock(&sim_lock);
+    while (sim_cur != t) pthread_cond_wait(&t->cond, &sim_lock);
+    t->entry(t->parameter);
+    t->state = SIM_DONE;
+    sim_schedule();
+    pthread_mutex_unlock(&sim_lock);
+    return RT_NULL;
+}
+
+static void sim_name(struct rt_object *obj, const char *name)
+{
+    strncpy(obj->name, name ? name : "", RT_NAME_MAX - 1);
+}
+
+extern int app_main(void);
+
+static void sim_main_entry(void *parameter)
+{
+    app_main();
+}
+
+/**
+ * @brief  启动仿真：创建 main 线程与按键脚本线程，本函数不返回
+ * @param  entry: 脚本线程入口，以最高优先级运行，结束时调用 sim_exit()
+ */
+void sim_start(void (*entry)(void *parameter), void *parameter)
+{
+    pthread_mutex_lock(&sim_lock);
+    sim_name(&sim_idle_tcb.parent, "tidle0");
+    rt_thread_startup(rt_thread_create("main", sim_main_entry, RT_NULL, 0, SIM_MAIN_PRIO, 0));
+    rt_thread_startup(rt_thread_create("stim", entry, parameter, 0, SIM_STIM_PRIO, 0));
+    sim_schedule();
+    for (;;) pthread_cond_wait(&sim_host_cond, &sim_lock);
+}
+
+void sim_exit(int code)
+{
+    fflush(RT_NULL);
+    exit(code);
+}
+
+/* ===================== 线程 ===================== */
+
+rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter,
+                             rt_uint32_t stack_size, rt_uint8_t priority, rt_uint32_t tick)
+{
+    sim_thread_t *t;
+
+    if (sim_thread_num >= SIM_THREAD_MAX) return RT_NULL;
+    t = (sim_thread_t *)calloc(1, sizeof(*t));
+    if (t == RT_NULL) return RT_NULL;
+    sim_name(&t->tcb.parent, name);
+    pthread_cond_init(&t->cond, RT_NULL);
+    t->entry = entry;
+    t->parameter = parameter;
+    t->prio = priority;
+    t->state = SIM_INIT;
+    t->deadline = SIM_NS_FOREVER;
+    sim_threads[sim_thread_num++] = t;
+    return &t->tcb;
+}
+
+rt_err_t rt_thread_startup(rt_thread_t thread)
+{
+    sim_thread_t *t = (sim_thread_t *)thread;
+
+    if (t->state != SIM_INIT) return -RT_ERROR;
+    sim_ready(t, RT_FALSE);
+    if (pthread_create(&t->pthread, RT_NULL, sim_thread_main, t) != 0)
+    {
+        t->state = SIM_DONE;
+        return -RT_ERROR;
+    }
+    sim_preempt();
+    return RT_EOK;
+}
+
+rt_thread_t rt_thread_self(void)
+{
+    return sim_cur ? &sim_cur->tcb : RT_NULL;
+}
+
+rt_err_t rt_thread_yield(void)
+{
+    sim_ready(sim_cur, RT_FALSE);
+    sim_schedule();
+    return RT_EOK;
+}
+
+rt_err_t rt_thread_delay(rt_tick_t tick)
+{
+    if (tick == 0) return rt_thread_yield();
+    sim_block(SIM_WAIT_SLEEP, RT_NULL, (rt_int32_t)tick);
+    return RT_EOK;
+}
+
+rt_err_t rt_thread_mdelay(rt_int32_t ms)
+{
+    return rt_thread_delay(rt_tick_from_millisecond(ms));
+}
+
+/* ===================== 时钟与中断 ===================== */
+
+rt_tick_t rt_tick_get(void)
+{
+    return (rt_tick_t)(sim_ns / SIM_NS_PER_TICK);
+}
+
+rt_tick_t rt_tick_from_millisecond(rt_int32_t ms)
+{
+    if (ms < 0) return (rt_tick_t)RT_WAITING_FOREVER;
+    return (rt_tick_t)(((rt_uint64_t)ms * RT_TICK_PER_SECOND + 999) / 1000);
+}
+
+rt_base_t rt_hw_interrupt_disable(void)
+{
+    return sim_irq_nest++;
+}
+
+void rt_hw_interrupt_enable(rt_base_t level)
+{
+    sim_irq_nest = (int)level;
+    if (sim_irq_nest == 0) sim_preempt();
+}
+
+rt_uint8_t rt_interrupt_get_nest(void)
+{
+    return (rt_uint8_t)sim_isr_nest;
+}
+
+rt_base_t rt_enter_critical(void)
+{
+    return ++sim_critical;
+}
+
+void rt_exit_critical(void)
+{
+    if (--sim_critical == 0) sim_preempt();
+}
+
+void rt_hw_us_delay(rt_uint32_t us)
+{
+    sim_busy((rt_uint64_t)us * 1000);
+}
+
+/* cputime：以仿真时钟的纳秒为计数单位 */
+uint64_t clock_cpu_gettime(void)
+{
+    return sim_ns;
+}
+
+uint64_t clock_cpu_getres(void)
+{
+    return 1000UL * 1000;
+}
+
+uint64_t clock_cpu_microsecond(uint64_t cpu_tick)
+{
+    return cpu_tick / 1000;
+}
+
+/* ===================== 定时器 ===================== */
+
+void rt_timer_init(rt_timer_t timer, const char *name, void (*timeout)(void *parameter),
+                   void *parameter, rt_tick_t time, rt_uint8_t flag)
+{
+    memset(timer, 0, sizeof(*timer));
+    sim_name(&timer->parent, name);
+    timer->timeout_func = timeout;
+    timer->parameter = parameter;
+    timer->init_tick = time;
+    timer->parent.flag = flag & ~RT_TIMER_FLAG_ACTIVATED;
+}
+
+rt_timer_t rt_timer_create(const char *name, void (*timeout)(void *parameter),
+                           void *parameter, rt_tick_t time, rt_uint8_t flag)
+{
+    rt_timer_t timer = (rt_timer_t)malloc(sizeof(struct rt_timer));
+
+    if (timer != RT_NULL) rt_timer_init(timer, name, timeout, parameter, time, flag);
+    return timer;
+}
+
+rt_err_t rt_timer_start(rt_timer_t timer)
+{
+    if (timer->parent.flag & RT_TIMER_FLAG_ACTIVATED) sim_timer_remove(timer);
+    if (sim_timer_num >= SIM_TIMER_MAX) return -RT_EFULL;
+    timer->timeout_tick = rt_tick_get() + timer->init_tick;
+    timer->parent.flag |= RT_TIMER_FLAG_ACTIVATED;
+    sim_timers[sim_timer_num++] = timer;
+    return RT_EOK;
+}
+
+rt_err_t rt_timer_stop(rt_timer_t timer)
+{
+    if (!(timer->parent.flag & RT_TIMER_FLAG_ACTIVATED)) return -RT_ERROR;
+    sim_timer_remove(timer);
+    return RT_EOK;
+}
+
+rt_err_t rt_timer_delete(rt_timer_t timer)
+{
+    if (timer->parent.flag & RT_TIMER_FLAG_ACTIVATED) sim_timer_remove(timer);
+    free(timer);
+    return RT_EOK;
+}
+
+rt_err_t rt_timer_control(rt_timer_t timer, int cmd, void *arg)
+{
+    switch (cmd)
+    {
+    case RT_TIMER_CTRL_SET_TIME:
+        timer->init_tick = *(rt_tick_t *)arg;
+        break;
+    case RT_TIMER_CTRL_GET_TIME:
+        *(rt_tick_t *)arg = timer->init_tick;
+        break;
+    case RT_TIMER_CTRL_SET_ONESHOT:
+        timer->parent.flag &= ~RT_TIMER_FLAG_PERIODIC;
+        break;
+    case RT_TIMER_CTRL_SET_PERIODIC:
+        timer->parent.flag |= RT_TIMER_FLAG_PERIODIC;
+        break;
+    case RT_TIMER_CTRL_GET_STATE:
+        *(rt_uint32_t *)arg = (timer->parent.flag & RT_TIMER_FLAG_ACTIVATED) ?
+                              RT_TIMER_FLAG_ACTIVATED : RT_TIMER_FLAG_DEACTIVATED;
+        break;
+    default:
+        return -RT_ERROR;
+    }
+    return RT_EOK;
+}
+
+/* ===================== 信号量 ===================== */
+
+rt_err_t rt_sem_init(rt_sem_t sem, const char *name, rt_uint32_t value, rt_uint8_t flag)
+{
+    memset(sem, 0, sizeof(*sem));
+    sim_name(&sem->parent.parent, name);
+    sem->value = (rt_uint16_t)value;
+    sem->max_value = 0xFFFF;
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout)
+{
+    rt_err_t ret = RT_EOK;
+
+    SIM_HOOK(sim_trytake_hook, (&sem->parent.parent));
+    if (sem->value > 0)
+        sem->value--;
+    else if (timeout == 0)
+        return -RT_ETIMEOUT;
+    else
+        ret = sim_block(SIM_WAIT_SEM, sem, timeout);
+    if (ret == RT_EOK) SIM_HOOK(sim_take_hook, (&sem->parent.parent));
+    return ret;
+}
+
+rt_err_t rt_sem_release(rt_sem_t sem)
+{
+    sim_thread_t *t = sim_waiter(SIM_WAIT_SEM, sem);
+
+    SIM_HOOK(sim_put_hook, (&sem->parent.parent));
+    if (t != RT_NULL)
+        sim_wake(t, RT_EOK);
+    else if (sem->value < sem->max_value)
+        sem->value++;
+    else
+        return -RT_EFULL;
+    sim_preempt();
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_control(rt_sem_t sem, int cmd, void *arg)
+{
+    sim_thread_t *t;
+
+    if (cmd != RT_IPC_CMD_RESET) return -RT_ERROR;
+    while ((t = sim_waiter(SIM_WAIT_SEM, sem)) != RT_NULL) sim_wake(t, -RT_ERROR);
+    sem->value = (rt_uint16_t)(rt_ubase_t)arg;
+    sim_preempt();
+    return RT_EOK;
+}
+
+/* ===================== 事件 ===================== */
+
+static rt_bool_t sim_event_match(rt_uint32_t set, rt_uint32_t want, rt_uint8_t opt)
+{
+    if (opt & RT_EVENT_FLAG_AND) return (set & want) == want;
+    return (set & want) != 0;
+}
+
+rt_err_t rt_event_init(rt_event_t event, const char *name, rt_uint8_t flag)
+{
+    memset(event, 0, sizeof(*event));
+    sim_name(&event->parent.parent, name);
+    return RT_EOK;
+}
+
+rt_err_t rt_event_recv(rt_event_t event, rt_uint32_t set, rt_uint8_t option,
+                       rt_int32_t timeout, rt_uint32_t *recved)
+{
+    sim_thread_t *self = sim_cur;
+    rt_err_t ret;
+
+    SIM_HOOK(sim_trytake_hook, (&event->parent.parent));
+    if (sim_event_match(event->set, set, option))
+    {
+        if (recved) *recved = event->set & set;
+        if (option & RT_EVENT_FLAG_CLEAR) event->set &= ~set;
+        SIM_HOOK(sim_take_hook, (&event->parent.parent));
+        return RT_EOK;
+    }
+    if (timeout == 0) return -RT_ETIMEOUT;
+    self->evt_set = set;
+    self->evt_opt = option;
+    ret = sim_block(SIM_WAIT_EVENT, event, timeout);
+    if (ret == RT_EOK && recved) *recved = self->evt_recved;
+    if (ret == RT_EOK) SIM_HOOK(sim_take_hook, (&event->parent.parent));
+    return ret;
+}
+
+rt_err_t rt_event_send(rt_event_t event, rt_uint32_t set)
+{
+    int i;
+
+    SIM_HOOK(sim_put_hook, (&event->parent.parent));
+    event->set |= set;
+    for (i = 0; i < sim_thread_num; i++)
+    {
+        sim_thread_t *t = sim_threads[i];
+
+        if (t->state != SIM_BLOCKED || t->wait != SIM_WAIT_EVENT || t->obj != event) continue;
+        if (!sim_event_match(event->set, t->evt_set, t->evt_opt)) continue;
+        t->evt_recved = event->set & t->evt_set;
+        if (t->evt_opt & RT_EVENT_FLAG_CLEAR) event->set &= ~t->evt_set;
+        sim_wake(t, RT_EOK);
+    }
+    sim_preempt();
+    return RT_EOK;
+}
+
+rt_err_t rt_event_control(rt_event_t event, int cmd, void *arg)
+{
+    sim_thread_t *t;
+
+    if (cmd != RT_IPC_CMD_RESET) return -RT_ERROR;
+    while ((t = sim_waiter(SIM_WAIT_EVENT, event)) != RT_NULL) sim_wake(t, -RT_ERROR);
+    event->set = 0;
+    sim_preempt();
+    return RT_EOK;
+}
+
+/* ===================== 互斥量 ===================== */
+
+rt_err_t rt_mutex_init(rt_mutex_t mutex, const char *name, rt_uint8_t flag)
+{
+    memset(mutex, 0, sizeof(*mutex));
+    sim_name(&mutex->parent.parent, name);
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout)
+{
+    rt_err_t ret = RT_EOK;
+
+    SIM_HOOK(sim_trytake_hook, (&mutex->parent.parent));
+    if (mutex->owner == RT_NULL)
+    {
+        mutex->owner = &sim_cur->tcb;
+        mutex->hold = 1;
+    }
+    else if (mutex->owner == &sim_cur->tcb)
+    {
+        mutex->hold++;
+    }
+    else if (timeout == 0)
+    {
+        return -RT_ETIMEOUT;
+    }
+    else
+    {
+        ret = sim_block(SIM_WAIT_MUTEX, mutex, timeout);
+    }
+    if (ret == RT_EOK) SIM_HOOK(sim_take_hook, (&mutex->parent.parent));
+    return ret;
+}
+
+rt_err_t rt_mutex_release(rt_mutex_t mutex)
+{
+    sim_thread_t *t;
+
+    if (mutex->owner != &sim_cur->tcb) return -RT_ERROR;
+    SIM_HOOK(sim_put_hook, (&mutex->parent.parent));
+    if (--mutex->hold > 0) return RT_EOK;
+
+    /* 直接交给等待中优先级最高的线程 */
+    t = sim_waiter(SIM_WAIT_MUTEX, mutex);
+    mutex->owner = t ? &t->tcb : RT_NULL;
+    if (t != RT_NULL)
+    {
+        mutex->hold = 1;
+        sim_wake(t, RT_EOK);
+        sim_preempt();
+    }
+    return RT_EOK;
+}
+
+/* ===================== 消息队列 ===================== */
+
+rt_mq_t rt_mq_create(const char *name, rt_size_t msg_size, rt_size_t max_msgs, rt_uint8_t flag)
+{
+    sim_mq_t *q = (sim_mq_t *)calloc(1, sizeof(*q));
+
+    if (q == RT_NULL) return RT_NULL;
+    sim_name(&q->mq.parent.parent, name);
+    q->mq.msg_size = (rt_uint16_t)msg_size;
+    q->mq.max_msgs = (rt_uint16_t)max_msgs;
+    q->pool = (rt_uint8_t *)calloc(max_msgs, SIM_MQ_SLOT(q));
+    if (q->pool == RT_NULL)
+    {
+        free(q);
+        return RT_NULL;
+    }
+    return &q->mq;
+}
+
+rt_err_t rt_mq_send(rt_mq_t mq, const void *buffer, rt_size_t size)
+{
+    sim_mq_t *q = (sim_mq_t *)mq;
+    sim_thread_t *t;
+    rt_uint8_t *slot;
+
+    if (size > mq->msg_size) return -RT_ERROR;
+    SIM_HOOK(sim_put_hook, (&mq->parent.parent));
+
+    /* 有线程在等待时直接交给它 */
+    t = sim_waiter(SIM_WAIT_MQ, mq);
+    if (t != RT_NULL)
+    {
+        memcpy(t->mq_buf, buffer, size < t->mq_size ? size : t->mq_size);
+        t->mq_size = size;
+        sim_wake(t, RT_EOK);
+        sim_preempt();
+        return RT_EOK;
+    }
+
+    if (mq->entry >= mq->max_msgs) return -RT_EFULL;
+    slot = q->pool + ((q->head + mq->entry) % mq->max_msgs) * SIM_MQ_SLOT(q);
+    memcpy(slot, &size, sizeof(size));
+    memcpy(slot + sizeof(size), buffer, size);
+    mq->entry++;
+    return RT_EOK;
+}
+
+/*
+ * 队列满时阻塞到有空位。仿真中软定时器回调也在中断上下文中执行，不能阻塞，
+ * 此时与 rt_mq_send 相同；每次被唤醒后重新按原超时时间等待
+ */
+rt_err_t rt_mq_send_wait(rt_mq_t mq, const void *buffer, rt_size_t size, rt_int32_t timeout)
+{
+    rt_err_t ret;
+
+    while ((ret = rt_mq_send(mq, buffer, size)) == -RT_EFULL)
+    {
+        if (timeout == 0 || sim_irq_nest) break;
+        ret = sim_block(SIM_WAIT_MQ_SEND, mq, timeout);
+        if (ret != RT_EOK) break;
+    }
+    return ret;
+}
+
+rt_ssize_t rt_mq_recv(rt_mq_t mq, void *buffer, rt_size_t size, rt_int32_t timeout)
+{
+    sim_mq_t *q = (sim_mq_t *)mq;
+    sim_thread_t *self = sim_cur, *t;
+    rt_uint8_t *slot;
+    rt_size_t len;
+    rt_err_t ret;
+
+    SIM_HOOK(sim_trytake_hook, (&mq->parent.parent));
+    if (mq->entry > 0)
+    {
+        slot = q->pool + q->head * SIM_MQ_SLOT(q);
+        memcpy(&len, slot, sizeof(len));
+        memcpy(buffer, slot + sizeof(len), len < size ? len : size);
+        q->head = (rt_uint16_t)((q->head + 1) % mq->max_msgs);
+        mq->entry--;
+        SIM_HOOK(sim_take_hook, (&mq->parent.parent));
+
+        /* 空出位置，唤醒一个等待发送的线程 */
+        t = sim_waiter(SIM_WAIT_MQ_SEND, mq);
+        if (t != RT_NULL)
+        {
+            sim_wake(t, RT_EOK);
+            sim_preempt();
+        }
+        return (rt_ssize_t)len;
+    }
+    if (timeout == 0) return -RT_ETIMEOUT;
+    self->mq_buf = buffer;
+    self->mq_size = size;
+    ret = sim_block(SIM_WAIT_MQ, mq, timeout);
+    if (ret != RT_EOK) return ret;
+    SIM_HOOK(sim_take_hook, (&mq->parent.parent));
+    return (rt_ssize_t)self->mq_size;
+}
+
+rt_err_t rt_mq_control(rt_mq_t mq, int cmd, void *arg)
+{
+    if (cmd != RT_IPC_CMD_RESET) return -RT_ERROR;
+    ((sim_mq_t *)mq)->head = 0;
+    mq->entry = 0;
+    return RT_EOK;
+}
+
+/* ===================== 内核钩子 ===================== */
+
+void rt_scheduler_sethook(void (*hook)(struct rt_thread *from, struct rt_thread *to))
+{
+    sim_scheduler_hook = hook;
+}
+
+void rt_interrupt_enter_sethook(void (*hook)(void))
+{
+    sim_irq_enter_hook = hook;
+}
+
+void rt_interrupt_leave_sethook(void (*hook)(void))
+{
+    sim_irq_leave_hook = hook;
+}
+
+void rt_object_trytake_sethook(void (*hook)(struct rt_object *object))
+{
+    sim_trytake_hook = hook;
+}
+
+void rt_object_take_sethook(void (*hook)(struct rt_object *object))
+{
+    sim_take_hook = hook;
+}
+
+void rt_object_put_sethook(void (*hook)(struct rt_object *object))
+{
+    sim_put_hook = hook;
+}
+
+rt_err_t rt_thread_idle_sethook(void (*hook)(void))
+{
+    int i;
+
+    for (i = 0; i < RT_IDLE_HOOK_LIST_SIZE; i++)
+    {
+        if (sim_idle_hook[i] == RT_NULL)
+        {
+            sim_idle_hook[i] = hook;
+            return RT_EOK;
+        }
+    }
+    return -RT_EFULL;
+}
+
+rt_thread_t rt_thread_idle_gethandler(void)
+{
+    return &sim_idle_tcb;
+}
+
+/* 仿真线程不会被删除 */
+void rt_object_detach_sethook(void (*hook)(struct rt_object *object))
+{
+}
+
+/* 没有内核对象表，线程在第一次切入时由使用者登记 */
+struct rt_object_information *rt_object_get_information(enum rt_object_class_type type)
+{
+    return RT_NULL;
+}
+
+/* ===================== 内核服务 ===================== */
+
+int rt_kprintf(const char *fmt, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, fmt);
+    n = vprintf(fmt, args);
+    va_end(args);
+    return n;
+}
+
+void *rt_memcpy(void *dst, const void *src, rt_ubase_t count)
+{
+    return memcpy(dst, src, count);
+}
+
+void *rt_memset(void *s, int c, rt_ubase_t count)
+{
+    return memset(s, c, count);
+}
@@ -0,0 +1,209 @@
+/**
+ * @file    sim_main.c
+ * @brief   主机仿真入口与按键脚本
+ * @details 用法：smartlock_sim [-k 脚本] [-o 屏幕.ppm] [-s 舵机.csv] [-t 毫秒] [-v]
+ *          - 没有脚本时运行 -t 指定的时间(默认 3000ms)后退出
+ *          - 退出时输出 SPI 流量与按键到显示的延迟统计，并按 -o 导出屏幕
+ *          - 舵机记录每行为 "时间(us),通道,脉宽(ns),周期(ns)"
+ *
+ * 脚本每行一条命令，# 开头为注释，时间单位为毫秒：
+ *   wait <ms>                      等待
+ *   key <按键串> [按住] [间隔]     依次按下并释放，0-9 为数字键，C 为清除键，E 为确认键，
+ *                                  默认按住 80ms、间隔 120ms
+ *   press <键值> / release <键值>  按下/释放键值 1-16 的按键(按住不放时测试长按)
+ *   dump <文件>                    导出当前屏幕为 PPM
+ *   msh <命令> [参数...]           执行 MSH_CMD_EXPORT 导出的命令，如 lcd_bench、boot_time
+ *   echo <文字>                    输出带时间的文字
+ *   quit                           结束仿真
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <finsh.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_LINE_MAX        256
+#define SIM_ARGS_MAX        8
+
+int sim_verbose = 0;
+
+static FILE *sim_script = RT_NULL;
+static const char *sim_ppm = RT_NULL;
+static rt_uint32_t sim_run_ms = 3000;
+
+/* 键盘字符到键值：布局与 main.c 中的按键处理一致 */
+static rt_uint8_t sim_key_code(char c)
+{
+    static const rt_uint8_t digit[10] = {14, 1, 2, 3, 5, 6, 7, 9, 10, 11};
+
+    if (c >= '0' && c <= '9') return digit[c - '0'];
+    if (c == 'C' || c == 'c') return 13;
+    if (c == 'E' || c == 'e') return 15;
+    return 0;
+}
+
+/* FSymTab 段由 MSH_CMD_EXPORT 生成，链接器提供段的起止符号 */
+extern const struct finsh_syscall __start_FSymTab[] __attribute__((weak));
+extern const struct finsh_syscall __stop_FSymTab[] __attribute__((weak));
+
+static int sim_msh(int argc, char **argv)
+{
+    const struct finsh_syscall *cmd;
+
+    for (cmd = __start_FSymTab; cmd != RT_NULL && cmd < __stop_FSymTab; cmd++)
+    {
+        if (!strcmp(cmd->name, argv[0])) return ((int (*)(int, char **))cmd->func)(argc, argv);
+    }
+    rt_kprintf("[sim] msh: %s: command not found\n", argv[0]);
+    return -1;
+}
+
+static void sim_finish(int code)
+{
+    rt_kprintf("[sim] finished at %.3f ms\n", sim_now() / 1e6);
+    sim_board_report();
+    if (sim_ppm) sim_panel_dump(sim_ppm);
+    if (sim_servo_log) fclose(sim_servo_log);
+    sim_exit(code);
+}
+
+/* 执行一行脚本，返回 -1 表示脚本结束 */
+static int sim_command(int argc, char **argv, int line)
+{
+    rt_uint32_t hold = 80, gap = 120;
+    rt_uint8_t key;
+    const char *p;
+
+    if (!strcmp(argv[0], "wait") && argc >= 2)
+    {
+        rt_thread_mdelay(atoi(argv[1]));
+    }
+    else if (!strcmp(argv[0], "key") && argc >= 2)
+    {
+        if (argc >= 3) hold = atoi(argv[2]);
+        if (argc >= 4) gap = atoi(argv[3]);
+        for (p = argv[1]; *p; p++)
+        {
+            key = sim_key_code(*p);
+            if (key == 0)
+            {
+                rt_kprintf("[sim] line %d: unknown key '%c'\n", line, *p);
+                continue;
+            }
+            sim_key_set(key, RT_TRUE);
+            rt_thread_mdelay(hold);
+            sim_key_set(key, RT_FALSE);
+            rt_thread_mdelay(gap);
+        }
+    }
+    else if ((!strcmp(argv[0], "press") || !strcmp(argv[0], "release")) && argc >= 2)
+    {
+        sim_key_set((rt_uint8_t)atoi(argv[1]), argv[0][0] == 'p');
+    }
+    else if (!strcmp(argv[0], "dump") && argc >= 2)
+    {
+        sim_panel_dump(argv[1]);
+    }
+    else if (!strcmp(argv[0], "msh") && argc >= 2)
+    {
+        sim_msh(argc - 1, argv + 1);
+    }
+    else if (!strcmp(argv[0], "echo"))
+    {
+        rt_kprintf("[sim %10.3f ms]", sim_now() / 1e6);
+        for (key = 1; key < argc; key++) rt_kprintf(" %s", argv[key]);
+        rt_kprintf("\n");
+    }
+    else if (!strcmp(argv[0], "quit"))
+    {
+        return -1;
+    }
+    else
+    {
+        rt_kprintf("[sim] line %d: bad command '%s'\n", line, argv[0]);
+    }
+    return 0;
+}
+
+/* 脚本线程：优先级最高，相当于操作键盘的人 */
+static void sim_stim_entry(void *parameter)
+{
+    char buf[SIM_LINE_MAX];
+    char *argv[SIM_ARGS_MAX];
+    int argc, line = 0;
+    char *tok;
+
+    if (sim_script == RT_NULL)
+    {
+        rt_thread_mdelay(sim_run_ms);
+        sim_finish(0);
+    }
+
+    while (fgets(buf, sizeof(buf), sim_script) != RT_NULL)
+    {
+        line++;
+        argc = 0;
+        for (tok = strtok(buf, " \t\r\n"); tok && argc < SIM_ARGS_MAX; tok = strtok(RT_NULL, " \t\r\n"))
+        {
+            argv[argc++] = tok;
+        }
+        if (argc == 0 || argv[0][0] == '#') continue;
+        if (sim_verbose) rt_kprintf("[sim %10.3f ms] %s\n", sim_now() / 1e6, argv[0]);
+        if (sim_command(argc, argv, line) < 0) break;
+    }
+    sim_finish(0);
+}
+
+static void sim_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-k script] [-o screen.ppm] [-s servo.csv] [-t ms] [-v]\n", name);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-' || argv[i][1] == '\0') sim_usage(argv[0]);
+        if (argv[i][1] == 'v')
+        {
+            sim_verbose = 1;
+            continue;
+        }
+        if (i + 1 >= argc) sim_usage(argv[0]);
+        switch (argv[i][1])
+        {
+        case 'k':
+            sim_script = fopen(argv[++i], "r");
+            if (sim_script == RT_NULL)
+            {
+                perror(argv[i]);
+                return 1;
+            }
+            break;
+        case 'o':
+            sim_ppm = argv[++i];
+            break;
+        case 's':
+            sim_servo_log = fopen(argv[++i], "w");
+            if (sim_servo_log == RT_NULL)
+            {
+                perror(argv[i]);
+                return 1;
+            }
+            break;
+        case 't':
+            sim_run_ms = (rt_uint32_t)atoi(argv[++i]);
+            break;
+        default:
+            sim_usage(argv[0]);
+        }
+    }
+
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(sim_stim_entry, RT_NULL);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2025-12-20     Voyager       the first version
+ */
+#ifndef SIM_TEST_H_
+#define SIM_TEST_H_
+
+#include <stdio.h>
+
+/*
+ * 主机测试用的检查宏，每个 test_xxx.c 单独编译成一个程序(见 SConstruct 中的 scons test)。
+ * 检查失败时打印位置并继续执行，main 最后返回 TEST_RESULT() 作为进程退出码
+ */
+
+static int test_checks;                 /* 已执行的检查数 */
+static int test_fails;                  /* 失败的检查数 */
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        test_checks++;                                                          \
+        if (!(cond))                                                            \
+        {                                                                       \
+            test_fails++;                                                       \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+        }                                                                       \
+    } while (0)
+
+/* 整数比较，失败时同时打印两边的值 */
+#define CHECK_EQ(a, b)                                                          \
+    do {                                                                        \
+        long long test_a_ = (long long)(a), test_b_ = (long long)(b);           \
+        test_checks++;                                                          \
+        if (test_a_ != test_b_)                                                 \
+        {                                                                       \
+            test_fails++;                                                       \
+            printf("%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n",            \
+                   __FILE__, __LINE__, #a, #b, test_a_, test_b_);               \
+        }                                                                       \
+    } while (0)
+
+/* 字符串比较，用于对照操作记录 */
+#define CHECK_STR(a, b)                                                         \
+    do {                                                                        \
+        const char *test_a_ = (a), *test_b_ = (b);                              \
+        test_checks++;                                                          \
+        if (strcmp(test_a_, test_b_) != 0)                                      \
+        {                                                                       \
+            test_fails++;                                                       \
+            printf("%s:%d: CHECK_STR(%s) failed:\n  got    \"%s\"\n  expect \"%s\"\n", \
+                   __FILE__, __LINE__, #a, test_a_, test_b_);                   \
+        }                                                                       \
+    } while (0)
+
+/* 输出汇总，返回进程退出码 */
+#define TEST_RESULT(name)                                                       \
+    (printf("[%s] %d checks, %d failed\n", (name), test_checks, test_fails),    \
+     test_fails ? 1 : 0)
+
+#endif /* SIM_TEST_H_ */
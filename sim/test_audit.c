@@ -0,0 +1,270 @@
+/**
+ * @file    test_audit.c
+ * @brief   审计日志(Driver/audit.c)的主机测试
+ * @details 直接包含 audit.c，与 sim_kernel.c、FAL 和 fal_sim.c 中的主机 NOR Flash 一起运行在
+ *          仿真时钟上，使用 board/port/fal_cfg.h 中 1MB 的 "audit" 分区(256 个 4KB 扇区)：
+ *          - 写入：一连串 AUDIT_PAGE_RECS 条记录只产生一次页编程；不足一页的记录
+ *            在 AUDIT_FLUSH_MS 之前不写 Flash，之后提交一次
+ *          - 查询：按扇区时间索引只读取与时间范围有重叠的扇区
+ *          - 回绕：分区写满后只擦除最旧的一个扇区，其余扇区的记录仍可查询
+ *          - 重新挂载：恢复当前扇区、写入偏移与最后记录时间；掉电写坏的记录被跳过，
+ *            写入位置越过该记录
+ *          全程检查 NOR 上没有需要把 0 变回 1 的写入。
+ *          用法：test_audit [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "fal_sim.h"
+
+/* 不编译 msh 命令 */
+#undef RT_USING_FINSH
+#include "audit.c"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+#define SECTOR_RECS     (FAL_SIM_BLK_SIZE / AUDIT_REC_SIZE - 1)     /* 每个扇区除扇区头外的记录数 */
+
+static fal_sim_stat_t stat0;            /* 用例开始时的 Flash 统计 */
+static rt_uint32_t programs0, erases0;
+
+static void mark(void)
+{
+    stat0 = fal_sim_stat;
+    programs0 = audit_programs;
+    erases0 = audit_erases;
+}
+
+#define WRITES()        (fal_sim_stat.writes - stat0.writes)
+#define WRITE_BYTES()   (fal_sim_stat.write_bytes - stat0.write_bytes)
+#define READ_BYTES()    (fal_sim_stat.read_bytes - stat0.read_bytes)
+#define ERASES()        (fal_sim_stat.erases - stat0.erases)
+
+/* 记录 n 条并直接提交，不等待提交线程；arg 为递增序号 */
+static rt_uint32_t seq_arg;
+
+static void fill(rt_uint32_t n)
+{
+    rt_uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        audit_log(7, AUDIT_RESULT_OK, AUDIT_METHOD_PIN, seq_arg++);
+        if ((i + 1) % AUDIT_PAGE_RECS == 0) audit_flush();
+    }
+    audit_flush();
+}
+
+/* 查询回调：检查时间顺序并记下最后一条 */
+static rt_uint32_t query_prev;
+static audit_rec_t query_last;
+
+static void query_cb(const audit_rec_t *rec, void *parameter)
+{
+    CHECK(rec->time >= query_prev);
+    query_prev = rec->time;
+    query_last = *rec;
+}
+
+static rt_uint32_t query(rt_uint32_t t1, rt_uint32_t t2)
+{
+    query_prev = 0;
+    return audit_query(t1, t2, query_cb, RT_NULL);
+}
+
+/* 模拟重启：按 Flash 内容重新建立索引与写入位置 */
+static void remount(void)
+{
+    rt_memset(audit_index, 0, sizeof(audit_index));
+    audit_cur = audit_off = audit_last = 0;
+    CHECK_EQ(audit_mount(), RT_EOK);
+}
+
+static void test_batch(void)
+{
+    /* 空白分区：格式化第一个扇区，扇区头占第一页的一个位置 */
+    CHECK_EQ(audit_cur, 0);
+    CHECK_EQ(audit_off, sizeof(audit_head_t));
+    CHECK_EQ(audit_room, AUDIT_PAGE_RECS - 1);
+    fill(AUDIT_PAGE_RECS - 1);
+    CHECK_EQ(audit_off, AUDIT_PAGE_SIZE);
+
+    /* 一连串事件凑满一页：提交线程只编程一次 */
+    mark();
+    for (int i = 0; i < (int)AUDIT_PAGE_RECS; i++)
+    {
+        audit_log(7, AUDIT_RESULT_FAIL, AUDIT_METHOD_PIN, seq_arg++);
+    }
+    rt_thread_mdelay(1);
+    CHECK_EQ(WRITES(), 1);
+    CHECK_EQ(WRITE_BYTES(), AUDIT_PAGE_SIZE);
+    CHECK_EQ(audit_programs - programs0, 1);
+    CHECK_EQ(audit_in - audit_out, 0);
+
+    /* 不足一页：AUDIT_FLUSH_MS 之前只在 RAM 中，到时提交一次 */
+    mark();
+    audit_log(7, AUDIT_RESULT_OK, AUDIT_METHOD_PIN, seq_arg++);
+    rt_thread_mdelay(AUDIT_FLUSH_MS / 2);
+    audit_log(7, AUDIT_RESULT_LOCK, AUDIT_METHOD_AUTO, seq_arg++);
+    audit_log(7, AUDIT_RESULT_OK, AUDIT_METHOD_KEY, seq_arg++);
+    rt_thread_mdelay(AUDIT_FLUSH_MS / 2 - 10);
+    CHECK_EQ(WRITES(), 0);
+    CHECK_EQ(audit_in - audit_out, 3);
+    rt_thread_mdelay(20);
+    CHECK_EQ(WRITES(), 1);
+    CHECK_EQ(WRITE_BYTES(), 3 * AUDIT_REC_SIZE);
+    CHECK_EQ(audit_in - audit_out, 0);
+    CHECK_EQ(ERASES(), 0);
+}
+
+static rt_uint32_t t0_end, t1, t2;
+
+static void test_query(void)
+{
+    rt_uint32_t used = AUDIT_PAGE_RECS * 2 - 1 + 3;
+
+    /*
+     * 扇区 0 写满；扇区 1 在 10 秒后开始，后一半记录再晚 5 秒；扇区 2 在 10 秒后开始，
+     * 后 5 条再晚 1 秒。扇区的时间范围到下一个扇区的首条记录为止(含)
+     */
+    fill(SECTOR_RECS - used);
+    CHECK_EQ(audit_off, FAL_SIM_BLK_SIZE);
+    t0_end = audit_last;
+    rt_thread_mdelay(10000);
+    t1 = audit_now();
+    fill(SECTOR_RECS / 2);
+    rt_thread_mdelay(5000);
+    fill(SECTOR_RECS - SECTOR_RECS / 2);
+    CHECK_EQ(audit_cur, 1);
+    rt_thread_mdelay(10000);
+    t2 = audit_now();
+    fill(5);
+    rt_thread_mdelay(1000);
+    fill(5);
+    CHECK_EQ(audit_cur, 2);
+    CHECK_EQ(audit_index[1].time, t1);
+    CHECK_EQ(audit_index[2].time, t2);
+
+    /* 每个范围只读取一个扇区 */
+    mark();
+    CHECK_EQ(query(0, t0_end), SECTOR_RECS);
+    CHECK(READ_BYTES() <= FAL_SIM_BLK_SIZE);
+
+    mark();
+    CHECK_EQ(query(t1 + 1, t1 + 5), SECTOR_RECS - SECTOR_RECS / 2);
+    CHECK(READ_BYTES() <= FAL_SIM_BLK_SIZE);
+
+    mark();
+    CHECK_EQ(query(t2 + 1, t2 + 100), 5);
+    CHECK(READ_BYTES() <= AUDIT_READ_RECS * AUDIT_REC_SIZE);
+    CHECK_EQ(query_last.arg, seq_arg - 1);
+
+    /* 范围在最后一条记录之后：一个扇区也不读 */
+    mark();
+    CHECK_EQ(query(audit_last + 1, audit_last + 100), 0);
+    CHECK_EQ(READ_BYTES(), 0);
+
+    /* 范围只含扇区 1 首条记录的时间：扇区 0 的时间范围也到此为止，两个扇区都被读取 */
+    CHECK_EQ(query(t1, t1), SECTOR_RECS / 2);
+
+    CHECK_EQ(query(0, 0xFFFFFFFF), 2 * SECTOR_RECS + 10);
+}
+
+static void test_wrap(void)
+{
+    rt_uint32_t sectors = audit_sectors;
+
+    /* 写满其余扇区 */
+    CHECK_EQ(sectors, 256);
+    fill((sectors - 2) * SECTOR_RECS - 10);
+    CHECK_EQ(audit_cur, sectors - 1);
+    CHECK_EQ(audit_off, FAL_SIM_BLK_SIZE);
+    CHECK_EQ(audit_erases, sectors);
+
+    /* 下一条记录只擦除最旧的扇区 0 */
+    rt_thread_mdelay(10000);
+    mark();
+    fill(1);
+    CHECK_EQ(ERASES(), 1);
+    CHECK_EQ(audit_erases - erases0, 1);
+    CHECK_EQ(audit_cur, 0);
+    CHECK_EQ(audit_index[0].seq, sectors + 1);
+    CHECK_EQ(audit_index[1].seq, 2);
+
+    /* 扇区 0 原有的记录不再存在，扇区 1 的记录不受影响 */
+    CHECK_EQ(query(0, t0_end), 0);
+    CHECK_EQ(query(t1, t1 + 5), SECTOR_RECS);
+    CHECK_EQ(query(0, 0xFFFFFFFF), (sectors - 1) * SECTOR_RECS + 1);
+}
+
+static void test_remount(void)
+{
+    rt_uint32_t cur, off, last, total;
+    audit_rec_t torn;
+
+    /* 重新挂载恢复写入位置与最后记录时间 */
+    rt_thread_mdelay(5000);
+    fill(5);
+    cur = audit_cur;
+    off = audit_off;
+    last = audit_last;
+    total = query(0, 0xFFFFFFFF);
+    remount();
+    CHECK_EQ(audit_cur, cur);
+    CHECK_EQ(audit_off, off);
+    CHECK_EQ(audit_last, last);
+    CHECK_EQ(audit_room, (AUDIT_PAGE_SIZE - off % AUDIT_PAGE_SIZE) / AUDIT_REC_SIZE);
+
+    /* 掉电时一条记录只写入前 8 字节 */
+    rt_memset(&torn, 0, sizeof(torn));
+    torn.time = last + 100;
+    torn.user = 7;
+    torn.check = audit_check(&torn);
+    CHECK(fal_partition_write(audit_part, audit_cur * audit_sector_size + audit_off,
+                              (const rt_uint8_t *)&torn, 8) == 8);
+    remount();
+    CHECK_EQ(audit_cur, cur);
+    CHECK_EQ(audit_off, off + AUDIT_REC_SIZE);
+    CHECK_EQ(audit_last, last);
+    CHECK_EQ(query(0, 0xFFFFFFFF), total);
+
+    /* 之后的记录写在坏记录之后，查询不返回坏记录 */
+    fill(1);
+    CHECK_EQ(audit_off, off + 2 * AUDIT_REC_SIZE);
+    CHECK_EQ(query(0, 0xFFFFFFFF), total + 1);
+    CHECK_EQ(query_last.arg, seq_arg - 1);
+    CHECK_EQ(query(last + 100, last + 100), 0);
+}
+
+/* 测试线程：优先级最高，阻塞时仿真时钟前进，提交线程在其间运行 */
+static void test_entry(void *parameter)
+{
+    CHECK(fal_init() > 0);
+    CHECK_EQ(audit_init(), RT_EOK);
+    CHECK_EQ(audit_erases, 1);
+
+    test_batch();
+    test_query();
+    test_wrap();
+    test_remount();
+
+    CHECK_EQ(fal_sim_stat.overwrites, 0);
+    CHECK_EQ(audit_dropped, 0);
+    sim_exit(TEST_RESULT("audit"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
@@ -0,0 +1,530 @@
+/**
+ * @file    test_dmabuf.c
+ * @brief   DMA 缓冲池(libraries/drivers/drv_dmabuf.c)的主机测试
+ * @details 直接包含 drv_dmabuf.c，缓冲池指向本文件中的数组，两个 D-Cache 维护函数换成记录地址范围的替身：
+ *          - 分配：单块、多块连续区、跨 32 位位图字边界、最大 32 块、全部用完与碎片化后的失败
+ *          - 与参考模型(逐块数组上的首次适配)对照的随机分配/释放，检查地址、对齐、互不重叠
+ *          - 释放非分配地址与重复释放触发断言
+ *          - 映射：池内、直接使用(清除/无效化的范围)、未对齐与 XIP 源的中转、超长截断、池满返回 0
+ *          - 统计计数与中断开关配对
+ *          用法：test_dmabuf [种子]
+ * @date    2025-12-20
+ */
+
+/* rtconfig_preinc.h 只开放 POSIX.1，MAP_ANONYMOUS/MAP_FIXED_NOREPLACE 需要 GNU 扩展 */
+#define _GNU_SOURCE
+
+#include <rtthread.h>
+#include <board.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "test.h"
+
+#define DMABUF_POOL_SIZE        (32 * 1024)
+#define DMABUF_POOL_ADDR        ((rt_ubase_t)test_pool)
+
+static rt_uint8_t test_pool[DMABUF_POOL_SIZE] __attribute__((aligned(32)));
+
+/* 记录驱动发出的 D-Cache 维护操作 */
+static struct
+{
+    const void *addr;
+    rt_size_t len;
+} test_clean_op, test_inval_op;
+static int test_cleans, test_invals;
+
+static void test_clean(uint32_t *addr, int32_t len)
+{
+    test_clean_op.addr = addr;
+    test_clean_op.len = len;
+    test_cleans++;
+}
+
+static void test_invalidate(uint32_t *addr, int32_t len)
+{
+    test_inval_op.addr = addr;
+    test_inval_op.len = len;
+    test_invals++;
+}
+
+/* 主机上没有 RCC 与 SCB，msh 命令不参与测试 */
+#undef __HAL_RCC_SRAM1_CLK_ENABLE
+#undef RT_USING_FINSH
+#define SCB_CleanDCache_by_Addr(a, l)       test_clean(a, l)
+#define SCB_InvalidateDCache_by_Addr(a, l)  test_invalidate(a, l)
+
+#include "drv_dmabuf.c"
+
+/* ===================== 内核替身 ===================== */
+
+static int irq_depth;                   /* 当前关中断的嵌套层数 */
+static int assert_armed, assert_hit;
+static jmp_buf assert_jmp;
+
+rt_base_t rt_hw_interrupt_disable(void)
+{
+    return irq_depth++;
+}
+
+void rt_hw_interrupt_enable(rt_base_t level)
+{
+    irq_depth = level;
+}
+
+void *rt_memcpy(void *dst, const void *src, rt_ubase_t count)
+{
+    return memcpy(dst, src, count);
+}
+
+void *rt_memset(void *s, int c, rt_ubase_t count)
+{
+    return memset(s, c, count);
+}
+
+int __rt_ffs(int value)
+{
+    return __builtin_ffs(value);
+}
+
+void rt_assert_handler(const char *ex, const char *func, rt_size_t line)
+{
+    if (assert_armed)
+    {
+        assert_hit = 1;
+        longjmp(assert_jmp, 1);
+    }
+    printf("assertion %s failed at %s:%u\n", ex, func, (unsigned)line);
+    fflush(stdout);
+    abort();
+}
+
+/* 执行 stmt，期望其中的 RT_ASSERT 失败 */
+#define CHECK_ASSERT(stmt)                                                      \
+    do {                                                                        \
+        assert_hit = 0;                                                         \
+        if (!setjmp(assert_jmp))                                                \
+        {                                                                       \
+            assert_armed = 1;                                                   \
+            stmt;                                                               \
+        }                                                                       \
+        assert_armed = 0;                                                       \
+        irq_depth = 0;                                                          \
+        CHECK(assert_hit);                                                      \
+    } while (0)
+
+/* ===================== 辅助 ===================== */
+
+#define BLK(i)      (test_pool + (i) * DMABUF_BLOCK_SIZE)
+
+static int blk(const void *buf)
+{
+    return buf ? (int)(((const rt_uint8_t *)buf - test_pool) / DMABUF_BLOCK_SIZE) : -1;
+}
+
+static int free_blocks(void)
+{
+    int i, n = 0;
+
+    for (i = 0; i < DMABUF_BLOCKS; i++)
+    {
+        n += (dmabuf_free_map[i / 32] >> (i % 32)) & 1;
+    }
+    return n;
+}
+
+/* 每个用例从空池开始，结束时池必须完整归还 */
+static void setup(void)
+{
+    rt_hw_dmabuf_init();
+    test_cleans = test_invals = 0;
+}
+
+static void teardown(void)
+{
+    int i, runs = 0;
+
+    for (i = 0; i < DMABUF_BLOCKS; i++)
+    {
+        runs += dmabuf_run[i] != 0;
+    }
+    CHECK_EQ(free_blocks(), DMABUF_BLOCKS);
+    CHECK_EQ(runs, 0);
+    CHECK_EQ(dmabuf_stats.used, 0);
+    CHECK_EQ(irq_depth, 0);
+}
+
+/* ===================== 分配 ===================== */
+
+static void test_uninit(void)
+{
+    /* rt_hw_dmabuf_init 之前位图全空，调用方走退回路径 */
+    CHECK(rt_hw_dmabuf_alloc(1) == RT_NULL);
+    CHECK_EQ(dmabuf_stats.fail, 1);
+    CHECK_EQ(irq_depth, 0);
+}
+
+static void test_alloc(void)
+{
+    void *a, *b, *c, *d;
+
+    setup();
+    CHECK_EQ(DMABUF_BLOCKS, 64);
+    CHECK_EQ(DMABUF_WORDS, 2);
+
+    CHECK(rt_hw_dmabuf_alloc(0) == RT_NULL);
+    CHECK(rt_hw_dmabuf_alloc(DMABUF_MAX_SIZE + 1) == RT_NULL);
+
+    a = rt_hw_dmabuf_alloc(1);
+    b = rt_hw_dmabuf_alloc(DMABUF_BLOCK_SIZE);
+    c = rt_hw_dmabuf_alloc(DMABUF_BLOCK_SIZE + 1);
+    CHECK(a == BLK(0));
+    CHECK(b == BLK(1));
+    CHECK(c == BLK(2));
+    CHECK_EQ(dmabuf_run[2], 2);
+    CHECK_EQ(dmabuf_stats.used, 4);
+    CHECK_EQ((rt_ubase_t)c & DMABUF_LINE_MASK, 0);
+
+    /* 32 块只能占满一个位图字，第 0 字已被占用 */
+    d = rt_hw_dmabuf_alloc(DMABUF_MAX_SIZE);
+    CHECK(d == BLK(32));
+    CHECK_EQ(dmabuf_free_map[1], 0);
+    CHECK(rt_hw_dmabuf_alloc(DMABUF_MAX_SIZE) == RT_NULL);
+    CHECK_EQ(dmabuf_stats.peak, 36);
+
+    /* 释放后的空洞被首次适配重新使用 */
+    rt_hw_dmabuf_free(b);
+    CHECK(rt_hw_dmabuf_alloc(DMABUF_BLOCK_SIZE) == BLK(1));
+    rt_hw_dmabuf_free(BLK(1));
+    CHECK(rt_hw_dmabuf_alloc(2 * DMABUF_BLOCK_SIZE) == BLK(4));
+    rt_hw_dmabuf_free(BLK(4));
+
+    rt_hw_dmabuf_free(a);
+    rt_hw_dmabuf_free(c);
+    rt_hw_dmabuf_free(d);
+    rt_hw_dmabuf_free(RT_NULL);
+    CHECK_EQ(dmabuf_stats.peak, 37);
+    teardown();
+}
+
+static void test_word_boundary(void)
+{
+    void *blocks[30];
+    int i;
+
+    setup();
+    for (i = 0; i < 30; i++)
+    {
+        blocks[i] = rt_hw_dmabuf_alloc(1);
+    }
+    CHECK(blocks[29] == BLK(29));
+
+    /* 第 0 字只剩 30、31 两块，3 块的连续区不能跨到第 1 字 */
+    CHECK(rt_hw_dmabuf_alloc(3 * DMABUF_BLOCK_SIZE) == BLK(32));
+    CHECK(rt_hw_dmabuf_alloc(2 * DMABUF_BLOCK_SIZE) == BLK(30));
+    CHECK_EQ(dmabuf_free_map[0], 0);
+    CHECK_EQ(dmabuf_free_map[1], ~0U << 3);
+
+    /* 恰好结束在字的最后一位 */
+    rt_hw_dmabuf_free(BLK(32));
+    CHECK(rt_hw_dmabuf_alloc(29 * DMABUF_BLOCK_SIZE) == BLK(32));
+    CHECK(rt_hw_dmabuf_alloc(3 * DMABUF_BLOCK_SIZE) == BLK(61));
+    CHECK(rt_hw_dmabuf_alloc(1) == RT_NULL);
+    CHECK_EQ(free_blocks(), 0);
+
+    rt_hw_dmabuf_free(BLK(30));
+    rt_hw_dmabuf_free(BLK(32));
+    rt_hw_dmabuf_free(BLK(61));
+    for (i = 0; i < 30; i++)
+    {
+        rt_hw_dmabuf_free(blocks[i]);
+    }
+    teardown();
+}
+
+static void test_exhaust(void)
+{
+    int i, n = 0;
+    rt_uint32_t fail;
+
+    setup();
+    while (rt_hw_dmabuf_alloc(1) != RT_NULL)
+    {
+        n++;
+    }
+    CHECK_EQ(n, DMABUF_BLOCKS);
+    CHECK_EQ(dmabuf_stats.used, DMABUF_BLOCKS);
+    CHECK_EQ(dmabuf_stats.peak, DMABUF_BLOCKS);
+    fail = dmabuf_stats.fail;
+    CHECK(rt_hw_dmabuf_alloc(1) == RT_NULL);
+    CHECK_EQ(dmabuf_stats.fail, fail + 1);
+
+    /* 隔块释放：一半空闲，但没有两块相连的空闲区 */
+    for (i = 0; i < DMABUF_BLOCKS; i += 2)
+    {
+        rt_hw_dmabuf_free(BLK(i));
+    }
+    CHECK_EQ(free_blocks(), DMABUF_BLOCKS / 2);
+    CHECK(rt_hw_dmabuf_alloc(2 * DMABUF_BLOCK_SIZE) == RT_NULL);
+    rt_hw_dmabuf_free(BLK(41));
+    CHECK(rt_hw_dmabuf_alloc(3 * DMABUF_BLOCK_SIZE) == BLK(40));
+    CHECK(rt_hw_dmabuf_alloc(1) == BLK(0));
+
+    rt_hw_dmabuf_free(BLK(0));
+    rt_hw_dmabuf_free(BLK(40));
+    for (i = 1; i < DMABUF_BLOCKS; i += 2)
+    {
+        if (i != 41)
+        {
+            rt_hw_dmabuf_free(BLK(i));
+        }
+    }
+    teardown();
+}
+
+static void test_bad_free(void)
+{
+    rt_uint8_t other[DMABUF_BLOCK_SIZE];
+    void *a;
+
+    setup();
+    a = rt_hw_dmabuf_alloc(2 * DMABUF_BLOCK_SIZE);
+    CHECK_ASSERT(rt_hw_dmabuf_free(other));
+    CHECK_ASSERT(rt_hw_dmabuf_free((rt_uint8_t *)a + 32));
+    CHECK_ASSERT(rt_hw_dmabuf_free(BLK(1)));            /* 连续区中间的块 */
+    CHECK_ASSERT(rt_hw_dmabuf_free(BLK(5)));            /* 从未分配 */
+    rt_hw_dmabuf_free(a);
+    CHECK_ASSERT(rt_hw_dmabuf_free(a));                 /* 重复释放 */
+    teardown();
+}
+
+/* 参考模型：在逐块数组上对每个位图字做首次适配 */
+static int model_alloc(rt_uint8_t *owner, int n, int tag)
+{
+    int w, b, i;
+
+    for (w = 0; w < DMABUF_WORDS; w++)
+    {
+        for (b = 0; b + n <= 32; b++)
+        {
+            for (i = 0; i < n && !owner[w * 32 + b + i]; i++)
+            {
+            }
+            if (i == n)
+            {
+                memset(owner + w * 32 + b, tag, n);
+                return w * 32 + b;
+            }
+        }
+    }
+    return -1;
+}
+
+static void test_random(unsigned seed)
+{
+    rt_uint8_t owner[DMABUF_BLOCKS] = {0};
+    struct
+    {
+        rt_uint8_t *buf;
+        int n;
+    } live[DMABUF_BLOCKS + 1];
+    int count = 0, step, i, n, idx, mism = 0, corrupt = 0, cross = 0;
+
+    setup();
+    srand(seed);
+    for (step = 0; step < 20000; step++)
+    {
+        if (count > 0 && (rand() % 2 || count == DMABUF_BLOCKS))
+        {
+            i = rand() % count;
+            /* 释放前确认内容没有被其它分配覆盖 */
+            for (idx = 0; idx < live[i].n * DMABUF_BLOCK_SIZE; idx++)
+            {
+                corrupt += live[i].buf[idx] != (rt_uint8_t)(blk(live[i].buf) + 1);
+            }
+            memset(owner + blk(live[i].buf), 0, live[i].n);
+            rt_hw_dmabuf_free(live[i].buf);
+            live[i] = live[--count];
+            continue;
+        }
+
+        /* 偏向小分配，偶尔申请大块 */
+        n = rand() % 8 ? 1 + rand() % 4 : 1 + rand() % 32;
+        idx = model_alloc(owner, n, 0xff);
+        live[count].buf = rt_hw_dmabuf_alloc(n * DMABUF_BLOCK_SIZE - rand() % DMABUF_BLOCK_SIZE);
+        live[count].n = n;
+        if (blk(live[count].buf) != idx)
+        {
+            mism++;
+            if (idx >= 0)
+            {
+                memset(owner + idx, 0, n);
+            }
+            rt_hw_dmabuf_free(live[count].buf);
+            continue;
+        }
+        if (idx < 0)
+        {
+            continue;
+        }
+        cross += idx % 32 + n > 32;
+        memset(live[count].buf, idx + 1, n * DMABUF_BLOCK_SIZE);
+        count++;
+    }
+    CHECK_EQ(mism, 0);
+    CHECK_EQ(corrupt, 0);
+    CHECK_EQ(cross, 0);
+    CHECK_EQ(irq_depth, 0);
+
+    for (i = 0; i < count; i++)
+    {
+        rt_hw_dmabuf_free(live[i].buf);
+    }
+    teardown();
+}
+
+/* ===================== 映射 ===================== */
+
+static rt_uint8_t ram[DMABUF_MAX_SIZE + 256] __attribute__((aligned(32)));
+
+static void test_map_direct(void)
+{
+    struct rt_dmabuf_map map;
+    void *pool;
+
+    setup();
+
+    /* 池内缓冲不可缓存，不做维护 */
+    pool = rt_hw_dmabuf_alloc(64);
+    CHECK_EQ(rt_hw_dmabuf_map(&map, pool, 64, RT_DMABUF_BIDIRECTIONAL, 4), 64);
+    CHECK(map.dma == pool && !map.bounce);
+    rt_hw_dmabuf_unmap(&map);
+    rt_hw_dmabuf_free(pool);
+    CHECK_EQ(test_cleans + test_invals, 0);
+
+    /* 发送：起始地址向下对齐到缓存行后清除 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 4, 100, RT_DMABUF_TO_DEVICE, 4), 100);
+    CHECK(map.dma == ram + 4 && !map.bounce);
+    CHECK(test_clean_op.addr == ram);
+    CHECK_EQ(test_clean_op.len, 104);
+    rt_hw_dmabuf_unmap(&map);
+    CHECK_EQ(test_cleans, 1);
+    CHECK_EQ(test_invals, 0);
+    CHECK_EQ(map.len, 0);
+
+    /* 整行的接收缓冲：映射与解除映射各无效化一次 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 64, 96, RT_DMABUF_FROM_DEVICE, 4), 96);
+    CHECK(map.dma == ram + 64 && !map.bounce);
+    CHECK_EQ(test_invals, 1);
+    rt_hw_dmabuf_unmap(&map);
+    CHECK_EQ(test_invals, 2);
+    CHECK(test_inval_op.addr == ram + 64);
+    CHECK_EQ(test_inval_op.len, 96);
+    CHECK_EQ(test_cleans, 1);
+
+    /* 直接使用不受 DMABUF_MAX_SIZE 限制 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram, sizeof(ram), RT_DMABUF_TO_DEVICE, 1), sizeof(ram));
+    rt_hw_dmabuf_unmap(&map);
+
+    CHECK_EQ(dmabuf_stats.direct, 4);
+    CHECK_EQ(dmabuf_stats.bounce, 0);
+    teardown();
+}
+
+static void test_map_bounce(void)
+{
+    struct rt_dmabuf_map map;
+    int i;
+
+    setup();
+    for (i = 0; i < 64; i++)
+    {
+        ram[i] = i;
+    }
+
+    /* 不满足 DMA 对齐的发送缓冲：映射时复制进池 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 1, 40, RT_DMABUF_TO_DEVICE, 4), 40);
+    CHECK(map.bounce && map.dma == BLK(0));
+    CHECK(memcmp(map.dma, ram + 1, 40) == 0);
+    CHECK_EQ(dmabuf_stats.used, 1);
+    rt_hw_dmabuf_unmap(&map);
+    CHECK_EQ(dmabuf_stats.used, 0);
+
+    /* 与其它数据共用缓存行的接收缓冲：解除映射时复制回来，周围字节不变 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 8, 16, RT_DMABUF_FROM_DEVICE, 4), 16);
+    CHECK(map.bounce);
+    memset(map.dma, 0xa5, 16);
+    rt_hw_dmabuf_unmap(&map);
+    CHECK_EQ(ram[7], 7);
+    CHECK_EQ(ram[8], 0xa5);
+    CHECK_EQ(ram[23], 0xa5);
+    CHECK_EQ(ram[24], 24);
+    CHECK_EQ(test_cleans + test_invals, 0);
+
+    /* 超过 DMABUF_MAX_SIZE 的中转只映射前 16KB，调用方分段传输 */
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 2, DMABUF_MAX_SIZE + 100, RT_DMABUF_TO_DEVICE, 4), DMABUF_MAX_SIZE);
+    CHECK_EQ(dmabuf_stats.used, 32);
+    rt_hw_dmabuf_unmap(&map);
+
+    /* 池满时返回 0，解除映射为空操作 */
+    CHECK(rt_hw_dmabuf_alloc(DMABUF_MAX_SIZE) == BLK(0));
+    CHECK(rt_hw_dmabuf_alloc(DMABUF_MAX_SIZE) == BLK(32));
+    CHECK_EQ(rt_hw_dmabuf_map(&map, ram + 1, 8, RT_DMABUF_TO_DEVICE, 4), 0);
+    CHECK_EQ(map.len, 0);
+    rt_hw_dmabuf_unmap(&map);
+    rt_hw_dmabuf_free(BLK(0));
+    rt_hw_dmabuf_free(BLK(32));
+
+    CHECK_EQ(dmabuf_stats.bounce, 3);
+    CHECK_EQ(dmabuf_stats.direct, 0);
+    teardown();
+}
+
+static void test_map_xip(void)
+{
+    struct rt_dmabuf_map map;
+    rt_uint8_t *xip;
+
+    setup();
+    CHECK(!rt_hw_dmabuf_direct((void *)DMABUF_XIP_START, 32, RT_DMABUF_TO_DEVICE, 4));
+    CHECK(!rt_hw_dmabuf_direct((void *)(DMABUF_XIP_START + DMABUF_XIP_SIZE - 32), 32, RT_DMABUF_TO_DEVICE, 4));
+    CHECK(rt_hw_dmabuf_direct((void *)(DMABUF_XIP_START + DMABUF_XIP_SIZE), 32, RT_DMABUF_TO_DEVICE, 4));
+    CHECK(rt_hw_dmabuf_direct((void *)(DMABUF_XIP_START - 32), 32, RT_DMABUF_TO_DEVICE, 4));
+
+    /* 在 XIP 地址上映射一页主机内存，检查中转时确实从源地址复制 */
+    xip = mmap((void *)DMABUF_XIP_START, 4096, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (xip == (void *)DMABUF_XIP_START)
+    {
+        memcpy(xip, "font data", 10);
+        CHECK_EQ(rt_hw_dmabuf_map(&map, xip, 10, RT_DMABUF_TO_DEVICE, 4), 10);
+        CHECK(map.bounce);
+        CHECK_STR((char *)map.dma, "font data");
+        rt_hw_dmabuf_unmap(&map);
+        CHECK_EQ(test_cleans, 0);
+        munmap(xip, 4096);
+    }
+    else
+    {
+        printf("0x%08x is not available, XIP bounce copy not checked\n", DMABUF_XIP_START);
+    }
+    teardown();
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned seed = argc > 1 ? strtoul(argv[1], RT_NULL, 0) : 1;
+
+    test_uninit();
+    test_alloc();
+    test_word_boundary();
+    test_exhaust();
+    test_bad_free();
+    test_random(seed);
+    test_map_direct();
+    test_map_bounce();
+    test_map_xip();
+
+    return TEST_RESULT("dmabuf");
+}
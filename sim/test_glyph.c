@@ -0,0 +1,228 @@
+/**
+ * @file    test_glyph.c
+ * @brief   叠加方式文字(mode=1)的 SPI 流量对比与主机测试(Driver/lcd.c)
+ * @details 直接包含 lcd.c，在 gImage_2 背景上逐个绘制 16/24/32 点汉字与 16/32 点 ASCII 字符：
+ *          - before：原实现，对字模中每个为 1 的位调用一次 LCD_DrawPoint
+ *          - after：LCD_ShowChar / LCD_ShowChinese*(mode=1)，即 LCD_Blend_Mask
+ *          每个字模两种方式各画一次，用 lcd_stats 统计每字的 SPI 字节数、传输次数与地址窗口数，
+ *          输出对比表；并检查两种方式写到屏幕模型的结果逐像素相同，帧缓冲下每字只刷新前景像素的
+ *          外接矩形(一个窗口)，直接写屏时每行每段连续前景像素一个窗口、字节数不多于 before。
+ *          sim/SConstruct 把本文件编译两次：test_glyph 使用帧缓冲，test_glyph_stream 定义
+ *          LCD_USE_FRAMEBUFFER=0。
+ *          用法：test_glyph [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "lcd.c"
+#include "pic_rle.h"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+#define GLYPH_FC        RED
+#define WINDOW_BYTES    11          /* 0x2A、4 字节列地址、0x2B、4 字节行地址、0x2C */
+
+/* 字模集合：w x h 点阵，按序号取字模与对应的绘制调用 */
+typedef struct
+{
+    const char *name;
+    u16 w, h;
+    int num;
+} glyph_set_t;
+
+static const glyph_set_t glyph_sets[] = {
+    {"hz16",  16, 16, TFONT16_INDEX_NUM},
+    {"hz24",  24, 24, TFONT24_INDEX_NUM},
+    {"hz32",  32, 32, TFONT32_INDEX_NUM},
+    {"asc16",  8, 16, '~' - ' ' + 1},
+    {"asc32", 16, 32, '~' - ' ' + 1},
+};
+
+static const u8 *glyph_mask(int set, int k)
+{
+    switch (set)
+    {
+    case 0:  return tfont16[tfont16_index[k].idx].Msk;
+    case 1:  return tfont24[tfont24_index[k].idx].Msk;
+    case 2:  return tfont32[tfont32_index[k].idx].Msk;
+    case 3:  return ascii_1608[k];
+    default: return ascii_3216[k];
+    }
+}
+
+/* after：经公开接口按叠加方式绘制 */
+static void glyph_draw(int set, int k, u16 x, u16 y)
+{
+    const glyph_set_t *gs = &glyph_sets[set];
+    u32 code;
+    u8 s[4];
+
+    if (set >= 3)
+    {
+        LCD_ShowChar(x, y, ' ' + k, GLYPH_FC, WHITE, gs->h, 1);
+        return;
+    }
+    code = (set == 0 ? tfont16_index : set == 1 ? tfont24_index : tfont32_index)[k].code;
+    s[0] = 0xE0 | (code >> 12);
+    s[1] = 0x80 | ((code >> 6) & 0x3F);
+    s[2] = 0x80 | (code & 0x3F);
+    s[3] = 0;
+    LCD_ShowChinese(x, y, s, GLYPH_FC, WHITE, gs->h, 1);
+}
+
+/* before：原实现，每个前景像素单独设置窗口 */
+static void glyph_draw_points(int set, int k, u16 x, u16 y)
+{
+    const glyph_set_t *gs = &glyph_sets[set];
+    const u8 *msk = glyph_mask(set, k);
+    u16 n;
+
+    for (n = 0; n < gs->w * gs->h; n++)
+    {
+        if (msk[n >> 3] & (0x01 << (n & 7))) LCD_DrawPoint(x + n % gs->w, y + n / gs->w, GLYPH_FC);
+    }
+}
+
+/* 字模形状：每行连续前景像素的段数(直接写屏时 after 的窗口数)与前景像素外接矩形的面积 */
+static void glyph_shape(int set, int k, u32 *runs, u32 *area)
+{
+    const glyph_set_t *gs = &glyph_sets[set];
+    const u8 *msk = glyph_mask(set, k);
+    int i, j, n, on, prev;
+    int x1 = gs->w, y1 = gs->h, x2 = -1, y2 = -1;
+
+    *runs = 0;
+    for (j = 0; j < gs->h; j++)
+    {
+        for (i = 0, prev = 0; i < gs->w; i++, prev = on)
+        {
+            n = j * gs->w + i;
+            on = (msk[n >> 3] & (0x01 << (n & 7))) != 0;
+            if (!on) continue;
+            if (!prev) (*runs)++;
+            if (i < x1) x1 = i;
+            if (i > x2) x2 = i;
+            if (j < y1) y1 = j;
+            y2 = j;
+        }
+    }
+    *area = x2 < 0 ? 0 : (x2 - x1 + 1) * (y2 - y1 + 1);
+}
+
+static u16 screen[LCD_H][LCD_W];
+
+static void screen_save(void)
+{
+    int x, y;
+
+    for (y = 0; y < LCD_H; y++)
+        for (x = 0; x < LCD_W; x++) screen[y][x] = sim_panel_pixel(x, y);
+}
+
+static int screen_diff(void)
+{
+    int x, y, bad = 0;
+
+    for (y = 0; y < LCD_H; y++)
+        for (x = 0; x < LCD_W; x++) bad += screen[y][x] != sim_panel_pixel(x, y);
+    return bad;
+}
+
+static void background(void)
+{
+    LCD_ShowImageCompressed(0, 0, &gImage_2_rle);
+    LCD_Flush();
+    rt_thread_mdelay(20);
+    rt_memset(&lcd_stats, 0, sizeof(lcd_stats));
+}
+
+static void glyph_set_run(int set)
+{
+    const glyph_set_t *gs = &glyph_sets[set];
+    lcd_stats_t before = {0}, after = {0};
+    int k, bad = 0, wrong = 0;
+    u32 runs, area;
+    u16 x, y;
+
+    for (k = 0; k < gs->num; k++)
+    {
+        x = (u16)((7 + k * 13) % (LCD_W - gs->w));
+        y = (u16)((20 + k * 29) % (LCD_H - gs->h));
+
+        background();
+        glyph_draw_points(set, k, x, y);
+        LCD_Flush();
+        rt_thread_mdelay(20);
+        screen_save();
+        before.bytes += lcd_stats.bytes;
+        before.xfers += lcd_stats.xfers;
+        before.windows += lcd_stats.windows;
+
+        background();
+        glyph_draw(set, k, x, y);
+        LCD_Flush();
+        rt_thread_mdelay(20);
+        bad += screen_diff() != 0;
+        after.bytes += lcd_stats.bytes;
+        after.xfers += lcd_stats.xfers;
+        after.windows += lcd_stats.windows;
+
+        /*
+         * 帧缓冲：只刷新前景像素的外接矩形，一个窗口(before 的逐点脏矩形合并后也接近外接矩形，
+         * 偶尔拆成两个更小的矩形)；直接写屏：每段连续前景像素一个窗口
+         */
+        glyph_shape(set, k, &runs, &area);
+#if LCD_USE_FRAMEBUFFER
+        wrong += lcd_stats.windows != (area ? 1 : 0);
+        wrong += lcd_stats.bytes != (area ? WINDOW_BYTES + area * 2 : 0);
+#else
+        wrong += lcd_stats.windows != runs;
+#endif
+    }
+    /* 不一致的字模数 */
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(wrong, 0);
+#if !LCD_USE_FRAMEBUFFER
+    CHECK(after.bytes < before.bytes);
+#endif
+
+    printf("%-6s %3d  %8.1f %7.1f %7.1f  %8.1f %7.1f %7.1f  %5.2fx\n", gs->name, gs->num,
+           (double)before.bytes / gs->num, (double)before.xfers / gs->num, (double)before.windows / gs->num,
+           (double)after.bytes / gs->num, (double)after.xfers / gs->num, (double)after.windows / gs->num,
+           (double)before.bytes / after.bytes);
+}
+
+static void test_entry(void *parameter)
+{
+    int i;
+
+    CHECK_EQ(LCD_Init_RTT(), RT_EOK);
+
+    printf("per glyph over gImage_2, %s\n", LCD_USE_FRAMEBUFFER ? "framebuffer" : "direct");
+    printf("%-6s %3s  %-24s  %-24s\n", "", "", "before (LCD_DrawPoint)", "after (LCD_Blend_Mask)");
+    printf("%-6s %3s  %8s %7s %7s  %8s %7s %7s  %6s\n", "font", "num",
+           "bytes", "xfers", "windows", "bytes", "xfers", "windows", "saving");
+    for (i = 0; i < (int)(sizeof(glyph_sets) / sizeof(glyph_sets[0])); i++)
+    {
+        glyph_set_run(i);
+    }
+
+    sim_exit(TEST_RESULT(LCD_USE_FRAMEBUFFER ? "glyph" : "glyph_stream"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
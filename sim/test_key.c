@@ -0,0 +1,243 @@
+/**
+ * @file    test_key.c
+ * @brief   按键扫描、消抖与长按/重复事件(Driver/key.c)的主机回放测试
+ * @details 直接包含 key.c，与 sim_kernel.c、sim_board.c 一起运行在仿真时钟上。
+ *          每个用例是一段按时间排列的按键电平变化(带抖动的按下与释放、短毛刺、长按、多键交叠)，
+ *          由最高优先级的测试线程按时刻回放给键盘模型，走与开发板相同的列线中断唤醒、
+ *          节拍定时器逐行扫描与积分消抖；收集线程记录 key_event_get() 读到的事件，
+ *          与期望的事件序列和时刻范围比较。
+ *          用法：test_key [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "key.c"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+/* 一次扫描 4 个节拍，消抖需要连续 KEY_DEBOUNCE_CNT 次扫描，加上唤醒后的第一轮扫描 */
+#define SCAN_MS         (4 * KEY_ROW_TICKS)
+#define LATENCY_MIN     ((KEY_DEBOUNCE_CNT - 1) * SCAN_MS)
+#define LATENCY_MAX     ((KEY_DEBOUNCE_CNT + 1) * SCAN_MS)
+
+/* ===================== 回放 ===================== */
+
+typedef struct
+{
+    rt_uint32_t ms;         /* 相对用例开始的时刻 */
+    rt_uint8_t  key;
+    rt_uint8_t  down;
+} key_step_t;
+
+static rt_tick_t replay_start;
+
+/* 按时刻回放电平变化，结束后再等待 settle 毫秒让扫描回到空闲 */
+static void replay(const key_step_t *step, int n, rt_uint32_t settle)
+{
+    rt_int32_t wait;
+    int i;
+
+    rt_thread_mdelay(100);
+    replay_start = rt_tick_get();
+    for (i = 0; i < n; i++)
+    {
+        wait = (rt_int32_t)(replay_start + step[i].ms - rt_tick_get());
+        if (wait > 0) rt_thread_mdelay(wait);
+        sim_key_set(step[i].key, step[i].down);
+    }
+    rt_thread_mdelay(settle);
+}
+
+/* ===================== 事件收集 ===================== */
+
+#define LOG_MAX     64
+
+static key_event_t event_log[LOG_MAX];
+static int events;
+
+static void collect_entry(void *parameter)
+{
+    key_event_t evt;
+
+    while (1)
+    {
+        if (key_event_get(&evt, RT_WAITING_FOREVER) == RT_EOK && events < LOG_MAX)
+        {
+            event_log[events++] = evt;
+        }
+    }
+}
+
+/* 第 i 个事件相对用例开始的时刻 */
+static rt_int32_t event_ms(int i)
+{
+    return (rt_int32_t)(event_log[i].tick - replay_start);
+}
+
+/* 检查第 i 个事件的键值、类型与时刻范围 [from, to] */
+static void check_event(int i, rt_uint8_t key, rt_uint8_t type, rt_int32_t from, rt_int32_t to)
+{
+    CHECK(i < events);
+    if (i >= events) return;
+    CHECK_EQ(event_log[i].key, key);
+    CHECK_EQ(event_log[i].type, type);
+    CHECK(event_ms(i) >= from && event_ms(i) <= to);
+    if (event_ms(i) < from || event_ms(i) > to)
+    {
+        printf("  event %d at %d ms, expected %d ~ %d\n", i, (int)event_ms(i), (int)from, (int)to);
+    }
+}
+
+/* 用例结束：扫描已停止并重新等待列线中断 */
+static void check_idle(void)
+{
+    CHECK(key_armed);
+    CHECK_EQ(key_ring_head, key_ring_tail);
+    events = 0;
+}
+
+/* ===================== 用例 ===================== */
+
+static void test_clean(void)
+{
+    static const key_step_t steps[] = {
+        {0, 5, 1}, {80, 5, 0},
+    };
+
+    replay(steps, 2, 100);
+    CHECK_EQ(events, 2);
+    check_event(0, 5, KEY_EVT_PRESS, LATENCY_MIN, LATENCY_MAX);
+    check_event(1, 5, KEY_EVT_RELEASE, 80 + LATENCY_MIN, 80 + LATENCY_MAX);
+    check_idle();
+}
+
+static void test_bounce(void)
+{
+    /* 触点在按下和释放时各抖动约 6ms */
+    static const key_step_t steps[] = {
+        {0, 2, 1}, {1, 2, 0}, {2, 2, 1}, {3, 2, 0}, {5, 2, 1}, {6, 2, 0}, {7, 2, 1},
+        {100, 2, 0}, {101, 2, 1}, {103, 2, 0}, {104, 2, 1}, {106, 2, 0},
+    };
+
+    replay(steps, sizeof(steps) / sizeof(steps[0]), 100);
+    CHECK_EQ(events, 2);
+    check_event(0, 2, KEY_EVT_PRESS, 7 + LATENCY_MIN, 7 + LATENCY_MAX);
+    check_event(1, 2, KEY_EVT_RELEASE, 106 + LATENCY_MIN, 106 + LATENCY_MAX);
+    check_idle();
+}
+
+static void test_glitch(void)
+{
+    /* 短于一次消抖的毛刺不产生事件，扫描在毛刺消失后回到空闲 */
+    static const key_step_t steps[] = {
+        {0, 9, 1}, {3, 9, 0},
+        {50, 14, 1}, {56, 14, 0},
+        {120, 1, 1}, {122, 1, 0}, {125, 1, 1}, {127, 1, 0},
+    };
+
+    replay(steps, sizeof(steps) / sizeof(steps[0]), 100);
+    CHECK_EQ(events, 0);
+    check_idle();
+}
+
+static void test_long(void)
+{
+    static const key_step_t steps[] = {
+        {0, 13, 1}, {1700, 13, 0},
+    };
+    rt_int32_t press;
+    int i;
+
+    replay(steps, 2, 100);
+
+    /* 按下后 KEY_LONG_MS 长按，之后每 KEY_REPEAT_MS 重复，按扫描周期取整 */
+    CHECK_EQ(events, 6);
+    check_event(0, 13, KEY_EVT_PRESS, LATENCY_MIN, LATENCY_MAX);
+    press = event_ms(0);
+    check_event(1, 13, KEY_EVT_LONG, press + KEY_LONG_MS, press + KEY_LONG_MS + SCAN_MS - 1);
+    for (i = 2; i < 5; i++)
+    {
+        check_event(i, 13, KEY_EVT_REPEAT, event_ms(i - 1) + KEY_REPEAT_MS,
+                    event_ms(i - 1) + KEY_REPEAT_MS + SCAN_MS - 1);
+    }
+    check_event(5, 13, KEY_EVT_RELEASE, 1700 + LATENCY_MIN, 1700 + LATENCY_MAX);
+    check_idle();
+}
+
+static void test_overlap(void)
+{
+    /* 按住 1 时按下 6，先放开 1：各键独立消抖，不丢键也不互相影响 */
+    static const key_step_t steps[] = {
+        {0, 1, 1}, {60, 6, 1}, {120, 1, 0}, {200, 6, 0},
+    };
+
+    replay(steps, 4, 100);
+    CHECK_EQ(events, 4);
+    check_event(0, 1, KEY_EVT_PRESS, LATENCY_MIN, LATENCY_MAX);
+    check_event(1, 6, KEY_EVT_PRESS, 60 + LATENCY_MIN, 60 + LATENCY_MAX);
+    check_event(2, 1, KEY_EVT_RELEASE, 120 + LATENCY_MIN, 120 + LATENCY_MAX);
+    check_event(3, 6, KEY_EVT_RELEASE, 200 + LATENCY_MIN, 200 + LATENCY_MAX);
+    check_idle();
+}
+
+static void test_typing(void)
+{
+    /* 快速输入 123456 确认：按住 40ms、间隔 40ms */
+    static const rt_uint8_t keys[] = {1, 2, 3, 5, 6, 7, 15};
+    key_step_t steps[2 * sizeof(keys)];
+    int i;
+
+    for (i = 0; i < (int)sizeof(keys); i++)
+    {
+        steps[2 * i].ms = i * 80;
+        steps[2 * i].key = keys[i];
+        steps[2 * i].down = 1;
+        steps[2 * i + 1].ms = i * 80 + 40;
+        steps[2 * i + 1].key = keys[i];
+        steps[2 * i + 1].down = 0;
+    }
+    replay(steps, 2 * sizeof(keys), 100);
+
+    CHECK_EQ(events, 2 * (int)sizeof(keys));
+    for (i = 0; i < (int)sizeof(keys); i++)
+    {
+        check_event(2 * i, keys[i], KEY_EVT_PRESS, i * 80 + LATENCY_MIN, i * 80 + LATENCY_MAX);
+        check_event(2 * i + 1, keys[i], KEY_EVT_RELEASE, i * 80 + 40 + LATENCY_MIN, i * 80 + 40 + LATENCY_MAX);
+    }
+    check_idle();
+}
+
+/* 测试线程：优先级最高，回放电平变化，阻塞时仿真时钟前进 */
+static void test_entry(void *parameter)
+{
+    key_init();
+    rt_thread_startup(rt_thread_create("collect", collect_entry, RT_NULL, 1024, 20, 10));
+    rt_thread_mdelay(10);
+    CHECK(key_armed);
+
+    test_clean();
+    test_bounce();
+    test_glitch();
+    test_long();
+    test_overlap();
+    test_typing();
+
+    sim_exit(TEST_RESULT("key"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
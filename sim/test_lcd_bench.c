@@ -0,0 +1,146 @@
+/**
+ * @file    test_lcd_bench.c
+ * @brief   lcd_bench(Driver/lcd_bench.c)的主机版本与 SPI 流量回归检查
+ * @details 直接包含 lcd.c 与 lcd_bench.c，屏幕 SPI 由 sim_board.c 的模型代替，计时使用仿真时钟：
+ *          - 运行一遍 lcd_bench 命令，输出与开发板上相同的表格(耗时为仿真时钟下 20MHz 的理论值)
+ *          - 逐项重复 lcd_bench 的测试循环，由 SPI 模型统计每次迭代的传输次数(同步传输与 DMA 提交)、
+ *            字节数与地址窗口命令(0x2A)数，检查与 lcd_stats 一致，且不超过 bench_budget 中记录的值
+ *          绘制代码改动使某项流量增加时测试失败；流量减少时输出提示，应同时更新 bench_budget。
+ *          sim/SConstruct 把本文件编译两次：test_lcd_bench 使用帧缓冲，test_lcd_bench_stream 定义
+ *          LCD_USE_FRAMEBUFFER=0。
+ *          用法：test_lcd_bench [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "lcd.c"
+#include "lcd_bench.c"
+#include "pic_rle.h"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+/* 每次迭代的 SPI 流量上限 */
+typedef struct
+{
+    const char *name;
+    u32 xfers;
+    u32 bytes;
+    u32 windows;
+} bench_budget_t;
+
+static const bench_budget_t bench_budget[] =
+{
+#if LCD_USE_FRAMEBUFFER
+    {"fill",            1, 32779, 1},
+    {"image",           1, 32779, 1},
+    {"hz16",            2, 5142, 2},
+    {"hz16_overlay",    4, 4540, 4},
+    {"hz24",            1, 5771, 1},
+    {"hz32",            1, 6155, 1},
+    {"ascii16",         1, 4107, 1},
+    {"ascii16_overlay", 1, 2783, 1},
+    {"ascii32",         1, 8203, 1},
+    {"line",            7, 24667, 7},
+    {"circle",          5, 23599, 5},
+#else
+    {"fill",            129, 32779, 1},
+    {"image",           129, 32779, 1},
+    {"hz16",            20, 5230, 10},
+    {"hz16_overlay",    650, 4645, 325},
+    {"hz24",            30, 5815, 5},
+    {"hz32",            27, 6177, 3},
+    {"ascii16",         32, 4272, 16},
+    {"ascii16_overlay", 532, 3694, 266},
+    {"ascii32",         40, 8280, 8},
+    {"line",            1186, 8589, 593},
+    {"circle",          1216, 9504, 608},
+#endif
+};
+
+#define BENCH_NUM   (sizeof(bench_items) / sizeof(bench_items[0]))
+
+/* 与 lcd_bench_run 相同的测试循环，返回每次迭代的 SPI 模型统计 */
+static void bench_measure(const lcd_bench_item_t *it, sim_spi_stat_t *per)
+{
+    sim_spi_stat_t s0;
+    lcd_stats_t l0;
+    u16 i;
+
+    LCD_Fill(0, 0, LCD_W, LCD_H, WHITE);
+    LCD_Flush();
+    rt_thread_mdelay(20);
+
+    s0 = sim_spi_stats;
+    l0 = lcd_stats;
+    for (i = 0; i < it->count; i++)
+    {
+        it->run(i);
+    }
+    rt_thread_mdelay(20);
+
+    /* 驱动自己的统计与线上看到的一致 */
+    CHECK_EQ(lcd_stats.bytes - l0.bytes, sim_spi_stats.bytes - s0.bytes);
+    CHECK_EQ(lcd_stats.xfers - l0.xfers, (sim_spi_stats.xfers - s0.xfers) + (sim_spi_stats.dma - s0.dma));
+    CHECK_EQ(lcd_stats.windows - l0.windows, sim_spi_stats.windows - s0.windows);
+
+    per->xfers   = (sim_spi_stats.xfers + sim_spi_stats.dma - s0.xfers - s0.dma) / it->count;
+    per->bytes   = (sim_spi_stats.bytes - s0.bytes) / it->count;
+    per->windows = (sim_spi_stats.windows - s0.windows) / it->count;
+}
+
+static void test_budget(void)
+{
+    sim_spi_stat_t per;
+    const bench_budget_t *b;
+    rt_size_t i;
+    int over = 0;
+
+    CHECK_EQ(BENCH_NUM, sizeof(bench_budget) / sizeof(bench_budget[0]));
+
+    printf("%-16s %14s %14s %14s\n", "per iteration", "transfers", "bytes", "windows");
+    for (i = 0; i < BENCH_NUM; i++)
+    {
+        b = &bench_budget[i];
+        CHECK(strcmp(b->name, bench_items[i].name) == 0);
+        bench_measure(&bench_items[i], &per);
+        printf("%-16s %6u / %-6u %6u / %-6u %6u / %-6u\n", bench_items[i].name,
+               per.xfers, b->xfers, (u32)per.bytes, b->bytes, per.windows, b->windows);
+
+        over += per.xfers > b->xfers || per.bytes > b->bytes || per.windows > b->windows;
+        if (per.xfers < b->xfers || per.bytes < b->bytes || per.windows < b->windows)
+            printf("%-16s below budget, update bench_budget\n", bench_items[i].name);
+    }
+    /* 超出上限的测试项数 */
+    CHECK_EQ(over, 0);
+}
+
+static void test_entry(void *parameter)
+{
+    char *all[] = {"lcd_bench"};
+    char *none[] = {"lcd_bench", "nosuchtest"};
+
+    CHECK_EQ(LCD_Init_RTT(), RT_EOK);
+
+    CHECK_EQ(lcd_bench(1, all), 0);
+    CHECK_EQ(lcd_bench(2, none), 0);
+    test_budget();
+
+    sim_exit(TEST_RESULT(LCD_USE_FRAMEBUFFER ? "lcd_bench" : "lcd_bench_stream"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
@@ -0,0 +1,401 @@
+/**
+ * @file    test_raster.c
+ * @brief   画线、矩形、圆与圆角矩形(Driver/lcd.c)的主机逐像素测试
+ * @details 直接包含 lcd.c，每个用例先清屏，再用 lcd.c 的图元绘制并 LCD_Flush 到 sim_board.c 的屏幕模型，
+ *          与本文件中逐像素的参考实现画在内存中的期望图像逐像素比较：
+ *          - 画线：教科书式 Bresenham，每步一个像素(lcd.c 把同行/同列的连续像素合并为一段)
+ *          - 圆与圆角矩形轮廓：原 Draw_Circle 的中点算法，8 个对称点分别移到四个圆角的圆心，加上四条直边
+ *          - 填充：每行从轮廓最左的像素填到最右的像素
+ *          用例包括开机进度条、八个方向的线、陡峭上行线(原 delta_y=-delta_x 的错误)、超出屏幕的图形、
+ *          退化的图形(半径 0、单点、圆角大于短边一半)与 1000 个随机图形。
+ *          sim/SConstruct 把本文件编译两次：test_raster 使用帧缓冲，test_raster_stream 定义
+ *          LCD_USE_FRAMEBUFFER=0，此时还检查水平线、垂直线和矩形的地址窗口数。
+ *          用法：test_raster [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "lcd.c"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+#define RASTER_BG       BLACK
+#define RASTER_RANDOM   1000
+
+enum
+{
+    SHAPE_LINE,
+    SHAPE_RECT,
+    SHAPE_CIRCLE,
+    SHAPE_FILL_CIRCLE,
+    SHAPE_ROUND_RECT,
+    SHAPE_FILL_ROUND_RECT,
+    SHAPE_NUM
+};
+
+static const char *const shape_name[SHAPE_NUM] = {
+    "line", "rect", "circle", "fill_circle", "round_rect", "fill_round_rect"
+};
+
+/* 期望图像 */
+static u16 want[LCD_H][LCD_W];
+
+static void ref_point(int x, int y, u16 color)
+{
+    if (x >= 0 && y >= 0 && x < LCD_W && y < LCD_H) want[y][x] = color;
+}
+
+/* 参考画线：每步一个像素 */
+static void ref_line(int x1, int y1, int x2, int y2, u16 color)
+{
+    int dx = abs(x2 - x1), dy = abs(y2 - y1);
+    int sx = x2 >= x1 ? 1 : -1, sy = y2 >= y1 ? 1 : -1;
+    int x = x1, y = y1, err;
+
+    if (dx >= dy)
+    {
+        for (err = dx >> 1;; x += sx)
+        {
+            ref_point(x, y, color);
+            if (x == x2) break;
+            err -= dy;
+            if (err < 0)
+            {
+                err += dx;
+                y += sy;
+            }
+        }
+    }
+    else
+    {
+        for (err = dy >> 1;; y += sy)
+        {
+            ref_point(x, y, color);
+            if (y == y2) break;
+            err -= dx;
+            if (err < 0)
+            {
+                err += dy;
+                x += sx;
+            }
+        }
+    }
+}
+
+/* 轮廓各行最左、最右的像素，行号偏移 RASTER_ROW0 以容纳超出屏幕的部分 */
+#define RASTER_ROW0     300
+#define RASTER_ROWS     (RASTER_ROW0 * 2 + LCD_H)
+
+static int row_min[RASTER_ROWS], row_max[RASTER_ROWS];
+
+static void ref_outline_point(int x, int y, u16 color)
+{
+    ref_point(x, y, color);
+    if (x < row_min[y + RASTER_ROW0]) row_min[y + RASTER_ROW0] = x;
+    if (x > row_max[y + RASTER_ROW0]) row_max[y + RASTER_ROW0] = x;
+}
+
+/* 参考圆角形状：cx1,cy1 与 cx2,cy2 为左上、右下圆角的圆心，相同时为圆 */
+static void ref_round(int cx1, int cy1, int cx2, int cy2, int r, u16 color, int fill)
+{
+    int a = 0, b = r, x, y;
+
+    for (y = 0; y < RASTER_ROWS; y++)
+    {
+        row_min[y] = 0x7FFF;
+        row_max[y] = -0x7FFF;
+    }
+    /* 原 Draw_Circle */
+    while (a <= b)
+    {
+        ref_outline_point(cx2 + b, cy1 - a, color);
+        ref_outline_point(cx1 - b, cy1 - a, color);
+        ref_outline_point(cx2 + b, cy2 + a, color);
+        ref_outline_point(cx1 - b, cy2 + a, color);
+        ref_outline_point(cx2 + a, cy1 - b, color);
+        ref_outline_point(cx1 - a, cy1 - b, color);
+        ref_outline_point(cx2 + a, cy2 + b, color);
+        ref_outline_point(cx1 - a, cy2 + b, color);
+        a++;
+        if ((a * a + b * b) > (r * r)) b--;
+    }
+    /* 直边 */
+    for (x = cx1; x <= cx2; x++)
+    {
+        ref_outline_point(x, cy1 - r, color);
+        ref_outline_point(x, cy2 + r, color);
+    }
+    for (y = cy1; y <= cy2; y++)
+    {
+        ref_outline_point(cx1 - r, y, color);
+        ref_outline_point(cx2 + r, y, color);
+    }
+    if (!fill) return;
+    for (y = 0; y < RASTER_ROWS; y++)
+    {
+        for (x = row_min[y]; x <= row_max[y]; x++) ref_point(x, y - RASTER_ROW0, color);
+    }
+}
+
+/* 与 LCD_Round_Rect 相同的参数整理 */
+static void ref_round_rect(int x1, int y1, int x2, int y2, int r, u16 color, int fill)
+{
+    int t;
+
+    if (x1 > x2) { t = x1; x1 = x2; x2 = t; }
+    if (y1 > y2) { t = y1; y1 = y2; y2 = t; }
+    if (r > (x2 - x1) / 2) r = (x2 - x1) / 2;
+    if (r > (y2 - y1) / 2) r = (y2 - y1) / 2;
+    ref_round(x1 + r, y1 + r, x2 - r, y2 - r, r, color, fill);
+}
+
+typedef struct
+{
+    int shape;
+    u16 x1, y1, x2, y2;     /* 圆：x1,y1 为圆心 */
+    u8 r;
+    u16 color;
+} raster_case_t;
+
+static void case_draw(const raster_case_t *c)
+{
+    switch (c->shape)
+    {
+    case SHAPE_LINE:            LCD_DrawLine(c->x1, c->y1, c->x2, c->y2, c->color); break;
+    case SHAPE_RECT:            LCD_DrawRectangle(c->x1, c->y1, c->x2, c->y2, c->color); break;
+    case SHAPE_CIRCLE:          Draw_Circle(c->x1, c->y1, c->r, c->color); break;
+    case SHAPE_FILL_CIRCLE:     LCD_FillCircle(c->x1, c->y1, c->r, c->color); break;
+    case SHAPE_ROUND_RECT:      LCD_DrawRoundRect(c->x1, c->y1, c->x2, c->y2, c->r, c->color); break;
+    default:                    LCD_FillRoundRect(c->x1, c->y1, c->x2, c->y2, c->r, c->color); break;
+    }
+}
+
+static void case_ref(const raster_case_t *c)
+{
+    switch (c->shape)
+    {
+    case SHAPE_LINE:
+        ref_line(c->x1, c->y1, c->x2, c->y2, c->color);
+        break;
+    case SHAPE_RECT:
+        ref_line(c->x1, c->y1, c->x2, c->y1, c->color);
+        ref_line(c->x1, c->y2, c->x2, c->y2, c->color);
+        ref_line(c->x1, c->y1, c->x1, c->y2, c->color);
+        ref_line(c->x2, c->y1, c->x2, c->y2, c->color);
+        break;
+    case SHAPE_CIRCLE:
+    case SHAPE_FILL_CIRCLE:
+        ref_round(c->x1, c->y1, c->x1, c->y1, c->r, c->color, c->shape == SHAPE_FILL_CIRCLE);
+        break;
+    default:
+        ref_round_rect(c->x1, c->y1, c->x2, c->y2, c->r, c->color, c->shape == SHAPE_FILL_ROUND_RECT);
+        break;
+    }
+}
+
+static void clear(void)
+{
+    int x, y;
+
+    LCD_Fill(0, 0, LCD_W, LCD_H, RASTER_BG);
+    for (y = 0; y < LCD_H; y++)
+        for (x = 0; x < LCD_W; x++) want[y][x] = RASTER_BG;
+    LCD_Flush();
+    rt_thread_mdelay(20);
+    rt_memset(&lcd_stats, 0, sizeof(lcd_stats));
+}
+
+/* 屏幕与期望图像不一致的像素数，第一处不一致时打印用例 */
+static int panel_diff(const char *what, const raster_case_t *c)
+{
+    int x, y, bad = 0;
+
+    LCD_Flush();
+    rt_thread_mdelay(20);
+    for (y = 0; y < LCD_H; y++)
+    {
+        for (x = 0; x < LCD_W; x++)
+        {
+            if (sim_panel_pixel(x, y) == want[y][x]) continue;
+            if (!bad++)
+                printf("%s: %s (%u,%u)-(%u,%u) r=%u: pixel (%d,%d) is %04X, want %04X\n",
+                       what, shape_name[c->shape], c->x1, c->y1, c->x2, c->y2, c->r,
+                       x, y, sim_panel_pixel(x, y), want[y][x]);
+        }
+    }
+    return bad;
+}
+
+/* 单个图形：清屏、绘制、比较，返回不一致的像素数 */
+static int case_run(const char *what, const raster_case_t *c)
+{
+    clear();
+    case_draw(c);
+    case_ref(c);
+    return panel_diff(what, c);
+}
+
+/* 原开机进度条：128 条从 y=100 到屏幕底部的垂直线，逐条画在同一屏上 */
+static void test_progress(void)
+{
+    raster_case_t c = {SHAPE_LINE, 0, 100, 0, LCD_H - 1, 0, RED};
+    int i;
+
+    clear();
+    for (i = 0; i < LCD_W; i++)
+    {
+        c.x1 = c.x2 = i;
+        case_draw(&c);
+        case_ref(&c);
+    }
+    CHECK_EQ(panel_diff("progress", &c), 0);
+#if !LCD_USE_FRAMEBUFFER
+    CHECK_EQ(lcd_stats.windows, LCD_W);
+    CHECK_EQ(lcd_stats.bytes, LCD_W * (11 + (LCD_H - 100) * 2));
+#endif
+}
+
+/* 从中心到四周的线，覆盖八个方向、水平、垂直与陡峭的上行线 */
+static void test_lines(void)
+{
+    raster_case_t c = {SHAPE_LINE, 64, 64, 0, 0, 0, WHITE};
+    int i, bad = 0;
+
+    for (i = 0; i < 4 * 32; i++)
+    {
+        /* 沿屏幕边缘一周取终点，每隔 4 个像素一个 */
+        c.x2 = i < 32 ? i * 4 : i < 64 ? 127 : i < 96 ? 127 - (i - 64) * 4 : 0;
+        c.y2 = i < 32 ? 0 : i < 64 ? (i - 32) * 4 : i < 96 ? 127 : 127 - (i - 96) * 4;
+        bad += case_run("lines", &c) != 0;
+        /* 反向画同一条线 */
+        c.x1 = c.x2; c.y1 = c.y2; c.x2 = 64; c.y2 = 64;
+        bad += case_run("lines", &c) != 0;
+        c.x1 = 64; c.y1 = 64;
+    }
+    CHECK_EQ(bad, 0);
+
+    /* 陡峭上行线：dy > dx 且 y 递减 */
+    {
+        static const raster_case_t steep[] = {
+            {SHAPE_LINE, 10, 120, 20, 5, 0, RED},
+            {SHAPE_LINE, 100, 127, 90, 0, 0, RED},
+            {SHAPE_LINE, 0, 127, 1, 0, 0, RED},
+            {SHAPE_LINE, 60, 90, 61, 89, 0, RED},
+        };
+        for (i = 0; i < (int)(sizeof(steep) / sizeof(steep[0])); i++)
+        {
+            CHECK_EQ(case_run("steep", &steep[i]), 0);
+        }
+    }
+
+#if !LCD_USE_FRAMEBUFFER
+    /* 水平线、垂直线与矩形分别只需 1、1、4 个窗口 */
+    c.x1 = 5; c.y1 = 20; c.x2 = 120; c.y2 = 20;
+    CHECK_EQ(case_run("hline", &c), 0);
+    CHECK_EQ(lcd_stats.windows, 1);
+    c.x1 = 30; c.y1 = 127; c.x2 = 30; c.y2 = 3;
+    CHECK_EQ(case_run("vline", &c), 0);
+    CHECK_EQ(lcd_stats.windows, 1);
+    c.shape = SHAPE_RECT; c.x1 = 10; c.y1 = 10; c.x2 = 100; c.y2 = 80;
+    CHECK_EQ(case_run("rect", &c), 0);
+    CHECK_EQ(lcd_stats.windows, 4);
+#endif
+}
+
+/* 圆与圆角矩形：各种半径、超出屏幕、退化的参数 */
+static void test_round(void)
+{
+    static const raster_case_t fixed[] = {
+        {SHAPE_CIRCLE, 64, 64, 0, 0, 0, YELLOW},
+        {SHAPE_FILL_CIRCLE, 64, 64, 0, 0, 0, YELLOW},
+        {SHAPE_CIRCLE, 0, 0, 0, 0, 30, YELLOW},
+        {SHAPE_FILL_CIRCLE, 127, 127, 0, 0, 30, YELLOW},
+        {SHAPE_FILL_CIRCLE, 10, 64, 0, 0, 100, YELLOW},
+        {SHAPE_CIRCLE, 64, 64, 0, 0, 255, YELLOW},
+        {SHAPE_FILL_CIRCLE, 200, 64, 0, 0, 90, YELLOW},
+        {SHAPE_ROUND_RECT, 10, 10, 117, 60, 8, CYAN},
+        {SHAPE_FILL_ROUND_RECT, 117, 60, 10, 10, 8, CYAN},
+        {SHAPE_ROUND_RECT, 20, 20, 40, 100, 200, CYAN},
+        {SHAPE_FILL_ROUND_RECT, 20, 20, 41, 101, 200, CYAN},
+        {SHAPE_ROUND_RECT, 50, 50, 50, 50, 5, CYAN},
+        {SHAPE_FILL_ROUND_RECT, 50, 50, 51, 90, 5, CYAN},
+        {SHAPE_ROUND_RECT, 100, 100, 200, 180, 12, CYAN},
+        {SHAPE_FILL_ROUND_RECT, 0, 0, 127, 127, 0, CYAN},
+    };
+    int i, r, bad = 0;
+    raster_case_t c = {SHAPE_CIRCLE, 64, 64, 0, 0, 0, MAGENTA};
+
+    for (i = 0; i < (int)(sizeof(fixed) / sizeof(fixed[0])); i++)
+    {
+        CHECK_EQ(case_run("round", &fixed[i]), 0);
+    }
+    for (r = 0; r <= 70; r++)
+    {
+        c.r = r;
+        c.shape = SHAPE_CIRCLE;
+        bad += case_run("circle", &c) != 0;
+        c.shape = SHAPE_FILL_CIRCLE;
+        bad += case_run("circle", &c) != 0;
+    }
+    CHECK_EQ(bad, 0);
+}
+
+/* 随机图形，坐标可超出屏幕，固定种子 */
+static u32 rand_state = 20251220;
+
+static u32 rand_next(u32 n)
+{
+    rand_state = rand_state * 1103515245 + 12345;
+    return (rand_state >> 16) % n;
+}
+
+static void test_random(void)
+{
+    raster_case_t c;
+    int i, bad[SHAPE_NUM] = {0};
+
+    for (i = 0; i < RASTER_RANDOM; i++)
+    {
+        c.shape = rand_next(SHAPE_NUM);
+        c.x1 = rand_next(LCD_W + 40);
+        c.y1 = rand_next(LCD_H + 40);
+        c.x2 = rand_next(LCD_W + 40);
+        c.y2 = rand_next(LCD_H + 40);
+        c.r = rand_next(i % 4 ? 40 : 256);
+        c.color = (u16)rand_next(0xFFFF) + 1;
+        bad[c.shape] += case_run("random", &c) != 0;
+    }
+    for (i = 0; i < SHAPE_NUM; i++)
+    {
+        CHECK_EQ(bad[i], 0);
+    }
+}
+
+static void test_entry(void *parameter)
+{
+    CHECK_EQ(LCD_Init_RTT(), RT_EOK);
+
+    test_progress();
+    test_lines();
+    test_round();
+    test_random();
+
+    sim_exit(TEST_RESULT(LCD_USE_FRAMEBUFFER ? "raster" : "raster_stream"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file    test_rle.c
+ * @brief   压缩图片解码(LCD_ShowImageCompressed，Driver/lcd.c)的主机往返测试
+ * @details 直接包含 lcd.c，以 Driver/pic.h 中的四幅原始 RGB565 图片为基准：
+ *          - 用 LCD_Rle_Row 逐行解码 pic_rle.h 中对应的压缩图片，逐像素比较，并检查数据恰好用完
+ *          - 经 LCD_ShowImageCompressed 与 LCD_Flush 写到 sim_board.c 的屏幕模型，逐像素比较屏幕内容
+ *          - 图片部分超出屏幕时只写可见部分，其余像素保持原样
+ *          sim/SConstruct 把本文件编译两次：test_rle 使用帧缓冲，test_rle_stream 定义
+ *          LCD_USE_FRAMEBUFFER=0，经行缓冲直接发送到屏幕。
+ *          用法：test_rle [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "lcd.c"
+#include "pic.h"
+#include "pic_rle.h"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+#define IMG_NUM     4
+
+static const unsigned char *const raw[IMG_NUM] = {gImage_1, gImage_2, gImage_3, gImage_4};
+static const lcd_image_t *const rle[IMG_NUM] = {&gImage_1_rle, &gImage_2_rle, &gImage_3_rle, &gImage_4_rle};
+
+/* 原始图片 (x, y) 处的像素，高字节在前 */
+static u16 raw_pixel(int i, int x, int y)
+{
+    const unsigned char *p = &raw[i][(y * rle[i]->width + x) * 2];
+
+    return (u16)((p[0] << 8) | p[1]);
+}
+
+/* 解码器：逐行解码并与原始数据比较 */
+static void test_decode(void)
+{
+    u8 row[LCD_W * 2];
+    lcd_rle_t d;
+    int i, y, bad;
+
+    for (i = 0; i < IMG_NUM; i++)
+    {
+        CHECK_EQ(rle[i]->width, 128);
+        CHECK_EQ(rle[i]->height, 128);
+        CHECK(rle[i]->data_size < 32768);
+
+        memset(&d, 0, sizeof(d));
+        d.img = rle[i];
+        d.p = rle[i]->data;
+        d.end = rle[i]->data + rle[i]->data_size;
+        bad = 0;
+        for (y = 0; y < rle[i]->height; y++)
+        {
+            LCD_Rle_Row(&d, row, rle[i]->width);
+            if (memcmp(row, &raw[i][y * rle[i]->width * 2], rle[i]->width * 2)) bad++;
+        }
+        CHECK_EQ(bad, 0);
+        CHECK(d.p == d.end);
+        CHECK_EQ(d.left, 0);
+    }
+}
+
+/* 屏幕上 (x0, y0) 起显示第 i 幅图片，其余像素为 bg，返回不一致的像素数 */
+static int panel_diff(int i, int x0, int y0, u16 bg)
+{
+    int x, y, bad = 0;
+    u16 want;
+
+    for (y = 0; y < LCD_H; y++)
+    {
+        for (x = 0; x < LCD_W; x++)
+        {
+            if (x >= x0 && y >= y0 && x - x0 < rle[i]->width && y - y0 < rle[i]->height)
+                want = raw_pixel(i, x - x0, y - y0);
+            else
+                want = bg;
+            if (sim_panel_pixel(x, y) != want) bad++;
+        }
+    }
+    return bad;
+}
+
+/* 整屏显示：写到屏幕的内容与原始图片一致 */
+static void test_show(void)
+{
+    int i;
+
+    for (i = 0; i < IMG_NUM; i++)
+    {
+        LCD_ShowImageCompressed(0, 0, rle[i]);
+        LCD_Flush();
+        rt_thread_mdelay(20);
+        CHECK_EQ(panel_diff(i, 0, 0, 0), 0);
+    }
+}
+
+/* 部分超出屏幕：可见部分是图片左上角，屏幕其余部分不变 */
+static void test_clip(void)
+{
+    static const struct { u16 x, y; } pos[] = {{40, 70}, {127, 0}, {0, 127}, {100, 100}};
+    int k;
+
+    for (k = 0; k < (int)(sizeof(pos) / sizeof(pos[0])); k++)
+    {
+        LCD_Fill(0, 0, LCD_W, LCD_H, BLUE);
+        LCD_ShowImageCompressed(pos[k].x, pos[k].y, rle[k]);
+        LCD_Flush();
+        rt_thread_mdelay(20);
+        CHECK_EQ(panel_diff(k, pos[k].x, pos[k].y, BLUE), 0);
+    }
+
+    /* 起点在屏幕外时不写入 */
+    LCD_ShowImageCompressed(LCD_W, 0, rle[0]);
+    LCD_ShowImageCompressed(0, LCD_H, rle[0]);
+    LCD_Flush();
+    rt_thread_mdelay(20);
+    CHECK_EQ(panel_diff(3, 100, 100, BLUE), 0);
+}
+
+static void test_entry(void *parameter)
+{
+    CHECK_EQ(LCD_Init_RTT(), RT_EOK);
+
+    test_decode();
+    test_show();
+    test_clip();
+
+    sim_exit(TEST_RESULT(LCD_USE_FRAMEBUFFER ? "rle" : "rle_stream"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
@@ -0,0 +1,363 @@
+/**
+ * @file    test_servo.c
+ * @brief   舵机运动轨迹与门锁状态机(Driver/timer.c)的主机测试
+ * @details 直接包含 timer.c，与 sim_kernel.c、sim_board.c 一起运行在仿真时钟上：
+ *          PWM 模型把每次设置的脉宽与时刻写入 sim_servo_log，测试读回后逐步检查
+ *          - 曲线：梯形与 S 曲线在整个 Q16 定义域内单调、端点为 0 与 1、关于中点对称
+ *          - 轨迹：步数与时间间隔、终点脉宽、速度先增后减；梯形的匀加速段与匀速段，
+ *            S 曲线起止速度接近 0、峰值速度为平均值的 1.875 倍
+ *          - 运动中改变目标：从当前脉宽继续、原回调不调用、重新按周期计时；步数上下限
+ *          - 门锁：请求、到位事件、lock 线程中的通知、自动上锁与中途反向
+ *          用法：test_servo [-v]
+ * @date    2025-12-20
+ */
+
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "timer.c"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+/* ===================== PWM 记录 ===================== */
+
+#define SAMPLE_MAX  256
+
+static struct
+{
+    rt_uint64_t us;
+    rt_uint32_t pulse;
+} sample[SAMPLE_MAX];
+static int samples;
+
+/* 开始记录新的一段 */
+static void pwm_reset(void)
+{
+    if (sim_servo_log != RT_NULL) fclose(sim_servo_log);
+    sim_servo_log = tmpfile();
+    samples = 0;
+}
+
+/* 读回 reset 之后的所有脉宽设置 */
+static void pwm_read(void)
+{
+    unsigned long long us;
+    unsigned pulse, period;
+    int channel;
+
+    samples = 0;
+    fflush(sim_servo_log);
+    rewind(sim_servo_log);
+    while (samples < SAMPLE_MAX &&
+           fscanf(sim_servo_log, "%llu,%d,%u,%u\n", &us, &channel, &pulse, &period) == 4)
+    {
+        sample[samples].us = us;
+        sample[samples].pulse = pulse;
+        samples++;
+    }
+}
+
+/* ===================== 回调记录 ===================== */
+
+static int done_calls[3];
+static rt_uint64_t done_ns[3];
+
+static void done_cb(void *parameter)
+{
+    int id = (int)(rt_ubase_t)parameter;
+
+    CHECK(rt_interrupt_get_nest() > 0);
+    done_calls[id]++;
+    done_ns[id] = sim_now();
+}
+
+static void done_clear(void)
+{
+    memset(done_calls, 0, sizeof(done_calls));
+}
+
+static int notify_calls;
+static rt_uint8_t notify_state;
+static rt_uint64_t notify_ns;
+static char notify_thread[RT_NAME_MAX];
+
+static void notify_cb(rt_uint8_t state)
+{
+    notify_calls++;
+    notify_state = state;
+    notify_ns = sim_now();
+    strncpy(notify_thread, rt_thread_self()->parent.name, sizeof(notify_thread) - 1);
+}
+
+static rt_uint64_t ms_since(rt_uint64_t ns)
+{
+    return (sim_now() - ns) / 1000000;
+}
+
+/* ===================== 曲线 ===================== */
+
+static void test_shape(rt_uint8_t profile)
+{
+    rt_uint32_t u, s, prev = 0;
+    int bad_order = 0, bad_sym = 0;
+
+    CHECK_EQ(servo_shape(profile, 0), 0);
+    CHECK_EQ(servo_shape(profile, SERVO_SHAPE_ONE), SERVO_SHAPE_ONE);
+    for (u = 0; u <= SERVO_SHAPE_ONE; u++)
+    {
+        s = servo_shape(profile, u);
+        bad_order += s < prev || s > SERVO_SHAPE_ONE;
+        /* s(u) + s(1 - u) = 1，Q16 取整误差在几个 LSB 内 */
+        bad_sym += abs((int)(s + servo_shape(profile, SERVO_SHAPE_ONE - u)) - SERVO_SHAPE_ONE) > 4;
+        prev = s;
+    }
+    CHECK_EQ(bad_order, 0);
+    CHECK_EQ(bad_sym, 0);
+}
+
+/* ===================== 轨迹 ===================== */
+
+#define FROM_NS     SERVO_ANGLE_NS(0)
+#define TO_NS       SERVO_ANGLE_NS(90)
+#define STEPS       (400 / SERVO_STEP_MS)
+#define AVG_STEP    ((TO_NS - FROM_NS) / STEPS)
+
+/* 从 0 度转到 90 度，返回每步的脉宽增量 */
+static void run_plan(rt_uint8_t profile, int *d)
+{
+    rt_uint64_t t0;
+    int k, bad_time = 0;
+
+    pwm_reset();
+    done_clear();
+    t0 = sim_now();
+    CHECK_EQ(servo_move(90, 400, profile, done_cb, (void *)0), RT_EOK);
+    CHECK(servo_busy());
+    rt_thread_mdelay(500);
+    CHECK(!servo_busy());
+    pwm_read();
+
+    /* 第一步立即输出，之后每个周期一步，最后一步输出满一个周期后到位 */
+    CHECK_EQ(samples, STEPS);
+    for (k = 0; k < samples; k++)
+    {
+        bad_time += sample[k].us != t0 / 1000 + k * SERVO_STEP_MS * 1000;
+        d[k] = (int)sample[k].pulse - (int)(k ? sample[k - 1].pulse : FROM_NS);
+    }
+    CHECK_EQ(bad_time, 0);
+    CHECK_EQ(sample[STEPS - 1].pulse, TO_NS);
+    CHECK_EQ(done_calls[0], 1);
+    CHECK_EQ((done_ns[0] - t0) / 1000000, 400);
+
+    /* 速度先增后减且对称；Q16 位置的 1 LSB 约为 15ns 脉宽，允许 50ns 的取整误差 */
+    for (k = 0; k < STEPS; k++)
+    {
+        CHECK(d[k] > 0);
+        if (k < STEPS / 2) CHECK(d[k + 1] >= d[k] - 50);
+        CHECK(abs(d[k] - d[STEPS - 1 - k]) <= 50);
+    }
+
+    /* 回到起点 */
+    CHECK_EQ(servo_move(0, 400, profile, RT_NULL, RT_NULL), RT_EOK);
+    rt_thread_mdelay(400);
+}
+
+static void test_trapezoid(void)
+{
+    int d[STEPS], k;
+
+    run_plan(SERVO_PROFILE_TRAPEZOID, d);
+
+    /* 加速段(前 1/3)速度线性增加：s = 9u^2/4，第 k 步增量为 9(2k+1)/4 * AVG_STEP / STEPS */
+    for (k = 0; (k + 1) * 3 <= STEPS; k++)
+    {
+        CHECK(abs(d[k] - 9 * (2 * k + 1) * AVG_STEP / 4 / STEPS) <= 50);
+    }
+    /* 匀速段为平均速度的 1.5 倍 */
+    for (k = (STEPS + 2) / 3; (k + 1) * 3 <= 2 * STEPS; k++)
+    {
+        CHECK(abs(d[k] - 3 * AVG_STEP / 2) <= 50);
+    }
+}
+
+static void test_scurve(void)
+{
+    int d[STEPS], k, peak = 0;
+
+    run_plan(SERVO_PROFILE_SCURVE, d);
+
+    /* 起止速度接近 0：第一步与最后一步小于平均步长的 1/20，梯形约为 1/9 */
+    CHECK(d[0] < AVG_STEP / 20);
+    CHECK(d[STEPS - 1] < AVG_STEP / 20);
+
+    /* 峰值速度 1.875 倍平均速度(离散采样略低) */
+    for (k = 0; k < STEPS; k++)
+    {
+        if (d[k] > peak) peak = d[k];
+    }
+    CHECK(peak > AVG_STEP * 18 / 10 && peak <= AVG_STEP * 1875 / 1000);
+}
+
+static void test_retarget(void)
+{
+    rt_uint64_t t1;
+    rt_uint32_t last;
+    int k, bad_time = 0;
+
+    pwm_reset();
+    done_clear();
+    CHECK_EQ(servo_move(90, 400, SERVO_PROFILE_SCURVE, done_cb, (void *)1), RT_EOK);
+    rt_thread_mdelay(190);
+
+    /* 运动到一半改为 200ms 的梯形动作回到 0 度 */
+    pwm_read();
+    CHECK_EQ(samples, 10);
+    last = sample[samples - 1].pulse;
+    t1 = sim_now();
+    CHECK_EQ(servo_move(0, 200, SERVO_PROFILE_TRAPEZOID, done_cb, (void *)2), RT_EOK);
+    rt_thread_mdelay(600);
+    pwm_read();
+
+    CHECK_EQ(samples, 20);
+    for (k = 10; k < samples; k++)
+    {
+        bad_time += sample[k].us != t1 / 1000 + (k - 10) * SERVO_STEP_MS * 1000;
+    }
+    CHECK_EQ(bad_time, 0);
+    /* 新动作从当前脉宽开始，第一步只走一小段 */
+    CHECK(sample[10].pulse < last && last - sample[10].pulse < 20000);
+    CHECK_EQ(sample[19].pulse, FROM_NS);
+    CHECK_EQ(done_calls[1], 0);
+    CHECK_EQ(done_calls[2], 1);
+    CHECK_EQ((done_ns[2] - t1) / 1000000, 200);
+}
+
+static void test_limits(void)
+{
+    rt_uint64_t t0;
+
+    /* 不足一步按一步：立即输出终点，一个周期后到位 */
+    pwm_reset();
+    done_clear();
+    t0 = sim_now();
+    servo_move(45, 5, SERVO_PROFILE_SCURVE, done_cb, (void *)0);
+    rt_thread_mdelay(100);
+    pwm_read();
+    CHECK_EQ(samples, 1);
+    CHECK_EQ(sample[0].pulse, SERVO_ANGLE_NS(45));
+    CHECK_EQ((done_ns[0] - t0) / 1000000, SERVO_STEP_MS);
+
+    /* 角度上限 180 度 */
+    pwm_reset();
+    servo_move(200, 0, SERVO_PROFILE_TRAPEZOID, RT_NULL, RT_NULL);
+    rt_thread_mdelay(100);
+    pwm_read();
+    CHECK_EQ(sample[0].pulse, PWM_MAX_NS);
+
+    /* 动作时间上限 SERVO_MAX_STEPS 步 */
+    pwm_reset();
+    done_clear();
+    t0 = sim_now();
+    servo_move(0, 5000, SERVO_PROFILE_TRAPEZOID, done_cb, (void *)0);
+    rt_thread_mdelay(3000);
+    pwm_read();
+    CHECK_EQ(samples, SERVO_MAX_STEPS);
+    CHECK_EQ(sample[samples - 1].pulse, FROM_NS);
+    CHECK_EQ((done_ns[0] - t0) / 1000000, SERVO_MAX_STEPS * SERVO_STEP_MS);
+}
+
+/* ===================== 门锁 ===================== */
+
+static void test_lock(void)
+{
+    rt_uint64_t t0;
+
+    lock_set_notify(notify_cb);
+
+    /* 开锁：LOCK_MOVE_MS 后到位，通知在 lock 线程中调用 */
+    notify_calls = 0;
+    t0 = sim_now();
+    CHECK_EQ(lock_request(LOCK_UNLOCKED), RT_EOK);
+    CHECK_EQ(lock_state(), LOCK_UNLOCKING);
+    CHECK_EQ(lock_wait(LOCK_UNLOCKED, 1000), RT_EOK);
+    CHECK_EQ(ms_since(t0), LOCK_MOVE_MS);
+    CHECK_EQ(lock_state(), LOCK_UNLOCKED);
+    rt_thread_mdelay(1);
+    CHECK_EQ(notify_calls, 1);
+    CHECK_EQ(notify_state, LOCK_UNLOCKED);
+    CHECK_STR(notify_thread, "lock");
+    CHECK_EQ((notify_ns - t0) / 1000000, LOCK_MOVE_MS);
+
+    /* 保持 LOCK_HOLD_MS 后自动上锁 */
+    CHECK_EQ(lock_wait(LOCK_LOCKED, LOCK_HOLD_MS + 1000), RT_EOK);
+    CHECK_EQ(ms_since(t0), LOCK_MOVE_MS + LOCK_HOLD_MS + LOCK_MOVE_MS);
+    CHECK_EQ(lock_state(), LOCK_LOCKED);
+    rt_thread_mdelay(1);
+    CHECK_EQ(notify_calls, 2);
+    CHECK_EQ(notify_state, LOCK_LOCKED);
+
+    /* 保持期间再次请求开锁重新计时 */
+    t0 = sim_now();
+    lock_request(LOCK_UNLOCKED);
+    rt_thread_mdelay(LOCK_MOVE_MS + LOCK_HOLD_MS / 2);
+    lock_request(LOCK_UNLOCKED);
+    CHECK_EQ(lock_wait(LOCK_LOCKED, LOCK_HOLD_MS * 2), RT_EOK);
+    CHECK_EQ(ms_since(t0), LOCK_MOVE_MS + LOCK_HOLD_MS / 2 + LOCK_HOLD_MS + LOCK_MOVE_MS);
+
+    /* 开锁途中上锁：立即反向，开锁到位不上报 */
+    notify_calls = 0;
+    t0 = sim_now();
+    lock_request(LOCK_UNLOCKED);
+    rt_thread_mdelay(LOCK_MOVE_MS / 2);
+    lock_request(LOCK_LOCKED);
+    CHECK_EQ(lock_state(), LOCK_LOCKING);
+    CHECK_EQ(lock_wait(LOCK_LOCKED, 1000), RT_EOK);
+    CHECK_EQ(ms_since(t0), LOCK_MOVE_MS / 2 + LOCK_MOVE_MS);
+    CHECK_EQ(lock_wait(LOCK_UNLOCKED, 0), -RT_ETIMEOUT);
+    rt_thread_mdelay(LOCK_HOLD_MS + 1000);
+    CHECK_EQ(notify_calls, 1);
+    CHECK_EQ(notify_state, LOCK_LOCKED);
+    CHECK_EQ(lock_state(), LOCK_LOCKED);
+
+    lock_set_notify(RT_NULL);
+}
+
+/* 测试线程：优先级最高，阻塞时仿真时钟前进，定时器在其间触发 */
+static void test_entry(void *parameter)
+{
+    /* 初始化之前不接受动作请求 */
+    CHECK_EQ(servo_move(90, 400, SERVO_PROFILE_SCURVE, RT_NULL, RT_NULL), -RT_ERROR);
+    CHECK_EQ(lock_request(LOCK_UNLOCKED), -RT_ERROR);
+    CHECK_EQ(lock_wait(LOCK_UNLOCKED, 0), -RT_ERROR);
+
+    /* 上电位置按开锁处理，初始化时转到上锁位置 */
+    TIM2_PWM_Init();
+    CHECK_EQ(lock_wait(LOCK_LOCKED, 1000), RT_EOK);
+    CHECK_EQ(lock_state(), LOCK_LOCKED);
+    rt_thread_mdelay(10);
+
+    test_shape(SERVO_PROFILE_TRAPEZOID);
+    test_shape(SERVO_PROFILE_SCURVE);
+    test_trapezoid();
+    test_scurve();
+    test_retarget();
+    test_limits();
+    test_lock();
+
+    sim_exit(TEST_RESULT("servo"));
+}
+
+int main(int argc, char *argv[])
+{
+    sim_verbose = argc > 1 && !strcmp(argv[1], "-v");
+    setvbuf(stdout, RT_NULL, _IOLBF, 0);
+    sim_start(test_entry, RT_NULL);
+    return 0;
+}
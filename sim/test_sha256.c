@@ -0,0 +1,203 @@
+/**
+ * @file    test_sha256.c
+ * @brief   软件 SHA-256(Driver/sha256.c)与 PIN 哈希路径(Driver/cred.c)的主机测试
+ * @details 直接包含 cred.c(按 RT_USING_FAL 编译)，与 sha256.c 一起在主机上运行：
+ *          - FIPS 180-4 已知答案："abc"、空串、448 位两块消息与一百万个 'a'，
+ *            以及逐字节输入与跨块边界的分段输入
+ *          - cred_schedule() 预先填好的盐值 || PIN 分组经 sha256_block_digest() 一次压缩，
+ *            与 sha256_init/update/final 计算的结果相同
+ *          - cred_equal() 对相同与不同(首字节、末字节、单个位)的输入
+ *          用法：test_sha256
+ * @date    2025-12-20
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+/* 不编译 msh 命令 */
+#undef RT_USING_FINSH
+#include "cred.c"
+
+int sim_verbose = 0;
+
+int app_main(void)
+{
+    return 0;
+}
+
+/* 仿真内核不提供堆，cred_init() 的索引分配使用主机 malloc */
+void *rt_malloc(rt_size_t size)
+{
+    return malloc(size);
+}
+
+void rt_free(void *ptr)
+{
+    free(ptr);
+}
+
+uint32_t HAL_GetUIDw0(void)
+{
+    return 0;
+}
+
+uint32_t HAL_GetUIDw1(void)
+{
+    return 0;
+}
+
+uint32_t HAL_GetUIDw2(void)
+{
+    return 0;
+}
+
+/* 十六进制串转为 32 字节摘要 */
+static void hex_digest(const char *hex, rt_uint8_t *digest)
+{
+    int i;
+
+    for (i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        unsigned v;
+
+        sscanf(hex + 2 * i, "%2x", &v);
+        digest[i] = (rt_uint8_t)v;
+    }
+}
+
+static int digest_is(const rt_uint8_t *digest, const char *hex)
+{
+    rt_uint8_t expect[SHA256_DIGEST_SIZE];
+
+    hex_digest(hex, expect);
+    return memcmp(digest, expect, SHA256_DIGEST_SIZE) == 0;
+}
+
+/* 分 step 字节一段输入，step 为 0 时一次输入 */
+static void sha256(const void *data, rt_size_t len, rt_size_t step, rt_uint8_t *digest)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)data;
+    sha256_ctx_t ctx;
+    rt_size_t n;
+
+    sha256_init(&ctx);
+    if (step == 0) step = len;
+    while (len > 0)
+    {
+        n = len < step ? len : step;
+        sha256_update(&ctx, p, n);
+        p += n;
+        len -= n;
+    }
+    sha256_final(&ctx, digest);
+}
+
+static void test_known_answer(void)
+{
+    static const struct
+    {
+        const char *msg;
+        const char *digest;
+    } kat[] =
+    {
+        {"abc",      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+        {"",         "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+        {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                     "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+    };
+    static const rt_size_t steps[] = {0, 1, 3, 55, 63, 64};
+    rt_uint8_t digest[SHA256_DIGEST_SIZE];
+    rt_uint8_t *million;
+    rt_size_t i, k;
+
+    for (i = 0; i < sizeof(kat) / sizeof(kat[0]); i++)
+    {
+        for (k = 0; k < sizeof(steps) / sizeof(steps[0]); k++)
+        {
+            sha256(kat[i].msg, strlen(kat[i].msg), steps[k], digest);
+            CHECK(digest_is(digest, kat[i].digest));
+        }
+    }
+
+    /* 一百万个 'a'：多块消息，一次输入与不按分组对齐的分段输入 */
+    million = malloc(1000000);
+    memset(million, 'a', 1000000);
+    sha256(million, 1000000, 0, digest);
+    CHECK(digest_is(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+    sha256(million, 1000000, 4097, digest);
+    CHECK(digest_is(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+    free(million);
+}
+
+static void test_block_digest(void)
+{
+    rt_uint8_t pin[CRED_PIN_LEN];
+    rt_uint8_t fast[SHA256_DIGEST_SIZE], ref[SHA256_DIGEST_SIZE];
+    sha256_ctx_t ctx;
+    int i, j, salt;
+
+    /* 盐值 || PIN 共 CRED_MSG_LEN 字节，填充后正好一个分组 */
+    CHECK(CRED_MSG_LEN + 1 + 8 <= SHA256_BLOCK_SIZE);
+
+    for (salt = 0; salt < 4; salt++)
+    {
+        for (j = 0; j < CRED_SALT_LEN; j++) cred_head.salt[j] = (rt_uint8_t)(salt * 61 + j * 17);
+        cred_schedule();
+        for (i = 0; i < 1000; i++)
+        {
+            for (j = 0; j < CRED_PIN_LEN; j++) pin[j] = (rt_uint8_t)((i * 7 + j * 3 + salt) % 10);
+            cred_hash_sw(pin, fast);
+
+            sha256_init(&ctx);
+            sha256_update(&ctx, cred_head.salt, CRED_SALT_LEN);
+            sha256_update(&ctx, pin, CRED_PIN_LEN);
+            sha256_final(&ctx, ref);
+            CHECK(memcmp(fast, ref, SHA256_DIGEST_SIZE) == 0);
+        }
+    }
+
+    /* 分组中的盐值部分不被校验改写 */
+    CHECK(memcmp(cred_block, cred_head.salt, CRED_SALT_LEN) == 0);
+}
+
+static void test_equal(void)
+{
+    rt_uint8_t a[CRED_HASH_LEN], b[CRED_HASH_LEN];
+    int i, bit;
+
+    for (i = 0; i < CRED_HASH_LEN; i++) a[i] = b[i] = (rt_uint8_t)(i * 37 + 5);
+    CHECK_EQ(cred_equal(a, b, CRED_HASH_LEN), 1);
+    CHECK_EQ(cred_equal(a, a, CRED_HASH_LEN), 1);
+    CHECK_EQ(cred_equal(a, b, 0), 1);
+
+    b[0] ^= 0x80;
+    CHECK_EQ(cred_equal(a, b, CRED_HASH_LEN), 0);
+    b[0] ^= 0x80;
+    b[CRED_HASH_LEN - 1] ^= 0x01;
+    CHECK_EQ(cred_equal(a, b, CRED_HASH_LEN), 0);
+    CHECK_EQ(cred_equal(a, b, CRED_HASH_LEN - 1), 1);
+    b[CRED_HASH_LEN - 1] ^= 0x01;
+
+    for (i = 0; i < CRED_HASH_LEN; i++)
+    {
+        for (bit = 0; bit < 8; bit++)
+        {
+            b[i] ^= (rt_uint8_t)(1 << bit);
+            CHECK_EQ(cred_equal(a, b, CRED_HASH_LEN), 0);
+            b[i] ^= (rt_uint8_t)(1 << bit);
+        }
+    }
+
+    /* 内置 PIN 的比较使用同一函数 */
+    CHECK_EQ(cred_equal(cred_default_pin, cred_default_pin, CRED_PIN_LEN), 1);
+}
+
+int main(int argc, char *argv[])
+{
+    test_known_answer();
+    test_block_digest();
+    test_equal();
+
+    return TEST_RESULT("sha256");
+}
@@ -0,0 +1,675 @@
+/**
+ * @file    test_spi.c
+ * @brief   SPI DMA 驱动(libraries/drivers/drv_spi.c)的主机测试
+ * @details 直接包含 drv_spi.c 与 SPI 框架 spi_core.c，HAL、设备注册、互斥量、完成量与 DMA 缓冲服务
+ *          由本文件中的替身代替：
+ *          - HAL_SPI_xxx_DMA 只记录启动的传输，完成中断在 rt_completion_wait() 中按脚本触发：
+ *            正常完成、带错误码完成(HAL_SPI_ErrorCallback)或不触发(等待超时)
+ *          - 片选、GPIO 副作用、DMA 启动、轮询传输与中止依次记入操作记录，与期望的序列逐字比较
+ *          - DMA 缓冲替身记录未释放的映射，每个用例结束时必须为 0
+ *          覆盖 spixfer 的 DMA、轮询、64KB 拆分、错误、超时与启动失败路径，
+ *          rt_hw_spi_dma_submit/poll/wait，消息链的正常完成、中途出错、超时与退回框架的条件，
+ *          以及框架 rt_spi_transfer_chain 逐段发送时遇到失败段立即停止。
+ *          用法：test_spi [-v]，-v 同时输出驱动的日志
+ * @date    2025-12-20
+ */
+
+#include <rtthread.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+
+#include "drv_spi.c"
+/* 两个文件各自定义日志标签，rtdbg.h 只展开一次，框架的日志沿用驱动的标签 */
+#undef DBG_TAG
+#undef DBG_LVL
+#include "spi_core.c"
+
+/* ===================== 操作记录 ===================== */
+
+static char test_log[1024];
+static int test_verbose;
+
+static void log_add(const char *fmt, ...)
+{
+    size_t n = strlen(test_log);
+    va_list ap;
+
+    if (n != 0 && n < sizeof(test_log) - 1) test_log[n++] = ' ';
+    va_start(ap, fmt);
+    vsnprintf(test_log + n, sizeof(test_log) - n, fmt, ap);
+    va_end(ap);
+}
+
+/* ===================== 中断脚本 ===================== */
+
+#define IRQ_OK      0       /* 传输正常完成 */
+#define IRQ_ERROR   1       /* 带错误码完成，经 HAL_SPI_ErrorCallback 通知 */
+#define IRQ_HANG    2       /* 不再产生中断 */
+
+static int dma_started;                 /* 本用例中启动的 DMA 传输数 */
+static int dma_pending;                 /* 最近一次启动的传输尚未完成 */
+static void (*dma_callback)(SPI_HandleTypeDef *hspi);
+static int fail_at = -1;                /* 第几次 DMA 传输按 fail_kind 结束 */
+static int fail_kind;
+static int refuse_at = -1;              /* 第几次 DMA 启动返回 HAL_BUSY */
+static int cpt_done;
+
+/* 按脚本结束正在进行的传输，完成回调中可能启动下一段 */
+static void dma_fire(SPI_HandleTypeDef *hspi)
+{
+    int index = dma_started - 1;
+
+    dma_pending = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    if (index == fail_at && fail_kind == IRQ_ERROR)
+    {
+        hspi->ErrorCode = HAL_SPI_ERROR_OVR;
+        HAL_SPI_ErrorCallback(hspi);
+        return;
+    }
+    dma_callback(hspi);
+}
+
+void rt_completion_init(struct rt_completion *completion)
+{
+    cpt_done = 0;
+}
+
+void rt_completion_done(struct rt_completion *completion)
+{
+    cpt_done = 1;
+}
+
+/* 单线程中的等待：依次触发挂起的中断，直到完成或脚本要求挂起；timeout 为 0 时不触发 */
+rt_err_t rt_completion_wait(struct rt_completion *completion, rt_int32_t timeout)
+{
+    while (!cpt_done && dma_pending && timeout != 0)
+    {
+        if (dma_started - 1 == fail_at && fail_kind == IRQ_HANG) break;
+        dma_fire(&spi_bus_obj[0].handle);
+    }
+    if (!cpt_done) return -RT_ETIMEOUT;
+    cpt_done = 0;
+    return RT_EOK;
+}
+
+/* ===================== HAL 替身 ===================== */
+
+static HAL_StatusTypeDef dma_start(SPI_HandleTypeDef *hspi, const char *kind, uint16_t size,
+                                   void (*callback)(SPI_HandleTypeDef *hspi))
+{
+    if (dma_started == refuse_at)
+    {
+        refuse_at = -1;
+        log_add("busy");
+        hspi->State = HAL_SPI_STATE_BUSY;
+        return HAL_BUSY;
+    }
+    log_add("%s%u", kind, size);
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    dma_callback = callback;
+    dma_pending = 1;
+    dma_started++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size)
+{
+    return dma_start(hspi, "dma", Size, HAL_SPI_TxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    return dma_start(hspi, "rxdma", Size, HAL_SPI_RxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                              uint16_t Size)
+{
+    return dma_start(hspi, "txrxdma", Size, HAL_SPI_TxRxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    log_add("tx%u", Size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    log_add("rx%u", Size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                          uint16_t Size, uint32_t Timeout)
+{
+    log_add("txrx%u", Size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
+{
+    log_add("abort");
+    dma_pending = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *const hdma)
+{
+    return HAL_OK;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+uint32_t HAL_RCC_GetSysClockFreq(void)
+{
+    return 600000000;
+}
+
+#define TEST_CS_PIN     GPIO_PIN_6
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (GPIO_Pin == TEST_CS_PIN) log_add("cs%d", PinState == GPIO_PIN_SET);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+void rt_pin_port_write(rt_base_t port, rt_uint32_t set_mask, rt_uint32_t clr_mask)
+{
+    log_add("io+%x-%x", set_mask, clr_mask);
+}
+
+/* ===================== DMA 缓冲替身 ===================== */
+
+/* 当作 XIP 中的常量：DMA 不能直接读取，需要弹跳复制 */
+static rt_uint8_t xip_data[64];
+static rt_uint8_t bounce_buf[DMABUF_MAX_SIZE];
+static int maps_live;                   /* 尚未释放的映射 */
+static int pool_empty;                  /* 弹跳缓冲分配失败 */
+
+rt_bool_t rt_hw_dmabuf_direct(const void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align)
+{
+    return (const rt_uint8_t *)buf < xip_data || (const rt_uint8_t *)buf >= xip_data + sizeof(xip_data);
+}
+
+rt_size_t rt_hw_dmabuf_map(struct rt_dmabuf_map *map, void *buf, rt_size_t len, rt_uint8_t dir, rt_size_t align)
+{
+    map->buf = buf;
+    map->dir = dir;
+    map->len = len;
+    map->dma = buf;
+    map->bounce = 0;
+    if (!rt_hw_dmabuf_direct(buf, len, dir, align))
+    {
+        if (pool_empty)
+        {
+            map->len = 0;
+            return 0;
+        }
+        if (map->len > DMABUF_MAX_SIZE) map->len = DMABUF_MAX_SIZE;
+        map->dma = bounce_buf;
+        map->bounce = 1;
+    }
+    maps_live++;
+    return map->len;
+}
+
+void rt_hw_dmabuf_unmap(struct rt_dmabuf_map *map)
+{
+    if (map->len == 0) return;
+    map->len = 0;
+    maps_live--;
+}
+
+/* ===================== RT-Thread 替身 ===================== */
+
+static struct rt_spi_bus *test_bus;
+
+rt_err_t rt_spi_bus_device_init(struct rt_spi_bus *bus, const char *name)
+{
+    test_bus = bus;
+    return RT_EOK;
+}
+
+rt_err_t rt_spidev_device_init(struct rt_spi_device *dev, const char *name)
+{
+    return RT_EOK;
+}
+
+rt_device_t rt_device_find(const char *name)
+{
+    return RT_NULL;
+}
+
+void rt_pin_mode(rt_base_t pin, rt_uint8_t mode)
+{
+}
+
+void rt_pin_write(rt_base_t pin, rt_ssize_t value)
+{
+}
+
+/* 单线程运行，总线锁不需要实际加锁 */
+rt_err_t rt_mutex_init(rt_mutex_t mutex, const char *name, rt_uint8_t flag)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_release(rt_mutex_t mutex)
+{
+    return RT_EOK;
+}
+
+void *rt_malloc(rt_size_t size)
+{
+    return malloc(size);
+}
+
+void *rt_memset(void *s, int c, rt_ubase_t count)
+{
+    return memset(s, c, count);
+}
+
+rt_base_t rt_hw_interrupt_disable(void)
+{
+    return 0;
+}
+
+void rt_hw_interrupt_enable(rt_base_t level)
+{
+}
+
+rt_tick_t rt_tick_from_millisecond(rt_int32_t ms)
+{
+    return ms;
+}
+
+int rt_kprintf(const char *fmt, ...)
+{
+    va_list ap;
+    int n = 0;
+
+    if (test_verbose)
+    {
+        va_start(ap, fmt);
+        n = vprintf(fmt, ap);
+        va_end(ap);
+    }
+    return n;
+}
+
+void rt_assert_handler(const char *ex, const char *func, rt_size_t line)
+{
+    printf("assertion %s failed at %s:%u\n", ex, func, (unsigned)line);
+    abort();
+}
+
+/* ===================== 用例 ===================== */
+
+static struct stm32_spi *spi;
+static struct rt_spi_device dev;
+static struct stm32_hw_spi_cs cs;
+static rt_uint8_t tx[70000];
+static rt_uint8_t rx[64];
+
+/* 配置总线，dma_flag 为 SPI_USING_xx_DMA_FLAG 的组合 */
+static void setup(rt_uint8_t dma_flag)
+{
+    static SPI_TypeDef fake_spi;
+    static struct dma_config fake_dma;
+    static struct rt_spi_configuration cfg;
+
+    spi->spi_dma_flag = dma_flag;
+    spi->config->dma_tx = &fake_dma;
+    spi->config->dma_rx = &fake_dma;
+    spi->handle.Instance = &fake_spi;  /* 寄存器访问落在普通内存上 */
+    cfg.data_width = 8;
+    cfg.mode = RT_SPI_MASTER | RT_SPI_MODE_0 | RT_SPI_MSB;
+    cfg.max_hz = 20 * 1000 * 1000;
+    CHECK_EQ(test_bus->ops->configure(&dev, &cfg), RT_EOK);
+    test_bus->owner = &dev;             /* 框架不再重新配置总线 */
+
+    test_log[0] = '\0';
+    dma_started = 0;
+    dma_pending = 0;
+    fail_at = -1;
+    refuse_at = -1;
+    pool_empty = 0;
+}
+
+/* 每个用例结束时：没有进行中的传输与未释放的映射 */
+static void teardown(void)
+{
+    CHECK_EQ(maps_live, 0);
+    CHECK_EQ(spi->dma_busy, 0);
+    CHECK(spi->chain == RT_NULL);
+    CHECK_EQ(spi->handle.State, HAL_SPI_STATE_READY);
+}
+
+static rt_ssize_t xfer(const void *send_buf, void *recv_buf, rt_size_t length)
+{
+    struct rt_spi_message msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.send_buf = send_buf;
+    msg.recv_buf = recv_buf;
+    msg.length = length;
+    msg.cs_take = 1;
+    msg.cs_release = 1;
+    return test_bus->ops->xfer(&dev, &msg);
+}
+
+static void test_xfer(void)
+{
+    /* 发送走 DMA，等待完成中断 */
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 100);
+    CHECK_STR(test_log, "cs0 dma100 cs1");
+    teardown();
+
+    /* HAL 单次最多 65535 字节，超出部分拆成多段 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    CHECK_EQ(xfer(tx, RT_NULL, 70000), 70000);
+    CHECK_STR(test_log, "cs0 dma65535 dma4465 cs1");
+    teardown();
+
+    /* 收发与只接收 */
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    CHECK_EQ(xfer(tx, rx, 16), 16);
+    CHECK_EQ(xfer(RT_NULL, rx, 16), 16);
+    CHECK_STR(test_log, "cs0 txrxdma16 cs1 cs0 rxdma16 cs1");
+    teardown();
+
+    /* 没有 DMA 的总线、弹跳缓冲分配失败时轮询发送 */
+    setup(0);
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 100);
+    CHECK_STR(test_log, "cs0 tx100 cs1");
+    teardown();
+
+    setup(SPI_USING_TX_DMA_FLAG);
+    pool_empty = 1;
+    CHECK_EQ(xfer(xip_data, RT_NULL, sizeof(xip_data)), sizeof(xip_data));
+    CHECK_STR(test_log, "cs0 tx64 cs1");
+    teardown();
+}
+
+static void test_xfer_fail(void)
+{
+    /* 完成中断带错误码：返回 0 而不是请求的长度 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    fail_at = 0;
+    fail_kind = IRQ_ERROR;
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 0);
+    CHECK_STR(test_log, "cs0 dma100 cs1");
+    teardown();
+
+    /* 超时：中止传输，仍然释放片选 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    fail_at = 0;
+    fail_kind = IRQ_HANG;
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 0);
+    CHECK_STR(test_log, "cs0 dma100 abort cs1");
+    teardown();
+
+    /* HAL 拒绝启动 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    refuse_at = 0;
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 0);
+    CHECK_STR(test_log, "cs0 busy cs1");
+    teardown();
+
+    /* 错误码只影响出错的那次传输 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    fail_at = 0;
+    fail_kind = IRQ_ERROR;
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 0);
+    CHECK_EQ(xfer(tx, RT_NULL, 100), 100);
+    teardown();
+}
+
+static void test_submit(void)
+{
+    /* 提交后立即返回，poll 与 wait(0) 不改变状态，wait 等到完成 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_poll(&dev), RT_FALSE);
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), -RT_EBUSY);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, 0), -RT_ETIMEOUT);
+    CHECK_EQ(rt_hw_spi_dma_poll(&dev), RT_FALSE);
+    CHECK_EQ(maps_live, 1);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, RT_WAITING_FOREVER), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_poll(&dev), RT_TRUE);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, RT_WAITING_FOREVER), RT_EOK);  /* 空闲时直接返回 */
+    CHECK_STR(test_log, "dma100");
+    teardown();
+
+    /* 错误码由 wait 报告，下一次传输清除 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    fail_at = 0;
+    fail_kind = IRQ_ERROR;
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, RT_WAITING_FOREVER), -RT_EIO);
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, RT_WAITING_FOREVER), RT_EOK);
+    teardown();
+
+    /* 超时：中止并释放弹跳缓冲，总线可以继续使用 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    fail_at = 0;
+    fail_kind = IRQ_HANG;
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, xip_data, sizeof(xip_data)), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_wait(&dev, 100), -RT_ETIMEOUT);
+    CHECK_EQ(rt_hw_spi_dma_poll(&dev), RT_TRUE);
+    CHECK_STR(test_log, "dma64 abort");
+    teardown();
+
+    /* HAL 拒绝启动 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    refuse_at = 0;
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), -RT_EIO);
+    teardown();
+
+    /* 没有 DMA 或无法映射时同步发送，返回时已经完成 */
+    setup(0);
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, tx, 100), RT_EOK);
+    CHECK_EQ(rt_hw_spi_dma_poll(&dev), RT_TRUE);
+    CHECK_STR(test_log, "tx100");
+    teardown();
+
+    setup(SPI_USING_TX_DMA_FLAG);
+    pool_empty = 1;
+    CHECK_EQ(rt_hw_spi_dma_submit(&dev, xip_data, sizeof(xip_data)), RT_EOK);
+    CHECK_STR(test_log, "tx64");
+    teardown();
+}
+
+#define DC_MASK     0x40
+
+/* 组成与 LCD 地址窗口相同形状的链：命令(DC 低、取片选)、参数(DC 高)、像素(释放片选) */
+static struct rt_spi_chain_message chain[4];
+
+static void chain_setup(rt_size_t pixels)
+{
+    static rt_uint8_t cmd[2];
+
+    memset(chain, 0, sizeof(chain));
+    chain[0].parent.send_buf = &cmd[0];
+    chain[0].parent.length = 1;
+    chain[0].parent.cs_take = 1;
+    chain[0].gpio_clr_mask = DC_MASK;
+    chain[0].parent.next = &chain[1].parent;
+    chain[1].parent.send_buf = tx;
+    chain[1].parent.length = 4;
+    chain[1].gpio_set_mask = DC_MASK;
+    chain[1].parent.next = &chain[2].parent;
+    chain[2].parent.send_buf = &cmd[1];
+    chain[2].parent.length = 1;
+    chain[2].gpio_clr_mask = DC_MASK;
+    chain[2].parent.next = &chain[3].parent;
+    chain[3].parent.send_buf = tx;
+    chain[3].parent.length = pixels;
+    chain[3].parent.cs_release = 1;
+    chain[3].gpio_set_mask = DC_MASK;
+}
+
+static void test_chain(void)
+{
+    /* 每段完成中断启动下一段，GPIO 副作用在该段发送前写入 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(70000);
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 4);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 dma4 io+0-40 dma1 io+40-0 dma65535 dma4465 cs1");
+    teardown();
+
+    /* 只有副作用、没有数据的段 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.length = 0;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 4);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 io+0-40 dma1 io+40-0 dma8 cs1");
+    teardown();
+
+    /* 第二段出错：返回已完成的段数并释放片选 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    fail_at = 1;
+    fail_kind = IRQ_ERROR;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 1);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 dma4 cs1");
+    teardown();
+
+    /* 第二段超时：先从中断手中取走链再中止 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    fail_at = 1;
+    fail_kind = IRQ_HANG;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 1);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 dma4 abort cs1");
+    teardown();
+
+    /* 第一段就无法启动 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    refuse_at = 0;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 0);
+    CHECK_STR(test_log, "io+0-40 cs0 busy cs1");
+    teardown();
+
+    /* 之后的传输不受影响 */
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), 4);
+    teardown();
+}
+
+static void test_chain_fallback(void)
+{
+    /* 以下情况不发送任何数据，交给 SPI 框架逐段处理 */
+    setup(0);
+    chain_setup(8);
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), -RT_ENOSYS);
+
+    setup(SPI_USING_TX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.recv_buf = rx;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), -RT_ENOSYS);
+
+    chain_setup(8);
+    chain[2].parent.send_buf = xip_data;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), -RT_ENOSYS);
+
+    chain_setup(8);
+    chain[3].parent.send_buf = RT_NULL;
+    CHECK_EQ(test_bus->ops->xfer_chain(&dev, chain), -RT_ENOSYS);
+
+    CHECK_STR(test_log, "");
+    teardown();
+}
+
+static void test_transfer_chain(void)
+{
+    /* 驱动不能整链提交时由框架逐段发送：先写 GPIO 副作用，再发送该段 */
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.recv_buf = rx;
+    CHECK(rt_spi_transfer_chain(&dev, chain) == RT_NULL);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 txrxdma4 io+0-40 dma1 io+40-0 dma8 cs1");
+    teardown();
+
+    /* 第二段出错时 spixfer 返回 0：停在该段，不再切换 DC、不发送像素 */
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.recv_buf = rx;
+    fail_at = 1;
+    fail_kind = IRQ_ERROR;
+    CHECK(rt_spi_transfer_chain(&dev, chain) == &chain[1]);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 txrxdma4");
+    teardown();
+
+    /* 超时与启动失败同样停在出错的段 */
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.recv_buf = rx;
+    fail_at = 1;
+    fail_kind = IRQ_HANG;
+    CHECK(rt_spi_transfer_chain(&dev, chain) == &chain[1]);
+    CHECK_STR(test_log, "io+0-40 cs0 dma1 io+40-0 txrxdma4 abort");
+    teardown();
+
+    setup(SPI_USING_TX_DMA_FLAG | SPI_USING_RX_DMA_FLAG);
+    chain_setup(8);
+    chain[1].parent.recv_buf = rx;
+    refuse_at = 0;
+    CHECK(rt_spi_transfer_chain(&dev, chain) == &chain[0]);
+    CHECK_STR(test_log, "io+0-40 cs0 busy");
+    teardown();
+}
+
+int main(int argc, char *argv[])
+{
+    test_verbose = argc > 1 && !strcmp(argv[1], "-v");
+
+    rt_hw_spi_init();
+    CHECK(test_bus != RT_NULL);
+    if (test_bus == RT_NULL) return TEST_RESULT("spi");
+
+    spi = rt_container_of(test_bus, struct stm32_spi, spi_bus);
+    cs.GPIOx = GPIOF;
+    cs.GPIO_Pin = TEST_CS_PIN;
+    dev.bus = test_bus;
+    dev.parent.user_data = &cs;
+
+    test_xfer();
+    test_xfer_fail();
+    test_submit();
+    test_chain();
+    test_chain_fallback();
+    test_transfer_chain();
+
+    return TEST_RESULT("spi");
+}
@@ -0,0 +1,312 @@
+/**
+ * @file    timer_bench.c
+ * @brief   内核定时器后端的主机基准测试
+ * @details 把 rt-thread/src/timer.c 原样编译到主机上，比较跳表(RT_TIMER_SKIP_LIST_LEVEL 1~4)
+ *          与时间轮(RT_USING_TIMER_WHEEL)在不同活动定时器数量下的开销：
+ *          - start：重启一个已在运行的定时器(先移除再插入，按键消抖等场景的典型用法)
+ *          - stop：停止一个运行中的定时器
+ *          - expiry：逐个节拍调用 rt_timer_check()，按到期次数平均，含周期定时器的重新插入
+ *          定时器周期按 1/3 短(1~50 节拍)、1/3 中(50~2000)、1/3 长(2000~60000)分布，
+ *          对应消抖/动画、自动上锁、背光与审计刷新这类定时器。
+ *
+ *          expiry 阶段每个节拍还随机重启一个定时器，所有到期的(节拍, 定时器)对累加成校验和，
+ *          各后端的校验和必须相同，用于确认时间轮与跳表的到期时刻一致。第二个校验和来自
+ *          不计时的一轮，每次检查前节拍前进 1~64 个(与软定时器线程晚醒的情况相同)。
+ *
+ *          sim/SConstruct 为每种后端各编译一个程序(timer_bench_skip1 ~ timer_bench_skip4、
+ *          timer_bench_wheel)，用法：timer_bench_xxx [定时器数...]，默认 10 100 1000。
+ *          内核的其它部分由本文件末尾的替身代替，只计入定时器代码本身的开销。
+ * @date    2025-12-20
+ */
+
+/* rtconfig_preinc.h 把 _POSIX_C_SOURCE 定义为 1，clock_gettime() 需要 199309 */
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE     199309L
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_TIMER_MAX     1000
+#ifndef BENCH_TICKS
+#define BENCH_TICKS         20000       /* expiry 阶段运行的节拍数 */
+#endif
+#define BENCH_OPS           200000      /* start/stop 阶段的操作次数 */
+
+#ifdef RT_USING_TIMER_WHEEL
+#define BENCH_BACKEND       "wheel"
+#else
+#define BENCH_BACKEND       "skip" RT_STRINGIFY(RT_TIMER_SKIP_LIST_LEVEL)
+#endif
+
+static struct rt_timer bench_timer[BENCH_TIMER_MAX];
+static rt_tick_t bench_tick;
+static rt_uint32_t bench_seed;
+static rt_uint32_t bench_fired;
+static rt_uint32_t bench_sum;
+
+static rt_uint32_t bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return bench_seed >> 8;
+}
+
+static double bench_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_timeout(void *parameter)
+{
+    rt_uint32_t id = (rt_uint32_t)(rt_ubase_t)parameter;
+
+    bench_fired++;
+    bench_sum += (bench_tick * 2654435761u) ^ (id * 40503u);
+}
+
+static rt_tick_t bench_period(int i)
+{
+    switch (i % 3)
+    {
+    case 0:  return 1 + bench_rand() % 50;
+    case 1:  return 50 + bench_rand() % 1950;
+    default: return 2000 + bench_rand() % 58000;
+    }
+}
+
+/* 从节拍 0 开始启动 n 个周期定时器 */
+static void bench_setup(int n)
+{
+    int i;
+
+    bench_seed = 1;
+    bench_tick = 0;
+    bench_fired = 0;
+    bench_sum = 0;
+    rt_system_timer_init();
+
+    for (i = 0; i < n; i++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "t%d", i);
+        rt_timer_init(&bench_timer[i], name, bench_timeout, (void *)(rt_ubase_t)i,
+                      bench_period(i), RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+        rt_timer_start(&bench_timer[i]);
+    }
+}
+
+static void bench_teardown(int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        rt_timer_detach(&bench_timer[i]);
+    }
+}
+
+/* 运行 BENCH_TICKS 个节拍，每次检查前节拍前进 1~step 个并随机重启一个定时器 */
+static void bench_expire(int n, rt_uint32_t step)
+{
+    rt_tick_t end = bench_tick + BENCH_TICKS;
+
+    while (bench_tick != end)
+    {
+        rt_tick_t delta = step > 1 ? 1 + bench_rand() % step : 1;
+
+        bench_tick += delta < end - bench_tick ? delta : end - bench_tick;
+        rt_timer_start(&bench_timer[bench_rand() % n]);
+        rt_timer_check();
+    }
+}
+
+static void bench_run(int n)
+{
+    double t0, t_expiry, t_start, t_stop;
+    rt_uint32_t fired, sum;
+    int i, k;
+
+    bench_setup(n);
+    bench_expire(n, 64);
+    sum = bench_sum;
+    bench_teardown(n);
+
+    /* expiry：时间包括每个节拍中的一次随机重启，运行后再单独扣除 */
+    bench_setup(n);
+    t0 = bench_ns();
+    bench_expire(n, 1);
+    t_expiry = bench_ns() - t0;
+    fired = bench_fired;
+
+    t0 = bench_ns();
+    for (k = 0; k < BENCH_OPS; k++)
+    {
+        rt_timer_start(&bench_timer[bench_rand() % n]);
+    }
+    t_start = (bench_ns() - t0) / BENCH_OPS;
+    t_expiry -= t_start * BENCH_TICKS;
+
+    /* stop：每轮停止一半定时器后全部重新启动，只计停止的时间 */
+    t_stop = 0;
+    for (k = 0; k < BENCH_OPS; k += n / 2 + 1)
+    {
+        int base = bench_rand() % n;
+
+        t0 = bench_ns();
+        for (i = 0; i <= n / 2; i++)
+        {
+            rt_timer_stop(&bench_timer[(base + i * 7) % n]);
+        }
+        t_stop += bench_ns() - t0;
+        for (i = 0; i <= n / 2; i++)
+        {
+            rt_timer_start(&bench_timer[(base + i * 7) % n]);
+        }
+    }
+    t_stop /= (BENCH_OPS / (n / 2 + 1) + 1) * (n / 2 + 1);
+
+    printf("%-6s %6d %9.1f %9.1f %9.1f %10.1f %9u  %08x %08x\n", BENCH_BACKEND, n, t_start, t_stop,
+           fired ? t_expiry / fired : 0.0, t_expiry / BENCH_TICKS, fired, bench_sum, sum);
+    bench_teardown(n);
+}
+
+int main(int argc, char **argv)
+{
+    static const int def[] = {10, 100, 1000};
+    int i, n;
+
+    printf("%-6s %6s %9s %9s %9s %10s %9s  %s\n", "list", "timers", "start ns", "stop ns",
+           "expiry ns", "tick ns", "expired", "checksum step1/step64");
+    for (i = 0; i < (argc > 1 ? argc - 1 : 3); i++)
+    {
+        n = argc > 1 ? atoi(argv[i + 1]) : def[i];
+        if (n < 1 || n > BENCH_TIMER_MAX)
+        {
+            fprintf(stderr, "timer count must be 1 to %d\n", BENCH_TIMER_MAX);
+            return 1;
+        }
+        bench_run(n);
+    }
+    return 0;
+}
+
+/* ===================== 内核替身 ===================== */
+
+void (*rt_object_take_hook)(struct rt_object *object);
+void (*rt_object_put_hook)(struct rt_object *object);
+
+rt_tick_t rt_tick_get(void)
+{
+    return bench_tick;
+}
+
+/* rt_timer_check() 只能在节拍中断中调用 */
+rt_uint8_t rt_interrupt_get_nest(void)
+{
+    return 1;
+}
+
+rt_base_t rt_hw_interrupt_disable(void)
+{
+    return 0;
+}
+
+void rt_hw_interrupt_enable(rt_base_t level)
+{
+}
+
+int __rt_ffs(int value)
+{
+    return __builtin_ffs(value);
+}
+
+void rt_assert_handler(const char *ex, const char *func, rt_size_t line)
+{
+    fprintf(stderr, "assert (%s) in %s:%d\n", ex, func, (int)line);
+    abort();
+}
+
+void rt_object_init(struct rt_object *object, enum rt_object_class_type type, const char *name)
+{
+    object->type = type | RT_Object_Class_Static;
+    strncpy(object->name, name, RT_NAME_MAX - 1);
+}
+
+void rt_object_detach(rt_object_t object)
+{
+    object->type = RT_Object_Class_Null;
+}
+
+rt_object_t rt_object_allocate(enum rt_object_class_type type, const char *name)
+{
+    return RT_NULL;
+}
+
+void rt_object_delete(rt_object_t object)
+{
+}
+
+rt_bool_t rt_object_is_systemobject(rt_object_t object)
+{
+    return (object->type & RT_Object_Class_Static) ? RT_TRUE : RT_FALSE;
+}
+
+rt_uint8_t rt_object_get_type(rt_object_t object)
+{
+    return object->type & ~RT_Object_Class_Static;
+}
+
+rt_err_t rt_sched_lock(rt_sched_lock_level_t *plvl)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_sched_unlock(rt_sched_lock_level_t level)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_sched_thread_timer_start(struct rt_thread *thread)
+{
+    return RT_EOK;
+}
+
+/* 软定时器线程不运行，基准只使用硬定时器 */
+rt_err_t rt_sem_init(rt_sem_t sem, const char *name, rt_uint32_t value, rt_uint8_t flag)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_release(rt_sem_t sem)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_control(rt_sem_t sem, int cmd, void *arg)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_thread_init(struct rt_thread *thread, const char *name, void (*entry)(void *parameter),
+                        void *parameter, void *stack_start, rt_uint32_t stack_size,
+                        rt_uint8_t priority, rt_uint32_t tick)
+{
+    return RT_EOK;
+}
+
+rt_err_t rt_thread_startup(rt_thread_t thread)
+{
+    return RT_EOK;
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2006-2025, RT-Thread Development Team
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Change Logs:
+# Date           Author       Notes
+# 2025-12-20     Voyager      the first version
+#
+"""
+汉字字库索引生成工具：扫描字库头文件中的 tfont16/tfont24/tfont32 数组，
+按字符的 Unicode 码点排序生成索引表，供 Driver/lcd.c 二分查找字模。
+
+源文件与字库均为 UTF-8 编码，字库条目的 Index 字段即字符本身。
+增删字库中的汉字后需重新执行：
+  python tools/fontindex.py -o Driver/font_index.h Driver/font_ascii_16x8.h
+同一字号中出现重复的字符时报错退出。
+"""
+
+import argparse
+import re
+import sys
+
+TABLES = ('tfont16', 'tfont24', 'tfont32')
+
+
+def scan(src, table):
+    m = re.search(r'const\s+\w+\s+%s\s*\[\s*\]\s*=\s*\{(.*?)\n\s*\};' % table, src, re.S)
+    if not m:
+        return []
+    entries = []
+    for idx, ch in enumerate(re.findall(r'\{\s*"([^"]*)"\s*,\s*\{', m.group(1))):
+        if len(ch) != 1:
+            sys.exit('%s[%d]: index "%s" is not a single character' % (table, idx, ch))
+        entries.append((ord(ch), idx, ch))
+    return entries
+
+
+def main():
+    parser = argparse.ArgumentParser(description='generate sorted glyph index for the LCD font tables')
+    parser.add_argument('font', help='font header, e.g. Driver/font_ascii_16x8.h')
+    parser.add_argument('-o', '--output', required=True, help='generated header path')
+    args = parser.parse_args()
+
+    src = open(args.font, encoding='utf-8').read()
+    out = ['/*',
+           ' * Copyright (c) 2006-2025, RT-Thread Development Team',
+           ' *',
+           ' * SPDX-License-Identifier: Apache-2.0',
+           ' *',
+           ' * 此文件由 tools/fontindex.py 根据 %s 生成，请勿手动修改' % args.font.replace('\\', '/').split('/')[-1],
+           ' */',
+           '#ifndef DRIVER_FONT_INDEX_H_',
+           '#define DRIVER_FONT_INDEX_H_',
+           '',
+           '/* 汉字索引：按 Unicode 码点升序排列，idx 为对应字库数组的下标 */',
+           'typedef struct {',
+           '    unsigned int   code;',
+           '    unsigned short idx;',
+           '} typFNT_INDEX;',
+           '']
+    for table in TABLES:
+        entries = sorted(scan(src, table))
+        for a, b in zip(entries, entries[1:]):
+            if a[0] == b[0]:
+                sys.exit('%s: duplicate glyph "%s" at [%d] and [%d]' % (table, a[2], a[1], b[1]))
+        out.append('static const typFNT_INDEX %s_index[] = {' % table)
+        for code, idx, ch in entries:
+            out.append('    {0x%04X, %3d},  /* %s */' % (code, idx, ch))
+        if not entries:
+            out.append('    {0, 0},')
+        out.append('};')
+        out.append('#define %s_INDEX_NUM %d' % (table.upper(), len(entries)))
+        out.append('')
+        print('%s: %d glyphs' % (table, len(entries)))
+    out.append('#endif /* DRIVER_FONT_INDEX_H_ */')
+    out.append('')
+    open(args.output, 'w', encoding='utf-8', newline='\n').write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2006-2025, RT-Thread Development Team
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Change Logs:
+# Date           Author       Notes
+# 2025-12-20     Voyager      the first version
+#
+"""
+图片压缩工具：把 PNG/BMP 或 pic.h 中的 RGB565 数组转换为 lcd_image_t 压缩格式头文件
+
+压缩格式(与 Driver/lcd.c 中 LCD_ShowImageCompressed 的解码器对应)：
+  - 像素按行优先排列，游程可以跨行
+  - 控制字节 c < 0x80 : 其后紧跟 c+1 个字面像素
+  - 控制字节 c >= 0x80: 其后一个像素重复 (c & 0x7F)+2 次
+  - LCD_IMG_RLE8  : 像素为 1 字节调色板索引，颜色数 <= 256 时自动选用
+  - LCD_IMG_RLE565: 像素为 2 字节 RGB565，高字节在前
+
+用法：
+  python tools/img2rle.py -o Driver/pic_rle.h Driver/pic.h
+  python tools/img2rle.py -o Driver/pic_rle.h logo.png:gImage_1 bg.bmp:gImage_2
+每个生成的图片都会重新解码并与原始像素逐一比对，不一致时报错退出。
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+LCD_IMG_RLE565 = 0
+LCD_IMG_RLE8 = 1
+
+
+def rgb888_to_565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load_c_arrays(path):
+    """读取 pic.h 风格的 const unsigned char name[N] = {...}; 数组，默认 128x128"""
+    src = open(path, encoding='utf-8', errors='ignore').read()
+    images = []
+    for m in re.finditer(r'const\s+unsigned\s+char\s+(\w+)\s*\[\s*(\d*)\s*\]\s*=\s*\{(.*?)\};', src, re.S):
+        body = re.sub(r'/\*.*?\*/', '', m.group(3), flags=re.S)
+        data = [int(x, 16) for x in re.findall(r'0[xX][0-9a-fA-F]+', body)]
+        pixels = [(data[i] << 8) | data[i + 1] for i in range(0, len(data) - 1, 2)]
+        side = int(len(pixels) ** 0.5)
+        if side * side != len(pixels):
+            raise ValueError('%s: %d pixels is not a square image' % (m.group(1), len(pixels)))
+        images.append((m.group(1), side, side, pixels))
+    return images
+
+
+def load_bmp(path):
+    raw = open(path, 'rb').read()
+    if raw[:2] != b'BM':
+        raise ValueError('%s: not a BMP file' % path)
+    offset, = struct.unpack_from('<I', raw, 10)
+    width, height, planes, bpp, compression = struct.unpack_from('<iiHHI', raw, 18)
+    if compression not in (0, 3) or bpp not in (16, 24, 32):
+        raise ValueError('%s: only uncompressed 16/24/32-bit BMP is supported' % path)
+    bottom_up = height > 0
+    height = abs(height)
+    stride = (width * bpp // 8 + 3) & ~3
+    pixels = []
+    for row in range(height):
+        y = height - 1 - row if bottom_up else row
+        base = offset + y * stride
+        for x in range(width):
+            if bpp == 16:
+                pixels.append(struct.unpack_from('<H', raw, base + x * 2)[0])
+            else:
+                b, g, r = raw[base + x * bpp // 8: base + x * bpp // 8 + 3]
+                pixels.append(rgb888_to_565(r, g, b))
+    return width, height, pixels
+
+
+def load_png(path):
+    raw = open(path, 'rb').read()
+    if raw[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+    pos, idat, plte = 8, b'', None
+    while pos < len(raw):
+        length, ctype = struct.unpack_from('>I4s', raw, pos)
+        chunk = raw[pos + 8: pos + 8 + length]
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif ctype == b'PLTE':
+            plte = chunk
+        elif ctype == b'IDAT':
+            idat += chunk
+        pos += 12 + length
+    if depth != 8 or interlace or color not in (2, 3, 6):
+        raise ValueError('%s: only 8-bit non-interlaced RGB/RGBA/indexed PNG is supported' % path)
+    channels = {2: 3, 3: 1, 6: 4}[color]
+    stride = width * channels
+    data = zlib.decompress(idat)
+    prev = bytearray(stride)
+    pixels = []
+    pos = 0
+    for _ in range(height):
+        ftype = data[pos]
+        line = bytearray(data[pos + 1: pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        for x in range(width):
+            if color == 3:
+                r, g, b = plte[line[x] * 3: line[x] * 3 + 3]
+            else:
+                r, g, b = line[x * channels: x * channels + 3]
+            pixels.append(rgb888_to_565(r, g, b))
+        prev = line
+    return width, height, pixels
+
+
+def packbits(symbols):
+    """按上文格式编码符号序列，返回控制字节与符号交织的列表"""
+    out = []
+    i, n = 0, len(symbols)
+    while i < n:
+        j = i
+        while j + 1 < n and symbols[j + 1] == symbols[i] and j - i < 128:
+            j += 1
+        if j > i:
+            out.append(('ctl', 0x80 | (j - i + 1 - 2)))
+            out.append(('sym', symbols[i]))
+            i = j + 1
+            continue
+        k = i
+        while k < n and k - i < 128 and not (k + 1 < n and symbols[k + 1] == symbols[k]):
+            k += 1
+        k = max(k, i + 1)
+        out.append(('ctl', k - i - 1))
+        out.extend(('sym', s) for s in symbols[i:k])
+        i = k
+    return out
+
+
+def encode(pixels):
+    palette = sorted(set(pixels))
+    if len(palette) <= 256:
+        index = {c: i for i, c in enumerate(palette)}
+        stream = bytes(v for _, v in packbits([index[p] for p in pixels]))
+        return LCD_IMG_RLE8, palette, stream
+    stream = bytearray()
+    for kind, v in packbits(pixels):
+        if kind == 'ctl':
+            stream.append(v)
+        else:
+            stream += bytes((v >> 8, v & 0xFF))
+    return LCD_IMG_RLE565, [], bytes(stream)
+
+
+def decode(fmt, palette, stream, count):
+    """与 lcd.c 中解码器逻辑一致，用于生成后的逐像素校验"""
+    out, p = [], 0
+    psize = 1 if fmt == LCD_IMG_RLE8 else 2
+
+    def sym():
+        nonlocal p
+        v = stream[p] if psize == 1 else (stream[p] << 8) | stream[p + 1]
+        p += psize
+        return palette[v] if fmt == LCD_IMG_RLE8 else v
+
+    while len(out) < count:
+        c = stream[p]
+        p += 1
+        if c & 0x80:
+            out.extend([sym()] * ((c & 0x7F) + 2))
+        else:
+            out.extend(sym() for _ in range(c + 1))
+    return out[:count]
+
+
+def c_bytes(data, indent='    '):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ','.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def emit(out, name, width, height, fmt, palette, stream):
+    out.append('/* %s: %dx%d, %s, %d bytes (raw %d bytes) */' %
+               (name, width, height, 'RLE8' if fmt == LCD_IMG_RLE8 else 'RLE565',
+                len(stream) + len(palette) * 2, width * height * 2))
+    if palette:
+        out.append('static const u16 %s_rle_palette[%d] = {' % (name, len(palette)))
+        for i in range(0, len(palette), 8):
+            out.append('    ' + ','.join('0x%04X' % c for c in palette[i:i + 8]) + ',')
+        out.append('};')
+    out.append('static const u8 %s_rle_data[%d] = {' % (name, len(stream)))
+    out.append(c_bytes(stream))
+    out.append('};')
+    out.append('const lcd_image_t %s_rle = {%d, %d, %s, %d, %s, %s_rle_data, sizeof(%s_rle_data)};' %
+               (name, width, height, 'LCD_IMG_RLE8' if fmt == LCD_IMG_RLE8 else 'LCD_IMG_RLE565',
+                len(palette), '%s_rle_palette' % name if palette else 'RT_NULL', name, name))
+    out.append('')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='convert images to lcd_image_t RLE headers')
+    parser.add_argument('inputs', nargs='+', help='pic.h style header, or image.png[:name] / image.bmp[:name]')
+    parser.add_argument('-o', '--output', required=True, help='generated header path')
+    args = parser.parse_args()
+
+    images = []
+    for item in args.inputs:
+        path, _, name = item.partition(':')
+        lower = path.lower()
+        if lower.endswith('.h') or lower.endswith('.c'):
+            images.extend(load_c_arrays(path))
+            continue
+        if lower.endswith('.png'):
+            w, h, px = load_png(path)
+        elif lower.endswith('.bmp'):
+            w, h, px = load_bmp(path)
+        else:
+            sys.exit('unsupported input: %s' % path)
+        name = name or re.sub(r'\W', '_', path.replace('\\', '/').split('/')[-1].rsplit('.', 1)[0])
+        images.append((name, w, h, px))
+
+    guard = 'DRIVER_' + re.sub(r'\W', '_', args.output.replace('\\', '/').split('/')[-1]).upper() + '_'
+    out = ['/*',
+           ' * Copyright (c) 2006-2025, RT-Thread Development Team',
+           ' *',
+           ' * SPDX-License-Identifier: Apache-2.0',
+           ' *',
+           ' * 此文件由 tools/img2rle.py 生成，请勿手动修改',
+           ' */',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '#include "lcd.h"',
+           '']
+    total_raw = total = 0
+    for name, w, h, px in images:
+        fmt, palette, stream = encode(px)
+        if decode(fmt, palette, stream, len(px)) != px:
+            sys.exit('%s: round-trip check failed' % name)
+        emit(out, name, w, h, fmt, palette, stream)
+        total_raw += w * h * 2
+        total += len(stream) + len(palette) * 2
+        print('%-12s %3dx%-3d %6d -> %6d bytes' % (name, w, h, w * h * 2, len(stream) + len(palette) * 2))
+    out.append('#endif /* %s */' % guard)
+    out.append('')
+    open(args.output, 'w', encoding='utf-8', newline='\n').write('\n'.join(out))
+    print('total %d -> %d bytes, all images verified pixel-exact' % (total_raw, total))
+
+
+if __name__ == '__main__':
+    main()
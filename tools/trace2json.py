@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2006-2025, RT-Thread Development Team
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Change Logs:
+# Date           Author       Notes
+# 2025-12-20     Voyager      the first version
+#
+"""
+跟踪转换工具：把 msh 命令 trace dump 的控制台输出转换为 Chrome trace JSON
+
+输入为保存下来的控制台日志，其中 "trace: begin" 与 "trace: end" 之间的 N/E 行
+由 Driver/trace.c 输出，其它行被忽略；日志中有多次导出时使用最后一次。
+
+输出(可用 chrome://tracing 或 ui.perfetto.dev 打开)，每个 CPU 一个进程：
+  - "cpu" 轨道：正在运行的线程
+  - "irq" 轨道：中断，以及在中断上下文中记录的区间与瞬时事件
+  - 每个线程一个轨道：trace_begin/trace_end 区间、trace_mark 瞬时事件、
+    阻塞在 IPC 对象上的等待区间，释放者到被唤醒线程之间画出箭头
+
+同时在标准输出打印摘要：各线程的运行时间、各区间的次数与耗时、瞬时事件时间线。
+
+用法：
+  python tools/trace2json.py console.log -o trace.json
+"""
+
+import argparse
+import json
+import re
+import sys
+
+EV_SWITCH, EV_IRQ_ENTER, EV_IRQ_LEAVE, EV_TRYTAKE, EV_TAKE, EV_PUT, \
+    EV_BEGIN, EV_END, EV_MARK, EV_SYNC = range(1, 11)
+
+FLAG_ISR = 0x80
+
+OBJ_TYPES = {2: 'sem', 3: 'mutex', 4: 'event', 5: 'mailbox', 6: 'mq'}
+
+TID_CPU = 1
+TID_IRQ = 2
+TID_THREAD = 100
+
+
+def parse(lines):
+    """返回 (res, names, events)，events 为每个 CPU 的 [time, data, type, flag, arg] 列表"""
+    block = None
+    for line in lines:
+        line = line.strip()
+        m = re.match(r'trace: begin cpus=(\d+) res=(\d+)', line)
+        if m:
+            block = {'res': int(m.group(2)), 'names': {},
+                     'events': [[] for _ in range(int(m.group(1)))], 'done': False}
+            continue
+        if block is None or block['done']:
+            continue
+        if line == 'trace: end':
+            block['done'] = True
+            continue
+        f = line.split(None, 3)
+        if len(f) == 4 and f[0] == 'N':
+            block['names'][int(f[2], 16)] = (f[1], f[3])
+        elif len(f) >= 1 and f[0] == 'E':
+            f = line.split()
+            if len(f) != 7:
+                continue
+            cpu, time, data, typ, flag, arg = [int(x, 16) for x in f[1:]]
+            if cpu < len(block['events']):
+                block['events'][cpu].append((time, data, typ, flag, arg))
+    if block is None:
+        sys.exit('no "trace: begin" found in input')
+    if not block['done']:
+        print('warning: trace dump is truncated', file=sys.stderr)
+    return block['res'], block['names'], block['events']
+
+
+def irq_name(n):
+    if n == 15:
+        return 'SysTick'
+    if n >= 16:
+        return 'IRQ%d' % (n - 16)
+    return 'irq' if n == 0 else 'exception %d' % n
+
+
+class Converter:
+    def __init__(self, res, names):
+        self.res = res
+        self.names = names
+        self.out = []
+        self.tids = {}
+        self.flow_id = 0
+        self.run_time = {}
+        self.spans = {}
+        self.marks = []
+
+    def us(self, cycles):
+        """周期数转换为微秒，res 为每周期的纳秒数乘以 10^6"""
+        return cycles * self.res / 1e9
+
+    def name(self, addr):
+        return self.names.get(addr, ('?', '0x%x' % addr))[1]
+
+    def tid(self, pid, thread):
+        key = (pid, thread)
+        if key not in self.tids:
+            self.tids[key] = TID_THREAD + len(self.tids)
+            self.meta(pid, self.tids[key], 'thread_name', self.name(thread))
+        return self.tids[key]
+
+    def meta(self, pid, tid, kind, name):
+        self.out.append({'ph': 'M', 'pid': pid, 'tid': tid, 'name': kind, 'args': {'name': name}})
+
+    def slice(self, pid, tid, name, start, end, args=None):
+        ev = {'ph': 'X', 'pid': pid, 'tid': tid, 'name': name,
+              'ts': self.us(start), 'dur': self.us(end - start)}
+        if args:
+            ev['args'] = args
+        self.out.append(ev)
+
+    def convert(self, pid, events):
+        self.meta(pid, 0, 'process_name', 'cpu%d' % pid)
+        self.meta(pid, TID_CPU, 'thread_name', 'cpu')
+        self.meta(pid, TID_IRQ, 'thread_name', 'irq')
+        if not events:
+            return
+
+        # 32 位周期计数展开为单调时间，相邻事件间隔不超过一圈
+        t0 = events[0][0]
+        now = 0
+        prev = t0
+        cur = None              # 正在运行的线程
+        cur_start = 0
+        irq_stack = []          # (异常号, 开始时间)
+        span_stack = {}         # 轨道 -> [(名称, 开始时间)]
+        pending = {}            # 线程 -> [对象, 开始时间, 期间是否被切出]
+        last_put = {}           # 对象 -> (时间, 轨道)
+
+        for time, data, typ, flag, arg in events:
+            now += (time - prev) & 0xFFFFFFFF
+            prev = time
+            in_isr = bool(irq_stack) or (flag & FLAG_ISR and typ >= EV_BEGIN)
+            track = TID_IRQ if in_isr or cur is None else self.tid(pid, cur)
+
+            if typ == EV_SWITCH:
+                if cur is not None:
+                    self.slice(pid, TID_CPU, self.name(cur), cur_start, now)
+                    self.run_time[self.name(cur)] = self.run_time.get(self.name(cur), 0) + now - cur_start
+                    if cur in pending:
+                        pending[cur][2] = True
+                cur, cur_start = data, now
+                self.tid(pid, cur)
+            elif typ == EV_IRQ_ENTER:
+                irq_stack.append((data, now))
+            elif typ == EV_IRQ_LEAVE:
+                if irq_stack:
+                    n, start = irq_stack.pop()
+                    self.slice(pid, TID_IRQ, irq_name(n), start, now)
+            elif typ == EV_TRYTAKE:
+                if not in_isr and cur is not None:
+                    pending[cur] = [data, now, False]
+            elif typ == EV_TAKE:
+                p = pending.pop(cur, None) if not in_isr else None
+                if p and p[0] == data and p[2]:
+                    obj = '%s %s' % (OBJ_TYPES.get(flag, 'obj'), self.name(data))
+                    self.slice(pid, track, 'wait ' + obj, p[1], now)
+                    put = last_put.get(data)
+                    if put and put[0] >= p[1]:
+                        self.flow_id += 1
+                        self.out.append({'ph': 's', 'pid': pid, 'tid': put[1], 'ts': self.us(put[0]),
+                                         'name': obj, 'cat': 'ipc', 'id': self.flow_id})
+                        self.out.append({'ph': 'f', 'pid': pid, 'tid': track, 'ts': self.us(now),
+                                         'name': obj, 'cat': 'ipc', 'id': self.flow_id, 'bp': 'e'})
+            elif typ == EV_PUT:
+                last_put[data] = (now, track)
+            elif typ == EV_BEGIN:
+                span_stack.setdefault(track, []).append((data, now))
+            elif typ == EV_END:
+                stack = span_stack.get(track, [])
+                for i in range(len(stack) - 1, -1, -1):
+                    if stack[i][0] == data:
+                        name, start = stack.pop(i)
+                        self.slice(pid, track, self.name(name), start, now)
+                        s = self.spans.setdefault(self.name(name), [0, 0, 0])
+                        s[0] += 1
+                        s[1] += now - start
+                        s[2] = max(s[2], now - start)
+                        break
+            elif typ == EV_MARK:
+                self.out.append({'ph': 'i', 'pid': pid, 'tid': track, 'name': self.name(data),
+                                 's': 't', 'ts': self.us(now), 'args': {'value': arg}})
+                self.marks.append((now, self.name(data), arg,
+                                   'irq' if track == TID_IRQ else self.name(cur)))
+
+        # 收尾：未结束的运行区间与打点区间截止到最后一个事件
+        if cur is not None:
+            self.slice(pid, TID_CPU, self.name(cur), cur_start, now)
+            self.run_time[self.name(cur)] = self.run_time.get(self.name(cur), 0) + now - cur_start
+        for track, stack in span_stack.items():
+            for name, start in stack:
+                self.slice(pid, track, self.name(name) + ' (unfinished)', start, now)
+        self.length = now
+
+    def summary(self):
+        total = getattr(self, 'length', 0) or 1
+        print('window: %.3f ms' % (self.us(total) / 1000))
+        print('\n%-12s %10s %6s' % ('thread', 'run ms', 'cpu%'))
+        for name, t in sorted(self.run_time.items(), key=lambda x: -x[1]):
+            print('%-12s %10.3f %6.1f' % (name, self.us(t) / 1000, 100.0 * t / total))
+        if self.spans:
+            print('\n%-12s %6s %10s %10s %10s' % ('span', 'count', 'total ms', 'avg us', 'max us'))
+            for name, (n, t, mx) in sorted(self.spans.items(), key=lambda x: -x[1][1]):
+                print('%-12s %6d %10.3f %10.1f %10.1f' % (name, n, self.us(t) / 1000, self.us(t) / n, self.us(mx)))
+        if self.marks:
+            print('\n%10s  %-12s %6s  %s' % ('ms', 'mark', 'value', 'context'))
+            for t, name, arg, ctx in self.marks:
+                print('%10.3f  %-12s %6d  %s' % (self.us(t) / 1000, name, arg, ctx))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='convert "trace dump" console output to Chrome trace JSON')
+    parser.add_argument('log', help='console log containing the trace dump')
+    parser.add_argument('-o', '--output', default='trace.json', help='output file (default trace.json)')
+    parser.add_argument('-q', '--quiet', action='store_true', help='do not print the summary')
+    args = parser.parse_args()
+
+    with open(args.log, 'r', errors='replace') as f:
+        res, names, events = parse(f)
+
+    conv = Converter(res, names)
+    for cpu, evs in enumerate(events):
+        conv.convert(cpu, evs)
+
+    with open(args.output, 'w') as f:
+        json.dump({'traceEvents': conv.out, 'displayTimeUnit': 'ns'}, f)
+    print('%s: %d events' % (args.output, sum(len(e) for e in events)))
+    if not args.quiet:
+        conv.summary()
+
+
+if __name__ == '__main__':
+    main()